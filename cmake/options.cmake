@@ -5,6 +5,7 @@ option(RETDEC_DOC "Build public API documentation (requires Doxygen)." OFF)
 option(RETDEC_TESTS "Build tests." OFF)
 option(RETDEC_DEV_TOOLS "Build dev tools." OFF)
 option(RETDEC_COMPILE_YARA "Compile YARA rules at installation." ON)
+option(RETDEC_COMPILE_CTYPES "Precompile C-types databases at installation." ON)
 option(RETDEC_MSVC_STATIC_RUNTIME "Use a multi-threaded statically-linked runtime library." OFF)
 
 # Component options.
@@ -19,6 +20,7 @@ option(RETDEC_ENABLE_COMMON "" OFF)
 option(RETDEC_ENABLE_CONFIG "" OFF)
 option(RETDEC_ENABLE_CPDETECT "" OFF)
 option(RETDEC_ENABLE_CTYPES "" OFF)
+option(RETDEC_ENABLE_CTYPESCOMPILERTOOL "" OFF)
 option(RETDEC_ENABLE_CTYPESPARSER "" OFF)
 option(RETDEC_ENABLE_DEBUGFORMAT "" OFF)
 option(RETDEC_ENABLE_DEMANGLER "" OFF)
@@ -26,6 +28,7 @@ option(RETDEC_ENABLE_DEMANGLERTOOL "" OFF)
 option(RETDEC_ENABLE_FILEFORMAT "" OFF)
 option(RETDEC_ENABLE_FILEINFO "" OFF)
 option(RETDEC_ENABLE_GETSIG "" OFF)
+option(RETDEC_ENABLE_HLLTOKENS "" OFF)
 option(RETDEC_ENABLE_IDR2PAT "" OFF)
 option(RETDEC_ENABLE_LLVM_SUPPORT "" OFF)
 option(RETDEC_ENABLE_LLVMIR_EMUL "" OFF)
@@ -44,6 +47,7 @@ option(RETDEC_ENABLE_RTTI_FINDER "" OFF)
 option(RETDEC_ENABLE_SERDES "" OFF)
 option(RETDEC_ENABLE_STACOFIN "" OFF)
 option(RETDEC_ENABLE_STACOFINTOOL "" OFF)
+option(RETDEC_ENABLE_TOKENS2JSONTOOL "" OFF)
 option(RETDEC_ENABLE_UNPACKER "" OFF)
 option(RETDEC_ENABLE_UNPACKERTOOL "" OFF)
 option(RETDEC_ENABLE_UTILS "" OFF)
@@ -76,6 +80,7 @@ foreach(t ${RETDEC_ENABLE})
 	set_if_equal(${t} "config" RETDEC_ENABLE_CONFIG)
 	set_if_equal(${t} "cpdetect" RETDEC_ENABLE_CPDETECT)
 	set_if_equal(${t} "ctypes" RETDEC_ENABLE_CTYPES)
+	set_if_equal(${t} "ctypescompilertool" RETDEC_ENABLE_CTYPESCOMPILERTOOL)
 	set_if_equal(${t} "ctypesparser" RETDEC_ENABLE_CTYPESPARSER)
 	set_if_equal(${t} "debugformat" RETDEC_ENABLE_DEBUGFORMAT)
 	set_if_equal(${t} "demangler" RETDEC_ENABLE_DEMANGLER)
@@ -83,6 +88,7 @@ foreach(t ${RETDEC_ENABLE})
 	set_if_equal(${t} "fileformat" RETDEC_ENABLE_FILEFORMAT)
 	set_if_equal(${t} "fileinfo" RETDEC_ENABLE_FILEINFO)
 	set_if_equal(${t} "getsig" RETDEC_ENABLE_GETSIG)
+	set_if_equal(${t} "hlltokens" RETDEC_ENABLE_HLLTOKENS)
 	set_if_equal(${t} "idr2pat" RETDEC_ENABLE_IDR2PAT)
 	set_if_equal(${t} "llvmir-emul" RETDEC_ENABLE_LLVMIR_EMUL)
 	set_if_equal(${t} "llvmir2hll" RETDEC_ENABLE_LLVMIR2HLL)
@@ -100,6 +106,7 @@ foreach(t ${RETDEC_ENABLE})
 	set_if_equal(${t} "serdes" RETDEC_ENABLE_SERDES)
 	set_if_equal(${t} "stacofin" RETDEC_ENABLE_STACOFIN)
 	set_if_equal(${t} "stacofintool" RETDEC_ENABLE_STACOFINTOOL)
+	set_if_equal(${t} "tokens2jsontool" RETDEC_ENABLE_TOKENS2JSONTOOL)
 	set_if_equal(${t} "unpacker" RETDEC_ENABLE_UNPACKER)
 	set_if_equal(${t} "unpackertool" RETDEC_ENABLE_UNPACKERTOOL)
 	set_if_equal(${t} "utils" RETDEC_ENABLE_UTILS)
@@ -118,6 +125,7 @@ if (RETDEC_ENABLE_AR_EXTRACTOR
 	OR RETDEC_ENABLE_CONFIG
 	OR RETDEC_ENABLE_CPDETECT
 	OR RETDEC_ENABLE_CTYPES
+	OR RETDEC_ENABLE_CTYPESCOMPILERTOOL
 	OR RETDEC_ENABLE_CTYPESPARSER
 	OR RETDEC_ENABLE_DEBUGFORMAT
 	OR RETDEC_ENABLE_DEMANGLER
@@ -125,6 +133,7 @@ if (RETDEC_ENABLE_AR_EXTRACTOR
 	OR RETDEC_ENABLE_FILEFORMAT
 	OR RETDEC_ENABLE_FILEINFO
 	OR RETDEC_ENABLE_GETSIG
+	OR RETDEC_ENABLE_HLLTOKENS
 	OR RETDEC_ENABLE_IDR2PAT
 	OR RETDEC_ENABLE_LLVM_SUPPORT
 	OR RETDEC_ENABLE_LLVMIR_EMUL
@@ -143,6 +152,7 @@ if (RETDEC_ENABLE_AR_EXTRACTOR
 	OR RETDEC_ENABLE_SERDES
 	OR RETDEC_ENABLE_STACOFIN
 	OR RETDEC_ENABLE_STACOFINTOOL
+	OR RETDEC_ENABLE_TOKENS2JSONTOOL
 	OR RETDEC_ENABLE_UNPACKER
 	OR RETDEC_ENABLE_UNPACKERTOOL
 	OR RETDEC_ENABLE_UTILS
@@ -194,6 +204,9 @@ if(RETDEC_DEV_TOOLS)
 			RETDEC_ENABLE_ALL)
 endif()
 
+set_if_at_least_one_set(RETDEC_ENABLE_CTYPESCOMPILERTOOL
+		RETDEC_ENABLE_ALL)
+
 if(RETDEC_DEV_TOOLS)
 	set_if_at_least_one_set(RETDEC_ENABLE_DEMANGLERTOOL
 			RETDEC_ENABLE_ALL)
@@ -225,6 +238,9 @@ endif()
 set_if_at_least_one_set(RETDEC_ENABLE_STACOFINTOOL
 		RETDEC_ENABLE_ALL)
 
+set_if_at_least_one_set(RETDEC_ENABLE_TOKENS2JSONTOOL
+		RETDEC_ENABLE_ALL)
+
 set_if_at_least_one_set(RETDEC_ENABLE_UNPACKERTOOL
 		RETDEC_ENABLE_ALL)
 
@@ -293,6 +309,7 @@ set_if_at_least_one_set(RETDEC_ENABLE_DEMANGLER
 set_if_at_least_one_set(RETDEC_ENABLE_CTYPESPARSER
 		RETDEC_ENABLE_ALL
 		RETDEC_ENABLE_BIN2LLVMIR
+		RETDEC_ENABLE_CTYPESCOMPILERTOOL
 		RETDEC_ENABLE_DEMANGLER)
 
 set_if_at_least_one_set(RETDEC_ENABLE_CTYPES
@@ -328,6 +345,11 @@ set_if_at_least_one_set(RETDEC_ENABLE_PELIB
 		RETDEC_ENABLE_FILEFORMAT
 		RETDEC_ENABLE_UNPACKERTOOL)
 
+set_if_at_least_one_set(RETDEC_ENABLE_HLLTOKENS
+		RETDEC_ENABLE_ALL
+		RETDEC_ENABLE_LLVMIR2HLL
+		RETDEC_ENABLE_TOKENS2JSONTOOL)
+
 set_if_at_least_one_set(RETDEC_ENABLE_LLVM_SUPPORT
 		RETDEC_ENABLE_ALL
 		RETDEC_ENABLE_BIN2LLVMIR
@@ -366,19 +388,24 @@ set_if_at_least_one_set(RETDEC_ENABLE_UTILS
 		RETDEC_ENABLE_CONFIG
 		RETDEC_ENABLE_COMMON
 		RETDEC_ENABLE_CTYPES
+		RETDEC_ENABLE_CTYPESCOMPILERTOOL
 		RETDEC_ENABLE_CTYPESPARSER
 		RETDEC_ENABLE_FILEFORMAT
 		RETDEC_ENABLE_FILEINFO
+		RETDEC_ENABLE_HLLTOKENS
 		RETDEC_ENABLE_IDR2PAT
 		RETDEC_ENABLE_LLVM_SUPPORT
 		RETDEC_ENABLE_LLVMIR2HLL
 		RETDEC_ENABLE_LOADER
 		RETDEC_ENABLE_MACHO_EXTRACTOR
 		RETDEC_ENABLE_MACHO_EXTRACTORTOOL
+		RETDEC_ENABLE_PDBPARSER
+		RETDEC_ENABLE_PELIB
 		RETDEC_ENABLE_CPDETECT
 		RETDEC_ENABLE_PATTERNGEN
 		RETDEC_ENABLE_RTTI_FINDER
 		RETDEC_ENABLE_STACOFIN
+		RETDEC_ENABLE_TOKENS2JSONTOOL
 		RETDEC_ENABLE_UNPACKERTOOL)
 
 set_if_at_least_one_set(RETDEC_ENABLE_YARACPP
@@ -403,12 +430,18 @@ set_if_all_set(RETDEC_ENABLE_CTYPES_TESTS
 set_if_all_set(RETDEC_ENABLE_CTYPESPARSER_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_CTYPESPARSER)
+set_if_all_set(RETDEC_ENABLE_DEBUGFORMAT_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_DEBUGFORMAT)
 set_if_all_set(RETDEC_ENABLE_DEMANGLER_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_DEMANGLER)
 set_if_all_set(RETDEC_ENABLE_FILEFORMAT_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_FILEFORMAT)
+set_if_all_set(RETDEC_ENABLE_HLLTOKENS_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_HLLTOKENS)
 set_if_all_set(RETDEC_ENABLE_LLVMIR_EMUL_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_LLVMIR_EMUL)
@@ -418,12 +451,24 @@ set_if_all_set(RETDEC_ENABLE_LLVMIR2HLL_TESTS
 set_if_all_set(RETDEC_ENABLE_LOADER_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_LOADER)
+set_if_all_set(RETDEC_ENABLE_PDBPARSER_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_PDBPARSER)
+set_if_all_set(RETDEC_ENABLE_PELIB_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_PELIB)
+set_if_all_set(RETDEC_ENABLE_RTTI_FINDER_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_RTTI_FINDER)
 set_if_all_set(RETDEC_ENABLE_SERDES_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_SERDES)
 set_if_all_set(RETDEC_ENABLE_UNPACKER_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_UNPACKER)
+set_if_all_set(RETDEC_ENABLE_UNPACKERTOOL_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_UNPACKERTOOL)
 set_if_all_set(RETDEC_ENABLE_COMMON_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_COMMON)
@@ -450,13 +495,19 @@ set_if_at_least_one_set(RETDEC_ENABLE_GOOGLETEST
 		RETDEC_ENABLE_CONFIG_TESTS
 		RETDEC_ENABLE_CTYPES_TESTS
 		RETDEC_ENABLE_CTYPESPARSER_TESTS
+		RETDEC_ENABLE_DEBUGFORMAT_TESTS
 		RETDEC_ENABLE_DEMANGLER_TESTS
 		RETDEC_ENABLE_FILEFORMAT_TESTS
+		RETDEC_ENABLE_HLLTOKENS_TESTS
 		RETDEC_ENABLE_LLVMIR_EMUL_TESTS
 		RETDEC_ENABLE_LLVMIR2HLL_TESTS
 		RETDEC_ENABLE_LOADER_TESTS
+		RETDEC_ENABLE_PDBPARSER_TESTS
+		RETDEC_ENABLE_PELIB_TESTS
+		RETDEC_ENABLE_RTTI_FINDER_TESTS
 		RETDEC_ENABLE_SERDES_TESTS
 		RETDEC_ENABLE_UNPACKER_TESTS
+		RETDEC_ENABLE_UNPACKERTOOL_TESTS
 		RETDEC_ENABLE_UTILS_TESTS)
 
 set_if_at_least_one_set(RETDEC_ENABLE_KEYSTONE
@@ -482,6 +533,7 @@ set_if_at_least_one_set(RETDEC_ENABLE_RAPIDJSON
 		RETDEC_ENABLE_CONFIG
 		RETDEC_ENABLE_CTYPESPARSER
 		RETDEC_ENABLE_FILEINFO
+		RETDEC_ENABLE_HLLTOKENS
 		RETDEC_ENABLE_MACHO_EXTRACTOR
 		RETDEC_ENABLE_MACHO_EXTRACTORTOOL
 		RETDEC_ENABLE_SERDES)
@@ -19,6 +19,15 @@
 namespace retdec {
 namespace ar_extractor {
 
+/**
+ * Object file stored in archive. Its data are owned by the archive.
+ */
+struct ArchiveObject
+{
+	std::string name; ///< Fixed name, unique within the archive.
+	llvm::StringRef data; ///< Content of the object file.
+};
+
 /**
  * Class for reading archives using llvm::Archive.
  */
@@ -27,6 +36,8 @@ class ArchiveWrapper : private retdec::utils::NonCopyable
 	public:
 		ArchiveWrapper(const std::string &archivePath, bool &succes,
 			std::string &errorMessage);
+		ArchiveWrapper(llvm::MemoryBufferRef archiveData, bool &succes,
+			std::string &errorMessage);
 
 		/// @brief Getters.
 		/// @{
@@ -57,6 +68,12 @@ class ArchiveWrapper : private retdec::utils::NonCopyable
 			const std::string &outputPath = "") const;
 		/// @}
 
+		/// @brief In-memory access methods.
+		/// @{
+		bool getObjects(std::vector<ArchiveObject> &result,
+			std::string &errorMessage) const;
+		/// @}
+
 	private:
 		/// LLVM archive parser.
 		std::unique_ptr<llvm::object::Archive> archive;
@@ -65,6 +82,7 @@ class ArchiveWrapper : private retdec::utils::NonCopyable
 
 		/// @brief Auxiliary methods.
 		/// @{
+		bool init(std::string &errorMessage);
 		bool getNames(std::vector<std::string> &result,
 			std::string &errorMessage) const;
 		bool getCount(std::size_t &count, std::string &errorMessage) const;
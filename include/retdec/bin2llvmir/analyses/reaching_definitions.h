@@ -3,9 +3,8 @@
 * @brief Reaching definitions analysis (RDA) builds UD and DU chains.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 *
-* Right now, this works on an entire module. But we could insert an another layer
-* that represents functions. Then it would be possible to associate BBs with
-* functions that own them and recompute RDA only for the selected function.
+* Results are kept for each function separately. update() recomputes only
+* functions that were changed since the last computation.
 */
 
 #ifndef RETDEC_BIN2LLVMIR_ANALYSES_REACHING_DEFINITIONS_H
@@ -119,6 +118,20 @@ class BasicBlockEntry
 
 class ReachingDefinitionsAnalysis
 {
+	public:
+		/// Statistics of a single update() call.
+		struct UpdateStats
+		{
+			/// Number of functions whose results were (re)computed.
+			std::size_t recomputed = 0;
+			/// Number of functions whose results were reused.
+			std::size_t reused = 0;
+			/// Time (in seconds) spent by the update.
+			double time = 0.0;
+			/// Time (in seconds) the reused results took to compute.
+			double saved = 0.0;
+		};
+
 	public:
 		bool runOnModule(
 				llvm::Module& M,
@@ -128,6 +141,11 @@ class ReachingDefinitionsAnalysis
 				llvm::Function& F,
 				Abi* abi = nullptr,
 				bool trackFlagRegs = false);
+		UpdateStats update(
+				llvm::Module& M,
+				Abi* abi = nullptr,
+				bool trackFlagRegs = false);
+		void invalidate(const llvm::Function* F);
 		void clear();
 		bool wasRun() const;
 
@@ -152,24 +170,124 @@ class ReachingDefinitionsAnalysis
 				llvm::Instruction* I);
 
 	private:
-		void run();
+		using BasicBlockMap = std::map<const llvm::BasicBlock*, BasicBlockEntry>;
+
+		/// State of the results computed for a single function.
+		struct FunctionState
+		{
+			/// Hash of the function body the results were computed for.
+			std::size_t hash = 0;
+			/// Time (in seconds) the computation took.
+			double time = 0.0;
+		};
+
+	private:
+		void setUp(llvm::Module* M, Abi* abi, bool trackFlagRegs);
+		void compute(llvm::Function& F, BasicBlockMap& bbs);
+		void run(const llvm::Function* F, BasicBlockMap& bbs);
 		const BasicBlockEntry& getBasicBlockEntry(const llvm::Instruction* I) const;
-		void initializeBasicBlocks(llvm::Module& M);
-		void initializeBasicBlocks(llvm::Function& F);
-		void initializeBasicBlocksPrev();
-		void initializeKillGenSets();
-		void propagate();
-		void initializeDefsAndUses();
-		void clearInternal();
+		void initializeBasicBlocks(llvm::Function& F, BasicBlockMap& bbs);
+		void initializeBasicBlocksPrev(BasicBlockMap& bbs);
+		void initializeKillGenSets(BasicBlockMap& bbs);
+		void propagate(const llvm::Function* F, BasicBlockMap& bbs);
+		void initializeDefsAndUses(BasicBlockMap& bbs);
+		void clearInternal(BasicBlockMap& bbs);
 
 	private:
-		std::map<const llvm::Function*, std::map<const llvm::BasicBlock*, BasicBlockEntry>> bbMap;
+		std::map<const llvm::Function*, BasicBlockMap> bbMap;
+		/// Functions with up-to-date results, see update().
+		std::map<const llvm::Function*, FunctionState> _functionStates;
+		const llvm::Module* _module = nullptr;
 		bool _trackFlagRegs = false;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
 		bool _run = false;
 		Abi* _abi = nullptr;
 };
 
+/**
+ * Memoized on-demand reaching definitions.
+ *
+ * It answers the same queries as the on-demand static interface of
+ * ReachingDefinitionsAnalysis, but each basic block is scanned only once
+ * (for all registers and allocas at the same time) and searches through the
+ * control flow graph are remembered for each basic block and value. Results
+ * of repeated queries are returned right away.
+ *
+ * The cache is not notified about IR changes. Its owner has to call
+ * invalidate() whenever instructions or basic blocks of an already queried
+ * function are added, removed, or modified. Returned sets are valid until
+ * the cache is invalidated.
+ */
+class OnDemandRdaCache
+{
+	public:
+		const std::set<llvm::Instruction*>& defsFromUse(llvm::Instruction* I);
+		const std::set<llvm::Instruction*>& usesFromDef(llvm::Instruction* I);
+
+		void invalidate();
+		void invalidate(const llvm::Function* f);
+
+	private:
+		/// Definitions and uses of values in a single basic block.
+		struct BasicBlockSummary
+		{
+			/// The last definition of a value in the block.
+			std::unordered_map<const llvm::Value*, llvm::Instruction*> lastDefs;
+			/// Uses of a value before the first store to it in the block.
+			std::unordered_map<const llvm::Value*,
+					std::vector<llvm::Instruction*>> exposedUses;
+			/// Values stored to in the block.
+			std::unordered_set<const llvm::Value*> kills;
+		};
+
+		/// Uses of a definition in its basic block.
+		struct LocalUses
+		{
+			std::vector<llvm::Instruction*> uses;
+			/// Is the definition killed by another one in the block?
+			bool killed = false;
+		};
+
+		using BlockValue = std::pair<const llvm::BasicBlock*, const llvm::Value*>;
+
+		struct FunctionCache
+		{
+			std::unordered_map<const llvm::BasicBlock*, BasicBlockSummary> blocks;
+			/// Definition of a load's value in the load's block, or nullptr.
+			std::unordered_map<const llvm::Instruction*, llvm::Instruction*> localDefs;
+			/// Uses of a definition in the definition's block.
+			std::unordered_map<const llvm::Instruction*, LocalUses> localUses;
+			/// Definitions of a value reaching the block's entry.
+			std::map<BlockValue, std::set<llvm::Instruction*>> defsIn;
+			/// Uses of a value reachable from the block's exit.
+			std::map<BlockValue, std::set<llvm::Instruction*>> usesOut;
+			/// Results of queries.
+			std::unordered_map<const llvm::Instruction*,
+					std::set<llvm::Instruction*>> defsFromUse;
+			std::unordered_map<const llvm::Instruction*,
+					std::set<llvm::Instruction*>> usesFromDef;
+		};
+
+	private:
+		FunctionCache& getFunctionCache(const llvm::Function* f);
+		BasicBlockSummary& getSummary(FunctionCache& fc, llvm::BasicBlock* bb);
+		void summarize(
+				FunctionCache& fc,
+				llvm::BasicBlock* bb,
+				BasicBlockSummary& summary);
+		const std::set<llvm::Instruction*>& getDefsIn(
+				FunctionCache& fc,
+				llvm::BasicBlock* bb,
+				llvm::Value* v);
+		const std::set<llvm::Instruction*>& getUsesOut(
+				FunctionCache& fc,
+				llvm::BasicBlock* bb,
+				llvm::Value* v);
+
+	private:
+		std::unordered_map<const llvm::Function*, FunctionCache> _functions;
+};
+
 } // namespace bin2llvmir
 } // namespace retdec
 
@@ -38,6 +38,11 @@ namespace bin2llvmir {
  * In such a case, global data members and global behaviour configuration is
  * not a problem. If you, for whatever reason, want to store instances, keep
  * this in mind.
+ *
+ * Trees may be constructed and simplified in several threads at the same
+ * time, provided that the configuration is not changed and nothing modifies
+ * the IR meanwhile. Per-construction state is thread-local, and constants are
+ * created in the LLVM context under @c getLlvmContextMutex().
  */
 class SymbolicTree
 {
@@ -74,10 +79,15 @@ class SymbolicTree
 		 * constructed.
 		 * Otherwise, it is much more efficient to precompute RDA before trees
 		 * are constructed.
+		 * If @a cache is given, results of on-demand RDA queries are shared
+		 * with other trees constructed with the same cache (the caller is
+		 * responsible for its invalidation). Otherwise, they are shared only
+		 * within this tree.
 		 */
 		static SymbolicTree OnDemandRda(
 				llvm::Value* v,
-				unsigned maxNodeLevel = 10
+				unsigned maxNodeLevel = 10,
+				OnDemandRdaCache* cache = nullptr
 		);
 		/**
 		 * A lightweight construction method where no RDA is used.
@@ -149,7 +159,9 @@ class SymbolicTree
 	private:
 		static Abi* _abi;
 		static Config* _config;
-		static bool _val2valUsed;
+		/// On-demand RDA used while a tree is constructed by OnDemandRda().
+		static thread_local OnDemandRdaCache* _onDemandRda;
+		static thread_local bool _val2valUsed;
 		static bool _trackThroughAllocaLoads;
 		static bool _trackThroughGeneralRegisterLoads;
 		static bool _trackOnlyFlagRegisters;
@@ -38,13 +38,47 @@ class ConstantsAnalysis : public llvm::ModulePass
 				FileImage* i,
 				DebugFormat* d);
 
+	private:
+		/// Use of a value found by the analysis, to be replaced by a global
+		/// variable.
+		struct GlobalUse
+		{
+			/// Instruction using the value.
+			llvm::Instruction* inst = nullptr;
+			/// Operand of the instruction.
+			llvm::Value* val = nullptr;
+			/// Is the value stored by the instruction?
+			bool storeValue = false;
+			/// Maximal integer in the simplified symbolic tree of the value,
+			/// which is an address of data in the image.
+			llvm::ConstantInt* maxC = nullptr;
+			/// Is @c maxC the root of the tree (the whole value)?
+			bool maxIsRoot = false;
+			/// User of @c maxC, if it is not the root.
+			llvm::Instruction* userI = nullptr;
+			/// Global variable the value resolved to.
+			llvm::GlobalVariable* gv = nullptr;
+		};
+
+		/// Global uses found in a single function.
+		struct FunctionUses
+		{
+			llvm::Function* function = nullptr;
+			std::vector<GlobalUse> uses;
+		};
+
 	private:
 		bool run();
+		void analyzeFunction(
+				ReachingDefinitionsAnalysis& RDA,
+				FunctionUses& fu) const;
 		void checkForGlobalInInstruction(
 				ReachingDefinitionsAnalysis& RDA,
 				llvm::Instruction* inst,
 				llvm::Value* val,
-				bool storeValue = false);
+				std::vector<GlobalUse>& uses,
+				bool storeValue = false) const;
+		void applyGlobalUse(const GlobalUse& use);
 		void tagFunctionsWithUsedCryptoGlobals();
 
 	private:
@@ -191,6 +191,7 @@ class Decoder : public llvm::ModulePass
 				const JumpTarget& jt,
 				ByteData bytes,
 				bool strict = false);
+		void setDeadFlags_x86(ByteData bytes, common::Address addr);
 
 	// ARM specific.
 	//
@@ -299,6 +300,9 @@ class Decoder : public llvm::ModulePass
 
 		std::unique_ptr<capstone2llvmir::Capstone2LlvmIrTranslator> _c2l;
 		cs_insn* _dryCsInsn = nullptr;
+		/// Dead x86 flags of instructions in the last analysed window.
+		/// Used only if lazy flags are enabled.
+		std::map<common::Address, uint32_t> _deadFlags;
 
 		llvm::IRBuilder<>* _irb;
 
@@ -333,6 +337,10 @@ class Decoder : public llvm::ModulePass
 		// eventually jump to.
 		std::map<llvm::BasicBlock*, llvm::BasicBlock*> _likelyBb2Target;
 
+		/// On-demand RDA shared by symbolic trees of a single jump target
+		/// computation. It is invalidated before IR gets modified.
+		OnDemandRdaCache _rdaCache;
+
 		// TODO: remove, solve better.
 		bool _switchGenerated = false;
 
@@ -8,6 +8,9 @@
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_IDIOMS_IDIOMS_ANALYSIS_H
 
 #include <cstdio>
+#include <initializer_list>
+#include <utility>
+#include <vector>
 
 #include <llvm/ADT/Statistic.h>
 #include <llvm/IR/BasicBlock.h>
@@ -43,12 +46,43 @@ public:
 	IdiomsAnalysis(llvm::Module * M, CC_compiler cc, CC_arch arch)
 	{
 		init(M, cc, arch);
+		initIdioms();
 	}
 	virtual bool doAnalysis(llvm::Function & f, llvm::Pass * p) override;
 
 private:
+	using Exchanger = llvm::Instruction * (IdiomsAnalysis::*)(llvm::BasicBlock::iterator) const;
+
+	/**
+	 * Basic block idiom exchanger and opcodes of the instructions it
+	 * can replace (the roots of its idiom trees).
+	 */
+	struct Idiom {
+		Exchanger exchanger = nullptr;
+		const char * name = nullptr;
+		std::vector<unsigned> opcodes;
+	};
+
+	/**
+	 * Instructions of a basic block indexed by their opcodes. Instructions
+	 * of every opcode are kept in the basic block order together with their
+	 * position in the block.
+	 */
+	using IndexedInstruction = std::pair<std::size_t, llvm::Instruction *>;
+	using OpcodeIndex = std::vector<std::vector<IndexedInstruction>>;
+
+	void initIdioms();
+	void addIdiom(Exchanger exchanger, const char * name, std::initializer_list<unsigned> opcodes);
+	static void indexBasicBlock(llvm::BasicBlock & bb, OpcodeIndex & index);
+
 	bool analyse(llvm::Function & f, llvm::Pass * p, int (IdiomsAnalysis::*exchanger)(llvm::Function &, llvm::Pass *) const, const char * fname);
-	bool analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname);
+	bool analyse(const Idiom & idiom, const OpcodeIndex & index);
+	void exchange(llvm::BasicBlock::iterator insn, llvm::Instruction * res);
+
+private:
+	/// Basic block idioms applicable to the compiler and architecture,
+	/// in the order in which they have to be exchanged.
+	std::vector<Idiom> m_idioms;
 };
 
 } // namespace bin2llvmir
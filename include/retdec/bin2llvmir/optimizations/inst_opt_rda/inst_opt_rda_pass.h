@@ -12,6 +12,7 @@
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
 
+#include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/providers/abi/abi.h"
 
 namespace retdec {
@@ -27,7 +28,9 @@ class InstructionRdaOptimizer : public llvm::ModulePass
 
 	private:
 		bool run();
-		bool runOnFunction(llvm::Function* f);
+		bool runOnFunction(
+				llvm::Function* f,
+				ReachingDefinitionsAnalysis& RDA);
 
 	private:
 		llvm::Module* _module = nullptr;
@@ -107,7 +107,7 @@ class ParamReturn : public llvm::ModulePass
 		Demangler* _demangler = nullptr;
 
 		std::map<llvm::Value*, DataFlowEntry> _fnc2calls;
-		ReachingDefinitionsAnalysis _RDA;
+		ReachingDefinitionsAnalysis* _RDA = nullptr;
 		Collector::Ptr _collector;
 };
 
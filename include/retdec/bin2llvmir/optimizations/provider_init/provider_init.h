@@ -7,6 +7,8 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_PROVIDER_INIT_PROVIDER_INIT_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_PROVIDER_INIT_PROVIDER_INIT_H
 
+#include <memory>
+
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
 
@@ -17,6 +19,11 @@ namespace config {
 class Config;
 
 } // namespace config
+namespace fileformat {
+
+class FileFormat;
+
+} // namespace fileformat
 namespace bin2llvmir {
 
 class ProviderInitialization : public llvm::ModulePass
@@ -28,9 +35,12 @@ class ProviderInitialization : public llvm::ModulePass
 		virtual bool doFinalization(llvm::Module& m) override;
 
 		void setConfig(retdec::config::Config* c);
+		void setInputFile(
+				const std::shared_ptr<retdec::fileformat::FileFormat>& f);
 
 	private:
 		retdec::config::Config* _config = nullptr;
+		std::shared_ptr<retdec::fileformat::FileFormat> _inputFile;
 };
 
 } // namespace bin2llvmir
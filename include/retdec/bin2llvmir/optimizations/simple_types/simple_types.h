@@ -220,7 +220,7 @@ class SimpleTypesAnalysis : public llvm::ModulePass
 		EqSetContainer eqSets;
 		ValuePairList val2PtrVal;
 
-		ReachingDefinitionsAnalysis RDA;
+		ReachingDefinitionsAnalysis* RDA = nullptr;
 		llvm::Module* module = nullptr;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
 		Config* config = nullptr;
@@ -9,6 +9,7 @@
 
 #include <optional>
 #include <unordered_set>
+#include <vector>
 
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
@@ -33,21 +34,52 @@ class StackAnalysis : public llvm::ModulePass
 				Abi* abi,
 				DebugFormat* dbgf = nullptr);
 
+	private:
+		/// Stack access found by the analysis, to be replaced by a stack
+		/// variable.
+		struct StackAccess
+		{
+			/// Instruction accessing the stack.
+			llvm::Instruction* inst = nullptr;
+			/// Operand of the instruction computing the stack address.
+			llvm::Value* val = nullptr;
+			/// Type of the accessed object.
+			llvm::Type* type = nullptr;
+			/// Offset of the access on the stack.
+			llvm::ConstantInt* offset = nullptr;
+			/// Base offset of the symbolic tree before simplification.
+			std::optional<int> baseOffset;
+			/// Base offset of the symbolic tree after simplification.
+			std::optional<int> simplifiedBaseOffset;
+		};
+
+		/// Stack accesses found in a single function.
+		struct FunctionAccesses
+		{
+			llvm::Function* function = nullptr;
+			std::vector<StackAccess> accesses;
+		};
+
 	private:
 		bool run();
-		void handleInstruction(
+		void analyzeFunction(
+				ReachingDefinitionsAnalysis& RDA,
+				FunctionAccesses& fa) const;
+		void analyzeInstruction(
 				ReachingDefinitionsAnalysis& RDA,
 				llvm::Instruction* inst,
 				llvm::Value* val,
 				llvm::Type* type,
-				std::map<llvm::Value*, llvm::Value*>& val2val);
-		std::optional<int> getBaseOffset(SymbolicTree &root);
+				std::map<llvm::Value*, llvm::Value*>& val2val,
+				std::vector<StackAccess>& accesses) const;
+		void applyStackAccess(const StackAccess& access);
+		std::optional<int> getBaseOffset(SymbolicTree &root) const;
 		const retdec::common::Object* getDebugStackVariable(
 				llvm::Function* fnc,
-				SymbolicTree& root);
+				std::optional<int> baseOffset);
 		const retdec::common::Object* getConfigStackVariable(
 				llvm::Function* fnc,
-				SymbolicTree& root);
+				std::optional<int> baseOffset);
 
 	private:
 		llvm::Module* _module = nullptr;
@@ -50,6 +50,8 @@ public:
 
 	demangler::Demangler* getDemangler();
 
+	demangler::CachingDemangler::Statistics getCacheStatistics() const;
+
 private:
 	llvm::Type *getLlvmType(std::shared_ptr<retdec::ctypes::Type> type);
 
@@ -58,7 +60,9 @@ private:
 	Config *_config = nullptr;
 	std::unique_ptr<retdec::ctypes::Module> _ctypesModule;
 	std::shared_ptr<ctypesparser::TypeConfig> _typeConfig;
-	std::unique_ptr<demangler::Demangler> _demangler;
+	/// Shared with the other providers (e.g. debug format) through
+	/// @c getDemangler(), so all of them use the same cache.
+	std::unique_ptr<demangler::CachingDemangler> _demangler;
 };
 
 /**
@@ -9,6 +9,7 @@
 
 #include <llvm/IR/Module.h>
 
+#include "retdec/ctypesparser/binary_ctypes_parser.h"
 #include "retdec/ctypesparser/json_ctypes_parser.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
@@ -42,6 +43,9 @@ class Lti
 
 	private:
 		void loadLtiFile(const std::string& filePath);
+		bool openBinaryLtiFile(
+				const std::string& filePath,
+				const std::string& callConv);
 		llvm::Type* getLlvmType(std::shared_ptr<retdec::ctypes::Type> type);
 
 	private:
@@ -51,6 +55,12 @@ class Lti
 		retdec::loader::Image* _image = nullptr;
 		std::unique_ptr<retdec::ctypes::Module> _ltiModule;
 		ctypesparser::JSONCTypesParser _ltiParser;
+		/// Precompiled LTI files whose functions are parsed on demand
+		/// (in the order in which they were loaded), together with their
+		/// default call conventions.
+		std::vector<std::pair<
+				std::unique_ptr<ctypesparser::BinaryCTypesParser>,
+				std::string>> _ltiBinaryParsers;
 };
 
 class LtiProvider
@@ -0,0 +1,54 @@
+/**
+ * @file include/retdec/bin2llvmir/providers/rda.h
+ * @brief Reaching definitions provider for bin2llvmirl.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_PROVIDERS_RDA_H
+#define RETDEC_BIN2LLVMIR_PROVIDERS_RDA_H
+
+#include <map>
+#include <utility>
+
+#include <llvm/IR/Module.h>
+
+#include "retdec/bin2llvmir/analyses/reaching_definitions.h"
+#include "retdec/bin2llvmir/providers/abi/abi.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Completely static object -- all members and methods are static -> it can be
+ * used by anywhere in bin2llvmirl. It provides mapping of modules to reaching
+ * definitions analyses shared by all passes working with these modules.
+ *
+ * Shared analysis is only updated when a pass asks for it, and only functions
+ * changed since the last update are recomputed.
+ *
+ * @attention Even though this is accessible anywhere in bin2llvmirl, use it only
+ * in LLVM passes' prologs to get pass-local analysis object. All analyses,
+ * utils and other modules *MUST NOT* use it. If they need to work with
+ * reaching definitions, they should accept them in parameter.
+ */
+class RdaProvider
+{
+	public:
+		static ReachingDefinitionsAnalysis* getRda(
+				llvm::Module* m,
+				Abi* abi = nullptr,
+				bool trackFlagRegs = false);
+
+		static void clear();
+
+	private:
+		/// Mapping of modules (and flag registers tracking) to analyses.
+		static std::map<
+				std::pair<llvm::Module*, bool>,
+				ReachingDefinitionsAnalysis> _module2rda;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file include/retdec/bin2llvmir/utils/parallel.h
+ * @brief Parallel execution of function-local analyses.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_UTILS_PARALLEL_H
+#define RETDEC_BIN2LLVMIR_UTILS_PARALLEL_H
+
+#include <exception>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include <llvm/Support/ThreadPool.h>
+
+namespace retdec {
+namespace bin2llvmir {
+
+llvm::ThreadPool& getThreadPool();
+std::mutex& getLlvmContextMutex();
+
+void setParallelExecution(bool b);
+bool isParallelExecution();
+
+/**
+ * Call @a fnc for each of the @a items on the shared thread pool and wait
+ * until all the calls finish. If some of the calls throw, the exception of
+ * the first such item is rethrown once all the calls finish.
+ *
+ * LLVM IR is not thread-safe. The calls may only read the IR. Anything they
+ * create in the LLVM context (constants, types) must be created while
+ * holding @c getLlvmContextMutex(). The usual way is to collect changes for
+ * each item in parallel, and apply them serially once this returns.
+ *
+ * The calls must not call @c parallelForEach() themselves, they would wait
+ * for the pool they are running on.
+ *
+ * If parallel execution is disabled by @c setParallelExecution(), the items
+ * are processed in order on the calling thread.
+ */
+template <typename T, typename Fnc>
+void parallelForEach(std::vector<T>& items, Fnc fnc)
+{
+	if (!isParallelExecution())
+	{
+		for (auto& item : items)
+		{
+			fnc(item);
+		}
+		return;
+	}
+
+	std::vector<std::exception_ptr> errors(items.size());
+	std::vector<std::shared_future<void>> futures;
+	futures.reserve(items.size());
+
+	auto& pool = getThreadPool();
+	for (std::size_t i = 0; i < items.size(); ++i)
+	{
+		futures.push_back(pool.async([&fnc, &items, &errors, i]()
+		{
+			try
+			{
+				fnc(items[i]);
+			}
+			catch (...)
+			{
+				errors[i] = std::current_exception();
+			}
+		}));
+	}
+
+	for (auto& f : futures)
+	{
+		f.wait();
+	}
+
+	for (auto& e : errors)
+	{
+		if (e)
+		{
+			std::rethrow_exception(e);
+		}
+	}
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
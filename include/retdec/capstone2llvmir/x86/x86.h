@@ -10,6 +10,7 @@
 #include <array>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "retdec/capstone2llvmir/capstone2llvmir.h"
 #include "retdec/capstone2llvmir/x86/x86_defs.h"
@@ -66,6 +67,39 @@ class Capstone2LlvmIrTranslatorX86 : virtual public Capstone2LlvmIrTranslator
 		 * register @p r. Register can be its own parent.
 		 */
 		virtual uint32_t getParentRegister(uint32_t r) const = 0;
+
+		/**
+		 * @return Bit of the flag register @p r (e.g. @c X86_REG_CF) in flag
+		 * masks used by @c getDeadFlags() and @c setDeadFlags().
+		 */
+		static uint32_t getFlagMask(uint32_t r)
+		{
+			return 1u << (r - X86_REG_CF);
+		}
+		/**
+		 * Find status flags written by the @p count instructions in
+		 * @p insns that are overwritten by one of the following instructions
+		 * before they are read. The instructions must form a straight-line
+		 * sequence (e.g. a basic block) and must have details. All flags are
+		 * considered live after the last instruction.
+		 * Flags read and written by the instructions are taken from
+		 * Capstone's @c eflags detail. A write ends a flag's live range
+		 * only if the translation of the instruction is known to store the
+		 * flag, e.g. flags left undefined by @c mul or written by shifts
+		 * with a possibly zero count keep the previous value live.
+		 * @return Mask of dead flags (see @c getFlagMask()) for each of the
+		 * instructions.
+		 */
+		virtual std::vector<uint32_t> getDeadFlags(
+				const cs_insn* insns,
+				std::size_t count) const = 0;
+		/**
+		 * Set status flags (see @c getFlagMask()) whose values written by
+		 * the next translated instruction are never read. Translation of the
+		 * instruction does not generate them. This applies only to the next
+		 * translated instruction, all flags are generated afterwards.
+		 */
+		virtual void setDeadFlags(uint32_t flags) = 0;
 };
 
 } // namespace capstone2llvmir
@@ -7,8 +7,10 @@
 #ifndef RETDEC_COMMON_FUNCTION_H
 #define RETDEC_COMMON_FUNCTION_H
 
+#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 
 #include "retdec/common/calling_convention.h"
 #include "retdec/common/basic_block.h"
@@ -201,15 +203,49 @@ struct FunctionAddressCompare
 /**
  * An associative container with functions' names as the key.
  * See Function class for details.
+ *
+ * Functions are also indexed by their start addresses and real names.
+ * Real names of the contained functions must be changed only through
+ * @c setRealName(), and start addresses must not be changed at all.
+ * Otherwise, the indexes get out of sync.
  */
 class FunctionContainer : public std::set<Function, FunctionNameCompare>
 {
 	public:
+		FunctionContainer();
+		FunctionContainer(const FunctionContainer& o);
+		FunctionContainer& operator=(const FunctionContainer& o);
+
 		bool hasFunction(const std::string& name);
 		const Function* getFunctionByName(const std::string& name) const;
 		const Function* getFunctionByStartAddress(
 				const retdec::common::Address& addr) const;
 		const Function* getFunctionByRealName(const std::string& name) const;
+
+		void setRealName(const Function* f, const std::string& realName);
+
+		/// @name Reimplemented base container methods.
+		///
+		/// They need to be reimplemented to modify both underlying container
+		/// and the address and real name indexes.
+		/// @{
+		std::pair<iterator,bool> insert(const Function& e);
+		iterator insert(const_iterator hint, const Function& e);
+		void clear();
+		size_t erase(const Function& val);
+		iterator erase(const_iterator pos);
+		/// @}
+
+	private:
+		void addToIndexes(const Function* f);
+		void removeFromIndexes(const Function* f);
+		void rebuildIndexes();
+
+	private:
+		/// Functions with defined start addresses.
+		std::multimap<retdec::common::Address, const Function*> _addr2fnc;
+		/// Functions with non-empty real names.
+		std::unordered_multimap<std::string, const Function*> _realName2fnc;
 };
 
 // TODO:
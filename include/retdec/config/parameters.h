@@ -7,8 +7,10 @@
 #ifndef RETDEC_CONFIG_PARAMETERS_H
 #define RETDEC_CONFIG_PARAMETERS_H
 
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <rapidjson/document.h>
 #include <rapidjson/writer.h>
@@ -31,6 +33,7 @@ class Parameters
 		bool isKeepAllFunctions() const;
 		bool isSelectedDecodeOnly() const;
 		bool isDetectStaticCode() const;
+		bool isLazyFlags() const;
 		bool isTimeout() const;
 		bool isMaxMemoryLimitHalfRam() const;
 		bool isBackendNoOpts() const;
@@ -73,6 +76,9 @@ class Parameters
 		void setBackendCallInfoObtainer(const std::string& val);
 		void setBackendVarRenamer(const std::string& val);
 		void setIsDetectStaticCode(bool b);
+		void setIsLazyFlags(bool b);
+		void setLlvmPipeline(const std::string& name);
+		void setLlvmPassStatsFile(const std::string& file);
 		void setIsBackendNoOpts(bool b);
 		void setIsBackendEmitCfg(bool b);
 		void setIsBackendEmitCg(bool b);
@@ -108,6 +114,9 @@ class Parameters
 		const std::string& getBackendEnabledOpts() const;
 		const std::string& getBackendCallInfoObtainer() const;
 		const std::string& getBackendVarRenamer() const;
+		const std::string& getLlvmPipeline() const;
+		const std::string& getLlvmPassStatsFile() const;
+		std::vector<std::string> getLlvmPasses() const;
 		/// @}
 
 		void fixRelativePaths(const std::string& configPath);
@@ -135,8 +144,18 @@ class Parameters
 		common::AddressRangeContainer selectedRanges;
 
 		/// LLVM passes.
+		/// Items starting with @c LLVM_PIPELINE_REF are references to named
+		/// pipelines from @c llvmPipelines.
 		std::vector<std::string> llvmPasses;
 
+		/// Named LLVM pipelines (sequences of passes and references to other
+		/// pipelines) that can be referenced from @c llvmPasses or selected
+		/// by @c setLlvmPipeline().
+		std::map<std::string, std::vector<std::string>> llvmPipelines;
+
+		/// Prefix of references to named pipelines.
+		static constexpr char LLVM_PIPELINE_REF = '@';
+
 	private:
 		/// Decompilation will verbosely inform about the
 		/// decompilation process.
@@ -169,6 +188,13 @@ class Parameters
 		uint64_t _timeout = 0;
 
 		bool _detectStaticCode = true;
+		/// Do not generate x86 status flags that are overwritten before
+		/// they are read.
+		bool _lazyFlags = false;
+		/// Named pipeline used instead of @c llvmPasses.
+		std::string _llvmPipeline;
+		/// File into which per-pass statistics are written.
+		std::string _llvmPassStatsFile;
 		std::string _backendDisabledOpts;
 		std::string _backendEnabledOpts;
 		std::string _backendCallInfoObtainer = "optim";
@@ -0,0 +1,71 @@
+/**
+* @file include/retdec/ctypesparser/binary_ctypes_format.h
+* @brief Definition of the binary (precompiled) C-types format.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_CTYPESPARSER_BINARY_CTYPES_FORMAT_H
+#define RETDEC_CTYPESPARSER_BINARY_CTYPES_FORMAT_H
+
+#include <cstdint>
+
+namespace retdec {
+namespace ctypesparser {
+
+/**
+* @brief Constants describing the binary C-types format.
+*
+* The binary format is a precompiled form of the JSON C-types files. It allows
+* a reader to find a single function by its name without parsing the rest of
+* the file. All numbers are stored in little endian. The file consists of:
+*
+*  - A header: magic (8 bytes), version, string pool offset and size, number
+*    of types, offset of the type table, number of functions and offset of the
+*    function index (all @c uint32_t).
+*  - A string pool. Strings are referenced by their offset into the pool. Each
+*    string is stored as a @c uint32_t length followed by its bytes.
+*  - A type table: for every type, the offset of its record in the file. Types
+*    are referenced by their index into this table.
+*  - A function index sorted by function names: for every function, the
+*    reference of its name and the offset of its record in the file.
+*  - Type and function records (see @c TypeKind and the writer for their
+*    layout).
+*/
+namespace binary_ctypes {
+
+/// Magic bytes at the beginning of every file.
+constexpr char MAGIC[8] = {'R', 'D', 'C', 'T', 'Y', 'P', 'E', 'S'};
+/// Version of the format. Increase it whenever the layout changes.
+constexpr std::uint32_t VERSION = 1;
+/// Size of the header in bytes.
+constexpr std::uint32_t HEADER_SIZE = 8 + 7 * 4;
+/// Size of an entry in the function index in bytes.
+constexpr std::uint32_t FUNCTION_INDEX_ENTRY_SIZE = 2 * 4;
+/// Reference of a type that is not in the type table (an unknown type).
+constexpr std::uint32_t UNKNOWN_TYPE_REF = 0xffffffff;
+
+/**
+* @brief Kinds of type records.
+*/
+enum class TypeKind: std::uint8_t
+{
+	Unknown = 0,
+	Void,
+	Integral,
+	FloatingPoint,
+	Typedef,
+	Pointer,
+	Array,
+	Struct,
+	Union,
+	Enum,
+	Function,
+	Qualifier
+};
+
+} // namespace binary_ctypes
+
+} // namespace ctypesparser
+} // namespace retdec
+
+#endif
@@ -0,0 +1,136 @@
+/**
+* @file include/retdec/ctypesparser/binary_ctypes_parser.h
+* @brief Parser for C-types from precompiled binary files.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_CTYPESPARSER_BINARY_CTYPES_PARSER_H
+#define RETDEC_CTYPESPARSER_BINARY_CTYPES_PARSER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "retdec/ctypesparser/ctypes_parser.h"
+
+namespace retdec {
+
+namespace utils {
+class MappedFile;
+} // namespace utils
+
+namespace ctypesparser {
+
+/**
+* @brief Parser for C-types in the binary format created by
+*        BinaryCTypesWriter.
+*
+* Contrary to JSONCTypesParser, functions do not have to be parsed all at once.
+* The file is mapped into memory and a function (together with the types it
+* uses) is materialized only when it is requested by parseFunction(). The
+* result is the same as if the function was parsed from the original JSON.
+*
+* @see binary_ctypes_format.h
+*/
+class BinaryCTypesParser: public CTypesParser
+{
+	public:
+		BinaryCTypesParser();
+		BinaryCTypesParser(unsigned defaultBitWidth);
+		~BinaryCTypesParser();
+
+		void openFile(const std::string &filePath);
+		void openBuffer(const std::uint8_t *data, std::size_t size);
+		bool isOpen() const;
+
+		/// @name Function index.
+		/// @{
+		std::size_t getFunctionCount() const;
+		std::vector<std::string> getFunctionNames() const;
+		bool hasFunction(const std::string &name) const;
+		/// @}
+
+		/// @name Parsing.
+		/// @{
+		std::shared_ptr<retdec::ctypes::Function> parseFunction(
+			const std::string &name,
+			std::unique_ptr<retdec::ctypes::Module> &module,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
+		std::unique_ptr<retdec::ctypes::Module> parse(
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
+		void parseInto(
+			std::unique_ptr<retdec::ctypes::Module> &module,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
+		/// @}
+
+	private:
+		void readHeader();
+		void setUpParsing(
+			const std::unique_ptr<retdec::ctypes::Module> &module,
+			const TypeWidths &typeWidths,
+			const retdec::ctypes::CallConvention &callConvention);
+		std::uint32_t findFunction(const std::string &name) const;
+		std::shared_ptr<retdec::ctypes::Function> parseFunctionAt(
+			std::uint32_t indexPos);
+
+		std::shared_ptr<retdec::ctypes::Type> getOrParseType(
+			std::uint32_t typeRef);
+		std::shared_ptr<retdec::ctypes::Type> parseType(std::uint32_t typeRef);
+		std::shared_ptr<retdec::ctypes::Type> parseTypedefedType(
+			std::uint32_t offset);
+		std::shared_ptr<retdec::ctypes::Type> parseCompositeType(
+			std::uint32_t offset,
+			bool isStruct);
+		std::shared_ptr<retdec::ctypes::Type> parseEnum(std::uint32_t offset);
+		std::shared_ptr<retdec::ctypes::Type> parseFunctionType(
+			std::uint32_t offset);
+		std::shared_ptr<retdec::ctypes::Type> parseArray(std::uint32_t offset);
+		retdec::ctypes::FunctionType::VarArgness parseVarArgness(
+			std::uint32_t &offset);
+		retdec::ctypes::CallConvention parseCallConv(std::uint32_t &offset);
+
+		/// @name Reading of raw data.
+		/// @{
+		std::uint8_t readU8(std::uint32_t &offset) const;
+		std::uint32_t readU32(std::uint32_t &offset) const;
+		std::uint64_t readU64(std::uint32_t &offset) const;
+		std::string_view readString(std::uint32_t &offset) const;
+		std::string_view getString(std::uint32_t stringRef) const;
+		void checkBounds(std::uint64_t offset, std::uint64_t size) const;
+		/// @}
+
+	private:
+		/// File the data come from (if opened by openFile()).
+		std::unique_ptr<retdec::utils::MappedFile> file;
+		/// Data in the binary format.
+		const std::uint8_t *data = nullptr;
+		/// Size of the data.
+		std::size_t size = 0;
+
+		/// @name Values from the header.
+		/// @{
+		std::uint32_t stringsOffset = 0;
+		std::uint32_t stringsSize = 0;
+		std::uint32_t typeCount = 0;
+		std::uint32_t typeTableOffset = 0;
+		std::uint32_t functionCount = 0;
+		std::uint32_t functionIndexOffset = 0;
+		/// @}
+
+		/// Already parsed types by their references.
+		std::vector<std::shared_ptr<retdec::ctypes::Type>> parsedTypes;
+		/// Names of typedefs that are being parsed (to break cycles).
+		std::vector<std::string> typedefsInProgress;
+		/// Call convention used when a function does not contain one.
+		retdec::ctypes::CallConvention defaultCallConv;
+};
+
+} // namespace ctypesparser
+} // namespace retdec
+
+#endif
@@ -0,0 +1,80 @@
+/**
+* @file include/retdec/ctypesparser/binary_ctypes_writer.h
+* @brief Compiler of C-types from JSON into the binary format.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_CTYPESPARSER_BINARY_CTYPES_WRITER_H
+#define RETDEC_CTYPESPARSER_BINARY_CTYPES_WRITER_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <rapidjson/document.h>
+
+namespace retdec {
+namespace ctypesparser {
+
+/**
+* @brief Compiles C-types represented in JSON into the binary format.
+*
+* Only types that are (transitively) used by functions are written. The
+* output can be read by BinaryCTypesParser.
+*
+* @see binary_ctypes_format.h
+*/
+class BinaryCTypesWriter
+{
+	public:
+		void write(std::istream &jsonStream, std::ostream &outStream);
+		std::vector<std::uint8_t> write(std::istream &jsonStream);
+
+	private:
+		using Buffer = std::vector<std::uint8_t>;
+
+	private:
+		void reset();
+		void writeFunction(const rapidjson::Value &jsonFunction);
+		void writeType(const rapidjson::Value &jsonType);
+		void writeCallConvAndVarArgness(const rapidjson::Value &jsonValue);
+		void writeNamedTypeWithBitWidth(const rapidjson::Value &jsonType);
+		void writeMembers(const rapidjson::Value &jsonMembers);
+		void writeArrayDimensions(const rapidjson::Value &jsonDimensions);
+		void writeEnumItems(const rapidjson::Value &jsonItems);
+
+		std::uint32_t getTypeRef(const std::string &typeKey);
+		std::uint32_t getStringRef(const std::string &str);
+
+		void writeU8(std::uint8_t value);
+		void writeU32(std::uint32_t value);
+		void writeU64(std::uint64_t value);
+		void writeString(const std::string &str);
+
+	private:
+		/// Types from the JSON file by their keys.
+		std::unordered_map<std::string, const rapidjson::Value*> jsonTypes;
+		/// Indexes of already referenced types by their keys.
+		std::unordered_map<std::string, std::uint32_t> typeRefs;
+		/// Keys of referenced types that have not been written yet.
+		std::queue<std::string> typesToWrite;
+		/// Offsets of type records (relative to the start of records).
+		std::vector<std::uint32_t> typeOffsets;
+
+		/// Offsets of strings in the string pool.
+		std::unordered_map<std::string, std::uint32_t> stringRefs;
+		/// String pool.
+		Buffer strings;
+
+		/// Type and function records.
+		Buffer records;
+};
+
+} // namespace ctypesparser
+} // namespace retdec
+
+#endif
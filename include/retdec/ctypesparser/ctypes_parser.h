@@ -36,6 +36,11 @@ class CTypesParser
 		CTypesParser();
 		CTypesParser(unsigned defaultBitWidth);
 
+		unsigned getIntegralTypeBitWidth(const std::string &type) const;
+		unsigned getBitWidthOrDefault(const std::string &typeName) const;
+		retdec::ctypes::Parameter::Annotations parseAnnotations(
+			const std::string &annot) const;
+
 	protected:
 		/// Container for already parsed functions, types.
 		std::shared_ptr<retdec::ctypes::Context> context;
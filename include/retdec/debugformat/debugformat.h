@@ -28,6 +28,15 @@ namespace debugformat {
 
 /**
  * Common (PDB and DWARF) debug information representation.
+ *
+ * DWARF information is loaded lazily by default. All functions and global
+ * variables are indexed by their addresses when the file is loaded, but only
+ * their names and address ranges are filled in @c functions and @c globals.
+ * The rest (source lines, parameters, local variables, and types) is loaded
+ * when the function or variable is asked for by @c getFunction() or
+ * @c getGlobalVar(), or when @c loadAll() is called. @c getFunctionLines()
+ * loads only the source file and lines of a function, which is much cheaper
+ * than converting its types.
  */
 class DebugFormat
 {
@@ -40,12 +49,17 @@ class DebugFormat
 				retdec::loader::Image* inFile,
 				const std::string& pdbFile,
 				SymbolTable* symtab,
-				retdec::demangler::Demangler* demangler
+				retdec::demangler::Demangler* demangler,
+				bool lazyDwarf = true
 		);
 
 		retdec::common::Function* getFunction(retdec::common::Address a);
+		const retdec::common::Function* getFunctionLines(
+				retdec::common::Address a);
 		const retdec::common::Object* getGlobalVar(retdec::common::Address a);
 
+		void loadAll();
+
 		bool hasInformation() const;
 
 	private:
@@ -58,12 +72,23 @@ class DebugFormat
 		void loadDwarf();
 		void loadDwarf_CU(llvm::DWARFDie die);
 		retdec::common::Function loadDwarf_subprogram(llvm::DWARFDie die);
+		void loadDwarf_subprogramLines(
+				llvm::DWARFDie die,
+				retdec::common::Function& dif);
+		void loadDwarf_subprogramBody(
+				llvm::DWARFDie die,
+				retdec::common::Function& dif);
 		std::string loadDwarf_type(llvm::DWARFDie die);
 		std::string _loadDwarf_type(llvm::DWARFDie die);
 		retdec::common::Object loadDwarf_formal_parameter(
 				llvm::DWARFDie die,
 				unsigned argCntr);
-		retdec::common::Object loadDwarf_variable(llvm::DWARFDie die);
+		retdec::common::Object loadDwarf_variable(
+				llvm::DWARFDie die,
+				bool withType = true);
+		void loadDwarf_globalVariableType(
+				llvm::DWARFDie die,
+				const retdec::common::Object& gv);
 
 		void loadSymtab();
 
@@ -82,6 +107,17 @@ class DebugFormat
 		/// Dwarf named types cache.
 		std::map<std::pair<llvm::DWARFUnit*, uint32_t>, std::string> dieOff2type;
 
+		/// Dwarf data, kept alive for lazy loading.
+		std::unique_ptr<llvm::MemoryBuffer> _dwarfBuffer;
+		std::unique_ptr<llvm::object::Binary> _dwarfBinary;
+		std::unique_ptr<llvm::DWARFContext> _dwarfContext;
+		/// Offsets of DIEs of functions which were not fully loaded yet.
+		std::map<retdec::common::Address, uint64_t> _dwarfFunctions;
+		/// Offsets of DIEs of functions whose lines were not loaded yet.
+		std::map<retdec::common::Address, uint64_t> _dwarfFunctionLines;
+		/// Offsets of DIEs of global variables which were not fully loaded yet.
+		std::map<retdec::common::Address, uint64_t> _dwarfGlobals;
+
 	public:
 		retdec::common::GlobalVarContainer globals;
 		retdec::common::TypeContainer types;
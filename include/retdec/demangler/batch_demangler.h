@@ -0,0 +1,70 @@
+/**
+ * @file include/retdec/demangler/batch_demangler.h
+ * @brief Demangling of large batches of names.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_DEMANGLER_BATCH_DEMANGLER_H
+#define RETDEC_DEMANGLER_BATCH_DEMANGLER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "retdec/demangler/demangler_base.h"
+
+namespace retdec {
+namespace demangler {
+
+/**
+ * @brief Mangling schemes which can be recognized by name prefixes.
+ */
+enum class ManglingScheme
+{
+	unknown,
+	itanium,
+	microsoft,
+	borland,
+};
+
+ManglingScheme detectManglingScheme(const std::string &mangled);
+
+std::unique_ptr<Demangler> createDemangler(ManglingScheme scheme);
+
+/**
+ * @brief Demangles batches of names on more threads.
+ *
+ * Mangling scheme of each name is detected from its prefix and only
+ * the demangler for that scheme is used. Names are split into contiguous
+ * chunks, each chunk is demangled by one thread with its own demanglers,
+ * and results are returned in the order of the names.
+ */
+class BatchDemangler
+{
+public:
+	struct Result
+	{
+		ManglingScheme scheme = ManglingScheme::unknown;
+		/// Demangled name, empty if the name could not be demangled.
+		std::string demangled;
+	};
+
+public:
+	explicit BatchDemangler(unsigned threads = 0);
+	~BatchDemangler();
+
+	std::vector<Result> demangle(const std::vector<std::string> &names);
+
+	unsigned getThreadCount() const;
+
+private:
+	class Worker;
+
+private:
+	std::vector<std::unique_ptr<Worker>> _workers;
+};
+
+}
+}
+
+#endif //RETDEC_DEMANGLER_BATCH_DEMANGLER_H
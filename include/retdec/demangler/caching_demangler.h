@@ -0,0 +1,74 @@
+/**
+ * @file include/retdec/demangler/caching_demangler.h
+ * @brief Demangler which memoizes results of another demangler.
+ * @copyright (c) 2018 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_DEMANGLER_CACHING_DEMANGLER_H
+#define RETDEC_DEMANGLER_CACHING_DEMANGLER_H
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "retdec/demangler/demangler_base.h"
+
+namespace retdec {
+namespace demangler {
+
+/**
+ * @brief Thread-safe memoizing wrapper around another demangler.
+ *
+ * Demangled strings are cached by mangled names. Functions demangled into
+ * ctypes are looked up in the given module first -- they are added there
+ * under their mangled names when they are demangled for the first time.
+ * Names which cannot be demangled into ctypes functions are remembered,
+ * so they are not parsed again.
+ *
+ * Calls of the wrapped demangler are serialized, so it does not need to be
+ * thread-safe itself.
+ */
+class CachingDemangler : public Demangler
+{
+public:
+	/// Numbers of cache hits and misses since the demangler was created.
+	struct Statistics
+	{
+		std::size_t hits = 0;
+		std::size_t misses = 0;
+	};
+
+public:
+	explicit CachingDemangler(std::unique_ptr<Demangler> demangler);
+
+	std::string demangleToString(const std::string &mangled) override;
+
+	std::shared_ptr<ctypes::Function> demangleFunctionToCtypes(
+		const std::string &mangled,
+		std::unique_ptr<ctypes::Module> &module,
+		const ctypesparser::CTypesParser::TypeWidths &typeWidths,
+		const ctypesparser::CTypesParser::TypeSignedness &typeSignedness,
+		unsigned defaultBitWidth) override;
+
+	Statistics statistics() const;
+
+private:
+	struct Demangled
+	{
+		std::string name;
+		Status status;
+	};
+
+private:
+	std::unique_ptr<Demangler> _demangler;
+	mutable std::mutex _mutex;
+	std::unordered_map<std::string, Demangled> _demangled;
+	std::unordered_set<std::string> _notFunctions;
+	Statistics _statistics;
+};
+
+}
+}
+
+#endif //RETDEC_DEMANGLER_CACHING_DEMANGLER_H
@@ -8,8 +8,10 @@
 #define RETDEC_DEMANGLER_H
 
 #include "retdec/demangler/demangler_base.h"
+#include "retdec/demangler/batch_demangler.h"
 #include "retdec/demangler/itanium_demangler.h"
 #include "retdec/demangler/microsoft_demangler.h"
 #include "retdec/demangler/borland_demangler.h"
+#include "retdec/demangler/caching_demangler.h"
 
 #endif //RETDEC_DEMANGLER_H
@@ -56,6 +56,8 @@ public:
 
 	Status status();
 
+	const std::string &getCompiler() const;
+
 protected:
 	std::string _compiler;
 	Status _status;
@@ -7,6 +7,8 @@
 #ifndef RETDEC_LLVM_MICROSOFT_DEMANGLER_H
 #define RETDEC_LLVM_MICROSOFT_DEMANGLER_H
 
+#include <cstddef>
+
 #include "retdec/demangler/demangler_base.h"
 
 namespace retdec {
@@ -19,6 +21,10 @@ class MicrosoftDemangler : public Demangler
 {
 public:
 	MicrosoftDemangler();
+	~MicrosoftDemangler() override;
+
+	MicrosoftDemangler(const MicrosoftDemangler &) = delete;
+	MicrosoftDemangler &operator=(const MicrosoftDemangler &) = delete;
 
 	std::string demangleToString(const std::string &mangled) override;
 
@@ -28,6 +34,12 @@ public:
 		const ctypesparser::CTypesParser::TypeWidths &typeWidths,
 		const ctypesparser::CTypesParser::TypeSignedness &typeSignedness,
 		unsigned defaultBitWidth) override;
+
+private:
+	/// Output buffer reused by all demanglings, LLVM grows it when needed.
+	char *_buffer = nullptr;
+	/// Known lower bound of @c _buffer size.
+	std::size_t _bufferSize = 0;
 };
 
 }
@@ -65,12 +65,28 @@ enum class Architecture
 	MIPS
 };
 
+/**
+ * Flags for configurable file loading
+ *
+ * Parts of the file marked by @c LAZY_* flags are not loaded with the file,
+ * they are loaded on the first access to them. Profiles combine the flags
+ * needed by the individual tools.
+ */
 enum LoadFlags
 {
 	NONE              = 0,
 	NO_FILE_HASHES    = 1,
 	NO_VERBOSE_HASHES = 2,
-	DETECT_STRINGS    = 4
+	DETECT_STRINGS    = 4,
+	LAZY_RICH_HEADER  = 8,
+	LAZY_CERTIFICATES = 16,
+	LAZY_DOTNET       = 32,
+	LAZY_VISUAL_BASIC = 64,
+	LAZY_ALL          = LAZY_RICH_HEADER | LAZY_CERTIFICATES | LAZY_DOTNET | LAZY_VISUAL_BASIC,
+
+	PROFILE_FILEINFO   = NONE,
+	PROFILE_UNPACKER   = NO_FILE_HASHES | NO_VERBOSE_HASHES | LAZY_ALL,
+	PROFILE_DECOMPILER = NO_FILE_HASHES | NO_VERBOSE_HASHES | LAZY_ALL
 };
 
 } // namespace fileformat
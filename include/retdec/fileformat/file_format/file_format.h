@@ -49,6 +49,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		std::istream auxIStream;                 ///< auxiliary input stream
 		std::vector<unsigned char> *loadedBytes; ///< reference to serialized content of input file
 		LoadFlags loadFlags;                     ///< load flags for configurable file loading
+		mutable unsigned lazyParts;              ///< @c LAZY_* load flags of parts which are not loaded yet
 
 		/// @name Initialization methods
 		/// @{
@@ -105,6 +106,12 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		void computeSectionTableHashes();
 		/// @}
 
+		/// @name Lazy loading methods
+		/// @{
+		void loadLazily(LoadFlags part) const;
+		virtual void loadLazyPart(LoadFlags part);
+		/// @}
+
 		/// @name Setters
 		/// @{
 		void setLoadedBytes(std::vector<unsigned char> *lBytes);
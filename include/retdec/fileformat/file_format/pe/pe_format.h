@@ -57,6 +57,7 @@ class PeFormat : public FileFormat
 		/// @name Virtual initialization methods
 		/// @{
 		virtual std::size_t initSectionTableHashOffsets() override;
+		virtual void loadLazyPart(LoadFlags part) override;
 		/// @}
 
 		/// @name Auxiliary methods
@@ -0,0 +1,80 @@
+/**
+* @file include/retdec/hlltokens/binary_format.h
+* @brief Definition of the binary format of the emitted high-level code.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_HLLTOKENS_BINARY_FORMAT_H
+#define RETDEC_HLLTOKENS_BINARY_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace retdec {
+namespace hlltokens {
+
+/**
+ * Constants describing the binary token format.
+ *
+ * The format carries the same information as the JSON output (a sequence of
+ * tokens interleaved with address entries, followed by the output language)
+ * but it is much more compact and cheaper to parse. It is designed to be
+ * written in a single pass, so it can be streamed. The file consists of:
+ *
+ *  - A header: magic (8 bytes) and version (1 byte).
+ *  - A sequence of records. Every record starts with an opcode byte
+ *    (see @c Opcode).
+ *
+ * Numbers are stored as unsigned LEB128 varints. Strings are stored as
+ * a varint length followed by their bytes (no terminating zero).
+ *
+ * Token values are kept in a string table that is built implicitly while
+ * reading: a value stored by @c TOKEN_NEW gets the next free index, and later
+ * occurrences of the same value are written by @c TOKEN_REF as that index.
+ * Values that rarely repeat (comments, string literals) are stored by
+ * @c TOKEN_INLINE and are not added to the table.
+ *
+ * Defined addresses are stored as zig-zag encoded differences from the
+ * previous defined address (the first one from zero).
+ */
+namespace binary_format {
+
+/// Magic bytes at the beginning of every file.
+constexpr char MAGIC[8] = {'R', 'D', 'T', 'O', 'K', 'E', 'N', 'S'};
+/// Version of the format. Increase it whenever the layout changes.
+constexpr std::uint8_t VERSION = 1;
+/// Size of the header in bytes.
+constexpr std::size_t HEADER_SIZE = 8 + 1;
+
+/**
+ * Opcodes of records.
+ *
+ * Token opcodes contain the token kind in their low six bits.
+ */
+enum Opcode: std::uint8_t
+{
+	/// A token whose value is in the string table: kind | TOKEN_REF, index.
+	TOKEN_REF         = 0x00,
+	/// A token with a new value: kind | TOKEN_NEW, string.
+	TOKEN_NEW         = 0x40,
+	/// A token with a value not stored in the table: kind | TOKEN_INLINE, string.
+	TOKEN_INLINE      = 0x80,
+	/// A defined address: zig-zag encoded difference.
+	ADDRESS           = 0xf0,
+	/// An undefined address (no data).
+	ADDRESS_UNDEFINED = 0xf1,
+	/// The end of the token sequence: output language (string).
+	END               = 0xff
+};
+
+/// Mask of opcode bits distinguishing the type of a token record.
+constexpr std::uint8_t TOKEN_TYPE_MASK = 0xc0;
+/// Mask of opcode bits containing the token kind.
+constexpr std::uint8_t TOKEN_KIND_MASK = 0x3f;
+
+} // namespace binary_format
+
+} // namespace hlltokens
+} // namespace retdec
+
+#endif
@@ -0,0 +1,109 @@
+/**
+* @file include/retdec/hlltokens/binary_token_reader.h
+* @brief Reader of the binary format of the emitted high-level code.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_HLLTOKENS_BINARY_TOKEN_READER_H
+#define RETDEC_HLLTOKENS_BINARY_TOKEN_READER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "retdec/hlltokens/token_kind.h"
+
+namespace retdec {
+
+namespace utils {
+class MappedFile;
+} // namespace utils
+
+namespace hlltokens {
+
+/**
+ * An exception thrown when the binary data cannot be read.
+ */
+class BinaryTokenReaderError: public std::runtime_error
+{
+	public:
+		using std::runtime_error::runtime_error;
+};
+
+/**
+ * A single entry of the token sequence.
+ */
+struct TokenEntry
+{
+	enum class Type
+	{
+		/// A token (@c kind and @c value are set).
+		Token,
+		/// An address entry (@c address and @c addressDefined are set).
+		Address,
+		/// The end of the sequence (@c value is the output language).
+		End
+	};
+
+	Type type = Type::End;
+	TokenKind kind = TokenKind::NewLine;
+	/// Valid as long as the reader is opened.
+	std::string_view value;
+	std::uint64_t address = 0;
+	bool addressDefined = false;
+};
+
+/**
+ * A reader of the binary token format written by the binary output manager of
+ * llvmir2hll.
+ *
+ * The reader does not copy the data: token values are views into the read
+ * buffer (or into the mapped file), so they stay valid as long as the reader
+ * is opened.
+ *
+ * @see binary_format.h
+ */
+class BinaryTokenReader
+{
+	public:
+		BinaryTokenReader();
+		~BinaryTokenReader();
+
+		void openFile(const std::string& filePath);
+		void openBuffer(const std::uint8_t* data, std::size_t size);
+		bool isOpen() const;
+
+		bool next(TokenEntry& entry);
+
+	private:
+		std::uint8_t readU8();
+		std::uint64_t readVarint();
+		std::string_view readString();
+		void checkBounds(std::size_t size) const;
+
+	private:
+		/// File the data come from (if opened by openFile()).
+		std::unique_ptr<utils::MappedFile> _file;
+		/// Data in the binary format.
+		const std::uint8_t* _data = nullptr;
+		/// Size of the data.
+		std::size_t _size = 0;
+		/// Offset of the next record.
+		std::size_t _offset = 0;
+		/// Has the end record been read?
+		bool _finished = false;
+
+		/// Token values that can be referenced.
+		std::vector<std::string_view> _strings;
+		/// Last defined address.
+		std::uint64_t _lastAddress = 0;
+};
+
+} // namespace hlltokens
+} // namespace retdec
+
+#endif
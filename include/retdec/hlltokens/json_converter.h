@@ -0,0 +1,26 @@
+/**
+* @file include/retdec/hlltokens/json_converter.h
+* @brief Conversion of the binary format of the emitted high-level code into
+*        JSON.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_HLLTOKENS_JSON_CONVERTER_H
+#define RETDEC_HLLTOKENS_JSON_CONVERTER_H
+
+#include <ostream>
+
+namespace retdec {
+namespace hlltokens {
+
+class BinaryTokenReader;
+
+void convertToJson(
+		BinaryTokenReader& reader,
+		std::ostream& out,
+		bool pretty = false);
+
+} // namespace hlltokens
+} // namespace retdec
+
+#endif
@@ -0,0 +1,55 @@
+/**
+* @file include/retdec/hlltokens/token_kind.h
+* @brief Kinds of tokens of the emitted high-level code.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_HLLTOKENS_TOKEN_KIND_H
+#define RETDEC_HLLTOKENS_TOKEN_KIND_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace retdec {
+namespace hlltokens {
+
+/**
+ * Kinds of tokens that are emitted by output managers.
+ * Managers that serialize tokens can use them instead of comparing strings.
+ */
+enum class TokenKind: std::uint8_t
+{
+	NewLine,
+	Space,
+	Punctuation,
+	Operator,
+	GlobalVariableId,
+	LocalVariableId,
+	MemberId,
+	LabelId,
+	FunctionId,
+	ParameterId,
+	Keyword,
+	DataType,
+	Preprocessor,
+	Include,
+	ConstantBool,
+	ConstantInt,
+	ConstantFloat,
+	ConstantString,
+	ConstantSymbol,
+	ConstantPointer,
+	Comment
+};
+
+/// Number of token kinds.
+constexpr std::size_t TOKEN_KIND_COUNT =
+		static_cast<std::size_t>(TokenKind::Comment) + 1;
+
+std::string_view getTokenKindName(TokenKind kind);
+
+} // namespace hlltokens
+} // namespace retdec
+
+#endif
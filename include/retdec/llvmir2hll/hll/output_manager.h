@@ -8,14 +8,22 @@
 #define RETDEC_LLVMIR2HLL_HLL_OUTPUT_MANAGER_H
 
 #include <string>
+#include <string_view>
 
+#include "retdec/hlltokens/token_kind.h"
 #include "retdec/llvmir2hll/support/types.h"
 
 namespace retdec {
 namespace llvmir2hll {
 
+using hlltokens::TokenKind;
+
 /**
+ * A base class of all output managers.
  *
+ * Token payloads are passed as string views, so neither string literals nor
+ * existing strings need to be copied when a token is emitted. Managers must
+ * not store the views beyond the call.
  */
 class OutputManager
 {
@@ -39,33 +47,33 @@ class OutputManager
 		// new line
 		virtual void newLine() = 0;
 		// any whitespace
-		virtual void space(const std::string& space = " ") = 0;
+		virtual void space(std::string_view space = " ") = 0;
 		// e.g. (){}[];
 		virtual void punctuation(char p) = 0;
 		// e.g. == - + * -> .
-		virtual void operatorX(const std::string& op) = 0;
+		virtual void operatorX(std::string_view op) = 0;
 		// identifiers
-		virtual void globalVariableId(const std::string& id) = 0;
-		virtual void localVariableId(const std::string& id) = 0;
-		virtual void memberId(const std::string& id) = 0;
-		virtual void labelId(const std::string& id) = 0;
-		virtual void functionId(const std::string& id) = 0;
-		virtual void parameterId(const std::string& id) = 0;
+		virtual void globalVariableId(std::string_view id) = 0;
+		virtual void localVariableId(std::string_view id) = 0;
+		virtual void memberId(std::string_view id) = 0;
+		virtual void labelId(std::string_view id) = 0;
+		virtual void functionId(std::string_view id) = 0;
+		virtual void parameterId(std::string_view id) = 0;
 		// other
-		virtual void keyword(const std::string& k) = 0;
-		virtual void dataType(const std::string& t) = 0;
-		virtual void preprocessor(const std::string& p) = 0;
-		virtual void include(const std::string& i) = 0;
+		virtual void keyword(std::string_view k) = 0;
+		virtual void dataType(std::string_view t) = 0;
+		virtual void preprocessor(std::string_view p) = 0;
+		virtual void include(std::string_view i) = 0;
 		// constants
-		virtual void constantBool(const std::string& c) = 0;
-		virtual void constantInt(const std::string& c) = 0;
-		virtual void constantFloat(const std::string& c) = 0;
-		virtual void constantString(const std::string& c) = 0;
-		virtual void constantSymbol(const std::string& c) = 0;
-		virtual void constantPointer(const std::string& c) = 0;
+		virtual void constantBool(std::string_view c) = 0;
+		virtual void constantInt(std::string_view c) = 0;
+		virtual void constantFloat(std::string_view c) = 0;
+		virtual void constantString(std::string_view c) = 0;
+		virtual void constantSymbol(std::string_view c) = 0;
+		virtual void constantPointer(std::string_view c) = 0;
 		// comment_prefix comment
 		virtual void comment(
-			const std::string& comment) = 0;
+			std::string_view comment) = 0;
 
 	// Special methods.
 	//
@@ -90,27 +98,27 @@ class OutputManager
 	public:
 		// [space]op[space]
 		virtual void operatorX(
-			const std::string& op,
+			std::string_view op,
 			bool spaceBefore,
 			bool spaceAfter);
 		// indent// comment
 		virtual void comment(
-			const std::string& comment,
-			const std::string& indent);
+			std::string_view comment,
+			std::string_view indent);
 		// [indent]// comment\n
 		virtual void commentLine(
-			const std::string& comment,
-			const std::string& indent = "");
+			std::string_view comment,
+			std::string_view indent = "");
 		// [indent]#include <include>[ // comment]
 		virtual void includeLine(
-			const std::string& header,
-			const std::string& indent = "",
-			const std::string& comment = "");
+			std::string_view header,
+			std::string_view indent = "",
+			std::string_view comment = "");
 		// [indent]typedef t1 t2;
 		virtual void typedefLine(
-			const std::string& indent,
-			const std::string& t1,
-			const std::string& t2);
+			std::string_view indent,
+			std::string_view t1,
+			std::string_view t2);
 
 	// Data.
 	//
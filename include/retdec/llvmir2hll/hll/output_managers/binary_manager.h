@@ -0,0 +1,59 @@
+/**
+* @file include/retdec/llvmir2hll/hll/output_managers/binary_manager.h
+* @brief A binary output manager class.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_HLL_OUTPUT_MANAGERS_BINARY_MANAGER_H
+#define RETDEC_LLVMIR2HLL_HLL_OUTPUT_MANAGERS_BINARY_MANAGER_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <llvm/Support/raw_ostream.h>
+
+#include "retdec/llvmir2hll/hll/output_managers/token_manager.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+ * An output manager emitting the same tokens as the JSON output managers in
+ * the compact binary format described in retdec/hlltokens/binary_format.h.
+ *
+ * Use retdec::hlltokens::BinaryTokenReader to read the output.
+ */
+class BinaryOutputManager : public TokenOutputManager
+{
+	public:
+		BinaryOutputManager(llvm::raw_ostream& out);
+		virtual void finalize() override;
+
+	protected:
+		virtual void generateToken(TokenKind k, std::string_view v) override;
+		virtual void generateAddressEntry(Address a) override;
+
+	private:
+		void writeByte(std::uint8_t b);
+		void writeVarint(std::uint64_t n);
+		void writeString(std::string_view str);
+
+	private:
+		llvm::raw_ostream& _out;
+
+		/// Token values that have already been written (with stable
+		/// addresses, so they can be referenced by @c _stringIndexes).
+		std::deque<std::string> _strings;
+		/// Indexes of token values in the string table.
+		std::unordered_map<std::string_view, std::uint32_t> _stringIndexes;
+		/// Last generated defined address.
+		std::uint64_t _lastAddress = 0;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -21,26 +21,26 @@ class PlainOutputManager : public OutputManager
 
 	public:
 		virtual void newLine() override;
-		virtual void space(const std::string& space = " ") override;
+		virtual void space(std::string_view space = " ") override;
 		virtual void punctuation(char p) override;
-		virtual void operatorX(const std::string& op) override;
-		virtual void globalVariableId(const std::string& id) override;
-		virtual void localVariableId(const std::string& id) override;
-		virtual void memberId(const std::string& id) override;
-		virtual void labelId(const std::string& id) override;
-		virtual void functionId(const std::string& id) override;
-		virtual void parameterId(const std::string& id) override;
-		virtual void keyword(const std::string& k) override;
-		virtual void dataType(const std::string& t) override;
-		virtual void preprocessor(const std::string& p) override;
-		virtual void include(const std::string& i) override;
-		virtual void constantBool(const std::string& c) override;
-		virtual void constantInt(const std::string& c) override;
-		virtual void constantFloat(const std::string& c) override;
-		virtual void constantString(const std::string& c) override;
-		virtual void constantSymbol(const std::string& c) override;
-		virtual void constantPointer(const std::string& c) override;
-		virtual void comment(const std::string& comment) override;
+		virtual void operatorX(std::string_view op) override;
+		virtual void globalVariableId(std::string_view id) override;
+		virtual void localVariableId(std::string_view id) override;
+		virtual void memberId(std::string_view id) override;
+		virtual void labelId(std::string_view id) override;
+		virtual void functionId(std::string_view id) override;
+		virtual void parameterId(std::string_view id) override;
+		virtual void keyword(std::string_view k) override;
+		virtual void dataType(std::string_view t) override;
+		virtual void preprocessor(std::string_view p) override;
+		virtual void include(std::string_view i) override;
+		virtual void constantBool(std::string_view c) override;
+		virtual void constantInt(std::string_view c) override;
+		virtual void constantFloat(std::string_view c) override;
+		virtual void constantString(std::string_view c) override;
+		virtual void constantSymbol(std::string_view c) override;
+		virtual void constantPointer(std::string_view c) override;
+		virtual void comment(std::string_view comment) override;
 
 	public:
 		virtual void commentModifier() override;
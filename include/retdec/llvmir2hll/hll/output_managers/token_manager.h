@@ -0,0 +1,86 @@
+/**
+* @file include/retdec/llvmir2hll/hll/output_managers/token_manager.h
+* @brief A base class of output managers serializing individual tokens.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_HLL_OUTPUT_MANAGERS_TOKEN_MANAGER_H
+#define RETDEC_LLVMIR2HLL_HLL_OUTPUT_MANAGERS_TOKEN_MANAGER_H
+
+#include <stack>
+#include <string>
+
+#include "retdec/llvmir2hll/hll/output_manager.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+ * A base class of output managers that serialize the code as a sequence of
+ * tokens interleaved with address entries (e.g. JSON).
+ *
+ * It takes care of the comment modifier and of deciding when an address entry
+ * has to be generated. Subclasses only serialize the resulting entries.
+ */
+class TokenOutputManager : public OutputManager
+{
+	public:
+		virtual void newLine() override;
+		virtual void space(std::string_view space = " ") override;
+		virtual void punctuation(char p) override;
+		virtual void operatorX(std::string_view op) override;
+		virtual void globalVariableId(std::string_view id) override;
+		virtual void localVariableId(std::string_view id) override;
+		virtual void memberId(std::string_view id) override;
+		virtual void labelId(std::string_view id) override;
+		virtual void functionId(std::string_view id) override;
+		virtual void parameterId(std::string_view id) override;
+		virtual void keyword(std::string_view k) override;
+		virtual void dataType(std::string_view t) override;
+		virtual void preprocessor(std::string_view p) override;
+		virtual void include(std::string_view i) override;
+		virtual void constantBool(std::string_view c) override;
+		virtual void constantInt(std::string_view c) override;
+		virtual void constantFloat(std::string_view c) override;
+		virtual void constantString(std::string_view c) override;
+		virtual void constantSymbol(std::string_view c) override;
+		virtual void constantPointer(std::string_view c) override;
+		virtual void comment(std::string_view comment) override;
+
+	public:
+		virtual void commentModifier() override;
+		virtual void addressPush(Address a) override;
+		virtual void addressPop() override;
+
+	protected:
+		/// Serializes a single token.
+		virtual void generateToken(TokenKind k, std::string_view v) = 0;
+		/// Serializes an entry associating subsequent tokens with @a a.
+		virtual void generateAddressEntry(Address a) = 0;
+
+	private:
+		void token(TokenKind k, std::string_view v);
+
+	private:
+		std::stack<std::pair<Address, bool>> _addrs;
+		std::pair<Address, bool> _addrToGenerate;
+		/**
+		 * Used to implement commentModifier():
+		 *   1. commentModifier() sets _commentModifierOn flag to true.
+		 *   2. All token generators check if the flag is set.
+		 *   3. If it is not, they generate token entry as usual.
+		 *   4. If it is, instead of generating token entry,
+		 *      they serialize token value to string and concatenate it to
+		 *      _runningComment.
+		 *   5. Before generating newline token, the newline() token generator
+		 *      checks the flag and if it is set, it generates comment token
+		 *      from _runningComment and resets the flag and _runningComment.
+		 */
+		bool _commentModifierOn = false;
+		std::string _runningComment;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
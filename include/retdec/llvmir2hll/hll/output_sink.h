@@ -0,0 +1,58 @@
+/**
+* @file include/retdec/llvmir2hll/hll/output_sink.h
+* @brief A stream that passes the emitted code to a caller-supplied sink.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_HLL_OUTPUT_SINK_H
+#define RETDEC_LLVMIR2HLL_HLL_OUTPUT_SINK_H
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+#include <llvm/Support/raw_ostream.h>
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+ * A function that receives chunks of the emitted code.
+ * The chunk is valid only during the call.
+ */
+using OutputSink = std::function<void(std::string_view chunk)>;
+
+/**
+ * An output stream that collects the emitted code into a buffer of the given
+ * size and passes it to a sink whenever the buffer is full (and when the
+ * stream is flushed or destroyed).
+ *
+ * This allows the caller to process the output while it is being generated
+ * instead of waiting for the whole output.
+ */
+class OutputSinkStream: public llvm::raw_ostream
+{
+	public:
+		/// Default size of chunks passed to the sink.
+		static constexpr std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+	public:
+		OutputSinkStream(
+			OutputSink sink,
+			std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+		virtual ~OutputSinkStream() override;
+
+	private:
+		virtual void write_impl(const char* ptr, std::size_t size) override;
+		virtual uint64_t current_pos() const override;
+
+	private:
+		OutputSink _sink;
+		/// Number of bytes passed to the sink so far.
+		uint64_t _pos = 0;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -45,6 +45,7 @@
 #include "retdec/llvmir2hll/graphs/cg/cg_writer_factory.h"
 #include "retdec/llvmir2hll/hll/hll_writer.h"
 #include "retdec/llvmir2hll/hll/hll_writer_factory.h"
+#include "retdec/llvmir2hll/hll/output_sink.h"
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/llvm/llvm_debug_info_obtainer.h"
@@ -110,6 +111,7 @@ public:
 
 	void setConfig(retdec::config::Config* c);
 	void setOutputString(std::string* outString);
+	void setOutputSink(const llvmir2hll::OutputSink* outSink);
 
 private:
 	bool initialize(llvm::Module &m);
@@ -181,6 +183,9 @@ private:
 
 	/// Output string stream.
 	std::unique_ptr<llvm::raw_string_ostream> outStringStream;
+
+	/// Output stream passing the code to a caller-supplied sink.
+	std::unique_ptr<llvmir2hll::OutputSinkStream> outSinkStream;
 };
 
 } // namespace llvmir2hll
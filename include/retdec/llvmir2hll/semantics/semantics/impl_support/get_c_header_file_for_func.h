@@ -9,31 +9,65 @@
 
 #include <cstddef>
 #include <optional>
+#include <string>
+#include <string_view>
 
-#include "retdec/llvmir2hll/support/types.h"
-#include "retdec/utils/array.h"
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
+
+/**
+* @brief A C header file in which a function is declared.
+*
+* Instances are meant to be stored in constant tables, so all the strings are
+* views into string literals.
+*/
+struct FuncCHeader {
+	/// Name of the function.
+	std::string_view funcName;
+	/// Name of the header file.
+	std::string_view header;
+};
 
 /**
-* @brief Maps all the functions from array @a funcs into @a header by adding
-*        them into @a map.
+* @brief Returns @c true if the given table is sorted by function names and
+*        contains every function at most once.
 *
-* @param[in] funcs Statically allocated array of function names
-*                  (<tt>const char *</tt>).
-* @param[in] header The name of the header file (<tt>const char *</tt>).
-* @param[out] map A map into which the mappings will be stored.
+* Tables with header files are searched by binary search, so every table
+* should be checked by a @c static_assert using this function.
 */
-#define ADD_FUNCS_TO_C_HEADER_MAP(funcs, header, map) \
-	for (std::size_t i = 0, e = retdec::utils::arraySize(funcs); i != e; ++i) { \
-		map[funcs[i]] = header; \
+template<std::size_t N>
+constexpr bool isSortedFuncCHeaderTable(const FuncCHeader (&headers)[N]) {
+	for (std::size_t i = 1; i < N; ++i) {
+		if (!(headers[i - 1].funcName < headers[i].funcName)) {
+			return false;
+		}
 	}
+	return true;
+}
 
-namespace retdec {
-namespace llvmir2hll {
-namespace semantics {
+/**
+* @brief A read-only view of a sorted table of FuncCHeader.
+*/
+class FuncCHeaderTable {
+public:
+	constexpr FuncCHeaderTable() = default;
+
+	template<std::size_t N>
+	constexpr FuncCHeaderTable(const FuncCHeader (&headers)[N]):
+		first(headers), last(headers + N) {}
+
+	constexpr const FuncCHeader *begin() const { return first; }
+	constexpr const FuncCHeader *end() const { return last; }
+
+private:
+	const FuncCHeader *first = nullptr;
+	const FuncCHeader *last = nullptr;
+};
 
-std::optional<std::string> getCHeaderFileForFuncFromMap(
+std::optional<std::string> getCHeaderFileForFuncFromTable(
 		const std::string &funcName,
-		const StringStringUMap &map);
+		const FuncCHeaderTable &table);
 
 } // namespace semantics
 } // namespace llvmir2hll
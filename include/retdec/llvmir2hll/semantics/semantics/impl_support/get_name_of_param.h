@@ -10,37 +10,74 @@
 #include <cstddef>
 #include <optional>
 #include <string>
-#include <unordered_map>
-
-/**
-* @brief Sets a name of the given parameter for the given function.
-*/
-#define ADD_PARAM_NAME(funcName, paramPos, paramName) \
-	funcParamNamesMap[FuncParamPosPair(funcName, paramPos)] = paramName;
+#include <string_view>
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
-/// A pair of function name and parameter position.
-using FuncParamPosPair = std::pair<std::string, unsigned>;
+/**
+* @brief A name of a parameter of a function.
+*
+* Instances are meant to be stored in constant tables, so all the strings are
+* views into string literals.
+*/
+struct FuncParamName {
+	/// Name of the function.
+	std::string_view funcName;
+	/// Position of the parameter (starting from 1).
+	unsigned paramPos;
+	/// Name of the parameter.
+	std::string_view paramName;
+};
+
+/**
+* @brief Strict ordering of FuncParamName by function name and parameter
+*        position.
+*/
+constexpr bool operator<(const FuncParamName &a, const FuncParamName &b) {
+	return a.funcName < b.funcName ||
+		(a.funcName == b.funcName && a.paramPos < b.paramPos);
+}
 
 /**
-* @brief A hashing functor for FuncParamPosPair.
+* @brief Returns @c true if the given table is sorted and contains every
+*        (function, position) pair at most once.
+*
+* Tables with parameter names are searched by binary search, so every table
+* should be checked by a @c static_assert using this function.
 */
-struct FuncParamPosPairHasher {
-	std::size_t operator()(const FuncParamPosPair &p) const {
-		return std::hash<std::string>()(p.first) + p.second;
+template<std::size_t N>
+constexpr bool isSortedFuncParamNamesTable(const FuncParamName (&names)[N]) {
+	for (std::size_t i = 1; i < N; ++i) {
+		if (!(names[i - 1] < names[i])) {
+			return false;
+		}
 	}
-};
+	return true;
+}
+
+/**
+* @brief A read-only view of a sorted table of FuncParamName.
+*/
+class FuncParamNamesTable {
+public:
+	constexpr FuncParamNamesTable() = default;
+
+	template<std::size_t N>
+	constexpr FuncParamNamesTable(const FuncParamName (&names)[N]):
+		first(names), last(names + N) {}
 
-/// Mapping of a function name and parameter position into the name of this
-/// parameter.
-using FuncParamNamesMap = std::unordered_map<FuncParamPosPair, std::string,
-	FuncParamPosPairHasher>;
+	constexpr const FuncParamName *begin() const { return first; }
+	constexpr const FuncParamName *end() const { return last; }
+
+private:
+	const FuncParamName *first = nullptr;
+	const FuncParamName *last = nullptr;
+};
 
-std::optional<std::string> getNameOfParamFromMap(const std::string &funcName,
-	unsigned paramPos, const FuncParamNamesMap &map);
+std::optional<std::string> getNameOfParamFromTable(const std::string &funcName,
+	unsigned paramPos, const FuncParamNamesTable &table);
 
 } // namespace semantics
 } // namespace llvmir2hll
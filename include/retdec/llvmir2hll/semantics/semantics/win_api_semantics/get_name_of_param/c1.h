@@ -1,6 +1,6 @@
 /**
 * @file include/retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/c1.h
-* @brief Initializes FuncParamNamesMap for WinAPI functions starting with C
+* @brief Provides the table of parameter names of WinAPI functions starting with C
 *        (first part).
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
@@ -15,7 +15,7 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-void initFuncParamNamesMap_C1(FuncParamNamesMap &funcParamNamesMap);
+FuncParamNamesTable getFuncParamNamesTable_C1();
 
 } // namespace win_api
 } // namespace semantics
@@ -1,6 +1,6 @@
 /**
 * @file include/retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/e.h
-* @brief Initializes FuncParamNamesMap for WinAPI functions starting with E.
+* @brief Provides the table of parameter names of WinAPI functions starting with E.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -14,7 +14,7 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-void initFuncParamNamesMap_E(FuncParamNamesMap &funcParamNamesMap);
+FuncParamNamesTable getFuncParamNamesTable_E();
 
 } // namespace win_api
 } // namespace semantics
@@ -1,6 +1,6 @@
 /**
 * @file include/retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/n.h
-* @brief Initializes FuncParamNamesMap for WinAPI functions starting with N.
+* @brief Provides the table of parameter names of WinAPI functions starting with N.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -14,7 +14,7 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-void initFuncParamNamesMap_N(FuncParamNamesMap &funcParamNamesMap);
+FuncParamNamesTable getFuncParamNamesTable_N();
 
 } // namespace win_api
 } // namespace semantics
@@ -17,7 +17,8 @@ namespace loader {
 
 std::unique_ptr<Image> createImage(
 		const std::string& filePath,
-		bool isRaw = false);
+		bool isRaw = false,
+		retdec::fileformat::LoadFlags loadFlags = retdec::fileformat::LoadFlags::NONE);
 std::unique_ptr<Image> createImage(
 		const std::shared_ptr<retdec::fileformat::FileFormat>& fileFormat);
 
@@ -14,6 +14,18 @@
 namespace retdec {
 namespace macho_extractor {
 
+/**
+ * Architecture slice of Mach-O Universal Binary. Its data are a view into
+ * the buffer of the universal binary, so they are valid only as long as
+ * the BreakMachOUniversal instance exists.
+ */
+struct MachOSlice
+{
+	std::string archName;     ///< LLVM architecture name.
+	std::uint64_t offset = 0; ///< Offset of the slice in the universal binary.
+	llvm::StringRef data;     ///< Content of the slice.
+};
+
 class BreakMachOUniversal
 {
 	private:
@@ -31,6 +43,13 @@ class BreakMachOUniversal
 		bool getByArchFamily(
 				std::uint32_t cpuType,
 				llvm::object::MachOUniversalBinary::object_iterator &res);
+		bool getByArchFamilyName(
+				const std::string &familyName,
+				llvm::object::MachOUniversalBinary::object_iterator &res);
+		bool getBest(
+				llvm::object::MachOUniversalBinary::object_iterator &res);
+		MachOSlice getSlice(
+				llvm::object::MachOUniversalBinary::object_iterator &object);
 		bool extract(
 				llvm::object::MachOUniversalBinary::object_iterator &object,
 				const std::string &outPath);
@@ -70,6 +89,15 @@ class BreakMachOUniversal
 				const std::string &machoArchName,
 				const std::string &outPath);
 		/// @}
+
+		/// @brief In-memory access methods
+		/// @{
+		bool getBestArchive(MachOSlice &res);
+		bool getArchiveForFamily(
+				const std::string &familyName,
+				MachOSlice &res);
+		std::vector<MachOSlice> getAllArchives();
+		/// @}
 };
 
 } // namespace macho_extractor
@@ -7,11 +7,19 @@
 #ifndef RETDEC_PDBPARSER_PDB_FILE_H
 #define RETDEC_PDBPARSER_PDB_FILE_H
 
+#include <memory>
+
 #include "retdec/pdbparser/pdb_info.h"
 #include "retdec/pdbparser/pdb_symbols.h"
 #include "retdec/pdbparser/pdb_types.h"
 #include "retdec/pdbparser/pdb_utils.h"
 
+namespace retdec {
+namespace utils {
+class MappedFile;
+} // namespace utils
+} // namespace retdec
+
 namespace retdec {
 namespace pdbparser {
 
@@ -132,14 +140,7 @@ typedef union _PDB_ROOT
 class PDBFile
 {
 	public:
-		PDBFile(void) :
-				pdb_loaded(false), pdb_initialized(false), pdb_filename(nullptr), pdb_version(0), page_size(0), pdb_file_size(
-				        0), pdb_file_data(
-				nullptr), num_streams(0), pdb_fpo_num(0), pdb_newfpo_num(0), pdb_sec_num(0), pdb_header(nullptr), pdb_root_dir(
-				nullptr), pdb_info_v700(nullptr), dbi_header_v700(nullptr), pdb_types(nullptr), pdb_symbols(nullptr)
-		{
-		}
-		;
+		PDBFile(void);
 		~PDBFile(void);
 
 		// Action methods
@@ -152,13 +153,7 @@ class PDBFile
 		{
 			return pdb_version;
 		}
-		PDBStream * get_stream(unsigned int num)
-		{
-			if (num < num_streams)
-				return &streams[num];
-			else
-				return nullptr;
-		}
+		PDBStream * get_stream(unsigned int num);
 		const char * get_module_name(unsigned int num)
 		{
 			if (num < modules.size())
@@ -199,6 +194,7 @@ class PDBFile
 		// Internal functions
 		bool stream_is_linear(PDB_DWORD *pages, int num_pages);
 		char * extract_stream(PDB_DWORD *pages, int num_pages);
+		void load_stream(unsigned int num);
 		PDBFileState load_pdb_v200(void);
 		PDBFileState load_pdb_v700(void);
 		void parse_modules(void);
@@ -211,6 +207,7 @@ class PDBFile
 		unsigned int pdb_version;
 		unsigned int page_size;
 		unsigned int pdb_file_size;
+		std::unique_ptr<retdec::utils::MappedFile> pdb_file_map;  // memory-mapped PDB file
 		char * pdb_file_data;
 		unsigned int num_streams;
 		int pdb_fpo_num;
@@ -17,6 +17,7 @@ namespace pdbparser {
 
 // PDB type definition
 class PDBTypeDef;
+class PDBTypes;
 // PDB type definition map (key is type index)
 typedef std::map<int, PDBTypeDef *> PDBTypeDefIndexMap;
 // PDB type definition map - for fully defined types (key is type name)
@@ -158,7 +159,7 @@ class PDBTypeBase : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfRecord *, int, PDBTypeDefIndexMap &)
+		virtual void parse(lfRecord *, int, PDBTypes &)
 		{
 		}
 		;
@@ -198,7 +199,7 @@ class PDBTypeFieldList : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfFieldList *record, int size, PDBTypeDefIndexMap &types);
+		virtual void parse(lfFieldList *record, int size, PDBTypes &types);
 		virtual void dump(bool nested = false);
 		virtual bool is_fully_defined(void)
 		{
@@ -238,7 +239,7 @@ class PDBTypeEnum : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfEnum *record, int size, PDBTypeDefIndexMap &types);
+		virtual void parse(lfEnum *record, int size, PDBTypes &types);
 		virtual void dump(bool nested = false);
 		virtual bool is_fully_defined(void)
 		{
@@ -275,7 +276,7 @@ class PDBTypeArray : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfArray *record, int size, PDBTypeDefIndexMap &types);
+		virtual void parse(lfArray *record, int size, PDBTypes &types);
 		virtual void dump(bool nested = false);
 		virtual bool is_fully_defined(void)
 		{
@@ -313,7 +314,7 @@ class PDBTypePointer : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfPointer *record, int size, PDBTypeDefIndexMap &types);
+		virtual void parse(lfPointer *record, int size, PDBTypes &types);
 		virtual void dump(bool nested = false);
 		virtual bool is_fully_defined(void)
 		{
@@ -348,7 +349,7 @@ class PDBTypeConst : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfModifier *record, int, PDBTypeDefIndexMap &types);
+		virtual void parse(lfModifier *record, int, PDBTypes &types);
 		virtual void dump(bool nested = false);
 		virtual bool is_fully_defined(void)
 		{
@@ -384,7 +385,7 @@ class PDBTypeArglist : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfArgList *record, int, PDBTypeDefIndexMap &)
+		virtual void parse(lfArgList *record, int, PDBTypes &)
 		{
 			arglist = record;
 		}
@@ -443,8 +444,8 @@ class PDBTypeFunction : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfProc *record, int size, PDBTypeDefIndexMap &types);
-		void parse_mfunc(lfMFunc *record, int size, PDBTypeDefIndexMap &types);
+		virtual void parse(lfProc *record, int size, PDBTypes &types);
+		void parse_mfunc(lfMFunc *record, int size, PDBTypes &types);
 		virtual void dump(bool nested = false);
 		virtual bool is_fully_defined(void)
 		{
@@ -488,7 +489,7 @@ class PDBTypeStruct : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfStructure *record, int size, PDBTypeDefIndexMap &types);
+		virtual void parse(lfStructure *record, int size, PDBTypes &types);
 		virtual void dump(bool nested = false);
 		virtual bool is_fully_defined(void)
 		{
@@ -520,7 +521,7 @@ class PDBTypeUnion : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfUnion *record, int size, PDBTypeDefIndexMap &types);
+		virtual void parse(lfUnion *record, int size, PDBTypes &types);
 		virtual void dump(bool nested = false);
 		virtual bool is_fully_defined(void)
 		{
@@ -556,7 +557,7 @@ class PDBTypeClass : public PDBTypeDef
 		;
 
 		// Basic methods - parse and dump
-		virtual void parse(lfClass *record, int size, PDBTypeDefIndexMap &types);
+		virtual void parse(lfClass *record, int size, PDBTypes &types);
 		virtual void dump(bool nested = false);
 		virtual bool is_fully_defined(void)
 		{
@@ -585,27 +586,22 @@ class PDBTypes
 	public:
 		// Constructor and destructor
 		PDBTypes(PDBStream *s) :
-				pdb_tpi_size(s->size), pdb_tpi_data(s->data), parsed(false), tpi_header(
-				        reinterpret_cast<HDR *>(s->data))
+				pdb_tpi_size(s->size), pdb_tpi_data(s->data), parsed(false), indexed(false), parsing_index(
+				        0x7fffffff), tpi_header(reinterpret_cast<HDR *>(s->data))
 		{
 		}
 		;
 		~PDBTypes(void);
 
 		// Action methods
+		void index_types(void);
 		void parse_types(void);
 
 		// Getting methods
-		PDBTypeDef * get_type_by_index(int index)
-		{
-			if (!parsed)
-				return nullptr;
-			else
-				return types[index];
-		}
-		;
+		PDBTypeDef * get_type_by_index(int index);
 		PDBTypeDef * get_type_by_name(char *name)
 		{
+			parse_types();
 			if (!parsed)
 				return nullptr;
 			else
@@ -620,19 +616,24 @@ class PDBTypes
 	public:
 		// Internal functions
 		PHDR TPILoadTypeInfo(void);
+		PDBTypeDef * parse_type(int index);
 
 		// Variables
 		unsigned int pdb_tpi_size;  // size of TPI stream
 		char * pdb_tpi_data;  // data from TPI stream
-		bool parsed;  // types are parsed
+		bool parsed;  // all types are parsed
+		bool indexed;  // type records are indexed
+		int parsing_index;  // index of type being parsed (higher indexes are not visible)
 
 		// Data structure pointers
 		HDR * tpi_header;
 
 		// Data containers
-		PDBTypeDefIndexMap types;  // Map of type definitions (key is type index)
-		PDBTypeDefIndexMap types_fully_defined;  // Map of fully defined types (key is type index)
-		PDBTypeDefNameMap types_byname;  // Map of fully defined types (key is type name)
+		std::vector<unsigned int> type_offsets;  // Offsets of type records (index is type index - tiMin)
+		std::vector<bool> type_parsed;  // Type record was parsed (index is type index - tiMin)
+		PDBTypeDefIndexMap types;  // Map of parsed type definitions (key is type index)
+		PDBTypeDefIndexMap types_fully_defined;  // Map of parsed fully defined types (key is type index)
+		PDBTypeDefNameMap types_byname;  // Map of parsed fully defined types (key is type name)
 };
 
 } // namespace pdbparser
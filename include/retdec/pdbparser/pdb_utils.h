@@ -97,6 +97,7 @@ typedef struct _PDBStream
 		int size;  // stream size in bytes
 		bool unused;  // indicates unused stream
 		bool linear;  // stream is linear in PDB file
+		PDB_DWORD * pages;  // index of pages used by stream
 } PDBStream;
 
 // PDB Modules vector
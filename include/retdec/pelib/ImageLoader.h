@@ -13,6 +13,7 @@
 #ifndef RETDEC_PELIB_IMAGE_LOADER_H
 #define RETDEC_PELIB_IMAGE_LOADER_H
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -77,8 +78,33 @@ struct PELIB_IMAGE_COMPARE
 	std::uint32_t startTickCount = 0;               // GetTickCount value at the start of image testing
 };
 
+//-----------------------------------------------------------------------------
+// Content of the file the image is loaded from. If the content is shared,
+// full pages of the mapped image point to it instead of copying it.
+// The owner keeps the content alive (it is empty if the caller does).
+
+struct PELIB_FILE_DATA
+{
+	const std::uint8_t * data() const
+	{
+		return fileBegin;
+	}
+
+	std::size_t size() const
+	{
+		return fileSize;
+	}
+
+	std::shared_ptr<const void> owner;
+	const std::uint8_t * fileBegin;
+	std::size_t fileSize;
+	bool isShared;
+};
+
 //-----------------------------------------------------------------------------
 // Support structure for one PE file page
+// Full pages of file data are not copied. They point directly to the file content
+// and only get their own buffer when written to (copy-on-write). Zero pages share one buffer.
 
 struct PELIB_FILE_PAGE
 {
@@ -86,48 +112,79 @@ struct PELIB_FILE_PAGE
 	{
 		isInvalidPage = true;
 		isZeroPage = false;
+		isOwnBuffer = false;
 	}
 
 	// Initializes the page with a valid data
-	bool setValidPage(const void * data, size_t length)
+	bool setValidPage(const PELIB_FILE_DATA & fileData, const std::uint8_t * data, size_t length)
 	{
-		// Write the valid data to the page
-		writeToPage(data, 0, length);
-
-		// Write zero data to the end of the page
-		memset(buffer.data() + length, 0, PELIB_PAGE_SIZE - length);
+		if(length == PELIB_PAGE_SIZE && fileData.isShared)
+		{
+			// Full page: Share the data with the file
+			buffer = std::shared_ptr<const std::uint8_t>(fileData.owner, data);
+			isOwnBuffer = false;
+		}
+		else
+		{
+			// Copy the valid data to the page. The rest of the page is zeroed
+			buffer = allocatePage(data, length);
+			isOwnBuffer = true;
+		}
 
 		isInvalidPage = false;
 		isZeroPage = false;
 		return true;
 	}
 
-	// Initializes the page as zero page. To save memory, we won't initialize buffer
+	// Initializes the page as zero page. To save memory, all zero pages share one buffer
 	void setZeroPage()
 	{
-		buffer.clear();
+		buffer = std::shared_ptr<const std::uint8_t>(std::shared_ptr<const void>(), zeroPage);
+		isOwnBuffer = false;
 		isInvalidPage = false;
 		isZeroPage = true;
 	}
 
 	void writeToPage(const void * data, size_t offset, size_t length)
 	{
-		if(offset < PELIB_PAGE_SIZE)
+		// Invalid pages are not accessible in the mapped image. Writes to them are ignored
+		if(offset < PELIB_PAGE_SIZE && isInvalidPage == false)
 		{
-			// Make sure that there is buffer allocated
-			if(buffer.size() != PELIB_PAGE_SIZE)
-				buffer.resize(PELIB_PAGE_SIZE);
+			// Pages shared with the file, the zero page and buffers shared by copies of the loader get their own copy
+			if(isOwnBuffer == false || buffer.use_count() > 1)
+			{
+				buffer = allocatePage(buffer.get(), PELIB_PAGE_SIZE);
+				isOwnBuffer = true;
+			}
 
 			// Copy the data, up to page size
 			if((offset + length) > PELIB_PAGE_SIZE)
 				length = PELIB_PAGE_SIZE - offset;
-			memcpy(buffer.data() + offset, data, length);
+			memcpy(const_cast<std::uint8_t *>(buffer.get()) + offset, data, length);
 		}
 	}
 
-	ByteBuffer buffer;                    // A page-sized buffer, holding one image page. Empty if isInvalidPage
+	// Returns the page content, or nullptr if the page is invalid
+	const std::uint8_t * getData() const
+	{
+		return buffer.get();
+	}
+
+	static std::shared_ptr<const std::uint8_t> allocatePage(const std::uint8_t * data, size_t length)
+	{
+		std::shared_ptr<std::uint8_t> page(new std::uint8_t[PELIB_PAGE_SIZE], std::default_delete<std::uint8_t[]>());
+
+		memcpy(page.get(), data, length);
+		memset(page.get() + length, 0, PELIB_PAGE_SIZE - length);
+		return page;
+	}
+
+	static const std::uint8_t zeroPage[PELIB_PAGE_SIZE];   // Content of all zero pages
+
+	std::shared_ptr<const std::uint8_t> buffer; // Page content: the file data, the zero page or own buffer. Empty if isInvalidPage
 	bool isInvalidPage;                   // For invalid pages within image (SectionAlignment > 0x1000)
 	bool isZeroPage;                      // For sections with VirtualSize != 0, RawSize = 0
+	bool isOwnBuffer;                     // If true, the buffer has been allocated for this page (written or partially loaded page)
 };
 
 //-----------------------------------------------------------------------------
@@ -139,7 +196,7 @@ class ImageLoader
 
 	ImageLoader(std::uint32_t loaderFlags = 0);
 
-	int Load(ByteBuffer & fileData, bool loadHeadersOnly = false);
+	int Load(const ByteBuffer & fileData, bool loadHeadersOnly = false, bool shareFileData = false);
 	int Load(std::istream & fs, std::streamoff fileOffset = 0, bool loadHeadersOnly = false);
 	int Load(const char * fileName, bool loadHeadersOnly = false);
 
@@ -153,7 +210,7 @@ class ImageLoader
 
 	std::uint32_t readString(std::string & str, std::uint32_t rva, std::uint32_t maxLength = 65535);
 	std::uint32_t readStringRc(std::string & str, std::uint32_t rva);
-	std::uint32_t readStringRaw(ByteBuffer & fileData,
+	std::uint32_t readStringRaw(const PELIB_FILE_DATA & fileData,
 		                        std::string & str,
 		                        std::size_t offset,
 		                        std::size_t maxLength = 65535,
@@ -366,23 +423,25 @@ class ImageLoader
 	bool processImageRelocations(std::uint64_t oldImageBase, std::uint64_t getImageBase, std::uint32_t VirtualAddress, std::uint32_t Size);
 	void writeNewImageBase(std::uint64_t newImageBase);
 
-	int captureDosHeader(ByteBuffer & fileData);
+	int loadFileData(const PELIB_FILE_DATA & fileData, bool loadHeadersOnly);
+
+	int captureDosHeader(const PELIB_FILE_DATA & fileData);
 	int saveDosHeader(std::ostream & fs, std::streamoff fileOffset);
-	int captureNtHeaders(ByteBuffer & fileData);
+	int captureNtHeaders(const PELIB_FILE_DATA & fileData);
 	int saveNtHeaders(std::ostream & fs, std::streamoff fileOffset);
-	int captureSectionName(ByteBuffer & fileData, std::string & sectionName, const std::uint8_t * name);
-	int captureSectionHeaders(ByteBuffer & fileData);
+	int captureSectionName(const PELIB_FILE_DATA & fileData, std::string & sectionName, const std::uint8_t * name);
+	int captureSectionHeaders(const PELIB_FILE_DATA & fileData);
 	int saveSectionHeaders(std::ostream & fs, std::streamoff fileOffset);
-	int captureImageSections(ByteBuffer & fileData);
-	int captureOptionalHeader32(std::uint8_t * fileData, std::uint8_t * filePtr, std::uint8_t * fileEnd);
-	int captureOptionalHeader64(std::uint8_t * fileData, std::uint8_t * filePtr, std::uint8_t * fileEnd);
+	int captureImageSections(const PELIB_FILE_DATA & fileData);
+	int captureOptionalHeader32(const std::uint8_t * fileData, const std::uint8_t * filePtr, const std::uint8_t * fileEnd);
+	int captureOptionalHeader64(const std::uint8_t * fileData, const std::uint8_t * filePtr, const std::uint8_t * fileEnd);
 
 	int verifyDosHeader(PELIB_IMAGE_DOS_HEADER & hdr, std::size_t fileSize);
 	int verifyDosHeader(std::istream & fs, std::streamoff fileOffset, std::size_t fileSize);
 
-	int loadImageAsIs(ByteBuffer & fileData);
+	int loadImageAsIs(const PELIB_FILE_DATA & fileData);
 
-	std::uint32_t captureImageSection(ByteBuffer & fileData,
+	std::uint32_t captureImageSection(const PELIB_FILE_DATA & fileData,
 									  std::uint32_t virtualAddress,
 									  std::uint32_t virtualSize,
 									  std::uint32_t pointerToRawData,
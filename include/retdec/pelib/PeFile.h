@@ -134,7 +134,8 @@ namespace PeLib
 		int loadPeHeaders(bool loadHeadersOnly = false);
 		
 		/// Alternate load - can be used when the data are already loaded to memory to prevent duplicating large buffers
-		int loadPeHeaders(ByteBuffer & fileData, bool loadHeadersOnly = false);
+		/// If shareFileData is true, the mapped image refers to the data, so they must stay unchanged while the file is used
+		int loadPeHeaders(const ByteBuffer & fileData, bool loadHeadersOnly = false, bool shareFileData = false);
 
 		/// returns PEFILE64 or PEFILE32
 		int getFileType() const;
@@ -170,6 +171,8 @@ namespace PeLib
 		int readDelayImportDirectory() ;
 		/// Reads the security directory of the current file.
 		int readSecurityDirectory() ;
+		/// Reads all data directories of the current file. Directories within the mapped image can be read concurrently.
+		void readDirectories(bool concurrently = true);
 
 		/// Checks the entry point code
 		LoaderError checkEntryPointErrors() const;
@@ -112,6 +112,10 @@ namespace PeLib
 		// Other errors
 		LDR_ERROR_INMEMORY_IMAGE,                   // The file is a 1:1 in-memory image
 
+		// Errors from limits of parsed directories
+		LDR_ERROR_RSRC_ENTRY_COUNT_EXCEEDED,        // Number of resource directory entries exceeds maximum
+		LDR_ERROR_RELOC_ENTRY_COUNT_EXCEEDED,       // Number of relocation entries exceeds maximum
+
 		LDR_ERROR_MAX
 
 	};
@@ -152,6 +156,8 @@ namespace PeLib
 	const std::uint32_t PELIB_MAX_IMPORT_DLLS        = 0x100;           // Maximum number of imported DLLs we consider OK
 	const std::uint32_t PELIB_MAX_IMPORTED_FUNCTIONS = 0x1000;          // Maximum number of exported functions (per DLL) that we support
 	const std::uint32_t PELIB_MAX_EXPORTED_FUNCTIONS = 0x1000;          // Maximum number of exported functions that we support
+	const std::uint32_t PELIB_MAX_RESOURCE_ENTRIES   = 0x40000;         // Maximum number of resource directory entries that we parse
+	const std::uint32_t PELIB_MAX_RELOCATION_ENTRIES = 0x400000;        // Maximum number of relocation entries that we parse
 	const std::uint32_t PE_MAX_SECTION_COUNT_XP = 96;
 	const std::uint32_t PE_MAX_SECTION_COUNT_7 = 192;
 
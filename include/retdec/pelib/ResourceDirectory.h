@@ -347,6 +347,8 @@ namespace PeLib
 		  ResourceNode m_rnRoot;
 		  /// Detection of invalid structure of nodes in directory.
 		  std::set<std::size_t> m_resourceNodeOffsets;
+		  /// Number of entries read so far, limited by PELIB_MAX_RESOURCE_ENTRIES.
+		  std::size_t m_numberOfEntries;
 		  /// Stores RVAs which are occupied by this export directory.
 		  std::vector<std::pair<unsigned int, unsigned int>> m_occupiedAddresses;
 		  /// Error detected by the import table parser
@@ -544,6 +546,8 @@ namespace PeLib
 		  void insertNodeOffset(std::size_t nodeOffset);
 		  /// Check if node with specified offset was loaded.
 		  bool hasNodeOffset(std::size_t nodeOffset) const;
+		  /// Count entries of a loaded node. Returns false if the total limit was exceeded.
+		  bool addNumberOfEntries(std::size_t numberOfEntries);
 
 		  void addOccupiedAddressRange(unsigned int start, unsigned int end);
 		  const std::vector<std::pair<unsigned int, unsigned int>>& getOccupiedAddresses() const;
@@ -14,6 +14,8 @@
 #include "retdec/common/basic_block.h"
 #include "retdec/common/function.h"
 #include "retdec/config/config.h"
+#include "retdec/fileformat/file_format/file_format.h"
+#include "retdec/llvmir2hll/hll/output_sink.h"
 
 namespace retdec {
 
@@ -51,6 +53,30 @@ bool decompile(
 		std::string* outString = nullptr
 );
 
+/**
+ * Run a decompilation according to a \p config configuration of the already
+ * parsed \p inputFile, which must be the input file set in \p config.
+ * The file is not parsed again. It must have been loaded with
+ * \c LoadFlags::PROFILE_DECOMPILER.
+ * If \p outString is set, decompilation output will be returned
+ * in this string. Otherwise, output file is expected to be set in \p config.
+ */
+bool decompile(
+		retdec::config::Config& config,
+		const std::shared_ptr<retdec::fileformat::FileFormat>& inputFile,
+		std::string* outString = nullptr
+);
+
+/**
+ * Run a decompilation according to a \p config configuration.
+ * Decompilation output is passed to \p outSink in chunks while it is being
+ * generated, so the caller can process it before the decompilation ends.
+ */
+bool decompile(
+		retdec::config::Config& config,
+		const retdec::llvmir2hll::OutputSink& outSink
+);
+
 } // namespace retdec
 
 #endif
@@ -8,6 +8,7 @@
 #define RETDEC_RTTI_FINDER_VTABLE_VTABLE_FINDER_H
 
 #include <cstdint>
+#include <set>
 #include <vector>
 
 #include "retdec/rtti-finder/rtti/rtti_gcc.h"
@@ -33,6 +34,12 @@ void findMsvcVtables(
 		VtablesMsvc& vtables,
 		RttiMsvc& rttis);
 
+void findPossibleVtables(
+		const retdec::loader::Image* img,
+		std::set<retdec::common::Address>& possibleVtables,
+		bool gcc,
+		bool bulk = true);
+
 } // namespace rtti_finder
 } // namespace retdec
 
@@ -0,0 +1,147 @@
+/**
+ * @file include/retdec/unpacker/decompression/decompression_buffers.h
+ * @brief Fast access to input and output buffers of decompression algorithms.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UNPACKER_DECOMPRESSION_DECOMPRESSION_BUFFERS_H
+#define RETDEC_UNPACKER_DECOMPRESSION_DECOMPRESSION_BUFFERS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "retdec/utils/dynamic_buffer.h"
+
+namespace retdec {
+namespace unpacker {
+
+/**
+ * @brief Read-only view of compressed data.
+ *
+ * Reads bytes directly from the underlying memory. Bytes beyond the end of
+ * the data are read as 0, the same way as in @c DynamicBuffer.
+ */
+class InputView
+{
+public:
+	InputView() : _data(nullptr), _size(0), _readable(0) {}
+	explicit InputView(const retdec::utils::DynamicBuffer& buffer)
+			: _data(buffer.getRawBuffer()),
+			_size(buffer.getRealDataSize()),
+			_readable(std::min(buffer.getRealDataSize(), buffer.getCapacity())) {}
+
+	uint32_t size() const { return _size; }
+
+	uint8_t read(uint32_t pos) const
+	{
+		return pos < _readable ? _data[pos] : 0;
+	}
+
+	uint32_t readLe32(uint32_t pos) const
+	{
+		if (pos < _readable && _readable - pos >= 4)
+		{
+			const uint8_t* p = _data + pos;
+			return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+		}
+
+		uint32_t value = 0;
+		for (uint32_t i = 0; i < 4; ++i)
+			value |= static_cast<uint32_t>(read(pos + i)) << (i << 3);
+		return value;
+	}
+
+private:
+	const uint8_t* _data;
+	uint32_t _size;
+	uint32_t _readable;
+};
+
+/**
+ * @brief Output window of decompressed data.
+ *
+ * Takes over the content of the output buffer for the time of decompression
+ * and gives it back when destroyed. Writes beyond the capacity of the output
+ * buffer are ignored and reads of bytes not yet written return 0, the same
+ * way as in @c DynamicBuffer. Unlike @c DynamicBuffer, match copies check the
+ * capacity once per match instead of once per byte.
+ */
+class OutputWindow
+{
+public:
+	explicit OutputWindow(retdec::utils::DynamicBuffer& buffer)
+			: _buffer(buffer), _capacity(buffer.getCapacity())
+	{
+		_buffer.swapBuffer(_data);
+	}
+
+	OutputWindow(const OutputWindow&) = delete;
+	OutputWindow& operator =(const OutputWindow&) = delete;
+
+	~OutputWindow()
+	{
+		_buffer.swapBuffer(_data);
+	}
+
+	uint32_t capacity() const { return _capacity; }
+
+	uint8_t read(uint32_t pos) const
+	{
+		return pos < _data.size() && pos < _capacity ? _data[pos] : 0;
+	}
+
+	void write(uint32_t pos, uint8_t byte)
+	{
+		if (pos == _data.size() && pos < _capacity)
+			_data.push_back(byte);
+		else if (pos < _capacity)
+		{
+			if (pos > _data.size())
+				_data.resize(pos + 1);
+			_data[pos] = byte;
+		}
+	}
+
+	/**
+	 * Copies @a count bytes from distance @a dist behind @a pos to @a pos
+	 * and moves @a pos behind them. The source may overlap the copied bytes.
+	 *
+	 * @return @c true if all the bytes fit into the capacity, otherwise only
+	 *         the bytes that fit are copied and @c false is returned.
+	 */
+	bool copy(uint32_t& pos, uint32_t dist, uint32_t count)
+	{
+		uint32_t available = pos < _capacity ? _capacity - pos : 0;
+		bool fits = count <= available;
+		if (!fits)
+			count = available;
+
+		uint32_t src = pos - dist;
+		if (dist != 0 && dist <= pos && pos == _data.size())
+		{
+			_data.resize(pos + count);
+			uint8_t* data = _data.data();
+			for (uint32_t i = 0; i < count; ++i)
+				data[pos + i] = data[src + i];
+			pos += count;
+		}
+		else
+		{
+			for (uint32_t i = 0; i < count; ++i)
+				write(pos++, read(src++));
+		}
+
+		return fits;
+	}
+
+private:
+	retdec::utils::DynamicBuffer& _buffer;
+	std::vector<uint8_t> _data;
+	uint32_t _capacity;
+};
+
+} // namespace unpacker
+} // namespace retdec
+
+#endif
@@ -8,6 +8,7 @@
 #define RETDEC_UNPACKER_DECOMPRESSION_LZMA_LZMA_DATA_H
 
 #include "retdec/unpacker/decompression/compressed_data.h"
+#include "retdec/unpacker/decompression/decompression_buffers.h"
 
 namespace retdec {
 namespace unpacker {
@@ -60,6 +61,7 @@ private:
 	bool decodeDirectBits(uint32_t count, uint32_t initValue, uint32_t& ret);
 	bool decodeRevBitTree(uint32_t pos, uint32_t rep, uint32_t& posSlot);
 
+	InputView _input; ///< The view of the input buffer.
 	uint32_t _readPos; ///< The position of reading from the input buffer.
 	uint8_t _pb, _lp, _lc; ///< Parameters of LZMA compression.
 	RangeDecoder _rangeDecoder; ///< Range decoder.
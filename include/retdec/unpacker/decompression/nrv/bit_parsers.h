@@ -8,6 +8,7 @@
 #define RETDEC_UNPACKER_DECOMPRESSION_NRV_BIT_PARSERS_H
 
 #include "retdec/fileformat/fftypes.h"
+#include "retdec/unpacker/decompression/decompression_buffers.h"
 #include "retdec/utils/dynamic_buffer.h"
 
 using namespace retdec::utils;
@@ -45,22 +46,22 @@ private:
 	BitParserN& operator =(const BitParserN&);
 };
 
-class BitParser8 : public BitParserN<uint32_t>
+/**
+ * Non-virtual bit getter of NRV bitstreams with 8-bit bit words.
+ */
+class BitGetter8
 {
 public:
-	BitParser8() = default;
-	BitParser8(const BitParser8&) = delete;
-
-	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
+	bool getBit(uint8_t& bit, const InputView& data, uint32_t& pos)
 	{
 		bit = (_value >> 7) & 1;
 		_value <<= 1;
 		if ((_value & 0xFF) == 0)
 		{
-			if (pos >= data.getRealDataSize())
+			if (pos >= data.size())
 				return false;
 
-			_value = data.read<uint8_t>(pos++, retdec::utils::Endianness::LITTLE);
+			_value = data.read(pos++);
 
 			bit = (_value >> 7) & 1;
 			_value <<= 1;
@@ -69,24 +70,27 @@ public:
 
 		return true;
 	}
+
+private:
+	uint32_t _value = 0;
 };
 
-class BitParserLe32 : public BitParserN<uint32_t>
+/**
+ * Non-virtual bit getter of NRV bitstreams with 32-bit little endian bit words.
+ */
+class BitGetterLe32
 {
 public:
-	BitParserLe32() = default;
-	BitParserLe32(const BitParserLe32&) = delete;
-
-	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
+	bool getBit(uint8_t& bit, const InputView& data, uint32_t& pos)
 	{
 		bit = (_value >> 31) & 1;
 		_value <<= 1;
 		if (_value == 0)
 		{
-			if (pos >= data.getRealDataSize())
+			if (pos >= data.size())
 				return false;
 
-			_value = data.read<uint32_t>(pos, retdec::utils::Endianness::LITTLE);
+			_value = data.readLe32(pos);
 			pos += 4;
 
 			bit = (_value >> 31) & 1;
@@ -96,6 +100,61 @@ public:
 
 		return true;
 	}
+
+private:
+	uint32_t _value = 0;
+};
+
+/**
+ * Bit getter calling any @c BitParser through its virtual interface.
+ */
+class VirtualBitGetter
+{
+public:
+	VirtualBitGetter(BitParser* bitParser, const DynamicBuffer& buffer) : _bitParser(bitParser), _buffer(buffer) {}
+
+	bool getBit(uint8_t& bit, const InputView& /*data*/, uint32_t& pos)
+	{
+		return _bitParser->getBit(bit, _buffer, pos);
+	}
+
+private:
+	BitParser* _bitParser;
+	const DynamicBuffer& _buffer;
+};
+
+class BitParser8 : public BitParser
+{
+public:
+	BitParser8() = default;
+	BitParser8(const BitParser8&) = delete;
+
+	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
+	{
+		return _getter.getBit(bit, InputView(data), pos);
+	}
+
+	BitGetter8& getBitGetter() { return _getter; }
+
+private:
+	BitGetter8 _getter;
+};
+
+class BitParserLe32 : public BitParser
+{
+public:
+	BitParserLe32() = default;
+	BitParserLe32(const BitParserLe32&) = delete;
+
+	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
+	{
+		return _getter.getBit(bit, InputView(data), pos);
+	}
+
+	BitGetterLe32& getBitGetter() { return _getter; }
+
+private:
+	BitGetterLe32 _getter;
 };
 
 } // namespace unpacker
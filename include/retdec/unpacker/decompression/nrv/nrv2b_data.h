@@ -26,6 +26,8 @@ public:
 	virtual bool decompress(DynamicBuffer& outputBuffer) override;
 
 private:
+	template <typename BitGetter> bool decompress(BitGetter& bitGetter, DynamicBuffer& outputBuffer);
+
 	Nrv2bData& operator =(const Nrv2bData&);
 };
 
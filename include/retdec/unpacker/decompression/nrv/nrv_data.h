@@ -27,6 +27,22 @@ public:
 	}
 
 protected:
+	/**
+	 * Calls @a decompressFnc with the bit getter matching the bit parser of
+	 * the data. The known bit parsers are resolved once here so the bit
+	 * reading in the decompression loop is not a virtual call.
+	 */
+	template <typename Fnc> bool withBitGetter(Fnc decompressFnc)
+	{
+		if (auto bitParser8 = dynamic_cast<BitParser8*>(_bitParser))
+			return decompressFnc(bitParser8->getBitGetter());
+		else if (auto bitParserLe32 = dynamic_cast<BitParserLe32*>(_bitParser))
+			return decompressFnc(bitParserLe32->getBitGetter());
+
+		VirtualBitGetter bitGetter(_bitParser, _buffer);
+		return decompressFnc(bitGetter);
+	}
+
 	uint32_t _readPos, _writePos;
 	BitParser* _bitParser;
 
@@ -11,6 +11,8 @@
 #include <sstream>
 #include <string>
 
+#include "retdec/fileformat/file_format/file_format.h"
+#include "retdec/loader/image_factory.h"
 #include "retdec/utils/io/log.h"
 #include "retdec/unpacker/unpacker_exception.h"
 
@@ -85,6 +87,7 @@ public:
 		std::string inputFile; ///< Path to the input file (packed file).
 		std::string outputFile; ///< Path to the output file (unpacked file).
 		bool brute; ///< Brute mode of the unpacking was chosen.
+		std::shared_ptr<retdec::fileformat::FileFormat> inputFileFormat; ///< Already parsed input file, if any. Used instead of parsing the input file again.
 	};
 
 	virtual ~Plugin() = default;
@@ -148,6 +151,30 @@ public:
 		return _cachedExitCode;
 	}
 
+	/**
+	 * Forgets the cached exit code of the plugin, so the next call of @ref Plugin::run
+	 * performs the unpacking again. It needs to be called when another input file is unpacked.
+	 */
+	void resetCachedExitCode()
+	{
+		_cachedExitCode = PLUGIN_EXIT_UNPACKED;
+	}
+
+	/**
+	 * Checks whether the already parsed input file is packed by the packer of
+	 * this plugin. Only cheap checks (entry point bytes, section names) should
+	 * be performed here. It is used by the fast detection of packers, which
+	 * never selects plugins not implementing it.
+	 *
+	 * @param file The parsed input file.
+	 *
+	 * @return @c true if the file is packed by the packer of this plugin.
+	 */
+	virtual bool detect(const retdec::fileformat::FileFormat& /*file*/) const
+	{
+		return false;
+	}
+
 	/**
 	 * Pure virtual method that performs preparation of unpacking.
 	 */
@@ -207,6 +234,23 @@ protected:
 	Plugin(const Plugin&);
 	Plugin& operator =(const Plugin&);
 
+	/**
+	 * Creates the loaded image of the input file from the startup arguments. The already parsed
+	 * input file is used if there is any, otherwise the input file is parsed from its path.
+	 *
+	 * @return Loaded image of the input file or @c nullptr if it cannot be loaded.
+	 */
+	std::unique_ptr<retdec::loader::Image> createInputImage() const
+	{
+		if (startupArgs.inputFileFormat)
+			return retdec::loader::createImage(startupArgs.inputFileFormat);
+
+		return retdec::loader::createImage(
+				startupArgs.inputFile,
+				false,
+				retdec::fileformat::LoadFlags::PROFILE_UNPACKER);
+	}
+
 	Plugin::Info info; ///< The static info of the plugin.
 	Plugin::Arguments startupArgs; ///< Startup arguments of the plugin.
 
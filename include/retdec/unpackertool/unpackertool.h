@@ -7,11 +7,29 @@
 #ifndef RETDEC_UNPACKERTOOL_UNPACKERTOOL_H
 #define RETDEC_UNPACKERTOOL_UNPACKERTOOL_H
 
+#include <memory>
+#include <string>
+
+#include "retdec/fileformat/file_format/file_format.h"
+
 namespace retdec {
 namespace unpackertool {
 
 int _main(int argc, char** argv);
 
+/**
+ * Unpack the already parsed \p inputFile into \p outputFile.
+ * Packers are detected only by the checks of the unpacking plugins (entry
+ * point bytes, section names), not by the full compiler and packer detection
+ * used by \c _main(), so files which are not packed are recognized quickly.
+ * The plugins use \p inputFile instead of parsing the file again.
+ * \return \c 0 if the file was unpacked, the exit code of \c _main() otherwise.
+ */
+int unpack(
+		const std::shared_ptr<retdec::fileformat::FileFormat>& inputFile,
+		const std::string& outputFile
+);
+
 } // namespace unpackertool
 } // namespace retdec
 
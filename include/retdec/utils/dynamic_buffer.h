@@ -70,6 +70,7 @@ public:
 
 	const uint8_t* getRawBuffer() const;
 	std::vector<uint8_t> getBuffer() const;
+	void swapBuffer(std::vector<uint8_t>& data);
 
 	void forEach(const std::function<void(uint8_t&)>& func);
 	void forEachReverse(const std::function<void(uint8_t&)>& func);
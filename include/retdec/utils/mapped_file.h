@@ -0,0 +1,58 @@
+/**
+* @file include/retdec/utils/mapped_file.h
+* @brief Read-only memory-mapped files.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_MAPPED_FILE_H
+#define RETDEC_UTILS_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief A read-only view of a whole file.
+*
+* The file is mapped into memory when the platform supports it. Otherwise,
+* its content is read into an internal buffer. In both cases, the data stay
+* valid until the instance is destroyed.
+*/
+class MappedFile: private NonCopyable
+{
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const std::string& filePath);
+		~MappedFile();
+
+		bool open(const std::string& filePath);
+		void close();
+
+		bool isOpen() const;
+		bool isMapped() const;
+		const std::uint8_t* getData() const;
+		std::size_t getSize() const;
+
+	private:
+		/// Mapped or buffered content of the file.
+		const std::uint8_t* _data = nullptr;
+		/// Size of the file.
+		std::size_t _size = 0;
+		/// Is the file opened?
+		bool _opened = false;
+		/// Has the file been mapped (or read into @c _buffer)?
+		bool _mapped = false;
+		/// Content of the file when it cannot be mapped.
+		std::vector<std::uint8_t> _buffer;
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+
+"""Runs the decompiler with the given LLVM pipelines over a corpus of files,
+aggregates per-pass statistics, and compares the pipelines' results.
+
+Each pass is reported with its total run time and the total number of LLVM IR
+instructions and basic blocks it added or removed. The hit rate of the
+demangler cache over the whole pipeline is reported as well. Passes that never
+change the IR (its hash is the same before and after them on all files) are
+marked, they are candidates for removal from the pipeline.
+
+The first pipeline is the reference. For the other pipelines, the size of the
+LLVM IR handed to the back-end is compared with the reference for each file.
+Files where it grows by more than the given bound (in percent) are reported
+and make the script fail.
+"""
+
+from __future__ import print_function
+
+import argparse
+import csv
+import importlib
+import os
+import sys
+import tempfile
+import time
+
+utils = importlib.import_module('retdec-utils')
+utils.check_python_version()
+CmdRunner = utils.CmdRunner
+
+
+sys.stdout = utils.Unbuffered(sys.stdout)
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DECOMPILER = os.path.join(SCRIPT_DIR, 'retdec-decompiler')
+BACKEND_PASS = 'retdec-llvmir2hll'
+
+
+def parse_args(args):
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+
+    parser.add_argument('inputs',
+                        metavar='FILE',
+                        nargs='+',
+                        help='Files to decompile. Directories are searched recursively.')
+
+    parser.add_argument('-p', '--pipelines',
+                        nargs='+',
+                        default=['default', 'fast'],
+                        help='Named pipelines to run, the first one is the reference (default: default fast).')
+
+    parser.add_argument('-b', '--bound',
+                        type=float,
+                        default=5.0,
+                        help='Allowed growth of the back-end LLVM IR against the reference, in percent (default: 5).')
+
+    parser.add_argument('-t', '--timeout',
+                        type=int,
+                        default=300,
+                        help='Timeout of one decompilation, in seconds (default: 300).')
+
+    parser.add_argument('-o', '--output-dir',
+                        help='Directory for decompilation outputs (default: temporary directory).')
+
+    parser.add_argument('--decompiler',
+                        default=DECOMPILER,
+                        help='Path to retdec-decompiler.')
+
+    return parser.parse_args(args)
+
+
+def collect_files(inputs):
+    files = []
+    for i in inputs:
+        if os.path.isdir(i):
+            for root, _, names in os.walk(i):
+                files.extend(os.path.join(root, n) for n in sorted(names))
+        else:
+            files.append(i)
+    return files
+
+
+def read_stats(path):
+    with open(path) as f:
+        return [{
+            'index': int(r['index']),
+            'pass': r['pass'],
+            'seconds': float(r['seconds']),
+            'instructions_before': int(r['instructions_before']),
+            'instructions_after': int(r['instructions_after']),
+            'blocks_before': int(r['blocks_before']),
+            'blocks_after': int(r['blocks_after']),
+            'ir_hash_before': r['ir_hash_before'],
+            'ir_hash_after': r['ir_hash_after'],
+            'demangler_hits': int(r.get('demangler_hits') or 0),
+            'demangler_misses': int(r.get('demangler_misses') or 0),
+        } for r in csv.DictReader(f)]
+
+
+def backend_ir_size(stats):
+    """Returns the number of instructions handed to the back-end."""
+    for s in stats:
+        if s['pass'] == BACKEND_PASS:
+            return s['instructions_before']
+    return stats[-1]['instructions_after'] if stats else 0
+
+
+class PipelineTuner:
+    def __init__(self, _args):
+        self.args = parse_args(_args)
+        self.output_dir = self.args.output_dir or tempfile.mkdtemp(prefix='retdec-pipeline-tuner-')
+        # pipeline -> file -> stats
+        self.stats = {p: {} for p in self.args.pipelines}
+        # pipeline -> total wall time
+        self.times = {p: 0.0 for p in self.args.pipelines}
+
+    def run(self):
+        files = collect_files(self.args.inputs)
+        if not files:
+            utils.print_error('no input files')
+            return 1
+
+        for f in files:
+            for p in self.args.pipelines:
+                self._decompile(f, p)
+
+        for p in self.args.pipelines:
+            self._print_pass_report(p)
+        return self._print_quality_report()
+
+    def _decompile(self, path, pipeline):
+        base = os.path.join(self.output_dir, os.path.basename(path) + '.' + pipeline)
+        stats_file = base + '.stats.csv'
+        cmd = [
+            self.args.decompiler,
+            '--silent',
+            '--pipeline', pipeline,
+            '--pipeline-stats', stats_file,
+            '-o', base + '.c',
+            path,
+        ]
+
+        print('%s [%s] ' % (path, pipeline), end='')
+        start = time.time()
+        _, rc, timeouted = CmdRunner.run_cmd(cmd, timeout=self.args.timeout, buffer_output=True)
+        self.times[pipeline] += time.time() - start
+
+        if timeouted:
+            print('[TIMEOUT]')
+        elif rc != 0 or not os.path.isfile(stats_file):
+            print('[FAIL]')
+        else:
+            print('[OK]')
+            self.stats[pipeline][path] = read_stats(stats_file)
+
+    def _print_pass_report(self, pipeline):
+        runs = list(self.stats[pipeline].values())
+        if not runs:
+            return
+
+        print()
+        print('Pipeline %s: %d files, %.2f s' % (pipeline, len(runs), self.times[pipeline]))
+        print('%5s  %-32s %10s %12s %10s' % ('index', 'pass', 'seconds', 'delta insns', 'delta bbs'))
+
+        # All runs of the pipeline have the same passes in the same order.
+        for i, s in enumerate(runs[0]):
+            seconds = 0.0
+            insns = 0
+            blocks = 0
+            changed = False
+            for r in runs:
+                if i < len(r):
+                    seconds += r[i]['seconds']
+                    insns += abs(r[i]['instructions_after'] - r[i]['instructions_before'])
+                    blocks += abs(r[i]['blocks_after'] - r[i]['blocks_before'])
+                    changed |= r[i]['ir_hash_after'] != r[i]['ir_hash_before']
+            print('%5d  %-32s %10.3f %12d %10d%s' % (
+                i, s['pass'], seconds, insns, blocks,
+                '' if changed else '  (no effect)'))
+
+        hits = sum(s['demangler_hits'] for r in runs for s in r)
+        misses = sum(s['demangler_misses'] for r in runs for s in r)
+        if hits + misses:
+            print('Demangler cache: %d hits, %d misses (%.1f%% hit rate)' % (
+                hits, misses, 100.0 * hits / (hits + misses)))
+
+    def _print_quality_report(self):
+        reference = self.args.pipelines[0]
+        ret = 0
+
+        print()
+        for p in self.args.pipelines[1:]:
+            over = []
+            for path, ref_stats in self.stats[reference].items():
+                if path not in self.stats[p]:
+                    continue
+                ref_size = backend_ir_size(ref_stats)
+                size = backend_ir_size(self.stats[p][path])
+                growth = 100.0 * (size - ref_size) / ref_size if ref_size else 0.0
+                if growth > self.args.bound:
+                    over.append((path, ref_size, size, growth))
+
+            print('Pipeline %s against %s: %.2f s vs %.2f s, %d files over the %.1f%% bound' % (
+                p, reference, self.times[p], self.times[reference], len(over), self.args.bound))
+            for path, ref_size, size, growth in over:
+                print('    %s: %d -> %d instructions (+%.1f%%)' % (path, ref_size, size, growth))
+            if over:
+                ret = 1
+
+        return ret
+
+
+if __name__ == '__main__':
+    tuner = PipelineTuner(sys.argv[1:])
+    sys.exit(tuner.run())
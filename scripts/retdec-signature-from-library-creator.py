@@ -5,7 +5,10 @@
 from __future__ import print_function
 
 import argparse
+import filecmp
+import hashlib
 import importlib
+import json
 import os
 import shutil
 import sys
@@ -22,6 +25,10 @@ SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
 AR = os.path.join(SCRIPT_DIR, 'retdec-ar-extractor')
 BIN2PAT = os.path.join(SCRIPT_DIR, 'retdec-bin2pat')
 PAT2YARA = os.path.join(SCRIPT_DIR, 'retdec-pat2yara')
+YARAC = os.path.join(SCRIPT_DIR, 'retdec-yarac')
+
+# Change when outputs of bin2pat or pat2yara change for the same inputs.
+MANIFEST_VERSION = 1
 
 def parse_args(args):
     parser = argparse.ArgumentParser(description=__doc__,
@@ -62,9 +69,37 @@ def parse_args(args):
                         action='store_true',
                         help='Stop after bin2pat.')
 
+    parser.add_argument('-j', '--jobs',
+                        dest='jobs',
+                        type=int,
+                        default=0,
+                        help='Number of threads used by bin2pat and pat2yara '
+                             '(0 for number of processors).')
+
+    parser.add_argument('-c', '--cache-dir',
+                        dest='cache_dir',
+                        metavar='DIR',
+                        help='Extract objects into DIR and cache their patterns '
+                             'there. Output is rebuilt only when some inputs '
+                             'or options changed.')
+
+    parser.add_argument('--compile',
+                        dest='compile',
+                        action='store_true',
+                        help='Create also precompiled \'.yarac\' file with yarac.')
+
     return parser.parse_args(args)
 
 
+def file_sha256(path):
+    """Returns SHA-256 of the file content as a hex string."""
+    sha256 = hashlib.sha256()
+    with open(path, 'rb') as f:
+        for chunk in iter(lambda: f.read(1 << 20), b''):
+            sha256.update(chunk)
+    return sha256.hexdigest()
+
+
 class SigFromLib:
     def __init__(self, _args):
         self.args = parse_args(_args)
@@ -89,12 +124,86 @@ class SigFromLib:
         if self.args.ignore_nops:
             self.ignore_nop = '--ignore-nops'
 
+        if self.args.cache_dir:
+            os.makedirs(self.args.cache_dir, exist_ok=True)
+
         return True
 
+    def _object_dir(self, lib_path, lib_name):
+        """Directory into which objects of the library are extracted.
+
+        With cache, objects are extracted to the same path on every run,
+        bin2pat caches patterns by object paths.
+        """
+        if self.args.cache_dir:
+            return os.path.join(os.path.abspath(self.args.cache_dir), 'objects', file_sha256(lib_path))
+        return os.path.join(self.tmp_dir_path, lib_name) + '-objects'
+
+    def _compiled_output(self):
+        return os.path.splitext(self.args.output)[0] + '.yarac'
+
+    def _manifest_path(self):
+        return self.args.output + '.manifest'
+
+    def _create_manifest(self):
+        """Describe inputs and options that affect the output."""
+        return {
+            'version': MANIFEST_VERSION,
+            'inputs': [file_sha256(lib_path) for lib_path in self.args.input],
+            'min_pure': str(self.args.min_pure),
+            'ignore_nops': self.args.ignore_nops,
+            'logfile': self.args.logfile,
+        }
+
+    def _is_up_to_date(self, manifest):
+        """Check whether outputs were created from the same inputs."""
+        outputs = [self.args.output]
+        if self.args.logfile:
+            outputs.append(self.args.output + '.log')
+        if not all(os.path.isfile(o) for o in outputs):
+            return False
+        if self.args.compile and not self._is_compiled():
+            return False
+
+        try:
+            with open(self._manifest_path(), 'r') as f:
+                return json.load(f) == manifest
+        except (OSError, ValueError):
+            return False
+
+    def _replace_if_changed(self, new_file, file):
+        """Move new_file to file unless their contents are the same."""
+        if os.path.isfile(file) and filecmp.cmp(new_file, file, shallow=False):
+            return False
+        os.replace(new_file, file)
+        return True
+
+    def _is_compiled(self):
+        """Check whether precompiled rules are newer than the output file."""
+        compiled = self._compiled_output()
+        return (os.path.isfile(compiled)
+                and os.path.getmtime(compiled) >= os.path.getmtime(self.args.output))
+
+    def _compile(self):
+        """Create precompiled rules from the output file."""
+        compiled = self._compiled_output()
+        _, result, _ = CmdRunner.run_cmd([YARAC, '-w', self.args.output, compiled], discard_stdout=True, discard_stderr=True)
+        if result != 0:
+            utils.remove_file_forced(compiled)
+        return result == 0
+
     def run(self):
         if not self._check_arguments():
             return 1
 
+        manifest = None
+        if self.args.cache_dir and not self.args.bin_to_pat_only:
+            manifest = self._create_manifest()
+            if self._is_up_to_date(manifest):
+                print('%s is up to date' % self.args.output)
+                shutil.rmtree(self.tmp_dir_path, ignore_errors=True)
+                return 0
+
         pattern_files = []
         object_dirs = []
 
@@ -109,8 +218,9 @@ class SigFromLib:
             lib_name = os.path.splitext(os.path.basename(lib_path))[0]
 
             # Create sub-directory for object files.
-            object_dir = os.path.join(self.tmp_dir_path, lib_name) + '-objects'
+            object_dir = self._object_dir(lib_path, lib_name)
             object_dirs = [object_dir]
+            shutil.rmtree(object_dir, ignore_errors=True)
             os.makedirs(object_dir, exist_ok=True)
 
             # Extract all files to temporary folder.
@@ -125,13 +235,22 @@ class SigFromLib:
                     if os.path.isfile(fname):
                         objects.append(fname)
 
+            # Keep order of objects stable, rule names depend on it.
+            objects.sort()
+
             # Extract patterns from library.
             pattern_file = os.path.join(self.tmp_dir_path, lib_name) + '.pat'
             pattern_files.append(pattern_file)
             with open(self.object_list_path, 'w') as object_list:
                 for item in objects:
                     object_list.write(item + '\n')
-            _, result, _ = CmdRunner.run_cmd([BIN2PAT, '-o', pattern_file, '-l', self.object_list_path], discard_stdout=True, discard_stderr=True)
+            bin2pat_args = [BIN2PAT, '-o', pattern_file, '-l', self.object_list_path]
+            if self.args.jobs:
+                bin2pat_args.extend(['-j', str(self.args.jobs)])
+            if self.args.cache_dir:
+                bin2pat_args.extend(['-c', self.args.cache_dir])
+
+            _, result, _ = CmdRunner.run_cmd(bin2pat_args, discard_stdout=True, discard_stderr=True)
 
             if result != 0:
                 self.print_error_and_cleanup('utility bin2pat failed when processing %s' % lib_path)
@@ -151,11 +270,22 @@ class SigFromLib:
             return 0
 
         # Create final .yara file from .pat files.
-        pat2yara_args = [PAT2YARA] + pattern_files + ['--min-pure', str(self.args.min_pure), '-o', self.args.output]
+        # With cache, existing outputs are kept if they did not change.
+        output = self.args.output
+        if manifest:
+            output = os.path.join(self.tmp_dir_path, 'output.yara')
+
+        pat2yara_args = [PAT2YARA] + pattern_files + ['--min-pure', str(self.args.min_pure), '-o', output]
         if self.args.logfile:
-            pat2yara_args.extend(['-l', self.args.output + '.log'])
+            pat2yara_args.extend(['-l', output + '.log'])
         if self.ignore_nop:
             pat2yara_args.extend([self.ignore_nop, str(self.args.ignore_nops)])
+        if self.args.jobs:
+            pat2yara_args.extend(['-j', str(self.args.jobs)])
+
+        # Invalidate manifest before outputs are changed.
+        if manifest:
+            utils.remove_file_forced(self._manifest_path())
 
         _, result, _ = CmdRunner.run_cmd(pat2yara_args, discard_stdout=True, discard_stderr=True)
 
@@ -163,6 +293,22 @@ class SigFromLib:
             self.print_error_and_cleanup('utility pat2yara failed')
             return 1
 
+        # Unchanged output keeps its modification time, so it is not compiled
+        # again.
+        if manifest:
+            self._replace_if_changed(output, self.args.output)
+            if self.args.logfile:
+                self._replace_if_changed(output + '.log', self.args.output + '.log')
+
+        if self.args.compile and not self._is_compiled():
+            if not self._compile():
+                self.print_error_and_cleanup('utility yarac failed')
+                return 1
+
+        if manifest:
+            with open(self._manifest_path(), 'w') as f:
+                json.dump(manifest, f)
+
         # Do cleanup.
         if not self.args.no_cleanup:
             shutil.rmtree(self.tmp_dir_path, ignore_errors=True)
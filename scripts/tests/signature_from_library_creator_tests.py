@@ -0,0 +1,140 @@
+"""Tests for the retdec-signature-from-library-creator.py script.
+
+The script is run with fake archive extractor, bin2pat and pat2yara tools.
+The fake bin2pat caches patterns by object path and content like the real one
+and logs cache hits and misses.
+
+Run with: python3 -m unittest discover -s scripts/tests -p '*_tests.py'
+"""
+
+import hashlib
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import textwrap
+import unittest
+
+SCRIPTS_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Library is a text file with one 'name:content' line per object.
+FAKE_AR = '''
+import os, sys
+lib, out = sys.argv[1], sys.argv[-1]
+if '--valid' in sys.argv:
+    sys.exit(0)
+with open(lib) as f:
+    for line in f:
+        name, content = line.strip().split(':', 1)
+        with open(os.path.join(out, name), 'w') as o:
+            o.write(content)
+'''
+
+FAKE_BIN2PAT = '''
+import hashlib, os, sys
+args = sys.argv[1:]
+out = args[args.index('-o') + 1]
+cache = args[args.index('-c') + 1] if '-c' in args else None
+with open(args[args.index('-l') + 1]) as f:
+    objects = f.read().split()
+rules = ''
+for path in objects:
+    with open(path) as f:
+        content = f.read()
+    rule = 'rule r { meta: source = "%s" content = "%s" }\\n' % (path, content)
+    if cache:
+        key = hashlib.sha256((path + '\\0' + content).encode()).hexdigest()
+        entry = os.path.join(cache, key + '.pat')
+        hit = os.path.isfile(entry)
+        with open(os.path.join(cache, 'bin2pat.log'), 'a') as log:
+            log.write('%s %s\\n' % ('hit' if hit else 'miss', content))
+        if not hit:
+            with open(entry, 'w') as f:
+                f.write(rule)
+    rules += rule
+with open(out, 'w') as f:
+    f.write(rules)
+'''
+
+FAKE_PAT2YARA = '''
+import sys
+args = sys.argv[1:]
+out = args[args.index('-o') + 1]
+with open(out, 'w') as o:
+    for p in args[:args.index('--min-pure')]:
+        with open(p) as f:
+            o.write(f.read())
+'''
+
+
+class SignatureFromLibraryCreatorTests(unittest.TestCase):
+    def setUp(self):
+        self.dir = tempfile.mkdtemp()
+        # The script must be run from an installed 'bin' directory.
+        self.bin_dir = os.path.join(self.dir, 'bin')
+        os.makedirs(self.bin_dir)
+        for script in ['retdec-signature-from-library-creator.py', 'retdec-utils.py']:
+            shutil.copy(os.path.join(SCRIPTS_DIR, script), self.bin_dir)
+        self._add_tool('retdec-ar-extractor', FAKE_AR)
+        self._add_tool('retdec-bin2pat', FAKE_BIN2PAT)
+        self._add_tool('retdec-pat2yara', FAKE_PAT2YARA)
+        self.cache_dir = os.path.join(self.dir, 'cache')
+        self.output = os.path.join(self.dir, 'out.yara')
+
+    def tearDown(self):
+        shutil.rmtree(self.dir, ignore_errors=True)
+
+    def _add_tool(self, name, code):
+        path = os.path.join(self.bin_dir, name)
+        with open(path, 'w') as f:
+            f.write('#!%s\n' % sys.executable)
+            f.write(textwrap.dedent(code))
+        os.chmod(path, 0o755)
+
+    def _add_library(self, name, objects):
+        path = os.path.join(self.dir, name)
+        with open(path, 'w') as f:
+            for obj, content in objects:
+                f.write('%s:%s\n' % (obj, content))
+        return path
+
+    def _run(self, libs):
+        script = os.path.join(self.bin_dir, 'retdec-signature-from-library-creator.py')
+        cmd = [sys.executable, script, '-o', self.output, '-c', self.cache_dir] + libs
+        result = subprocess.run(cmd, cwd=self.dir, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        self.assertEqual(0, result.returncode, result.stdout.decode())
+
+    def _bin2pat_log(self):
+        with open(os.path.join(self.cache_dir, 'bin2pat.log')) as f:
+            return f.read().split('\n')[:-1]
+
+    def _clear_bin2pat_log(self):
+        os.remove(os.path.join(self.cache_dir, 'bin2pat.log'))
+
+    def test_objects_of_unchanged_library_are_taken_from_cache(self):
+        lib1 = self._add_library('lib1.a', [('a.o', 'A'), ('b.o', 'B')])
+        self._run([lib1])
+        self.assertEqual(['miss A', 'miss B'], self._bin2pat_log())
+
+        self._clear_bin2pat_log()
+        lib2 = self._add_library('lib2.a', [('c.o', 'C')])
+        self._run([lib1, lib2])
+        self.assertEqual(['hit A', 'hit B', 'miss C'], self._bin2pat_log())
+
+    def test_output_is_the_same_when_objects_are_taken_from_cache(self):
+        lib1 = self._add_library('lib1.a', [('a.o', 'A')])
+        lib2 = self._add_library('lib2.a', [('b.o', 'B')])
+        self._run([lib1, lib2])
+        with open(self.output) as f:
+            first = f.read()
+
+        os.remove(self.output)
+        self._run([lib1, lib2])
+        with open(self.output) as f:
+            self.assertEqual(first, f.read())
+        self.assertEqual(['miss A', 'miss B', 'hit A', 'hit B'], self._bin2pat_log())
+
+
+if __name__ == '__main__':
+    unittest.main()
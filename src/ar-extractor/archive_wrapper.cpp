@@ -110,21 +110,49 @@ ArchiveWrapper::ArchiveWrapper(
 	std::string &errorMessage)
 	: buffer(MemoryBuffer::getFile(llvm::Twine(archivePath)))
 {
-	succes = false;
+	succes = init(errorMessage);
+}
+
+/**
+ * Constructor.
+ *
+ * @param archiveData content of input archive, it is not copied and it
+ *                    must outlive the created instance
+ * @param succes result of object construction
+ * @param errorMessage possible error message if @p success is set to false
+ */
+ArchiveWrapper::ArchiveWrapper(
+	llvm::MemoryBufferRef archiveData,
+	bool &succes,
+	std::string &errorMessage)
+	: buffer(MemoryBuffer::getMemBuffer(archiveData, false))
+{
+	succes = init(errorMessage);
+}
+
+/**
+ * Parse archive from the buffer.
+ *
+ * @param errorMessage possible error message if @c false is returned
+ *
+ * @return @c true if archive was parsed, @c false otherwise
+ */
+bool ArchiveWrapper::init(std::string &errorMessage)
+{
 	if (!buffer) {
 		errorMessage = "Could not create file buffer";
-		return;
+		return false;
 	}
 
 	Error error = Error::success();
 	archive = std::make_unique<Archive>(buffer.get()->getMemBufferRef(), error);
 	if (error) {
 		errorMessage = llvm::toString(std::move(error));
-		return;
+		return false;
 	}
 
 	// Get object count - this iterates over all objects.
-	succes = getCount(objectCount, errorMessage);
+	return getCount(objectCount, errorMessage);
 }
 
 /**
@@ -262,38 +290,19 @@ bool ArchiveWrapper::extract(
 	 * or may not work on Windows OS.
 	 */
 
-	// Map for non-unique names - counts number of name occurrences.
-	std::map<std::string, std::size_t> nameMap;
-
-	Error error = Error::success();
-	for (const auto &child : archive->children(error)) {
-		if (checkError(error, errorMessage)) {
-			return false;
-		}
-
-		// Try to get name.
-		auto nameOrErr = child.getName();
-		std::string name = nameOrErr ? fixName(nameOrErr->str()) : "invalid_name";
-
-		// Increment name count and fix name if it is not unique.
-		if (++nameMap[name] != 1) {
-			name += "." + std::to_string(nameMap[name]);
-		}
+	std::vector<ArchiveObject> objects;
+	if (!getObjects(objects, errorMessage)) {
+		return false;
+	}
 
-		auto bufferOrErr = child.getBuffer();
-		if (!bufferOrErr) {
-			errorMessage = "Could not get file buffer";
+	auto dir = directory.empty() ? directory : directory + '/';
+	for (const auto &object : objects) {
+		if (!writeFile(dir + object.name, object.data, errorMessage)) {
 			return false;
 		}
-		else {
-			auto dir = directory.empty() ? directory : directory + '/';
-			if (!writeFile(dir + name, *bufferOrErr, errorMessage)) {
-				return false;
-			}
-		}
 	}
 
-	return !checkError(error, errorMessage);
+	return true;
 }
 
 /**
@@ -407,6 +416,53 @@ bool ArchiveWrapper::extractByIndex(
 	return false;
 }
 
+/**
+ * Get all object files without extracting them.
+ *
+ * Names are fixed and made unique in the same way as by @c extract(), i.e.
+ * if multiple files have same name, they are decorated with their index
+ * suffix. Data of objects point into the archive buffer, so they are valid
+ * only as long as this wrapper exists.
+ *
+ * @param result container where objects will be added
+ * @param errorMessage possible error message if @c false is returned
+ *
+ * @return @c true if no errors occurred, @c false otherwise
+ */
+bool ArchiveWrapper::getObjects(
+	std::vector<ArchiveObject> &result,
+	std::string &errorMessage) const
+{
+	// Map for non-unique names - counts number of name occurrences.
+	std::map<std::string, std::size_t> nameMap;
+
+	Error error = Error::success();
+	for (const auto &child : archive->children(error)) {
+		if (checkError(error, errorMessage)) {
+			return false;
+		}
+
+		// Try to get name.
+		auto nameOrErr = child.getName();
+		std::string name = nameOrErr ? fixName(nameOrErr->str()) : "invalid_name";
+
+		// Increment name count and fix name if it is not unique.
+		if (++nameMap[name] != 1) {
+			name += "." + std::to_string(nameMap[name]);
+		}
+
+		auto bufferOrErr = child.getBuffer();
+		if (!bufferOrErr) {
+			errorMessage = "Could not get file buffer";
+			return false;
+		}
+
+		result.push_back({name, *bufferOrErr});
+	}
+
+	return !checkError(error, errorMessage);
+}
+
 /**
  * Get names of all object files in archive.
  *
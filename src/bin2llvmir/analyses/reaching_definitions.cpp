@@ -4,12 +4,14 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <chrono>
 #include <iomanip>
 #include <set>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include <llvm/ADT/Hashing.h>
 #include <llvm/ADT/PostOrderIterator.h>
 #include <llvm/IR/CFG.h>
 #include <llvm/IR/Instruction.h>
@@ -20,6 +22,7 @@
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 #define debug_enabled false
 #include "retdec/bin2llvmir/utils/llvm.h"
 
@@ -35,18 +38,56 @@ namespace bin2llvmir {
 //=============================================================================
 //
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Hash of everything in function @a F that affects its reaching definitions:
+ * basic blocks, their instructions, and operands of these instructions
+ * (control flow edges are operands of terminators).
+ */
+std::size_t hashFunction(const Function& F)
+{
+	hash_code h = hash_value(&F);
+	for (const BasicBlock& B : F)
+	{
+		h = hash_combine(h, &B);
+		for (const Instruction& I : B)
+		{
+			h = hash_combine(h, &I, I.getOpcode());
+			for (const Value* op : I.operand_values())
+			{
+				h = hash_combine(h, op);
+			}
+		}
+	}
+	return h;
+}
+
+} // anonymous namespace
+
 bool ReachingDefinitionsAnalysis::runOnModule(
 		Module& M,
 		Abi* abi,
 		bool trackFlagRegs)
 {
-	_trackFlagRegs = trackFlagRegs;
-	_abi = abi;
-	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(&M);
-
 	clear();
-	initializeBasicBlocks(M);
-	run();
+	setUp(&M, abi, trackFlagRegs);
+
+	// Functions are independent -> they are computed in parallel.
+	//
+	std::vector<std::pair<Function*, BasicBlockMap*>> fncs;
+	for (Function& F : M)
+	{
+		fncs.emplace_back(&F, &bbMap[&F]);
+	}
+	parallelForEach(fncs, [this](std::pair<Function*, BasicBlockMap*>& p)
+	{
+		compute(*p.first, *p.second);
+	});
+
+	LOG << *this << "\n";
 
 	_run = true;
 	return false;
@@ -57,43 +98,159 @@ bool ReachingDefinitionsAnalysis::runOnFunction(
 		Abi* abi,
 		bool trackFlagRegs)
 {
-	_trackFlagRegs = trackFlagRegs;
-	_abi = abi;
-	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(F.getParent());
-
 	clear();
-	initializeBasicBlocks(F);
-	run();
+	setUp(F.getParent(), abi, trackFlagRegs);
+
+	compute(F, bbMap[&F]);
+
+	LOG << *this << "\n";
 
 	_run = true;
 	return false;
 }
 
-void ReachingDefinitionsAnalysis::run()
+/**
+ * Bring the results up to date with module @a M.
+ *
+ * Results are recomputed only for functions that were added, changed, or
+ * invalidated since they were last computed by this method. Results of
+ * removed functions are dropped. If the analysis has not been updated for
+ * @a M with the same settings before, all functions are computed.
+ *
+ * Definitions and uses of recomputed functions are new objects. Pointers to
+ * the old ones must not be used after the update.
+ */
+ReachingDefinitionsAnalysis::UpdateStats ReachingDefinitionsAnalysis::update(
+		Module& M,
+		Abi* abi,
+		bool trackFlagRegs)
 {
-	initializeBasicBlocksPrev();
-	initializeKillGenSets();
-	propagate();
-	initializeDefsAndUses();
+	auto start = Clock::now();
+	UpdateStats stats;
 
-	LOG << *this << "\n";
-
-	clearInternal();
-}
+	if (_module != &M || _abi != abi || _trackFlagRegs != trackFlagRegs)
+	{
+		clear();
+	}
+	setUp(&M, abi, trackFlagRegs);
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Module& M)
-{
+	struct FunctionUpdate
+	{
+		Function* function = nullptr;
+		FunctionState* state = nullptr;
+		BasicBlockMap* bbs = nullptr;
+		bool reused = false;
+	};
+
+	std::set<const Function*> functions;
+	std::vector<FunctionUpdate> updates;
 	for (Function& F : M)
 	{
-		initializeBasicBlocks(F);
+		functions.insert(&F);
+		updates.push_back({&F, &_functionStates[&F], &bbMap[&F]});
+	}
+
+	// Functions are independent -> they are checked and computed in parallel.
+	//
+	parallelForEach(updates, [this](FunctionUpdate& u)
+	{
+		auto hash = hashFunction(*u.function);
+		if (u.state->hash == hash)
+		{
+			u.reused = true;
+			return;
+		}
+
+		auto start = Clock::now();
+		compute(*u.function, *u.bbs);
+		u.state->hash = hash;
+		u.state->time = std::chrono::duration<double>(Clock::now() - start).count();
+	});
+
+	for (auto& u : updates)
+	{
+		if (u.reused)
+		{
+			++stats.reused;
+			stats.saved += u.state->time;
+		}
+		else
+		{
+			++stats.recomputed;
+		}
 	}
+
+	// Functions removed from the module. Their keys may be dangling, they are
+	// only compared.
+	for (auto it = bbMap.begin(); it != bbMap.end();)
+	{
+		if (functions.count(it->first))
+		{
+			++it;
+		}
+		else
+		{
+			_functionStates.erase(it->first);
+			it = bbMap.erase(it);
+		}
+	}
+
+	_run = true;
+	stats.time = std::chrono::duration<double>(Clock::now() - start).count();
+	return stats;
+}
+
+/**
+ * Force recomputation of function @a F results in the next update().
+ * Existing results of @a F remain usable until then.
+ */
+void ReachingDefinitionsAnalysis::invalidate(const llvm::Function* F)
+{
+	_functionStates.erase(F);
+}
+
+void ReachingDefinitionsAnalysis::setUp(
+		llvm::Module* M,
+		Abi* abi,
+		bool trackFlagRegs)
+{
+	_module = M;
+	_trackFlagRegs = trackFlagRegs;
+	_abi = abi;
+	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(M);
+}
+
+/**
+ * (Re)compute results for a single function @a F into @a bbs.
+ * Only @a bbs is modified, so functions can be computed in parallel.
+ */
+void ReachingDefinitionsAnalysis::compute(
+		llvm::Function& F,
+		BasicBlockMap& bbs)
+{
+	bbs.clear();
+	initializeBasicBlocks(F, bbs);
+	run(&F, bbs);
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
+void ReachingDefinitionsAnalysis::run(
+		const llvm::Function* F,
+		BasicBlockMap& bbs)
+{
+	initializeBasicBlocksPrev(bbs);
+	initializeKillGenSets(bbs);
+	propagate(F, bbs);
+	initializeDefsAndUses(bbs);
+	clearInternal(bbs);
+}
+
+void ReachingDefinitionsAnalysis::initializeBasicBlocks(
+		llvm::Function& F,
+		BasicBlockMap& bbs)
 {
 	for (BasicBlock& B : F)
 	{
-		BasicBlockEntry bbe(&B, bbMap.size());
+		BasicBlockEntry bbe(&B, bbs.size());
 
 		int insnPos = -1;
 		for (Instruction& I : B)
@@ -200,13 +357,15 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
 			}
 		}
 
-		bbMap[&F][&B] = bbe;
+		bbs[&B] = bbe;
 	}
 }
 
 void ReachingDefinitionsAnalysis::clear()
 {
 	bbMap.clear();
+	_functionStates.clear();
+	_module = nullptr;
 	_run = false;
 }
 
@@ -219,10 +378,9 @@ bool ReachingDefinitionsAnalysis::wasRun() const
  * Clear internal structures used to compute RDA, but not needed to use it once
  * it is computed.
  */
-void ReachingDefinitionsAnalysis::clearInternal()
+void ReachingDefinitionsAnalysis::clearInternal(BasicBlockMap& bbs)
 {
-	for (auto& pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		BasicBlockEntry& bb = pair.second;
 		bb.defsOut.clear();
@@ -231,10 +389,9 @@ void ReachingDefinitionsAnalysis::clearInternal()
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
+void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev(BasicBlockMap& bbs)
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		auto B = pair.first;
 		auto &entry = pair.second;
@@ -242,60 +399,55 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
 		for (auto PI = pred_begin(B), E = pred_end(B); PI != E; ++PI)
 		{
 			auto* pred = *PI;
-			auto p = pair1.second.find(pred);
+			auto p = bbs.find(pred);
 
-			assert(p != pair1.second.end() && "we should have all BBs stored in bbMap");
+			assert(p != bbs.end() && "we should have all BBs stored in bbMap");
 
 			entry.prevBBs.insert( &p->second );
 		}
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeKillGenSets()
+void ReachingDefinitionsAnalysis::initializeKillGenSets(BasicBlockMap& bbs)
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		pair.second.initializeKillDefSets();
 	}
 }
 
-void ReachingDefinitionsAnalysis::propagate()
+void ReachingDefinitionsAnalysis::propagate(
+		const llvm::Function* F,
+		BasicBlockMap& bbs)
 {
-	for (auto &pair1 : bbMap)
+	std::vector<BasicBlockEntry*> workList;
+	workList.reserve(bbs.size());
+	ReversePostOrderTraversal<const Function*> RPOT(F); // Expensive to create
+	for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
 	{
-		const Function* fnc = pair1.first;
+		const BasicBlock* bb = *I;
+		auto fIt = bbs.find(bb);
+		assert(fIt != bbs.end());
+		workList.push_back(&(fIt->second));
 
-		std::vector<BasicBlockEntry*> workList;
-		workList.reserve(pair1.second.size());
-		ReversePostOrderTraversal<const Function*> RPOT(fnc); // Expensive to create
-		for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
-		{
-			const BasicBlock* bb = *I;
-			auto fIt = pair1.second.find(bb);
-			assert(fIt != pair1.second.end());
-			workList.push_back(&(fIt->second));
+		fIt->second.changed = true;
+	}
 
-			fIt->second.changed = true;
-		}
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
 
-		bool changed = true;
-		while (changed)
+		for (auto* bbe : workList)
 		{
-			changed = false;
-
-			for (auto* bbe : workList)
-			{
-				changed |= bbe->initDefsOut();
-			}
+			changed |= bbe->initDefsOut();
 		}
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeDefsAndUses()
+void ReachingDefinitionsAnalysis::initializeDefsAndUses(BasicBlockMap& bbs)
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		BasicBlockEntry &bb = pair.second;
 
@@ -784,5 +936,311 @@ std::set<llvm::Instruction*> ReachingDefinitionsAnalysis::usesFromDef_onDemand(
 	return ret;
 }
 
+//
+//=============================================================================
+//  OnDemandRdaCache
+//=============================================================================
+//
+
+namespace {
+
+const std::set<llvm::Instruction*> EMPTY_INSTRUCTION_SET;
+
+/**
+ * Only definitions and uses of these values are tracked by on-demand RDA.
+ */
+bool isTrackedValue(const llvm::Value* v)
+{
+	return isa<GlobalVariable>(v) || isa<AllocaInst>(v);
+}
+
+} // anonymous namespace
+
+/**
+ * The same as \c ReachingDefinitionsAnalysis::defsFromUse_onDemand().
+ */
+const std::set<llvm::Instruction*>& OnDemandRdaCache::defsFromUse(
+		llvm::Instruction* I)
+{
+	auto* l = dyn_cast<LoadInst>(I);
+	if (l == nullptr || !isTrackedValue(l->getPointerOperand()))
+	{
+		return EMPTY_INSTRUCTION_SET;
+	}
+
+	auto& fc = getFunctionCache(l->getFunction());
+	auto fIt = fc.defsFromUse.find(l);
+	if (fIt != fc.defsFromUse.end())
+	{
+		return fIt->second;
+	}
+
+	getSummary(fc, l->getParent());
+	auto& ret = fc.defsFromUse[l];
+	if (auto* d = fc.localDefs[l])
+	{
+		ret.insert(d);
+	}
+	else
+	{
+		ret = getDefsIn(fc, l->getParent(), l->getPointerOperand());
+	}
+	return ret;
+}
+
+/**
+ * The same as \c ReachingDefinitionsAnalysis::usesFromDef_onDemand().
+ */
+const std::set<llvm::Instruction*>& OnDemandRdaCache::usesFromDef(
+		llvm::Instruction* I)
+{
+	Value* val = nullptr;
+	if (auto* s = dyn_cast<StoreInst>(I))
+	{
+		val = s->getPointerOperand();
+	}
+	else if (auto* a = dyn_cast<AllocaInst>(I))
+	{
+		val = a;
+	}
+	if (val == nullptr || !isTrackedValue(val))
+	{
+		return EMPTY_INSTRUCTION_SET;
+	}
+
+	auto& fc = getFunctionCache(I->getFunction());
+	auto fIt = fc.usesFromDef.find(I);
+	if (fIt != fc.usesFromDef.end())
+	{
+		return fIt->second;
+	}
+
+	getSummary(fc, I->getParent());
+	auto& ret = fc.usesFromDef[I];
+	auto& local = fc.localUses[I];
+	ret.insert(local.uses.begin(), local.uses.end());
+	if (!local.killed)
+	{
+		auto& out = getUsesOut(fc, I->getParent(), val);
+		ret.insert(out.begin(), out.end());
+	}
+	return ret;
+}
+
+/**
+ * Throws away everything that was computed.
+ */
+void OnDemandRdaCache::invalidate()
+{
+	_functions.clear();
+}
+
+/**
+ * Throws away everything that was computed for the function \p f.
+ */
+void OnDemandRdaCache::invalidate(const llvm::Function* f)
+{
+	_functions.erase(f);
+}
+
+OnDemandRdaCache::FunctionCache& OnDemandRdaCache::getFunctionCache(
+		const llvm::Function* f)
+{
+	return _functions[f];
+}
+
+OnDemandRdaCache::BasicBlockSummary& OnDemandRdaCache::getSummary(
+		FunctionCache& fc,
+		llvm::BasicBlock* bb)
+{
+	auto fIt = fc.blocks.find(bb);
+	if (fIt != fc.blocks.end())
+	{
+		return fIt->second;
+	}
+
+	auto& summary = fc.blocks[bb];
+	summarize(fc, bb, summary);
+	return summary;
+}
+
+/**
+ * Scans the basic block \p bb once and records definitions and uses of all
+ * the tracked values in it. Semantics of definitions and uses is the same as
+ * in \c defInBasicBlock() and \c usesInBasicBlock().
+ */
+void OnDemandRdaCache::summarize(
+		FunctionCache& fc,
+		llvm::BasicBlock* bb,
+		BasicBlockSummary& summary)
+{
+	// Definitions that are live at the current position.
+	std::unordered_map<const llvm::Value*, llvm::Instruction*> currentDefs;
+
+	for (auto& i : *bb)
+	{
+		auto* insn = &i;
+		auto* s = dyn_cast<StoreInst>(insn);
+		Value* storePtr = s ? s->getPointerOperand() : nullptr;
+
+		if (auto* l = dyn_cast<LoadInst>(insn))
+		{
+			if (isTrackedValue(l->getPointerOperand()))
+			{
+				auto dIt = currentDefs.find(l->getPointerOperand());
+				fc.localDefs[l] = dIt != currentDefs.end() ? dIt->second : nullptr;
+			}
+		}
+
+		for (auto& op : insn->operands())
+		{
+			Value* v = op;
+			if (v == storePtr || !isTrackedValue(v))
+			{
+				continue;
+			}
+
+			auto dIt = currentDefs.find(v);
+			if (dIt != currentDefs.end())
+			{
+				auto& uses = fc.localUses[dIt->second].uses;
+				if (uses.empty() || uses.back() != insn)
+				{
+					uses.push_back(insn);
+				}
+			}
+			if (summary.kills.count(v) == 0)
+			{
+				auto& uses = summary.exposedUses[v];
+				if (uses.empty() || uses.back() != insn)
+				{
+					uses.push_back(insn);
+				}
+			}
+		}
+
+		if (storePtr && isTrackedValue(storePtr))
+		{
+			auto dIt = currentDefs.find(storePtr);
+			if (dIt != currentDefs.end())
+			{
+				fc.localUses[dIt->second].killed = true;
+			}
+			summary.kills.insert(storePtr);
+			currentDefs[storePtr] = s;
+			summary.lastDefs[storePtr] = s;
+			fc.localUses[s];
+		}
+		else if (isa<AllocaInst>(insn))
+		{
+			currentDefs[insn] = insn;
+			summary.lastDefs[insn] = insn;
+			fc.localUses[insn];
+		}
+	}
+}
+
+/**
+ * Finds definitions of \p v in all the predecessors of \p bb (and their
+ * predecessors, if they do not define \p v).
+ */
+const std::set<llvm::Instruction*>& OnDemandRdaCache::getDefsIn(
+		FunctionCache& fc,
+		llvm::BasicBlock* bb,
+		llvm::Value* v)
+{
+	auto key = std::make_pair(bb, v);
+	auto fIt = fc.defsIn.find(key);
+	if (fIt != fc.defsIn.end())
+	{
+		return fIt->second;
+	}
+
+	std::set<llvm::Instruction*> ret;
+	std::unordered_set<llvm::BasicBlock*> searchedBbs;
+	std::vector<llvm::BasicBlock*> worklistBbs;
+
+	auto preds = predecessors(bb);
+	std::copy(preds.begin(), preds.end(), std::back_inserter(worklistBbs));
+
+	while (!worklistBbs.empty())
+	{
+		auto* b = worklistBbs.back();
+		worklistBbs.pop_back();
+
+		searchedBbs.insert(b);
+
+		auto& summary = getSummary(fc, b);
+		auto dIt = summary.lastDefs.find(v);
+		if (dIt != summary.lastDefs.end())
+		{
+			ret.insert(dIt->second);
+		}
+		else
+		{
+			for (auto* p : predecessors(b))
+			{
+				if (searchedBbs.count(p) == 0)
+				{
+					worklistBbs.push_back(p);
+				}
+			}
+		}
+	}
+
+	return fc.defsIn[key] = std::move(ret);
+}
+
+/**
+ * Finds uses of \p v in all the successors of \p bb (and their successors,
+ * if they do not kill \p v).
+ */
+const std::set<llvm::Instruction*>& OnDemandRdaCache::getUsesOut(
+		FunctionCache& fc,
+		llvm::BasicBlock* bb,
+		llvm::Value* v)
+{
+	auto key = std::make_pair(bb, v);
+	auto fIt = fc.usesOut.find(key);
+	if (fIt != fc.usesOut.end())
+	{
+		return fIt->second;
+	}
+
+	std::set<llvm::Instruction*> ret;
+	std::unordered_set<llvm::BasicBlock*> searchedBbs;
+	std::vector<llvm::BasicBlock*> worklistBbs;
+
+	auto succs = successors(bb);
+	std::copy(succs.begin(), succs.end(), std::back_inserter(worklistBbs));
+
+	while (!worklistBbs.empty())
+	{
+		auto* b = worklistBbs.back();
+		worklistBbs.pop_back();
+
+		searchedBbs.insert(b);
+
+		auto& summary = getSummary(fc, b);
+		auto uIt = summary.exposedUses.find(v);
+		if (uIt != summary.exposedUses.end())
+		{
+			ret.insert(uIt->second.begin(), uIt->second.end());
+		}
+		if (summary.kills.count(v) == 0)
+		{
+			for (auto* s : successors(b))
+			{
+				if (searchedBbs.count(s) == 0)
+				{
+					worklistBbs.push_back(s);
+				}
+			}
+		}
+	}
+
+	return fc.usesOut[key] = std::move(ret);
+}
+
 } // namespace bin2llvmir
 } // namespace retdec
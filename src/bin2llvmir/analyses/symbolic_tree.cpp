@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <mutex>
 #include <ostream>
 #include <sstream>
 
@@ -17,6 +18,7 @@
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/utils/debug.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 #include "retdec/bin2llvmir/utils/symbolic_tree_match.h"
 
 using namespace llvm;
@@ -27,6 +29,30 @@ using namespace retdec::bin2llvmir::st_match;
 namespace retdec {
 namespace bin2llvmir {
 
+namespace {
+
+/**
+ * Get integer constant. Trees may be constructed and simplified in
+ * @c parallelForEach(), but the LLVM context owning the constants is not
+ * thread-safe.
+ */
+Constant* getConstantInt(Type* t, std::uint64_t v)
+{
+	std::lock_guard<std::mutex> lock(getLlvmContextMutex());
+	return ConstantInt::get(t, v);
+}
+
+/**
+ * Get undefined value. See getConstantInt().
+ */
+UndefValue* getUndef(Type* t)
+{
+	std::lock_guard<std::mutex> lock(getLlvmContextMutex());
+	return UndefValue::get(t);
+}
+
+} // anonymous namespace
+
 SymbolicTree SymbolicTree::PrecomputedRda(
 		ReachingDefinitionsAnalysis& rda,
 		llvm::Value* v,
@@ -47,9 +73,16 @@ SymbolicTree SymbolicTree::PrecomputedRdaWithValueMap(
 
 SymbolicTree SymbolicTree::OnDemandRda(
 		llvm::Value* v,
-		unsigned maxNodeLevel)
+		unsigned maxNodeLevel,
+		OnDemandRdaCache* cache)
 {
-	return SymbolicTree(nullptr, v, nullptr, 0, maxNodeLevel, nullptr, false);
+	// IR does not change while the tree is constructed, so the queries can
+	// always be memoized at least for this tree.
+	OnDemandRdaCache treeCache;
+	_onDemandRda = cache ? cache : &treeCache;
+	SymbolicTree st(nullptr, v, nullptr, 0, maxNodeLevel, nullptr, false);
+	_onDemandRda = nullptr;
+	return st;
 }
 
 SymbolicTree SymbolicTree::Linear(
@@ -210,7 +243,7 @@ void SymbolicTree::expandNode(
 // TODO!!! replace with invalid tree
 				ops.emplace_back(
 						RDA,
-						UndefValue::get(l->getType()),
+						getUndef(l->getType()),
 						l,
 						getLevel() + 1,
 						maxNodeLevel,
@@ -233,13 +266,20 @@ void SymbolicTree::expandNode(
 		}
 		else
 		{
-			auto defs = ReachingDefinitionsAnalysis::defsFromUse_onDemand(l);
+			std::set<llvm::Instruction*> onDemandDefs;
+			if (_onDemandRda == nullptr)
+			{
+				onDemandDefs = ReachingDefinitionsAnalysis::defsFromUse_onDemand(l);
+			}
+			const auto& defs = _onDemandRda
+					? _onDemandRda->defsFromUse(l)
+					: onDemandDefs;
 			if (defs.size() > _naryLimit)
 			{
 // TODO!!! replace with invalid tree
 				ops.emplace_back(
 						RDA,
-						UndefValue::get(l->getType()),
+						getUndef(l->getType()),
 						l,
 						getLevel() + 1,
 						maxNodeLevel,
@@ -405,7 +445,7 @@ void SymbolicTree::_simplifyNode()
 					&load)))
 	{
 		auto addr = AsmInstruction::getFunctionAddress(load->getFunction());
-		value = ConstantInt::get(load->getType(), addr);
+		value = getConstantInt(load->getType(), addr);
 		ops.clear();
 	}
 	else if (match(*this, m_Load(m_GlobalVariable(global), &load))
@@ -422,28 +462,28 @@ void SymbolicTree::_simplifyNode()
 	}
 	else if (match(*this, m_Add(m_ConstantInt(c1), m_ConstantInt(c2))))
 	{
-		value = ConstantInt::get(
+		value = getConstantInt(
 				c1->getType(),
 				c1->getSExtValue() + c2->getSExtValue());
 		ops.clear();
 	}
 	else if (match(*this, m_Sub(m_ConstantInt(c1), m_ConstantInt(c2))))
 	{
-		value = ConstantInt::get(
+		value = getConstantInt(
 				c1->getType(),
 				c1->getSExtValue() - c2->getSExtValue());
 		ops.clear();
 	}
 	else if (match(*this, m_Or(m_ConstantInt(c1), m_ConstantInt(c2))))
 	{
-		value = ConstantInt::get(
+		value = getConstantInt(
 				c1->getType(),
 				c1->getSExtValue() | c2->getSExtValue());
 		ops.clear();
 	}
 	else if (match(*this, m_And(m_ConstantInt(c1), m_ConstantInt(c2))))
 	{
-		value = ConstantInt::get(
+		value = getConstantInt(
 				c1->getType(),
 				c1->getSExtValue() & c2->getSExtValue());
 		ops.clear();
@@ -454,7 +494,7 @@ void SymbolicTree::_simplifyNode()
 	{
 		if (auto addr = _config->getGlobalAddress(global))
 		{
-			value = ConstantInt::get(c1->getType(), addr + c1->getSExtValue());
+			value = getConstantInt(c1->getType(), addr + c1->getSExtValue());
 			ops.clear();
 		}
 	}
@@ -473,7 +513,7 @@ void SymbolicTree::_simplifyNode()
 			m_ConstantInt(c2))))
 	{
 		ops[0] = std::move(ops[0].ops[0]);
-		ops[1].value = ConstantInt::get(
+		ops[1].value = getConstantInt(
 				c1->getType(),
 				c1->getSExtValue() + c2->getSExtValue());
 	}
@@ -701,7 +741,8 @@ bool SymbolicTree::isNary(unsigned N) const
 
 Abi* SymbolicTree::_abi = nullptr;
 Config* SymbolicTree::_config = nullptr;
-bool SymbolicTree::_val2valUsed = false;
+thread_local OnDemandRdaCache* SymbolicTree::_onDemandRda = nullptr;
+thread_local bool SymbolicTree::_val2valUsed = false;
 bool SymbolicTree::_trackThroughAllocaLoads = true;
 bool SymbolicTree::_trackThroughGeneralRegisterLoads = true;
 bool SymbolicTree::_trackOnlyFlagRegisters = false;
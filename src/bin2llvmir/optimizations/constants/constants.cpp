@@ -22,9 +22,11 @@
 #include "retdec/bin2llvmir/analyses/symbolic_tree.h"
 #include "retdec/bin2llvmir/optimizations/constants/constants.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/rda.h"
 const bool debug_enabled = false;
 #include "retdec/bin2llvmir/utils/llvm.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 
 using namespace retdec::utils;
 using namespace llvm;
@@ -74,15 +76,43 @@ bool ConstantsAnalysis::runOnModuleCustom(
 
 bool ConstantsAnalysis::run()
 {
-	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnModule(*_module, _abi);
+	auto& RDA = *RdaProvider::getRda(_module, _abi);
 
+	// Functions are analyzed in parallel, the analysis does not modify IR.
+	// Found uses are then replaced serially, in the original order.
+	//
+	std::vector<FunctionUses> fncs;
 	for (Function& f : *_module)
-	for (inst_iterator I = inst_begin(&f), E = inst_end(&f); I != E;)
 	{
-		Instruction& i = *I;
-		++I;
+		if (!f.empty())
+		{
+			fncs.emplace_back();
+			fncs.back().function = &f;
+		}
+	}
+
+	parallelForEach(fncs, [this, &RDA](FunctionUses& fu)
+	{
+		analyzeFunction(RDA, fu);
+	});
+
+	for (auto& fu : fncs)
+	for (auto& use : fu.uses)
+	{
+		applyGlobalUse(use);
+	}
+
+	IrModifier::eraseUnusedInstructionsRecursive(_toRemove);
 
+	return false;
+}
+
+void ConstantsAnalysis::analyzeFunction(
+		ReachingDefinitionsAnalysis& RDA,
+		FunctionUses& fu) const
+{
+	for (Instruction& i : instructions(fu.function))
+	{
 		if (StoreInst *store = dyn_cast<StoreInst>(&i))
 		{
 			if (AsmInstruction::isLlvmToAsmInstruction(store))
@@ -90,14 +120,23 @@ bool ConstantsAnalysis::run()
 				continue;
 			}
 
-			checkForGlobalInInstruction(RDA, store, store->getValueOperand(), true);
+			checkForGlobalInInstruction(
+					RDA,
+					store,
+					store->getValueOperand(),
+					fu.uses,
+					true);
 
 			if (isa<GlobalVariable>(store->getPointerOperand()))
 			{
 				continue;
 			}
 
-			checkForGlobalInInstruction(RDA, store, store->getPointerOperand());
+			checkForGlobalInInstruction(
+					RDA,
+					store,
+					store->getPointerOperand(),
+					fu.uses);
 		}
 		else if (auto* load = dyn_cast<LoadInst>(&i))
 		{
@@ -106,20 +145,26 @@ bool ConstantsAnalysis::run()
 				continue;
 			}
 
-			checkForGlobalInInstruction(RDA, load, load->getPointerOperand());
+			checkForGlobalInInstruction(
+					RDA,
+					load,
+					load->getPointerOperand(),
+					fu.uses);
 		}
 	}
-
-	IrModifier::eraseUnusedInstructionsRecursive(_toRemove);
-
-	return false;
 }
 
+/**
+ * Find out if @a val used in @a inst is (or contains) an address of a global
+ * variable. If so, add the use to @a uses. IR is not modified, see
+ * parallelForEach().
+ */
 void ConstantsAnalysis::checkForGlobalInInstruction(
 		ReachingDefinitionsAnalysis& RDA,
 		Instruction* inst,
 		Value* val,
-		bool storeValue)
+		std::vector<GlobalUse>& uses,
+		bool storeValue) const
 {
 	LOG << llvmObjToString(inst) << std::endl;
 
@@ -128,6 +173,11 @@ void ConstantsAnalysis::checkForGlobalInInstruction(
 
 	LOG << root << std::endl;
 
+	GlobalUse use;
+	use.inst = inst;
+	use.val = val;
+	use.storeValue = storeValue;
+
 	auto* max = root.getMaxIntValue();
 	auto* maxC = max ? dyn_cast_or_null<ConstantInt>(max->value) : nullptr;
 	Instruction* userI = max ? dyn_cast_or_null<Instruction>(max->user) : nullptr;
@@ -135,36 +185,62 @@ void ConstantsAnalysis::checkForGlobalInInstruction(
 	if (max && maxC && maxC->getValue().getActiveBits() <= 64 && maxC->getZExtValue() != 0)
 	if (userI || max == &root)
 	if (_image->getImage()->hasDataOnAddress(maxC->getZExtValue()))
+	{
+		use.maxC = maxC;
+		use.maxIsRoot = max == &root;
+		use.userI = userI;
+	}
+
+	auto* gv = dyn_cast<GlobalVariable>(root.value);
+	if (isa<LoadInst>(inst) && gv && root.ops.size() <= 1)
+	{
+		use.gv = gv;
+	}
+
+	if (use.maxC || use.gv)
+	{
+		uses.push_back(use);
+	}
+}
+
+/**
+ * Replace the global @a use with the global variable.
+ */
+void ConstantsAnalysis::applyGlobalUse(const GlobalUse& use)
+{
+	auto* inst = use.inst;
+	auto* val = use.val;
+
+	if (use.maxC)
 	{
 		IrModifier irm(_module, _config);
 		auto* ngv = irm.getGlobalVariable(
 				_image,
 				_dbgf,
-				maxC->getZExtValue(),
-				storeValue);
+				use.maxC->getZExtValue(),
+				use.storeValue);
 
 		if (ngv)
 		{
-			if (max == &root)
+			if (use.maxIsRoot)
 			{
 				auto* conv = IrModifier::convertConstantToType(ngv, val->getType());
 				_toRemove.insert(val);
 				inst->replaceUsesOfWith(val, conv);
 				return;
 			}
-			else if (userI)
+			else if (use.userI)
 			{
-				auto* conv = IrModifier::convertConstantToType(ngv, maxC->getType());
-				userI->replaceUsesOfWith(maxC, conv);
+				auto* conv = IrModifier::convertConstantToType(ngv, use.maxC->getType());
+				use.userI->replaceUsesOfWith(use.maxC, conv);
 				return;
 			}
 		}
 	}
 
-	auto* gv = dyn_cast<GlobalVariable>(root.value);
-	if (isa<LoadInst>(inst) && gv && root.ops.size() <= 1)
+	if (use.gv)
 	{
-		auto* conv = IrModifier::convertConstantToType(gv, val->getType());
+		auto* conv = IrModifier::convertConstantToType(use.gv, val->getType());
 		_toRemove.insert(val);
 		inst->replaceUsesOfWith(val, conv);
 		return;
@@ -295,6 +295,11 @@ void Decoder::decodeJumpTarget(const JumpTarget& jt)
 		LOG << "\t\t\t" << "translating = " << addr << std::endl;
 
 		Address oldAddr = addr;
+		if (_config->getConfig().parameters.isLazyFlags()
+				&& _config->getConfig().architecture.isX86())
+		{
+			setDeadFlags_x86(bytes, addr);
+		}
 		auto res = translate(bytes, addr, irb);
 
 		if (res.failed() || res.llvmInsn == nullptr)
@@ -818,7 +823,10 @@ common::Address Decoder::getJumpTarget(
 		llvm::CallInst* branchCall,
 		llvm::Value* val)
 {
-	auto st = SymbolicTree::OnDemandRda(val, 20);
+	// IR has been modified since the last jump target computation.
+	_rdaCache.invalidate();
+
+	auto st = SymbolicTree::OnDemandRda(val, 20, &_rdaCache);
 
 	// TODO: better implementation.
 	// PIC code.
@@ -1075,7 +1083,10 @@ bool Decoder::getJumpTargetSwitch(
 	unsigned tableSize = 0;
 if (brToSwitch)
 {
-	auto stCond = SymbolicTree::OnDemandRda(brToSwitch->getCondition());
+	auto stCond = SymbolicTree::OnDemandRda(
+			brToSwitch->getCondition(),
+			10,
+			&_rdaCache);
 	stCond.simplifyNode();
 
 	auto levelOrd = stCond.getLevelOrder();
@@ -1132,7 +1143,7 @@ if (brToSwitch)
 	//
 	std::vector<unsigned> idxs;
 	unsigned maxIdx = 0;
-	auto idxRoot = SymbolicTree::OnDemandRda(idx);
+	auto idxRoot = SymbolicTree::OnDemandRda(idx, 10, &_rdaCache);
 	idxRoot.simplifyNode();
 
 	llvm::LoadInst* l = nullptr;
@@ -1244,8 +1255,10 @@ if (brToSwitch)
 		}
 	}
 
+	// Branch targets may get created (split) from now on.
 	//
-	//
+	_rdaCache.invalidate();
+
 	std::vector<llvm::BasicBlock*> casesBbs;
 	for (auto c : cases)
 	{
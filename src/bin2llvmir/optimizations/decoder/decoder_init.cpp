@@ -1064,7 +1064,7 @@ void Decoder::initConfigFunctions()
 		std::string realName = _names->getPreferredNameForAddress(start);
 		if (cf->getName() != realName)
 		{
-			cf->setRealName(realName);
+			_config->getConfig().functions.setRealName(cf, realName);
 		}
 
 		cf->setIsExported(_exports.count(start));
@@ -1072,7 +1072,9 @@ void Decoder::initConfigFunctions()
 		auto dbgIt = _debugFncs.find(start);
 		if (dbgIt != _debugFncs.end())
 		{
-			auto* df = dbgIt->second;
+			// Only source lines are loaded here, types of the function are
+			// converted by getFunction() when some analysis needs them.
+			auto* df = _debug->getFunctionLines(dbgIt->second->getStart());
 			cf->setIsFromDebug(true);
 			cf->setStartLine(df->getStartLine());
 			cf->setEndLine(df->getEndLine());
@@ -4,8 +4,11 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+
 #include "retdec/bin2llvmir/optimizations/decoder/decoder.h"
 #include "retdec/bin2llvmir/utils/capstone.h"
+#include "retdec/capstone2llvmir/x86/x86.h"
 #include "retdec/utils/string.h"
 
 using namespace retdec::utils;
@@ -109,5 +112,57 @@ std::size_t Decoder::decodeJumpTargetDryRun_x86(
 	return true;
 }
 
+/**
+ * Tell the translator which flags written by the instruction at @a addr are
+ * dead. Flags are analysed for a window of instructions starting at @a addr
+ * and ending with the first control flow instruction, results for the
+ * following instructions are reused until the translation leaves the window.
+ */
+void Decoder::setDeadFlags_x86(ByteData bytes, common::Address addr)
+{
+	auto* x86 = dynamic_cast<Capstone2LlvmIrTranslatorX86*>(_c2l.get());
+	if (x86 == nullptr)
+	{
+		return;
+	}
+
+	auto fIt = _deadFlags.find(addr);
+	if (fIt == _deadFlags.end())
+	{
+		_deadFlags.clear();
+
+		const std::size_t windowSize = 64;
+		cs_insn* insns = nullptr;
+		std::size_t count = cs_disasm(
+				_c2l->getCapstoneEngine(),
+				bytes.first,
+				bytes.second,
+				addr,
+				windowSize,
+				&insns);
+
+		std::size_t n = 0;
+		while (n < count && !_c2l->isControlFlowInstruction(insns[n]))
+		{
+			++n;
+		}
+		n = std::min(n + 1, count);
+
+		auto dead = x86->getDeadFlags(insns, n);
+		for (std::size_t j = 0; j < n; ++j)
+		{
+			_deadFlags[insns[j].address] = dead[j];
+		}
+		if (count)
+		{
+			cs_free(insns, count);
+		}
+
+		fIt = _deadFlags.find(addr);
+	}
+
+	x86->setDeadFlags(fIt != _deadFlags.end() ? fIt->second : 0);
+}
+
 } // namespace bin2llvmir
 } // namespace retdec
@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/bin2llvmir/optimizations/idioms/idioms_analysis.h"
 
 using namespace llvm;
@@ -12,252 +14,334 @@ namespace retdec {
 namespace bin2llvmir {
 
 /**
- * Analyse given BasicBlock and use instruction exchanger to transform
- * instruction idioms
+ * Register basic block idiom exchanger
  *
- * @param bb BasicBlock to analyse
  * @param exchanger instruction idiom exchanger
- * @param fname instruction idiom exchanger name (for debug purpose only)
+ * @param name instruction idiom exchanger name (for debug purpose only)
+ * @param opcodes opcodes of instructions @a exchanger can replace
  */
-bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname) {
-	bool change_made = false;
+void IdiomsAnalysis::addIdiom(Exchanger exchanger, const char * name, std::initializer_list<unsigned> opcodes) {
+	Idiom idiom;
+	idiom.exchanger = exchanger;
+	idiom.name = name;
+	idiom.opcodes = opcodes;
+	m_idioms.push_back(idiom);
+}
 
-	for (BasicBlock::iterator iter = bb.begin(), end = bb.end(); iter != end; /**/) {
-		BasicBlock::iterator insn = iter;
-		++iter; // go to next instruction to use valid iterator in next loop
+/**
+ * Register basic block idiom exchangers applicable to the compiler and
+ * architecture. Position of instruction idiom exchangers is IMPORTANT! More
+ * complicated instruction idioms have to be exchanged before simplier ones.
+ * They can consist of other instruction idioms (the simple ones), so they
+ * have to be exchanged at first place!
+ *
+ * Every exchanger is registered with opcodes of the instructions it matches
+ * (the root of the idiom). It is never called on any other instruction.
+ */
+void IdiomsAnalysis::initIdioms() {
+	CC_compiler cc = getCompiler();
+	CC_arch arch = getArch();
 
-		// call exchanger on every instruction
-		Instruction * res = (this->*exchanger)(insn);
+	if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_x86 || arch == ARCH_THUMB || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY) {
+			addIdiom(&IdiomsMagicDivMod::signedMod1,
+					"IdiomsMagicDivMod::signedMod1", {Instruction::Add});
 
-		if (res) {
-			change_made = true;
+			addIdiom(&IdiomsMagicDivMod::signedMod2,
+					"IdiomsMagicDivMod::signedMod2", {Instruction::Add});
 
-			(*insn).replaceAllUsesWith(res);
+			addIdiom(&IdiomsMagicDivMod::magicUnsignedDiv2,
+					"IdiomsMagicDivMod::magicUnsignedDiv2", {Instruction::LShr});
 
-			// Move the name to the new instruction first.
-			res->takeName(&*insn);
+			addIdiom(&IdiomsMagicDivMod::magicUnsignedDiv1,
+					"IdiomsMagicDivMod::magicUnsignedDiv1", {Instruction::Trunc});
 
-			// Insert the new instruction into the basic block...
-			BasicBlock * InstParent = (*insn).getParent();
+			addIdiom(&IdiomsMagicDivMod::magicSignedDiv1,
+					"IdiomsMagicDivMod::magicSignedDiv1", {Instruction::Sub});
 
-			// If we replace a PHI with something that isn't a PHI,
-			// fix up the insertion point.
-			if (! isa<PHINode>(res) && isa<PHINode>(insn))
-				insn = InstParent->getFirstInsertionPt();
+			addIdiom(&IdiomsMagicDivMod::magicSignedDiv2,
+					"IdiomsMagicDivMod::magicSignedDiv2", {Instruction::Sub});
 
-			InstParent->getInstList().insert(insn, res);
+			addIdiom(&IdiomsMagicDivMod::magicSignedDiv3,
+					"IdiomsMagicDivMod::magicSignedDiv3", {Instruction::Sub});
 
-			(*insn).eraseFromParent();
-		}
-	}
+			addIdiom(&IdiomsMagicDivMod::magicSignedDiv4,
+					"IdiomsMagicDivMod::magicSignedDiv4", {Instruction::Sub});
 
-	return change_made;
-}
+			addIdiom(&IdiomsMagicDivMod::magicSignedDiv5,
+					"IdiomsMagicDivMod::magicSignedDiv5", {Instruction::Sub});
 
-/**
- * Do instruction idioms analysis pass
- *
- * @param f Function to analyse for instruction idioms
- * @param p actual pass
- * @return true whenever an exchange has been made, otherwise 0
- */
-bool IdiomsAnalysis::doAnalysis(Function & f, Pass * p) {
-	/*
-	 * Instruction idioms are inspected in a tree of Instructions. Every
-	 * instruction idiom has to be called on a basic block. Position of
-	 * instruction idiom exchangers is IMPORTANT! More complicated instruction
-	 * idioms have to be exchanged before simplier ones. They can consist of
-	 * other instruction idioms (the simple ones), so they have to be exchanged
-	 * at first place!
-	 */
-	bool change_made = false; // was there any exchange?
+			addIdiom(&IdiomsMagicDivMod::magicSignedDiv6,
+					"IdiomsMagicDivMod::magicSignedDiv6", {Instruction::Sub});
 
-	CC_compiler cc = getCompiler();
-	CC_arch arch = getArch();
+			// Found in PowerPC - div 10
+			addIdiom(&IdiomsMagicDivMod::magicSignedDiv7pos,
+					"IdiomsMagicDivMod::magicSignedDiv7pos", {Instruction::Sub});
 
-	// Inspect multi-basic block idioms
-	if (cc == CC_GCC || cc == CC_ANY) {
-		change_made |= analyse(f, p, &IdiomsGCC::exchangeCondBitShiftDivMultiBB,
-									"IdiomsGCC::exchangeCondBitShiftDivMultiBB");
-	}
+			// Found in PowerPC - the same as previous, but the divisor
+			// is negative, i.e. div -10
+			addIdiom(&IdiomsMagicDivMod::magicSignedDiv7neg,
+					"IdiomsMagicDivMod::magicSignedDiv7neg", {Instruction::Sub});
 
-	// Inspect basic-block idioms
-	for (Function::iterator b = f.begin(); b != f.end(); ++b) {
-		BasicBlock & bb = *b;
-		if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_x86 || arch == ARCH_THUMB || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY) {
-				change_made |= analyse(bb, &IdiomsMagicDivMod::signedMod1,
-											"IdiomsMagicDivMod::signedMod1");
+			// Found in PowerPC - div 6
+			addIdiom(&IdiomsMagicDivMod::magicSignedDiv8pos,
+					"IdiomsMagicDivMod::magicSignedDiv8pos", {Instruction::Sub});
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::signedMod2,
-											"IdiomsMagicDivMod::signedMod2");
+			// Found in PowerPC - the same as previous, but the divisor
+			// is negative, i.e. div -3
+			addIdiom(&IdiomsMagicDivMod::magicSignedDiv8neg,
+					"IdiomsMagicDivMod::magicSignedDiv8neg", {Instruction::Sub});
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicUnsignedDiv2,
-											"IdiomsMagicDivMod::magicUnsignedDiv2");
+			addIdiom(&IdiomsMagicDivMod::unsignedMod,
+					"IdiomsMagicDivMod::unsignedMod", {Instruction::Sub});
+	}
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		addIdiom(&IdiomsGCC::exchangeSignedModuloByTwo,
+				"IdiomsGCC::exchangeSignedModuloByTwo", {Instruction::Sub});
+
+	// PowerPC model lacks FPU and x86 uses x87.
+	if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_ANY)
+			addIdiom(&IdiomsGCC::exchangeCopysign,
+					"IdiomsGCC::exchangeCopysign", {Instruction::Or});
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicUnsignedDiv1,
-											"IdiomsMagicDivMod::magicUnsignedDiv1");
+	// PowerPC model lacks FPU and x86 uses x87.
+	if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_ANY)
+			addIdiom(&IdiomsGCC::exchangeFloatAbs,
+					"IdiomsGCC::exchangeFloatAbs", {Instruction::And});
+
+	if (arch == ARCH_x86 || arch == ARCH_ANY)
+		if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
+			addIdiom(&IdiomsVStudio::exchangeOrMinusOneAssign,
+					"IdiomsVStudio::exchangeOrMinusOneAssign", {Instruction::Or});
+
+	if (arch == ARCH_x86 || arch == ARCH_ANY)
+		if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
+			addIdiom(&IdiomsVStudio::exchangeAndZeroAssign,
+					"IdiomsVStudio::exchangeAndZeroAssign", {Instruction::And});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		addIdiom(&IdiomsGCC::exchangeCondBitShiftDiv1,
+				"IdiomsGCC::exchangeCondBitShiftDiv1", {Instruction::AShr});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		addIdiom(&IdiomsGCC::exchangeCondBitShiftDiv2,
+				"IdiomsGCC::exchangeCondBitShiftDiv2", {Instruction::Sub});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		addIdiom(&IdiomsGCC::exchangeCondBitShiftDiv3,
+				"IdiomsGCC::exchangeCondBitShiftDiv3", {Instruction::Sub});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
+		addIdiom(&IdiomsCommon::exchangeSignedModulo2n,
+				"IdiomsCommon::exchangeSignedModulo2n", {Instruction::Sub});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_Intel || cc == CC_ANY)
+		addIdiom(&IdiomsCommon::exchangeGreaterEqualZero,
+				"IdiomsCommon::exchangeGreaterEqualZero", {Instruction::Xor, Instruction::LShr});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
+		addIdiom(&IdiomsGCC::exchangeXorMinusOne,
+				"IdiomsGCC::exchangeXorMinusOne", {Instruction::Xor});
+
+	if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_ANY)
+			addIdiom(&IdiomsCommon::exchangeDivByMinusTwo,
+					"IdiomsCommon::exchangeDivByMinusTwo", {Instruction::Sub});
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv1,
-											"IdiomsMagicDivMod::magicSignedDiv1");
+	// all arch
+	if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_ANY)
+		addIdiom(&IdiomsCommon::exchangeLessThanZero,
+				"IdiomsCommon::exchangeLessThanZero", {Instruction::LShr});
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv2,
-											"IdiomsMagicDivMod::magicSignedDiv2");
+	// PowerPC model lacks FPU and x86 uses x87.
+	if (cc == CC_GCC || cc == CC_ANY)
+		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+			addIdiom(&IdiomsGCC::exchangeFloatNeg,
+					"IdiomsGCC::exchangeFloatNeg", {Instruction::Xor});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		addIdiom(&IdiomsCommon::exchangeUnsignedModulo2n,
+				"IdiomsCommon::exchangeUnsignedModulo2n", {Instruction::And});
+
+	// all arch
+	if (cc == CC_LLVM || cc == CC_ANY)
+		addIdiom(&IdiomsLLVM::exchangeIsGreaterThanMinusOne,
+				"IdiomsLLVM::exchangeIsGreaterThanMinusOne", {Instruction::ICmp});
+
+	// all arch
+	// all compilers
+	addIdiom(&IdiomsCommon::exchangeBitShiftSDiv1,
+			"IdiomsCommon::exchangeBitShiftSDiv1", {Instruction::Or});
+
+	// all arch
+	// all compilers
+	addIdiom(&IdiomsCommon::exchangeBitShiftUDiv,
+			"IdiomsCommon::exchangeBitShiftUDiv", {Instruction::LShr});
+
+	// all arch
+	// all compilers
+	addIdiom(&IdiomsCommon::exchangeBitShiftMul,
+			"IdiomsCommon::exchangeBitShiftMul", {Instruction::Shl});
+
+	// all arch
+	if (cc == CC_LLVM || cc == CC_ANY) {
+		addIdiom(&IdiomsLLVM::exchangeIsGreaterThanMinusOne,
+				"IdiomsLLVM::exchangeIsGreaterThanMinusOne", {Instruction::ICmp});
+	}
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv3,
-											"IdiomsMagicDivMod::magicSignedDiv3");
+	// all arch
+	if (cc == CC_LLVM || cc == CC_ANY) {
+		addIdiom(&IdiomsLLVM::exchangeCompareEq,
+				"IdiomsLLVM::exchangeCompareEq", {Instruction::Xor});
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv4,
-											"IdiomsMagicDivMod::magicSignedDiv4");
+#if 0
+		/* We do not recognize this well */
+		addIdiom(&IdiomsLLVM::exchangeCompareNeq,
+				"IdiomsLLVM::exchangeCompareNeq", {Instruction::Xor});
+#endif
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv5,
-											"IdiomsMagicDivMod::magicSignedDiv5");
+		addIdiom(&IdiomsLLVM::exchangeCompareSlt,
+				"IdiomsLLVM::exchangeCompareSlt", {Instruction::And});
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv6,
-											"IdiomsMagicDivMod::magicSignedDiv6");
+		addIdiom(&IdiomsLLVM::exchangeCompareSle,
+				"IdiomsLLVM::exchangeCompareSle", {Instruction::Or});
+	}
+}
 
-				// Found in PowerPC - div 10
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv7pos,
-											"IdiomsMagicDivMod::magicSignedDiv7pos");
+/**
+ * Index instructions of given BasicBlock by their opcodes
+ *
+ * @param bb BasicBlock to index
+ * @param index index to fill, its previous content is discarded
+ */
+void IdiomsAnalysis::indexBasicBlock(llvm::BasicBlock & bb, OpcodeIndex & index) {
+	index.resize(Instruction::OtherOpsEnd);
+	for (auto & insns : index)
+		insns.clear();
+
+	std::size_t pos = 0;
+	for (Instruction & insn : bb)
+		index[insn.getOpcode()].emplace_back(pos++, &insn);
+}
 
-				// Found in PowerPC - the same as previous, but the divisor
-				// is negative, i.e. div -10
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv7neg,
-											"IdiomsMagicDivMod::magicSignedDiv7neg");
+/**
+ * Replace instruction with the result of an instruction exchanger
+ *
+ * @param insn instruction to replace
+ * @param res replacement returned by the exchanger
+ */
+void IdiomsAnalysis::exchange(llvm::BasicBlock::iterator insn, llvm::Instruction * res) {
+	(*insn).replaceAllUsesWith(res);
 
-				// Found in PowerPC - div 6
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv8pos,
-											"IdiomsMagicDivMod::magicSignedDiv8pos");
+	// Move the name to the new instruction first.
+	res->takeName(&*insn);
 
-				// Found in PowerPC - the same as previous, but the divisor
-				// is negative, i.e. div -3
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv8neg,
-											"IdiomsMagicDivMod::magicSignedDiv8neg");
+	// Insert the new instruction into the basic block...
+	BasicBlock * InstParent = (*insn).getParent();
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::unsignedMod,
-											"IdiomsMagicDivMod::unsignedMod");
-		}
+	// If we replace a PHI with something that isn't a PHI,
+	// fix up the insertion point.
+	BasicBlock::iterator pos = insn;
+	if (! isa<PHINode>(res) && isa<PHINode>(insn))
+		pos = InstParent->getFirstInsertionPt();
 
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeSignedModuloByTwo,
-										"IdiomsGCC::exchangeSignedModuloByTwo");
+	InstParent->getInstList().insert(pos, res);
 
-		// PowerPC model lacks FPU and x86 uses x87.
-		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsGCC::exchangeCopysign,
-											"IdiomsGCC::exchangeCopysign");
+	(*insn).eraseFromParent();
+}
 
-		// PowerPC model lacks FPU and x86 uses x87.
-		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsGCC::exchangeFloatAbs,
-											"IdiomsGCC::exchangeFloatAbs");
+/**
+ * Analyse given BasicBlock and use instruction exchanger to transform
+ * instruction idioms
+ *
+ * The exchanger is called only on instructions with one of its root opcodes,
+ * in the basic block order. Exchangers erase only instructions of the idiom
+ * tree, which precede the replaced instruction, so the instructions yet to be
+ * visited stay valid. Instructions created by the exchanges are not visited
+ * until @a index is rebuilt.
+ *
+ * @param idiom instruction idiom exchanger to use
+ * @param index instructions of the basic block indexed by their opcodes
+ * @return true whenever an exchange has been made
+ */
+bool IdiomsAnalysis::analyse(const Idiom & idiom, const OpcodeIndex & index) {
+	const std::vector<IndexedInstruction> * candidates = &index[idiom.opcodes.front()];
 
-		if (arch == ARCH_x86 || arch == ARCH_ANY)
-			if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsVStudio::exchangeOrMinusOneAssign,
-											"IdiomsVStudio::exchangeOrMinusOneAssign");
+	// Idiom with more roots - merge them to keep the basic block order.
+	std::vector<IndexedInstruction> merged;
+	if (idiom.opcodes.size() > 1) {
+		for (unsigned opcode : idiom.opcodes)
+			merged.insert(merged.end(), index[opcode].begin(), index[opcode].end());
 
-		if (arch == ARCH_x86 || arch == ARCH_ANY)
-			if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsVStudio::exchangeAndZeroAssign,
-										"IdiomsVStudio::exchangeAndZeroAssign");
+		std::sort(merged.begin(), merged.end());
+		candidates = &merged;
+	}
 
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv1,
-										"IdiomsGCC::exchangeCondBitShiftDiv1");
+	bool change_made = false;
 
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv2,
-										"IdiomsGCC::exchangeCondBitShiftDiv2");
+	for (const IndexedInstruction & candidate : *candidates) {
+		BasicBlock::iterator insn = candidate.second->getIterator();
 
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv3,
-										"IdiomsGCC::exchangeCondBitShiftDiv3");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeSignedModulo2n,
-										"IdiomsCommon::exchangeSignedModulo2n");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_Intel || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeGreaterEqualZero,
-										"IdiomsCommon::exchangeGreaterEqualZero");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeXorMinusOne,
-										"IdiomsGCC::exchangeXorMinusOne");
-
-		if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsCommon::exchangeDivByMinusTwo,
-											"IdiomsCommon::exchangeDivByMinusTwo");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeLessThanZero,
-										"IdiomsCommon::exchangeLessThanZero");
-
-		// PowerPC model lacks FPU and x86 uses x87.
-		if (cc == CC_GCC || cc == CC_ANY)
-			if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-				change_made |= analyse(bb, &IdiomsGCC::exchangeFloatNeg,
-											"IdiomsGCC::exchangeFloatNeg");
+		Instruction * res = (this->*idiom.exchanger)(insn);
 
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeUnsignedModulo2n,
-										"IdiomsCommon::exchangeUnsignedModulo2n");
-
-		// all arch
-		if (cc == CC_LLVM || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
-											"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
-
-		// all arch
-		// all compilers
-		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftSDiv1,
-									"IdiomsCommon::exchangeBitShiftSDiv1");
-
-		// all arch
-		// all compilers
-		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftUDiv,
-									"IdiomsCommon::exchangeBitShiftUDiv");
-
-		// all arch
-		// all compilers
-		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftMul,
-									"IdiomsCommon::exchangeBitShiftMul");
-
-		// all arch
-		if (cc == CC_LLVM || cc == CC_ANY) {
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
-										"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
+		if (res) {
+			change_made = true;
+			exchange(insn, res);
 		}
+	}
+
+	return change_made;
+}
 
-		// all arch
-		if (cc == CC_LLVM || cc == CC_ANY) {
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareEq,
-										"IdiomsLLVM::exchangeCompareEq");
+/**
+ * Do instruction idioms analysis pass
+ *
+ * Instructions of every basic block are indexed by their opcodes in a single
+ * walk, so that each basic block idiom exchanger visits only the instructions
+ * it can match. The index is rebuilt after every exchanger that changed the
+ * basic block so that the following exchangers see the new instructions.
+ *
+ * @param f Function to analyse for instruction idioms
+ * @param p actual pass
+ * @return true whenever an exchange has been made, otherwise 0
+ */
+bool IdiomsAnalysis::doAnalysis(Function & f, Pass * p) {
+	/*
+	 * Instruction idioms are inspected in a tree of Instructions. Every
+	 * instruction idiom has to be called on a basic block. The order of
+	 * instruction idiom exchangers is given by initIdioms().
+	 */
+	bool change_made = false; // was there any exchange?
 
-	#if 0
-			/* We do not recognize this well */
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareNeq,
-										"IdiomsLLVM::exchangeCompareNeq");
-	#endif
+	CC_compiler cc = getCompiler();
 
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareSlt,
-										"IdiomsLLVM::exchangeCompareSlt");
+	// Inspect multi-basic block idioms
+	if (cc == CC_GCC || cc == CC_ANY) {
+		change_made |= analyse(f, p, &IdiomsGCC::exchangeCondBitShiftDivMultiBB,
+									"IdiomsGCC::exchangeCondBitShiftDivMultiBB");
+	}
 
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareSle,
-									"IdiomsLLVM::exchangeCompareSle");
+	// Inspect basic-block idioms
+	OpcodeIndex index;
+	for (BasicBlock & bb : f) {
+		indexBasicBlock(bb, index);
+
+		for (const Idiom & idiom : m_idioms) {
+			if (analyse(idiom, index)) {
+				change_made = true;
+				indexBasicBlock(bb, index);
+			}
 		}
 	}
 
@@ -9,6 +9,7 @@
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/optimizations/inst_opt_rda/inst_opt_rda_pass.h"
 #include "retdec/bin2llvmir/optimizations/inst_opt_rda/inst_opt_rda.h"
+#include "retdec/bin2llvmir/providers/rda.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 
 using namespace llvm;
@@ -49,21 +50,22 @@ bool InstructionRdaOptimizer::run()
 {
 	bool changed = false;
 
+	auto* RDA = RdaProvider::getRda(_module, _abi, true);
+
 	for (Function& f : *_module)
 	{
-		changed |= runOnFunction(&f);
+		changed |= runOnFunction(&f, *RDA);
 	}
 
 	return changed;
 }
 
-bool InstructionRdaOptimizer::runOnFunction(llvm::Function* f)
+bool InstructionRdaOptimizer::runOnFunction(
+		llvm::Function* f,
+		ReachingDefinitionsAnalysis& RDA)
 {
 	bool changed = false;
 
-	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnFunction(*f, _abi, true);
-
 	std::unordered_set<llvm::Value*> toRemove;
 
 	for (auto it = inst_begin(f), eIt = inst_end(f); it != eIt;)
@@ -21,6 +21,7 @@
 #define debug_enabled false
 #include "retdec/bin2llvmir/utils/llvm.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/rda.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 
 using namespace retdec::utils;
@@ -59,7 +60,6 @@ bool ParamReturn::runOnModule(Module& m)
 	_dbgf = DebugFormatProvider::getDebugFormat(_module);
 	_lti = LtiProvider::getLti(_module);
 	_demangler = DemanglerProvider::getDemangler(_module);
-	_collector = CollectorProvider::createCollector(_abi, _module, &_RDA);
 
 	return run();
 }
@@ -80,7 +80,6 @@ bool ParamReturn::runOnModuleCustom(
 	_dbgf = dbgf;
 	_lti = lti;
 	_demangler = demangler;
-	_collector = CollectorProvider::createCollector(_abi, _module, &_RDA);
 
 	return run();
 }
@@ -93,7 +92,8 @@ bool ParamReturn::run()
 		return false;
 	}
 
-	_RDA.runOnModule(*_module, _abi);
+	_RDA = RdaProvider::getRda(_module, _abi);
+	_collector = CollectorProvider::createCollector(_abi, _module, _RDA);
 
 	collectAllCalls();
 //	dumpInfo();
@@ -101,8 +101,6 @@ bool ParamReturn::run()
 //	dumpInfo();
 	applyToIr();
 
-	_RDA.clear();
-
 	return false;
 }
 
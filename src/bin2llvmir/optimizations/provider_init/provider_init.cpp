@@ -20,6 +20,7 @@
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/providers/lti.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/rda.h"
 #include "retdec/cpdetect/cpdetect.h"
 #include "retdec/utils/string.h"
 #include "retdec/yaracpp/yara_detector.h"
@@ -168,6 +169,16 @@ void ProviderInitialization::setConfig(retdec::config::Config* c)
 	_config = c;
 }
 
+/**
+ * Use the already parsed input file instead of parsing the input file
+ * from the config again.
+ */
+void ProviderInitialization::setInputFile(
+		const std::shared_ptr<retdec::fileformat::FileFormat>& f)
+{
+	_inputFile = f;
+}
+
 /**
  * @return Always @c false -- this pass does not modify module.
  */
@@ -181,6 +192,7 @@ bool ProviderInitialization::runOnModule(Module& m)
 	FileImageProvider::clear();
 	LtiProvider::clear();
 	NamesProvider::clear();
+	RdaProvider::clear();
 	SymbolicTree::clear();
 	CallingConventionProvider::clear();
 
@@ -199,10 +211,12 @@ bool ProviderInitialization::runOnModule(Module& m)
 
 	// Fileimage.
 	//
-	auto* f = FileImageProvider::addFileImage(
-			&m,
-			c->getConfig().parameters.getInputFile(),
-			c);
+	auto* f = _inputFile
+			? FileImageProvider::addFileImage(&m, _inputFile, c)
+			: FileImageProvider::addFileImage(
+					&m,
+					c->getConfig().parameters.getInputFile(),
+					c);
 	if (f == nullptr)
 	{
 		throw std::runtime_error("ProviderInitialization: f == nullptr");
@@ -361,7 +375,9 @@ bool ProviderInitialization::runOnModule(Module& m)
 	{
 		yara.addRuleFile(crypto);
 	}
-	yara.analyze(c->getConfig().parameters.getInputFile());
+	// The parsed input is scanned, it may exist only in memory (e.g. an
+	// object from an archive).
+	yara.analyze(f->getFileFormat()->getBytes());
 	for(const auto &rule : yara.getDetectedRules())
 	{
 		common::Pattern p = saveCryptoRule(
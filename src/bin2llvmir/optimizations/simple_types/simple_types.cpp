@@ -22,6 +22,7 @@
 #include "retdec/bin2llvmir/optimizations/simple_types/simple_types.h"
 #include "retdec/bin2llvmir/providers/abi/abi.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/rda.h"
 #include "retdec/bin2llvmir/utils/debug.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 
@@ -88,14 +89,14 @@ bool SimpleTypesAnalysis::runOnModule(Module& M)
 	{
 		first = false;
 
-		RDA.runOnModule(M, AbiProvider::getAbi(&M));
+		RDA = RdaProvider::getRda(&M, AbiProvider::getAbi(&M));
 		buildEqSets(M);
 		buildEquations();
 		eqSets.propagate(module);
 		eqSets.apply(module, config, objf, instToErase);
 		eraseObsoleteInstructions();
 		setGlobalConstants();
-		RDA.clear();
+		RDA = nullptr;
 	}
 	else
 	{
@@ -403,7 +404,7 @@ void SimpleTypesAnalysis::processUse(llvm::Value* current, Value* u, std::queue<
 					}
 					else
 					{
-						auto uses = RDA.usesFromDef(store);
+						auto uses = RDA->usesFromDef(store);
 						for (auto* u : uses)
 						{
 							toProcess.push(u->use);
@@ -529,7 +530,7 @@ void SimpleTypesAnalysis::processUse(llvm::Value* current, Value* u, std::queue<
 			}
 			else
 			{
-				auto uses = RDA.usesFromDef(user);
+				auto uses = RDA->usesFromDef(user);
 				for (auto* u : uses)
 				{
 					toProcess.push(u->use);
@@ -16,7 +16,9 @@
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/optimizations/stack/stack.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/rda.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 #define debug_enabled false
 #include "retdec/bin2llvmir/utils/llvm.h"
 
@@ -69,71 +71,101 @@ bool StackAnalysis::run()
 		return false;
 	}
 
-	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnModule(*_module, _abi);
+	auto& RDA = *RdaProvider::getRda(_module, _abi);
 
+	// Functions are analyzed in parallel, the analysis does not modify IR.
+	// Found accesses are then replaced serially, in the original order.
+	//
+	std::vector<FunctionAccesses> fncs;
 	for (auto& f : *_module)
 	{
-		std::map<Value*, Value*> val2val;
-		for (inst_iterator I = inst_begin(f), E = inst_end(f); I != E;)
+		if (!f.empty())
 		{
-			Instruction& i = *I;
-			++I;
+			fncs.emplace_back();
+			fncs.back().function = &f;
+		}
+	}
 
-			if (StoreInst *store = dyn_cast<StoreInst>(&i))
-			{
-				if (AsmInstruction::isLlvmToAsmInstruction(store))
-				{
-					continue;
-				}
+	parallelForEach(fncs, [this, &RDA](FunctionAccesses& fa)
+	{
+		analyzeFunction(RDA, fa);
+	});
+
+	for (auto& fa : fncs)
+	for (auto& access : fa.accesses)
+	{
+		applyStackAccess(access);
+	}
 
-				handleInstruction(
-						RDA,
-						store,
-						store->getValueOperand(),
-						store->getValueOperand()->getType(),
-						val2val);
+	IrModifier::eraseUnusedInstructionsRecursive(_toRemove);
 
-				if (isa<GlobalVariable>(store->getPointerOperand()))
-				{
-					continue;
-				}
+	return false;
+}
 
-				handleInstruction(
-						RDA,
-						store,
-						store->getPointerOperand(),
-						store->getValueOperand()->getType(),
-						val2val);
+void StackAnalysis::analyzeFunction(
+		ReachingDefinitionsAnalysis& RDA,
+		FunctionAccesses& fa) const
+{
+	std::map<Value*, Value*> val2val;
+	for (auto& i : instructions(fa.function))
+	{
+		if (StoreInst *store = dyn_cast<StoreInst>(&i))
+		{
+			if (AsmInstruction::isLlvmToAsmInstruction(store))
+			{
+				continue;
 			}
-			else if (LoadInst* load = dyn_cast<LoadInst>(&i))
+
+			analyzeInstruction(
+					RDA,
+					store,
+					store->getValueOperand(),
+					store->getValueOperand()->getType(),
+					val2val,
+					fa.accesses);
+
+			if (isa<GlobalVariable>(store->getPointerOperand()))
 			{
-				if (isa<GlobalVariable>(load->getPointerOperand()))
-				{
-					continue;
-				}
+				continue;
+			}
 
-				handleInstruction(
-						RDA,
-						load,
-						load->getPointerOperand(),
-						load->getType(),
-						val2val);
+			analyzeInstruction(
+					RDA,
+					store,
+					store->getPointerOperand(),
+					store->getValueOperand()->getType(),
+					val2val,
+					fa.accesses);
+		}
+		else if (LoadInst* load = dyn_cast<LoadInst>(&i))
+		{
+			if (isa<GlobalVariable>(load->getPointerOperand()))
+			{
+				continue;
 			}
+
+			analyzeInstruction(
+					RDA,
+					load,
+					load->getPointerOperand(),
+					load->getType(),
+					val2val,
+					fa.accesses);
 		}
 	}
-
-	IrModifier::eraseUnusedInstructionsRecursive(_toRemove);
-
-	return false;
 }
 
-void StackAnalysis::handleInstruction(
+/**
+ * Find out if @a val used in @a inst is a stack address. If so, add the
+ * access to @a accesses. IR is not modified, see parallelForEach().
+ */
+void StackAnalysis::analyzeInstruction(
 		ReachingDefinitionsAnalysis& RDA,
 		llvm::Instruction* inst,
 		llvm::Value* val,
 		llvm::Type* type,
-		std::map<llvm::Value*, llvm::Value*>& val2val)
+		std::map<llvm::Value*, llvm::Value*>& val2val,
+		std::vector<StackAccess>& accesses) const
 {
 	LOG << llvmObjToString(inst) << std::endl;
 
@@ -158,22 +190,11 @@ void StackAnalysis::handleInstruction(
 		}
 	}
 
-	auto* debugSv = getDebugStackVariable(inst->getFunction(), root);
-	auto* configSv = getConfigStackVariable(inst->getFunction(), root);
+	auto baseOffset = getBaseOffset(root);
 
 	root.simplifyNode();
 	LOG << root << std::endl;
 
-	if (debugSv == nullptr)
-	{
-		debugSv = getDebugStackVariable(inst->getFunction(), root);
-	}
-
-	if (configSv == nullptr)
-	{
-		configSv = getConfigStackVariable(inst->getFunction(), root);
-	}
-
 	auto* ci = dyn_cast_or_null<ConstantInt>(root.value);
 	if (ci == nullptr)
 	{
@@ -191,8 +212,43 @@ void StackAnalysis::handleInstruction(
 	LOG << "===> " << llvmObjToString(ci) << std::endl;
 	LOG << "===> " << ci->getSExtValue() << std::endl;
 
+	StackAccess access;
+	access.inst = inst;
+	access.val = val;
+	access.type = type;
+	access.offset = ci;
+	access.baseOffset = baseOffset;
+	access.simplifiedBaseOffset = getBaseOffset(root);
+	accesses.push_back(access);
+}
+
+/**
+ * Replace the stack @a access with an access to stack variable.
+ */
+void StackAnalysis::applyStackAccess(const StackAccess& access)
+{
+	auto* inst = access.inst;
+	auto* val = access.val;
+	auto* fnc = inst->getFunction();
+
+	// Variables are looked up here rather than in the analysis, the config
+	// ones depend on stack variables created so far.
+	//
+	auto* debugSv = getDebugStackVariable(fnc, access.baseOffset);
+	auto* configSv = getConfigStackVariable(fnc, access.baseOffset);
+
+	if (debugSv == nullptr)
+	{
+		debugSv = getDebugStackVariable(fnc, access.simplifiedBaseOffset);
+	}
+
+	if (configSv == nullptr)
+	{
+		configSv = getConfigStackVariable(fnc, access.simplifiedBaseOffset);
+	}
+
 	std::string name = "";
-	Type* t = type;
+	Type* t = access.type;
 
 	if (debugSv)
 	{
@@ -217,8 +273,8 @@ void StackAnalysis::handleInstruction(
 
 	IrModifier irModif(_module, _config);
 	auto p = irModif.getStackVariable(
-			inst->getFunction(),
-			ci->getSExtValue(),
+			fnc,
+			access.offset->getSExtValue(),
 			t,
 			name,
 			realName,
@@ -248,7 +304,7 @@ void StackAnalysis::handleInstruction(
 		l->replaceAllUsesWith(conv);
 		_toRemove.insert(l);
 	}
-	else
+	else if (is_contained(inst->operand_values(), val))
 	{
 		auto* conv = IrModifier::convertValueToType(a, val->getType(), inst);
 		_toRemove.insert(val);
@@ -256,7 +312,7 @@ void StackAnalysis::handleInstruction(
 	}
 }
 
-std::optional<int> StackAnalysis::getBaseOffset(SymbolicTree& root)
+std::optional<int> StackAnalysis::getBaseOffset(SymbolicTree& root) const
 {
 	std::optional<int> baseOffset;
 	if (auto* ci = dyn_cast_or_null<ConstantInt>(root.value))
@@ -287,14 +343,13 @@ std::optional<int> StackAnalysis::getBaseOffset(SymbolicTree& root)
 }
 
 /**
- * Find a value that is being added to the stack pointer register in \p root.
- * Find a debug variable with offset equal to this value.
+ * Find a debug variable with offset equal to \p baseOffset -- a value that
+ * is being added to the stack pointer register, see getBaseOffset().
  */
 const retdec::common::Object* StackAnalysis::getDebugStackVariable(
 		llvm::Function* fnc,
-		SymbolicTree& root)
+		std::optional<int> baseOffset)
 {
-	auto baseOffset = getBaseOffset(root);
 	if (!baseOffset.has_value())
 	{
 		return nullptr;
@@ -328,9 +383,8 @@ const retdec::common::Object* StackAnalysis::getDebugStackVariable(
 
 const retdec::common::Object* StackAnalysis::getConfigStackVariable(
 		llvm::Function* fnc,
-		SymbolicTree& root)
+		std::optional<int> baseOffset)
 {
-	auto baseOffset = getBaseOffset(root);
 	if (!baseOffset.has_value())
 	{
 		return nullptr;
@@ -32,7 +32,7 @@ Demangler::Demangler(
 	_config(config),
 	_ctypesModule(std::make_unique<ctypes::Module>(std::make_shared<ctypes::Context>())),
 	_typeConfig(typeConfig),
-	_demangler(std::move(demangler)) {}
+	_demangler(std::make_unique<demangler::CachingDemangler>(std::move(demangler))) {}
 
 std::string Demangler::demangleToString(const std::string &mangled)
 {
@@ -72,6 +72,14 @@ demangler::Demangler* Demangler::getDemangler()
 	return _demangler.get();
 }
 
+/**
+ * @return Hit and miss counts of the demangling cache.
+ */
+demangler::CachingDemangler::Statistics Demangler::getCacheStatistics() const
+{
+	return _demangler->statistics();
+}
+
 /******************************************************************/
 /********************** Demangler Factory *************************/
 /******************************************************************/
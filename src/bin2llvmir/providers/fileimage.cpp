@@ -30,7 +30,8 @@ FileImage::FileImage(
 				m,
 				retdec::loader::createImage(
 						path,
-						config->getConfig().fileFormat.isRaw()),
+						config->getConfig().fileFormat.isRaw(),
+						retdec::fileformat::LoadFlags::PROFILE_DECOMPILER),
 				config)
 {
 
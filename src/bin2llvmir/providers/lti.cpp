@@ -16,6 +16,7 @@
 #include "retdec/ctypes/union_type.h"
 #include "retdec/ctypes/unknown_type.h"
 #include "retdec/ctypes/void_type.h"
+#include "retdec/utils/filesystem.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/providers/lti.h"
 #include "retdec/bin2llvmir/utils/ctypes2llvm.h"
@@ -91,20 +92,77 @@ Lti::Lti(
 	}
 }
 
+/**
+ * Loads the given LTI file.
+ *
+ * If there is a precompiled version of the file (@c .lti instead of
+ * @c .json), it is only opened and its functions are parsed when they are
+ * needed. Otherwise, the whole JSON file is parsed.
+ */
 void Lti::loadLtiFile(const std::string& filePath)
 {
+	std::string cc = "cdecl";
+	if (retdec::utils::containsCaseInsensitive(filePath, "win"))
+	{
+		cc = "stdcall";
+	}
+
+	if (openBinaryLtiFile(filePath, cc))
+	{
+		return;
+	}
+
 	std::ifstream file(filePath);
 	if (file)
 	{
-		std::string cc = "cdecl";
-		if (retdec::utils::containsCaseInsensitive(filePath, "win"))
+		// The first definition of a function wins, so functions from all the
+		// previously opened precompiled files have to be in the module before
+		// the JSON file is parsed.
+		for (auto& p : _ltiBinaryParsers)
 		{
-			cc = "stdcall";
+			p.first->parseInto(_ltiModule, _typeConfig->typeWidths(), p.second);
 		}
+		_ltiBinaryParsers.clear();
+
 		_ltiParser.parseInto(file, _ltiModule, _typeConfig->typeWidths(), cc);
 	}
 }
 
+/**
+ * Opens the precompiled version of the given JSON LTI file.
+ * @return @c True if the precompiled file exists and is valid,
+ *         @c false otherwise.
+ */
+bool Lti::openBinaryLtiFile(
+		const std::string& filePath,
+		const std::string& callConv)
+{
+	if (!retdec::utils::endsWith(filePath, ".json"))
+	{
+		return false;
+	}
+	std::string binaryPath = filePath.substr(0, filePath.size() - 5) + ".lti";
+	if (!fs::is_regular_file(binaryPath))
+	{
+		return false;
+	}
+
+	auto parser = std::make_unique<ctypesparser::BinaryCTypesParser>(
+			static_cast<unsigned>(
+					_config->getConfig().architecture.getBitSize()));
+	try
+	{
+		parser->openFile(binaryPath);
+	}
+	catch (const ctypesparser::CTypesParseError&)
+	{
+		return false;
+	}
+
+	_ltiBinaryParsers.emplace_back(std::move(parser), callConv);
+	return true;
+}
+
 bool Lti::hasLtiFunction(const std::string& name)
 {
 	return getLtiFunction(name) != nullptr;
@@ -113,7 +171,24 @@ bool Lti::hasLtiFunction(const std::string& name)
 std::shared_ptr<retdec::ctypes::Function> Lti::getLtiFunction(
 		const std::string& name)
 {
-	return _ltiModule->getFunctionWithName(name);
+	if (auto f = _ltiModule->getFunctionWithName(name))
+	{
+		return f;
+	}
+
+	for (auto& p : _ltiBinaryParsers)
+	{
+		if (auto f = p.first->parseFunction(
+				name,
+				_ltiModule,
+				_typeConfig->typeWidths(),
+				p.second))
+		{
+			return f;
+		}
+	}
+
+	return nullptr;
 }
 
 /**
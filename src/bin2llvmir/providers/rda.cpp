@@ -0,0 +1,60 @@
+/**
+ * @file src/bin2llvmir/providers/rda.cpp
+ * @brief Reaching definitions provider for bin2llvmirl.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "retdec/bin2llvmir/providers/rda.h"
+#include "retdec/utils/io/log.h"
+
+using namespace retdec::utils::io;
+
+namespace retdec {
+namespace bin2llvmir {
+
+std::map<
+		std::pair<llvm::Module*, bool>,
+		ReachingDefinitionsAnalysis> RdaProvider::_module2rda;
+
+/**
+ * Get reaching definitions analysis for module @a m. The analysis is brought
+ * up to date with the current state of the module -- only functions modified
+ * since the last call are recomputed. The outcome is reported in the
+ * decompilation phases log.
+ * @param m             Module for which to get the analysis.
+ * @param abi           ABI used to recognize flag registers.
+ * @param trackFlagRegs Should flag registers be tracked?
+ * @return Analysis associated with @a m, which is valid until the module is
+ *         modified, or until the next call of this method.
+ */
+ReachingDefinitionsAnalysis* RdaProvider::getRda(
+		llvm::Module* m,
+		Abi* abi,
+		bool trackFlagRegs)
+{
+	auto& rda = _module2rda[{m, trackFlagRegs}];
+	auto stats = rda.update(*m, abi, trackFlagRegs);
+
+	std::stringstream msg;
+	msg << std::fixed << std::setprecision(2)
+		<< "reaching definitions: " << stats.recomputed
+		<< " functions recomputed, " << stats.reused
+		<< " reused (" << stats.time << "s, saved " << stats.saved << "s)";
+	Log::phase(msg.str(), Log::SubPhase);
+
+	return &rda;
+}
+
+/**
+ * Clear all stored data.
+ */
+void RdaProvider::clear()
+{
+	_module2rda.clear();
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
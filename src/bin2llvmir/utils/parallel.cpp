@@ -0,0 +1,54 @@
+/**
+ * @file src/bin2llvmir/utils/parallel.cpp
+ * @brief Parallel execution of function-local analyses.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <atomic>
+
+#include "retdec/bin2llvmir/utils/parallel.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+namespace {
+
+std::atomic<bool> parallelExecution(true);
+
+} // anonymous namespace
+
+/**
+ * Get thread pool shared by all the analyses. It is created on the first use,
+ * so processes forked before that create their own pool.
+ */
+llvm::ThreadPool& getThreadPool()
+{
+	static llvm::ThreadPool pool;
+	return pool;
+}
+
+/**
+ * Get mutex guarding the LLVM context in calls of @c parallelForEach().
+ */
+std::mutex& getLlvmContextMutex()
+{
+	static std::mutex mutex;
+	return mutex;
+}
+
+/**
+ * Enable or disable parallel execution of @c parallelForEach(). It is enabled
+ * by default.
+ */
+void setParallelExecution(bool b)
+{
+	parallelExecution = b;
+}
+
+bool isParallelExecution()
+{
+	return parallelExecution;
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -4,15 +4,19 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
+#include <iterator>
 #include <ostream>
+#include <sstream>
+#include <thread>
 #include <vector>
 
+#include "retdec/fileformat/utils/crypto.h"
 #include "retdec/utils/filesystem.h"
 #include "retdec/utils/io/log.h"
 #include "retdec/patterngen/pattern_extractor/pattern_extractor.h"
-#include "yaramod/yaramod.h"
 
 /**
  * Tool for generation of patterns in yara format.
@@ -36,7 +40,132 @@ void printUsage(Logger &log)
 		<< "    If multiple notes are given, only last one is used.\n\n"
 		<< "-l --list LIST_FILE\n"
 		<< "    Optionally pass the list of input files as a text file.\n"
-		<< "    This is useful for a large number of input files.\n\n";
+		<< "    This is useful for a large number of input files.\n\n"
+		<< "-j --jobs VALUE\n"
+		<< "    Extract patterns from VALUE input files in parallel.\n"
+		<< "    If not given, number of processors is used.\n\n"
+		<< "-c --cache-dir CACHE_DIR\n"
+		<< "    Store rules of each input file in CACHE_DIR and reuse them\n"
+		<< "    when file with the same path and content is processed again at\n"
+		<< "    the same position of input list with the same note.\n\n";
+}
+
+/**
+ * Version of cache entries. Change it when format of rules changes.
+ */
+const std::string CACHE_VERSION = "bin2pat-2";
+
+/**
+ * Result of pattern extraction from one input file.
+ */
+struct ExtractedFile
+{
+	bool valid = false;                ///< File was processed.
+	bool cached = false;               ///< Rules were taken from cache.
+	std::string errorMessage;          ///< Problem with invalid file.
+	std::vector<std::string> warnings; ///< Problems with valid file.
+	std::string rules;                 ///< Rules text.
+};
+
+/**
+ * Get path of cache entry for input file.
+ *
+ * Entry is identified by hash of file content and all other values that
+ * affect extracted rules. Path is one of them, it is in the source meta of
+ * the rules.
+ *
+ * @param cacheDir cache directory
+ * @param path input file path
+ * @param groupName prefix of rule names
+ * @param note note added to all rules
+ *
+ * @return path of cache entry, empty string if file cannot be read
+ */
+std::string getCachePath(
+	const std::string &cacheDir,
+	const std::string &path,
+	const std::string &groupName,
+	const std::string &note)
+{
+	std::ifstream input(path, std::ios::binary);
+	if (!input) {
+		return std::string();
+	}
+
+	std::string key((std::istreambuf_iterator<char>(input)),
+		std::istreambuf_iterator<char>());
+	key += '\0' + CACHE_VERSION + '\0' + path + '\0' + groupName + '\0' + note;
+
+	const auto hash = retdec::fileformat::getSha256(
+		reinterpret_cast<const unsigned char*>(key.data()), key.size());
+	return (fs::path(cacheDir) / (hash + ".pat")).string();
+}
+
+/**
+ * Extract patterns from input file or take them from cache.
+ *
+ * @param path input file path
+ * @param groupName prefix of rule names
+ * @param note note added to all rules
+ * @param cacheDir cache directory, empty if cache is not used
+ *
+ * @return extraction result
+ */
+ExtractedFile extractFile(
+	const std::string &path,
+	const std::string &groupName,
+	const std::string &note,
+	const std::string &cacheDir)
+{
+	ExtractedFile result;
+
+	std::string cachePath;
+	if (!cacheDir.empty()) {
+		cachePath = getCachePath(cacheDir, path, groupName, note);
+		std::ifstream cached;
+		if (!cachePath.empty()) {
+			cached.open(cachePath, std::ios::binary);
+		}
+		if (cached.is_open()) {
+			result.rules.assign(std::istreambuf_iterator<char>(cached),
+				std::istreambuf_iterator<char>());
+			result.valid = result.cached = true;
+			return result;
+		}
+	}
+
+	auto extractor = std::make_unique<PatternExtractor>(path, groupName);
+	result.valid = extractor->isValid();
+	if (!result.valid) {
+		result.errorMessage = extractor->getErrorMessage();
+		return result;
+	}
+	result.warnings = extractor->getWarnings();
+
+	// Rules are always printed per file, so that output is the same whether
+	// they are taken from cache or not.
+	std::ostringstream rules;
+	extractor->printRules(rules, note);
+	result.rules = rules.str();
+
+	// Write entry under temporary name first so that other processes
+	// sharing the cache never read incomplete entry.
+	if (!cachePath.empty()) {
+		const auto tmpPath = cachePath + "." + groupName + ".tmp";
+		std::ofstream entry(tmpPath, std::ios::binary);
+		entry << result.rules;
+		entry.close();
+
+		std::error_code ec;
+		if (entry) {
+			fs::rename(tmpPath, cachePath, ec);
+		}
+		else {
+			fs::remove(tmpPath, ec);
+		}
+	}
+
+	return result;
 }
 
 void printErrorAndDie(
@@ -58,6 +187,8 @@ void processArgs(
 {
 	std::string note;
 	std::string outPath;
+	std::string cacheDir;
+	std::size_t jobs = 0;
 	std::vector<std::string> inPaths;
 
 	for (std::size_t i = 0, e = args.size(); i < e; ++i) {
@@ -83,6 +214,33 @@ void processArgs(
 				return;
 			}
 		}
+		else if (args[i] == "-j" || args[i] == "--jobs") {
+			if (i + 1 < e) {
+				std::size_t processed = 0;
+				try {
+					jobs = std::stoull(args[++i], &processed);
+				}
+				catch (const std::exception &) {
+				}
+				if (processed != args[i].size()) {
+					printErrorAndDie("invalid --jobs argument value");
+					return;
+				}
+			}
+			else {
+				needValue(args[i]);
+				return;
+			}
+		}
+		else if (args[i] == "-c" || args[i] == "--cache-dir") {
+			if (i + 1 < e) {
+				cacheDir = args[++i];
+			}
+			else {
+				needValue(args[i]);
+				return;
+			}
+		}
 		else if (args[i] == "-l" || args[i] == "--list") {
 			// Ensure -l --list is not the last thing in args
 			if (&args[i] == &args.back()) {
@@ -130,29 +288,66 @@ void processArgs(
 		return;
 	}
 
-	// Prepare builder.
-	yaramod::YaraFileBuilder builder;
+	if (!cacheDir.empty()) {
+		std::error_code ec;
+		fs::create_directories(cacheDir, ec);
+		if (!fs::is_directory(cacheDir)) {
+			printErrorAndDie("could not create cache directory '"
+				+ cacheDir + "'");
+			return;
+		}
+	}
+
+	if (jobs == 0) {
+		jobs = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	// Rules of all files are collected as text.
+	std::string rules;
 
-	// Process files.
-	unsigned index = 0;
+	// Process files. Files are extracted in parallel in windows, results are
+	// processed in input order so that output does not depend on jobs.
 	bool atLeastOne = false;
-	for (const auto &path : inPaths) {
-		PatternExtractor extractor(path, "file_" + std::to_string(index++));
+	const std::size_t windowSize = jobs * 4;
+	for (std::size_t start = 0; start < inPaths.size(); start += windowSize) {
+		const auto end = std::min(start + windowSize, inPaths.size());
+		std::vector<ExtractedFile> results(end - start);
 
-		// Add rules if valid.
-		if (!extractor.isValid()) {
-			// Sometimes, non-supported files are present in archives. We will
-			// only print warning if such a file is encountered.
-			Log::error() << Log::Error << "file '" << path << "' was not processed.\n";
-			Log::error() << "Problem: " << extractor.getErrorMessage() << ".\n\n";
-			continue;
+		// Thread t extracts files t, t + jobs, t + 2 * jobs, ...
+		auto extractFiles = [&](std::size_t t) {
+			for (auto i = start + t; i < end; i += jobs) {
+				results[i - start] = extractFile(inPaths[i],
+					"file_" + std::to_string(i), note, cacheDir);
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (std::size_t t = 1; t < jobs && start + t < end; ++t) {
+			threads.emplace_back(extractFiles, t);
 		}
-		else {
+		extractFiles(0);
+		for (auto &thread : threads) {
+			thread.join();
+		}
+
+		for (std::size_t i = start; i < end; ++i) {
+			const auto &path = inPaths[i];
+			auto &result = results[i - start];
+
+			// Add rules if valid.
+			if (!result.valid) {
+				// Sometimes, non-supported files are present in archives. We
+				// will only print warning if such a file is encountered.
+				Log::error() << Log::Error << "file '" << path << "' was not processed.\n";
+				Log::error() << "Problem: " << result.errorMessage << ".\n\n";
+				continue;
+			}
+
 			atLeastOne = true;
-			extractor.addRulesToBuilder(builder, note);
+			rules += result.rules;
 
 			// Print warnings if any.
-			const auto &warnings = extractor.getWarnings();
+			const auto &warnings = result.warnings;
 			if (!warnings.empty()) {
 				Log::error() << Log::Warning << "problems with file '" << path << "'\n";
 				for (const auto &warning : warnings) {
@@ -176,10 +371,10 @@ void processArgs(
 			printErrorAndDie("could not open output file");
 			return;
 		}
-		outputFile << builder.get(false)->getText() << "\n";
+		outputFile << rules;
 	}
 	else {
-		Log::info() << builder.get(false)->getText() << "\n";
+		Log::info() << rules;
 	}
 }
 
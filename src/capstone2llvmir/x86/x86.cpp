@@ -4,8 +4,11 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <initializer_list>
 #include <iomanip>
 
+#include <llvm/Transforms/Utils/Local.h>
+
 #include "capstone2llvmir/x86/x86_impl.h"
 
 namespace retdec {
@@ -157,6 +160,192 @@ uint32_t Capstone2LlvmIrTranslatorX86_impl::getParentRegister(uint32_t r) const
 			: r;
 }
 
+namespace {
+
+/**
+ * Status flags tracked by the dead flag analysis, their translator
+ * registers and Capstone's eflags bits.
+ */
+struct StatusFlag
+{
+	uint32_t reg;
+	uint64_t written;
+	uint64_t read;
+};
+
+const std::array<StatusFlag, 6> statusFlags =
+{{
+	{
+		X86_REG_CF,
+		X86_EFLAGS_MODIFY_CF | X86_EFLAGS_RESET_CF | X86_EFLAGS_SET_CF
+				| X86_EFLAGS_UNDEFINED_CF,
+		X86_EFLAGS_TEST_CF | X86_EFLAGS_PRIOR_CF
+	},
+	{
+		X86_REG_PF,
+		X86_EFLAGS_MODIFY_PF | X86_EFLAGS_RESET_PF | X86_EFLAGS_SET_PF
+				| X86_EFLAGS_UNDEFINED_PF,
+		X86_EFLAGS_TEST_PF | X86_EFLAGS_PRIOR_PF
+	},
+	{
+		X86_REG_AF,
+		X86_EFLAGS_MODIFY_AF | X86_EFLAGS_RESET_AF | X86_EFLAGS_SET_AF
+				| X86_EFLAGS_UNDEFINED_AF,
+		X86_EFLAGS_TEST_AF | X86_EFLAGS_PRIOR_AF
+	},
+	{
+		X86_REG_ZF,
+		X86_EFLAGS_MODIFY_ZF | X86_EFLAGS_RESET_ZF | X86_EFLAGS_SET_ZF
+				| X86_EFLAGS_UNDEFINED_ZF,
+		X86_EFLAGS_TEST_ZF | X86_EFLAGS_PRIOR_ZF
+	},
+	{
+		X86_REG_SF,
+		X86_EFLAGS_MODIFY_SF | X86_EFLAGS_RESET_SF | X86_EFLAGS_SET_SF
+				| X86_EFLAGS_UNDEFINED_SF,
+		X86_EFLAGS_TEST_SF | X86_EFLAGS_PRIOR_SF
+	},
+	{
+		X86_REG_OF,
+		X86_EFLAGS_MODIFY_OF | X86_EFLAGS_RESET_OF | X86_EFLAGS_SET_OF
+				| X86_EFLAGS_UNDEFINED_OF,
+		X86_EFLAGS_TEST_OF | X86_EFLAGS_PRIOR_OF
+	},
+}};
+
+/**
+ * Status flags the translation of the instruction always stores. Capstone's
+ * eflags detail may say more (e.g. flags left undefined by @c mul), only
+ * these flags are known to be overwritten by the translated instruction.
+ * Instructions which may leave their flags unchanged (e.g. shifts with
+ * a zero count) are not listed.
+ */
+uint32_t getStoredFlags(const cs_insn& i)
+{
+	auto mask = [](std::initializer_list<uint32_t> regs)
+	{
+		uint32_t ret = 0;
+		for (auto r : regs)
+		{
+			ret |= Capstone2LlvmIrTranslatorX86::getFlagMask(r);
+		}
+		return ret;
+	};
+
+	switch (i.id)
+	{
+		case X86_INS_ADD:
+		case X86_INS_XADD:
+		case X86_INS_ADC:
+		case X86_INS_SUB:
+		case X86_INS_SBB:
+		case X86_INS_CMP:
+		case X86_INS_NEG:
+		case X86_INS_AND:
+		case X86_INS_TEST:
+		case X86_INS_OR:
+		case X86_INS_XOR:
+			return mask({X86_REG_CF, X86_REG_PF, X86_REG_AF, X86_REG_ZF,
+					X86_REG_SF, X86_REG_OF});
+		case X86_INS_INC:
+		case X86_INS_DEC:
+			return mask({X86_REG_PF, X86_REG_AF, X86_REG_ZF, X86_REG_SF,
+					X86_REG_OF});
+		case X86_INS_MUL:
+		case X86_INS_IMUL:
+			return mask({X86_REG_CF, X86_REG_OF});
+		case X86_INS_ADCX:
+		case X86_INS_BT:
+		case X86_INS_CLC:
+		case X86_INS_STC:
+		case X86_INS_CMC:
+			return mask({X86_REG_CF});
+		case X86_INS_ADOX:
+			return mask({X86_REG_OF});
+		case X86_INS_BSF:
+		case X86_INS_BSR:
+			return mask({X86_REG_ZF});
+		default:
+			return 0;
+	}
+}
+
+bool readsWholeFlagsRegister(const cs_insn& i)
+{
+	for (uint8_t j = 0; j < i.detail->regs_read_count; ++j)
+	{
+		if (i.detail->regs_read[j] == X86_REG_EFLAGS)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+} // anonymous namespace
+
+/**
+ * Backward liveness scan over the status flags. A flag written by an
+ * instruction is dead if all the following instructions up to the next
+ * write of the flag do not read it. Instructions the analysis does not
+ * understand make all the flags live.
+ */
+std::vector<uint32_t> Capstone2LlvmIrTranslatorX86_impl::getDeadFlags(
+		const cs_insn* insns,
+		std::size_t count) const
+{
+	uint32_t all = 0;
+	for (auto& f : statusFlags)
+	{
+		all |= getFlagMask(f.reg);
+	}
+
+	std::vector<uint32_t> dead(count, 0);
+	uint32_t live = all;
+	for (std::size_t n = count; n > 0; --n)
+	{
+		auto& i = insns[n-1];
+		if (i.detail == nullptr
+				|| _i2fm.count(i.id) == 0
+				|| _i2fm.at(i.id) == nullptr
+				|| readsWholeFlagsRegister(i)
+				|| isControlFlowInstruction(const_cast<cs_insn&>(i)))
+		{
+			live = all;
+			continue;
+		}
+
+		uint32_t written = 0;
+		uint32_t read = 0;
+		for (auto& f : statusFlags)
+		{
+			if (i.detail->x86.eflags & f.written)
+			{
+				written |= getFlagMask(f.reg);
+			}
+			if (i.detail->x86.eflags & f.read)
+			{
+				read |= getFlagMask(f.reg);
+			}
+		}
+
+		// Flags the instruction reads itself may be read after they are
+		// written in its translation.
+		dead[n-1] = written & ~live & ~read;
+
+		// Only flags the translation surely stores end the live ranges.
+		uint32_t killed = written & getStoredFlags(i);
+		live = (live & ~killed) | read;
+	}
+
+	return dead;
+}
+
+void Capstone2LlvmIrTranslatorX86_impl::setDeadFlags(uint32_t flags)
+{
+	_nextDeadFlags = flags;
+}
+
 //
 //==============================================================================
 // Pure virtual methods from Capstone2LlvmIrTranslator_impl
@@ -222,6 +411,8 @@ void Capstone2LlvmIrTranslatorX86_impl::translateInstruction(
 		llvm::IRBuilder<>& irb)
 {
 	_insn = i;
+	_deadFlags = _nextDeadFlags;
+	_nextDeadFlags = 0;
 
 	cs_detail* d = i->detail;
 	cs_x86* xi = &d->x86;
@@ -237,6 +428,9 @@ void Capstone2LlvmIrTranslatorX86_impl::translateInstruction(
 		throwUnhandledInstructions(i);
 		translatePseudoAsmGeneric(i, xi, irb);
 	}
+
+	eraseDeadFlagValues();
+	_deadFlags = 0;
 }
 
 //
@@ -710,6 +904,12 @@ llvm::StoreInst* Capstone2LlvmIrTranslatorX86_impl::storeRegister(
 		llvm::IRBuilder<>& irb,
 		eOpConv ct)
 {
+	if (isDeadFlag(r))
+	{
+		_deadFlagValues.emplace_back(val);
+		return nullptr;
+	}
+
 	auto* rt = getRegisterType(r);
 	auto pr = getParentRegister(r);
 	auto* reg = getRegister(pr);
@@ -832,9 +1032,31 @@ void Capstone2LlvmIrTranslatorX86_impl::storeRegistersPlusSflags(
 		const std::vector<std::pair<uint32_t, llvm::Value*>>& regs)
 {
 	storeRegisters(irb, regs);
-	storeRegister(X86_REG_ZF, generateZeroFlag(sflagsVal, irb), irb);
-	storeRegister(X86_REG_SF, generateSignFlag(sflagsVal, irb), irb);
-	storeRegister(X86_REG_PF, generateParityFlag(sflagsVal, irb), irb);
+	generateSetSflags(sflagsVal, irb);
+}
+
+bool Capstone2LlvmIrTranslatorX86_impl::isDeadFlag(uint32_t r) const
+{
+	return _deadFlags
+			&& r >= X86_REG_CF
+			&& r <= X86_REG_OF
+			&& (_deadFlags & getFlagMask(r));
+}
+
+/**
+ * Flag values may be computed from values the instruction also stores
+ * elsewhere, so only the values that ended up unused are erased.
+ */
+void Capstone2LlvmIrTranslatorX86_impl::eraseDeadFlagValues()
+{
+	for (auto& v : _deadFlagValues)
+	{
+		if (v)
+		{
+			llvm::RecursivelyDeleteTriviallyDeadInstructions(v);
+		}
+	}
+	_deadFlagValues.clear();
 }
 
 unsigned Capstone2LlvmIrTranslatorX86_impl::getAddrSpace(x86_reg segment)
@@ -1337,9 +1559,18 @@ void Capstone2LlvmIrTranslatorX86_impl::generateSetSflags(
 		llvm::Value* val,
 		llvm::IRBuilder<>& irb)
 {
-	storeRegister(X86_REG_ZF, generateZeroFlag(val, irb), irb);
-	storeRegister(X86_REG_SF, generateSignFlag(val, irb), irb);
-	storeRegister(X86_REG_PF, generateParityFlag(val, irb), irb);
+	if (!isDeadFlag(X86_REG_ZF))
+	{
+		storeRegister(X86_REG_ZF, generateZeroFlag(val, irb), irb);
+	}
+	if (!isDeadFlag(X86_REG_SF))
+	{
+		storeRegister(X86_REG_SF, generateSignFlag(val, irb), irb);
+	}
+	if (!isDeadFlag(X86_REG_PF))
+	{
+		storeRegister(X86_REG_PF, generateParityFlag(val, irb), irb);
+	}
 }
 
 /**
@@ -7,6 +7,8 @@
 #ifndef CAPSTONE2LLVMIR_X86_X86_IMPL_H
 #define CAPSTONE2LLVMIR_X86_X86_IMPL_H
 
+#include <llvm/IR/ValueHandle.h>
+
 #include "retdec/capstone2llvmir/x86/x86.h"
 #include "capstone2llvmir/capstone2llvmir_impl.h"
 
@@ -53,6 +55,11 @@ class Capstone2LlvmIrTranslatorX86_impl :
 		virtual llvm::Function* getX87DataLoadFunction() const override;
 
 		virtual uint32_t getParentRegister(uint32_t r) const override;
+
+		virtual std::vector<uint32_t> getDeadFlags(
+				const cs_insn* insns,
+				std::size_t count) const override;
+		virtual void setDeadFlags(uint32_t flags) override;
 //
 //==============================================================================
 // Pure virtual methods from Capstone2LlvmIrTranslator_impl
@@ -131,6 +138,8 @@ class Capstone2LlvmIrTranslatorX86_impl :
 		unsigned getAddrSpace(x86_reg segment);
 
 		bool isX87DataRegister(uint32_t r);
+		bool isDeadFlag(uint32_t r) const;
+		void eraseDeadFlagValues();
 
 		llvm::Value* loadX87Top(llvm::IRBuilder<>& irb);
 		llvm::Value* loadX87TopDec(llvm::IRBuilder<>& irb);
@@ -221,6 +230,14 @@ class Capstone2LlvmIrTranslatorX86_impl :
 
 		llvm::Function* _x87DataStoreFunction = nullptr; // void (i3, fp80)
 		llvm::Function* _x87DataLoadFunction = nullptr; // fp80 (i3)
+
+		/// Flags set by @c setDeadFlags() for the next translated instruction.
+		uint32_t _nextDeadFlags = 0;
+		/// Flags that are not stored by the currently translated instruction.
+		uint32_t _deadFlags = 0;
+		/// Values computed for the dead flags. They are erased at the end of
+		/// the instruction translation, if nothing else uses them.
+		std::vector<llvm::WeakVH> _deadFlagValues;
 //
 //==============================================================================
 // x86 instruction translation methods.
@@ -127,6 +127,32 @@ bool Function::operator!=(const Function& o) const
 //=============================================================================
 //
 
+FunctionContainer::FunctionContainer() :
+		std::set<Function, FunctionNameCompare>()
+{
+
+}
+
+FunctionContainer::FunctionContainer(const FunctionContainer& o) :
+		std::set<Function, FunctionNameCompare>(o)
+{
+	rebuildIndexes();
+}
+
+/**
+ * We need to make sure pointers in the indexes are valid -- point to the
+ * elements of this container, not the copied one.
+ */
+FunctionContainer& FunctionContainer::operator=(const FunctionContainer& o)
+{
+	if (this != &o)
+	{
+		std::set<Function, FunctionNameCompare>::operator=(o);
+		rebuildIndexes();
+	}
+	return *this;
+}
+
 /**
  * @return @c True if container contains a function of the specified name.
  */
@@ -143,34 +169,191 @@ const Function* FunctionContainer::getFunctionByName(
 }
 
 /**
+ * If there are more functions starting at @p addr, the one with the lowest
+ * name is returned.
  * @return Pointer to function or @c nullptr if not found.
  */
 const Function* FunctionContainer::getFunctionByStartAddress(
 		const retdec::common::Address& addr) const
 {
-	for (auto& elem : *this)
+	if (addr.isUndefined())
 	{
-		if (addr == elem.getStart())
+		for (auto& elem : *this)
 		{
-			return &elem;
+			if (elem.getStart().isUndefined())
+			{
+				return &elem;
+			}
 		}
+		return nullptr;
 	}
 
-	return nullptr;
+	const Function* ret = nullptr;
+	auto range = _addr2fnc.equal_range(addr);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (ret == nullptr || *it->second < *ret)
+		{
+			ret = it->second;
+		}
+	}
+	return ret;
 }
 
+/**
+ * If there are more functions with the real name @p name, the one with the
+ * lowest name is returned.
+ * @return Pointer to function or @c nullptr if not found.
+ */
 const Function* FunctionContainer::getFunctionByRealName(
 	const std::string& name) const
 {
-	for (auto& elem : *this)
+	if (name.empty())
+	{
+		for (auto& elem : *this)
+		{
+			if (elem.getRealName().empty())
+			{
+				return &elem;
+			}
+		}
+		return nullptr;
+	}
+
+	const Function* ret = nullptr;
+	auto range = _realName2fnc.equal_range(name);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (ret == nullptr || *it->second < *ret)
+		{
+			ret = it->second;
+		}
+	}
+	return ret;
+}
+
+/**
+ * Set real name of the function @p f from this container and update the
+ * real name index.
+ */
+void FunctionContainer::setRealName(
+		const Function* f,
+		const std::string& realName)
+{
+	removeFromIndexes(f);
+	// Real name is not a part of the key -- this does not break the set.
+	const_cast<Function*>(f)->setRealName(realName);
+	addToIndexes(f);
+}
+
+/**
+ * Functions are not replaced, inserting a function with the same name as
+ * an existing one does nothing -- same as for the underlying container.
+ */
+std::pair<FunctionContainer::iterator,bool> FunctionContainer::insert(
+		const Function& e)
+{
+	auto retPair = std::set<Function, FunctionNameCompare>::insert(e);
+	if (retPair.second)
+	{
+		addToIndexes(&(*retPair.first));
+	}
+	return retPair;
+}
+
+FunctionContainer::iterator FunctionContainer::insert(
+		FunctionContainer::const_iterator hint,
+		const Function& e)
+{
+	auto oldSize = size();
+	auto it = std::set<Function, FunctionNameCompare>::insert(hint, e);
+	if (size() != oldSize)
 	{
-		if (name == elem.getRealName())
+		addToIndexes(&(*it));
+	}
+	return it;
+}
+
+/**
+ * Clear both underlying container and the indexes.
+ */
+void FunctionContainer::clear()
+{
+	std::set<Function, FunctionNameCompare>::clear();
+	_addr2fnc.clear();
+	_realName2fnc.clear();
+}
+
+/**
+ * Erase the function with the same name as @p val from both underlying
+ * container and the indexes.
+ */
+size_t FunctionContainer::erase(const Function& val)
+{
+	auto it = find(val.getName());
+	if (it == end())
+	{
+		return 0;
+	}
+	erase(it);
+	return 1;
+}
+
+FunctionContainer::iterator FunctionContainer::erase(
+		FunctionContainer::const_iterator pos)
+{
+	removeFromIndexes(&(*pos));
+	return std::set<Function, FunctionNameCompare>::erase(pos);
+}
+
+void FunctionContainer::addToIndexes(const Function* f)
+{
+	if (f->getStart().isDefined())
+	{
+		_addr2fnc.emplace(f->getStart(), f);
+	}
+	if (!f->getRealName().empty())
+	{
+		_realName2fnc.emplace(f->getRealName(), f);
+	}
+}
+
+void FunctionContainer::removeFromIndexes(const Function* f)
+{
+	if (f->getStart().isDefined())
+	{
+		auto range = _addr2fnc.equal_range(f->getStart());
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == f)
+			{
+				_addr2fnc.erase(it);
+				break;
+			}
+		}
+	}
+	if (!f->getRealName().empty())
+	{
+		auto range = _realName2fnc.equal_range(f->getRealName());
+		for (auto it = range.first; it != range.second; ++it)
 		{
-			return &elem;
+			if (it->second == f)
+			{
+				_realName2fnc.erase(it);
+				break;
+			}
 		}
 	}
+}
 
-	return nullptr;
+void FunctionContainer::rebuildIndexes()
+{
+	_addr2fnc.clear();
+	_realName2fnc.clear();
+	for (auto& f : *this)
+	{
+		addToIndexes(&f);
+	}
 }
 
 //
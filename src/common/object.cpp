@@ -217,7 +217,7 @@ std::pair<GlobalVarContainer::iterator,bool> GlobalVarContainer::insert(
 	auto fit = find(e.getName());
 	if (fit != end())
 	{
-		ObjectSetContainer::erase(fit);
+		erase(*fit);
 	}
 
 	auto retPair = ObjectSetContainer::insert(e);
@@ -256,13 +256,23 @@ void GlobalVarContainer::clear()
  */
 size_t GlobalVarContainer::erase(const Object& val)
 {
-	assert(val.getStorage().isMemory());
-	if (val.getStorage().isMemory())
+	auto it = find(val.getId());
+	if (it == end())
 	{
-		_addr2global.erase(val.getStorage().getAddress());
+		return 0;
 	}
-	auto it = find(val.getId());
-	return ObjectSetContainer::erase(*it);
+
+	// Address of the contained object is used, @a val may be only a key.
+	if (it->getStorage().isMemory())
+	{
+		auto ait = _addr2global.find(it->getStorage().getAddress());
+		if (ait != _addr2global.end() && ait->second == &(*it))
+		{
+			_addr2global.erase(ait);
+		}
+	}
+	ObjectSetContainer::erase(it);
+	return 1;
 }
 
 } // namespace common
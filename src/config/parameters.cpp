@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <stdexcept>
+
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
 
@@ -27,6 +29,9 @@ const std::string JSON_selectedFunctions        = "selectedFunctions";
 const std::string JSON_selectedNotFoundFncs     = "selectedNotFoundFncs";
 const std::string JSON_selectedRanges           = "selectedRanges";
 const std::string JSON_llvmPasses               = "llvmPasses";
+const std::string JSON_llvmPipelines            = "llvmPipelines";
+const std::string JSON_llvmPipeline             = "llvmPipeline";
+const std::string JSON_llvmPassStatsFile        = "llvmPassStatsFile";
 const std::string JSON_entryPoint               = "entryPoint";
 const std::string JSON_mainAddress              = "mainAddress";
 const std::string JSON_sectionVMA               = "sectionVMA";
@@ -44,6 +49,7 @@ const std::string JSON_logFile                  = "logFile";
 const std::string JSON_errFile                  = "errFile";
 
 const std::string JSON_detectStaticCode         = "detectStaticCode";
+const std::string JSON_lazyFlags                = "lazyFlags";
 const std::string JSON_backendDisabledOpts      = "backendDisabledOpts";
 const std::string JSON_backendEnabledOpts       = "backendEnabledOpts";
 const std::string JSON_backendCallInfoObtainer  = "backendCallInfoObtainer";
@@ -163,6 +169,11 @@ bool Parameters::isDetectStaticCode() const
 	return _detectStaticCode;
 }
 
+bool Parameters::isLazyFlags() const
+{
+	return _lazyFlags;
+}
+
 bool Parameters::isTimeout() const
 {
 	return _timeout != 0;
@@ -346,6 +357,21 @@ void Parameters::setIsDetectStaticCode(bool b)
 	_detectStaticCode = b;
 }
 
+void Parameters::setIsLazyFlags(bool b)
+{
+	_lazyFlags = b;
+}
+
+void Parameters::setLlvmPipeline(const std::string& name)
+{
+	_llvmPipeline = name;
+}
+
+void Parameters::setLlvmPassStatsFile(const std::string& file)
+{
+	_llvmPassStatsFile = file;
+}
+
 const std::string& Parameters::getOrdinalNumbersDirectory() const
 {
 	return _ordinalNumbersDirectory;
@@ -451,6 +477,65 @@ const std::string& Parameters::getBackendVarRenamer() const
 	return _backendVarRenamer;
 }
 
+const std::string& Parameters::getLlvmPipeline() const
+{
+	return _llvmPipeline;
+}
+
+const std::string& Parameters::getLlvmPassStatsFile() const
+{
+	return _llvmPassStatsFile;
+}
+
+namespace {
+
+void expandLlvmPipeline(
+		const std::map<std::string, std::vector<std::string>>& pipelines,
+		const std::vector<std::string>& passes,
+		std::set<std::string>& expanding,
+		std::vector<std::string>& res)
+{
+	for (auto& p : passes)
+	{
+		if (p.empty() || p[0] != Parameters::LLVM_PIPELINE_REF)
+		{
+			res.push_back(p);
+			continue;
+		}
+
+		auto name = p.substr(1);
+		auto fIt = pipelines.find(name);
+		if (fIt == pipelines.end())
+		{
+			throw std::runtime_error("unknown LLVM pipeline: " + name);
+		}
+		if (!expanding.insert(name).second)
+		{
+			throw std::runtime_error("recursive LLVM pipeline: " + name);
+		}
+		expandLlvmPipeline(pipelines, fIt->second, expanding, res);
+		expanding.erase(name);
+	}
+}
+
+} // anonymous namespace
+
+/**
+ * @return LLVM passes to run: the selected named pipeline, or @c llvmPasses
+ *         if no pipeline is selected, with all pipeline references expanded.
+ */
+std::vector<std::string> Parameters::getLlvmPasses() const
+{
+	std::vector<std::string> passes = _llvmPipeline.empty()
+			? llvmPasses
+			: std::vector<std::string>{LLVM_PIPELINE_REF + _llvmPipeline};
+
+	std::vector<std::string> res;
+	std::set<std::string> expanding;
+	expandLlvmPipeline(llvmPipelines, passes, expanding, res);
+	return res;
+}
+
 void fixPath(std::string& path, fs::path root)
 {
 	fs::path p(path);
@@ -519,6 +604,7 @@ void Parameters::serialize(Writer& writer) const
 	serdes::serializeBool(writer, JSON_backendEmitCfg, isBackendEmitCfg());
 	serdes::serializeBool(writer, JSON_backendEmitCg, isBackendEmitCg());
 	serdes::serializeBool(writer, JSON_detectStaticCode, isDetectStaticCode());
+	serdes::serializeBool(writer, JSON_lazyFlags, isLazyFlags());
 	serdes::serializeBool(writer, JSON_backendAggressiveOpts, isBackendAggressiveOpts());
 	serdes::serializeBool(writer, JSON_backendKeepAllBrackets, isBackendKeepAllBrackets());
 	serdes::serializeBool(writer, JSON_backendKeepLibraryFuncs, isBackendKeepLibraryFuncs());
@@ -540,6 +626,18 @@ void Parameters::serialize(Writer& writer) const
 	serdes::serializeContainer(writer, JSON_selectedFunctions, selectedFunctions);
 	serdes::serializeContainer(writer, JSON_selectedNotFoundFncs, selectedNotFoundFunctions);
 	serdes::serializeContainer(writer, JSON_llvmPasses, llvmPasses);
+	if (!llvmPipelines.empty())
+	{
+		writer.String(JSON_llvmPipelines);
+		writer.StartObject();
+		for (auto& p : llvmPipelines)
+		{
+			serdes::serializeContainer(writer, p.first, p.second, true);
+		}
+		writer.EndObject();
+	}
+	serdes::serializeString(writer, JSON_llvmPipeline, getLlvmPipeline());
+	serdes::serializeString(writer, JSON_llvmPassStatsFile, getLlvmPassStatsFile());
 
 	serdes::serialize(writer, JSON_entryPoint, getEntryPoint());
 	serdes::serialize(writer, JSON_mainAddress, getMainAddress());
@@ -581,6 +679,7 @@ void Parameters::deserialize(const rapidjson::Value& val)
 	setErrFile( serdes::deserializeString(val, JSON_errFile) );
 
 	setIsDetectStaticCode( serdes::deserializeBool(val, JSON_detectStaticCode, true) );
+	setIsLazyFlags( serdes::deserializeBool(val, JSON_lazyFlags, false) );
 	setBackendDisabledOpts( serdes::deserializeString(val, JSON_backendDisabledOpts) );
 	setBackendEnabledOpts( serdes::deserializeString(val, JSON_backendEnabledOpts) );
 	setBackendCallInfoObtainer( serdes::deserializeString(val, JSON_backendCallInfoObtainer, "optim") );
@@ -613,6 +712,20 @@ void Parameters::deserialize(const rapidjson::Value& val)
 	serdes::deserializeContainer(val, JSON_selectedFunctions, selectedFunctions);
 	serdes::deserializeContainer(val, JSON_selectedNotFoundFncs, selectedNotFoundFunctions);
 	serdes::deserializeContainer(val, JSON_llvmPasses, llvmPasses);
+	llvmPipelines.clear();
+	auto pipelines = val.FindMember(JSON_llvmPipelines);
+	if (pipelines != val.MemberEnd() && pipelines->value.IsObject())
+	{
+		for (auto& p : pipelines->value.GetObject())
+		{
+			serdes::deserializeContainer(
+					pipelines->value,
+					p.name.GetString(),
+					llvmPipelines[p.name.GetString()]);
+		}
+	}
+	setLlvmPipeline( serdes::deserializeString(val, JSON_llvmPipeline) );
+	setLlvmPassStatsFile( serdes::deserializeString(val, JSON_llvmPassStatsFile) );
 }
 
 } // namespace config
@@ -519,7 +519,7 @@ ReturnCode CompilerDetector::getAllSignatures()
 	}
 
 	yara.analyze(
-			fileParser.getPathToFile(),
+			fileParser.getBytes(),
 			cpParams.searchType != SearchType::EXACT_MATCH
 	);
 	const auto &detected = yara.getDetectedRules();
@@ -690,16 +690,16 @@ void Heuristics::getDwarfInfo()
 	std::vector<std::string> languages;
 	std::vector<std::size_t> modulesCounter;
 
-	// Open input file as buffer.
+	// Open bytes of the parsed input file as buffer, the file may not exist
+	// on disk.
 	//
-	llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffOrErr =
-			llvm::MemoryBuffer::getFileOrSTDIN(fileParser.getPathToFile());
-	if (buffOrErr.getError())
-	{
-		return;
-	}
-	std::unique_ptr<llvm::MemoryBuffer> bufferPtr = std::move(buffOrErr.get());
-	llvm::MemoryBufferRef buffer = *bufferPtr;
+	const auto& bytes = fileParser.getBytes();
+	const auto path = fileParser.getPathToFile();
+	llvm::MemoryBufferRef buffer(
+			llvm::StringRef(
+					reinterpret_cast<const char*>(bytes.data()),
+					bytes.size()),
+			path);
 
 	// Open buffer as a binary file.
 	//
@@ -0,0 +1,153 @@
+/**
+ * @file src/ctypescompilertool/ctypes_compiler.cpp
+ * @brief Compiler of C-types databases from JSON into the binary format.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "retdec/ctypes/context.h"
+#include "retdec/ctypes/module.h"
+#include "retdec/ctypesparser/binary_ctypes_parser.h"
+#include "retdec/ctypesparser/binary_ctypes_writer.h"
+#include "retdec/ctypesparser/json_ctypes_parser.h"
+#include "retdec/utils/conversion.h"
+#include "retdec/utils/io/log.h"
+
+using namespace retdec::ctypesparser;
+using namespace retdec::utils::io;
+
+/**
+ * @brief String constant containing help.
+ */
+const std::string helpmsg =
+	"Usage:\n"
+	"\tretdec-ctypes-compiler [-h, --help]                               | Show this help.\n"
+	"\tretdec-ctypes-compiler <input.json> <output.lti>                  | Compile the JSON C-types database into the binary format.\n"
+	"\tretdec-ctypes-compiler --benchmark <input.json> <input.lti> [N]   | Compare loading of both formats when N (default 100) functions are needed.\n";
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+int compile(const std::string& inPath, const std::string& outPath)
+{
+	std::ifstream in(inPath, std::ios::binary);
+	if (!in)
+	{
+		Log::error() << "Error: failed to open " << inPath << std::endl;
+		return 1;
+	}
+	std::ofstream out(outPath, std::ios::binary);
+	if (!out)
+	{
+		Log::error() << "Error: failed to open " << outPath << std::endl;
+		return 1;
+	}
+
+	try
+	{
+		BinaryCTypesWriter().write(in, out);
+	}
+	catch (const CTypesParseError& e)
+	{
+		Log::error() << "Error: " << inPath << ": " << e.what() << std::endl;
+		return 1;
+	}
+	return 0;
+}
+
+/**
+ * @brief Measures the time needed to get @a count functions from the JSON
+ *        database (which is always parsed as a whole) and from the binary
+ *        database (which is parsed on demand).
+ */
+int benchmark(
+		const std::string& jsonPath,
+		const std::string& binaryPath,
+		std::size_t count)
+{
+	try
+	{
+		auto start = Clock::now();
+		std::ifstream in(jsonPath, std::ios::binary);
+		auto jsonModule = JSONCTypesParser().parse(in);
+		double jsonTime = elapsedMs(start);
+
+		start = Clock::now();
+		BinaryCTypesParser parser;
+		parser.openFile(binaryPath);
+		double openTime = elapsedMs(start);
+
+		auto names = parser.getFunctionNames();
+		std::size_t step = names.empty() || count == 0
+				? 1
+				: std::max<std::size_t>(1, names.size() / count);
+		auto binaryModule = std::make_unique<retdec::ctypes::Module>(
+				std::make_shared<retdec::ctypes::Context>());
+		std::size_t parsed = 0;
+		start = Clock::now();
+		for (std::size_t i = 0; i < names.size() && parsed < count; i += step)
+		{
+			parser.parseFunction(names[i], binaryModule);
+			++parsed;
+		}
+		double lookupTime = elapsedMs(start);
+
+		Log::info() << "functions in database:   " << names.size() << std::endl;
+		Log::info() << "JSON full parse:         " << jsonTime << " ms" << std::endl;
+		Log::info() << "binary open:             " << openTime << " ms" << std::endl;
+		Log::info() << "binary parse of " << parsed << " functions: "
+				<< lookupTime << " ms" << std::endl;
+	}
+	catch (const CTypesParseError& e)
+	{
+		Log::error() << "Error: " << e.what() << std::endl;
+		return 1;
+	}
+	return 0;
+}
+
+/**
+ * @brief Main function of the C-types compiler tool.
+ */
+int main(int argc, char *argv[])
+{
+	if (argc <= 1 || strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)
+	{
+		Log::info() << helpmsg;
+		return 0;
+	}
+
+	if (strcmp(argv[1], "--benchmark") == 0)
+	{
+		if (argc != 4 && argc != 5)
+		{
+			Log::error() << helpmsg;
+			return 1;
+		}
+		std::size_t count = 100;
+		if (argc == 5 && !retdec::utils::strToNum(argv[4], count))
+		{
+			Log::error() << "Error: invalid number of functions: "
+					<< argv[4] << std::endl << helpmsg;
+			return 1;
+		}
+		return benchmark(argv[2], argv[3], count);
+	}
+
+	if (argc != 3)
+	{
+		Log::error() << helpmsg;
+		return 1;
+	}
+	return compile(argv[1], argv[2]);
+}
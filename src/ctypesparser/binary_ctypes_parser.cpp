@@ -0,0 +1,669 @@
+/**
+* @file src/ctypesparser/binary_ctypes_parser.cpp
+* @brief Parser for C-types from precompiled binary files.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "retdec/ctypes/ctypes.h"
+#include "retdec/ctypesparser/binary_ctypes_format.h"
+#include "retdec/ctypesparser/binary_ctypes_parser.h"
+#include "retdec/utils/container.h"
+#include "retdec/utils/mapped_file.h"
+#include "retdec/utils/string.h"
+
+using namespace retdec::ctypesparser::binary_ctypes;
+
+namespace retdec {
+namespace ctypesparser {
+
+/**
+* @brief Constructs a new parser.
+*/
+BinaryCTypesParser::BinaryCTypesParser() = default;
+
+/**
+* @brief Constructs a new parser.
+*
+* @param defaultBitWidth BitWidth used for types that are not in typeWidths.
+*/
+BinaryCTypesParser::BinaryCTypesParser(unsigned defaultBitWidth):
+	CTypesParser(defaultBitWidth) {}
+
+// Defined here because of the forward declaration of utils::MappedFile.
+BinaryCTypesParser::~BinaryCTypesParser() = default;
+
+/**
+* @brief Opens the given binary C-types file.
+*
+* The file is mapped into memory and stays mapped until the parser is
+* destroyed or another file is opened.
+*
+* @throw CTypesParseError when the file cannot be opened or it is not a valid
+*        binary C-types file.
+*/
+void BinaryCTypesParser::openFile(const std::string &filePath)
+{
+	auto newFile = std::make_unique<retdec::utils::MappedFile>(filePath);
+	if (!newFile->isOpen())
+	{
+		throw CTypesParseError("Failed to open file " + filePath);
+	}
+
+	openBuffer(newFile->getData(), newFile->getSize());
+	file = std::move(newFile);
+}
+
+/**
+* @brief Uses the given data in the binary C-types format.
+*
+* The data are not copied, so they have to outlive the parser.
+*
+* @throw CTypesParseError when the data are not in the valid format.
+*/
+void BinaryCTypesParser::openBuffer(const std::uint8_t *data, std::size_t size)
+{
+	file.reset();
+	this->data = data;
+	this->size = size;
+	parsedTypes.clear();
+
+	try
+	{
+		readHeader();
+	}
+	catch (const CTypesParseError &)
+	{
+		this->data = nullptr;
+		this->size = 0;
+		throw;
+	}
+}
+
+bool BinaryCTypesParser::isOpen() const
+{
+	return data != nullptr;
+}
+
+/**
+* @brief Returns the number of functions in the opened file.
+*/
+std::size_t BinaryCTypesParser::getFunctionCount() const
+{
+	return functionCount;
+}
+
+/**
+* @brief Returns names of all functions in the opened file (sorted).
+*/
+std::vector<std::string> BinaryCTypesParser::getFunctionNames() const
+{
+	std::vector<std::string> names;
+	names.reserve(functionCount);
+	for (std::uint32_t i = 0; i < functionCount; ++i)
+	{
+		std::uint32_t offset = functionIndexOffset + i * FUNCTION_INDEX_ENTRY_SIZE;
+		names.emplace_back(getString(readU32(offset)));
+	}
+	return names;
+}
+
+/**
+* @brief Returns @c true if the opened file contains a function with the given
+*        name, @c false otherwise.
+*/
+bool BinaryCTypesParser::hasFunction(const std::string &name) const
+{
+	return findFunction(name) != functionCount;
+}
+
+/**
+* @brief Parses a single function (and all the types it uses) into the given
+*        module.
+*
+* @param[in] name Name of the function.
+* @param[in] module User's module.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @return The parsed function or @c nullptr if there is no such function.
+*
+* @throw CTypesParseError when the data are corrupted.
+*
+* Types that were already parsed into the context of @a module are reused, so
+* parsing functions one by one results in the same module as parseInto().
+*/
+std::shared_ptr<retdec::ctypes::Function> BinaryCTypesParser::parseFunction(
+	const std::string &name,
+	std::unique_ptr<retdec::ctypes::Module> &module,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	assert(module && "violated precondition - module cannot be null");
+
+	auto indexPos = findFunction(name);
+	if (indexPos == functionCount)
+	{
+		return nullptr;
+	}
+
+	setUpParsing(module, typeWidths, callConvention);
+	auto function = parseFunctionAt(indexPos);
+	module->addFunction(function);
+	return function;
+}
+
+/**
+* @brief Parses all functions from the opened file.
+*
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @return Module filled with C-types information.
+*
+* @throw CTypesParseError when the data are corrupted.
+*/
+std::unique_ptr<retdec::ctypes::Module> BinaryCTypesParser::parse(
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	auto module = std::make_unique<retdec::ctypes::Module>(context);
+	parseInto(module, typeWidths, callConvention);
+	return module;
+}
+
+/**
+* @brief Parses all functions from the opened file into user's module.
+*
+* @param[in] module User's module.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @throw CTypesParseError when the data are corrupted.
+*/
+void BinaryCTypesParser::parseInto(
+	std::unique_ptr<retdec::ctypes::Module> &module,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	assert(module && "violated precondition - module cannot be null");
+
+	setUpParsing(module, typeWidths, callConvention);
+	for (std::uint32_t i = 0; i < functionCount; ++i)
+	{
+		module->addFunction(parseFunctionAt(i));
+	}
+}
+
+/**
+* @brief Reads and checks the header of the opened data.
+*
+* @throw CTypesParseError when the header is invalid.
+*/
+void BinaryCTypesParser::readHeader()
+{
+	checkBounds(0, HEADER_SIZE);
+	if (std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+	{
+		throw CTypesParseError("Invalid magic of a binary C-types file.");
+	}
+
+	std::uint32_t offset = sizeof(MAGIC);
+	if (readU32(offset) != VERSION)
+	{
+		throw CTypesParseError("Unsupported version of a binary C-types file.");
+	}
+	stringsOffset = readU32(offset);
+	stringsSize = readU32(offset);
+	typeCount = readU32(offset);
+	typeTableOffset = readU32(offset);
+	functionCount = readU32(offset);
+	functionIndexOffset = readU32(offset);
+
+	checkBounds(stringsOffset, stringsSize);
+	checkBounds(typeTableOffset, 4ull * typeCount);
+	checkBounds(functionIndexOffset,
+		std::uint64_t(FUNCTION_INDEX_ENTRY_SIZE) * functionCount);
+}
+
+/**
+* @brief Prepares the parser for parsing into the given module.
+*
+* Already parsed types are kept only when they belong to the same context and
+* were parsed with the same settings.
+*/
+void BinaryCTypesParser::setUpParsing(
+	const std::unique_ptr<retdec::ctypes::Module> &module,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	if (context != module->getContext()
+			|| this->typeWidths != typeWidths
+			|| defaultCallConv != callConvention)
+	{
+		parsedTypes.clear();
+	}
+	parsedTypes.resize(typeCount);
+
+	context = module->getContext();
+	this->typeWidths = typeWidths;
+	defaultCallConv = callConvention;
+}
+
+/**
+* @brief Returns the position of the given function in the function index, or
+*        the number of functions if there is no such function.
+*/
+std::uint32_t BinaryCTypesParser::findFunction(const std::string &name) const
+{
+	std::uint32_t first = 0;
+	std::uint32_t count = functionCount;
+	while (count > 0)
+	{
+		std::uint32_t step = count / 2;
+		std::uint32_t offset = functionIndexOffset
+			+ (first + step) * FUNCTION_INDEX_ENTRY_SIZE;
+		if (getString(readU32(offset)) < name)
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	if (first < functionCount)
+	{
+		std::uint32_t offset = functionIndexOffset + first * FUNCTION_INDEX_ENTRY_SIZE;
+		if (getString(readU32(offset)) == name)
+		{
+			return first;
+		}
+	}
+	return functionCount;
+}
+
+/**
+* @brief Parses the function at the given position in the function index.
+*
+* When the context already contains a function with the same name, it is
+* returned instead (as in JSONCTypesParser).
+*/
+std::shared_ptr<retdec::ctypes::Function> BinaryCTypesParser::parseFunctionAt(
+	std::uint32_t indexPos)
+{
+	std::uint32_t offset = functionIndexOffset + indexPos * FUNCTION_INDEX_ENTRY_SIZE;
+	std::string fName(getString(readU32(offset)));
+	offset = readU32(offset);
+
+	auto cachedFunc = context->getFunctionWithName(fName);
+	if (cachedFunc)
+	{
+		return cachedFunc;
+	}
+
+	std::string fDecl(getString(readU32(offset)));
+	std::string fHeader(getString(readU32(offset)));
+	auto returnType = getOrParseType(readU32(offset));
+	auto varArgness = parseVarArgness(offset);
+	auto callConv = parseCallConv(offset);
+
+	retdec::ctypes::Function::Parameters parameters;
+	for (auto paramCount = readU32(offset); paramCount > 0; --paramCount)
+	{
+		std::string paramName(getString(readU32(offset)));
+		auto paramType = getOrParseType(readU32(offset));
+		std::string annotationStr(getString(readU32(offset)));
+		retdec::ctypes::Parameter::Annotations annots;
+		if (!annotationStr.empty())
+		{
+			annots = parseAnnotations(annotationStr);
+		}
+		parameters.emplace_back(paramName, paramType, annots);
+	}
+
+	auto newFunction = retdec::ctypes::Function::create(
+		context, fName, returnType, parameters, callConv, varArgness);
+	newFunction->setDeclaration(retdec::ctypes::FunctionDeclaration(fDecl));
+	newFunction->setHeaderFile(retdec::ctypes::HeaderFile(fHeader));
+	return newFunction;
+}
+
+/**
+* @brief Returns an already parsed type or parses it.
+*
+* @param typeRef Reference of the type (index into the type table).
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesParser::getOrParseType(
+	std::uint32_t typeRef)
+{
+	if (typeRef == UNKNOWN_TYPE_REF)
+	{
+		return retdec::ctypes::UnknownType::create();
+	}
+	if (typeRef >= typeCount)
+	{
+		throw CTypesParseError("Reference to a non-existing type.");
+	}
+
+	auto &cachedType = parsedTypes[typeRef];
+	if (cachedType)
+	{
+		return cachedType;
+	}
+
+	auto parsedType = parseType(typeRef);
+	// The parsing may have already stored the type (e.g. through recursion),
+	// so keep the first one (as in JSONCTypesParser).
+	if (!parsedTypes[typeRef])
+	{
+		parsedTypes[typeRef] = parsedType;
+	}
+	return parsedTypes[typeRef];
+}
+
+/**
+* @brief Parses the type record referenced by @a typeRef.
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesParser::parseType(
+	std::uint32_t typeRef)
+{
+	std::uint32_t offset = typeTableOffset + 4 * typeRef;
+	offset = readU32(offset);
+	auto kind = static_cast<TypeKind>(readU8(offset));
+
+	switch (kind)
+	{
+		case TypeKind::Typedef:
+			return parseTypedefedType(offset);
+		case TypeKind::Pointer:
+		{
+			auto pointedType = getOrParseType(readU32(offset));
+			return retdec::ctypes::PointerType::create(
+				context, pointedType, getBitWidthOrDefault("*"));
+		}
+		case TypeKind::Integral:
+		{
+			std::string typeName(getString(readU32(offset)));
+			if (auto cachedType = context->getNamedType(typeName))
+			{
+				return cachedType;
+			}
+			bool hasBitWidth = readU8(offset);
+			auto bitWidth = static_cast<std::int64_t>(readU64(offset));
+			if (!hasBitWidth)
+			{
+				bitWidth = getIntegralTypeBitWidth(typeName);
+			}
+			auto sign = retdec::utils::contains(typeName, "unsigned") ?
+				retdec::ctypes::IntegralType::Signess::Unsigned :
+				retdec::ctypes::IntegralType::Signess::Signed;
+			return retdec::ctypes::IntegralType::create(
+				context, typeName, bitWidth, sign);
+		}
+		case TypeKind::Struct:
+			return parseCompositeType(offset, true);
+		case TypeKind::Void:
+			return retdec::ctypes::VoidType::create();
+		case TypeKind::Function:
+			return parseFunctionType(offset);
+		case TypeKind::Array:
+			return parseArray(offset);
+		case TypeKind::FloatingPoint:
+		{
+			std::string typeName(getString(readU32(offset)));
+			if (auto cachedType = context->getNamedType(typeName))
+			{
+				return cachedType;
+			}
+			bool hasBitWidth = readU8(offset);
+			auto bitWidth = static_cast<std::int64_t>(readU64(offset));
+			if (!hasBitWidth)
+			{
+				bitWidth = getBitWidthOrDefault(typeName);
+			}
+			return retdec::ctypes::FloatingPointType::create(
+				context, typeName, bitWidth);
+		}
+		case TypeKind::Enum:
+			return parseEnum(offset);
+		case TypeKind::Union:
+			return parseCompositeType(offset, false);
+		case TypeKind::Qualifier:
+			return getOrParseType(readU32(offset));
+		case TypeKind::Unknown:
+			return retdec::ctypes::UnknownType::create();
+		default:
+			throw CTypesParseError("Invalid kind of a type record.");
+	}
+}
+
+/**
+* @brief Parses typedef from its record.
+*
+* Cyclic typedefs are broken by unknown types (as in JSONCTypesParser).
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesParser::parseTypedefedType(
+	std::uint32_t offset)
+{
+	std::string typeName(getString(readU32(offset)));
+	if (auto cachedType = context->getNamedType(typeName))
+	{
+		return cachedType;
+	}
+
+	if (retdec::utils::hasItem(typedefsInProgress, typeName))
+	{
+		return retdec::ctypes::UnknownType::create();
+	}
+
+	typedefsInProgress.emplace_back(typeName);
+	std::shared_ptr<retdec::ctypes::Type> aliasedType;
+	try
+	{
+		aliasedType = getOrParseType(readU32(offset));
+	}
+	catch (const CTypesParseError &)
+	{
+		typedefsInProgress.clear();
+		throw;
+	}
+	if (typeName == typedefsInProgress[0])
+	{   // returned from all nested types
+		typedefsInProgress.clear();
+	}
+	return retdec::ctypes::TypedefedType::create(context, typeName, aliasedType);
+}
+
+/**
+* @brief Parses struct or union from its record.
+*
+* A new type is created at the beginning (like a forward declaration) and its
+* members are set subsequently. This prevents parser from infinite looping.
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesParser::parseCompositeType(
+	std::uint32_t offset,
+	bool isStruct)
+{
+	std::string typeName(getString(readU32(offset)));
+	if (auto cachedType = context->getNamedType(typeName))
+	{
+		return cachedType;
+	}
+
+	std::shared_ptr<retdec::ctypes::CompositeType> newType;
+	if (isStruct)
+	{
+		newType = retdec::ctypes::StructType::create(context, typeName, {});
+	}
+	else
+	{
+		newType = retdec::ctypes::UnionType::create(context, typeName, {});
+	}
+
+	retdec::ctypes::CompositeType::Members members;
+	for (auto memberCount = readU32(offset); memberCount > 0; --memberCount)
+	{
+		std::string memberName(getString(readU32(offset)));
+		members.emplace_back(memberName, getOrParseType(readU32(offset)));
+	}
+	newType->setMembers(members);
+	return newType;
+}
+
+/**
+* @brief Parses enum from its record.
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesParser::parseEnum(
+	std::uint32_t offset)
+{
+	std::string typeName(getString(readU32(offset)));
+	if (auto cachedType = context->getNamedType(typeName))
+	{
+		return cachedType;
+	}
+
+	retdec::ctypes::EnumType::Values values;
+	for (auto itemCount = readU32(offset); itemCount > 0; --itemCount)
+	{
+		std::string itemName(getString(readU32(offset)));
+		values.emplace_back(itemName, static_cast<std::int64_t>(readU64(offset)));
+	}
+	return retdec::ctypes::EnumType::create(context, typeName, values);
+}
+
+/**
+* @brief Parses function type from its record.
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesParser::parseFunctionType(
+	std::uint32_t offset)
+{
+	auto retType = getOrParseType(readU32(offset));
+	auto varArgness = parseVarArgness(offset);
+	auto callConv = parseCallConv(offset);
+
+	retdec::ctypes::FunctionType::Parameters params;
+	for (auto paramCount = readU32(offset); paramCount > 0; --paramCount)
+	{
+		params.emplace_back(getOrParseType(readU32(offset)));
+	}
+	return retdec::ctypes::FunctionType::create(
+		context, retType, params, callConv, varArgness);
+}
+
+/**
+* @brief Parses array from its record.
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesParser::parseArray(
+	std::uint32_t offset)
+{
+	auto elementType = getOrParseType(readU32(offset));
+
+	retdec::ctypes::ArrayType::Dimensions dimensions;
+	for (auto dimCount = readU32(offset); dimCount > 0; --dimCount)
+	{
+		dimensions.emplace_back(readU64(offset));
+	}
+	return retdec::ctypes::ArrayType::create(context, elementType, dimensions);
+}
+
+retdec::ctypes::FunctionType::VarArgness BinaryCTypesParser::parseVarArgness(
+	std::uint32_t &offset)
+{
+	return readU8(offset) ?
+		retdec::ctypes::FunctionType::VarArgness::IsVarArg :
+		retdec::ctypes::FunctionType::VarArgness::IsNotVarArg;
+}
+
+/**
+* @brief Returns the stored call convention if exists, default otherwise.
+*/
+retdec::ctypes::CallConvention BinaryCTypesParser::parseCallConv(
+	std::uint32_t &offset)
+{
+	bool hasCallConv = readU8(offset);
+	std::string callConv(getString(readU32(offset)));
+	return hasCallConv ?
+		retdec::ctypes::CallConvention(callConv) : defaultCallConv;
+}
+
+std::uint8_t BinaryCTypesParser::readU8(std::uint32_t &offset) const
+{
+	checkBounds(offset, 1);
+	return data[offset++];
+}
+
+std::uint32_t BinaryCTypesParser::readU32(std::uint32_t &offset) const
+{
+	checkBounds(offset, 4);
+	std::uint32_t value = 0;
+	for (unsigned i = 0; i < 4; ++i)
+	{
+		value |= std::uint32_t(data[offset + i]) << (8 * i);
+	}
+	offset += 4;
+	return value;
+}
+
+std::uint64_t BinaryCTypesParser::readU64(std::uint32_t &offset) const
+{
+	checkBounds(offset, 8);
+	std::uint64_t value = 0;
+	for (unsigned i = 0; i < 8; ++i)
+	{
+		value |= std::uint64_t(data[offset + i]) << (8 * i);
+	}
+	offset += 8;
+	return value;
+}
+
+/**
+* @brief Reads a length-prefixed string at the given offset.
+*
+* The returned string points directly into the data.
+*/
+std::string_view BinaryCTypesParser::readString(std::uint32_t &offset) const
+{
+	std::uint32_t length = readU32(offset);
+	checkBounds(offset, length);
+	std::string_view str(reinterpret_cast<const char*>(data + offset), length);
+	offset += length;
+	return str;
+}
+
+/**
+* @brief Returns the string with the given reference (offset into the string
+*        pool).
+*/
+std::string_view BinaryCTypesParser::getString(std::uint32_t stringRef) const
+{
+	if (stringRef >= stringsSize)
+	{
+		throw CTypesParseError("Reference to a non-existing string.");
+	}
+	std::uint32_t offset = stringsOffset + stringRef;
+	return readString(offset);
+}
+
+/**
+* @brief Checks that @a size bytes starting at @a offset are within the data.
+*
+* @throw CTypesParseError when they are not.
+*/
+void BinaryCTypesParser::checkBounds(
+	std::uint64_t offset,
+	std::uint64_t size) const
+{
+	if (offset > this->size || size > this->size - offset)
+	{
+		throw CTypesParseError("Truncated or corrupted binary C-types data.");
+	}
+}
+
+} // namespace ctypesparser
+} // namespace retdec
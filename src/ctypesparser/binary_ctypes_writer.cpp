@@ -0,0 +1,500 @@
+/**
+* @file src/ctypesparser/binary_ctypes_writer.cpp
+* @brief Compiler of C-types from JSON into the binary format.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <sstream>
+
+#include <rapidjson/error/en.h>
+
+#include "retdec/ctypes/array_type.h"
+#include "retdec/ctypes/enum_type.h"
+#include "retdec/ctypesparser/binary_ctypes_format.h"
+#include "retdec/ctypesparser/binary_ctypes_writer.h"
+#include "retdec/ctypesparser/exceptions.h"
+
+using namespace retdec::ctypesparser::binary_ctypes;
+
+namespace {
+
+const std::string JSON_functions   = "functions";
+const std::string JSON_types       = "types";
+
+const std::string JSON_call_conv   = "call_conv";
+const std::string JSON_decl        = "decl";
+const std::string JSON_header      = "header";
+const std::string JSON_name        = "name";
+const std::string JSON_params      = "params";
+const std::string JSON_ret_type    = "ret_type";
+const std::string JSON_vararg      = "vararg";
+
+const std::string JSON_annotations          = "annotations";
+const std::string JSON_array                = "array";
+const std::string JSON_bit_width            = "bit_width";
+const std::string JSON_array_dimensions     = "dimensions";
+const std::string JSON_array_element        = "element_type";
+const std::string JSON_enum                 = "enum";
+const std::string JSON_enum_items           = "items";
+const std::string JSON_enum_value           = "value";
+const std::string JSON_integral_type        = "integral_type";
+const std::string JSON_floating_point_type  = "floating_point_type";
+const std::string JSON_function_type        = "function";
+const std::string JSON_members              = "members";
+const std::string JSON_modified_type        = "modified_type";
+const std::string JSON_pointed_type         = "pointed_type";
+const std::string JSON_pointer              = "pointer";
+const std::string JSON_qualifier            = "qualifier";
+const std::string JSON_structure            = "structure";
+const std::string JSON_type                 = "type";
+const std::string JSON_typedef              = "typedef";
+const std::string JSON_typedefed_type       = "typedefed_type";
+const std::string JSON_union                = "union";
+const std::string JSON_unknown_type         = "unknown";
+const std::string JSON_void                 = "void";
+
+/**
+* @brief Returns the member @a name of @a val, or @c nullptr if there is no
+*        such member.
+*/
+const rapidjson::Value *findMember(
+		const rapidjson::Value &val,
+		const std::string &name)
+{
+	if (!val.IsObject())
+	{
+		return nullptr;
+	}
+	auto res = val.FindMember(name.c_str());
+	return res != val.MemberEnd() ? &res->value : nullptr;
+}
+
+const rapidjson::Value &getObject(
+		const rapidjson::Value &val,
+		const std::string &name)
+{
+	auto *res = findMember(val, name);
+	if (!res || !res->IsObject())
+	{
+		throw retdec::ctypesparser::CTypesParseError(
+			name + " must be an object value");
+	}
+	return *res;
+}
+
+const rapidjson::Value &getArray(
+		const rapidjson::Value &val,
+		const std::string &name)
+{
+	auto *res = findMember(val, name);
+	if (!res || !res->IsArray())
+	{
+		throw retdec::ctypesparser::CTypesParseError(
+			name + " must be an array value");
+	}
+	return *res;
+}
+
+std::string getString(const rapidjson::Value &val, const std::string &name)
+{
+	auto *res = findMember(val, name);
+	if (!res || !res->IsString())
+	{
+		throw retdec::ctypesparser::CTypesParseError(
+			name + " must be a string value");
+	}
+	return res->GetString();
+}
+
+} // anonymous namespace
+
+namespace retdec {
+namespace ctypesparser {
+
+/**
+* @brief Compiles C-types from JSON into the binary format.
+*
+* @param[in] jsonStream Input stream containing C-types in JSON.
+* @param[out] outStream Output stream for the binary representation.
+*
+* @throw CTypesParseError when the input JSON is invalid or when the output
+*        cannot be written.
+*/
+void BinaryCTypesWriter::write(std::istream &jsonStream, std::ostream &outStream)
+{
+	auto data = write(jsonStream);
+	outStream.write(reinterpret_cast<const char*>(data.data()), data.size());
+	if (!outStream.good())
+	{
+		throw CTypesParseError("Failed to write to the output stream.");
+	}
+}
+
+/**
+* @brief Compiles C-types from JSON into the binary format.
+*
+* @param[in] jsonStream Input stream containing C-types in JSON.
+*
+* @return Binary representation of the C-types.
+*
+* @throw CTypesParseError when the input JSON is invalid.
+*/
+std::vector<std::uint8_t> BinaryCTypesWriter::write(std::istream &jsonStream)
+{
+	reset();
+
+	std::ostringstream sstr;
+	sstr << jsonStream.rdbuf();
+	if (!jsonStream.good())
+	{
+		throw CTypesParseError("Failed to read from the input stream.");
+	}
+	std::string json = sstr.str();
+
+	rapidjson::Document root;
+	rapidjson::ParseResult res = root.Parse(json.c_str(), json.size());
+	if (!res)
+	{
+		std::ostringstream errMsg;
+		errMsg << "Failed to parse JSON.\n";
+		errMsg << "Error (offset " << res.Offset() << "): "
+			<< GetParseError_En(res.Code()) << std::endl;
+		throw CTypesParseError(errMsg.str());
+	}
+
+	const rapidjson::Value &functions = getObject(root, JSON_functions);
+	const rapidjson::Value &types = getObject(root, JSON_types);
+	for (auto i = types.MemberBegin(), e = types.MemberEnd(); i != e; ++i)
+	{
+		jsonTypes.emplace(i->name.GetString(), &i->value);
+	}
+
+	// Functions are written in the order of their names, which is the order
+	// of the function index.
+	std::vector<std::pair<std::string, const rapidjson::Value*>> sortedFuncs;
+	for (auto i = functions.MemberBegin(), e = functions.MemberEnd(); i != e; ++i)
+	{
+		sortedFuncs.emplace_back(i->name.GetString(), &i->value);
+	}
+	std::stable_sort(sortedFuncs.begin(), sortedFuncs.end(),
+		[](const auto &a, const auto &b) { return a.first < b.first; }
+	);
+	// The first definition of a function wins (as in JSONCTypesParser).
+	sortedFuncs.erase(
+		std::unique(sortedFuncs.begin(), sortedFuncs.end(),
+			[](const auto &a, const auto &b) { return a.first == b.first; }),
+		sortedFuncs.end()
+	);
+
+	std::vector<std::pair<std::uint32_t, std::uint32_t>> funcIndex;
+	for (const auto &f : sortedFuncs)
+	{
+		funcIndex.emplace_back(getStringRef(f.first), records.size());
+		writeFunction(*f.second);
+	}
+
+	while (!typesToWrite.empty())
+	{
+		auto typeKey = typesToWrite.front();
+		typesToWrite.pop();
+		typeOffsets[typeRefs[typeKey]] = records.size();
+		writeType(*jsonTypes[typeKey]);
+	}
+
+	// Assemble the output.
+	std::uint64_t stringsOffset = HEADER_SIZE;
+	std::uint64_t typeTableOffset = stringsOffset + strings.size();
+	std::uint64_t funcIndexOffset = typeTableOffset + 4 * typeOffsets.size();
+	std::uint64_t recordsOffset = funcIndexOffset
+		+ FUNCTION_INDEX_ENTRY_SIZE * funcIndex.size();
+	if (recordsOffset + records.size() > UINT32_MAX)
+	{
+		throw CTypesParseError("The binary representation is too large.");
+	}
+
+	Buffer body;
+	std::swap(body, records);
+	records.insert(records.end(), std::begin(MAGIC), std::end(MAGIC));
+	writeU32(VERSION);
+	writeU32(stringsOffset);
+	writeU32(strings.size());
+	writeU32(typeOffsets.size());
+	writeU32(typeTableOffset);
+	writeU32(funcIndex.size());
+	writeU32(funcIndexOffset);
+	records.insert(records.end(), strings.begin(), strings.end());
+	for (auto offset : typeOffsets)
+	{
+		writeU32(recordsOffset + offset);
+	}
+	for (const auto &entry : funcIndex)
+	{
+		writeU32(entry.first);
+		writeU32(recordsOffset + entry.second);
+	}
+	records.insert(records.end(), body.begin(), body.end());
+
+	Buffer out;
+	std::swap(out, records);
+	reset();
+	return out;
+}
+
+void BinaryCTypesWriter::reset()
+{
+	jsonTypes.clear();
+	typeRefs.clear();
+	typesToWrite = {};
+	typeOffsets.clear();
+	stringRefs.clear();
+	strings.clear();
+	records.clear();
+}
+
+/**
+* @brief Writes a function record.
+*
+* Layout: declaration, header, return type, vararg flag, call convention flag
+* and call convention, number of parameters and, for every parameter, its
+* name, type and annotations.
+*/
+void BinaryCTypesWriter::writeFunction(const rapidjson::Value &jsonFunction)
+{
+	writeU32(getStringRef(getString(jsonFunction, JSON_decl)));
+	writeU32(getStringRef(getString(jsonFunction, JSON_header)));
+	writeU32(getTypeRef(getString(jsonFunction, JSON_ret_type)));
+	writeCallConvAndVarArgness(jsonFunction);
+
+	const rapidjson::Value &params = getArray(jsonFunction, JSON_params);
+	writeU32(params.Size());
+	for (auto i = params.Begin(), e = params.End(); i != e; ++i)
+	{
+		writeU32(getStringRef(getString(*i, JSON_name)));
+		writeU32(getTypeRef(getString(*i, JSON_type)));
+		auto *annotations = findMember(*i, JSON_annotations);
+		writeU32(getStringRef(annotations && annotations->IsString() ?
+			annotations->GetString() : ""));
+	}
+}
+
+/**
+* @brief Writes a type record.
+*
+* Every record starts with the type kind. The rest of the record depends on
+* the kind.
+*/
+void BinaryCTypesWriter::writeType(const rapidjson::Value &jsonType)
+{
+	std::string typeOfType = getString(jsonType, JSON_type);
+
+	if (typeOfType == JSON_typedef)
+	{
+		writeU8(static_cast<std::uint8_t>(TypeKind::Typedef));
+		writeU32(getStringRef(getString(jsonType, JSON_name)));
+		std::string aliasedTypeKey = getString(jsonType, JSON_typedefed_type);
+		writeU32(aliasedTypeKey == JSON_unknown_type ?
+			UNKNOWN_TYPE_REF : getTypeRef(aliasedTypeKey));
+	}
+	else if (typeOfType == JSON_pointer)
+	{
+		writeU8(static_cast<std::uint8_t>(TypeKind::Pointer));
+		writeU32(getTypeRef(getString(jsonType, JSON_pointed_type)));
+	}
+	else if (typeOfType == JSON_integral_type)
+	{
+		writeU8(static_cast<std::uint8_t>(TypeKind::Integral));
+		writeNamedTypeWithBitWidth(jsonType);
+	}
+	else if (typeOfType == JSON_structure || typeOfType == JSON_union)
+	{
+		writeU8(static_cast<std::uint8_t>(typeOfType == JSON_structure ?
+			TypeKind::Struct : TypeKind::Union));
+		writeU32(getStringRef(getString(jsonType, JSON_name)));
+		writeMembers(getArray(jsonType, JSON_members));
+	}
+	else if (typeOfType == JSON_void)
+	{
+		writeU8(static_cast<std::uint8_t>(TypeKind::Void));
+	}
+	else if (typeOfType == JSON_function_type)
+	{
+		writeU8(static_cast<std::uint8_t>(TypeKind::Function));
+		writeU32(getTypeRef(getString(jsonType, JSON_ret_type)));
+		writeCallConvAndVarArgness(jsonType);
+		const rapidjson::Value &params = getArray(jsonType, JSON_params);
+		writeU32(params.Size());
+		for (auto i = params.Begin(), e = params.End(); i != e; ++i)
+		{
+			writeU32(getTypeRef(getString(*i, JSON_type)));
+		}
+	}
+	else if (typeOfType == JSON_array)
+	{
+		writeU8(static_cast<std::uint8_t>(TypeKind::Array));
+		writeU32(getTypeRef(getString(jsonType, JSON_array_element)));
+		writeArrayDimensions(getArray(jsonType, JSON_array_dimensions));
+	}
+	else if (typeOfType == JSON_floating_point_type)
+	{
+		writeU8(static_cast<std::uint8_t>(TypeKind::FloatingPoint));
+		writeNamedTypeWithBitWidth(jsonType);
+	}
+	else if (typeOfType == JSON_enum)
+	{
+		writeU8(static_cast<std::uint8_t>(TypeKind::Enum));
+		writeU32(getStringRef(getString(jsonType, JSON_name)));
+		writeEnumItems(getArray(jsonType, JSON_enum_items));
+	}
+	else if (typeOfType == JSON_qualifier)
+	{
+		writeU8(static_cast<std::uint8_t>(TypeKind::Qualifier));
+		writeU32(getTypeRef(getString(jsonType, JSON_modified_type)));
+	}
+	else
+	{
+		writeU8(static_cast<std::uint8_t>(TypeKind::Unknown));
+	}
+}
+
+/**
+* @brief Writes the vararg flag, the call convention flag and the call
+*        convention (empty if it is not present in JSON).
+*/
+void BinaryCTypesWriter::writeCallConvAndVarArgness(
+		const rapidjson::Value &jsonValue)
+{
+	auto *varArg = findMember(jsonValue, JSON_vararg);
+	writeU8(varArg && varArg->IsBool() && varArg->GetBool());
+
+	auto *callConv = findMember(jsonValue, JSON_call_conv);
+	bool hasCallConv = callConv && callConv->IsString();
+	writeU8(hasCallConv);
+	writeU32(getStringRef(hasCallConv ? callConv->GetString() : ""));
+}
+
+/**
+* @brief Writes the name of the type, the bit width flag and the bit width (if
+*        present in JSON).
+*/
+void BinaryCTypesWriter::writeNamedTypeWithBitWidth(
+		const rapidjson::Value &jsonType)
+{
+	writeU32(getStringRef(getString(jsonType, JSON_name)));
+	auto *bitWidth = findMember(jsonType, JSON_bit_width);
+	bool hasBitWidth = bitWidth && bitWidth->IsInt64();
+	writeU8(hasBitWidth);
+	writeU64(hasBitWidth ? bitWidth->GetInt64() : 0);
+}
+
+void BinaryCTypesWriter::writeMembers(const rapidjson::Value &jsonMembers)
+{
+	writeU32(jsonMembers.Size());
+	for (auto i = jsonMembers.Begin(), e = jsonMembers.End(); i != e; ++i)
+	{
+		writeU32(getStringRef(getString(*i, JSON_name)));
+		writeU32(getTypeRef(getString(*i, JSON_type)));
+	}
+}
+
+void BinaryCTypesWriter::writeArrayDimensions(
+		const rapidjson::Value &jsonDimensions)
+{
+	writeU32(jsonDimensions.Size());
+	for (auto i = jsonDimensions.Begin(), e = jsonDimensions.End(); i != e; ++i)
+	{
+		writeU64(i->IsInt() ?
+			static_cast<retdec::ctypes::ArrayType::DimensionType>(i->GetInt()) :
+			retdec::ctypes::ArrayType::UNKNOWN_DIMENSION);
+	}
+}
+
+void BinaryCTypesWriter::writeEnumItems(const rapidjson::Value &jsonItems)
+{
+	writeU32(jsonItems.Size());
+	for (auto i = jsonItems.Begin(), e = jsonItems.End(); i != e; ++i)
+	{
+		writeU32(getStringRef(getString(*i, JSON_name)));
+		auto *value = findMember(*i, JSON_enum_value);
+		writeU64(value && value->IsInt64() ?
+			value->GetInt64() : retdec::ctypes::EnumType::DEFAULT_VALUE);
+	}
+}
+
+/**
+* @brief Returns the index of the given type in the type table.
+*
+* Types are added into the table when they are referenced for the first time.
+*
+* @throw CTypesParseError when there is no such type in JSON.
+*/
+std::uint32_t BinaryCTypesWriter::getTypeRef(const std::string &typeKey)
+{
+	auto it = typeRefs.find(typeKey);
+	if (it != typeRefs.end())
+	{
+		return it->second;
+	}
+
+	if (jsonTypes.find(typeKey) == jsonTypes.end())
+	{
+		throw CTypesParseError("Reference to a non-existing type " + typeKey);
+	}
+
+	std::uint32_t ref = typeOffsets.size();
+	typeOffsets.push_back(0);
+	typeRefs.emplace(typeKey, ref);
+	typesToWrite.push(typeKey);
+	return ref;
+}
+
+/**
+* @brief Returns the offset of the given string in the string pool.
+*
+* Every string is stored in the pool only once.
+*/
+std::uint32_t BinaryCTypesWriter::getStringRef(const std::string &str)
+{
+	auto it = stringRefs.find(str);
+	if (it != stringRefs.end())
+	{
+		return it->second;
+	}
+
+	std::uint32_t ref = strings.size();
+	std::swap(strings, records);
+	writeString(str);
+	std::swap(strings, records);
+	stringRefs.emplace(str, ref);
+	return ref;
+}
+
+void BinaryCTypesWriter::writeU8(std::uint8_t value)
+{
+	records.push_back(value);
+}
+
+void BinaryCTypesWriter::writeU32(std::uint32_t value)
+{
+	for (unsigned i = 0; i < 4; ++i)
+	{
+		records.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+	}
+}
+
+void BinaryCTypesWriter::writeU64(std::uint64_t value)
+{
+	for (unsigned i = 0; i < 8; ++i)
+	{
+		records.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+	}
+}
+
+void BinaryCTypesWriter::writeString(const std::string &str)
+{
+	writeU32(str.size());
+	records.insert(records.end(), str.begin(), str.end());
+}
+
+} // namespace ctypesparser
+} // namespace retdec
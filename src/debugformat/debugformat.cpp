@@ -24,12 +24,16 @@ DebugFormat::DebugFormat()
  * @param pdbFile   Input PDB file to load debugging information from.
  * @param symtab    Symbol table.
  * @param demangler Demangled instance used for this input file.
+ * @param lazyDwarf Load details of DWARF functions and global variables only
+ *                  when they are asked for. If @c false, everything is loaded
+ *                  right away.
  */
 DebugFormat::DebugFormat(
 		retdec::loader::Image* inFile,
 		const std::string& pdbFile,
 		SymbolTable* symtab,
-		retdec::demangler::Demangler* demangler)
+		retdec::demangler::Demangler* demangler,
+		bool lazyDwarf)
 		:
 		_symtab(symtab),
 		_inFile(inFile),
@@ -54,6 +58,10 @@ DebugFormat::DebugFormat(
 	}
 
 	loadDwarf();
+	if (!lazyDwarf)
+	{
+		loadAll();
+	}
 
 	loadSymtab();
 }
@@ -123,16 +131,98 @@ void DebugFormat::loadSymtab()
 	}
 }
 
+/**
+ * @return Function starting at address @a a, with all the debug information
+ *         loaded, or @c nullptr if there is no such function.
+ */
 retdec::common::Function* DebugFormat::getFunction(retdec::common::Address a)
 {
 	auto fIt = functions.find(a);
-	return fIt != functions.end() ? &fIt->second : nullptr;
+	if (fIt == functions.end())
+	{
+		return nullptr;
+	}
+
+	getFunctionLines(a);
+
+	auto dIt = _dwarfFunctions.find(a);
+	if (dIt != _dwarfFunctions.end())
+	{
+		auto offset = dIt->second;
+		_dwarfFunctions.erase(dIt);
+		loadDwarf_subprogramBody(
+				_dwarfContext->getDIEForOffset(offset),
+				fIt->second);
+	}
+	return &fIt->second;
+}
+
+/**
+ * @return Function starting at address @a a, with its source file and lines
+ *         loaded, or @c nullptr if there is no such function. Its return type,
+ *         parameters, and local variables may not be loaded yet, use
+ *         @c getFunction() to get them.
+ */
+const retdec::common::Function* DebugFormat::getFunctionLines(
+		retdec::common::Address a)
+{
+	auto fIt = functions.find(a);
+	if (fIt == functions.end())
+	{
+		return nullptr;
+	}
+
+	auto dIt = _dwarfFunctionLines.find(a);
+	if (dIt != _dwarfFunctionLines.end())
+	{
+		auto offset = dIt->second;
+		_dwarfFunctionLines.erase(dIt);
+		loadDwarf_subprogramLines(
+				_dwarfContext->getDIEForOffset(offset),
+				fIt->second);
+	}
+	return &fIt->second;
 }
 
+/**
+ * @return Global variable at address @a a, with all the debug information
+ *         loaded, or @c nullptr if there is no such variable.
+ */
 const retdec::common::Object* DebugFormat::getGlobalVar(
 		retdec::common::Address a)
 {
-	return globals.getObjectByAddress(a);
+	auto* gv = globals.getObjectByAddress(a);
+	if (gv == nullptr)
+	{
+		return nullptr;
+	}
+
+	auto dIt = _dwarfGlobals.find(a);
+	if (dIt != _dwarfGlobals.end())
+	{
+		auto offset = dIt->second;
+		_dwarfGlobals.erase(dIt);
+		loadDwarf_globalVariableType(
+				_dwarfContext->getDIEForOffset(offset),
+				*gv);
+		gv = globals.getObjectByAddress(a);
+	}
+	return gv;
+}
+
+/**
+ * Load all the debug information which was not loaded yet.
+ */
+void DebugFormat::loadAll()
+{
+	while (!_dwarfFunctions.empty())
+	{
+		getFunction(_dwarfFunctions.begin()->first);
+	}
+	while (!_dwarfGlobals.empty())
+	{
+		getGlobalVar(_dwarfGlobals.begin()->first);
+	}
 }
 
 } // namespace debugformat
@@ -27,16 +27,17 @@ namespace debugformat {
 
 void DebugFormat::loadDwarf()
 {
-	// Open input file as buffer.
+	// Open bytes of the parsed input file as buffer, the file may not exist
+	// on disk.
 	//
-	llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffOrErr =
-			llvm::MemoryBuffer::getFileOrSTDIN(
-				_inFile->getFileFormat()->getPathToFile());
-	if (buffOrErr.getError())
-	{
-		return;
-	}
-	std::unique_ptr<llvm::MemoryBuffer> bufferPtr = std::move(buffOrErr.get());
+	const auto& bytes = _inFile->getFileFormat()->getBytes();
+	std::unique_ptr<llvm::MemoryBuffer> bufferPtr =
+			llvm::MemoryBuffer::getMemBuffer(
+				llvm::StringRef(
+					reinterpret_cast<const char*>(bytes.data()),
+					bytes.size()),
+				_inFile->getFileFormat()->getPathToFile(),
+				false);
 	llvm::MemoryBufferRef buffer = *bufferPtr;
 
 	// Open buffer as a binary file.
@@ -63,9 +64,16 @@ void DebugFormat::loadDwarf()
 
 	LOG << "\n*** DebugFormat::DebugFormat(): DWARF" << std::endl;
 
-	// Inspect compilation unit DIEs.
+	// DIEs are loaded from the context later, keep it and all the data it
+	// refers to alive.
 	//
-	for (auto& unit : DICtx->compile_units())
+	_dwarfBuffer = std::move(bufferPtr);
+	_dwarfBinary = std::move(binOrErr.get());
+	_dwarfContext = std::move(DICtx);
+
+	// Index functions and global variables in compilation unit DIEs.
+	//
+	for (auto& unit : _dwarfContext->compile_units())
 	{
 		if (auto unitDie = unit->getUnitDIE(false))
 		{
@@ -83,18 +91,22 @@ void DebugFormat::loadDwarf_CU(llvm::DWARFDie die)
 			case llvm::dwarf::DW_TAG_subprogram:
 			{
 				auto f = loadDwarf_subprogram(c);
-				if (!f.getName().empty() && f.getStart().isDefined())
+				if (!f.getName().empty() && f.getStart().isDefined()
+						&& functions.insert({f.getStart(), f}).second)
 				{
-					functions.insert({f.getStart(), f});
+					_dwarfFunctions.emplace(f.getStart(), c.getOffset());
+					_dwarfFunctionLines.emplace(f.getStart(), c.getOffset());
 				}
 				break;
 			}
 			case llvm::dwarf::DW_TAG_variable:
 			{
-				auto v = loadDwarf_variable(c);
-				if (!v.getName().empty())
+				auto v = loadDwarf_variable(c, false);
+				common::Address addr;
+				if (!v.getName().empty() && globals.insert(v).second
+						&& v.getStorage().isMemory(addr))
 				{
-					globals.insert(v);
+					_dwarfGlobals.emplace(addr, c.getOffset());
 				}
 			}
 			default:
@@ -103,6 +115,11 @@ void DebugFormat::loadDwarf_CU(llvm::DWARFDie die)
 	}
 }
 
+/**
+ * Load function's name and address range from subprogram DIE @a die.
+ * The rest is loaded by @c loadDwarf_subprogramLines() and
+ * @c loadDwarf_subprogramBody().
+ */
 retdec::common::Function DebugFormat::loadDwarf_subprogram(llvm::DWARFDie die)
 {
 	// Start & end address.
@@ -156,17 +173,35 @@ retdec::common::Function DebugFormat::loadDwarf_subprogram(llvm::DWARFDie die)
 		return retdec::common::Function();
 	}
 
-	auto* unit = die.getDwarfUnit();
-	auto* lines = unit->getContext().getLineTableForUnit(unit);
-
 	retdec::common::Function dif(linkageName.empty() ? name : linkageName);
 
 	dif.setIsFromDebug(true);
 	dif.setStartEnd(start, end);
 	dif.setDemangledName(demangledName);
 
-	auto* sym = _inFile->getFileFormat()->getSymbol(start + 1);
-	dif.setIsThumb(sym && sym->isThumbSymbol());
+	// Symbols are searched linearly, do it only where they can be Thumb.
+	if (_inFile->getFileFormat()->isArm())
+	{
+		auto* sym = _inFile->getFileFormat()->getSymbol(start + 1);
+		dif.setIsThumb(sym && sym->isThumbSymbol());
+	}
+
+	return dif;
+}
+
+/**
+ * Load source file and lines of function @a dif from its subprogram DIE
+ * @a die. Only the attributes of the DIE and the line table of its unit are
+ * read, no types are converted.
+ */
+void DebugFormat::loadDwarf_subprogramLines(
+		llvm::DWARFDie die,
+		retdec::common::Function& dif)
+{
+	auto start = dif.getStart();
+	auto end = dif.getEnd();
+	auto* unit = die.getDwarfUnit();
+	auto* lines = unit->getContext().getLineTableForUnit(unit);
 
 	// Source file name.
 	//
@@ -209,6 +244,17 @@ retdec::common::Function DebugFormat::loadDwarf_subprogram(llvm::DWARFDie die)
 	}
 	dif.setStartLine(startLine);
 	dif.setEndLine(endLine);
+}
+
+/**
+ * Load return type, parameters, and local variables of function @a dif from
+ * its subprogram DIE @a die.
+ */
+void DebugFormat::loadDwarf_subprogramBody(
+		llvm::DWARFDie die,
+		retdec::common::Function& dif)
+{
+	auto* unit = die.getDwarfUnit();
 
 	// Return type.
 	//
@@ -250,8 +296,6 @@ retdec::common::Function DebugFormat::loadDwarf_subprogram(llvm::DWARFDie die)
 				break;
 		}
 	}
-
-	return dif;
 }
 
 std::string DebugFormat::loadDwarf_type(llvm::DWARFDie die)
@@ -516,7 +560,9 @@ retdec::common::Object DebugFormat::loadDwarf_formal_parameter(
 	return arg;
 }
 
-retdec::common::Object DebugFormat::loadDwarf_variable(llvm::DWARFDie die)
+retdec::common::Object DebugFormat::loadDwarf_variable(
+		llvm::DWARFDie die,
+		bool withType)
 {
 	std::string name;
 	if (auto n = llvm::dwarf::toString(die.find(
@@ -577,6 +623,10 @@ retdec::common::Object DebugFormat::loadDwarf_variable(llvm::DWARFDie die)
 	}
 
 	retdec::common::Object var(name, storage);
+	if (!withType)
+	{
+		return var;
+	}
 	if (auto o = llvm::dwarf::toReference(die.find(llvm::dwarf::DW_AT_type)))
 	{
 		if (auto odie = die.getDwarfUnit()->getDIEForOffset(o.getValue()))
@@ -587,5 +637,30 @@ retdec::common::Object DebugFormat::loadDwarf_variable(llvm::DWARFDie die)
 	return var;
 }
 
+/**
+ * Load type of global variable @a gv from its DIE @a die.
+ * The variable is replaced in @c globals by a copy with the type.
+ */
+void DebugFormat::loadDwarf_globalVariableType(
+		llvm::DWARFDie die,
+		const retdec::common::Object& gv)
+{
+	auto o = llvm::dwarf::toReference(die.find(llvm::dwarf::DW_AT_type));
+	if (!o)
+	{
+		return;
+	}
+	auto odie = die.getDwarfUnit()->getDIEForOffset(o.getValue());
+	if (!odie)
+	{
+		return;
+	}
+
+	retdec::common::Object var = gv;
+	var.type = loadDwarf_type(odie);
+	globals.erase(var);
+	globals.insert(var);
+}
+
 } // namespace debugformat
 } // namespace retdec
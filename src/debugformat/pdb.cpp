@@ -21,6 +21,10 @@ void DebugFormat::loadPdb()
 	loadPdbFunctions();
 }
 
+/**
+ * Convert PDB types which were already parsed. Types are parsed lazily, so
+ * these are only the types used by PDB symbols.
+ */
 void DebugFormat::loadPdbTypes()
 {
 	auto* ts = _pdbFile->get_types_container();
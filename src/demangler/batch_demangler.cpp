@@ -0,0 +1,169 @@
+/**
+ * @file src/demangler/batch_demangler.cpp
+ * @brief Implementation of demangling of large batches of names.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <thread>
+
+#include "retdec/demangler/batch_demangler.h"
+#include "retdec/demangler/borland_demangler.h"
+#include "retdec/demangler/itanium_demangler.h"
+#include "retdec/demangler/microsoft_demangler.h"
+
+namespace {
+
+/**
+ * Batches smaller than this are demangled on the calling thread only,
+ * starting threads would take longer than demangling them.
+ */
+const std::size_t MIN_CHUNK_SIZE = 256;
+
+bool startsWith(const std::string &str, const char *prefix)
+{
+	return str.compare(0, std::char_traits<char>::length(prefix), prefix) == 0;
+}
+
+}    // anonymous namespace
+
+namespace retdec {
+namespace demangler {
+
+/**
+ * @brief Detects mangling scheme of the name from its prefix.
+ * @param mangled Mangled name.
+ * @return Detected scheme, @c ManglingScheme::unknown if the name does not
+ *         look like a mangled name.
+ */
+ManglingScheme detectManglingScheme(const std::string &mangled)
+{
+	// Names in Mach-O files have an extra leading underscore.
+	if (startsWith(mangled, "_Z") || startsWith(mangled, "__Z")) {
+		return ManglingScheme::itanium;
+	}
+	if (startsWith(mangled, "?")) {
+		return ManglingScheme::microsoft;
+	}
+	if (startsWith(mangled, "@")) {
+		return ManglingScheme::borland;
+	}
+	return ManglingScheme::unknown;
+}
+
+/**
+ * @brief Creates demangler for the given mangling scheme.
+ * @return Created demangler, @c nullptr for @c ManglingScheme::unknown.
+ */
+std::unique_ptr<Demangler> createDemangler(ManglingScheme scheme)
+{
+	switch (scheme) {
+	case ManglingScheme::itanium:
+		return std::make_unique<ItaniumDemangler>();
+	case ManglingScheme::microsoft:
+		return std::make_unique<MicrosoftDemangler>();
+	case ManglingScheme::borland:
+		return std::make_unique<BorlandDemangler>();
+	default:
+		return nullptr;
+	}
+}
+
+/**
+ * @brief Demanglers used by one thread, created when they are needed.
+ */
+class BatchDemangler::Worker
+{
+public:
+	void demangle(
+		std::vector<std::string>::const_iterator first,
+		std::vector<std::string>::const_iterator last,
+		std::vector<Result>::iterator out)
+	{
+		for (; first != last; ++first, ++out) {
+			out->scheme = detectManglingScheme(*first);
+			if (auto *d = getDemangler(out->scheme)) {
+				out->demangled = d->demangleToString(*first);
+			}
+		}
+	}
+
+private:
+	Demangler *getDemangler(ManglingScheme scheme)
+	{
+		auto i = static_cast<std::size_t>(scheme);
+		if (_demanglers[i] == nullptr) {
+			_demanglers[i] = createDemangler(scheme);
+		}
+		return _demanglers[i].get();
+	}
+
+private:
+	std::unique_ptr<Demangler> _demanglers[4];
+};
+
+/**
+ * @brief Constructor.
+ * @param threads Maximal number of threads to use, @c 0 for the number of
+ *                hardware threads.
+ */
+BatchDemangler::BatchDemangler(unsigned threads)
+{
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	for (unsigned i = 0; i < threads; ++i) {
+		_workers.push_back(std::make_unique<Worker>());
+	}
+}
+
+BatchDemangler::~BatchDemangler() = default;
+
+/**
+ * @brief Demangles all the names.
+ * @return Results in the same order as @a names.
+ */
+std::vector<BatchDemangler::Result> BatchDemangler::demangle(
+	const std::vector<std::string> &names)
+{
+	std::vector<Result> results(names.size());
+
+	std::size_t chunks = std::min(
+		_workers.size(),
+		std::max<std::size_t>(1, names.size() / MIN_CHUNK_SIZE));
+	std::size_t chunkSize = (names.size() + chunks - 1) / chunks;
+
+	// The first chunk is demangled on the calling thread.
+	std::vector<std::thread> threads;
+	for (std::size_t i = 1; i < chunks; ++i) {
+		auto first = std::min(i * chunkSize, names.size());
+		auto last = std::min(first + chunkSize, names.size());
+		threads.emplace_back(
+			&Worker::demangle,
+			_workers[i].get(),
+			names.begin() + first,
+			names.begin() + last,
+			results.begin() + first);
+	}
+	_workers[0]->demangle(
+		names.begin(),
+		names.begin() + std::min(chunkSize, names.size()),
+		results.begin());
+
+	for (auto &t : threads) {
+		t.join();
+	}
+
+	return results;
+}
+
+/**
+ * @return Maximal number of threads used by @c demangle().
+ */
+unsigned BatchDemangler::getThreadCount() const
+{
+	return static_cast<unsigned>(_workers.size());
+}
+
+}
+}
@@ -0,0 +1,92 @@
+/**
+ * @file src/demangler/caching_demangler.cpp
+ * @brief Implementation of demangler which memoizes results of another demangler.
+ * @copyright (c) 2018 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/ctypes/function.h"
+#include "retdec/ctypes/module.h"
+#include "retdec/demangler/caching_demangler.h"
+
+namespace retdec {
+namespace demangler {
+
+/**
+ * @brief Constructor.
+ * @param demangler Demangler whose results are cached.
+ */
+CachingDemangler::CachingDemangler(std::unique_ptr<Demangler> demangler) :
+	Demangler(demangler->getCompiler()), _demangler(std::move(demangler)) {}
+
+/**
+ * @brief Demangles name, or returns the cached result of its previous demangling.
+ * After use demangler status should be checked.
+ * @param mangled Mangled name.
+ * @return Demangled name.
+ */
+std::string CachingDemangler::demangleToString(const std::string &mangled)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto it = _demangled.find(mangled);
+	if (it != _demangled.end()) {
+		++_statistics.hits;
+	} else {
+		++_statistics.misses;
+		auto demangled = _demangler->demangleToString(mangled);
+		it = _demangled.emplace(
+				mangled,
+				Demangled{std::move(demangled), _demangler->status()}).first;
+	}
+
+	_status = it->second.status;
+	return it->second.name;
+}
+
+std::shared_ptr<ctypes::Function> CachingDemangler::demangleFunctionToCtypes(
+	const std::string &mangled,
+	std::unique_ptr<ctypes::Module> &module,
+	const ctypesparser::CTypesParser::TypeWidths &typeWidths,
+	const ctypesparser::CTypesParser::TypeSignedness &typeSignedness,
+	unsigned defaultBitWidth)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (_notFunctions.count(mangled)) {
+		++_statistics.hits;
+		_status = invalid_mangled_name;
+		return nullptr;
+	}
+	if (auto func = module->getFunctionWithName(mangled)) {
+		++_statistics.hits;
+		_status = success;
+		return func;
+	}
+
+	++_statistics.misses;
+	auto func = _demangler->demangleFunctionToCtypes(
+			mangled,
+			module,
+			typeWidths,
+			typeSignedness,
+			defaultBitWidth);
+	if (func == nullptr) {
+		_notFunctions.insert(mangled);
+		_status = invalid_mangled_name;
+	} else {
+		_status = _demangler->status();
+	}
+	return func;
+}
+
+/**
+ * @return Numbers of cache hits and misses of both string and ctypes demangling.
+ */
+CachingDemangler::Statistics CachingDemangler::statistics() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _statistics;
+}
+
+}
+}
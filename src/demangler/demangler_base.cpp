@@ -24,5 +24,13 @@ Demangler::Status Demangler::status()
 	return _status;
 }
 
+/**
+ * @return Name of compiler mangling scheme.
+ */
+const std::string &Demangler::getCompiler() const
+{
+	return _compiler;
+}
+
 }
 }
@@ -4,6 +4,9 @@
  * @copyright (c) 2018 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <cstdlib>
+
 #include <llvm/Demangle/ItaniumDemangle.h>
 #include <llvm/Demangle/Demangle.h>
 #include <llvm/Demangle/Allocator.h>
@@ -20,6 +23,11 @@ namespace demangler {
  */
 ItaniumDemangler::ItaniumDemangler() : Demangler("itanium") {}
 
+ItaniumDemangler::~ItaniumDemangler()
+{
+	free(_buffer);
+}
+
 /**
  * @brief Method for demangling to string. After use demangler status should be checked.
  * @param mangled Name mangled by itanium mangling scheme.
@@ -31,13 +39,18 @@ std::string ItaniumDemangler::demangleToString(const std::string &mangled)
 	std::string demangled_str = "";
 	int llvm_status{};
 
-	char *demangled_c = llvm::itaniumDemangle(mangled_c, nullptr, nullptr, &llvm_status);
+	std::size_t size = _bufferSize;
+
+	char *demangled_c = llvm::itaniumDemangle(mangled_c, _buffer, &size, &llvm_status);
 
 	switch (llvm_status) {
 	case llvm::demangle_success:
 		_status = success;
+		// The buffer might have been reallocated, the returned size is the
+		// length of the demangled name, not the size of the buffer.
+		_buffer = demangled_c;
+		_bufferSize = std::max(_bufferSize, size);
 		demangled_str = demangled_c;
-		free(demangled_c);
 		break;
 	case llvm::demangle_invalid_mangled_name:
 		_status = invalid_mangled_name;
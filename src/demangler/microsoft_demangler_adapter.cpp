@@ -4,6 +4,9 @@
  * @copyright (c) 2018 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <cstdlib>
+
 #include <llvm/Demangle/Demangle.h>
 #include <llvm/Demangle/MicrosoftDemangle.h>
 
@@ -18,6 +21,11 @@ namespace demangler {
  */
 MicrosoftDemangler::MicrosoftDemangler() : Demangler("microsoft") {}
 
+MicrosoftDemangler::~MicrosoftDemangler()
+{
+	free(_buffer);
+}
+
 /**
  * @brief Method for demangling to string. After use demangler status should be checked.
  * @param mangled Name mangled by microsoft mangling scheme.
@@ -30,13 +38,18 @@ std::string MicrosoftDemangler::demangleToString(const std::string &mangled)
 	std::string demangled_str = "";
 	int llvm_status{};
 
-	char *demangled_c = llvm::microsoftDemangle(mangled_c, nullptr, nullptr, &llvm_status);
+	std::size_t size = _bufferSize;
+
+	char *demangled_c = llvm::microsoftDemangle(mangled_c, _buffer, &size, &llvm_status);
 
 	switch (llvm_status) {
 	case llvm::demangle_success:
 		_status = success;
+		// The buffer might have been reallocated, the returned size is the
+		// length of the demangled name, not the size of the buffer.
+		_buffer = demangled_c;
+		_bufferSize = std::max(_bufferSize, size);
 		demangled_str = demangled_c;
-		free(demangled_c);
 		break;
 	case llvm::demangle_invalid_mangled_name:
 		_status = invalid_mangled_name;
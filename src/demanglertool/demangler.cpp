@@ -4,11 +4,18 @@
  * @copyright (c) 2019 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <string>
 #include <iostream>
 
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
 #include "retdec/demangler/demangler.h"
 
+#include "retdec/utils/conversion.h"
 #include "retdec/utils/io/log.h"
 
 using namespace retdec::utils::io;
@@ -16,6 +23,8 @@ using namespace retdec::utils::io;
 using ItaniumDemangler = retdec::demangler::ItaniumDemangler;
 using MicrosoftDemangler = retdec::demangler::MicrosoftDemangler;
 using BorlandDemangler = retdec::demangler::BorlandDemangler;
+using BatchDemangler = retdec::demangler::BatchDemangler;
+using ManglingScheme = retdec::demangler::ManglingScheme;
 
 /**
  * @brief String constant containing help.
@@ -23,12 +32,153 @@ using BorlandDemangler = retdec::demangler::BorlandDemangler;
 const std::string helpmsg =
 	"Usage:\n"
 	"\t'retdec-demangler [-h, --help]   | Show this help.\n"
-	"\t'retdec-demangler <mangledname>  | Attempt to demangle <mangledname> using all available demanglers and print result if succeded.\n";
+	"\t'retdec-demangler <mangledname>  | Attempt to demangle <mangledname> using all available demanglers and print result if succeded.\n"
+	"\t'retdec-demangler -f, --file <file> [-j, --jobs <n>] [--json] [--stats]\n"
+	"\t                                 | Demangle names from <file> (one per line, '-' for standard input) and print them in the same order.\n"
+	"\t                                 | Scheme of each name is detected from its prefix ('_Z' itanium, '?' microsoft, '@' borland).\n"
+	"\t                                 | Names which cannot be demangled are printed unchanged.\n"
+	"\t    -j, --jobs <n>               | Use <n> threads, at most 1024 (default: number of processors).\n"
+	"\t    --json                       | Print JSON lines with mangled name, demangled name and scheme instead.\n"
+	"\t    --stats                      | Print the number of demangled names per second to the standard error.\n";
+
+namespace {
 
 /**
- * @brief Main function of the Demangler tool.
+ * Number of names read and demangled at once in the batch mode.
  */
-int main(int argc, char *argv[])
+const std::size_t BATCH_SIZE = 1 << 16;
+
+/**
+ * Maximal number of threads in the batch mode.
+ */
+const unsigned MAX_JOBS = 1024;
+
+const char *schemeName(ManglingScheme scheme)
+{
+	switch (scheme) {
+	case ManglingScheme::itanium:
+		return "itanium";
+	case ManglingScheme::microsoft:
+		return "microsoft";
+	case ManglingScheme::borland:
+		return "borland";
+	default:
+		return nullptr;
+	}
+}
+
+/**
+ * @brief Demangle @a names and write results to @a out.
+ */
+void writeBatch(
+	BatchDemangler &demangler,
+	const std::vector<std::string> &names,
+	bool json,
+	std::ostream &out)
+{
+	auto results = demangler.demangle(names);
+
+	std::string text;
+	rapidjson::StringBuffer buffer;
+	for (std::size_t i = 0; i < names.size(); ++i) {
+		auto &r = results[i];
+		if (!json) {
+			text += r.demangled.empty() ? names[i] : r.demangled;
+			text += '\n';
+			continue;
+		}
+
+		buffer.Clear();
+		rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+		writer.StartObject();
+		writer.Key("mangled");
+		writer.String(names[i].c_str(), names[i].size());
+		writer.Key("demangled");
+		if (r.demangled.empty()) {
+			writer.Null();
+		} else {
+			writer.String(r.demangled.c_str(), r.demangled.size());
+		}
+		writer.Key("scheme");
+		if (auto *s = schemeName(r.scheme)) {
+			writer.String(s);
+		} else {
+			writer.Null();
+		}
+		writer.EndObject();
+		text.append(buffer.GetString(), buffer.GetSize());
+		text += '\n';
+	}
+	out.write(text.data(), text.size());
+}
+
+/**
+ * @brief Demangle all names from @a in in batches.
+ * @return Number of demangled names.
+ */
+std::size_t demangleStream(
+	std::istream &in,
+	unsigned jobs,
+	bool json,
+	std::ostream &out)
+{
+	BatchDemangler demangler(jobs);
+	std::size_t count = 0;
+
+	std::vector<std::string> names;
+	names.reserve(BATCH_SIZE);
+	std::string line;
+	while (std::getline(in, line)) {
+		if (!line.empty() && line.back() == '\r') {
+			line.pop_back();
+		}
+		names.push_back(std::move(line));
+		if (names.size() == BATCH_SIZE) {
+			writeBatch(demangler, names, json, out);
+			count += names.size();
+			names.clear();
+		}
+	}
+	writeBatch(demangler, names, json, out);
+	count += names.size();
+
+	out.flush();
+	return count;
+}
+
+/**
+ * @brief Batch mode -- demangle names from file @a path.
+ */
+int demangleFile(const std::string &path, unsigned jobs, bool json, bool stats)
+{
+	std::ios::sync_with_stdio(false);
+	auto start = std::chrono::steady_clock::now();
+
+	std::size_t count = 0;
+	if (path == "-") {
+		count = demangleStream(std::cin, jobs, json, std::cout);
+	} else {
+		std::ifstream in(path);
+		if (!in) {
+			Log::error() << Log::Error << "cannot open file: " << path << std::endl;
+			return 1;
+		}
+		count = demangleStream(in, jobs, json, std::cout);
+	}
+
+	if (stats) {
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		Log::error() << count << " names in " << elapsed.count() << " s ("
+			<< static_cast<std::size_t>(count / std::max(elapsed.count(), 1e-9))
+			<< " names/s)" << std::endl;
+	}
+	return 0;
+}
+
+/**
+ * @brief Demangle names from @a argv using all available demanglers.
+ */
+int demangleArguments(int argc, char *argv[])
 {
 	auto dem_gcc = std::make_unique<ItaniumDemangler>();
 	auto dem_ms = std::make_unique<MicrosoftDemangler>();
@@ -38,11 +188,6 @@ int main(int argc, char *argv[])
 	std::string demangledMs;
 	std::string demangledBorland;
 
-	if (argc <= 1 || strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0) {
-		Log::info() << helpmsg;
-		return 0;
-	}
-
 	//process all mangled arguments
 	for (unsigned int i = 1; i < static_cast<unsigned int>(argc); i++) {
 		//demangle using all available demanglers
@@ -63,3 +208,55 @@ int main(int argc, char *argv[])
 
 	return 0;
 }
+
+}    // anonymous namespace
+
+/**
+ * @brief Main function of the Demangler tool.
+ */
+int main(int argc, char *argv[])
+{
+	if (argc <= 1 || std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help") {
+		Log::info() << helpmsg;
+		return 0;
+	}
+
+	std::string file;
+	unsigned jobs = 0;
+	bool jobsUsed = false;
+	bool json = false;
+	bool stats = false;
+	bool batch = false;
+	for (int i = 1; i < argc; i++) {
+		std::string a = argv[i];
+		bool hasValue = a == "-f" || a == "--file" || a == "-j" || a == "--jobs";
+		if (hasValue && i + 1 >= argc) {
+			Log::error() << Log::Error << "missing value of " << a << std::endl;
+			return 1;
+		}
+
+		if (a == "-f" || a == "--file") {
+			file = argv[++i];
+			batch = true;
+		} else if (a == "-j" || a == "--jobs") {
+			if (!retdec::utils::strToNum(argv[++i], jobs) || jobs > MAX_JOBS) {
+				Log::error() << Log::Error << "invalid number of jobs: " << argv[i] << std::endl;
+				return 1;
+			}
+			jobsUsed = true;
+		} else if (a == "--json") {
+			json = true;
+		} else if (a == "--stats") {
+			stats = true;
+		}
+	}
+
+	if (!batch && (jobsUsed || json || stats)) {
+		Log::error() << Log::Error << "-j, --jobs, --json and --stats can be used only with -f, --file" << std::endl;
+		return 1;
+	}
+
+	return batch
+		? demangleFile(file, jobs, json, stats)
+		: demangleArguments(argc, argv);
+}
@@ -188,6 +188,7 @@ void FileFormat::init()
 	certificateTable = nullptr;
 	tlsInfo = nullptr;
 	elfCoreInfo = nullptr;
+	lazyParts = getLoadFlags() & LoadFlags::LAZY_ALL;
 	fileFormat = Format::UNDETECTABLE;
 	stateIsValid = readFile(fileStream, bytes) && stateIsValid;
 	if (getLoadFlags() & LoadFlags::NO_FILE_HASHES)
@@ -495,6 +496,31 @@ LoadFlags FileFormat::getLoadFlags() const
 	return loadFlags;
 }
 
+/**
+ * Load a part of the file which was not loaded with the file
+ * @param part @c LAZY_* load flag of the part
+ *
+ * The part is loaded only once, on the first call.
+ */
+void FileFormat::loadLazily(LoadFlags part) const
+{
+	if (lazyParts & part)
+	{
+		lazyParts &= ~part;
+		const_cast<FileFormat*>(this)->loadLazyPart(part);
+	}
+}
+
+/**
+ * Load a part of the file marked by the @c LAZY_* load flag @a part
+ *
+ * Formats which support lazy loading of some parts override this method.
+ */
+void FileFormat::loadLazyPart(LoadFlags)
+{
+
+}
+
 /**
  * Get section which is located at offset @a offset
  * @param offset Offset in file
@@ -1565,6 +1591,7 @@ const ResourceTree* FileFormat::getResourceTree() const
  */
 const RichHeader* FileFormat::getRichHeader() const
 {
+	loadLazily(LoadFlags::LAZY_RICH_HEADER);
 	return richHeader;
 }
 
@@ -1583,6 +1610,7 @@ const PdbInfo* FileFormat::getPdbInfo() const
  */
 const CertificateTable* FileFormat::getCertificateTable() const
 {
+	loadLazily(LoadFlags::LAZY_CERTIFICATES);
 	return certificateTable;
 }
 
@@ -1756,6 +1784,7 @@ const Resource* FileFormat::getVersionResource() const
  */
 bool FileFormat::isSignaturePresent() const
 {
+	loadLazily(LoadFlags::LAZY_CERTIFICATES);
 	return signatureVerified.has_value();
 }
 
@@ -1765,6 +1794,7 @@ bool FileFormat::isSignaturePresent() const
  */
 bool FileFormat::isSignatureVerified() const
 {
+	loadLazily(LoadFlags::LAZY_CERTIFICATES);
 	return signatureVerified.has_value() && signatureVerified.value();
 }
 
@@ -877,21 +877,13 @@ void PeFormat::initStructures(const std::string & dllListFile)
 	{
 		try
 		{
-			if(file->loadPeHeaders(bytes) == ERROR_NONE)
+			// The bytes are not modified after loading and outlive the file,
+			// so the mapped image can share them instead of copying them
+			if(file->loadPeHeaders(bytes, false, true) == ERROR_NONE)
 				stateIsValid = true;
 
 			file->readCoffSymbolTable(bytes);
-			file->readImportDirectory();
-			file->readIatDirectory();
-			file->readBoundImportDirectory();
-			file->readDelayImportDirectory();
-			file->readExportDirectory();
-			file->readDebugDirectory();
-			file->readTlsDirectory();
-			file->readResourceDirectory();
-			file->readSecurityDirectory();
-			file->readComHeaderDirectory();
-			file->readRelocationsDirectory();
+			file->readDirectories();
 
 			// Fill-in the loader error info from PE file
 			initLoaderErrorInfo();
@@ -906,23 +898,56 @@ void PeFormat::initStructures(const std::string & dllListFile)
 	if(stateIsValid)
 	{
 		fileFormat = Format::PE;
-		loadRichHeader();
+		if (!(getLoadFlags() & LoadFlags::LAZY_RICH_HEADER))
+			loadRichHeader();
 		loadSections();
 		loadSymbols();
 		loadImports();
 		loadExports();
 		loadPdbInfo();
 		loadResources();
-		loadCertificates();
+		if (!(getLoadFlags() & LoadFlags::LAZY_CERTIFICATES))
+			loadCertificates();
 		loadTlsInformation();
-		loadDotnetHeaders();
-		loadVisualBasicHeader();
+		if (!(getLoadFlags() & LoadFlags::LAZY_DOTNET))
+			loadDotnetHeaders();
+		if (!(getLoadFlags() & LoadFlags::LAZY_VISUAL_BASIC))
+			loadVisualBasicHeader();
 		computeSectionTableHashes();
 		loadStrings();
 		scanForAnomalies();
 	}
 }
 
+/**
+ * Load a part of the file which was skipped by the @c LAZY_* load flag @a part
+ */
+void PeFormat::loadLazyPart(LoadFlags part)
+{
+	if (!stateIsValid)
+	{
+		return;
+	}
+
+	switch (part)
+	{
+		case LoadFlags::LAZY_RICH_HEADER:
+			loadRichHeader();
+			break;
+		case LoadFlags::LAZY_CERTIFICATES:
+			loadCertificates();
+			break;
+		case LoadFlags::LAZY_DOTNET:
+			loadDotnetHeaders();
+			break;
+		case LoadFlags::LAZY_VISUAL_BASIC:
+			loadVisualBasicHeader();
+			break;
+		default:
+			break;
+	}
+}
+
 std::size_t PeFormat::initSectionTableHashOffsets()
 {
 	secHashInfo.emplace_back(20, 4);
@@ -3598,6 +3623,7 @@ bool PeFormat::initDllList(const std::string & dllListFile)
  */
 bool PeFormat::isDotNet() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return clrHeader != nullptr || metadataHeader != nullptr;
 }
 
@@ -3745,76 +3771,91 @@ const PeCoffSection* PeFormat::getPeSection(unsigned long long secIndex) const
 
 const CLRHeader* PeFormat::getCLRHeader() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return clrHeader.get();
 }
 
 const MetadataHeader* PeFormat::getMetadataHeader() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return metadataHeader.get();
 }
 
 const MetadataStream* PeFormat::getMetadataStream() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return metadataStream.get();
 }
 
 const StringStream* PeFormat::getStringStream() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return stringStream.get();
 }
 
 const BlobStream* PeFormat::getBlobStream() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return blobStream.get();
 }
 
 const GuidStream* PeFormat::getGuidStream() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return guidStream.get();
 }
 
 const UserStringStream* PeFormat::getUserStringStream() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return userStringStream.get();
 }
 
 const std::string& PeFormat::getModuleVersionId() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return moduleVersionId;
 }
 
 const std::string& PeFormat::getTypeLibId() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return typeLibId;
 }
 
 const std::vector<std::shared_ptr<DotnetClass>>& PeFormat::getDefinedDotnetClasses() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return definedClasses;
 }
 
 const std::vector<std::shared_ptr<DotnetClass>>& PeFormat::getImportedDotnetClasses() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return importedClasses;
 }
 
 const std::string& PeFormat::getTypeRefhashCrc32() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return typeRefHashCrc32;
 }
 
 const std::string& PeFormat::getTypeRefhashMd5() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return typeRefHashMd5;
 }
 
 const std::string& PeFormat::getTypeRefhashSha256() const
 {
+	loadLazily(LoadFlags::LAZY_DOTNET);
 	return typeRefHashSha256;
 }
 
 const VisualBasicInfo* PeFormat::getVisualBasicInfo() const
 {
+	loadLazily(LoadFlags::LAZY_VISUAL_BASIC);
 	return &visualBasicInfo;
 }
 
@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <chrono>
 #include <regex>
 
 #include <llvm/Support/ErrorHandling.h>
@@ -15,6 +16,7 @@
 #include "retdec/ar-extractor/detection.h"
 #include "retdec/cpdetect/errors.h"
 #include "retdec/cpdetect/settings.h"
+#include "retdec/fileformat/format_factory.h"
 #include "retdec/fileformat/utils/format_detection.h"
 #include "retdec/fileformat/utils/other.h"
 #include "fileinfo/file_detector/detector_factory.h"
@@ -56,6 +58,7 @@ struct ProgParams
 	bool maxMemoryHalfRAM;                  ///< limit maximal memory to half of system RAM
 	std::size_t epBytesCount;               ///< number of bytes to load from entry point
 	LoadFlags loadFlags;                    ///< load flags for `fileformat`
+	std::size_t loadBenchmarkCount;         ///< number of loads of the file per load profile, 0 if not benchmarking
 
 	ProgParams() : searchMode(SearchType::EXACT_MATCH),
 					internalDatabase(true),
@@ -67,7 +70,8 @@ struct ProgParams
 					maxMemory(0),
 					maxMemoryHalfRAM(false),
 					epBytesCount(EP_BYTES_SIZE),
-					loadFlags(LoadFlags::NONE) {}
+					loadFlags(LoadFlags::PROFILE_FILEINFO),
+					loadBenchmarkCount(0) {}
 };
 
 /**
@@ -178,7 +182,13 @@ void printHelp()
 				<< "\n"
 				<< "Options for specifying list of available DLLs:\n"
 				<< "    --dlls=filename\n"
-				<< "                          Load the list of present DLLs from the file.\n";
+				<< "                          Load the list of present DLLs from the file.\n"
+				<< "\n"
+				<< "Options for measuring performance:\n"
+				<< "    --load-benchmark=N\n"
+				<< "                          Load the file N times with each load profile\n"
+				<< "                          (fileinfo, unpacker, decompiler), print average\n"
+				<< "                          load times and exit.\n";
 }
 
 std::string getParamOrDie(std::vector<std::string> &argv, std::size_t &i)
@@ -217,7 +227,8 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 	std::vector<std::string> argv;
 
 	std::set<std::string> withArgs = {"malware", "m", "crypto", "C", "other",
-			"o", "config", "c", "no-hashes", "max-memory", "ep-bytes", "dlls"};
+			"o", "config", "c", "no-hashes", "max-memory", "ep-bytes", "dlls",
+			"load-benchmark"};
 	for (int i = 1; i < argc; ++i)
 	{
 		std::string a = _argv[i];
@@ -365,6 +376,12 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 
 			params.dllListFile = dllListFile;
 		}
+		else if (c == "--load-benchmark")
+		{
+			auto countString = getParamOrDie(argv, i);
+			if (!strToNum(countString, params.loadBenchmarkCount) || params.loadBenchmarkCount == 0)
+				return false;
+		}
 		else if (params.filePath.empty())
 		{
 			params.filePath = argv[i];
@@ -401,6 +418,39 @@ void limitMaximalMemoryIfRequested(const ProgParams& params)
 	}
 }
 
+/**
+* Measures the time needed to load the input file with the individual load profiles.
+* Parts which are loaded lazily are not accessed, so they are not included in the time.
+*/
+int runLoadBenchmark(const ProgParams& params)
+{
+	const std::vector<std::pair<std::string, LoadFlags>> profiles = {
+		{"fileinfo", LoadFlags::PROFILE_FILEINFO},
+		{"unpacker", LoadFlags::PROFILE_UNPACKER},
+		{"decompiler", LoadFlags::PROFILE_DECOMPILER}
+	};
+
+	for (const auto& profile : profiles)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < params.loadBenchmarkCount; ++i)
+		{
+			auto fileParser = createFileFormat(params.filePath, params.dllListFile, false, profile.second);
+			if (!fileParser || !fileParser->isInValidState())
+			{
+				Log::error() << "Error: failed to load " << params.filePath << "\n";
+				return static_cast<int>(ReturnCode::FORMAT_PARSER_PROBLEM);
+			}
+		}
+		std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+		Log::info() << profile.first << ": "
+				<< elapsed.count() / params.loadBenchmarkCount << " ms\n";
+	}
+
+	return static_cast<int>(ReturnCode::OK);
+}
+
 } // anonymous namespace
 
 /**
@@ -421,6 +471,11 @@ int main(int argc, char* argv[])
 
 	limitMaximalMemoryIfRequested(params);
 
+	if(params.loadBenchmarkCount)
+	{
+		return runLoadBenchmark(params);
+	}
+
 	bool useConfig = true;
 	retdec::config::Config config;
 	if(params.generateConfigFile && !params.configFile.empty())
@@ -0,0 +1,193 @@
+/**
+* @file src/hlltokens/binary_token_reader.cpp
+* @brief Reader of the binary format of the emitted high-level code.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <cstring>
+
+#include "retdec/hlltokens/binary_format.h"
+#include "retdec/hlltokens/binary_token_reader.h"
+#include "retdec/utils/mapped_file.h"
+
+using namespace retdec::hlltokens::binary_format;
+
+namespace retdec {
+namespace hlltokens {
+
+BinaryTokenReader::BinaryTokenReader() = default;
+
+BinaryTokenReader::~BinaryTokenReader() = default;
+
+/**
+ * Opens the given file. The file is mapped into memory when possible.
+ *
+ * @throw BinaryTokenReaderError When the file cannot be opened or it is not
+ *                               in the binary token format.
+ */
+void BinaryTokenReader::openFile(const std::string& filePath)
+{
+	auto file = std::make_unique<utils::MappedFile>();
+	if (!file->open(filePath))
+	{
+		throw BinaryTokenReaderError("failed to open " + filePath);
+	}
+
+	openBuffer(file->getData(), file->getSize());
+	_file = std::move(file);
+}
+
+/**
+ * Opens the given data. They have to stay valid while the reader is used.
+ *
+ * @throw BinaryTokenReaderError When the data are not in the binary token
+ *                               format.
+ */
+void BinaryTokenReader::openBuffer(const std::uint8_t* data, std::size_t size)
+{
+	_file.reset();
+	_data = nullptr;
+	_size = 0;
+	_offset = 0;
+	_finished = false;
+	_strings.clear();
+	_lastAddress = 0;
+
+	if (size < HEADER_SIZE
+			|| std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+	{
+		throw BinaryTokenReaderError("not a binary token file");
+	}
+	if (data[sizeof(MAGIC)] != VERSION)
+	{
+		throw BinaryTokenReaderError("unsupported version of binary tokens");
+	}
+
+	_data = data;
+	_size = size;
+	_offset = HEADER_SIZE;
+}
+
+bool BinaryTokenReader::isOpen() const
+{
+	return _data != nullptr;
+}
+
+/**
+ * Reads the next entry of the token sequence.
+ *
+ * @return @c false if there are no more entries (the end entry has already
+ *         been returned), @c true otherwise.
+ *
+ * @throw BinaryTokenReaderError When the data are malformed or truncated.
+ */
+bool BinaryTokenReader::next(TokenEntry& entry)
+{
+	if (!isOpen() || _finished)
+	{
+		return false;
+	}
+
+	auto opcode = readU8();
+	// Opcodes with both type bits set are not tokens.
+	if ((opcode & TOKEN_TYPE_MASK) != TOKEN_TYPE_MASK)
+	{
+		unsigned kind = opcode & TOKEN_KIND_MASK;
+		if (kind >= TOKEN_KIND_COUNT)
+		{
+			throw BinaryTokenReaderError("invalid token kind");
+		}
+		entry.type = TokenEntry::Type::Token;
+		entry.kind = static_cast<TokenKind>(kind);
+
+		switch (opcode & TOKEN_TYPE_MASK)
+		{
+			case TOKEN_REF:
+			{
+				auto index = readVarint();
+				if (index >= _strings.size())
+				{
+					throw BinaryTokenReaderError("invalid string reference");
+				}
+				entry.value = _strings[index];
+				break;
+			}
+			case TOKEN_NEW:
+				entry.value = readString();
+				_strings.push_back(entry.value);
+				break;
+			default: // TOKEN_INLINE
+				entry.value = readString();
+				break;
+		}
+		return true;
+	}
+
+	switch (opcode)
+	{
+		case ADDRESS:
+		{
+			// Undo the zig-zag encoding of the difference.
+			auto diff = readVarint();
+			auto delta = (diff >> 1) ^ (~(diff & 1) + 1);
+			_lastAddress += delta;
+			entry.type = TokenEntry::Type::Address;
+			entry.address = _lastAddress;
+			entry.addressDefined = true;
+			return true;
+		}
+		case ADDRESS_UNDEFINED:
+			entry.type = TokenEntry::Type::Address;
+			entry.address = 0;
+			entry.addressDefined = false;
+			return true;
+		case END:
+			entry.type = TokenEntry::Type::End;
+			entry.value = readString();
+			_finished = true;
+			return true;
+		default:
+			throw BinaryTokenReaderError("invalid record");
+	}
+}
+
+std::uint8_t BinaryTokenReader::readU8()
+{
+	checkBounds(1);
+	return _data[_offset++];
+}
+
+std::uint64_t BinaryTokenReader::readVarint()
+{
+	std::uint64_t res = 0;
+	for (unsigned shift = 0; shift < 64; shift += 7)
+	{
+		auto byte = readU8();
+		res |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0)
+		{
+			return res;
+		}
+	}
+	throw BinaryTokenReaderError("invalid number");
+}
+
+std::string_view BinaryTokenReader::readString()
+{
+	auto size = readVarint();
+	checkBounds(size);
+	std::string_view str(reinterpret_cast<const char*>(_data + _offset), size);
+	_offset += size;
+	return str;
+}
+
+void BinaryTokenReader::checkBounds(std::size_t size) const
+{
+	if (size > _size - _offset)
+	{
+		throw BinaryTokenReaderError("unexpected end of binary tokens");
+	}
+}
+
+} // namespace hlltokens
+} // namespace retdec
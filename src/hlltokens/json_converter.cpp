@@ -0,0 +1,105 @@
+/**
+* @file src/hlltokens/json_converter.cpp
+* @brief Conversion of the binary format of the emitted high-level code into
+*        JSON.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <rapidjson/encodings.h>
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/writer.h>
+
+#include "retdec/hlltokens/binary_token_reader.h"
+#include "retdec/hlltokens/json_converter.h"
+#include "retdec/utils/conversion.h"
+
+namespace retdec {
+namespace hlltokens {
+
+namespace {
+
+const std::string JSON_KEY_LANGUAGE        = "language";
+const std::string JSON_KEY_ADDRESS         = "addr";
+const std::string JSON_KEY_TOKENS          = "tokens";
+const std::string JSON_KEY_KIND            = "kind";
+const std::string JSON_KEY_VALUE           = "val";
+
+template <typename Writer>
+void writeJson(BinaryTokenReader& reader, Writer& writer)
+{
+	writer.StartObject();
+
+	writer.String(JSON_KEY_TOKENS);
+	writer.StartArray();
+
+	std::string_view language;
+	TokenEntry entry;
+	while (reader.next(entry))
+	{
+		switch (entry.type)
+		{
+			case TokenEntry::Type::Token:
+			{
+				writer.StartObject();
+				auto kind = getTokenKindName(entry.kind);
+				writer.String(JSON_KEY_KIND);
+				writer.String(kind.data(), kind.size());
+				writer.String(JSON_KEY_VALUE);
+				writer.String(entry.value.data(), entry.value.size());
+				writer.EndObject();
+				break;
+			}
+			case TokenEntry::Type::Address:
+				writer.StartObject();
+				writer.String(JSON_KEY_ADDRESS);
+				writer.String(entry.addressDefined
+						? "0x" + utils::intToHexString(entry.address)
+						: "");
+				writer.EndObject();
+				break;
+			case TokenEntry::Type::End:
+				language = entry.value;
+				break;
+		}
+	}
+
+	writer.EndArray();
+
+	writer.String(JSON_KEY_LANGUAGE);
+	writer.String(language.data(), language.size());
+
+	writer.EndObject();
+}
+
+} // anonymous namespace
+
+/**
+ * Converts tokens read by the given reader into JSON that is identical to
+ * the output of the JSON output manager of llvmir2hll.
+ *
+ * @param[in] reader Opened reader.
+ * @param[out] out Output stream.
+ * @param[in] pretty Generate human-readable JSON (like the @c json-human
+ *                   output format)?
+ *
+ * @throw BinaryTokenReaderError When the data are malformed or truncated.
+ */
+void convertToJson(BinaryTokenReader& reader, std::ostream& out, bool pretty)
+{
+	rapidjson::OStreamWrapper stream(out);
+	if (pretty)
+	{
+		rapidjson::PrettyWriter<rapidjson::OStreamWrapper, rapidjson::ASCII<>> writer(stream);
+		writeJson(reader, writer);
+	}
+	else
+	{
+		rapidjson::Writer<rapidjson::OStreamWrapper, rapidjson::ASCII<>> writer(stream);
+		writeJson(reader, writer);
+	}
+	stream.Flush();
+}
+
+} // namespace hlltokens
+} // namespace retdec
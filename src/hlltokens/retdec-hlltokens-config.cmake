@@ -0,0 +1,11 @@
+
+if(NOT TARGET retdec::hlltokens)
+    find_package(retdec @PROJECT_VERSION@
+        REQUIRED
+        COMPONENTS
+            utils
+            rapidjson
+    )
+
+    include(${CMAKE_CURRENT_LIST_DIR}/retdec-hlltokens-targets.cmake)
+endif()
@@ -0,0 +1,61 @@
+/**
+* @file src/hlltokens/token_kind.cpp
+* @brief Kinds of tokens of the emitted high-level code.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <iterator>
+
+#include "retdec/hlltokens/token_kind.h"
+
+namespace retdec {
+namespace hlltokens {
+
+namespace {
+
+/**
+ * Names of token kinds, indexed by TokenKind.
+ */
+constexpr std::string_view TOKEN_KIND_NAMES[] =
+{
+	"nl",      // TokenKind::NewLine
+	"ws",      // TokenKind::Space
+	"punc",    // TokenKind::Punctuation
+	"op",      // TokenKind::Operator
+	"i_gvar",  // TokenKind::GlobalVariableId
+	"i_lvar",  // TokenKind::LocalVariableId
+	"i_mem",   // TokenKind::MemberId
+	"i_lab",   // TokenKind::LabelId
+	"i_fnc",   // TokenKind::FunctionId
+	"i_arg",   // TokenKind::ParameterId
+	"keyw",    // TokenKind::Keyword
+	"type",    // TokenKind::DataType
+	"preproc", // TokenKind::Preprocessor
+	"inc",     // TokenKind::Include
+	"l_bool",  // TokenKind::ConstantBool
+	"l_int",   // TokenKind::ConstantInt
+	"l_fp",    // TokenKind::ConstantFloat
+	"l_str",   // TokenKind::ConstantString
+	"l_sym",   // TokenKind::ConstantSymbol
+	"l_ptr",   // TokenKind::ConstantPointer
+	"cmnt",    // TokenKind::Comment
+};
+
+static_assert(
+	std::size(TOKEN_KIND_NAMES) == TOKEN_KIND_COUNT,
+	"every token kind has to have its name"
+);
+
+} // anonymous namespace
+
+/**
+ * Returns the name of the given token kind, which is used as the token kind
+ * in the JSON output (e.g. @c "i_fnc" for TokenKind::FunctionId).
+ */
+std::string_view getTokenKindName(TokenKind kind)
+{
+	return TOKEN_KIND_NAMES[static_cast<std::size_t>(kind)];
+}
+
+} // namespace hlltokens
+} // namespace retdec
@@ -11,6 +11,7 @@
 #include "retdec/llvmir2hll/hll/bracket_manager.h"
 #include "retdec/llvmir2hll/hll/hll_writer.h"
 #include "retdec/llvmir2hll/hll/output_manager.h"
+#include "retdec/llvmir2hll/hll/output_managers/binary_manager.h"
 #include "retdec/llvmir2hll/hll/output_managers/json_manager.h"
 #include "retdec/llvmir2hll/hll/output_managers/plain_manager.h"
 #include "retdec/llvmir2hll/ir/array_type.h"
@@ -152,6 +153,8 @@ HLLWriter::HLLWriter(llvm::raw_ostream &o, const std::string& outputFormat):
 		out = UPtr<OutputManager>(new JsonOutputManagerPlain(o));
 	} else if (outputFormat == "json-human") {
 		out = UPtr<OutputManager>(new JsonOutputManagerPretty(o));
+	} else if (outputFormat == "binary") {
+		out = UPtr<OutputManager>(new BinaryOutputManager(o));
 	} else {
 		out = UPtr<OutputManager>(new PlainOutputManager(o));
 	}
@@ -40,7 +40,7 @@ const std::string& OutputManager::getOutputLanguage() const
 }
 
 void OutputManager::operatorX(
-	const std::string& op,
+	std::string_view op,
 	bool spaceBefore,
 	bool spaceAfter)
 {
@@ -56,8 +56,8 @@ void OutputManager::operatorX(
 }
 
 void OutputManager::comment(
-	const std::string& c,
-	const std::string& indent)
+	std::string_view c,
+	std::string_view indent)
 {
 	if (!indent.empty())
 	{
@@ -67,17 +67,17 @@ void OutputManager::comment(
 }
 
 void OutputManager::commentLine(
-	const std::string& c,
-	const std::string& indent)
+	std::string_view c,
+	std::string_view indent)
 {
 	comment(c, indent);
 	newLine();
 }
 
 void OutputManager::includeLine(
-	const std::string& header,
-	const std::string& indent,
-	const std::string& c)
+	std::string_view header,
+	std::string_view indent,
+	std::string_view c)
 {
 	if (!indent.empty())
 	{
@@ -91,9 +91,9 @@ void OutputManager::includeLine(
 }
 
 void OutputManager::typedefLine(
-	const std::string& indent,
-	const std::string& t1,
-	const std::string& t2)
+	std::string_view indent,
+	std::string_view t1,
+	std::string_view t2)
 {
 	if (!indent.empty())
 	{
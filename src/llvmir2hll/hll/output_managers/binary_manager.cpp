@@ -0,0 +1,110 @@
+/**
+* @file src/llvmir2hll/hll/output_managers/binary_manager.cpp
+* @brief Implementation of BinaryOutputManager.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/hlltokens/binary_format.h"
+#include "retdec/llvmir2hll/hll/output_managers/binary_manager.h"
+
+using namespace retdec::hlltokens::binary_format;
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/**
+ * Should values of tokens of the given kind be stored in the string table?
+ * Comments and string literals rarely repeat, so storing them would only
+ * waste memory.
+ */
+bool isInterned(TokenKind k)
+{
+	return k != TokenKind::Comment && k != TokenKind::ConstantString;
+}
+
+} // anonymous namespace
+
+BinaryOutputManager::BinaryOutputManager(llvm::raw_ostream& out) :
+		_out(out)
+{
+	_out.write(MAGIC, sizeof(MAGIC));
+	writeByte(VERSION);
+
+	addressPush(Address::Undefined);
+}
+
+void BinaryOutputManager::finalize()
+{
+	writeByte(END);
+	writeString(getOutputLanguage());
+}
+
+void BinaryOutputManager::generateToken(TokenKind k, std::string_view v)
+{
+	auto kind = static_cast<std::uint8_t>(k);
+	if (!isInterned(k))
+	{
+		writeByte(TOKEN_INLINE | kind);
+		writeString(v);
+		return;
+	}
+
+	auto it = _stringIndexes.find(v);
+	if (it != _stringIndexes.end())
+	{
+		writeByte(TOKEN_REF | kind);
+		writeVarint(it->second);
+		return;
+	}
+
+	const auto& str = _strings.emplace_back(v);
+	_stringIndexes.emplace(str, _strings.size() - 1);
+	writeByte(TOKEN_NEW | kind);
+	writeString(v);
+}
+
+void BinaryOutputManager::generateAddressEntry(Address a)
+{
+	if (a.isUndefined())
+	{
+		writeByte(ADDRESS_UNDEFINED);
+		return;
+	}
+
+	// Zig-zag encoding of the difference keeps small negative differences
+	// small.
+	std::uint64_t diff = a.getValue() - _lastAddress;
+	std::uint64_t negative = diff >> 63;
+	writeByte(ADDRESS);
+	writeVarint((diff << 1) ^ (~negative + 1));
+	_lastAddress = a.getValue();
+}
+
+void BinaryOutputManager::writeByte(std::uint8_t b)
+{
+	_out << static_cast<char>(b);
+}
+
+void BinaryOutputManager::writeVarint(std::uint64_t n)
+{
+	char buffer[10];
+	std::size_t size = 0;
+	do
+	{
+		std::uint8_t b = n & 0x7f;
+		n >>= 7;
+		buffer[size++] = static_cast<char>(n != 0 ? b | 0x80 : b);
+	} while (n != 0);
+	_out.write(buffer, size);
+}
+
+void BinaryOutputManager::writeString(std::string_view str)
+{
+	writeVarint(str.size());
+	_out.write(str.data(), str.size());
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -21,9 +21,9 @@ void PlainOutputManager::newLine()
 	_out << "\n";
 }
 
-void PlainOutputManager::space(const std::string& space)
+void PlainOutputManager::space(std::string_view space)
 {
-	_out << space;
+	_out.write(space.data(), space.size());
 }
 
 void PlainOutputManager::punctuation(char p)
@@ -31,98 +31,100 @@ void PlainOutputManager::punctuation(char p)
 	_out << p;
 }
 
-void PlainOutputManager::operatorX(const std::string& op)
+void PlainOutputManager::operatorX(std::string_view op)
 {
-	_out << op;
+	_out.write(op.data(), op.size());
 }
 
-void PlainOutputManager::globalVariableId(const std::string& id)
+void PlainOutputManager::globalVariableId(std::string_view id)
 {
-	_out << id;
+	_out.write(id.data(), id.size());
 }
 
-void PlainOutputManager::localVariableId(const std::string& id)
+void PlainOutputManager::localVariableId(std::string_view id)
 {
-	_out << id;
+	_out.write(id.data(), id.size());
 }
 
-void PlainOutputManager::memberId(const std::string& id)
+void PlainOutputManager::memberId(std::string_view id)
 {
-	_out << id;
+	_out.write(id.data(), id.size());
 }
 
-void PlainOutputManager::labelId(const std::string& id)
+void PlainOutputManager::labelId(std::string_view id)
 {
-	_out << id;
+	_out.write(id.data(), id.size());
 }
 
-void PlainOutputManager::functionId(const std::string& id)
+void PlainOutputManager::functionId(std::string_view id)
 {
-	_out << id;
+	_out.write(id.data(), id.size());
 }
 
-void PlainOutputManager::parameterId(const std::string& id)
+void PlainOutputManager::parameterId(std::string_view id)
 {
-	_out << id;
+	_out.write(id.data(), id.size());
 }
 
-void PlainOutputManager::keyword(const std::string& k)
+void PlainOutputManager::keyword(std::string_view k)
 
 {
-	_out << k;
+	_out.write(k.data(), k.size());
 }
 
-void PlainOutputManager::dataType(const std::string& t)
+void PlainOutputManager::dataType(std::string_view t)
 {
-	_out << t;
+	_out.write(t.data(), t.size());
 }
 
-void PlainOutputManager::preprocessor(const std::string& p)
+void PlainOutputManager::preprocessor(std::string_view p)
 {
-	_out << p;
+	_out.write(p.data(), p.size());
 }
 
-void PlainOutputManager::include(const std::string& i)
+void PlainOutputManager::include(std::string_view i)
 {
-	_out << "<" << i << ">";
+	_out << "<";
+	_out.write(i.data(), i.size());
+	_out << ">";
 }
 
-void PlainOutputManager::constantBool(const std::string& c)
+void PlainOutputManager::constantBool(std::string_view c)
 {
-	_out << c;
+	_out.write(c.data(), c.size());
 }
 
-void PlainOutputManager::constantInt(const std::string& c)
+void PlainOutputManager::constantInt(std::string_view c)
 {
-	_out << c;
+	_out.write(c.data(), c.size());
 }
 
-void PlainOutputManager::constantFloat(const std::string& c)
+void PlainOutputManager::constantFloat(std::string_view c)
 {
-	_out << c;
+	_out.write(c.data(), c.size());
 }
 
-void PlainOutputManager::constantString(const std::string& c)
+void PlainOutputManager::constantString(std::string_view c)
 {
-	_out << c;
+	_out.write(c.data(), c.size());
 }
 
-void PlainOutputManager::constantSymbol(const std::string& c)
+void PlainOutputManager::constantSymbol(std::string_view c)
 {
-	_out << c;
+	_out.write(c.data(), c.size());
 }
 
-void PlainOutputManager::constantPointer(const std::string& c)
+void PlainOutputManager::constantPointer(std::string_view c)
 {
-	_out << c;
+	_out.write(c.data(), c.size());
 }
 
-void PlainOutputManager::comment(const std::string& c)
+void PlainOutputManager::comment(std::string_view c)
 {
 	_out << getCommentPrefix();
 	if (!c.empty())
 	{
-		_out << " " << utils::replaceCharsWithStrings(c, '\n', " ");
+		_out << " " << utils::replaceCharsWithStrings(std::string(c), '\n', " ");
 	}
 }
 
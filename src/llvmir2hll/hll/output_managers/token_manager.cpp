@@ -0,0 +1,252 @@
+/**
+* @file src/llvmir2hll/hll/output_managers/token_manager.cpp
+* @brief Implementation of TokenOutputManager.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/hll/output_managers/token_manager.h"
+#include "retdec/utils/string.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/**
+ * We don't like macros, but we potentially need to return from methods calling
+ * this helper routine, so we use it here anyway.
+ * \param val Anything that can be concatenated (+) to a std::string.
+ */
+#define HANDLE_COMMENT_MODIFIER(val)                 \
+{                                                    \
+	if (_commentModifierOn)                          \
+	{                                                \
+		_runningComment += val;                      \
+		return;                                      \
+	}                                                \
+}
+
+} // anonymous namespace
+
+void TokenOutputManager::newLine()
+{
+	if (_commentModifierOn)
+	{
+		// Clear it righ away because comment() is used to generate token
+		// and it checks for it.
+		_commentModifierOn = false;
+		if (!_runningComment.empty())
+		{
+			comment(_runningComment);
+			_runningComment.clear();
+		}
+	}
+
+	token(TokenKind::NewLine, "\n");
+}
+
+void TokenOutputManager::space(std::string_view space)
+{
+	HANDLE_COMMENT_MODIFIER(space);
+	token(TokenKind::Space, space);
+}
+
+void TokenOutputManager::punctuation(char p)
+{
+	HANDLE_COMMENT_MODIFIER(p);
+	token(TokenKind::Punctuation, std::string_view(&p, 1));
+}
+
+void TokenOutputManager::operatorX(std::string_view op)
+{
+	HANDLE_COMMENT_MODIFIER(op);
+	token(TokenKind::Operator, op);
+}
+
+void TokenOutputManager::globalVariableId(std::string_view id)
+{
+	HANDLE_COMMENT_MODIFIER(id);
+	token(TokenKind::GlobalVariableId, id);
+}
+
+void TokenOutputManager::localVariableId(std::string_view id)
+{
+	HANDLE_COMMENT_MODIFIER(id);
+	token(TokenKind::LocalVariableId, id);
+}
+
+void TokenOutputManager::memberId(std::string_view id)
+{
+	HANDLE_COMMENT_MODIFIER(id);
+	token(TokenKind::MemberId, id);
+}
+
+void TokenOutputManager::labelId(std::string_view id)
+{
+	HANDLE_COMMENT_MODIFIER(id);
+	token(TokenKind::LabelId, id);
+}
+
+void TokenOutputManager::functionId(std::string_view id)
+{
+	HANDLE_COMMENT_MODIFIER(id);
+	token(TokenKind::FunctionId, id);
+}
+
+void TokenOutputManager::parameterId(std::string_view id)
+{
+	HANDLE_COMMENT_MODIFIER(id);
+	token(TokenKind::ParameterId, id);
+}
+
+void TokenOutputManager::keyword(std::string_view k)
+{
+	HANDLE_COMMENT_MODIFIER(k);
+	token(TokenKind::Keyword, k);
+}
+
+void TokenOutputManager::dataType(std::string_view t)
+{
+	HANDLE_COMMENT_MODIFIER(t);
+	token(TokenKind::DataType, t);
+}
+
+void TokenOutputManager::preprocessor(std::string_view p)
+{
+	HANDLE_COMMENT_MODIFIER(p);
+	token(TokenKind::Preprocessor, p);
+}
+
+void TokenOutputManager::include(std::string_view i)
+{
+	HANDLE_COMMENT_MODIFIER(i);
+	token(TokenKind::Include, "<" + std::string(i) + ">");
+}
+
+void TokenOutputManager::constantBool(std::string_view c)
+{
+	HANDLE_COMMENT_MODIFIER(c);
+	token(TokenKind::ConstantBool, c);
+}
+
+void TokenOutputManager::constantInt(std::string_view c)
+{
+	HANDLE_COMMENT_MODIFIER(c);
+	token(TokenKind::ConstantInt, c);
+}
+
+void TokenOutputManager::constantFloat(std::string_view c)
+{
+	HANDLE_COMMENT_MODIFIER(c);
+	token(TokenKind::ConstantFloat, c);
+}
+
+void TokenOutputManager::constantString(std::string_view c)
+{
+	HANDLE_COMMENT_MODIFIER(c);
+	token(TokenKind::ConstantString, c);
+}
+
+void TokenOutputManager::constantSymbol(std::string_view c)
+{
+	HANDLE_COMMENT_MODIFIER(c);
+	token(TokenKind::ConstantSymbol, c);
+}
+
+void TokenOutputManager::constantPointer(std::string_view c)
+{
+	HANDLE_COMMENT_MODIFIER(c);
+	token(TokenKind::ConstantPointer, c);
+}
+
+void TokenOutputManager::comment(std::string_view c)
+{
+	HANDLE_COMMENT_MODIFIER(" " + std::string(c));
+	std::string str = getCommentPrefix();
+	if (!c.empty())
+	{
+		str += " " + utils::replaceCharsWithStrings(std::string(c), '\n', " ");
+	}
+	token(TokenKind::Comment, str);
+}
+
+void TokenOutputManager::commentModifier()
+{
+	_commentModifierOn = true;
+}
+
+void TokenOutputManager::addressPush(Address a)
+{
+	bool generate = true;
+
+	// Always generate the first pushed address so that first tokens are
+	// associated with something.
+	if (_addrs.empty())
+	{
+		generate = true;
+	}
+	// Do not generate address changes while in comment modifier mode.
+	// A single comment token is generated for all the stuff added in this mode
+	// and we cannot associate its individual parts with addresses.
+	else if (_commentModifierOn)
+	{
+		generate = false;
+	}
+	// Do not generate address if it is the same as the current top address.
+	// It is unnecessary.
+	else if (a == _addrs.top().first)
+	{
+		generate = false;
+	}
+
+	// Always do the push.
+	_addrs.push({a, generate});
+
+	if (generate)
+	{
+		generateAddressEntry(a);
+		_addrToGenerate = std::make_pair(Address::Undefined, false);
+	}
+}
+
+void TokenOutputManager::addressPop()
+{
+	// Never pop the last entry.
+	if (_addrs.size() < 2)
+	{
+		return;
+	}
+
+	bool generated = _addrs.top().second;
+
+	// Always do the pop.
+	_addrs.pop();
+
+	// If the popped entry was generated, re-generate the last entry.
+	if (generated)
+	{
+		// Well actually, do not generate it right away because it is possible
+		// that the next address is going to get pushed before the next token
+		// is added, and therefore it would be unnecessary to re-generate the
+		// address if no token actually was associated with it.
+		_addrToGenerate = std::make_pair(_addrs.top().first, true);
+	}
+}
+
+/**
+ * Generates the given token. If there is a pending address entry, it is
+ * generated first.
+ */
+void TokenOutputManager::token(TokenKind k, std::string_view v)
+{
+	if (_addrToGenerate.second)
+	{
+		generateAddressEntry(_addrToGenerate.first);
+		_addrToGenerate = std::make_pair(Address::Undefined, false);
+	}
+
+	generateToken(k, v);
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
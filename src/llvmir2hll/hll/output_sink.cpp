@@ -0,0 +1,41 @@
+/**
+* @file src/llvmir2hll/hll/output_sink.cpp
+* @brief Implementation of OutputSinkStream.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/hll/output_sink.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+OutputSinkStream::OutputSinkStream(OutputSink sink, std::size_t chunkSize) :
+		_sink(std::move(sink))
+{
+	SetBufferSize(chunkSize);
+}
+
+OutputSinkStream::~OutputSinkStream()
+{
+	// raw_ostream requires subclasses to flush the buffer themselves.
+	flush();
+}
+
+void OutputSinkStream::write_impl(const char* ptr, std::size_t size)
+{
+	if (size == 0)
+	{
+		return;
+	}
+
+	_sink(std::string_view(ptr, size));
+	_pos += size;
+}
+
+uint64_t OutputSinkStream::current_pos() const
+{
+	return _pos;
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
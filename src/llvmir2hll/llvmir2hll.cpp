@@ -140,6 +140,18 @@ void LlvmIr2Hll::setOutputString(std::string* outString)
 	}
 }
 
+/**
+* @brief Passes the generated code to @a outSink in chunks while it is being
+*        emitted (instead of writing it into the output file).
+*/
+void LlvmIr2Hll::setOutputSink(const llvmir2hll::OutputSink* outSink)
+{
+	if (outSink)
+	{
+		outSinkStream = std::make_unique<llvmir2hll::OutputSinkStream>(*outSink);
+	}
+}
+
 void LlvmIr2Hll::getAnalysisUsage(llvm::AnalysisUsage &au) const
 {
 	au.addRequired<llvm::LoopInfoWrapperPass>();
@@ -264,18 +276,22 @@ bool LlvmIr2Hll::initialize(llvm::Module &m)
 	}
 
 	// Instantiate the requested HLL writer and make sure it exists. We need to
-	// explicitly specify template parameters because raw_pwrite_stream has
-	// a private copy constructor, so it needs to be passed by reference.
+	// explicitly specify template parameters because raw_ostream has a
+	// private copy constructor, so it needs to be passed by reference.
 	Log::phase(
 		"creating the used HLL writer [" + TargetHLL + "]",
 		Log::SubPhase
 	);
 
 	// Output stream into which the generated code will be emitted.
+	raw_ostream* out = nullptr;
 	if (outStringStream)
 	{
-		hllWriter = llvmir2hll::HLLWriterFactory::getInstance().createObject<
-		raw_string_ostream &>(TargetHLL, *outStringStream, globalConfig->parameters.getOutputFormat());
+		out = outStringStream.get();
+	}
+	else if (outSinkStream)
+	{
+		out = outSinkStream.get();
 	}
 	else
 	{
@@ -284,11 +300,14 @@ bool LlvmIr2Hll::initialize(llvm::Module &m)
 		{
 			return false;
 		}
-
-		hllWriter = llvmir2hll::HLLWriterFactory::getInstance().createObject<
-		raw_pwrite_stream &>(TargetHLL, outFile->os(), globalConfig->parameters.getOutputFormat());
+		// Write the code in larger chunks than the default buffer allows.
+		outFile->os().SetBufferSize(llvmir2hll::OutputSinkStream::DEFAULT_CHUNK_SIZE);
+		out = &outFile->os();
 	}
 
+	hllWriter = llvmir2hll::HLLWriterFactory::getInstance().createObject<
+	raw_ostream &>(TargetHLL, *out, globalConfig->parameters.getOutputFormat());
+
 	if (!hllWriter)
 	{
 		printErrorUnsupportedObject<llvmir2hll::HLLWriterFactory>(
@@ -688,6 +707,7 @@ void LlvmIr2Hll::finalize()
 {
 	saveConfig();
 	if (outFile) outFile->keep();
+	if (outSinkStream) outSinkStream->flush();
 }
 
 /**
@@ -4,6 +4,7 @@ if(NOT TARGET retdec::llvmir2hll)
         REQUIRED
         COMPONENTS
             config
+            hlltokens
             utils
             rapidjson
             llvm
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_c_header_file_for_func.h"
 
 namespace retdec {
@@ -11,13 +13,19 @@ namespace llvmir2hll {
 namespace semantics {
 
 /**
-* @brief Returns the header name for the given function from the given map.
+* @brief Returns the header name for the given function from the given sorted
+*        table.
 */
-std::optional<std::string> getCHeaderFileForFuncFromMap(
+std::optional<std::string> getCHeaderFileForFuncFromTable(
 		const std::string &funcName,
-		const StringStringUMap &map) {
-	auto i = map.find(funcName);
-	return i != map.end() ? std::optional<std::string>(i->second) : std::nullopt;
+		const FuncCHeaderTable &table) {
+	auto it = std::lower_bound(table.begin(), table.end(), funcName,
+		[](const FuncCHeader &h, const std::string &name) {
+			return h.funcName < name;
+		}
+	);
+	return it != table.end() && it->funcName == funcName ?
+		std::optional<std::string>(it->header) : std::nullopt;
 }
 
 } // namespace semantics
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
 
 namespace retdec {
@@ -11,13 +13,17 @@ namespace llvmir2hll {
 namespace semantics {
 
 /**
-* @brief Returns the name of the given parameter from the given map.
+* @brief Returns the name of the given parameter from the given sorted table.
 */
-std::optional<std::string> getNameOfParamFromMap(const std::string &funcName,
-		unsigned paramPos, const FuncParamNamesMap &map) {
-	auto funcParamIter = map.find(FuncParamPosPair(funcName, paramPos));
-	return funcParamIter != map.end() ?
-		std::optional<std::string>(funcParamIter->second) : std::nullopt;
+std::optional<std::string> getNameOfParamFromTable(const std::string &funcName,
+		unsigned paramPos, const FuncParamNamesTable &table) {
+	FuncParamName key{funcName, paramPos, {}};
+	auto it = std::lower_bound(table.begin(), table.end(), key);
+	if (it == table.end() || it->funcName != funcName
+			|| it->paramPos != paramPos) {
+		return std::nullopt;
+	}
+	return std::string(it->paramName);
 }
 
 } // namespace semantics
@@ -15,3855 +15,3824 @@ namespace win_api {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_C_HEADER_MAP later in the
-*        file.
-*/
-const StringStringUMap &initFuncCHeaderMap() {
-	static StringStringUMap m;
-
-	// ctype.h
-	static const char *CTYPE_H_FUNCS[] = {
-		"_isctype",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(CTYPE_H_FUNCS, "ctype.h", m);
-
-	// stdlib.h
-	static const char *STDLIB_H_FUNCS[] = {
-		"_Exit",
-		"__doserrno",
-		"__p___argc",
-		"__p___argv",
-		"__p___wargv",
-		"__p__environ",
-		"__p__osver",
-		"__p__pgmptr",
-		"__p__wenviron",
-		"__p__winmajor",
-		"__p__winminor",
-		"__p__winver",
-		"__p__wpgmptr",
-		"__strtod",
-		"_atoi64",
-		"_beep",
-		"_ecvt",
-		"_errno",
-		"_exit",
-		"_fcvt",
-		"_fullpath",
-		"_gcvt",
-		"_i64toa",
-		"_i64tow",
-		"_itoa",
-		"_itow",
-		"_lrotl",
-		"_lrotr",
-		"_ltoa",
-		"_ltow",
-		"_makepath",
-		"_onexit",
-		"_putenv",
-		"_rotl",
-		"_rotr",
-		"_searchenv",
-		"_set_error_mode",
-		"_seterrormode",
-		"_sleep",
-		"_splitpath",
-		"_ui64toa",
-		"_ui64tow",
-		"_ultoa",
-		"_ultow",
-		"_wfullpath",
-		"_wgetenv",
-		"_wmakepath",
-		"_wputenv",
-		"_wsearchenv",
-		"_wsplitpath",
-		"_wsystem",
-		"_wtof",
-		"_wtoi",
-		"_wtoi64",
-		"_wtol",
-		"abort",
-		"abs",
-		"atof",
-		"atoi",
-		"atol",
-		"atoll",
-		"calloc",
-		"div",
-		"ecvt",
-		"exit",
-		"fcvt",
-		"free",
-		"gcvt",
-		"getenv",
-		"int",
-		"itoa",
-		"labs",
-		"ldiv",
-		"llabs",
-		"lldiv",
-		"lltoa",
-		"lltow",
-		"ltoa",
-		"malloc",
-		"mblen",
-		"mbstowcs",
-		"mbtowc",
-		"putenv",
-		"rand",
-		"realloc",
-		"searchenv",
-		"srand",
-		"strtod",
-		"strtof",
-		"strtol",
-		"strtold",
-		"strtoll",
-		"strtoul",
-		"strtoull",
-		"system",
-		"ulltoa",
-		"ulltow",
-		"void",
-		"wcstod",
-		"wcstof",
-		"wcstol",
-		"wcstold",
-		"wcstombs",
-		"wcstoul",
-		"wctomb",
-		"wtoll",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STDLIB_H_FUNCS, "stdlib.h", m);
-
-	// stdio.h
-	static const char *STDIO_H_FUNCS[] = {
-		"_getstdfilex",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STDIO_H_FUNCS, "stdio.h", m);
-
-	// string.h
-	static const char *STRING_H_FUNCS[] = {
-		"_memccpy",
-		"_memicmp",
-		"_strcmpi",
-		"_strdup",
-		"_strerror",
-		"_stricmp",
-		"_stricoll",
-		"_strlwr",
-		"_strncoll",
-		"_strnicmp",
-		"_strnicoll",
-		"_strnset",
-		"_strrev",
-		"_strset",
-		"_strupr",
-		"_swab",
-		"_wcsdup",
-		"_wcsicmp",
-		"_wcsicoll",
-		"_wcslwr",
-		"_wcsncoll",
-		"_wcsnicmp",
-		"_wcsnicoll",
-		"_wcsnset",
-		"_wcsrev",
-		"_wcsset",
-		"_wcsupr",
-		"memccpy",
-		"memchr",
-		"memcmp",
-		"memcpy",
-		"memicmp",
-		"memmove",
-		"memset",
-		"strcasecmp",
-		"strcat",
-		"strchr",
-		"strcmp",
-		"strcmpi",
-		"strcoll",
-		"strcpy",
-		"strcspn",
-		"strdup",
-		"strerror",
-		"stricmp",
-		"stricoll",
-		"strlen",
-		"strlwr",
-		"strncasecmp",
-		"strncat",
-		"strncmp",
-		"strncpy",
-		"strnicmp",
-		"strnset",
-		"strpbrk",
-		"strrchr",
-		"strrev",
-		"strset",
-		"strspn",
-		"strstr",
-		"strtok",
-		"strupr",
-		"strxfrm",
-		"swab",
-		"wcscat",
-		"wcschr",
-		"wcscmp",
-		"wcscmpi",
-		"wcscoll",
-		"wcscpy",
-		"wcscspn",
-		"wcsdup",
-		"wcsicmp",
-		"wcsicoll",
-		"wcslen",
-		"wcslwr",
-		"wcsncat",
-		"wcsncmp",
-		"wcsncpy",
-		"wcsnicmp",
-		"wcsnset",
-		"wcspbrk",
-		"wcsrchr",
-		"wcsrev",
-		"wcsset",
-		"wcsspn",
-		"wcsstr",
-		"wcstok",
-		"wcsupr",
-		"wcsxfrm",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STRING_H_FUNCS, "string.h", m);
-
-	// windows.h
-	static const char *WINDOWS_H_FUNCS[] = {
-		"AbortDoc",
-		"AbortPath",
-		"AbortPrinter",
-		"AbortSystemShutdownA",
-		"AbortSystemShutdownW",
-		"AccessCheck",
-		"AccessCheckAndAuditAlarmA",
-		"AccessCheckAndAuditAlarmW",
-		"ActivateKeyboardLayout",
-		"AddAccessAllowedAce",
-		"AddAccessDeniedAce",
-		"AddAce",
-		"AddAtomA",
-		"AddAtomW",
-		"AddAuditAccessAce",
-		"AddFontResourceA",
-		"AddFontResourceW",
-		"AddFormA",
-		"AddFormW",
-		"AddJobA",
-		"AddJobW",
-		"AddMonitorA",
-		"AddMonitorW",
-		"AddPortA",
-		"AddPortW",
-		"AddPrintProcessorA",
-		"AddPrintProcessorW",
-		"AddPrintProvidorA",
-		"AddPrintProvidorW",
-		"AddPrinterA",
-		"AddPrinterConnectionA",
-		"AddPrinterConnectionW",
-		"AddPrinterDriverA",
-		"AddPrinterDriverW",
-		"AddPrinterW",
-		"AdjustTokenGroups",
-		"AdjustTokenPrivileges",
-		"AdjustWindowRect",
-		"AdjustWindowRectEx",
-		"AdvancedDocumentPropertiesA",
-		"AdvancedDocumentPropertiesW",
-		"AllocConsole",
-		"AllocateAndInitializeSid",
-		"AllocateLocallyUniqueId",
-		"AngleArc",
-		"AnimatePalette",
-		"AnyPopup",
-		"AppendMenuA",
-		"AppendMenuW",
-		"Arc",
-		"ArcTo",
-		"AreAllAccessesGranted",
-		"AreAnyAccessesGranted",
-		"AreFileApisANSI",
-		"ArrangeIconicWindows",
-		"AttachThreadInput",
-		"BackupEventLogA",
-		"BackupEventLogW",
-		"BackupRead",
-		"BackupSeek",
-		"BackupWrite",
-		"Beep",
-		"BeginDeferWindowPos",
-		"BeginPaint",
-		"BeginPath",
-		"BeginUpdateResourceA",
-		"BeginUpdateResourceW",
-		"BindMoniker",
-		"BitBlt",
-		"BringWindowToTop",
-		"BroadcastSystemMessage",
-		"BroadcastSystemMessageA",
-		"BroadcastSystemMessageW",
-		"BstrFromVector",
-		"BuildCommDCBA",
-		"BuildCommDCBAndTimeoutsA",
-		"BuildCommDCBAndTimeoutsW",
-		"BuildCommDCBW",
-		"CLSIDFromProgID",
-		"CLSIDFromString",
-		"CallMsgFilterA",
-		"CallMsgFilterW",
-		"CallNamedPipeA",
-		"CallNamedPipeW",
-		"CallNextHookEx",
-		"CallWindowProcA",
-		"CallWindowProcW",
-		"CancelDC",
-		"CancelDeviceWakeupRequest",
-		"CancelIo",
-		"CancelWaitableTimer",
-		"CascadeWindows",
-		"ChangeClipboardChain",
-		"ChangeDisplaySettingsA",
-		"ChangeDisplaySettingsExA",
-		"ChangeDisplaySettingsExW",
-		"ChangeDisplaySettingsW",
-		"ChangeMenuA",
-		"ChangeMenuW",
-		"ChangeServiceConfig2A",
-		"ChangeServiceConfig2W",
-		"ChangeServiceConfigA",
-		"ChangeServiceConfigW",
-		"CharLowerA",
-		"CharLowerBuffA",
-		"CharLowerBuffW",
-		"CharLowerW",
-		"CharNextA",
-		"CharNextExA",
-		"CharNextW",
-		"CharPrevA",
-		"CharPrevExA",
-		"CharPrevW",
-		"CharToOemA",
-		"CharToOemBuffA",
-		"CharToOemBuffW",
-		"CharToOemW",
-		"CharUpperA",
-		"CharUpperBuffA",
-		"CharUpperBuffW",
-		"CharUpperW",
-		"CheckColorsInGamut",
-		"CheckDlgButton",
-		"CheckMenuItem",
-		"CheckMenuRadioItem",
-		"CheckRadioButton",
-		"ChildWindowFromPoint",
-		"ChildWindowFromPointEx",
-		"ChooseColorA",
-		"ChooseColorW",
-		"ChooseFontA",
-		"ChooseFontW",
-		"ChoosePixelFormat",
-		"Chord",
-		"ClearCommBreak",
-		"ClearCommError",
-		"ClearEventLogA",
-		"ClearEventLogW",
-		"ClientToScreen",
-		"ClipCursor",
-		"CloseClipboard",
-		"CloseDesktop",
-		"CloseDriver",
-		"CloseEnhMetaFile",
-		"CloseEventLog",
-		"CloseFigure",
-		"CloseHandle",
-		"CloseMetaFile",
-		"ClosePrinter",
-		"CloseServiceHandle",
-		"CloseWindow",
-		"CloseWindowStation",
-		"CoAddRefServerProcess",
-		"CoBuildVersion",
-		"CoCopyProxy",
-		"CoCreateFreeThreadedMarshaler",
-		"CoCreateGuid",
-		"CoCreateInstance",
-		"CoCreateInstanceEx",
-		"CoCreateStandardMalloc",
-		"CoDisconnectObject",
-		"CoDosDateTimeToFileTime",
-		"CoFileTimeNow",
-		"CoFileTimeToDosDateTime",
-		"CoFreeAllLibraries",
-		"CoFreeLibrary",
-		"CoFreeUnusedLibraries",
-		"CoGetCallContext",
-		"CoGetClassObject",
-		"CoGetCurrentProcess",
-		"CoGetInstanceFromFile",
-		"CoGetInstanceFromIStorage",
-		"CoGetInterfaceAndReleaseStream",
-		"CoGetMalloc",
-		"CoGetMarshalSizeMax",
-		"CoGetObject",
-		"CoGetPSClsid",
-		"CoGetStandardMarshal",
-		"CoGetStdMarshalEx",
-		"CoGetTreatAsClass",
-		"CoHasStrongExternalConnections",
-		"CoImpersonateClient",
-		"CoInitialize",
-		"CoInitializeEx",
-		"CoInitializeSecurity",
-		"CoIsHandlerConnected",
-		"CoIsOle1Class",
-		"CoLoadLibrary",
-		"CoLockObjectExternal",
-		"CoMarshalHresult",
-		"CoMarshalInterThreadInterfaceInStream",
-		"CoMarshalInterface",
-		"CoQueryAuthenticationServices",
-		"CoQueryClientBlanket",
-		"CoQueryProxyBlanket",
-		"CoRegisterClassObject",
-		"CoRegisterMallocSpy",
-		"CoRegisterMessageFilter",
-		"CoRegisterPSClsid",
-		"CoReleaseMarshalData",
-		"CoReleaseServerProcess",
-		"CoResumeClassObjects",
-		"CoRevertToSelf",
-		"CoRevokeClassObject",
-		"CoRevokeMallocSpy",
-		"CoSetProxyBlanket",
-		"CoSuspendClassObjects",
-		"CoSwitchCallContext",
-		"CoTaskMemAlloc",
-		"CoTaskMemFree",
-		"CoTaskMemRealloc",
-		"CoTreatAsClass",
-		"CoUninitialize",
-		"CoUnmarshalHresult",
-		"CoUnmarshalInterface",
-		"CombineRgn",
-		"CombineTransform",
-		"CommConfigDialogA",
-		"CommConfigDialogW",
-		"CommDlgExtendedError",
-		"CommandLineToArgvW",
-		"CompareFileTime",
-		"CompareStringA",
-		"CompareStringW",
-		"ConfigurePortA",
-		"ConfigurePortW",
-		"ConnectNamedPipe",
-		"ConnectToPrinterDlg",
-		"ContinueDebugEvent",
-		"ControlService",
-		"ConvertDefaultLocale",
-		"ConvertFiberToThread",
-		"ConvertThreadToFiber",
-		"CopyAcceleratorTableA",
-		"CopyAcceleratorTableW",
-		"CopyEnhMetaFileA",
-		"CopyEnhMetaFileW",
-		"CopyFileA",
-		"CopyFileExA",
-		"CopyFileExW",
-		"CopyFileW",
-		"CopyIcon",
-		"CopyImage",
-		"CopyLZFile",
-		"CopyMetaFileA",
-		"CopyMetaFileW",
-		"CopyRect",
-		"CopySid",
-		"CountClipboardFormats",
-		"CreateAcceleratorTableA",
-		"CreateAcceleratorTableW",
-		"CreateAntiMoniker",
-		"CreateBindCtx",
-		"CreateBitmap",
-		"CreateBitmapIndirect",
-		"CreateBrushIndirect",
-		"CreateCaret",
-		"CreateColorSpaceA",
-		"CreateColorSpaceW",
-		"CreateCompatibleBitmap",
-		"CreateCompatibleDC",
-		"CreateConsoleScreenBuffer",
-		"CreateCursor",
-		"CreateDCA",
-		"CreateDCW",
-		"CreateDIBPatternBrush",
-		"CreateDIBPatternBrushPt",
-		"CreateDIBSection",
-		"CreateDIBitmap",
-		"CreateDataAdviseHolder",
-		"CreateDataCache",
-		"CreateDesktopA",
-		"CreateDesktopW",
-		"CreateDialogIndirectParamA",
-		"CreateDialogIndirectParamW",
-		"CreateDialogParamA",
-		"CreateDialogParamW",
-		"CreateDirectoryA",
-		"CreateDirectoryExA",
-		"CreateDirectoryExW",
-		"CreateDirectoryW",
-		"CreateDiscardableBitmap",
-		"CreateDispTypeInfo",
-		"CreateEllipticRgn",
-		"CreateEllipticRgnIndirect",
-		"CreateEnhMetaFileA",
-		"CreateEnhMetaFileW",
-		"CreateErrorInfo",
-		"CreateEventA",
-		"CreateEventW",
-		"CreateFiber",
-		"CreateFiberEx",
-		"CreateFileA",
-		"CreateFileMappingA",
-		"CreateFileMappingW",
-		"CreateFileMoniker",
-		"CreateFileW",
-		"CreateFontA",
-		"CreateFontIndirectA",
-		"CreateFontIndirectW",
-		"CreateFontW",
-		"CreateGenericComposite",
-		"CreateHalftonePalette",
-		"CreateHatchBrush",
-		"CreateICA",
-		"CreateICW",
-		"CreateILockBytesOnHGlobal",
-		"CreateIcon",
-		"CreateIconFromResource",
-		"CreateIconFromResourceEx",
-		"CreateIconIndirect",
-		"CreateIoCompletionPort",
-		"CreateItemMoniker",
-		"CreateMDIWindowA",
-		"CreateMDIWindowW",
-		"CreateMailslotA",
-		"CreateMailslotW",
-		"CreateMenu",
-		"CreateMetaFileA",
-		"CreateMetaFileW",
-		"CreateMutexA",
-		"CreateMutexW",
-		"CreateNamedPipeA",
-		"CreateNamedPipeW",
-		"CreateOleAdviseHolder",
-		"CreatePalette",
-		"CreatePatternBrush",
-		"CreatePen",
-		"CreatePenIndirect",
-		"CreatePipe",
-		"CreatePointerMoniker",
-		"CreatePolyPolygonRgn",
-		"CreatePolygonRgn",
-		"CreatePopupMenu",
-		"CreatePrivateObjectSecurity",
-		"CreateProcessA",
-		"CreateProcessAsUserA",
-		"CreateProcessAsUserW",
-		"CreateProcessW",
-		"CreateRectRgn",
-		"CreateRectRgnIndirect",
-		"CreateRemoteThread",
-		"CreateRoundRectRgn",
-		"CreateScalableFontResourceA",
-		"CreateScalableFontResourceW",
-		"CreateSemaphoreA",
-		"CreateSemaphoreW",
-		"CreateServiceA",
-		"CreateServiceW",
-		"CreateSolidBrush",
-		"CreateStdDispatch",
-		"CreateStreamOnHGlobal",
-		"CreateTapePartition",
-		"CreateThread",
-		"CreateTypeLib",
-		"CreateWaitableTimerA",
-		"CreateWaitableTimerW",
-		"CreateWindowExA",
-		"CreateWindowExW",
-		"CreateWindowStationA",
-		"CreateWindowStationW",
-		"DPtoLP",
-		"DceErrorInqTextA",
-		"DceErrorInqTextW",
-		"DdeAbandonTransaction",
-		"DdeAccessData",
-		"DdeAddData",
-		"DdeClientTransaction",
-		"DdeCmpStringHandles",
-		"DdeConnect",
-		"DdeConnectList",
-		"DdeCreateDataHandle",
-		"DdeCreateStringHandleA",
-		"DdeCreateStringHandleW",
-		"DdeDisconnect",
-		"DdeDisconnectList",
-		"DdeEnableCallback",
-		"DdeFreeDataHandle",
-		"DdeFreeStringHandle",
-		"DdeGetData",
-		"DdeGetLastError",
-		"DdeImpersonateClient",
-		"DdeInitializeA",
-		"DdeInitializeW",
-		"DdeKeepStringHandle",
-		"DdeNameService",
-		"DdePostAdvise",
-		"DdeQueryConvInfo",
-		"DdeQueryNextServer",
-		"DdeQueryStringA",
-		"DdeQueryStringW",
-		"DdeReconnect",
-		"DdeSetQualityOfService",
-		"DdeSetUserHandle",
-		"DdeUnaccessData",
-		"DdeUninitialize",
-		"DebugActiveProcess",
-		"DebugBreak",
-		"DefDlgProcA",
-		"DefDlgProcW",
-		"DefDriverProc",
-		"DefFrameProcA",
-		"DefFrameProcW",
-		"DefMDIChildProcA",
-		"DefMDIChildProcW",
-		"DefWindowProcA",
-		"DefWindowProcW",
-		"DeferWindowPos",
-		"DefineDosDeviceA",
-		"DefineDosDeviceW",
-		"DeleteAce",
-		"DeleteAtom",
-		"DeleteColorSpace",
-		"DeleteCriticalSection",
-		"DeleteDC",
-		"DeleteEnhMetaFile",
-		"DeleteFiber",
-		"DeleteFileA",
-		"DeleteFileW",
-		"DeleteFormA",
-		"DeleteFormW",
-		"DeleteMenu",
-		"DeleteMetaFile",
-		"DeleteMonitorA",
-		"DeleteMonitorW",
-		"DeleteObject",
-		"DeletePortA",
-		"DeletePortW",
-		"DeletePrintProcessorA",
-		"DeletePrintProcessorW",
-		"DeletePrintProvidorA",
-		"DeletePrintProvidorW",
-		"DeletePrinter",
-		"DeletePrinterConnectionA",
-		"DeletePrinterConnectionW",
-		"DeletePrinterDataA",
-		"DeletePrinterDataW",
-		"DeletePrinterDriverA",
-		"DeletePrinterDriverW",
-		"DeleteService",
-		"DeregisterEventSource",
-		"DeregisterShellHookWindow",
-		"DescribePixelFormat",
-		"DestroyAcceleratorTable",
-		"DestroyCaret",
-		"DestroyCursor",
-		"DestroyIcon",
-		"DestroyMenu",
-		"DestroyPrivateObjectSecurity",
-		"DestroyWindow",
-		"DeviceCapabilitiesA",
-		"DeviceCapabilitiesW",
-		"DeviceIoControl",
-		"DialogBoxIndirectParamA",
-		"DialogBoxIndirectParamW",
-		"DialogBoxParamA",
-		"DialogBoxParamW",
-		"DisableThreadLibraryCalls",
-		"DisconnectNamedPipe",
-		"DispGetIDsOfNames",
-		"DispGetParam",
-		"DispInvoke",
-		"DispatchMessageA",
-		"DispatchMessageW",
-		"DlgDirListA",
-		"DlgDirListComboBoxA",
-		"DlgDirListComboBoxW",
-		"DlgDirListW",
-		"DlgDirSelectComboBoxExA",
-		"DlgDirSelectComboBoxExW",
-		"DlgDirSelectExA",
-		"DlgDirSelectExW",
-		"DllCanUnloadNow",
-		"DllGetClassObject",
-		"DoDragDrop",
-		"DocumentPropertiesA",
-		"DocumentPropertiesW",
-		"DosDateTimeToFileTime",
-		"DosDateTimeToVariantTime",
-		"DragAcceptFiles",
-		"DragDetect",
-		"DragFinish",
-		"DragObject",
-		"DragQueryFileA",
-		"DragQueryFileW",
-		"DragQueryPoint",
-		"DrawAnimatedRects",
-		"DrawCaption",
-		"DrawEdge",
-		"DrawEscape",
-		"DrawFocusRect",
-		"DrawFrameControl",
-		"DrawIcon",
-		"DrawIconEx",
-		"DrawMenuBar",
-		"DrawStateA",
-		"DrawStateW",
-		"DrawTextA",
-		"DrawTextExA",
-		"DrawTextExW",
-		"DrawTextW",
-		"DrvGetModuleHandle",
-		"DuplicateHandle",
-		"DuplicateIcon",
-		"DuplicateToken",
-		"DuplicateTokenEx",
-		"Ellipse",
-		"EmptyClipboard",
-		"EnableEUDC",
-		"EnableMenuItem",
-		"EnableScrollBar",
-		"EnableWindow",
-		"EncryptFileA",
-		"EncryptFileW",
-		"EndDeferWindowPos",
-		"EndDialog",
-		"EndDoc",
-		"EndDocPrinter",
-		"EndMenu",
-		"EndPage",
-		"EndPagePrinter",
-		"EndPaint",
-		"EndPath",
-		"EndUpdateResourceA",
-		"EndUpdateResourceW",
-		"EnterCriticalSection",
-		"EnumCalendarInfoA",
-		"EnumCalendarInfoW",
-		"EnumChildWindows",
-		"EnumClipboardFormats",
-		"EnumDateFormatsA",
-		"EnumDateFormatsW",
-		"EnumDependentServicesA",
-		"EnumDependentServicesW",
-		"EnumDesktopWindows",
-		"EnumDesktopsA",
-		"EnumDesktopsW",
-		"EnumDisplayDevicesA",
-		"EnumDisplayDevicesW",
-		"EnumDisplayMonitors",
-		"EnumDisplaySettingsA",
-		"EnumDisplaySettingsW",
-		"EnumEnhMetaFile",
-		"EnumFontFamiliesA",
-		"EnumFontFamiliesExA",
-		"EnumFontFamiliesExW",
-		"EnumFontFamiliesW",
-		"EnumFontsA",
-		"EnumFontsW",
-		"EnumFormsA",
-		"EnumFormsW",
-		"EnumICMProfilesA",
-		"EnumICMProfilesW",
-		"EnumJobsA",
-		"EnumJobsW",
-		"EnumMetaFile",
-		"EnumMonitorsA",
-		"EnumMonitorsW",
-		"EnumObjects",
-		"EnumPortsA",
-		"EnumPortsW",
-		"EnumPrintProcessorDatatypesA",
-		"EnumPrintProcessorDatatypesW",
-		"EnumPrintProcessorsA",
-		"EnumPrintProcessorsW",
-		"EnumPrinterDataA",
-		"EnumPrinterDataW",
-		"EnumPrinterDriversA",
-		"EnumPrinterDriversW",
-		"EnumPrintersA",
-		"EnumPrintersW",
-		"EnumPropsA",
-		"EnumPropsExA",
-		"EnumPropsExW",
-		"EnumPropsW",
-		"EnumResourceLanguagesA",
-		"EnumResourceLanguagesW",
-		"EnumResourceNamesA",
-		"EnumResourceNamesW",
-		"EnumResourceTypesA",
-		"EnumResourceTypesW",
-		"EnumServicesStatusA",
-		"EnumServicesStatusExA",
-		"EnumServicesStatusExW",
-		"EnumServicesStatusW",
-		"EnumSystemCodePagesA",
-		"EnumSystemCodePagesW",
-		"EnumSystemGeoID",
-		"EnumSystemLocalesA",
-		"EnumSystemLocalesW",
-		"EnumThreadWindows",
-		"EnumTimeFormatsA",
-		"EnumTimeFormatsW",
-		"EnumWindowStationsA",
-		"EnumWindowStationsW",
-		"EnumWindows",
-		"EqualPrefixSid",
-		"EqualRect",
-		"EqualRgn",
-		"EqualSid",
-		"EraseTape",
-		"Escape",
-		"EscapeCommFunction",
-		"ExcludeClipRect",
-		"ExcludeUpdateRgn",
-		"ExitProcess",
-		"ExitThread",
-		"ExitWindowsEx",
-		"ExpandEnvironmentStringsA",
-		"ExpandEnvironmentStringsW",
-		"ExtCreatePen",
-		"ExtCreateRegion",
-		"ExtEscape",
-		"ExtFloodFill",
-		"ExtSelectClipRgn",
-		"ExtTextOutA",
-		"ExtTextOutW",
-		"ExtractAssociatedIconA",
-		"ExtractAssociatedIconW",
-		"ExtractIconA",
-		"ExtractIconExA",
-		"ExtractIconExW",
-		"ExtractIconW",
-		"FatalAppExitA",
-		"FatalAppExitW",
-		"FatalExit",
-		"FileEncryptionStatusA",
-		"FileEncryptionStatusW",
-		"FileTimeToDosDateTime",
-		"FileTimeToLocalFileTime",
-		"FileTimeToSystemTime",
-		"FillConsoleOutputAttribute",
-		"FillConsoleOutputCharacterA",
-		"FillConsoleOutputCharacterW",
-		"FillPath",
-		"FillRect",
-		"FillRgn",
-		"FindAtomA",
-		"FindAtomW",
-		"FindClose",
-		"FindCloseChangeNotification",
-		"FindClosePrinterChangeNotification",
-		"FindExecutableA",
-		"FindExecutableW",
-		"FindFirstChangeNotificationA",
-		"FindFirstChangeNotificationW",
-		"FindFirstFileA",
-		"FindFirstFileExA",
-		"FindFirstFileExW",
-		"FindFirstFileW",
-		"FindFirstFreeAce",
-		"FindFirstPrinterChangeNotification",
-		"FindNextChangeNotification",
-		"FindNextFileA",
-		"FindNextFileW",
-		"FindNextPrinterChangeNotification",
-		"FindResourceA",
-		"FindResourceExA",
-		"FindResourceExW",
-		"FindResourceW",
-		"FindTextA",
-		"FindTextW",
-		"FindWindowA",
-		"FindWindowExA",
-		"FindWindowExW",
-		"FindWindowW",
-		"FixBrushOrgEx",
-		"FlashWindow",
-		"FlattenPath",
-		"FloodFill",
-		"FlushConsoleInputBuffer",
-		"FlushFileBuffers",
-		"FlushInstructionCache",
-		"FlushViewOfFile",
-		"FoldStringA",
-		"FoldStringW",
-		"FormatMessageA",
-		"FormatMessageW",
-		"FrameRect",
-		"FrameRgn",
-		"FreeConsole",
-		"FreeDDElParam",
-		"FreeEnvironmentStringsA",
-		"FreeEnvironmentStringsW",
-		"FreeLibrary",
-		"FreeLibraryAndExitThread",
-		"FreePrinterNotifyInfo",
-		"FreeResource",
-		"FreeSid",
-		"GdiComment",
-		"GdiFlush",
-		"GdiGetBatchLimit",
-		"GdiSetBatchLimit",
-		"GenerateConsoleCtrlEvent",
-		"GetACP",
-		"GetAce",
-		"GetAclInformation",
-		"GetActiveObject",
-		"GetActiveWindow",
-		"GetAltTabInfoA",
-		"GetAltTabInfoW",
-		"GetAncestor",
-		"GetArcDirection",
-		"GetAspectRatioFilterEx",
-		"GetAsyncKeyState",
-		"GetAtomNameA",
-		"GetAtomNameW",
-		"GetBinaryTypeA",
-		"GetBinaryTypeW",
-		"GetBitmapBits",
-		"GetBitmapDimensionEx",
-		"GetBkColor",
-		"GetBkMode",
-		"GetBoundsRect",
-		"GetBrushOrgEx",
-		"GetCPInfo",
-		"GetCPInfoExA",
-		"GetCPInfoExW",
-		"GetCalendarInfoA",
-		"GetCalendarInfoW",
-		"GetCapture",
-		"GetCaretBlinkTime",
-		"GetCaretPos",
-		"GetCharABCWidthsA",
-		"GetCharABCWidthsFloatA",
-		"GetCharABCWidthsFloatW",
-		"GetCharABCWidthsW",
-		"GetCharWidth32A",
-		"GetCharWidth32W",
-		"GetCharWidthA",
-		"GetCharWidthFloatA",
-		"GetCharWidthFloatW",
-		"GetCharWidthW",
-		"GetCharacterPlacementA",
-		"GetCharacterPlacementW",
-		"GetClassFile",
-		"GetClassInfoA",
-		"GetClassInfoExA",
-		"GetClassInfoExW",
-		"GetClassInfoW",
-		"GetClassLongA",
-		"GetClassLongW",
-		"GetClassNameA",
-		"GetClassNameW",
-		"GetClassWord",
-		"GetClientRect",
-		"GetClipBox",
-		"GetClipCursor",
-		"GetClipRgn",
-		"GetClipboardData",
-		"GetClipboardFormatNameA",
-		"GetClipboardFormatNameW",
-		"GetClipboardOwner",
-		"GetClipboardViewer",
-		"GetColorAdjustment",
-		"GetColorSpace",
-		"GetComboBoxInfo",
-		"GetCommConfig",
-		"GetCommMask",
-		"GetCommModemStatus",
-		"GetCommProperties",
-		"GetCommState",
-		"GetCommTimeouts",
-		"GetCommandLineA",
-		"GetCommandLineW",
-		"GetCompressedFileSizeA",
-		"GetCompressedFileSizeW",
-		"GetComputerNameA",
-		"GetComputerNameW",
-		"GetConsoleCP",
-		"GetConsoleCursorInfo",
-		"GetConsoleMode",
-		"GetConsoleOutputCP",
-		"GetConsoleScreenBufferInfo",
-		"GetConsoleTitleA",
-		"GetConsoleTitleW",
-		"GetConvertStg",
-		"GetCurrencyFormatA",
-		"GetCurrencyFormatW",
-		"GetCurrentDirectoryA",
-		"GetCurrentDirectoryW",
-		"GetCurrentHwProfileA",
-		"GetCurrentHwProfileW",
-		"GetCurrentObject",
-		"GetCurrentPositionEx",
-		"GetCurrentProcess",
-		"GetCurrentProcessId",
-		"GetCurrentThread",
-		"GetCurrentThreadId",
-		"GetCursor",
-		"GetCursorInfo",
-		"GetCursorPos",
-		"GetDC",
-		"GetDCEx",
-		"GetDCOrgEx",
-		"GetDIBColorTable",
-		"GetDIBits",
-		"GetDateFormatA",
-		"GetDateFormatW",
-		"GetDefaultCommConfigA",
-		"GetDefaultCommConfigW",
-		"GetDesktopWindow",
-		"GetDeviceCaps",
-		"GetDeviceGammaRamp",
-		"GetDevicePowerState",
-		"GetDialogBaseUnits",
-		"GetDiskFreeSpaceA",
-		"GetDiskFreeSpaceExA",
-		"GetDiskFreeSpaceExW",
-		"GetDiskFreeSpaceW",
-		"GetDlgCtrlID",
-		"GetDlgItem",
-		"GetDlgItemInt",
-		"GetDlgItemTextA",
-		"GetDlgItemTextW",
-		"GetDoubleClickTime",
-		"GetDriveTypeA",
-		"GetDriveTypeW",
-		"GetDriverModuleHandle",
-		"GetEnhMetaFileA",
-		"GetEnhMetaFileBits",
-		"GetEnhMetaFileDescriptionA",
-		"GetEnhMetaFileDescriptionW",
-		"GetEnhMetaFileHeader",
-		"GetEnhMetaFilePaletteEntries",
-		"GetEnhMetaFilePixelFormat",
-		"GetEnhMetaFileW",
-		"GetEnvironmentStrings",
-		"GetEnvironmentStringsA",
-		"GetEnvironmentStringsW",
-		"GetEnvironmentVariableA",
-		"GetEnvironmentVariableW",
-		"GetErrorInfo",
-		"GetExitCodeProcess",
-		"GetExitCodeThread",
-		"GetExpandedNameA",
-		"GetExpandedNameW",
-		"GetFileAttributesA",
-		"GetFileAttributesExA",
-		"GetFileAttributesExW",
-		"GetFileAttributesW",
-		"GetFileInformationByHandle",
-		"GetFileSecurityA",
-		"GetFileSecurityW",
-		"GetFileSize",
-		"GetFileTime",
-		"GetFileTitleA",
-		"GetFileTitleW",
-		"GetFileType",
-		"GetFileVersionInfoA",
-		"GetFileVersionInfoSizeA",
-		"GetFileVersionInfoSizeW",
-		"GetFileVersionInfoW",
-		"GetFocus",
-		"GetFontData",
-		"GetFontLanguageInfo",
-		"GetForegroundWindow",
-		"GetFormA",
-		"GetFormW",
-		"GetFullPathNameA",
-		"GetFullPathNameW",
-		"GetGeoInfoA",
-		"GetGeoInfoW",
-		"GetGlyphOutlineA",
-		"GetGlyphOutlineW",
-		"GetGraphicsMode",
-		"GetHGlobalFromILockBytes",
-		"GetHGlobalFromStream",
-		"GetHandleInformation",
-		"GetICMProfileA",
-		"GetICMProfileW",
-		"GetIconInfo",
-		"GetInputState",
-		"GetJobA",
-		"GetJobW",
-		"GetKBCodePage",
-		"GetKernelObjectSecurity",
-		"GetKerningPairsA",
-		"GetKerningPairsW",
-		"GetKeyNameTextA",
-		"GetKeyNameTextW",
-		"GetKeyState",
-		"GetKeyboardLayout",
-		"GetKeyboardLayoutList",
-		"GetKeyboardLayoutNameA",
-		"GetKeyboardLayoutNameW",
-		"GetKeyboardState",
-		"GetKeyboardType",
-		"GetLargestConsoleWindowSize",
-		"GetLastActivePopup",
-		"GetLastError",
-		"GetLastInputInfo",
-		"GetLengthSid",
-		"GetListBoxInfo",
-		"GetLocalTime",
-		"GetLocaleInfoA",
-		"GetLocaleInfoW",
-		"GetLogColorSpaceA",
-		"GetLogColorSpaceW",
-		"GetLogicalDriveStringsA",
-		"GetLogicalDriveStringsW",
-		"GetLogicalDrives",
-		"GetMailslotInfo",
-		"GetMapMode",
-		"GetMenu",
-		"GetMenuBarInfo",
-		"GetMenuCheckMarkDimensions",
-		"GetMenuContextHelpId",
-		"GetMenuDefaultItem",
-		"GetMenuInfo",
-		"GetMenuItemCount",
-		"GetMenuItemID",
-		"GetMenuItemInfoA",
-		"GetMenuItemInfoW",
-		"GetMenuItemRect",
-		"GetMenuState",
-		"GetMenuStringA",
-		"GetMenuStringW",
-		"GetMessageA",
-		"GetMessageExtraInfo",
-		"GetMessagePos",
-		"GetMessageTime",
-		"GetMessageW",
-		"GetMetaFileA",
-		"GetMetaFileBitsEx",
-		"GetMetaFileW",
-		"GetMetaRgn",
-		"GetMiterLimit",
-		"GetModuleFileNameA",
-		"GetModuleFileNameW",
-		"GetModuleHandleA",
-		"GetModuleHandleW",
-		"GetMonitorInfoA",
-		"GetMonitorInfoW",
-		"GetNLSVersion",
-		"GetNamedPipeHandleStateA",
-		"GetNamedPipeHandleStateW",
-		"GetNamedPipeInfo",
-		"GetNearestColor",
-		"GetNearestPaletteIndex",
-		"GetNextDlgGroupItem",
-		"GetNextDlgTabItem",
-		"GetNumberFormatA",
-		"GetNumberFormatW",
-		"GetNumberOfConsoleInputEvents",
-		"GetNumberOfConsoleMouseButtons",
-		"GetNumberOfEventLogRecords",
-		"GetOEMCP",
-		"GetObjectA",
-		"GetObjectType",
-		"GetObjectW",
-		"GetOldestEventLogRecord",
-		"GetOpenClipboardWindow",
-		"GetOpenFileNameA",
-		"GetOpenFileNameW",
-		"GetOutlineTextMetricsA",
-		"GetOutlineTextMetricsW",
-		"GetOverlappedResult",
-		"GetPaletteEntries",
-		"GetParent",
-		"GetPath",
-		"GetPixel",
-		"GetPixelFormat",
-		"GetPolyFillMode",
-		"GetPrintProcessorDirectoryA",
-		"GetPrintProcessorDirectoryW",
-		"GetPrinterA",
-		"GetPrinterDataA",
-		"GetPrinterDataW",
-		"GetPrinterDriverA",
-		"GetPrinterDriverDirectoryA",
-		"GetPrinterDriverDirectoryW",
-		"GetPrinterDriverW",
-		"GetPrinterW",
-		"GetPriorityClass",
-		"GetPriorityClipboardFormat",
-		"GetPrivateObjectSecurity",
-		"GetPrivateProfileIntA",
-		"GetPrivateProfileIntW",
-		"GetPrivateProfileSectionA",
-		"GetPrivateProfileSectionNamesA",
-		"GetPrivateProfileSectionNamesW",
-		"GetPrivateProfileSectionW",
-		"GetPrivateProfileStringA",
-		"GetPrivateProfileStringW",
-		"GetPrivateProfileStructA",
-		"GetPrivateProfileStructW",
-		"GetProcAddress",
-		"GetProcessAffinityMask",
-		"GetProcessHeap",
-		"GetProcessHeaps",
-		"GetProcessPriorityBoost",
-		"GetProcessShutdownParameters",
-		"GetProcessTimes",
-		"GetProcessVersion",
-		"GetProcessWindowStation",
-		"GetProcessWorkingSetSize",
-		"GetProfileIntA",
-		"GetProfileIntW",
-		"GetProfileSectionA",
-		"GetProfileSectionW",
-		"GetProfileStringA",
-		"GetProfileStringW",
-		"GetPropA",
-		"GetPropW",
-		"GetQueueStatus",
-		"GetQueuedCompletionStatus",
-		"GetROP2",
-		"GetRandomRgn",
-		"GetRasterizerCaps",
-		"GetRecordInfoFromGuids",
-		"GetRecordInfoFromTypeInfo",
-		"GetRegionData",
-		"GetRgnBox",
-		"GetRunningObjectTable",
-		"GetSaveFileNameA",
-		"GetSaveFileNameW",
-		"GetScrollBarInfo",
-		"GetScrollInfo",
-		"GetScrollPos",
-		"GetScrollRange",
-		"GetSecurityDescriptorControl",
-		"GetSecurityDescriptorDacl",
-		"GetSecurityDescriptorGroup",
-		"GetSecurityDescriptorLength",
-		"GetSecurityDescriptorOwner",
-		"GetSecurityDescriptorSacl",
-		"GetServiceDisplayNameA",
-		"GetServiceDisplayNameW",
-		"GetServiceKeyNameA",
-		"GetServiceKeyNameW",
-		"GetShortPathNameA",
-		"GetShortPathNameW",
-		"GetSidIdentifierAuthority",
-		"GetSidLengthRequired",
-		"GetSidSubAuthority",
-		"GetSidSubAuthorityCount",
-		"GetStartupInfoA",
-		"GetStartupInfoW",
-		"GetStdHandle",
-		"GetStockObject",
-		"GetStretchBltMode",
-		"GetStringTypeA",
-		"GetStringTypeExA",
-		"GetStringTypeExW",
-		"GetStringTypeW",
-		"GetSubMenu",
-		"GetSysColor",
-		"GetSysColorBrush",
-		"GetSystemDefaultLCID",
-		"GetSystemDefaultLangID",
-		"GetSystemDirectoryA",
-		"GetSystemDirectoryW",
-		"GetSystemInfo",
-		"GetSystemMenu",
-		"GetSystemMetrics",
-		"GetSystemPaletteEntries",
-		"GetSystemPaletteUse",
-		"GetSystemPowerStatus",
-		"GetSystemTime",
-		"GetSystemTimeAdjustment",
-		"GetSystemTimeAsFileTime",
-		"GetTabbedTextExtentA",
-		"GetTabbedTextExtentW",
-		"GetTapeParameters",
-		"GetTapePosition",
-		"GetTapeStatus",
-		"GetTempFileNameA",
-		"GetTempFileNameW",
-		"GetTempPathA",
-		"GetTempPathW",
-		"GetTextAlign",
-		"GetTextCharacterExtra",
-		"GetTextCharset",
-		"GetTextCharsetInfo",
-		"GetTextColor",
-		"GetTextExtentExPointA",
-		"GetTextExtentExPointW",
-		"GetTextExtentPoint32A",
-		"GetTextExtentPoint32W",
-		"GetTextExtentPointA",
-		"GetTextExtentPointW",
-		"GetTextFaceA",
-		"GetTextFaceW",
-		"GetTextMetricsA",
-		"GetTextMetricsW",
-		"GetThreadContext",
-		"GetThreadDesktop",
-		"GetThreadLocale",
-		"GetThreadPriority",
-		"GetThreadPriorityBoost",
-		"GetThreadSelectorEntry",
-		"GetThreadTimes",
-		"GetTickCount",
-		"GetTimeFormatA",
-		"GetTimeFormatW",
-		"GetTimeZoneInformation",
-		"GetTokenInformation",
-		"GetTopWindow",
-		"GetUpdateRect",
-		"GetUpdateRgn",
-		"GetUserDefaultLCID",
-		"GetUserDefaultLangID",
-		"GetUserGeoID",
-		"GetUserNameA",
-		"GetUserNameW",
-		"GetUserObjectInformationA",
-		"GetUserObjectInformationW",
-		"GetUserObjectSecurity",
-		"GetVersion",
-		"GetVersionExA",
-		"GetVersionExW",
-		"GetViewportExtEx",
-		"GetViewportOrgEx",
-		"GetVolumeInformationA",
-		"GetVolumeInformationW",
-		"GetWinMetaFileBits",
-		"GetWindow",
-		"GetWindowContextHelpId",
-		"GetWindowDC",
-		"GetWindowExtEx",
-		"GetWindowInfo",
-		"GetWindowLongA",
-		"GetWindowLongW",
-		"GetWindowModuleFileNameA",
-		"GetWindowModuleFileNameW",
-		"GetWindowOrgEx",
-		"GetWindowPlacement",
-		"GetWindowRect",
-		"GetWindowRgn",
-		"GetWindowTextA",
-		"GetWindowTextLengthA",
-		"GetWindowTextLengthW",
-		"GetWindowTextW",
-		"GetWindowThreadProcessId",
-		"GetWindowWord",
-		"GetWindowsDirectoryA",
-		"GetWindowsDirectoryW",
-		"GetWorldTransform",
-		"GetWriteWatch",
-		"GlobalAddAtomA",
-		"GlobalAddAtomW",
-		"GlobalAlloc",
-		"GlobalCompact",
-		"GlobalDeleteAtom",
-		"GlobalFindAtomA",
-		"GlobalFindAtomW",
-		"GlobalFix",
-		"GlobalFlags",
-		"GlobalFree",
-		"GlobalGetAtomNameA",
-		"GlobalGetAtomNameW",
-		"GlobalHandle",
-		"GlobalLock",
-		"GlobalMemoryStatus",
-		"GlobalReAlloc",
-		"GlobalSize",
-		"GlobalUnWire",
-		"GlobalUnfix",
-		"GlobalUnlock",
-		"GlobalWire",
-		"GrayStringA",
-		"GrayStringW",
-		"HeapAlloc",
-		"HeapCompact",
-		"HeapCreate",
-		"HeapDestroy",
-		"HeapFree",
-		"HeapLock",
-		"HeapReAlloc",
-		"HeapSize",
-		"HeapUnlock",
-		"HeapValidate",
-		"HeapWalk",
-		"HideCaret",
-		"HiliteMenuItem",
-		"IAdviseSink2_OnLinkSrcChange_Proxy",
-		"IAdviseSink2_OnLinkSrcChange_Stub",
-		"IAdviseSink2_RemoteOnLinkSrcChange_Proxy",
-		"IAdviseSink2_RemoteOnLinkSrcChange_Stub",
-		"IAdviseSink_OnClose_Proxy",
-		"IAdviseSink_OnClose_Stub",
-		"IAdviseSink_OnDataChange_Proxy",
-		"IAdviseSink_OnDataChange_Stub",
-		"IAdviseSink_OnRename_Proxy",
-		"IAdviseSink_OnRename_Stub",
-		"IAdviseSink_OnSave_Proxy",
-		"IAdviseSink_OnSave_Stub",
-		"IAdviseSink_OnViewChange_Proxy",
-		"IAdviseSink_OnViewChange_Stub",
-		"IAdviseSink_RemoteOnClose_Proxy",
-		"IAdviseSink_RemoteOnClose_Stub",
-		"IAdviseSink_RemoteOnDataChange_Proxy",
-		"IAdviseSink_RemoteOnDataChange_Stub",
-		"IAdviseSink_RemoteOnRename_Proxy",
-		"IAdviseSink_RemoteOnRename_Stub",
-		"IAdviseSink_RemoteOnSave_Proxy",
-		"IAdviseSink_RemoteOnSave_Stub",
-		"IAdviseSink_RemoteOnViewChange_Proxy",
-		"IAdviseSink_RemoteOnViewChange_Stub",
-		"IBindCtx_EnumObjectParam_Proxy",
-		"IBindCtx_EnumObjectParam_Stub",
-		"IBindCtx_GetBindOptions_Proxy",
-		"IBindCtx_GetBindOptions_Stub",
-		"IBindCtx_GetObjectParam_Proxy",
-		"IBindCtx_GetObjectParam_Stub",
-		"IBindCtx_GetRunningObjectTable_Proxy",
-		"IBindCtx_GetRunningObjectTable_Stub",
-		"IBindCtx_RegisterObjectBound_Proxy",
-		"IBindCtx_RegisterObjectBound_Stub",
-		"IBindCtx_RegisterObjectParam_Proxy",
-		"IBindCtx_RegisterObjectParam_Stub",
-		"IBindCtx_ReleaseBoundObjects_Proxy",
-		"IBindCtx_ReleaseBoundObjects_Stub",
-		"IBindCtx_RevokeObjectBound_Proxy",
-		"IBindCtx_RevokeObjectBound_Stub",
-		"IBindCtx_RevokeObjectParam_Proxy",
-		"IBindCtx_RevokeObjectParam_Stub",
-		"IBindCtx_SetBindOptions_Proxy",
-		"IBindCtx_SetBindOptions_Stub",
-		"IClassFactory_CreateInstance_Proxy",
-		"IClassFactory_CreateInstance_Stub",
-		"IClassFactory_LockServer_Proxy",
-		"IClassFactory_LockServer_Stub",
-		"IClassFactory_RemoteCreateInstance_Proxy",
-		"IClassFactory_RemoteCreateInstance_Stub",
-		"IClassFactory_RemoteLockServer_Proxy",
-		"IClassFactory_RemoteLockServer_Stub",
-		"IDataAdviseHolder_Advise_Proxy",
-		"IDataAdviseHolder_Advise_Stub",
-		"IDataAdviseHolder_EnumAdvise_Proxy",
-		"IDataAdviseHolder_EnumAdvise_Stub",
-		"IDataAdviseHolder_SendOnDataChange_Proxy",
-		"IDataAdviseHolder_SendOnDataChange_Stub",
-		"IDataAdviseHolder_Unadvise_Proxy",
-		"IDataAdviseHolder_Unadvise_Stub",
-		"IDataObject_DAdvise_Proxy",
-		"IDataObject_DAdvise_Stub",
-		"IDataObject_DUnadvise_Proxy",
-		"IDataObject_DUnadvise_Stub",
-		"IDataObject_EnumDAdvise_Proxy",
-		"IDataObject_EnumDAdvise_Stub",
-		"IDataObject_EnumFormatEtc_Proxy",
-		"IDataObject_EnumFormatEtc_Stub",
-		"IDataObject_GetCanonicalFormatEtc_Proxy",
-		"IDataObject_GetCanonicalFormatEtc_Stub",
-		"IDataObject_GetDataHere_Proxy",
-		"IDataObject_GetDataHere_Stub",
-		"IDataObject_GetData_Proxy",
-		"IDataObject_GetData_Stub",
-		"IDataObject_QueryGetData_Proxy",
-		"IDataObject_QueryGetData_Stub",
-		"IDataObject_RemoteGetDataHere_Proxy",
-		"IDataObject_RemoteGetDataHere_Stub",
-		"IDataObject_RemoteGetData_Proxy",
-		"IDataObject_RemoteGetData_Stub",
-		"IDataObject_RemoteSetData_Proxy",
-		"IDataObject_RemoteSetData_Stub",
-		"IDataObject_SetData_Proxy",
-		"IDataObject_SetData_Stub",
-		"IEnumFORMATETC_Clone_Proxy",
-		"IEnumFORMATETC_Clone_Stub",
-		"IEnumFORMATETC_Next_Proxy",
-		"IEnumFORMATETC_Next_Stub",
-		"IEnumFORMATETC_RemoteNext_Proxy",
-		"IEnumFORMATETC_RemoteNext_Stub",
-		"IEnumFORMATETC_Reset_Proxy",
-		"IEnumFORMATETC_Reset_Stub",
-		"IEnumFORMATETC_Skip_Proxy",
-		"IEnumFORMATETC_Skip_Stub",
-		"IEnumMoniker_Clone_Proxy",
-		"IEnumMoniker_Clone_Stub",
-		"IEnumMoniker_Next_Proxy",
-		"IEnumMoniker_Next_Stub",
-		"IEnumMoniker_RemoteNext_Proxy",
-		"IEnumMoniker_RemoteNext_Stub",
-		"IEnumMoniker_Reset_Proxy",
-		"IEnumMoniker_Reset_Stub",
-		"IEnumMoniker_Skip_Proxy",
-		"IEnumMoniker_Skip_Stub",
-		"IEnumSTATDATA_Clone_Proxy",
-		"IEnumSTATDATA_Clone_Stub",
-		"IEnumSTATDATA_Next_Proxy",
-		"IEnumSTATDATA_Next_Stub",
-		"IEnumSTATDATA_RemoteNext_Proxy",
-		"IEnumSTATDATA_RemoteNext_Stub",
-		"IEnumSTATDATA_Reset_Proxy",
-		"IEnumSTATDATA_Reset_Stub",
-		"IEnumSTATDATA_Skip_Proxy",
-		"IEnumSTATDATA_Skip_Stub",
-		"IEnumSTATSTG_Clone_Proxy",
-		"IEnumSTATSTG_Clone_Stub",
-		"IEnumSTATSTG_Next_Proxy",
-		"IEnumSTATSTG_Next_Stub",
-		"IEnumSTATSTG_RemoteNext_Proxy",
-		"IEnumSTATSTG_RemoteNext_Stub",
-		"IEnumSTATSTG_Reset_Proxy",
-		"IEnumSTATSTG_Reset_Stub",
-		"IEnumSTATSTG_Skip_Proxy",
-		"IEnumSTATSTG_Skip_Stub",
-		"IEnumString_Clone_Proxy",
-		"IEnumString_Clone_Stub",
-		"IEnumString_Next_Proxy",
-		"IEnumString_Next_Stub",
-		"IEnumString_RemoteNext_Proxy",
-		"IEnumString_RemoteNext_Stub",
-		"IEnumString_Reset_Proxy",
-		"IEnumString_Reset_Stub",
-		"IEnumString_Skip_Proxy",
-		"IEnumString_Skip_Stub",
-		"IEnumUnknown_Clone_Proxy",
-		"IEnumUnknown_Clone_Stub",
-		"IEnumUnknown_Next_Proxy",
-		"IEnumUnknown_Next_Stub",
-		"IEnumUnknown_RemoteNext_Proxy",
-		"IEnumUnknown_RemoteNext_Stub",
-		"IEnumUnknown_Reset_Proxy",
-		"IEnumUnknown_Reset_Stub",
-		"IEnumUnknown_Skip_Proxy",
-		"IEnumUnknown_Skip_Stub",
-		"IExternalConnection_AddConnection_Proxy",
-		"IExternalConnection_AddConnection_Stub",
-		"IExternalConnection_ReleaseConnection_Proxy",
-		"IExternalConnection_ReleaseConnection_Stub",
-		"IIDFromString",
-		"ILockBytes_Flush_Proxy",
-		"ILockBytes_Flush_Stub",
-		"ILockBytes_LockRegion_Proxy",
-		"ILockBytes_LockRegion_Stub",
-		"ILockBytes_ReadAt_Proxy",
-		"ILockBytes_ReadAt_Stub",
-		"ILockBytes_RemoteReadAt_Proxy",
-		"ILockBytes_RemoteReadAt_Stub",
-		"ILockBytes_RemoteWriteAt_Proxy",
-		"ILockBytes_RemoteWriteAt_Stub",
-		"ILockBytes_SetSize_Proxy",
-		"ILockBytes_SetSize_Stub",
-		"ILockBytes_Stat_Proxy",
-		"ILockBytes_Stat_Stub",
-		"ILockBytes_UnlockRegion_Proxy",
-		"ILockBytes_UnlockRegion_Stub",
-		"ILockBytes_WriteAt_Proxy",
-		"ILockBytes_WriteAt_Stub",
-		"IMallocSpy_PostAlloc_Proxy",
-		"IMallocSpy_PostAlloc_Stub",
-		"IMallocSpy_PostDidAlloc_Proxy",
-		"IMallocSpy_PostDidAlloc_Stub",
-		"IMallocSpy_PostFree_Proxy",
-		"IMallocSpy_PostFree_Stub",
-		"IMallocSpy_PostGetSize_Proxy",
-		"IMallocSpy_PostGetSize_Stub",
-		"IMallocSpy_PostHeapMinimize_Proxy",
-		"IMallocSpy_PostHeapMinimize_Stub",
-		"IMallocSpy_PostRealloc_Proxy",
-		"IMallocSpy_PostRealloc_Stub",
-		"IMallocSpy_PreAlloc_Proxy",
-		"IMallocSpy_PreAlloc_Stub",
-		"IMallocSpy_PreDidAlloc_Proxy",
-		"IMallocSpy_PreDidAlloc_Stub",
-		"IMallocSpy_PreFree_Proxy",
-		"IMallocSpy_PreFree_Stub",
-		"IMallocSpy_PreGetSize_Proxy",
-		"IMallocSpy_PreGetSize_Stub",
-		"IMallocSpy_PreHeapMinimize_Proxy",
-		"IMallocSpy_PreHeapMinimize_Stub",
-		"IMallocSpy_PreRealloc_Proxy",
-		"IMallocSpy_PreRealloc_Stub",
-		"IMalloc_Alloc_Proxy",
-		"IMalloc_Alloc_Stub",
-		"IMalloc_DidAlloc_Proxy",
-		"IMalloc_DidAlloc_Stub",
-		"IMalloc_Free_Proxy",
-		"IMalloc_Free_Stub",
-		"IMalloc_GetSize_Proxy",
-		"IMalloc_GetSize_Stub",
-		"IMalloc_HeapMinimize_Proxy",
-		"IMalloc_HeapMinimize_Stub",
-		"IMalloc_Realloc_Proxy",
-		"IMalloc_Realloc_Stub",
-		"IMarshal_DisconnectObject_Proxy",
-		"IMarshal_DisconnectObject_Stub",
-		"IMarshal_GetMarshalSizeMax_Proxy",
-		"IMarshal_GetMarshalSizeMax_Stub",
-		"IMarshal_GetUnmarshalClass_Proxy",
-		"IMarshal_GetUnmarshalClass_Stub",
-		"IMarshal_MarshalInterface_Proxy",
-		"IMarshal_MarshalInterface_Stub",
-		"IMarshal_ReleaseMarshalData_Proxy",
-		"IMarshal_ReleaseMarshalData_Stub",
-		"IMarshal_UnmarshalInterface_Proxy",
-		"IMarshal_UnmarshalInterface_Stub",
-		"IMessageFilter_HandleInComingCall_Proxy",
-		"IMessageFilter_HandleInComingCall_Stub",
-		"IMessageFilter_MessagePending_Proxy",
-		"IMessageFilter_MessagePending_Stub",
-		"IMessageFilter_RetryRejectedCall_Proxy",
-		"IMessageFilter_RetryRejectedCall_Stub",
-		"IMoniker_BindToObject_Proxy",
-		"IMoniker_BindToObject_Stub",
-		"IMoniker_BindToStorage_Proxy",
-		"IMoniker_BindToStorage_Stub",
-		"IMoniker_CommonPrefixWith_Proxy",
-		"IMoniker_CommonPrefixWith_Stub",
-		"IMoniker_ComposeWith_Proxy",
-		"IMoniker_ComposeWith_Stub",
-		"IMoniker_Enum_Proxy",
-		"IMoniker_Enum_Stub",
-		"IMoniker_GetDisplayName_Proxy",
-		"IMoniker_GetDisplayName_Stub",
-		"IMoniker_GetTimeOfLastChange_Proxy",
-		"IMoniker_GetTimeOfLastChange_Stub",
-		"IMoniker_Hash_Proxy",
-		"IMoniker_Hash_Stub",
-		"IMoniker_Inverse_Proxy",
-		"IMoniker_Inverse_Stub",
-		"IMoniker_IsEqual_Proxy",
-		"IMoniker_IsEqual_Stub",
-		"IMoniker_IsRunning_Proxy",
-		"IMoniker_IsRunning_Stub",
-		"IMoniker_IsSystemMoniker_Proxy",
-		"IMoniker_IsSystemMoniker_Stub",
-		"IMoniker_ParseDisplayName_Proxy",
-		"IMoniker_ParseDisplayName_Stub",
-		"IMoniker_Reduce_Proxy",
-		"IMoniker_Reduce_Stub",
-		"IMoniker_RelativePathTo_Proxy",
-		"IMoniker_RelativePathTo_Stub",
-		"IMoniker_RemoteBindToObject_Proxy",
-		"IMoniker_RemoteBindToObject_Stub",
-		"IMoniker_RemoteBindToStorage_Proxy",
-		"IMoniker_RemoteBindToStorage_Stub",
-		"IPSFactoryBuffer_CreateProxy_Proxy",
-		"IPSFactoryBuffer_CreateProxy_Stub",
-		"IPSFactoryBuffer_CreateStub_Proxy",
-		"IPSFactoryBuffer_CreateStub_Stub",
-		"IPersistFile_GetCurFile_Proxy",
-		"IPersistFile_GetCurFile_Stub",
-		"IPersistFile_IsDirty_Proxy",
-		"IPersistFile_IsDirty_Stub",
-		"IPersistFile_Load_Proxy",
-		"IPersistFile_Load_Stub",
-		"IPersistFile_SaveCompleted_Proxy",
-		"IPersistFile_SaveCompleted_Stub",
-		"IPersistFile_Save_Proxy",
-		"IPersistFile_Save_Stub",
-		"IPersistStorage_HandsOffStorage_Proxy",
-		"IPersistStorage_HandsOffStorage_Stub",
-		"IPersistStorage_InitNew_Proxy",
-		"IPersistStorage_InitNew_Stub",
-		"IPersistStorage_IsDirty_Proxy",
-		"IPersistStorage_IsDirty_Stub",
-		"IPersistStorage_Load_Proxy",
-		"IPersistStorage_Load_Stub",
-		"IPersistStorage_SaveCompleted_Proxy",
-		"IPersistStorage_SaveCompleted_Stub",
-		"IPersistStorage_Save_Proxy",
-		"IPersistStorage_Save_Stub",
-		"IPersistStream_GetSizeMax_Proxy",
-		"IPersistStream_GetSizeMax_Stub",
-		"IPersistStream_IsDirty_Proxy",
-		"IPersistStream_IsDirty_Stub",
-		"IPersistStream_Load_Proxy",
-		"IPersistStream_Load_Stub",
-		"IPersistStream_Save_Proxy",
-		"IPersistStream_Save_Stub",
-		"IPersist_GetClassID_Proxy",
-		"IPersist_GetClassID_Stub",
-		"IROTData_GetComparisonData_Proxy",
-		"IROTData_GetComparisonData_Stub",
-		"IRootStorage_SwitchToFile_Proxy",
-		"IRootStorage_SwitchToFile_Stub",
-		"IRpcChannelBuffer_FreeBuffer_Proxy",
-		"IRpcChannelBuffer_FreeBuffer_Stub",
-		"IRpcChannelBuffer_GetBuffer_Proxy",
-		"IRpcChannelBuffer_GetBuffer_Stub",
-		"IRpcChannelBuffer_GetDestCtx_Proxy",
-		"IRpcChannelBuffer_GetDestCtx_Stub",
-		"IRpcChannelBuffer_IsConnected_Proxy",
-		"IRpcChannelBuffer_IsConnected_Stub",
-		"IRpcChannelBuffer_SendReceive_Proxy",
-		"IRpcChannelBuffer_SendReceive_Stub",
-		"IRpcProxyBuffer_Connect_Proxy",
-		"IRpcProxyBuffer_Connect_Stub",
-		"IRpcProxyBuffer_Disconnect_Proxy",
-		"IRpcProxyBuffer_Disconnect_Stub",
-		"IRpcStubBuffer_Connect_Proxy",
-		"IRpcStubBuffer_Connect_Stub",
-		"IRpcStubBuffer_CountRefs_Proxy",
-		"IRpcStubBuffer_CountRefs_Stub",
-		"IRpcStubBuffer_DebugServerQueryInterface_Proxy",
-		"IRpcStubBuffer_DebugServerQueryInterface_Stub",
-		"IRpcStubBuffer_DebugServerRelease_Proxy",
-		"IRpcStubBuffer_DebugServerRelease_Stub",
-		"IRpcStubBuffer_Disconnect_Proxy",
-		"IRpcStubBuffer_Disconnect_Stub",
-		"IRpcStubBuffer_Invoke_Proxy",
-		"IRpcStubBuffer_Invoke_Stub",
-		"IRpcStubBuffer_IsIIDSupported_Proxy",
-		"IRpcStubBuffer_IsIIDSupported_Stub",
-		"IRunnableObject_GetRunningClass_Proxy",
-		"IRunnableObject_GetRunningClass_Stub",
-		"IRunnableObject_IsRunning_Proxy",
-		"IRunnableObject_IsRunning_Stub",
-		"IRunnableObject_LockRunning_Proxy",
-		"IRunnableObject_LockRunning_Stub",
-		"IRunnableObject_Run_Proxy",
-		"IRunnableObject_Run_Stub",
-		"IRunnableObject_SetContainedObject_Proxy",
-		"IRunnableObject_SetContainedObject_Stub",
-		"IRunningObjectTable_EnumRunning_Proxy",
-		"IRunningObjectTable_EnumRunning_Stub",
-		"IRunningObjectTable_GetObject_Proxy",
-		"IRunningObjectTable_GetObject_Stub",
-		"IRunningObjectTable_GetTimeOfLastChange_Proxy",
-		"IRunningObjectTable_GetTimeOfLastChange_Stub",
-		"IRunningObjectTable_IsRunning_Proxy",
-		"IRunningObjectTable_IsRunning_Stub",
-		"IRunningObjectTable_NoteChangeTime_Proxy",
-		"IRunningObjectTable_NoteChangeTime_Stub",
-		"IRunningObjectTable_Register_Proxy",
-		"IRunningObjectTable_Register_Stub",
-		"IRunningObjectTable_Revoke_Proxy",
-		"IRunningObjectTable_Revoke_Stub",
-		"IStdMarshalInfo_GetClassForHandler_Proxy",
-		"IStdMarshalInfo_GetClassForHandler_Stub",
-		"IStorage_Commit_Proxy",
-		"IStorage_Commit_Stub",
-		"IStorage_CopyTo_Proxy",
-		"IStorage_CopyTo_Stub",
-		"IStorage_CreateStorage_Proxy",
-		"IStorage_CreateStorage_Stub",
-		"IStorage_CreateStream_Proxy",
-		"IStorage_CreateStream_Stub",
-		"IStorage_DestroyElement_Proxy",
-		"IStorage_DestroyElement_Stub",
-		"IStorage_EnumElements_Proxy",
-		"IStorage_EnumElements_Stub",
-		"IStorage_MoveElementTo_Proxy",
-		"IStorage_MoveElementTo_Stub",
-		"IStorage_OpenStorage_Proxy",
-		"IStorage_OpenStorage_Stub",
-		"IStorage_OpenStream_Proxy",
-		"IStorage_OpenStream_Stub",
-		"IStorage_RemoteEnumElements_Proxy",
-		"IStorage_RemoteEnumElements_Stub",
-		"IStorage_RemoteOpenStream_Proxy",
-		"IStorage_RemoteOpenStream_Stub",
-		"IStorage_RenameElement_Proxy",
-		"IStorage_RenameElement_Stub",
-		"IStorage_Revert_Proxy",
-		"IStorage_Revert_Stub",
-		"IStorage_SetClass_Proxy",
-		"IStorage_SetClass_Stub",
-		"IStorage_SetElementTimes_Proxy",
-		"IStorage_SetElementTimes_Stub",
-		"IStorage_SetStateBits_Proxy",
-		"IStorage_SetStateBits_Stub",
-		"IStorage_Stat_Proxy",
-		"IStorage_Stat_Stub",
-		"IStream_Clone_Proxy",
-		"IStream_Clone_Stub",
-		"IStream_Commit_Proxy",
-		"IStream_Commit_Stub",
-		"IStream_CopyTo_Proxy",
-		"IStream_CopyTo_Stub",
-		"IStream_LockRegion_Proxy",
-		"IStream_LockRegion_Stub",
-		"IStream_Read_Proxy",
-		"IStream_Read_Stub",
-		"IStream_RemoteCopyTo_Proxy",
-		"IStream_RemoteCopyTo_Stub",
-		"IStream_RemoteRead_Proxy",
-		"IStream_RemoteRead_Stub",
-		"IStream_RemoteSeek_Proxy",
-		"IStream_RemoteSeek_Stub",
-		"IStream_RemoteWrite_Proxy",
-		"IStream_RemoteWrite_Stub",
-		"IStream_Revert_Proxy",
-		"IStream_Revert_Stub",
-		"IStream_Seek_Proxy",
-		"IStream_Seek_Stub",
-		"IStream_SetSize_Proxy",
-		"IStream_SetSize_Stub",
-		"IStream_Stat_Proxy",
-		"IStream_Stat_Stub",
-		"IStream_UnlockRegion_Proxy",
-		"IStream_UnlockRegion_Stub",
-		"IStream_Write_Proxy",
-		"IStream_Write_Stub",
-		"IUnknown_AddRef_Proxy",
-		"IUnknown_AddRef_Stub",
-		"IUnknown_QueryInterface_Proxy",
-		"IUnknown_QueryInterface_Stub",
-		"IUnknown_Release_Proxy",
-		"IUnknown_Release_Stub",
-		"I_NsClientBindDone",
-		"I_NsClientBindSearch",
-		"I_NsServerBindSearch",
-		"I_RpcAllocate",
-		"I_RpcAsyncSendReceive",
-		"I_RpcBindingCopy",
-		"I_RpcBindingInqDynamicEndpoint",
-		"I_RpcBindingInqTransportType",
-		"I_RpcBindingIsClientLocal",
-		"I_RpcBindingSetAsync",
-		"I_RpcClearMutex",
-		"I_RpcConnectionInqSockBuffSize",
-		"I_RpcConnectionSetSockBuffSize",
-		"I_RpcDeleteMutex",
-		"I_RpcFree",
-		"I_RpcFreeBuffer",
-		"I_RpcGetAssociationContext",
-		"I_RpcGetBuffer",
-		"I_RpcGetCurrentCallHandle",
-		"I_RpcGetThreadWindowHandle",
-		"I_RpcIfInqTransferSyntaxes",
-		"I_RpcMapWin32Status",
-		"I_RpcMonitorAssociation",
-		"I_RpcNsBindingSetEntryName",
-		"I_RpcNsGetBuffer",
-		"I_RpcNsRaiseException",
-		"I_RpcNsSendReceive",
-		"I_RpcPauseExecution",
-		"I_RpcReBindBuffer",
-		"I_RpcRequestMutex",
-		"I_RpcSend",
-		"I_RpcSendReceive",
-		"I_RpcServerThreadContinueListening",
-		"I_RpcServerThreadPauseListening",
-		"I_RpcServerUnregisterEndpointA",
-		"I_RpcServerUnregisterEndpointW",
-		"I_RpcSetAssociationContext",
-		"I_RpcSsDontSerializeContext",
-		"I_RpcStopMonitorAssociation",
-		"I_UuidCreate",
-		"ImmAssociateContext",
-		"ImmConfigureIMEA",
-		"ImmConfigureIMEW",
-		"ImmCreateContext",
-		"ImmDestroyContext",
-		"ImmDisableIME",
-		"ImmEnumRegisterWordA",
-		"ImmEnumRegisterWordW",
-		"ImmEscapeA",
-		"ImmEscapeW",
-		"ImmGetCandidateListA",
-		"ImmGetCandidateListCountA",
-		"ImmGetCandidateListCountW",
-		"ImmGetCandidateListW",
-		"ImmGetCandidateWindow",
-		"ImmGetCompositionFontA",
-		"ImmGetCompositionFontW",
-		"ImmGetCompositionStringA",
-		"ImmGetCompositionStringW",
-		"ImmGetCompositionWindow",
-		"ImmGetContext",
-		"ImmGetConversionListA",
-		"ImmGetConversionListW",
-		"ImmGetConversionStatus",
-		"ImmGetDefaultIMEWnd",
-		"ImmGetDescriptionA",
-		"ImmGetDescriptionW",
-		"ImmGetGuideLineA",
-		"ImmGetGuideLineW",
-		"ImmGetIMEFileNameA",
-		"ImmGetIMEFileNameW",
-		"ImmGetImeMenuItemsA",
-		"ImmGetImeMenuItemsW",
-		"ImmGetOpenStatus",
-		"ImmGetProperty",
-		"ImmGetRegisterWordStyleA",
-		"ImmGetRegisterWordStyleW",
-		"ImmGetStatusWindowPos",
-		"ImmGetVirtualKey",
-		"ImmInstallIMEA",
-		"ImmInstallIMEW",
-		"ImmIsIME",
-		"ImmIsUIMessageA",
-		"ImmIsUIMessageW",
-		"ImmNotifyIME",
-		"ImmRegisterWordA",
-		"ImmRegisterWordW",
-		"ImmReleaseContext",
-		"ImmSetCandidateWindow",
-		"ImmSetCompositionFontA",
-		"ImmSetCompositionFontW",
-		"ImmSetCompositionStringA",
-		"ImmSetCompositionStringW",
-		"ImmSetCompositionWindow",
-		"ImmSetConversionStatus",
-		"ImmSetOpenStatus",
-		"ImmSetStatusWindowPos",
-		"ImmSimulateHotKey",
-		"ImmUnregisterWordA",
-		"ImmUnregisterWordW",
-		"ImpersonateDdeClientWindow",
-		"ImpersonateLoggedOnUser",
-		"ImpersonateNamedPipeClient",
-		"ImpersonateSelf",
-		"InSendMessage",
-		"InflateRect",
-		"InitAtomTable",
-		"InitializeAcl",
-		"InitializeCriticalSection",
-		"InitializeCriticalSectionAndSpinCount",
-		"InitializeSecurityDescriptor",
-		"InitializeSid",
-		"InitiateSystemShutdownA",
-		"InitiateSystemShutdownW",
-		"InsertMenuA",
-		"InsertMenuItemA",
-		"InsertMenuItemW",
-		"InsertMenuW",
-		"InterlockedCompareExchange",
-		"InterlockedDecrement",
-		"InterlockedExchange",
-		"InterlockedExchangeAdd",
-		"InterlockedIncrement",
-		"InternalGetWindowText",
-		"IntersectClipRect",
-		"IntersectRect",
-		"InvalidateRect",
-		"InvalidateRgn",
-		"InvertRect",
-		"InvertRgn",
-		"IsAccelerator",
-		"IsBadCodePtr",
-		"IsBadHugeReadPtr",
-		"IsBadHugeWritePtr",
-		"IsBadReadPtr",
-		"IsBadStringPtrA",
-		"IsBadStringPtrW",
-		"IsBadWritePtr",
-		"IsCharAlphaA",
-		"IsCharAlphaNumericA",
-		"IsCharAlphaNumericW",
-		"IsCharAlphaW",
-		"IsCharLowerA",
-		"IsCharLowerW",
-		"IsCharUpperA",
-		"IsCharUpperW",
-		"IsChild",
-		"IsClipboardFormatAvailable",
-		"IsDBCSLeadByte",
-		"IsDBCSLeadByteEx",
-		"IsDebuggerPresent",
-		"IsDialogMessageA",
-		"IsDialogMessageW",
-		"IsDlgButtonChecked",
-		"IsIconic",
-		"IsMenu",
-		"IsNLSDefinedString",
-		"IsProcessorFeaturePresent",
-		"IsRectEmpty",
-		"IsSystemResumeAutomatic",
-		"IsTextUnicode",
-		"IsValidAcl",
-		"IsValidCodePage",
-		"IsValidLocale",
-		"IsValidSecurityDescriptor",
-		"IsValidSid",
-		"IsWindow",
-		"IsWindowEnabled",
-		"IsWindowUnicode",
-		"IsWindowVisible",
-		"IsZoomed",
-		"KillTimer",
-		"LCMapStringA",
-		"LCMapStringW",
-		"LHashValOfNameSys",
-		"LHashValOfNameSysA",
-		"LPtoDP",
-		"LZClose",
-		"LZCopy",
-		"LZDone",
-		"LZInit",
-		"LZOpenFileA",
-		"LZOpenFileW",
-		"LZRead",
-		"LZSeek",
-		"LZStart",
-		"LeaveCriticalSection",
-		"LineDDA",
-		"LineTo",
-		"LoadAcceleratorsA",
-		"LoadAcceleratorsW",
-		"LoadBitmapA",
-		"LoadBitmapW",
-		"LoadCursorA",
-		"LoadCursorFromFileA",
-		"LoadCursorFromFileW",
-		"LoadCursorW",
-		"LoadIconA",
-		"LoadIconW",
-		"LoadImageA",
-		"LoadImageW",
-		"LoadKeyboardLayoutA",
-		"LoadKeyboardLayoutW",
-		"LoadLibraryA",
-		"LoadLibraryExA",
-		"LoadLibraryExW",
-		"LoadLibraryW",
-		"LoadMenuA",
-		"LoadMenuIndirectA",
-		"LoadMenuIndirectW",
-		"LoadMenuW",
-		"LoadModule",
-		"LoadRegTypeLib",
-		"LoadResource",
-		"LoadStringA",
-		"LoadStringW",
-		"LoadTypeLib",
-		"LoadTypeLibEx",
-		"LocalAlloc",
-		"LocalCompact",
-		"LocalDiscard",
-		"LocalFileTimeToFileTime",
-		"LocalFlags",
-		"LocalFree",
-		"LocalHandle",
-		"LocalLock",
-		"LocalReAlloc",
-		"LocalShrink",
-		"LocalSize",
-		"LocalUnlock",
-		"LockFile",
-		"LockFileEx",
-		"LockResource",
-		"LockServiceDatabase",
-		"LockWindowUpdate",
-		"LogonUserA",
-		"LogonUserW",
-		"LookupAccountNameA",
-		"LookupAccountNameW",
-		"LookupAccountSidA",
-		"LookupAccountSidW",
-		"LookupIconIdFromDirectory",
-		"LookupIconIdFromDirectoryEx",
-		"LookupPrivilegeDisplayNameA",
-		"LookupPrivilegeDisplayNameW",
-		"LookupPrivilegeNameA",
-		"LookupPrivilegeNameW",
-		"LookupPrivilegeValueA",
-		"LookupPrivilegeValueW",
-		"MIDL_user_allocate",
-		"MIDL_user_free",
-		"MIDL_wchar_strcpy",
-		"MIDL_wchar_strlen",
-		"MakeAbsoluteSD",
-		"MakeSelfRelativeSD",
-		"MapDialogRect",
-		"MapGenericMask",
-		"MapViewOfFile",
-		"MapViewOfFileEx",
-		"MapVirtualKeyA",
-		"MapVirtualKeyExA",
-		"MapVirtualKeyExW",
-		"MapVirtualKeyW",
-		"MapWindowPoints",
-		"MaskBlt",
-		"MenuItemFromPoint",
-		"MessageBeep",
-		"MessageBoxA",
-		"MessageBoxExA",
-		"MessageBoxExW",
-		"MessageBoxIndirectA",
-		"MessageBoxIndirectW",
-		"MessageBoxW",
-		"MkParseDisplayName",
-		"ModifyMenuA",
-		"ModifyMenuW",
-		"ModifyWorldTransform",
-		"MonikerCommonPrefixWith",
-		"MonikerRelativePathTo",
-		"MoveFileA",
-		"MoveFileExA",
-		"MoveFileExW",
-		"MoveFileW",
-		"MoveToEx",
-		"MoveWindow",
-		"MsgWaitForMultipleObjects",
-		"MsgWaitForMultipleObjectsEx",
-		"MulDiv",
-		"MultiByteToWideChar",
-		"MultinetGetConnectionPerformanceA",
-		"MultinetGetConnectionPerformanceW",
-		"NDRCContextBinding",
-		"NDRCContextMarshall",
-		"NDRCContextUnmarshall",
-		"NDRSContextMarshall",
-		"NDRSContextUnmarshall",
-		"NDRcopy",
-		"NdrAllocate",
-		"NdrByteCountPointerBufferSize",
-		"NdrByteCountPointerFree",
-		"NdrByteCountPointerMarshall",
-		"NdrByteCountPointerUnmarshall",
-		"NdrClearOutParameters",
-		"NdrClientCall",
-		"NdrClientCall2",
-		"NdrClientContextMarshall",
-		"NdrClientContextUnmarshall",
-		"NdrClientInitialize",
-		"NdrClientInitializeNew",
-		"NdrComplexArrayBufferSize",
-		"NdrComplexArrayFree",
-		"NdrComplexArrayMarshall",
-		"NdrComplexArrayMemorySize",
-		"NdrComplexArrayUnmarshall",
-		"NdrComplexStructBufferSize",
-		"NdrComplexStructFree",
-		"NdrComplexStructMarshall",
-		"NdrComplexStructMemorySize",
-		"NdrComplexStructUnmarshall",
-		"NdrConformantArrayBufferSize",
-		"NdrConformantArrayFree",
-		"NdrConformantArrayMarshall",
-		"NdrConformantArrayMemorySize",
-		"NdrConformantArrayUnmarshall",
-		"NdrConformantStringBufferSize",
-		"NdrConformantStringMarshall",
-		"NdrConformantStringMemorySize",
-		"NdrConformantStringUnmarshall",
-		"NdrConformantStructBufferSize",
-		"NdrConformantStructFree",
-		"NdrConformantStructMarshall",
-		"NdrConformantStructMemorySize",
-		"NdrConformantStructUnmarshall",
-		"NdrConformantVaryingArrayBufferSize",
-		"NdrConformantVaryingArrayFree",
-		"NdrConformantVaryingArrayMarshall",
-		"NdrConformantVaryingArrayMemorySize",
-		"NdrConformantVaryingArrayUnmarshall",
-		"NdrConformantVaryingStructBufferSize",
-		"NdrConformantVaryingStructFree",
-		"NdrConformantVaryingStructMarshall",
-		"NdrConformantVaryingStructMemorySize",
-		"NdrConformantVaryingStructUnmarshall",
-		"NdrContextHandleSize",
-		"NdrConvert",
-		"NdrEncapsulatedUnionBufferSize",
-		"NdrEncapsulatedUnionFree",
-		"NdrEncapsulatedUnionMarshall",
-		"NdrEncapsulatedUnionMemorySize",
-		"NdrEncapsulatedUnionUnmarshall",
-		"NdrFixedArrayBufferSize",
-		"NdrFixedArrayFree",
-		"NdrFixedArrayMarshall",
-		"NdrFixedArrayMemorySize",
-		"NdrFixedArrayUnmarshall",
-		"NdrFreeBuffer",
-		"NdrFullPointerFree",
-		"NdrFullPointerInsertRefId",
-		"NdrFullPointerQueryPointer",
-		"NdrFullPointerQueryRefId",
-		"NdrFullPointerXlatFree",
-		"NdrFullPointerXlatInit",
-		"NdrGetBuffer",
-		"NdrHardStructBufferSize",
-		"NdrHardStructFree",
-		"NdrHardStructMarshall",
-		"NdrHardStructMemorySize",
-		"NdrHardStructUnmarshall",
-		"NdrInterfacePointerBufferSize",
-		"NdrInterfacePointerFree",
-		"NdrInterfacePointerMarshall",
-		"NdrInterfacePointerMemorySize",
-		"NdrInterfacePointerUnmarshall",
-		"NdrMapCommAndFaultStatus",
-		"NdrNonConformantStringBufferSize",
-		"NdrNonConformantStringMarshall",
-		"NdrNonConformantStringMemorySize",
-		"NdrNonConformantStringUnmarshall",
-		"NdrNonEncapsulatedUnionBufferSize",
-		"NdrNonEncapsulatedUnionFree",
-		"NdrNonEncapsulatedUnionMarshall",
-		"NdrNonEncapsulatedUnionMemorySize",
-		"NdrNonEncapsulatedUnionUnmarshall",
-		"NdrNsGetBuffer",
-		"NdrNsSendReceive",
-		"NdrOleAllocate",
-		"NdrOleFree",
-		"NdrPointerBufferSize",
-		"NdrPointerFree",
-		"NdrPointerMarshall",
-		"NdrPointerMemorySize",
-		"NdrPointerUnmarshall",
-		"NdrRpcSmClientAllocate",
-		"NdrRpcSmClientFree",
-		"NdrRpcSmSetClientToOsf",
-		"NdrRpcSsDefaultAllocate",
-		"NdrRpcSsDefaultFree",
-		"NdrRpcSsDisableAllocate",
-		"NdrRpcSsEnableAllocate",
-		"NdrSH_Copy",
-		"NdrSH_IfAlloc",
-		"NdrSH_IfAllocCopy",
-		"NdrSH_IfAllocRef",
-		"NdrSH_IfAllocSet",
-		"NdrSH_IfCopy",
-		"NdrSH_IfFree",
-		"NdrSH_StringMarshall",
-		"NdrSH_StringUnMarshall",
-		"NdrSH_TLUPDecision",
-		"NdrSH_TLUPDecisionBuffer",
-		"NdrSH_UPDecision",
-		"NdrSendReceive",
-		"NdrServerCall",
-		"NdrServerContextMarshall",
-		"NdrServerContextUnmarshall",
-		"NdrServerInitialize",
-		"NdrServerInitializeMarshall",
-		"NdrServerInitializeNew",
-		"NdrServerInitializeUnmarshall",
-		"NdrServerMarshall",
-		"NdrServerUnmarshall",
-		"NdrSimpleStructBufferSize",
-		"NdrSimpleStructFree",
-		"NdrSimpleStructMarshall",
-		"NdrSimpleStructMemorySize",
-		"NdrSimpleStructUnmarshall",
-		"NdrSimpleTypeMarshall",
-		"NdrSimpleTypeUnmarshall",
-		"NdrStubCall",
-		"NdrUserMarshalBufferSize",
-		"NdrUserMarshalFree",
-		"NdrUserMarshalMarshall",
-		"NdrUserMarshalMemorySize",
-		"NdrUserMarshalUnmarshall",
-		"NdrVaryingArrayBufferSize",
-		"NdrVaryingArrayFree",
-		"NdrVaryingArrayMarshall",
-		"NdrVaryingArrayMemorySize",
-		"NdrVaryingArrayUnmarshall",
-		"NdrXmitOrRepAsBufferSize",
-		"NdrXmitOrRepAsFree",
-		"NdrXmitOrRepAsMarshall",
-		"NdrXmitOrRepAsMemorySize",
-		"NdrXmitOrRepAsUnmarshall",
-		"Netbios",
-		"NotifyBootConfigStatus",
-		"NotifyChangeEventLog",
-		"OaBuildVersion",
-		"ObjectCloseAuditAlarmA",
-		"ObjectCloseAuditAlarmW",
-		"ObjectDeleteAuditAlarmA",
-		"ObjectDeleteAuditAlarmW",
-		"ObjectOpenAuditAlarmA",
-		"ObjectOpenAuditAlarmW",
-		"ObjectPrivilegeAuditAlarmA",
-		"ObjectPrivilegeAuditAlarmW",
-		"OemKeyScan",
-		"OemToCharA",
-		"OemToCharBuffA",
-		"OemToCharBuffW",
-		"OemToCharW",
-		"OffsetClipRgn",
-		"OffsetRect",
-		"OffsetRgn",
-		"OffsetViewportOrgEx",
-		"OffsetWindowOrgEx",
-		"OleBuildVersion",
-		"OleConvertIStorageToOLESTREAM",
-		"OleConvertIStorageToOLESTREAMEx",
-		"OleConvertOLESTREAMToIStorage",
-		"OleConvertOLESTREAMToIStorageEx",
-		"OleCreate",
-		"OleCreateDefaultHandler",
-		"OleCreateEmbeddingHelper",
-		"OleCreateFromData",
-		"OleCreateFromFile",
-		"OleCreateLink",
-		"OleCreateLinkFromData",
-		"OleCreateLinkToFile",
-		"OleCreateMenuDescriptor",
-		"OleCreateStaticFromData",
-		"OleDestroyMenuDescriptor",
-		"OleDoAutoConvert",
-		"OleDraw",
-		"OleDuplicateData",
-		"OleFlushClipboard",
-		"OleGetAutoConvert",
-		"OleGetClipboard",
-		"OleGetIconOfClass",
-		"OleGetIconOfFile",
-		"OleInitialize",
-		"OleIsCurrentClipboard",
-		"OleIsRunning",
-		"OleLoad",
-		"OleLoadFromStream",
-		"OleLockRunning",
-		"OleMetafilePictFromIconAndLabel",
-		"OleNoteObjectVisible",
-		"OleQueryCreateFromData",
-		"OleQueryLinkFromData",
-		"OleRegEnumFormatEtc",
-		"OleRegEnumVerbs",
-		"OleRegGetMiscStatus",
-		"OleRegGetUserType",
-		"OleRun",
-		"OleSave",
-		"OleSaveToStream",
-		"OleSetAutoConvert",
-		"OleSetClipboard",
-		"OleSetContainedObject",
-		"OleSetMenuDescriptor",
-		"OleTranslateAccelerator",
-		"OleUninitialize",
-		"OpenBackupEventLogA",
-		"OpenBackupEventLogW",
-		"OpenClipboard",
-		"OpenDesktopA",
-		"OpenDesktopW",
-		"OpenDriver",
-		"OpenEventA",
-		"OpenEventLogA",
-		"OpenEventLogW",
-		"OpenEventW",
-		"OpenFile",
-		"OpenFileMappingA",
-		"OpenFileMappingW",
-		"OpenIcon",
-		"OpenInputDesktop",
-		"OpenMutexA",
-		"OpenMutexW",
-		"OpenPrinterA",
-		"OpenPrinterW",
-		"OpenProcess",
-		"OpenProcessToken",
-		"OpenSCManagerA",
-		"OpenSCManagerW",
-		"OpenSemaphoreA",
-		"OpenSemaphoreW",
-		"OpenServiceA",
-		"OpenServiceW",
-		"OpenThreadToken",
-		"OpenWaitableTimerA",
-		"OpenWaitableTimerW",
-		"OpenWindowStationA",
-		"OpenWindowStationW",
-		"OutputDebugStringA",
-		"OutputDebugStringW",
-		"PackDDElParam",
-		"PageSetupDlgA",
-		"PageSetupDlgW",
-		"PaintDesktop",
-		"PaintRgn",
-		"PatBlt",
-		"PathToRegion",
-		"PeekConsoleInputA",
-		"PeekConsoleInputW",
-		"PeekMessageA",
-		"PeekMessageW",
-		"PeekNamedPipe",
-		"Pie",
-		"PlayEnhMetaFile",
-		"PlayEnhMetaFileRecord",
-		"PlayMetaFile",
-		"PlayMetaFileRecord",
-		"PlaySoundA",
-		"PlaySoundW",
-		"PlgBlt",
-		"PolyBezier",
-		"PolyBezierTo",
-		"PolyDraw",
-		"PolyPolygon",
-		"PolyPolyline",
-		"PolyTextOutA",
-		"PolyTextOutW",
-		"Polygon",
-		"Polyline",
-		"PolylineTo",
-		"PostMessageA",
-		"PostMessageW",
-		"PostQueuedCompletionStatus",
-		"PostQuitMessage",
-		"PostThreadMessageA",
-		"PostThreadMessageW",
-		"PrepareTape",
-		"PrintDlgA",
-		"PrintDlgW",
-		"PrinterMessageBoxA",
-		"PrinterMessageBoxW",
-		"PrinterProperties",
-		"PrivilegeCheck",
-		"PrivilegedServiceAuditAlarmA",
-		"PrivilegedServiceAuditAlarmW",
-		"ProgIDFromCLSID",
-		"PtInRect",
-		"PtInRegion",
-		"PtVisible",
-		"PulseEvent",
-		"PurgeComm",
-		"QueryDosDeviceA",
-		"QueryDosDeviceW",
-		"QueryPathOfRegTypeLib",
-		"QueryPerformanceCounter",
-		"QueryPerformanceFrequency",
-		"QueryServiceConfig2A",
-		"QueryServiceConfig2W",
-		"QueryServiceConfigA",
-		"QueryServiceConfigW",
-		"QueryServiceLockStatusA",
-		"QueryServiceLockStatusW",
-		"QueryServiceObjectSecurity",
-		"QueryServiceStatus",
-		"QueryServiceStatusEx",
-		"QueueUserAPC",
-		"RPC_CLIENT_FREE",
-		"RPC_FORWARD_FUNCTION",
-		"RPC_IF_CALLBACK_FN",
-		"RPC_OBJECT_INQ_FN",
-		"RaiseException",
-		"ReadClassStg",
-		"ReadClassStm",
-		"ReadConsoleA",
-		"ReadConsoleInputA",
-		"ReadConsoleInputW",
-		"ReadConsoleOutputA",
-		"ReadConsoleOutputAttribute",
-		"ReadConsoleOutputCharacterA",
-		"ReadConsoleOutputCharacterW",
-		"ReadConsoleOutputW",
-		"ReadConsoleW",
-		"ReadDirectoryChangesW",
-		"ReadEventLogA",
-		"ReadEventLogW",
-		"ReadFile",
-		"ReadFileEx",
-		"ReadFileScatter",
-		"ReadFmtUserTypeStg",
-		"ReadPrinter",
-		"ReadProcessMemory",
-		"RealChildWindowFromPoint",
-		"RealGetWindowClassA",
-		"RealGetWindowClassW",
-		"RealizePalette",
-		"RectInRegion",
-		"RectVisible",
-		"Rectangle",
-		"RedrawWindow",
-		"RegCloseKey",
-		"RegConnectRegistryA",
-		"RegConnectRegistryW",
-		"RegCreateKeyA",
-		"RegCreateKeyExA",
-		"RegCreateKeyExW",
-		"RegCreateKeyW",
-		"RegDeleteKeyA",
-		"RegDeleteKeyW",
-		"RegDeleteValueA",
-		"RegDeleteValueW",
-		"RegEnumKeyA",
-		"RegEnumKeyExA",
-		"RegEnumKeyExW",
-		"RegEnumKeyW",
-		"RegEnumValueA",
-		"RegEnumValueW",
-		"RegFlushKey",
-		"RegGetKeySecurity",
-		"RegLoadKeyA",
-		"RegLoadKeyW",
-		"RegNotifyChangeKeyValue",
-		"RegOpenKeyA",
-		"RegOpenKeyExA",
-		"RegOpenKeyExW",
-		"RegOpenKeyW",
-		"RegQueryInfoKeyA",
-		"RegQueryInfoKeyW",
-		"RegQueryMultipleValuesA",
-		"RegQueryMultipleValuesW",
-		"RegQueryValueA",
-		"RegQueryValueExA",
-		"RegQueryValueExW",
-		"RegQueryValueW",
-		"RegReplaceKeyA",
-		"RegReplaceKeyW",
-		"RegRestoreKeyA",
-		"RegRestoreKeyW",
-		"RegSaveKeyA",
-		"RegSaveKeyW",
-		"RegSetKeySecurity",
-		"RegSetValueA",
-		"RegSetValueExA",
-		"RegSetValueExW",
-		"RegSetValueW",
-		"RegUnLoadKeyA",
-		"RegUnLoadKeyW",
-		"RegisterActiveObject",
-		"RegisterClassA",
-		"RegisterClassExA",
-		"RegisterClassExW",
-		"RegisterClassW",
-		"RegisterClipboardFormatA",
-		"RegisterClipboardFormatW",
-		"RegisterDragDrop",
-		"RegisterEventSourceA",
-		"RegisterEventSourceW",
-		"RegisterHotKey",
-		"RegisterServiceCtrlHandlerA",
-		"RegisterServiceCtrlHandlerExA",
-		"RegisterServiceCtrlHandlerExW",
-		"RegisterServiceCtrlHandlerW",
-		"RegisterTypeLib",
-		"RegisterWindowMessageA",
-		"RegisterWindowMessageW",
-		"ReleaseCapture",
-		"ReleaseDC",
-		"ReleaseMutex",
-		"ReleaseSemaphore",
-		"ReleaseStgMedium",
-		"RemoveDirectoryA",
-		"RemoveDirectoryW",
-		"RemoveFontResourceA",
-		"RemoveFontResourceW",
-		"RemoveMenu",
-		"RemovePropA",
-		"RemovePropW",
-		"ReplaceTextA",
-		"ReplaceTextW",
-		"ReplyMessage",
-		"ReportEventA",
-		"ReportEventW",
-		"ResetDCA",
-		"ResetDCW",
-		"ResetEvent",
-		"ResetPrinterA",
-		"ResetPrinterW",
-		"ResetWriteWatch",
-		"ResizePalette",
-		"RestoreDC",
-		"ResumeThread",
-		"ReuseDDElParam",
-		"RevertToSelf",
-		"RevokeActiveObject",
-		"RevokeDragDrop",
-		"RoundRect",
-		"RpcBindingCopy",
-		"RpcBindingFree",
-		"RpcBindingFromStringBindingA",
-		"RpcBindingFromStringBindingW",
-		"RpcBindingInqAuthClientA",
-		"RpcBindingInqAuthClientW",
-		"RpcBindingInqAuthInfoA",
-		"RpcBindingInqAuthInfoExA",
-		"RpcBindingInqAuthInfoExW",
-		"RpcBindingInqAuthInfoW",
-		"RpcBindingInqObject",
-		"RpcBindingReset",
-		"RpcBindingServerFromClient",
-		"RpcBindingSetAuthInfoA",
-		"RpcBindingSetAuthInfoExA",
-		"RpcBindingSetAuthInfoExW",
-		"RpcBindingSetAuthInfoW",
-		"RpcBindingSetObject",
-		"RpcBindingToStringBindingA",
-		"RpcBindingToStringBindingW",
-		"RpcBindingVectorFree",
-		"RpcCancelThread",
-		"RpcEpRegisterA",
-		"RpcEpRegisterNoReplaceA",
-		"RpcEpRegisterNoReplaceW",
-		"RpcEpRegisterW",
-		"RpcEpResolveBinding",
-		"RpcEpUnregister",
-		"RpcIfIdVectorFree",
-		"RpcIfInqId",
-		"RpcImpersonateClient",
-		"RpcMgmtBindingInqParameter",
-		"RpcMgmtBindingSetParameter",
-		"RpcMgmtEnableIdleCleanup",
-		"RpcMgmtEpEltInqBegin",
-		"RpcMgmtEpEltInqDone",
-		"RpcMgmtEpEltInqNextA",
-		"RpcMgmtEpEltInqNextW",
-		"RpcMgmtEpUnregister",
-		"RpcMgmtInqComTimeout",
-		"RpcMgmtInqDefaultProtectLevel",
-		"RpcMgmtInqIfIds",
-		"RpcMgmtInqParameter",
-		"RpcMgmtInqServerPrincNameA",
-		"RpcMgmtInqServerPrincNameW",
-		"RpcMgmtInqStats",
-		"RpcMgmtIsServerListening",
-		"RpcMgmtSetAuthorizationFn",
-		"RpcMgmtSetCancelTimeout",
-		"RpcMgmtSetComTimeout",
-		"RpcMgmtSetParameter",
-		"RpcMgmtSetServerStackSize",
-		"RpcMgmtStatsVectorFree",
-		"RpcMgmtStopServerListening",
-		"RpcMgmtWaitServerListen",
-		"RpcNetworkInqProtseqsA",
-		"RpcNetworkInqProtseqsW",
-		"RpcNetworkIsProtseqValidA",
-		"RpcNetworkIsProtseqValidW",
-		"RpcNsBindingExportA",
-		"RpcNsBindingExportW",
-		"RpcNsBindingImportBeginA",
-		"RpcNsBindingImportBeginW",
-		"RpcNsBindingImportDone",
-		"RpcNsBindingImportNext",
-		"RpcNsBindingInqEntryNameA",
-		"RpcNsBindingInqEntryNameW",
-		"RpcNsBindingLookupBeginA",
-		"RpcNsBindingLookupBeginW",
-		"RpcNsBindingLookupDone",
-		"RpcNsBindingLookupNext",
-		"RpcNsBindingSelect",
-		"RpcNsBindingUnexportA",
-		"RpcNsBindingUnexportW",
-		"RpcNsEntryExpandNameA",
-		"RpcNsEntryExpandNameW",
-		"RpcNsEntryObjectInqBeginA",
-		"RpcNsEntryObjectInqBeginW",
-		"RpcNsEntryObjectInqDone",
-		"RpcNsEntryObjectInqNext",
-		"RpcNsGroupDeleteA",
-		"RpcNsGroupDeleteW",
-		"RpcNsGroupMbrAddA",
-		"RpcNsGroupMbrAddW",
-		"RpcNsGroupMbrInqBeginA",
-		"RpcNsGroupMbrInqBeginW",
-		"RpcNsGroupMbrInqDone",
-		"RpcNsGroupMbrInqNextA",
-		"RpcNsGroupMbrInqNextW",
-		"RpcNsGroupMbrRemoveA",
-		"RpcNsGroupMbrRemoveW",
-		"RpcNsMgmtBindingUnexportA",
-		"RpcNsMgmtBindingUnexportW",
-		"RpcNsMgmtEntryCreateA",
-		"RpcNsMgmtEntryCreateW",
-		"RpcNsMgmtEntryDeleteA",
-		"RpcNsMgmtEntryDeleteW",
-		"RpcNsMgmtEntryInqIfIdsA",
-		"RpcNsMgmtEntryInqIfIdsW",
-		"RpcNsMgmtHandleSetExpAge",
-		"RpcNsMgmtInqExpAge",
-		"RpcNsMgmtSetExpAge",
-		"RpcNsProfileDeleteA",
-		"RpcNsProfileDeleteW",
-		"RpcNsProfileEltAddA",
-		"RpcNsProfileEltAddW",
-		"RpcNsProfileEltInqBeginA",
-		"RpcNsProfileEltInqBeginW",
-		"RpcNsProfileEltInqDone",
-		"RpcNsProfileEltInqNextA",
-		"RpcNsProfileEltInqNextW",
-		"RpcNsProfileEltRemoveA",
-		"RpcNsProfileEltRemoveW",
-		"RpcObjectInqType",
-		"RpcObjectSetType",
-		"RpcProtseqVectorFreeA",
-		"RpcProtseqVectorFreeW",
-		"RpcRaiseException",
-		"RpcRevertToSelf",
-		"RpcServerInqDefaultPrincNameA",
-		"RpcServerInqDefaultPrincNameW",
-		"RpcServerInqIf",
-		"RpcServerListen",
-		"RpcServerRegisterAuthInfoA",
-		"RpcServerRegisterAuthInfoW",
-		"RpcServerRegisterIf",
-		"RpcServerUnregisterIf",
-		"RpcServerUseAllProtseqs",
-		"RpcServerUseAllProtseqsEx",
-		"RpcServerUseAllProtseqsIf",
-		"RpcServerUseAllProtseqsIfEx",
-		"RpcServerUseProtseqA",
-		"RpcServerUseProtseqEpA",
-		"RpcServerUseProtseqEpExA",
-		"RpcServerUseProtseqEpExW",
-		"RpcServerUseProtseqEpW",
-		"RpcServerUseProtseqExA",
-		"RpcServerUseProtseqExW",
-		"RpcServerUseProtseqIfA",
-		"RpcServerUseProtseqIfExA",
-		"RpcServerUseProtseqIfExW",
-		"RpcServerUseProtseqIfW",
-		"RpcServerUseProtseqW",
-		"RpcSmAllocate",
-		"RpcSmClientFree",
-		"RpcSmDestroyClientContext",
-		"RpcSmDisableAllocate",
-		"RpcSmEnableAllocate",
-		"RpcSmFree",
-		"RpcSmGetThreadHandle",
-		"RpcSmSetThreadHandle",
-		"RpcSsAllocate",
-		"RpcSsDestroyClientContext",
-		"RpcSsDisableAllocate",
-		"RpcSsDontSerializeContext",
-		"RpcSsEnableAllocate",
-		"RpcSsFree",
-		"RpcSsGetThreadHandle",
-		"RpcSsSetThreadHandle",
-		"RpcStringBindingComposeA",
-		"RpcStringBindingComposeW",
-		"RpcStringBindingParseA",
-		"RpcStringBindingParseW",
-		"RpcStringFreeA",
-		"RpcStringFreeW",
-		"RpcTestCancel",
-		"SHAppBarMessage",
-		"SHEmptyRecycleBinA",
-		"SHEmptyRecycleBinW",
-		"SHFileOperationA",
-		"SHFileOperationW",
-		"SHFreeNameMappings",
-		"SHGetFileInfoA",
-		"SHGetFileInfoW",
-		"SHQueryRecycleBinA",
-		"SHQueryRecycleBinW",
-		"SNB_free_inst",
-		"SNB_free_xmit",
-		"SNB_from_xmit",
-		"SNB_to_xmit",
-		"SafeArrayAccessData",
-		"SafeArrayAllocData",
-		"SafeArrayAllocDescriptor",
-		"SafeArrayAllocDescriptorEx",
-		"SafeArrayCopy",
-		"SafeArrayCreate",
-		"SafeArrayCreateVector",
-		"SafeArrayCreateVectorEx",
-		"SafeArrayDestroy",
-		"SafeArrayDestroyData",
-		"SafeArrayDestroyDescriptor",
-		"SafeArrayGetDim",
-		"SafeArrayGetElement",
-		"SafeArrayGetElemsize",
-		"SafeArrayGetIID",
-		"SafeArrayGetLBound",
-		"SafeArrayGetRecordInfo",
-		"SafeArrayGetUBound",
-		"SafeArrayGetVartype",
-		"SafeArrayLock",
-		"SafeArrayPtrOfIndex",
-		"SafeArrayPutElement",
-		"SafeArrayRedim",
-		"SafeArraySetIID",
-		"SafeArraySetRecordInfo",
-		"SafeArrayUnaccessData",
-		"SafeArrayUnlock",
-		"SaveDC",
-		"ScaleViewportExtEx",
-		"ScaleWindowExtEx",
-		"ScheduleJob",
-		"ScreenToClient",
-		"ScrollConsoleScreenBufferA",
-		"ScrollConsoleScreenBufferW",
-		"ScrollDC",
-		"ScrollWindow",
-		"ScrollWindowEx",
-		"SearchPathA",
-		"SearchPathW",
-		"SelectClipPath",
-		"SelectClipRgn",
-		"SelectObject",
-		"SelectPalette",
-		"SendDlgItemMessageA",
-		"SendDlgItemMessageW",
-		"SendDriverMessage",
-		"SendMessageA",
-		"SendMessageCallbackA",
-		"SendMessageCallbackW",
-		"SendMessageTimeoutA",
-		"SendMessageTimeoutW",
-		"SendMessageW",
-		"SendNotifyMessageA",
-		"SendNotifyMessageW",
-		"SetAbortProc",
-		"SetAclInformation",
-		"SetActiveWindow",
-		"SetArcDirection",
-		"SetBitmapBits",
-		"SetBitmapDimensionEx",
-		"SetBkColor",
-		"SetBkMode",
-		"SetBoundsRect",
-		"SetBrushOrgEx",
-		"SetCalendarInfoA",
-		"SetCalendarInfoW",
-		"SetCapture",
-		"SetCaretBlinkTime",
-		"SetCaretPos",
-		"SetClassLongA",
-		"SetClassLongW",
-		"SetClassWord",
-		"SetClipboardData",
-		"SetClipboardViewer",
-		"SetColorAdjustment",
-		"SetColorSpace",
-		"SetCommBreak",
-		"SetCommConfig",
-		"SetCommMask",
-		"SetCommState",
-		"SetCommTimeouts",
-		"SetComputerNameA",
-		"SetComputerNameW",
-		"SetConsoleActiveScreenBuffer",
-		"SetConsoleCP",
-		"SetConsoleCtrlHandler",
-		"SetConsoleCursorInfo",
-		"SetConsoleCursorPosition",
-		"SetConsoleMode",
-		"SetConsoleOutputCP",
-		"SetConsoleScreenBufferSize",
-		"SetConsoleTextAttribute",
-		"SetConsoleTitleA",
-		"SetConsoleTitleW",
-		"SetConsoleWindowInfo",
-		"SetConvertStg",
-		"SetCriticalSectionSpinCount",
-		"SetCurrentDirectoryA",
-		"SetCurrentDirectoryW",
-		"SetCursor",
-		"SetCursorPos",
-		"SetDIBColorTable",
-		"SetDIBits",
-		"SetDIBitsToDevice",
-		"SetDebugErrorLevel",
-		"SetDefaultCommConfigA",
-		"SetDefaultCommConfigW",
-		"SetDeviceGammaRamp",
-		"SetDlgItemInt",
-		"SetDlgItemTextA",
-		"SetDlgItemTextW",
-		"SetDoubleClickTime",
-		"SetEndOfFile",
-		"SetEnhMetaFileBits",
-		"SetEnvironmentVariableA",
-		"SetEnvironmentVariableW",
-		"SetErrorInfo",
-		"SetErrorMode",
-		"SetEvent",
-		"SetFileApisToANSI",
-		"SetFileApisToOEM",
-		"SetFileAttributesA",
-		"SetFileAttributesW",
-		"SetFilePointer",
-		"SetFilePointerEx",
-		"SetFileSecurityA",
-		"SetFileSecurityW",
-		"SetFileTime",
-		"SetFocus",
-		"SetForegroundWindow",
-		"SetFormA",
-		"SetFormW",
-		"SetGraphicsMode",
-		"SetHandleCount",
-		"SetHandleInformation",
-		"SetICMMode",
-		"SetICMProfileA",
-		"SetICMProfileW",
-		"SetJobA",
-		"SetJobW",
-		"SetKernelObjectSecurity",
-		"SetKeyboardState",
-		"SetLastError",
-		"SetLastErrorEx",
-		"SetLocalTime",
-		"SetLocaleInfoA",
-		"SetLocaleInfoW",
-		"SetMailslotInfo",
-		"SetMapMode",
-		"SetMapperFlags",
-		"SetMenu",
-		"SetMenuContextHelpId",
-		"SetMenuDefaultItem",
-		"SetMenuInfo",
-		"SetMenuItemBitmaps",
-		"SetMenuItemInfoA",
-		"SetMenuItemInfoW",
-		"SetMessageExtraInfo",
-		"SetMessageQueue",
-		"SetMetaFileBitsEx",
-		"SetMetaRgn",
-		"SetMiterLimit",
-		"SetNamedPipeHandleState",
-		"SetPaletteEntries",
-		"SetParent",
-		"SetPixel",
-		"SetPixelFormat",
-		"SetPixelV",
-		"SetPolyFillMode",
-		"SetPrinterA",
-		"SetPrinterDataA",
-		"SetPrinterDataW",
-		"SetPrinterW",
-		"SetPriorityClass",
-		"SetPrivateObjectSecurity",
-		"SetProcessAffinityMask",
-		"SetProcessPriorityBoost",
-		"SetProcessShutdownParameters",
-		"SetProcessWindowStation",
-		"SetProcessWorkingSetSize",
-		"SetPropA",
-		"SetPropW",
-		"SetROP2",
-		"SetRect",
-		"SetRectEmpty",
-		"SetRectRgn",
-		"SetScrollInfo",
-		"SetScrollPos",
-		"SetScrollRange",
-		"SetSecurityDescriptorControl",
-		"SetSecurityDescriptorDacl",
-		"SetSecurityDescriptorGroup",
-		"SetSecurityDescriptorOwner",
-		"SetSecurityDescriptorSacl",
-		"SetServiceObjectSecurity",
-		"SetServiceStatus",
-		"SetStdHandle",
-		"SetStretchBltMode",
-		"SetSysColors",
-		"SetSystemCursor",
-		"SetSystemPaletteUse",
-		"SetSystemPowerState",
-		"SetSystemTime",
-		"SetSystemTimeAdjustment",
-		"SetTapeParameters",
-		"SetTapePosition",
-		"SetTextAlign",
-		"SetTextCharacterExtra",
-		"SetTextColor",
-		"SetTextJustification",
-		"SetThreadAffinityMask",
-		"SetThreadContext",
-		"SetThreadDesktop",
-		"SetThreadIdealProcessor",
-		"SetThreadLocale",
-		"SetThreadPriority",
-		"SetThreadPriorityBoost",
-		"SetThreadToken",
-		"SetTimeZoneInformation",
-		"SetTimer",
-		"SetTokenInformation",
-		"SetUnhandledExceptionFilter",
-		"SetUserGeoID",
-		"SetUserObjectInformationA",
-		"SetUserObjectInformationW",
-		"SetUserObjectSecurity",
-		"SetViewportExtEx",
-		"SetViewportOrgEx",
-		"SetVolumeLabelA",
-		"SetVolumeLabelW",
-		"SetWaitableTimer",
-		"SetWinMetaFileBits",
-		"SetWindowContextHelpId",
-		"SetWindowExtEx",
-		"SetWindowLongA",
-		"SetWindowLongW",
-		"SetWindowOrgEx",
-		"SetWindowPlacement",
-		"SetWindowPos",
-		"SetWindowRgn",
-		"SetWindowTextA",
-		"SetWindowTextW",
-		"SetWindowWord",
-		"SetWindowsHookA",
-		"SetWindowsHookExA",
-		"SetWindowsHookExW",
-		"SetWindowsHookW",
-		"SetWorldTransform",
-		"SetupComm",
-		"ShellAboutA",
-		"ShellAboutW",
-		"ShellExecuteA",
-		"ShellExecuteExA",
-		"ShellExecuteExW",
-		"ShellExecuteW",
-		"Shell_NotifyIconA",
-		"Shell_NotifyIconW",
-		"ShowCaret",
-		"ShowCursor",
-		"ShowOwnedPopups",
-		"ShowScrollBar",
-		"ShowWindow",
-		"ShowWindowAsync",
-		"SignalObjectAndWait",
-		"SizeofResource",
-		"Sleep",
-		"SleepEx",
-		"StartDocA",
-		"StartDocPrinterA",
-		"StartDocPrinterW",
-		"StartDocW",
-		"StartPage",
-		"StartPagePrinter",
-		"StartServiceA",
-		"StartServiceCtrlDispatcherA",
-		"StartServiceCtrlDispatcherW",
-		"StartServiceW",
-		"StgCreateDocfile",
-		"StgCreateDocfileOnILockBytes",
-		"StgCreateStorageEx",
-		"StgIsStorageFile",
-		"StgIsStorageILockBytes",
-		"StgOpenStorage",
-		"StgOpenStorageEx",
-		"StgOpenStorageOnILockBytes",
-		"StgSetTimes",
-		"StretchBlt",
-		"StretchDIBits",
-		"StringFromCLSID",
-		"StringFromGUID2",
-		"StringFromIID",
-		"StrokeAndFillPath",
-		"StrokePath",
-		"SubtractRect",
-		"SuspendThread",
-		"SwapBuffers",
-		"SwapMouseButton",
-		"SwitchDesktop",
-		"SwitchToFiber",
-		"SwitchToThread",
-		"SysAllocString",
-		"SysAllocStringByteLen",
-		"SysAllocStringLen",
-		"SysFreeString",
-		"SysReAllocString",
-		"SysReAllocStringLen",
-		"SysStringByteLen",
-		"SysStringLen",
-		"SystemParametersInfoA",
-		"SystemParametersInfoW",
-		"SystemTimeToFileTime",
-		"SystemTimeToTzSpecificLocalTime",
-		"SystemTimeToVariantTime",
-		"TabbedTextOutA",
-		"TabbedTextOutW",
-		"TerminateProcess",
-		"TerminateThread",
-		"TextOutA",
-		"TextOutW",
-		"TileWindows",
-		"TlsAlloc",
-		"TlsFree",
-		"TlsGetValue",
-		"TlsSetValue",
-		"ToAscii",
-		"ToAsciiEx",
-		"ToUnicode",
-		"ToUnicodeEx",
-		"TrackMouseEvent",
-		"TrackPopupMenu",
-		"TrackPopupMenuEx",
-		"TransactNamedPipe",
-		"TranslateAcceleratorA",
-		"TranslateAcceleratorW",
-		"TranslateCharsetInfo",
-		"TranslateMDISysAccel",
-		"TranslateMessage",
-		"TransmitCommChar",
-		"TryEnterCriticalSection",
-		"UnRegisterTypeLib",
-		"UnhandledExceptionFilter",
-		"UnhookWindowsHook",
-		"UnhookWindowsHookEx",
-		"UnionRect",
-		"UnloadKeyboardLayout",
-		"UnlockFile",
-		"UnlockFileEx",
-		"UnlockServiceDatabase",
-		"UnmapViewOfFile",
-		"UnpackDDElParam",
-		"UnrealizeObject",
-		"UnregisterClassA",
-		"UnregisterClassW",
-		"UnregisterHotKey",
-		"UpdateColors",
-		"UpdateICMRegKeyA",
-		"UpdateICMRegKeyW",
-		"UpdateResourceA",
-		"UpdateResourceW",
-		"UpdateWindow",
-		"UuidCompare",
-		"UuidCreate",
-		"UuidCreateNil",
-		"UuidEqual",
-		"UuidFromStringA",
-		"UuidFromStringW",
-		"UuidHash",
-		"UuidIsNil",
-		"UuidToStringA",
-		"UuidToStringW",
-		"ValidateRect",
-		"ValidateRgn",
-		"VarAbs",
-		"VarAdd",
-		"VarAnd",
-		"VarBoolFromCy",
-		"VarBoolFromDate",
-		"VarBoolFromDec",
-		"VarBoolFromDisp",
-		"VarBoolFromI1",
-		"VarBoolFromI2",
-		"VarBoolFromI4",
-		"VarBoolFromI8",
-		"VarBoolFromR4",
-		"VarBoolFromR8",
-		"VarBoolFromStr",
-		"VarBoolFromUI1",
-		"VarBoolFromUI2",
-		"VarBoolFromUI4",
-		"VarBoolFromUI8",
-		"VarBstrCat",
-		"VarBstrCmp",
-		"VarBstrFromBool",
-		"VarBstrFromCy",
-		"VarBstrFromDate",
-		"VarBstrFromDec",
-		"VarBstrFromDisp",
-		"VarBstrFromI1",
-		"VarBstrFromI2",
-		"VarBstrFromI4",
-		"VarBstrFromI8",
-		"VarBstrFromR4",
-		"VarBstrFromR8",
-		"VarBstrFromUI1",
-		"VarBstrFromUI2",
-		"VarBstrFromUI4",
-		"VarBstrFromUI8",
-		"VarCat",
-		"VarCmp",
-		"VarCyAbs",
-		"VarCyAdd",
-		"VarCyCmp",
-		"VarCyCmpR8",
-		"VarCyFix",
-		"VarCyFromBool",
-		"VarCyFromDate",
-		"VarCyFromDec",
-		"VarCyFromDisp",
-		"VarCyFromI1",
-		"VarCyFromI2",
-		"VarCyFromI4",
-		"VarCyFromI8",
-		"VarCyFromR4",
-		"VarCyFromR8",
-		"VarCyFromStr",
-		"VarCyFromUI1",
-		"VarCyFromUI2",
-		"VarCyFromUI4",
-		"VarCyFromUI8",
-		"VarCyInt",
-		"VarCyMul",
-		"VarCyMulI4",
-		"VarCyMulI8",
-		"VarCyNeg",
-		"VarCyRound",
-		"VarCySub",
-		"VarDateFromBool",
-		"VarDateFromCy",
-		"VarDateFromDec",
-		"VarDateFromDisp",
-		"VarDateFromI1",
-		"VarDateFromI2",
-		"VarDateFromI4",
-		"VarDateFromI8",
-		"VarDateFromR4",
-		"VarDateFromR8",
-		"VarDateFromStr",
-		"VarDateFromUI1",
-		"VarDateFromUI2",
-		"VarDateFromUI4",
-		"VarDateFromUI8",
-		"VarDateFromUdate",
-		"VarDateFromUdateEx",
-		"VarDecAbs",
-		"VarDecAdd",
-		"VarDecCmp",
-		"VarDecCmpR8",
-		"VarDecDiv",
-		"VarDecFix",
-		"VarDecFromBool",
-		"VarDecFromCy",
-		"VarDecFromDate",
-		"VarDecFromDisp",
-		"VarDecFromI1",
-		"VarDecFromI2",
-		"VarDecFromI4",
-		"VarDecFromI8",
-		"VarDecFromR4",
-		"VarDecFromR8",
-		"VarDecFromStr",
-		"VarDecFromUI1",
-		"VarDecFromUI2",
-		"VarDecFromUI4",
-		"VarDecFromUI8",
-		"VarDecInt",
-		"VarDecMul",
-		"VarDecNeg",
-		"VarDecRound",
-		"VarDecSub",
-		"VarDiv",
-		"VarEqv",
-		"VarFix",
-		"VarI1FromBool",
-		"VarI1FromCy",
-		"VarI1FromDate",
-		"VarI1FromDec",
-		"VarI1FromDisp",
-		"VarI1FromI2",
-		"VarI1FromI4",
-		"VarI1FromI8",
-		"VarI1FromR4",
-		"VarI1FromR8",
-		"VarI1FromStr",
-		"VarI1FromUI1",
-		"VarI1FromUI2",
-		"VarI1FromUI4",
-		"VarI1FromUI8",
-		"VarI2FromBool",
-		"VarI2FromCy",
-		"VarI2FromDate",
-		"VarI2FromDec",
-		"VarI2FromDisp",
-		"VarI2FromI1",
-		"VarI2FromI4",
-		"VarI2FromI8",
-		"VarI2FromR4",
-		"VarI2FromR8",
-		"VarI2FromStr",
-		"VarI2FromUI1",
-		"VarI2FromUI2",
-		"VarI2FromUI4",
-		"VarI2FromUI8",
-		"VarI4FromBool",
-		"VarI4FromCy",
-		"VarI4FromDate",
-		"VarI4FromDec",
-		"VarI4FromDisp",
-		"VarI4FromI1",
-		"VarI4FromI2",
-		"VarI4FromI8",
-		"VarI4FromR4",
-		"VarI4FromR8",
-		"VarI4FromStr",
-		"VarI4FromUI1",
-		"VarI4FromUI2",
-		"VarI4FromUI4",
-		"VarI4FromUI8",
-		"VarI8FromBool",
-		"VarI8FromCy",
-		"VarI8FromDate",
-		"VarI8FromDec",
-		"VarI8FromDisp",
-		"VarI8FromI1",
-		"VarI8FromI2",
-		"VarI8FromI4",
-		"VarI8FromInt",
-		"VarI8FromR4",
-		"VarI8FromR8",
-		"VarI8FromStr",
-		"VarI8FromUI1",
-		"VarI8FromUI2",
-		"VarI8FromUI4",
-		"VarI8FromUI8",
-		"VarIdiv",
-		"VarImp",
-		"VarInt",
-		"VarMod",
-		"VarMul",
-		"VarNeg",
-		"VarNot",
-		"VarNumFromParseNum",
-		"VarOr",
-		"VarParseNumFromStr",
-		"VarPow",
-		"VarR4CmpR8",
-		"VarR4FromBool",
-		"VarR4FromCy",
-		"VarR4FromDate",
-		"VarR4FromDec",
-		"VarR4FromDisp",
-		"VarR4FromI1",
-		"VarR4FromI2",
-		"VarR4FromI4",
-		"VarR4FromI8",
-		"VarR4FromR8",
-		"VarR4FromStr",
-		"VarR4FromUI1",
-		"VarR4FromUI2",
-		"VarR4FromUI4",
-		"VarR4FromUI8",
-		"VarR8FromBool",
-		"VarR8FromCy",
-		"VarR8FromDate",
-		"VarR8FromDec",
-		"VarR8FromDisp",
-		"VarR8FromI1",
-		"VarR8FromI2",
-		"VarR8FromI4",
-		"VarR8FromI8",
-		"VarR8FromR4",
-		"VarR8FromStr",
-		"VarR8FromUI1",
-		"VarR8FromUI2",
-		"VarR8FromUI4",
-		"VarR8FromUI8",
-		"VarR8Pow",
-		"VarR8Round",
-		"VarRound",
-		"VarSub",
-		"VarUI1FromBool",
-		"VarUI1FromCy",
-		"VarUI1FromDate",
-		"VarUI1FromDec",
-		"VarUI1FromDisp",
-		"VarUI1FromI1",
-		"VarUI1FromI2",
-		"VarUI1FromI4",
-		"VarUI1FromI8",
-		"VarUI1FromR4",
-		"VarUI1FromR8",
-		"VarUI1FromStr",
-		"VarUI1FromUI2",
-		"VarUI1FromUI4",
-		"VarUI1FromUI8",
-		"VarUI2FromBool",
-		"VarUI2FromCy",
-		"VarUI2FromDate",
-		"VarUI2FromDec",
-		"VarUI2FromDisp",
-		"VarUI2FromI1",
-		"VarUI2FromI2",
-		"VarUI2FromI4",
-		"VarUI2FromI8",
-		"VarUI2FromR4",
-		"VarUI2FromR8",
-		"VarUI2FromStr",
-		"VarUI2FromUI1",
-		"VarUI2FromUI4",
-		"VarUI2FromUI8",
-		"VarUI4FromBool",
-		"VarUI4FromCy",
-		"VarUI4FromDate",
-		"VarUI4FromDec",
-		"VarUI4FromDisp",
-		"VarUI4FromI1",
-		"VarUI4FromI2",
-		"VarUI4FromI4",
-		"VarUI4FromI8",
-		"VarUI4FromR4",
-		"VarUI4FromR8",
-		"VarUI4FromStr",
-		"VarUI4FromUI1",
-		"VarUI4FromUI2",
-		"VarUI4FromUI8",
-		"VarUI8FromBool",
-		"VarUI8FromCy",
-		"VarUI8FromDate",
-		"VarUI8FromDec",
-		"VarUI8FromDisp",
-		"VarUI8FromI1",
-		"VarUI8FromI2",
-		"VarUI8FromI4",
-		"VarUI8FromI8",
-		"VarUI8FromInt",
-		"VarUI8FromR4",
-		"VarUI8FromR8",
-		"VarUI8FromStr",
-		"VarUI8FromUI1",
-		"VarUI8FromUI2",
-		"VarUI8FromUI4",
-		"VarUdateFromDate",
-		"VarXor",
-		"VariantChangeType",
-		"VariantChangeTypeEx",
-		"VariantClear",
-		"VariantCopy",
-		"VariantCopyInd",
-		"VariantInit",
-		"VariantTimeToDosDateTime",
-		"VariantTimeToSystemTime",
-		"VectorFromBstr",
-		"VerFindFileA",
-		"VerFindFileW",
-		"VerInstallFileA",
-		"VerInstallFileW",
-		"VerLanguageNameA",
-		"VerLanguageNameW",
-		"VerQueryValueA",
-		"VerQueryValueW",
-		"VerifyVersionInfoA",
-		"VerifyVersionInfoW",
-		"VirtualAlloc",
-		"VirtualAllocEx",
-		"VirtualFree",
-		"VirtualFreeEx",
-		"VirtualLock",
-		"VirtualProtect",
-		"VirtualProtectEx",
-		"VirtualQuery",
-		"VirtualQueryEx",
-		"VirtualUnlock",
-		"VkKeyScanA",
-		"VkKeyScanExA",
-		"VkKeyScanExW",
-		"VkKeyScanW",
-		"WNetAddConnection2A",
-		"WNetAddConnection2W",
-		"WNetAddConnection3A",
-		"WNetAddConnection3W",
-		"WNetAddConnectionA",
-		"WNetAddConnectionW",
-		"WNetCancelConnection2A",
-		"WNetCancelConnection2W",
-		"WNetCancelConnectionA",
-		"WNetCancelConnectionW",
-		"WNetCloseEnum",
-		"WNetConnectionDialog",
-		"WNetConnectionDialog1A",
-		"WNetConnectionDialog1W",
-		"WNetDisconnectDialog",
-		"WNetDisconnectDialog1A",
-		"WNetDisconnectDialog1W",
-		"WNetEnumResourceA",
-		"WNetEnumResourceW",
-		"WNetGetConnectionA",
-		"WNetGetConnectionW",
-		"WNetGetLastErrorA",
-		"WNetGetLastErrorW",
-		"WNetGetNetworkInformationA",
-		"WNetGetNetworkInformationW",
-		"WNetGetProviderNameA",
-		"WNetGetProviderNameW",
-		"WNetGetResourceInformationA",
-		"WNetGetResourceInformationW",
-		"WNetGetResourceParentA",
-		"WNetGetResourceParentW",
-		"WNetGetUniversalNameA",
-		"WNetGetUniversalNameW",
-		"WNetGetUserA",
-		"WNetGetUserW",
-		"WNetOpenEnumA",
-		"WNetOpenEnumW",
-		"WNetSetConnectionA",
-		"WNetSetConnectionW",
-		"WNetUseConnectionA",
-		"WNetUseConnectionW",
-		"WSAAccept",
-		"WSAAddressToStringA",
-		"WSAAddressToStringW",
-		"WSAAsyncGetHostByAddr",
-		"WSAAsyncGetHostByName",
-		"WSAAsyncGetProtoByName",
-		"WSAAsyncGetProtoByNumber",
-		"WSAAsyncGetServByName",
-		"WSAAsyncGetServByPort",
-		"WSAAsyncSelect",
-		"WSACancelAsyncRequest",
-		"WSACancelBlockingCall",
-		"WSACleanup",
-		"WSACloseEvent",
-		"WSAConnect",
-		"WSACreateEvent",
-		"WSADuplicateSocketA",
-		"WSADuplicateSocketW",
-		"WSAEnumNameSpaceProvidersA",
-		"WSAEnumNameSpaceProvidersW",
-		"WSAEnumNetworkEvents",
-		"WSAEnumProtocolsA",
-		"WSAEnumProtocolsW",
-		"WSAEventSelect",
-		"WSAGetLastError",
-		"WSAGetOverlappedResult",
-		"WSAGetQOSByName",
-		"WSAGetServiceClassInfoA",
-		"WSAGetServiceClassInfoW",
-		"WSAGetServiceClassNameByClassIdA",
-		"WSAGetServiceClassNameByClassIdW",
-		"WSAHtonl",
-		"WSAHtons",
-		"WSAInstallServiceClassA",
-		"WSAInstallServiceClassW",
-		"WSAIoctl",
-		"WSAIsBlocking",
-		"WSAJoinLeaf",
-		"WSALookupServiceBeginA",
-		"WSALookupServiceBeginW",
-		"WSALookupServiceEnd",
-		"WSALookupServiceNextA",
-		"WSALookupServiceNextW",
-		"WSANSPIoctl",
-		"WSANtohl",
-		"WSANtohs",
-		"WSARecv",
-		"WSARecvDisconnect",
-		"WSARecvFrom",
-		"WSARemoveServiceClass",
-		"WSAResetEvent",
-		"WSASend",
-		"WSASendDisconnect",
-		"WSASendTo",
-		"WSASetBlockingHook",
-		"WSASetEvent",
-		"WSASetLastError",
-		"WSASetServiceA",
-		"WSASetServiceW",
-		"WSASocketA",
-		"WSASocketW",
-		"WSAStartup",
-		"WSAStringToAddressA",
-		"WSAStringToAddressW",
-		"WSAUnhookBlockingHook",
-		"WSAWaitForMultipleEvents",
-		"WaitCommEvent",
-		"WaitForDebugEvent",
-		"WaitForInputIdle",
-		"WaitForMultipleObjects",
-		"WaitForMultipleObjectsEx",
-		"WaitForPrinterChange",
-		"WaitForSingleObject",
-		"WaitForSingleObjectEx",
-		"WaitMessage",
-		"WaitNamedPipeA",
-		"WaitNamedPipeW",
-		"WideCharToMultiByte",
-		"WidenPath",
-		"WinExec",
-		"WinHelpA",
-		"WinHelpW",
-		"WinLoadTrustProvider",
-		"WinMain",
-		"WindowFromDC",
-		"WindowFromPoint",
-		"WriteClassStg",
-		"WriteClassStm",
-		"WriteConsoleA",
-		"WriteConsoleInputA",
-		"WriteConsoleInputW",
-		"WriteConsoleOutputA",
-		"WriteConsoleOutputAttribute",
-		"WriteConsoleOutputCharacterA",
-		"WriteConsoleOutputCharacterW",
-		"WriteConsoleOutputW",
-		"WriteConsoleW",
-		"WriteFile",
-		"WriteFileEx",
-		"WriteFileGather",
-		"WriteFmtUserTypeStg",
-		"WritePrinter",
-		"WritePrivateProfileSectionA",
-		"WritePrivateProfileSectionW",
-		"WritePrivateProfileStringA",
-		"WritePrivateProfileStringW",
-		"WritePrivateProfileStructA",
-		"WritePrivateProfileStructW",
-		"WriteProcessMemory",
-		"WriteProfileSectionA",
-		"WriteProfileSectionW",
-		"WriteProfileStringA",
-		"WriteProfileStringW",
-		"WriteTapemark",
-		"__WSAFDIsSet",
-		"_hread",
-		"_hwrite",
-		"_lclose",
-		"_lcreat",
-		"_llseek",
-		"_lopen",
-		"_lread",
-		"_lwrite",
-		"_open",
-		"_read",
-		"_write",
-		"accept",
-		"auxGetDevCapsA",
-		"auxGetDevCapsW",
-		"auxGetNumDevs",
-		"auxGetVolume",
-		"auxOutMessage",
-		"auxSetVolume",
-		"bind",
-		"char_array_from_ndr",
-		"char_from_ndr",
-		"closesocket",
-		"connect",
-		"data_from_ndr",
-		"data_into_ndr",
-		"data_size_ndr",
-		"double_array_from_ndr",
-		"double_from_ndr",
-		"enum_from_ndr",
-		"float_array_from_ndr",
-		"float_from_ndr",
-		"gethostbyaddr",
-		"gethostbyname",
-		"gethostname",
-		"getpeername",
-		"getprotobyname",
-		"getprotobynumber",
-		"getservbyname",
-		"getservbyport",
-		"getsockname",
-		"getsockopt",
-		"htonl",
-		"htons",
-		"hyper_array_from_ndr",
-		"hyper_from_ndr",
-		"hyper_from_ndr_temp",
-		"inet_addr",
-		"inet_ntoa",
-		"ioctlsocket",
-		"joyGetDevCapsA",
-		"joyGetDevCapsW",
-		"joyGetNumDevs",
-		"joyGetPos",
-		"joyGetPosEx",
-		"joyGetThreshold",
-		"joyReleaseCapture",
-		"joySetCapture",
-		"joySetThreshold",
-		"keybd_event",
-		"listen",
-		"long_array_from_ndr",
-		"long_from_ndr",
-		"long_from_ndr_temp",
-		"lstrcatA",
-		"lstrcatW",
-		"lstrcmpA",
-		"lstrcmpW",
-		"lstrcmpiA",
-		"lstrcmpiW",
-		"lstrcpyA",
-		"lstrcpyW",
-		"lstrcpynA",
-		"lstrcpynW",
-		"lstrlenA",
-		"lstrlenW",
-		"mciGetCreatorTask",
-		"mciGetDeviceIDA",
-		"mciGetDeviceIDFromElementIDA",
-		"mciGetDeviceIDFromElementIDW",
-		"mciGetDeviceIDW",
-		"mciGetErrorStringA",
-		"mciGetErrorStringW",
-		"mciGetYieldProc",
-		"mciSendCommandA",
-		"mciSendCommandW",
-		"mciSendStringA",
-		"mciSendStringW",
-		"mciSetYieldProc",
-		"midiConnect",
-		"midiDisconnect",
-		"midiInAddBuffer",
-		"midiInClose",
-		"midiInGetDevCapsA",
-		"midiInGetDevCapsW",
-		"midiInGetErrorTextA",
-		"midiInGetErrorTextW",
-		"midiInGetID",
-		"midiInGetNumDevs",
-		"midiInMessage",
-		"midiInOpen",
-		"midiInPrepareHeader",
-		"midiInReset",
-		"midiInStart",
-		"midiInStop",
-		"midiInUnprepareHeader",
-		"midiOutCacheDrumPatches",
-		"midiOutCachePatches",
-		"midiOutClose",
-		"midiOutGetDevCapsA",
-		"midiOutGetDevCapsW",
-		"midiOutGetErrorTextA",
-		"midiOutGetErrorTextW",
-		"midiOutGetID",
-		"midiOutGetNumDevs",
-		"midiOutGetVolume",
-		"midiOutLongMsg",
-		"midiOutMessage",
-		"midiOutOpen",
-		"midiOutPrepareHeader",
-		"midiOutReset",
-		"midiOutSetVolume",
-		"midiOutShortMsg",
-		"midiOutUnprepareHeader",
-		"midiStreamClose",
-		"midiStreamOpen",
-		"midiStreamOut",
-		"midiStreamPause",
-		"midiStreamPosition",
-		"midiStreamProperty",
-		"midiStreamRestart",
-		"midiStreamStop",
-		"midl_allocate",
-		"mixerClose",
-		"mixerGetControlDetailsA",
-		"mixerGetControlDetailsW",
-		"mixerGetDevCapsA",
-		"mixerGetDevCapsW",
-		"mixerGetID",
-		"mixerGetLineControlsA",
-		"mixerGetLineControlsW",
-		"mixerGetLineInfoA",
-		"mixerGetLineInfoW",
-		"mixerGetNumDevs",
-		"mixerMessage",
-		"mixerOpen",
-		"mixerSetControlDetails",
-		"mmioAdvance",
-		"mmioAscend",
-		"mmioClose",
-		"mmioCreateChunk",
-		"mmioDescend",
-		"mmioFlush",
-		"mmioGetInfo",
-		"mmioInstallIOProcA",
-		"mmioInstallIOProcW",
-		"mmioOpenA",
-		"mmioOpenW",
-		"mmioRead",
-		"mmioRenameA",
-		"mmioRenameW",
-		"mmioSeek",
-		"mmioSendMessage",
-		"mmioSetBuffer",
-		"mmioSetInfo",
-		"mmioStringToFOURCCA",
-		"mmioStringToFOURCCW",
-		"mmioWrite",
-		"mmsystemGetVersion",
-		"mouse_event",
-		"ntohl",
-		"ntohs",
-		"recv",
-		"recvfrom",
-		"select",
-		"send",
-		"sendto",
-		"setsockopt",
-		"short_array_from_ndr",
-		"short_from_ndr",
-		"short_from_ndr_temp",
-		"shutdown",
-		"sndPlaySoundA",
-		"sndPlaySoundW",
-		"socket",
-		"timeBeginPeriod",
-		"timeEndPeriod",
-		"timeGetDevCaps",
-		"timeGetSystemTime",
-		"timeGetTime",
-		"timeKillEvent",
-		"timeSetEvent",
-		"tree_into_ndr",
-		"tree_peek_ndr",
-		"tree_size_ndr",
-		"wWinMain",
-		"waveInAddBuffer",
-		"waveInClose",
-		"waveInGetDevCapsA",
-		"waveInGetDevCapsW",
-		"waveInGetErrorTextA",
-		"waveInGetErrorTextW",
-		"waveInGetID",
-		"waveInGetNumDevs",
-		"waveInGetPosition",
-		"waveInMessage",
-		"waveInOpen",
-		"waveInPrepareHeader",
-		"waveInReset",
-		"waveInStart",
-		"waveInStop",
-		"waveInUnprepareHeader",
-		"waveOutBreakLoop",
-		"waveOutClose",
-		"waveOutGetDevCapsA",
-		"waveOutGetDevCapsW",
-		"waveOutGetErrorTextA",
-		"waveOutGetErrorTextW",
-		"waveOutGetID",
-		"waveOutGetNumDevs",
-		"waveOutGetPitch",
-		"waveOutGetPlaybackRate",
-		"waveOutGetPosition",
-		"waveOutGetVolume",
-		"waveOutMessage",
-		"waveOutOpen",
-		"waveOutPause",
-		"waveOutPrepareHeader",
-		"waveOutReset",
-		"waveOutRestart",
-		"waveOutSetPitch",
-		"waveOutSetPlaybackRate",
-		"waveOutSetVolume",
-		"waveOutUnprepareHeader",
-		"waveOutWrite",
-		"wglCopyContext",
-		"wglCreateContext",
-		"wglCreateLayerContext",
-		"wglDeleteContext",
-		"wglDescribeLayerPlane",
-		"wglGetCurrentContext",
-		"wglGetCurrentDC",
-		"wglGetLayerPaletteEntries",
-		"wglGetProcAddress",
-		"wglMakeCurrent",
-		"wglRealizeLayerPalette",
-		"wglSetLayerPaletteEntries",
-		"wglShareLists",
-		"wglSwapLayerBuffers",
-		"wglUseFontBitmapsA",
-		"wglUseFontBitmapsW",
-		"wglUseFontOutlinesA",
-		"wglUseFontOutlinesW",
-		"wsprintfA",
-		"wsprintfW",
-		"wvsprintfA",
-		"wvsprintfW",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(WINDOWS_H_FUNCS, "windows.h", m);
-
-	return m;
-}
+/// Header files of the functions, sorted by function names.
+constexpr FuncCHeader FUNC_C_HEADERS[] = {
+	{"AbortDoc", "windows.h"},
+	{"AbortPath", "windows.h"},
+	{"AbortPrinter", "windows.h"},
+	{"AbortSystemShutdownA", "windows.h"},
+	{"AbortSystemShutdownW", "windows.h"},
+	{"AccessCheck", "windows.h"},
+	{"AccessCheckAndAuditAlarmA", "windows.h"},
+	{"AccessCheckAndAuditAlarmW", "windows.h"},
+	{"ActivateKeyboardLayout", "windows.h"},
+	{"AddAccessAllowedAce", "windows.h"},
+	{"AddAccessDeniedAce", "windows.h"},
+	{"AddAce", "windows.h"},
+	{"AddAtomA", "windows.h"},
+	{"AddAtomW", "windows.h"},
+	{"AddAuditAccessAce", "windows.h"},
+	{"AddFontResourceA", "windows.h"},
+	{"AddFontResourceW", "windows.h"},
+	{"AddFormA", "windows.h"},
+	{"AddFormW", "windows.h"},
+	{"AddJobA", "windows.h"},
+	{"AddJobW", "windows.h"},
+	{"AddMonitorA", "windows.h"},
+	{"AddMonitorW", "windows.h"},
+	{"AddPortA", "windows.h"},
+	{"AddPortW", "windows.h"},
+	{"AddPrintProcessorA", "windows.h"},
+	{"AddPrintProcessorW", "windows.h"},
+	{"AddPrintProvidorA", "windows.h"},
+	{"AddPrintProvidorW", "windows.h"},
+	{"AddPrinterA", "windows.h"},
+	{"AddPrinterConnectionA", "windows.h"},
+	{"AddPrinterConnectionW", "windows.h"},
+	{"AddPrinterDriverA", "windows.h"},
+	{"AddPrinterDriverW", "windows.h"},
+	{"AddPrinterW", "windows.h"},
+	{"AdjustTokenGroups", "windows.h"},
+	{"AdjustTokenPrivileges", "windows.h"},
+	{"AdjustWindowRect", "windows.h"},
+	{"AdjustWindowRectEx", "windows.h"},
+	{"AdvancedDocumentPropertiesA", "windows.h"},
+	{"AdvancedDocumentPropertiesW", "windows.h"},
+	{"AllocConsole", "windows.h"},
+	{"AllocateAndInitializeSid", "windows.h"},
+	{"AllocateLocallyUniqueId", "windows.h"},
+	{"AngleArc", "windows.h"},
+	{"AnimatePalette", "windows.h"},
+	{"AnyPopup", "windows.h"},
+	{"AppendMenuA", "windows.h"},
+	{"AppendMenuW", "windows.h"},
+	{"Arc", "windows.h"},
+	{"ArcTo", "windows.h"},
+	{"AreAllAccessesGranted", "windows.h"},
+	{"AreAnyAccessesGranted", "windows.h"},
+	{"AreFileApisANSI", "windows.h"},
+	{"ArrangeIconicWindows", "windows.h"},
+	{"AttachThreadInput", "windows.h"},
+	{"BackupEventLogA", "windows.h"},
+	{"BackupEventLogW", "windows.h"},
+	{"BackupRead", "windows.h"},
+	{"BackupSeek", "windows.h"},
+	{"BackupWrite", "windows.h"},
+	{"Beep", "windows.h"},
+	{"BeginDeferWindowPos", "windows.h"},
+	{"BeginPaint", "windows.h"},
+	{"BeginPath", "windows.h"},
+	{"BeginUpdateResourceA", "windows.h"},
+	{"BeginUpdateResourceW", "windows.h"},
+	{"BindMoniker", "windows.h"},
+	{"BitBlt", "windows.h"},
+	{"BringWindowToTop", "windows.h"},
+	{"BroadcastSystemMessage", "windows.h"},
+	{"BroadcastSystemMessageA", "windows.h"},
+	{"BroadcastSystemMessageW", "windows.h"},
+	{"BstrFromVector", "windows.h"},
+	{"BuildCommDCBA", "windows.h"},
+	{"BuildCommDCBAndTimeoutsA", "windows.h"},
+	{"BuildCommDCBAndTimeoutsW", "windows.h"},
+	{"BuildCommDCBW", "windows.h"},
+	{"CLSIDFromProgID", "windows.h"},
+	{"CLSIDFromString", "windows.h"},
+	{"CallMsgFilterA", "windows.h"},
+	{"CallMsgFilterW", "windows.h"},
+	{"CallNamedPipeA", "windows.h"},
+	{"CallNamedPipeW", "windows.h"},
+	{"CallNextHookEx", "windows.h"},
+	{"CallWindowProcA", "windows.h"},
+	{"CallWindowProcW", "windows.h"},
+	{"CancelDC", "windows.h"},
+	{"CancelDeviceWakeupRequest", "windows.h"},
+	{"CancelIo", "windows.h"},
+	{"CancelWaitableTimer", "windows.h"},
+	{"CascadeWindows", "windows.h"},
+	{"ChangeClipboardChain", "windows.h"},
+	{"ChangeDisplaySettingsA", "windows.h"},
+	{"ChangeDisplaySettingsExA", "windows.h"},
+	{"ChangeDisplaySettingsExW", "windows.h"},
+	{"ChangeDisplaySettingsW", "windows.h"},
+	{"ChangeMenuA", "windows.h"},
+	{"ChangeMenuW", "windows.h"},
+	{"ChangeServiceConfig2A", "windows.h"},
+	{"ChangeServiceConfig2W", "windows.h"},
+	{"ChangeServiceConfigA", "windows.h"},
+	{"ChangeServiceConfigW", "windows.h"},
+	{"CharLowerA", "windows.h"},
+	{"CharLowerBuffA", "windows.h"},
+	{"CharLowerBuffW", "windows.h"},
+	{"CharLowerW", "windows.h"},
+	{"CharNextA", "windows.h"},
+	{"CharNextExA", "windows.h"},
+	{"CharNextW", "windows.h"},
+	{"CharPrevA", "windows.h"},
+	{"CharPrevExA", "windows.h"},
+	{"CharPrevW", "windows.h"},
+	{"CharToOemA", "windows.h"},
+	{"CharToOemBuffA", "windows.h"},
+	{"CharToOemBuffW", "windows.h"},
+	{"CharToOemW", "windows.h"},
+	{"CharUpperA", "windows.h"},
+	{"CharUpperBuffA", "windows.h"},
+	{"CharUpperBuffW", "windows.h"},
+	{"CharUpperW", "windows.h"},
+	{"CheckColorsInGamut", "windows.h"},
+	{"CheckDlgButton", "windows.h"},
+	{"CheckMenuItem", "windows.h"},
+	{"CheckMenuRadioItem", "windows.h"},
+	{"CheckRadioButton", "windows.h"},
+	{"ChildWindowFromPoint", "windows.h"},
+	{"ChildWindowFromPointEx", "windows.h"},
+	{"ChooseColorA", "windows.h"},
+	{"ChooseColorW", "windows.h"},
+	{"ChooseFontA", "windows.h"},
+	{"ChooseFontW", "windows.h"},
+	{"ChoosePixelFormat", "windows.h"},
+	{"Chord", "windows.h"},
+	{"ClearCommBreak", "windows.h"},
+	{"ClearCommError", "windows.h"},
+	{"ClearEventLogA", "windows.h"},
+	{"ClearEventLogW", "windows.h"},
+	{"ClientToScreen", "windows.h"},
+	{"ClipCursor", "windows.h"},
+	{"CloseClipboard", "windows.h"},
+	{"CloseDesktop", "windows.h"},
+	{"CloseDriver", "windows.h"},
+	{"CloseEnhMetaFile", "windows.h"},
+	{"CloseEventLog", "windows.h"},
+	{"CloseFigure", "windows.h"},
+	{"CloseHandle", "windows.h"},
+	{"CloseMetaFile", "windows.h"},
+	{"ClosePrinter", "windows.h"},
+	{"CloseServiceHandle", "windows.h"},
+	{"CloseWindow", "windows.h"},
+	{"CloseWindowStation", "windows.h"},
+	{"CoAddRefServerProcess", "windows.h"},
+	{"CoBuildVersion", "windows.h"},
+	{"CoCopyProxy", "windows.h"},
+	{"CoCreateFreeThreadedMarshaler", "windows.h"},
+	{"CoCreateGuid", "windows.h"},
+	{"CoCreateInstance", "windows.h"},
+	{"CoCreateInstanceEx", "windows.h"},
+	{"CoCreateStandardMalloc", "windows.h"},
+	{"CoDisconnectObject", "windows.h"},
+	{"CoDosDateTimeToFileTime", "windows.h"},
+	{"CoFileTimeNow", "windows.h"},
+	{"CoFileTimeToDosDateTime", "windows.h"},
+	{"CoFreeAllLibraries", "windows.h"},
+	{"CoFreeLibrary", "windows.h"},
+	{"CoFreeUnusedLibraries", "windows.h"},
+	{"CoGetCallContext", "windows.h"},
+	{"CoGetClassObject", "windows.h"},
+	{"CoGetCurrentProcess", "windows.h"},
+	{"CoGetInstanceFromFile", "windows.h"},
+	{"CoGetInstanceFromIStorage", "windows.h"},
+	{"CoGetInterfaceAndReleaseStream", "windows.h"},
+	{"CoGetMalloc", "windows.h"},
+	{"CoGetMarshalSizeMax", "windows.h"},
+	{"CoGetObject", "windows.h"},
+	{"CoGetPSClsid", "windows.h"},
+	{"CoGetStandardMarshal", "windows.h"},
+	{"CoGetStdMarshalEx", "windows.h"},
+	{"CoGetTreatAsClass", "windows.h"},
+	{"CoHasStrongExternalConnections", "windows.h"},
+	{"CoImpersonateClient", "windows.h"},
+	{"CoInitialize", "windows.h"},
+	{"CoInitializeEx", "windows.h"},
+	{"CoInitializeSecurity", "windows.h"},
+	{"CoIsHandlerConnected", "windows.h"},
+	{"CoIsOle1Class", "windows.h"},
+	{"CoLoadLibrary", "windows.h"},
+	{"CoLockObjectExternal", "windows.h"},
+	{"CoMarshalHresult", "windows.h"},
+	{"CoMarshalInterThreadInterfaceInStream", "windows.h"},
+	{"CoMarshalInterface", "windows.h"},
+	{"CoQueryAuthenticationServices", "windows.h"},
+	{"CoQueryClientBlanket", "windows.h"},
+	{"CoQueryProxyBlanket", "windows.h"},
+	{"CoRegisterClassObject", "windows.h"},
+	{"CoRegisterMallocSpy", "windows.h"},
+	{"CoRegisterMessageFilter", "windows.h"},
+	{"CoRegisterPSClsid", "windows.h"},
+	{"CoReleaseMarshalData", "windows.h"},
+	{"CoReleaseServerProcess", "windows.h"},
+	{"CoResumeClassObjects", "windows.h"},
+	{"CoRevertToSelf", "windows.h"},
+	{"CoRevokeClassObject", "windows.h"},
+	{"CoRevokeMallocSpy", "windows.h"},
+	{"CoSetProxyBlanket", "windows.h"},
+	{"CoSuspendClassObjects", "windows.h"},
+	{"CoSwitchCallContext", "windows.h"},
+	{"CoTaskMemAlloc", "windows.h"},
+	{"CoTaskMemFree", "windows.h"},
+	{"CoTaskMemRealloc", "windows.h"},
+	{"CoTreatAsClass", "windows.h"},
+	{"CoUninitialize", "windows.h"},
+	{"CoUnmarshalHresult", "windows.h"},
+	{"CoUnmarshalInterface", "windows.h"},
+	{"CombineRgn", "windows.h"},
+	{"CombineTransform", "windows.h"},
+	{"CommConfigDialogA", "windows.h"},
+	{"CommConfigDialogW", "windows.h"},
+	{"CommDlgExtendedError", "windows.h"},
+	{"CommandLineToArgvW", "windows.h"},
+	{"CompareFileTime", "windows.h"},
+	{"CompareStringA", "windows.h"},
+	{"CompareStringW", "windows.h"},
+	{"ConfigurePortA", "windows.h"},
+	{"ConfigurePortW", "windows.h"},
+	{"ConnectNamedPipe", "windows.h"},
+	{"ConnectToPrinterDlg", "windows.h"},
+	{"ContinueDebugEvent", "windows.h"},
+	{"ControlService", "windows.h"},
+	{"ConvertDefaultLocale", "windows.h"},
+	{"ConvertFiberToThread", "windows.h"},
+	{"ConvertThreadToFiber", "windows.h"},
+	{"CopyAcceleratorTableA", "windows.h"},
+	{"CopyAcceleratorTableW", "windows.h"},
+	{"CopyEnhMetaFileA", "windows.h"},
+	{"CopyEnhMetaFileW", "windows.h"},
+	{"CopyFileA", "windows.h"},
+	{"CopyFileExA", "windows.h"},
+	{"CopyFileExW", "windows.h"},
+	{"CopyFileW", "windows.h"},
+	{"CopyIcon", "windows.h"},
+	{"CopyImage", "windows.h"},
+	{"CopyLZFile", "windows.h"},
+	{"CopyMetaFileA", "windows.h"},
+	{"CopyMetaFileW", "windows.h"},
+	{"CopyRect", "windows.h"},
+	{"CopySid", "windows.h"},
+	{"CountClipboardFormats", "windows.h"},
+	{"CreateAcceleratorTableA", "windows.h"},
+	{"CreateAcceleratorTableW", "windows.h"},
+	{"CreateAntiMoniker", "windows.h"},
+	{"CreateBindCtx", "windows.h"},
+	{"CreateBitmap", "windows.h"},
+	{"CreateBitmapIndirect", "windows.h"},
+	{"CreateBrushIndirect", "windows.h"},
+	{"CreateCaret", "windows.h"},
+	{"CreateColorSpaceA", "windows.h"},
+	{"CreateColorSpaceW", "windows.h"},
+	{"CreateCompatibleBitmap", "windows.h"},
+	{"CreateCompatibleDC", "windows.h"},
+	{"CreateConsoleScreenBuffer", "windows.h"},
+	{"CreateCursor", "windows.h"},
+	{"CreateDCA", "windows.h"},
+	{"CreateDCW", "windows.h"},
+	{"CreateDIBPatternBrush", "windows.h"},
+	{"CreateDIBPatternBrushPt", "windows.h"},
+	{"CreateDIBSection", "windows.h"},
+	{"CreateDIBitmap", "windows.h"},
+	{"CreateDataAdviseHolder", "windows.h"},
+	{"CreateDataCache", "windows.h"},
+	{"CreateDesktopA", "windows.h"},
+	{"CreateDesktopW", "windows.h"},
+	{"CreateDialogIndirectParamA", "windows.h"},
+	{"CreateDialogIndirectParamW", "windows.h"},
+	{"CreateDialogParamA", "windows.h"},
+	{"CreateDialogParamW", "windows.h"},
+	{"CreateDirectoryA", "windows.h"},
+	{"CreateDirectoryExA", "windows.h"},
+	{"CreateDirectoryExW", "windows.h"},
+	{"CreateDirectoryW", "windows.h"},
+	{"CreateDiscardableBitmap", "windows.h"},
+	{"CreateDispTypeInfo", "windows.h"},
+	{"CreateEllipticRgn", "windows.h"},
+	{"CreateEllipticRgnIndirect", "windows.h"},
+	{"CreateEnhMetaFileA", "windows.h"},
+	{"CreateEnhMetaFileW", "windows.h"},
+	{"CreateErrorInfo", "windows.h"},
+	{"CreateEventA", "windows.h"},
+	{"CreateEventW", "windows.h"},
+	{"CreateFiber", "windows.h"},
+	{"CreateFiberEx", "windows.h"},
+	{"CreateFileA", "windows.h"},
+	{"CreateFileMappingA", "windows.h"},
+	{"CreateFileMappingW", "windows.h"},
+	{"CreateFileMoniker", "windows.h"},
+	{"CreateFileW", "windows.h"},
+	{"CreateFontA", "windows.h"},
+	{"CreateFontIndirectA", "windows.h"},
+	{"CreateFontIndirectW", "windows.h"},
+	{"CreateFontW", "windows.h"},
+	{"CreateGenericComposite", "windows.h"},
+	{"CreateHalftonePalette", "windows.h"},
+	{"CreateHatchBrush", "windows.h"},
+	{"CreateICA", "windows.h"},
+	{"CreateICW", "windows.h"},
+	{"CreateILockBytesOnHGlobal", "windows.h"},
+	{"CreateIcon", "windows.h"},
+	{"CreateIconFromResource", "windows.h"},
+	{"CreateIconFromResourceEx", "windows.h"},
+	{"CreateIconIndirect", "windows.h"},
+	{"CreateIoCompletionPort", "windows.h"},
+	{"CreateItemMoniker", "windows.h"},
+	{"CreateMDIWindowA", "windows.h"},
+	{"CreateMDIWindowW", "windows.h"},
+	{"CreateMailslotA", "windows.h"},
+	{"CreateMailslotW", "windows.h"},
+	{"CreateMenu", "windows.h"},
+	{"CreateMetaFileA", "windows.h"},
+	{"CreateMetaFileW", "windows.h"},
+	{"CreateMutexA", "windows.h"},
+	{"CreateMutexW", "windows.h"},
+	{"CreateNamedPipeA", "windows.h"},
+	{"CreateNamedPipeW", "windows.h"},
+	{"CreateOleAdviseHolder", "windows.h"},
+	{"CreatePalette", "windows.h"},
+	{"CreatePatternBrush", "windows.h"},
+	{"CreatePen", "windows.h"},
+	{"CreatePenIndirect", "windows.h"},
+	{"CreatePipe", "windows.h"},
+	{"CreatePointerMoniker", "windows.h"},
+	{"CreatePolyPolygonRgn", "windows.h"},
+	{"CreatePolygonRgn", "windows.h"},
+	{"CreatePopupMenu", "windows.h"},
+	{"CreatePrivateObjectSecurity", "windows.h"},
+	{"CreateProcessA", "windows.h"},
+	{"CreateProcessAsUserA", "windows.h"},
+	{"CreateProcessAsUserW", "windows.h"},
+	{"CreateProcessW", "windows.h"},
+	{"CreateRectRgn", "windows.h"},
+	{"CreateRectRgnIndirect", "windows.h"},
+	{"CreateRemoteThread", "windows.h"},
+	{"CreateRoundRectRgn", "windows.h"},
+	{"CreateScalableFontResourceA", "windows.h"},
+	{"CreateScalableFontResourceW", "windows.h"},
+	{"CreateSemaphoreA", "windows.h"},
+	{"CreateSemaphoreW", "windows.h"},
+	{"CreateServiceA", "windows.h"},
+	{"CreateServiceW", "windows.h"},
+	{"CreateSolidBrush", "windows.h"},
+	{"CreateStdDispatch", "windows.h"},
+	{"CreateStreamOnHGlobal", "windows.h"},
+	{"CreateTapePartition", "windows.h"},
+	{"CreateThread", "windows.h"},
+	{"CreateTypeLib", "windows.h"},
+	{"CreateWaitableTimerA", "windows.h"},
+	{"CreateWaitableTimerW", "windows.h"},
+	{"CreateWindowExA", "windows.h"},
+	{"CreateWindowExW", "windows.h"},
+	{"CreateWindowStationA", "windows.h"},
+	{"CreateWindowStationW", "windows.h"},
+	{"DPtoLP", "windows.h"},
+	{"DceErrorInqTextA", "windows.h"},
+	{"DceErrorInqTextW", "windows.h"},
+	{"DdeAbandonTransaction", "windows.h"},
+	{"DdeAccessData", "windows.h"},
+	{"DdeAddData", "windows.h"},
+	{"DdeClientTransaction", "windows.h"},
+	{"DdeCmpStringHandles", "windows.h"},
+	{"DdeConnect", "windows.h"},
+	{"DdeConnectList", "windows.h"},
+	{"DdeCreateDataHandle", "windows.h"},
+	{"DdeCreateStringHandleA", "windows.h"},
+	{"DdeCreateStringHandleW", "windows.h"},
+	{"DdeDisconnect", "windows.h"},
+	{"DdeDisconnectList", "windows.h"},
+	{"DdeEnableCallback", "windows.h"},
+	{"DdeFreeDataHandle", "windows.h"},
+	{"DdeFreeStringHandle", "windows.h"},
+	{"DdeGetData", "windows.h"},
+	{"DdeGetLastError", "windows.h"},
+	{"DdeImpersonateClient", "windows.h"},
+	{"DdeInitializeA", "windows.h"},
+	{"DdeInitializeW", "windows.h"},
+	{"DdeKeepStringHandle", "windows.h"},
+	{"DdeNameService", "windows.h"},
+	{"DdePostAdvise", "windows.h"},
+	{"DdeQueryConvInfo", "windows.h"},
+	{"DdeQueryNextServer", "windows.h"},
+	{"DdeQueryStringA", "windows.h"},
+	{"DdeQueryStringW", "windows.h"},
+	{"DdeReconnect", "windows.h"},
+	{"DdeSetQualityOfService", "windows.h"},
+	{"DdeSetUserHandle", "windows.h"},
+	{"DdeUnaccessData", "windows.h"},
+	{"DdeUninitialize", "windows.h"},
+	{"DebugActiveProcess", "windows.h"},
+	{"DebugBreak", "windows.h"},
+	{"DefDlgProcA", "windows.h"},
+	{"DefDlgProcW", "windows.h"},
+	{"DefDriverProc", "windows.h"},
+	{"DefFrameProcA", "windows.h"},
+	{"DefFrameProcW", "windows.h"},
+	{"DefMDIChildProcA", "windows.h"},
+	{"DefMDIChildProcW", "windows.h"},
+	{"DefWindowProcA", "windows.h"},
+	{"DefWindowProcW", "windows.h"},
+	{"DeferWindowPos", "windows.h"},
+	{"DefineDosDeviceA", "windows.h"},
+	{"DefineDosDeviceW", "windows.h"},
+	{"DeleteAce", "windows.h"},
+	{"DeleteAtom", "windows.h"},
+	{"DeleteColorSpace", "windows.h"},
+	{"DeleteCriticalSection", "windows.h"},
+	{"DeleteDC", "windows.h"},
+	{"DeleteEnhMetaFile", "windows.h"},
+	{"DeleteFiber", "windows.h"},
+	{"DeleteFileA", "windows.h"},
+	{"DeleteFileW", "windows.h"},
+	{"DeleteFormA", "windows.h"},
+	{"DeleteFormW", "windows.h"},
+	{"DeleteMenu", "windows.h"},
+	{"DeleteMetaFile", "windows.h"},
+	{"DeleteMonitorA", "windows.h"},
+	{"DeleteMonitorW", "windows.h"},
+	{"DeleteObject", "windows.h"},
+	{"DeletePortA", "windows.h"},
+	{"DeletePortW", "windows.h"},
+	{"DeletePrintProcessorA", "windows.h"},
+	{"DeletePrintProcessorW", "windows.h"},
+	{"DeletePrintProvidorA", "windows.h"},
+	{"DeletePrintProvidorW", "windows.h"},
+	{"DeletePrinter", "windows.h"},
+	{"DeletePrinterConnectionA", "windows.h"},
+	{"DeletePrinterConnectionW", "windows.h"},
+	{"DeletePrinterDataA", "windows.h"},
+	{"DeletePrinterDataW", "windows.h"},
+	{"DeletePrinterDriverA", "windows.h"},
+	{"DeletePrinterDriverW", "windows.h"},
+	{"DeleteService", "windows.h"},
+	{"DeregisterEventSource", "windows.h"},
+	{"DeregisterShellHookWindow", "windows.h"},
+	{"DescribePixelFormat", "windows.h"},
+	{"DestroyAcceleratorTable", "windows.h"},
+	{"DestroyCaret", "windows.h"},
+	{"DestroyCursor", "windows.h"},
+	{"DestroyIcon", "windows.h"},
+	{"DestroyMenu", "windows.h"},
+	{"DestroyPrivateObjectSecurity", "windows.h"},
+	{"DestroyWindow", "windows.h"},
+	{"DeviceCapabilitiesA", "windows.h"},
+	{"DeviceCapabilitiesW", "windows.h"},
+	{"DeviceIoControl", "windows.h"},
+	{"DialogBoxIndirectParamA", "windows.h"},
+	{"DialogBoxIndirectParamW", "windows.h"},
+	{"DialogBoxParamA", "windows.h"},
+	{"DialogBoxParamW", "windows.h"},
+	{"DisableThreadLibraryCalls", "windows.h"},
+	{"DisconnectNamedPipe", "windows.h"},
+	{"DispGetIDsOfNames", "windows.h"},
+	{"DispGetParam", "windows.h"},
+	{"DispInvoke", "windows.h"},
+	{"DispatchMessageA", "windows.h"},
+	{"DispatchMessageW", "windows.h"},
+	{"DlgDirListA", "windows.h"},
+	{"DlgDirListComboBoxA", "windows.h"},
+	{"DlgDirListComboBoxW", "windows.h"},
+	{"DlgDirListW", "windows.h"},
+	{"DlgDirSelectComboBoxExA", "windows.h"},
+	{"DlgDirSelectComboBoxExW", "windows.h"},
+	{"DlgDirSelectExA", "windows.h"},
+	{"DlgDirSelectExW", "windows.h"},
+	{"DllCanUnloadNow", "windows.h"},
+	{"DllGetClassObject", "windows.h"},
+	{"DoDragDrop", "windows.h"},
+	{"DocumentPropertiesA", "windows.h"},
+	{"DocumentPropertiesW", "windows.h"},
+	{"DosDateTimeToFileTime", "windows.h"},
+	{"DosDateTimeToVariantTime", "windows.h"},
+	{"DragAcceptFiles", "windows.h"},
+	{"DragDetect", "windows.h"},
+	{"DragFinish", "windows.h"},
+	{"DragObject", "windows.h"},
+	{"DragQueryFileA", "windows.h"},
+	{"DragQueryFileW", "windows.h"},
+	{"DragQueryPoint", "windows.h"},
+	{"DrawAnimatedRects", "windows.h"},
+	{"DrawCaption", "windows.h"},
+	{"DrawEdge", "windows.h"},
+	{"DrawEscape", "windows.h"},
+	{"DrawFocusRect", "windows.h"},
+	{"DrawFrameControl", "windows.h"},
+	{"DrawIcon", "windows.h"},
+	{"DrawIconEx", "windows.h"},
+	{"DrawMenuBar", "windows.h"},
+	{"DrawStateA", "windows.h"},
+	{"DrawStateW", "windows.h"},
+	{"DrawTextA", "windows.h"},
+	{"DrawTextExA", "windows.h"},
+	{"DrawTextExW", "windows.h"},
+	{"DrawTextW", "windows.h"},
+	{"DrvGetModuleHandle", "windows.h"},
+	{"DuplicateHandle", "windows.h"},
+	{"DuplicateIcon", "windows.h"},
+	{"DuplicateToken", "windows.h"},
+	{"DuplicateTokenEx", "windows.h"},
+	{"Ellipse", "windows.h"},
+	{"EmptyClipboard", "windows.h"},
+	{"EnableEUDC", "windows.h"},
+	{"EnableMenuItem", "windows.h"},
+	{"EnableScrollBar", "windows.h"},
+	{"EnableWindow", "windows.h"},
+	{"EncryptFileA", "windows.h"},
+	{"EncryptFileW", "windows.h"},
+	{"EndDeferWindowPos", "windows.h"},
+	{"EndDialog", "windows.h"},
+	{"EndDoc", "windows.h"},
+	{"EndDocPrinter", "windows.h"},
+	{"EndMenu", "windows.h"},
+	{"EndPage", "windows.h"},
+	{"EndPagePrinter", "windows.h"},
+	{"EndPaint", "windows.h"},
+	{"EndPath", "windows.h"},
+	{"EndUpdateResourceA", "windows.h"},
+	{"EndUpdateResourceW", "windows.h"},
+	{"EnterCriticalSection", "windows.h"},
+	{"EnumCalendarInfoA", "windows.h"},
+	{"EnumCalendarInfoW", "windows.h"},
+	{"EnumChildWindows", "windows.h"},
+	{"EnumClipboardFormats", "windows.h"},
+	{"EnumDateFormatsA", "windows.h"},
+	{"EnumDateFormatsW", "windows.h"},
+	{"EnumDependentServicesA", "windows.h"},
+	{"EnumDependentServicesW", "windows.h"},
+	{"EnumDesktopWindows", "windows.h"},
+	{"EnumDesktopsA", "windows.h"},
+	{"EnumDesktopsW", "windows.h"},
+	{"EnumDisplayDevicesA", "windows.h"},
+	{"EnumDisplayDevicesW", "windows.h"},
+	{"EnumDisplayMonitors", "windows.h"},
+	{"EnumDisplaySettingsA", "windows.h"},
+	{"EnumDisplaySettingsW", "windows.h"},
+	{"EnumEnhMetaFile", "windows.h"},
+	{"EnumFontFamiliesA", "windows.h"},
+	{"EnumFontFamiliesExA", "windows.h"},
+	{"EnumFontFamiliesExW", "windows.h"},
+	{"EnumFontFamiliesW", "windows.h"},
+	{"EnumFontsA", "windows.h"},
+	{"EnumFontsW", "windows.h"},
+	{"EnumFormsA", "windows.h"},
+	{"EnumFormsW", "windows.h"},
+	{"EnumICMProfilesA", "windows.h"},
+	{"EnumICMProfilesW", "windows.h"},
+	{"EnumJobsA", "windows.h"},
+	{"EnumJobsW", "windows.h"},
+	{"EnumMetaFile", "windows.h"},
+	{"EnumMonitorsA", "windows.h"},
+	{"EnumMonitorsW", "windows.h"},
+	{"EnumObjects", "windows.h"},
+	{"EnumPortsA", "windows.h"},
+	{"EnumPortsW", "windows.h"},
+	{"EnumPrintProcessorDatatypesA", "windows.h"},
+	{"EnumPrintProcessorDatatypesW", "windows.h"},
+	{"EnumPrintProcessorsA", "windows.h"},
+	{"EnumPrintProcessorsW", "windows.h"},
+	{"EnumPrinterDataA", "windows.h"},
+	{"EnumPrinterDataW", "windows.h"},
+	{"EnumPrinterDriversA", "windows.h"},
+	{"EnumPrinterDriversW", "windows.h"},
+	{"EnumPrintersA", "windows.h"},
+	{"EnumPrintersW", "windows.h"},
+	{"EnumPropsA", "windows.h"},
+	{"EnumPropsExA", "windows.h"},
+	{"EnumPropsExW", "windows.h"},
+	{"EnumPropsW", "windows.h"},
+	{"EnumResourceLanguagesA", "windows.h"},
+	{"EnumResourceLanguagesW", "windows.h"},
+	{"EnumResourceNamesA", "windows.h"},
+	{"EnumResourceNamesW", "windows.h"},
+	{"EnumResourceTypesA", "windows.h"},
+	{"EnumResourceTypesW", "windows.h"},
+	{"EnumServicesStatusA", "windows.h"},
+	{"EnumServicesStatusExA", "windows.h"},
+	{"EnumServicesStatusExW", "windows.h"},
+	{"EnumServicesStatusW", "windows.h"},
+	{"EnumSystemCodePagesA", "windows.h"},
+	{"EnumSystemCodePagesW", "windows.h"},
+	{"EnumSystemGeoID", "windows.h"},
+	{"EnumSystemLocalesA", "windows.h"},
+	{"EnumSystemLocalesW", "windows.h"},
+	{"EnumThreadWindows", "windows.h"},
+	{"EnumTimeFormatsA", "windows.h"},
+	{"EnumTimeFormatsW", "windows.h"},
+	{"EnumWindowStationsA", "windows.h"},
+	{"EnumWindowStationsW", "windows.h"},
+	{"EnumWindows", "windows.h"},
+	{"EqualPrefixSid", "windows.h"},
+	{"EqualRect", "windows.h"},
+	{"EqualRgn", "windows.h"},
+	{"EqualSid", "windows.h"},
+	{"EraseTape", "windows.h"},
+	{"Escape", "windows.h"},
+	{"EscapeCommFunction", "windows.h"},
+	{"ExcludeClipRect", "windows.h"},
+	{"ExcludeUpdateRgn", "windows.h"},
+	{"ExitProcess", "windows.h"},
+	{"ExitThread", "windows.h"},
+	{"ExitWindowsEx", "windows.h"},
+	{"ExpandEnvironmentStringsA", "windows.h"},
+	{"ExpandEnvironmentStringsW", "windows.h"},
+	{"ExtCreatePen", "windows.h"},
+	{"ExtCreateRegion", "windows.h"},
+	{"ExtEscape", "windows.h"},
+	{"ExtFloodFill", "windows.h"},
+	{"ExtSelectClipRgn", "windows.h"},
+	{"ExtTextOutA", "windows.h"},
+	{"ExtTextOutW", "windows.h"},
+	{"ExtractAssociatedIconA", "windows.h"},
+	{"ExtractAssociatedIconW", "windows.h"},
+	{"ExtractIconA", "windows.h"},
+	{"ExtractIconExA", "windows.h"},
+	{"ExtractIconExW", "windows.h"},
+	{"ExtractIconW", "windows.h"},
+	{"FatalAppExitA", "windows.h"},
+	{"FatalAppExitW", "windows.h"},
+	{"FatalExit", "windows.h"},
+	{"FileEncryptionStatusA", "windows.h"},
+	{"FileEncryptionStatusW", "windows.h"},
+	{"FileTimeToDosDateTime", "windows.h"},
+	{"FileTimeToLocalFileTime", "windows.h"},
+	{"FileTimeToSystemTime", "windows.h"},
+	{"FillConsoleOutputAttribute", "windows.h"},
+	{"FillConsoleOutputCharacterA", "windows.h"},
+	{"FillConsoleOutputCharacterW", "windows.h"},
+	{"FillPath", "windows.h"},
+	{"FillRect", "windows.h"},
+	{"FillRgn", "windows.h"},
+	{"FindAtomA", "windows.h"},
+	{"FindAtomW", "windows.h"},
+	{"FindClose", "windows.h"},
+	{"FindCloseChangeNotification", "windows.h"},
+	{"FindClosePrinterChangeNotification", "windows.h"},
+	{"FindExecutableA", "windows.h"},
+	{"FindExecutableW", "windows.h"},
+	{"FindFirstChangeNotificationA", "windows.h"},
+	{"FindFirstChangeNotificationW", "windows.h"},
+	{"FindFirstFileA", "windows.h"},
+	{"FindFirstFileExA", "windows.h"},
+	{"FindFirstFileExW", "windows.h"},
+	{"FindFirstFileW", "windows.h"},
+	{"FindFirstFreeAce", "windows.h"},
+	{"FindFirstPrinterChangeNotification", "windows.h"},
+	{"FindNextChangeNotification", "windows.h"},
+	{"FindNextFileA", "windows.h"},
+	{"FindNextFileW", "windows.h"},
+	{"FindNextPrinterChangeNotification", "windows.h"},
+	{"FindResourceA", "windows.h"},
+	{"FindResourceExA", "windows.h"},
+	{"FindResourceExW", "windows.h"},
+	{"FindResourceW", "windows.h"},
+	{"FindTextA", "windows.h"},
+	{"FindTextW", "windows.h"},
+	{"FindWindowA", "windows.h"},
+	{"FindWindowExA", "windows.h"},
+	{"FindWindowExW", "windows.h"},
+	{"FindWindowW", "windows.h"},
+	{"FixBrushOrgEx", "windows.h"},
+	{"FlashWindow", "windows.h"},
+	{"FlattenPath", "windows.h"},
+	{"FloodFill", "windows.h"},
+	{"FlushConsoleInputBuffer", "windows.h"},
+	{"FlushFileBuffers", "windows.h"},
+	{"FlushInstructionCache", "windows.h"},
+	{"FlushViewOfFile", "windows.h"},
+	{"FoldStringA", "windows.h"},
+	{"FoldStringW", "windows.h"},
+	{"FormatMessageA", "windows.h"},
+	{"FormatMessageW", "windows.h"},
+	{"FrameRect", "windows.h"},
+	{"FrameRgn", "windows.h"},
+	{"FreeConsole", "windows.h"},
+	{"FreeDDElParam", "windows.h"},
+	{"FreeEnvironmentStringsA", "windows.h"},
+	{"FreeEnvironmentStringsW", "windows.h"},
+	{"FreeLibrary", "windows.h"},
+	{"FreeLibraryAndExitThread", "windows.h"},
+	{"FreePrinterNotifyInfo", "windows.h"},
+	{"FreeResource", "windows.h"},
+	{"FreeSid", "windows.h"},
+	{"GdiComment", "windows.h"},
+	{"GdiFlush", "windows.h"},
+	{"GdiGetBatchLimit", "windows.h"},
+	{"GdiSetBatchLimit", "windows.h"},
+	{"GenerateConsoleCtrlEvent", "windows.h"},
+	{"GetACP", "windows.h"},
+	{"GetAce", "windows.h"},
+	{"GetAclInformation", "windows.h"},
+	{"GetActiveObject", "windows.h"},
+	{"GetActiveWindow", "windows.h"},
+	{"GetAltTabInfoA", "windows.h"},
+	{"GetAltTabInfoW", "windows.h"},
+	{"GetAncestor", "windows.h"},
+	{"GetArcDirection", "windows.h"},
+	{"GetAspectRatioFilterEx", "windows.h"},
+	{"GetAsyncKeyState", "windows.h"},
+	{"GetAtomNameA", "windows.h"},
+	{"GetAtomNameW", "windows.h"},
+	{"GetBinaryTypeA", "windows.h"},
+	{"GetBinaryTypeW", "windows.h"},
+	{"GetBitmapBits", "windows.h"},
+	{"GetBitmapDimensionEx", "windows.h"},
+	{"GetBkColor", "windows.h"},
+	{"GetBkMode", "windows.h"},
+	{"GetBoundsRect", "windows.h"},
+	{"GetBrushOrgEx", "windows.h"},
+	{"GetCPInfo", "windows.h"},
+	{"GetCPInfoExA", "windows.h"},
+	{"GetCPInfoExW", "windows.h"},
+	{"GetCalendarInfoA", "windows.h"},
+	{"GetCalendarInfoW", "windows.h"},
+	{"GetCapture", "windows.h"},
+	{"GetCaretBlinkTime", "windows.h"},
+	{"GetCaretPos", "windows.h"},
+	{"GetCharABCWidthsA", "windows.h"},
+	{"GetCharABCWidthsFloatA", "windows.h"},
+	{"GetCharABCWidthsFloatW", "windows.h"},
+	{"GetCharABCWidthsW", "windows.h"},
+	{"GetCharWidth32A", "windows.h"},
+	{"GetCharWidth32W", "windows.h"},
+	{"GetCharWidthA", "windows.h"},
+	{"GetCharWidthFloatA", "windows.h"},
+	{"GetCharWidthFloatW", "windows.h"},
+	{"GetCharWidthW", "windows.h"},
+	{"GetCharacterPlacementA", "windows.h"},
+	{"GetCharacterPlacementW", "windows.h"},
+	{"GetClassFile", "windows.h"},
+	{"GetClassInfoA", "windows.h"},
+	{"GetClassInfoExA", "windows.h"},
+	{"GetClassInfoExW", "windows.h"},
+	{"GetClassInfoW", "windows.h"},
+	{"GetClassLongA", "windows.h"},
+	{"GetClassLongW", "windows.h"},
+	{"GetClassNameA", "windows.h"},
+	{"GetClassNameW", "windows.h"},
+	{"GetClassWord", "windows.h"},
+	{"GetClientRect", "windows.h"},
+	{"GetClipBox", "windows.h"},
+	{"GetClipCursor", "windows.h"},
+	{"GetClipRgn", "windows.h"},
+	{"GetClipboardData", "windows.h"},
+	{"GetClipboardFormatNameA", "windows.h"},
+	{"GetClipboardFormatNameW", "windows.h"},
+	{"GetClipboardOwner", "windows.h"},
+	{"GetClipboardViewer", "windows.h"},
+	{"GetColorAdjustment", "windows.h"},
+	{"GetColorSpace", "windows.h"},
+	{"GetComboBoxInfo", "windows.h"},
+	{"GetCommConfig", "windows.h"},
+	{"GetCommMask", "windows.h"},
+	{"GetCommModemStatus", "windows.h"},
+	{"GetCommProperties", "windows.h"},
+	{"GetCommState", "windows.h"},
+	{"GetCommTimeouts", "windows.h"},
+	{"GetCommandLineA", "windows.h"},
+	{"GetCommandLineW", "windows.h"},
+	{"GetCompressedFileSizeA", "windows.h"},
+	{"GetCompressedFileSizeW", "windows.h"},
+	{"GetComputerNameA", "windows.h"},
+	{"GetComputerNameW", "windows.h"},
+	{"GetConsoleCP", "windows.h"},
+	{"GetConsoleCursorInfo", "windows.h"},
+	{"GetConsoleMode", "windows.h"},
+	{"GetConsoleOutputCP", "windows.h"},
+	{"GetConsoleScreenBufferInfo", "windows.h"},
+	{"GetConsoleTitleA", "windows.h"},
+	{"GetConsoleTitleW", "windows.h"},
+	{"GetConvertStg", "windows.h"},
+	{"GetCurrencyFormatA", "windows.h"},
+	{"GetCurrencyFormatW", "windows.h"},
+	{"GetCurrentDirectoryA", "windows.h"},
+	{"GetCurrentDirectoryW", "windows.h"},
+	{"GetCurrentHwProfileA", "windows.h"},
+	{"GetCurrentHwProfileW", "windows.h"},
+	{"GetCurrentObject", "windows.h"},
+	{"GetCurrentPositionEx", "windows.h"},
+	{"GetCurrentProcess", "windows.h"},
+	{"GetCurrentProcessId", "windows.h"},
+	{"GetCurrentThread", "windows.h"},
+	{"GetCurrentThreadId", "windows.h"},
+	{"GetCursor", "windows.h"},
+	{"GetCursorInfo", "windows.h"},
+	{"GetCursorPos", "windows.h"},
+	{"GetDC", "windows.h"},
+	{"GetDCEx", "windows.h"},
+	{"GetDCOrgEx", "windows.h"},
+	{"GetDIBColorTable", "windows.h"},
+	{"GetDIBits", "windows.h"},
+	{"GetDateFormatA", "windows.h"},
+	{"GetDateFormatW", "windows.h"},
+	{"GetDefaultCommConfigA", "windows.h"},
+	{"GetDefaultCommConfigW", "windows.h"},
+	{"GetDesktopWindow", "windows.h"},
+	{"GetDeviceCaps", "windows.h"},
+	{"GetDeviceGammaRamp", "windows.h"},
+	{"GetDevicePowerState", "windows.h"},
+	{"GetDialogBaseUnits", "windows.h"},
+	{"GetDiskFreeSpaceA", "windows.h"},
+	{"GetDiskFreeSpaceExA", "windows.h"},
+	{"GetDiskFreeSpaceExW", "windows.h"},
+	{"GetDiskFreeSpaceW", "windows.h"},
+	{"GetDlgCtrlID", "windows.h"},
+	{"GetDlgItem", "windows.h"},
+	{"GetDlgItemInt", "windows.h"},
+	{"GetDlgItemTextA", "windows.h"},
+	{"GetDlgItemTextW", "windows.h"},
+	{"GetDoubleClickTime", "windows.h"},
+	{"GetDriveTypeA", "windows.h"},
+	{"GetDriveTypeW", "windows.h"},
+	{"GetDriverModuleHandle", "windows.h"},
+	{"GetEnhMetaFileA", "windows.h"},
+	{"GetEnhMetaFileBits", "windows.h"},
+	{"GetEnhMetaFileDescriptionA", "windows.h"},
+	{"GetEnhMetaFileDescriptionW", "windows.h"},
+	{"GetEnhMetaFileHeader", "windows.h"},
+	{"GetEnhMetaFilePaletteEntries", "windows.h"},
+	{"GetEnhMetaFilePixelFormat", "windows.h"},
+	{"GetEnhMetaFileW", "windows.h"},
+	{"GetEnvironmentStrings", "windows.h"},
+	{"GetEnvironmentStringsA", "windows.h"},
+	{"GetEnvironmentStringsW", "windows.h"},
+	{"GetEnvironmentVariableA", "windows.h"},
+	{"GetEnvironmentVariableW", "windows.h"},
+	{"GetErrorInfo", "windows.h"},
+	{"GetExitCodeProcess", "windows.h"},
+	{"GetExitCodeThread", "windows.h"},
+	{"GetExpandedNameA", "windows.h"},
+	{"GetExpandedNameW", "windows.h"},
+	{"GetFileAttributesA", "windows.h"},
+	{"GetFileAttributesExA", "windows.h"},
+	{"GetFileAttributesExW", "windows.h"},
+	{"GetFileAttributesW", "windows.h"},
+	{"GetFileInformationByHandle", "windows.h"},
+	{"GetFileSecurityA", "windows.h"},
+	{"GetFileSecurityW", "windows.h"},
+	{"GetFileSize", "windows.h"},
+	{"GetFileTime", "windows.h"},
+	{"GetFileTitleA", "windows.h"},
+	{"GetFileTitleW", "windows.h"},
+	{"GetFileType", "windows.h"},
+	{"GetFileVersionInfoA", "windows.h"},
+	{"GetFileVersionInfoSizeA", "windows.h"},
+	{"GetFileVersionInfoSizeW", "windows.h"},
+	{"GetFileVersionInfoW", "windows.h"},
+	{"GetFocus", "windows.h"},
+	{"GetFontData", "windows.h"},
+	{"GetFontLanguageInfo", "windows.h"},
+	{"GetForegroundWindow", "windows.h"},
+	{"GetFormA", "windows.h"},
+	{"GetFormW", "windows.h"},
+	{"GetFullPathNameA", "windows.h"},
+	{"GetFullPathNameW", "windows.h"},
+	{"GetGeoInfoA", "windows.h"},
+	{"GetGeoInfoW", "windows.h"},
+	{"GetGlyphOutlineA", "windows.h"},
+	{"GetGlyphOutlineW", "windows.h"},
+	{"GetGraphicsMode", "windows.h"},
+	{"GetHGlobalFromILockBytes", "windows.h"},
+	{"GetHGlobalFromStream", "windows.h"},
+	{"GetHandleInformation", "windows.h"},
+	{"GetICMProfileA", "windows.h"},
+	{"GetICMProfileW", "windows.h"},
+	{"GetIconInfo", "windows.h"},
+	{"GetInputState", "windows.h"},
+	{"GetJobA", "windows.h"},
+	{"GetJobW", "windows.h"},
+	{"GetKBCodePage", "windows.h"},
+	{"GetKernelObjectSecurity", "windows.h"},
+	{"GetKerningPairsA", "windows.h"},
+	{"GetKerningPairsW", "windows.h"},
+	{"GetKeyNameTextA", "windows.h"},
+	{"GetKeyNameTextW", "windows.h"},
+	{"GetKeyState", "windows.h"},
+	{"GetKeyboardLayout", "windows.h"},
+	{"GetKeyboardLayoutList", "windows.h"},
+	{"GetKeyboardLayoutNameA", "windows.h"},
+	{"GetKeyboardLayoutNameW", "windows.h"},
+	{"GetKeyboardState", "windows.h"},
+	{"GetKeyboardType", "windows.h"},
+	{"GetLargestConsoleWindowSize", "windows.h"},
+	{"GetLastActivePopup", "windows.h"},
+	{"GetLastError", "windows.h"},
+	{"GetLastInputInfo", "windows.h"},
+	{"GetLengthSid", "windows.h"},
+	{"GetListBoxInfo", "windows.h"},
+	{"GetLocalTime", "windows.h"},
+	{"GetLocaleInfoA", "windows.h"},
+	{"GetLocaleInfoW", "windows.h"},
+	{"GetLogColorSpaceA", "windows.h"},
+	{"GetLogColorSpaceW", "windows.h"},
+	{"GetLogicalDriveStringsA", "windows.h"},
+	{"GetLogicalDriveStringsW", "windows.h"},
+	{"GetLogicalDrives", "windows.h"},
+	{"GetMailslotInfo", "windows.h"},
+	{"GetMapMode", "windows.h"},
+	{"GetMenu", "windows.h"},
+	{"GetMenuBarInfo", "windows.h"},
+	{"GetMenuCheckMarkDimensions", "windows.h"},
+	{"GetMenuContextHelpId", "windows.h"},
+	{"GetMenuDefaultItem", "windows.h"},
+	{"GetMenuInfo", "windows.h"},
+	{"GetMenuItemCount", "windows.h"},
+	{"GetMenuItemID", "windows.h"},
+	{"GetMenuItemInfoA", "windows.h"},
+	{"GetMenuItemInfoW", "windows.h"},
+	{"GetMenuItemRect", "windows.h"},
+	{"GetMenuState", "windows.h"},
+	{"GetMenuStringA", "windows.h"},
+	{"GetMenuStringW", "windows.h"},
+	{"GetMessageA", "windows.h"},
+	{"GetMessageExtraInfo", "windows.h"},
+	{"GetMessagePos", "windows.h"},
+	{"GetMessageTime", "windows.h"},
+	{"GetMessageW", "windows.h"},
+	{"GetMetaFileA", "windows.h"},
+	{"GetMetaFileBitsEx", "windows.h"},
+	{"GetMetaFileW", "windows.h"},
+	{"GetMetaRgn", "windows.h"},
+	{"GetMiterLimit", "windows.h"},
+	{"GetModuleFileNameA", "windows.h"},
+	{"GetModuleFileNameW", "windows.h"},
+	{"GetModuleHandleA", "windows.h"},
+	{"GetModuleHandleW", "windows.h"},
+	{"GetMonitorInfoA", "windows.h"},
+	{"GetMonitorInfoW", "windows.h"},
+	{"GetNLSVersion", "windows.h"},
+	{"GetNamedPipeHandleStateA", "windows.h"},
+	{"GetNamedPipeHandleStateW", "windows.h"},
+	{"GetNamedPipeInfo", "windows.h"},
+	{"GetNearestColor", "windows.h"},
+	{"GetNearestPaletteIndex", "windows.h"},
+	{"GetNextDlgGroupItem", "windows.h"},
+	{"GetNextDlgTabItem", "windows.h"},
+	{"GetNumberFormatA", "windows.h"},
+	{"GetNumberFormatW", "windows.h"},
+	{"GetNumberOfConsoleInputEvents", "windows.h"},
+	{"GetNumberOfConsoleMouseButtons", "windows.h"},
+	{"GetNumberOfEventLogRecords", "windows.h"},
+	{"GetOEMCP", "windows.h"},
+	{"GetObjectA", "windows.h"},
+	{"GetObjectType", "windows.h"},
+	{"GetObjectW", "windows.h"},
+	{"GetOldestEventLogRecord", "windows.h"},
+	{"GetOpenClipboardWindow", "windows.h"},
+	{"GetOpenFileNameA", "windows.h"},
+	{"GetOpenFileNameW", "windows.h"},
+	{"GetOutlineTextMetricsA", "windows.h"},
+	{"GetOutlineTextMetricsW", "windows.h"},
+	{"GetOverlappedResult", "windows.h"},
+	{"GetPaletteEntries", "windows.h"},
+	{"GetParent", "windows.h"},
+	{"GetPath", "windows.h"},
+	{"GetPixel", "windows.h"},
+	{"GetPixelFormat", "windows.h"},
+	{"GetPolyFillMode", "windows.h"},
+	{"GetPrintProcessorDirectoryA", "windows.h"},
+	{"GetPrintProcessorDirectoryW", "windows.h"},
+	{"GetPrinterA", "windows.h"},
+	{"GetPrinterDataA", "windows.h"},
+	{"GetPrinterDataW", "windows.h"},
+	{"GetPrinterDriverA", "windows.h"},
+	{"GetPrinterDriverDirectoryA", "windows.h"},
+	{"GetPrinterDriverDirectoryW", "windows.h"},
+	{"GetPrinterDriverW", "windows.h"},
+	{"GetPrinterW", "windows.h"},
+	{"GetPriorityClass", "windows.h"},
+	{"GetPriorityClipboardFormat", "windows.h"},
+	{"GetPrivateObjectSecurity", "windows.h"},
+	{"GetPrivateProfileIntA", "windows.h"},
+	{"GetPrivateProfileIntW", "windows.h"},
+	{"GetPrivateProfileSectionA", "windows.h"},
+	{"GetPrivateProfileSectionNamesA", "windows.h"},
+	{"GetPrivateProfileSectionNamesW", "windows.h"},
+	{"GetPrivateProfileSectionW", "windows.h"},
+	{"GetPrivateProfileStringA", "windows.h"},
+	{"GetPrivateProfileStringW", "windows.h"},
+	{"GetPrivateProfileStructA", "windows.h"},
+	{"GetPrivateProfileStructW", "windows.h"},
+	{"GetProcAddress", "windows.h"},
+	{"GetProcessAffinityMask", "windows.h"},
+	{"GetProcessHeap", "windows.h"},
+	{"GetProcessHeaps", "windows.h"},
+	{"GetProcessPriorityBoost", "windows.h"},
+	{"GetProcessShutdownParameters", "windows.h"},
+	{"GetProcessTimes", "windows.h"},
+	{"GetProcessVersion", "windows.h"},
+	{"GetProcessWindowStation", "windows.h"},
+	{"GetProcessWorkingSetSize", "windows.h"},
+	{"GetProfileIntA", "windows.h"},
+	{"GetProfileIntW", "windows.h"},
+	{"GetProfileSectionA", "windows.h"},
+	{"GetProfileSectionW", "windows.h"},
+	{"GetProfileStringA", "windows.h"},
+	{"GetProfileStringW", "windows.h"},
+	{"GetPropA", "windows.h"},
+	{"GetPropW", "windows.h"},
+	{"GetQueueStatus", "windows.h"},
+	{"GetQueuedCompletionStatus", "windows.h"},
+	{"GetROP2", "windows.h"},
+	{"GetRandomRgn", "windows.h"},
+	{"GetRasterizerCaps", "windows.h"},
+	{"GetRecordInfoFromGuids", "windows.h"},
+	{"GetRecordInfoFromTypeInfo", "windows.h"},
+	{"GetRegionData", "windows.h"},
+	{"GetRgnBox", "windows.h"},
+	{"GetRunningObjectTable", "windows.h"},
+	{"GetSaveFileNameA", "windows.h"},
+	{"GetSaveFileNameW", "windows.h"},
+	{"GetScrollBarInfo", "windows.h"},
+	{"GetScrollInfo", "windows.h"},
+	{"GetScrollPos", "windows.h"},
+	{"GetScrollRange", "windows.h"},
+	{"GetSecurityDescriptorControl", "windows.h"},
+	{"GetSecurityDescriptorDacl", "windows.h"},
+	{"GetSecurityDescriptorGroup", "windows.h"},
+	{"GetSecurityDescriptorLength", "windows.h"},
+	{"GetSecurityDescriptorOwner", "windows.h"},
+	{"GetSecurityDescriptorSacl", "windows.h"},
+	{"GetServiceDisplayNameA", "windows.h"},
+	{"GetServiceDisplayNameW", "windows.h"},
+	{"GetServiceKeyNameA", "windows.h"},
+	{"GetServiceKeyNameW", "windows.h"},
+	{"GetShortPathNameA", "windows.h"},
+	{"GetShortPathNameW", "windows.h"},
+	{"GetSidIdentifierAuthority", "windows.h"},
+	{"GetSidLengthRequired", "windows.h"},
+	{"GetSidSubAuthority", "windows.h"},
+	{"GetSidSubAuthorityCount", "windows.h"},
+	{"GetStartupInfoA", "windows.h"},
+	{"GetStartupInfoW", "windows.h"},
+	{"GetStdHandle", "windows.h"},
+	{"GetStockObject", "windows.h"},
+	{"GetStretchBltMode", "windows.h"},
+	{"GetStringTypeA", "windows.h"},
+	{"GetStringTypeExA", "windows.h"},
+	{"GetStringTypeExW", "windows.h"},
+	{"GetStringTypeW", "windows.h"},
+	{"GetSubMenu", "windows.h"},
+	{"GetSysColor", "windows.h"},
+	{"GetSysColorBrush", "windows.h"},
+	{"GetSystemDefaultLCID", "windows.h"},
+	{"GetSystemDefaultLangID", "windows.h"},
+	{"GetSystemDirectoryA", "windows.h"},
+	{"GetSystemDirectoryW", "windows.h"},
+	{"GetSystemInfo", "windows.h"},
+	{"GetSystemMenu", "windows.h"},
+	{"GetSystemMetrics", "windows.h"},
+	{"GetSystemPaletteEntries", "windows.h"},
+	{"GetSystemPaletteUse", "windows.h"},
+	{"GetSystemPowerStatus", "windows.h"},
+	{"GetSystemTime", "windows.h"},
+	{"GetSystemTimeAdjustment", "windows.h"},
+	{"GetSystemTimeAsFileTime", "windows.h"},
+	{"GetTabbedTextExtentA", "windows.h"},
+	{"GetTabbedTextExtentW", "windows.h"},
+	{"GetTapeParameters", "windows.h"},
+	{"GetTapePosition", "windows.h"},
+	{"GetTapeStatus", "windows.h"},
+	{"GetTempFileNameA", "windows.h"},
+	{"GetTempFileNameW", "windows.h"},
+	{"GetTempPathA", "windows.h"},
+	{"GetTempPathW", "windows.h"},
+	{"GetTextAlign", "windows.h"},
+	{"GetTextCharacterExtra", "windows.h"},
+	{"GetTextCharset", "windows.h"},
+	{"GetTextCharsetInfo", "windows.h"},
+	{"GetTextColor", "windows.h"},
+	{"GetTextExtentExPointA", "windows.h"},
+	{"GetTextExtentExPointW", "windows.h"},
+	{"GetTextExtentPoint32A", "windows.h"},
+	{"GetTextExtentPoint32W", "windows.h"},
+	{"GetTextExtentPointA", "windows.h"},
+	{"GetTextExtentPointW", "windows.h"},
+	{"GetTextFaceA", "windows.h"},
+	{"GetTextFaceW", "windows.h"},
+	{"GetTextMetricsA", "windows.h"},
+	{"GetTextMetricsW", "windows.h"},
+	{"GetThreadContext", "windows.h"},
+	{"GetThreadDesktop", "windows.h"},
+	{"GetThreadLocale", "windows.h"},
+	{"GetThreadPriority", "windows.h"},
+	{"GetThreadPriorityBoost", "windows.h"},
+	{"GetThreadSelectorEntry", "windows.h"},
+	{"GetThreadTimes", "windows.h"},
+	{"GetTickCount", "windows.h"},
+	{"GetTimeFormatA", "windows.h"},
+	{"GetTimeFormatW", "windows.h"},
+	{"GetTimeZoneInformation", "windows.h"},
+	{"GetTokenInformation", "windows.h"},
+	{"GetTopWindow", "windows.h"},
+	{"GetUpdateRect", "windows.h"},
+	{"GetUpdateRgn", "windows.h"},
+	{"GetUserDefaultLCID", "windows.h"},
+	{"GetUserDefaultLangID", "windows.h"},
+	{"GetUserGeoID", "windows.h"},
+	{"GetUserNameA", "windows.h"},
+	{"GetUserNameW", "windows.h"},
+	{"GetUserObjectInformationA", "windows.h"},
+	{"GetUserObjectInformationW", "windows.h"},
+	{"GetUserObjectSecurity", "windows.h"},
+	{"GetVersion", "windows.h"},
+	{"GetVersionExA", "windows.h"},
+	{"GetVersionExW", "windows.h"},
+	{"GetViewportExtEx", "windows.h"},
+	{"GetViewportOrgEx", "windows.h"},
+	{"GetVolumeInformationA", "windows.h"},
+	{"GetVolumeInformationW", "windows.h"},
+	{"GetWinMetaFileBits", "windows.h"},
+	{"GetWindow", "windows.h"},
+	{"GetWindowContextHelpId", "windows.h"},
+	{"GetWindowDC", "windows.h"},
+	{"GetWindowExtEx", "windows.h"},
+	{"GetWindowInfo", "windows.h"},
+	{"GetWindowLongA", "windows.h"},
+	{"GetWindowLongW", "windows.h"},
+	{"GetWindowModuleFileNameA", "windows.h"},
+	{"GetWindowModuleFileNameW", "windows.h"},
+	{"GetWindowOrgEx", "windows.h"},
+	{"GetWindowPlacement", "windows.h"},
+	{"GetWindowRect", "windows.h"},
+	{"GetWindowRgn", "windows.h"},
+	{"GetWindowTextA", "windows.h"},
+	{"GetWindowTextLengthA", "windows.h"},
+	{"GetWindowTextLengthW", "windows.h"},
+	{"GetWindowTextW", "windows.h"},
+	{"GetWindowThreadProcessId", "windows.h"},
+	{"GetWindowWord", "windows.h"},
+	{"GetWindowsDirectoryA", "windows.h"},
+	{"GetWindowsDirectoryW", "windows.h"},
+	{"GetWorldTransform", "windows.h"},
+	{"GetWriteWatch", "windows.h"},
+	{"GlobalAddAtomA", "windows.h"},
+	{"GlobalAddAtomW", "windows.h"},
+	{"GlobalAlloc", "windows.h"},
+	{"GlobalCompact", "windows.h"},
+	{"GlobalDeleteAtom", "windows.h"},
+	{"GlobalFindAtomA", "windows.h"},
+	{"GlobalFindAtomW", "windows.h"},
+	{"GlobalFix", "windows.h"},
+	{"GlobalFlags", "windows.h"},
+	{"GlobalFree", "windows.h"},
+	{"GlobalGetAtomNameA", "windows.h"},
+	{"GlobalGetAtomNameW", "windows.h"},
+	{"GlobalHandle", "windows.h"},
+	{"GlobalLock", "windows.h"},
+	{"GlobalMemoryStatus", "windows.h"},
+	{"GlobalReAlloc", "windows.h"},
+	{"GlobalSize", "windows.h"},
+	{"GlobalUnWire", "windows.h"},
+	{"GlobalUnfix", "windows.h"},
+	{"GlobalUnlock", "windows.h"},
+	{"GlobalWire", "windows.h"},
+	{"GrayStringA", "windows.h"},
+	{"GrayStringW", "windows.h"},
+	{"HeapAlloc", "windows.h"},
+	{"HeapCompact", "windows.h"},
+	{"HeapCreate", "windows.h"},
+	{"HeapDestroy", "windows.h"},
+	{"HeapFree", "windows.h"},
+	{"HeapLock", "windows.h"},
+	{"HeapReAlloc", "windows.h"},
+	{"HeapSize", "windows.h"},
+	{"HeapUnlock", "windows.h"},
+	{"HeapValidate", "windows.h"},
+	{"HeapWalk", "windows.h"},
+	{"HideCaret", "windows.h"},
+	{"HiliteMenuItem", "windows.h"},
+	{"IAdviseSink2_OnLinkSrcChange_Proxy", "windows.h"},
+	{"IAdviseSink2_OnLinkSrcChange_Stub", "windows.h"},
+	{"IAdviseSink2_RemoteOnLinkSrcChange_Proxy", "windows.h"},
+	{"IAdviseSink2_RemoteOnLinkSrcChange_Stub", "windows.h"},
+	{"IAdviseSink_OnClose_Proxy", "windows.h"},
+	{"IAdviseSink_OnClose_Stub", "windows.h"},
+	{"IAdviseSink_OnDataChange_Proxy", "windows.h"},
+	{"IAdviseSink_OnDataChange_Stub", "windows.h"},
+	{"IAdviseSink_OnRename_Proxy", "windows.h"},
+	{"IAdviseSink_OnRename_Stub", "windows.h"},
+	{"IAdviseSink_OnSave_Proxy", "windows.h"},
+	{"IAdviseSink_OnSave_Stub", "windows.h"},
+	{"IAdviseSink_OnViewChange_Proxy", "windows.h"},
+	{"IAdviseSink_OnViewChange_Stub", "windows.h"},
+	{"IAdviseSink_RemoteOnClose_Proxy", "windows.h"},
+	{"IAdviseSink_RemoteOnClose_Stub", "windows.h"},
+	{"IAdviseSink_RemoteOnDataChange_Proxy", "windows.h"},
+	{"IAdviseSink_RemoteOnDataChange_Stub", "windows.h"},
+	{"IAdviseSink_RemoteOnRename_Proxy", "windows.h"},
+	{"IAdviseSink_RemoteOnRename_Stub", "windows.h"},
+	{"IAdviseSink_RemoteOnSave_Proxy", "windows.h"},
+	{"IAdviseSink_RemoteOnSave_Stub", "windows.h"},
+	{"IAdviseSink_RemoteOnViewChange_Proxy", "windows.h"},
+	{"IAdviseSink_RemoteOnViewChange_Stub", "windows.h"},
+	{"IBindCtx_EnumObjectParam_Proxy", "windows.h"},
+	{"IBindCtx_EnumObjectParam_Stub", "windows.h"},
+	{"IBindCtx_GetBindOptions_Proxy", "windows.h"},
+	{"IBindCtx_GetBindOptions_Stub", "windows.h"},
+	{"IBindCtx_GetObjectParam_Proxy", "windows.h"},
+	{"IBindCtx_GetObjectParam_Stub", "windows.h"},
+	{"IBindCtx_GetRunningObjectTable_Proxy", "windows.h"},
+	{"IBindCtx_GetRunningObjectTable_Stub", "windows.h"},
+	{"IBindCtx_RegisterObjectBound_Proxy", "windows.h"},
+	{"IBindCtx_RegisterObjectBound_Stub", "windows.h"},
+	{"IBindCtx_RegisterObjectParam_Proxy", "windows.h"},
+	{"IBindCtx_RegisterObjectParam_Stub", "windows.h"},
+	{"IBindCtx_ReleaseBoundObjects_Proxy", "windows.h"},
+	{"IBindCtx_ReleaseBoundObjects_Stub", "windows.h"},
+	{"IBindCtx_RevokeObjectBound_Proxy", "windows.h"},
+	{"IBindCtx_RevokeObjectBound_Stub", "windows.h"},
+	{"IBindCtx_RevokeObjectParam_Proxy", "windows.h"},
+	{"IBindCtx_RevokeObjectParam_Stub", "windows.h"},
+	{"IBindCtx_SetBindOptions_Proxy", "windows.h"},
+	{"IBindCtx_SetBindOptions_Stub", "windows.h"},
+	{"IClassFactory_CreateInstance_Proxy", "windows.h"},
+	{"IClassFactory_CreateInstance_Stub", "windows.h"},
+	{"IClassFactory_LockServer_Proxy", "windows.h"},
+	{"IClassFactory_LockServer_Stub", "windows.h"},
+	{"IClassFactory_RemoteCreateInstance_Proxy", "windows.h"},
+	{"IClassFactory_RemoteCreateInstance_Stub", "windows.h"},
+	{"IClassFactory_RemoteLockServer_Proxy", "windows.h"},
+	{"IClassFactory_RemoteLockServer_Stub", "windows.h"},
+	{"IDataAdviseHolder_Advise_Proxy", "windows.h"},
+	{"IDataAdviseHolder_Advise_Stub", "windows.h"},
+	{"IDataAdviseHolder_EnumAdvise_Proxy", "windows.h"},
+	{"IDataAdviseHolder_EnumAdvise_Stub", "windows.h"},
+	{"IDataAdviseHolder_SendOnDataChange_Proxy", "windows.h"},
+	{"IDataAdviseHolder_SendOnDataChange_Stub", "windows.h"},
+	{"IDataAdviseHolder_Unadvise_Proxy", "windows.h"},
+	{"IDataAdviseHolder_Unadvise_Stub", "windows.h"},
+	{"IDataObject_DAdvise_Proxy", "windows.h"},
+	{"IDataObject_DAdvise_Stub", "windows.h"},
+	{"IDataObject_DUnadvise_Proxy", "windows.h"},
+	{"IDataObject_DUnadvise_Stub", "windows.h"},
+	{"IDataObject_EnumDAdvise_Proxy", "windows.h"},
+	{"IDataObject_EnumDAdvise_Stub", "windows.h"},
+	{"IDataObject_EnumFormatEtc_Proxy", "windows.h"},
+	{"IDataObject_EnumFormatEtc_Stub", "windows.h"},
+	{"IDataObject_GetCanonicalFormatEtc_Proxy", "windows.h"},
+	{"IDataObject_GetCanonicalFormatEtc_Stub", "windows.h"},
+	{"IDataObject_GetDataHere_Proxy", "windows.h"},
+	{"IDataObject_GetDataHere_Stub", "windows.h"},
+	{"IDataObject_GetData_Proxy", "windows.h"},
+	{"IDataObject_GetData_Stub", "windows.h"},
+	{"IDataObject_QueryGetData_Proxy", "windows.h"},
+	{"IDataObject_QueryGetData_Stub", "windows.h"},
+	{"IDataObject_RemoteGetDataHere_Proxy", "windows.h"},
+	{"IDataObject_RemoteGetDataHere_Stub", "windows.h"},
+	{"IDataObject_RemoteGetData_Proxy", "windows.h"},
+	{"IDataObject_RemoteGetData_Stub", "windows.h"},
+	{"IDataObject_RemoteSetData_Proxy", "windows.h"},
+	{"IDataObject_RemoteSetData_Stub", "windows.h"},
+	{"IDataObject_SetData_Proxy", "windows.h"},
+	{"IDataObject_SetData_Stub", "windows.h"},
+	{"IEnumFORMATETC_Clone_Proxy", "windows.h"},
+	{"IEnumFORMATETC_Clone_Stub", "windows.h"},
+	{"IEnumFORMATETC_Next_Proxy", "windows.h"},
+	{"IEnumFORMATETC_Next_Stub", "windows.h"},
+	{"IEnumFORMATETC_RemoteNext_Proxy", "windows.h"},
+	{"IEnumFORMATETC_RemoteNext_Stub", "windows.h"},
+	{"IEnumFORMATETC_Reset_Proxy", "windows.h"},
+	{"IEnumFORMATETC_Reset_Stub", "windows.h"},
+	{"IEnumFORMATETC_Skip_Proxy", "windows.h"},
+	{"IEnumFORMATETC_Skip_Stub", "windows.h"},
+	{"IEnumMoniker_Clone_Proxy", "windows.h"},
+	{"IEnumMoniker_Clone_Stub", "windows.h"},
+	{"IEnumMoniker_Next_Proxy", "windows.h"},
+	{"IEnumMoniker_Next_Stub", "windows.h"},
+	{"IEnumMoniker_RemoteNext_Proxy", "windows.h"},
+	{"IEnumMoniker_RemoteNext_Stub", "windows.h"},
+	{"IEnumMoniker_Reset_Proxy", "windows.h"},
+	{"IEnumMoniker_Reset_Stub", "windows.h"},
+	{"IEnumMoniker_Skip_Proxy", "windows.h"},
+	{"IEnumMoniker_Skip_Stub", "windows.h"},
+	{"IEnumSTATDATA_Clone_Proxy", "windows.h"},
+	{"IEnumSTATDATA_Clone_Stub", "windows.h"},
+	{"IEnumSTATDATA_Next_Proxy", "windows.h"},
+	{"IEnumSTATDATA_Next_Stub", "windows.h"},
+	{"IEnumSTATDATA_RemoteNext_Proxy", "windows.h"},
+	{"IEnumSTATDATA_RemoteNext_Stub", "windows.h"},
+	{"IEnumSTATDATA_Reset_Proxy", "windows.h"},
+	{"IEnumSTATDATA_Reset_Stub", "windows.h"},
+	{"IEnumSTATDATA_Skip_Proxy", "windows.h"},
+	{"IEnumSTATDATA_Skip_Stub", "windows.h"},
+	{"IEnumSTATSTG_Clone_Proxy", "windows.h"},
+	{"IEnumSTATSTG_Clone_Stub", "windows.h"},
+	{"IEnumSTATSTG_Next_Proxy", "windows.h"},
+	{"IEnumSTATSTG_Next_Stub", "windows.h"},
+	{"IEnumSTATSTG_RemoteNext_Proxy", "windows.h"},
+	{"IEnumSTATSTG_RemoteNext_Stub", "windows.h"},
+	{"IEnumSTATSTG_Reset_Proxy", "windows.h"},
+	{"IEnumSTATSTG_Reset_Stub", "windows.h"},
+	{"IEnumSTATSTG_Skip_Proxy", "windows.h"},
+	{"IEnumSTATSTG_Skip_Stub", "windows.h"},
+	{"IEnumString_Clone_Proxy", "windows.h"},
+	{"IEnumString_Clone_Stub", "windows.h"},
+	{"IEnumString_Next_Proxy", "windows.h"},
+	{"IEnumString_Next_Stub", "windows.h"},
+	{"IEnumString_RemoteNext_Proxy", "windows.h"},
+	{"IEnumString_RemoteNext_Stub", "windows.h"},
+	{"IEnumString_Reset_Proxy", "windows.h"},
+	{"IEnumString_Reset_Stub", "windows.h"},
+	{"IEnumString_Skip_Proxy", "windows.h"},
+	{"IEnumString_Skip_Stub", "windows.h"},
+	{"IEnumUnknown_Clone_Proxy", "windows.h"},
+	{"IEnumUnknown_Clone_Stub", "windows.h"},
+	{"IEnumUnknown_Next_Proxy", "windows.h"},
+	{"IEnumUnknown_Next_Stub", "windows.h"},
+	{"IEnumUnknown_RemoteNext_Proxy", "windows.h"},
+	{"IEnumUnknown_RemoteNext_Stub", "windows.h"},
+	{"IEnumUnknown_Reset_Proxy", "windows.h"},
+	{"IEnumUnknown_Reset_Stub", "windows.h"},
+	{"IEnumUnknown_Skip_Proxy", "windows.h"},
+	{"IEnumUnknown_Skip_Stub", "windows.h"},
+	{"IExternalConnection_AddConnection_Proxy", "windows.h"},
+	{"IExternalConnection_AddConnection_Stub", "windows.h"},
+	{"IExternalConnection_ReleaseConnection_Proxy", "windows.h"},
+	{"IExternalConnection_ReleaseConnection_Stub", "windows.h"},
+	{"IIDFromString", "windows.h"},
+	{"ILockBytes_Flush_Proxy", "windows.h"},
+	{"ILockBytes_Flush_Stub", "windows.h"},
+	{"ILockBytes_LockRegion_Proxy", "windows.h"},
+	{"ILockBytes_LockRegion_Stub", "windows.h"},
+	{"ILockBytes_ReadAt_Proxy", "windows.h"},
+	{"ILockBytes_ReadAt_Stub", "windows.h"},
+	{"ILockBytes_RemoteReadAt_Proxy", "windows.h"},
+	{"ILockBytes_RemoteReadAt_Stub", "windows.h"},
+	{"ILockBytes_RemoteWriteAt_Proxy", "windows.h"},
+	{"ILockBytes_RemoteWriteAt_Stub", "windows.h"},
+	{"ILockBytes_SetSize_Proxy", "windows.h"},
+	{"ILockBytes_SetSize_Stub", "windows.h"},
+	{"ILockBytes_Stat_Proxy", "windows.h"},
+	{"ILockBytes_Stat_Stub", "windows.h"},
+	{"ILockBytes_UnlockRegion_Proxy", "windows.h"},
+	{"ILockBytes_UnlockRegion_Stub", "windows.h"},
+	{"ILockBytes_WriteAt_Proxy", "windows.h"},
+	{"ILockBytes_WriteAt_Stub", "windows.h"},
+	{"IMallocSpy_PostAlloc_Proxy", "windows.h"},
+	{"IMallocSpy_PostAlloc_Stub", "windows.h"},
+	{"IMallocSpy_PostDidAlloc_Proxy", "windows.h"},
+	{"IMallocSpy_PostDidAlloc_Stub", "windows.h"},
+	{"IMallocSpy_PostFree_Proxy", "windows.h"},
+	{"IMallocSpy_PostFree_Stub", "windows.h"},
+	{"IMallocSpy_PostGetSize_Proxy", "windows.h"},
+	{"IMallocSpy_PostGetSize_Stub", "windows.h"},
+	{"IMallocSpy_PostHeapMinimize_Proxy", "windows.h"},
+	{"IMallocSpy_PostHeapMinimize_Stub", "windows.h"},
+	{"IMallocSpy_PostRealloc_Proxy", "windows.h"},
+	{"IMallocSpy_PostRealloc_Stub", "windows.h"},
+	{"IMallocSpy_PreAlloc_Proxy", "windows.h"},
+	{"IMallocSpy_PreAlloc_Stub", "windows.h"},
+	{"IMallocSpy_PreDidAlloc_Proxy", "windows.h"},
+	{"IMallocSpy_PreDidAlloc_Stub", "windows.h"},
+	{"IMallocSpy_PreFree_Proxy", "windows.h"},
+	{"IMallocSpy_PreFree_Stub", "windows.h"},
+	{"IMallocSpy_PreGetSize_Proxy", "windows.h"},
+	{"IMallocSpy_PreGetSize_Stub", "windows.h"},
+	{"IMallocSpy_PreHeapMinimize_Proxy", "windows.h"},
+	{"IMallocSpy_PreHeapMinimize_Stub", "windows.h"},
+	{"IMallocSpy_PreRealloc_Proxy", "windows.h"},
+	{"IMallocSpy_PreRealloc_Stub", "windows.h"},
+	{"IMalloc_Alloc_Proxy", "windows.h"},
+	{"IMalloc_Alloc_Stub", "windows.h"},
+	{"IMalloc_DidAlloc_Proxy", "windows.h"},
+	{"IMalloc_DidAlloc_Stub", "windows.h"},
+	{"IMalloc_Free_Proxy", "windows.h"},
+	{"IMalloc_Free_Stub", "windows.h"},
+	{"IMalloc_GetSize_Proxy", "windows.h"},
+	{"IMalloc_GetSize_Stub", "windows.h"},
+	{"IMalloc_HeapMinimize_Proxy", "windows.h"},
+	{"IMalloc_HeapMinimize_Stub", "windows.h"},
+	{"IMalloc_Realloc_Proxy", "windows.h"},
+	{"IMalloc_Realloc_Stub", "windows.h"},
+	{"IMarshal_DisconnectObject_Proxy", "windows.h"},
+	{"IMarshal_DisconnectObject_Stub", "windows.h"},
+	{"IMarshal_GetMarshalSizeMax_Proxy", "windows.h"},
+	{"IMarshal_GetMarshalSizeMax_Stub", "windows.h"},
+	{"IMarshal_GetUnmarshalClass_Proxy", "windows.h"},
+	{"IMarshal_GetUnmarshalClass_Stub", "windows.h"},
+	{"IMarshal_MarshalInterface_Proxy", "windows.h"},
+	{"IMarshal_MarshalInterface_Stub", "windows.h"},
+	{"IMarshal_ReleaseMarshalData_Proxy", "windows.h"},
+	{"IMarshal_ReleaseMarshalData_Stub", "windows.h"},
+	{"IMarshal_UnmarshalInterface_Proxy", "windows.h"},
+	{"IMarshal_UnmarshalInterface_Stub", "windows.h"},
+	{"IMessageFilter_HandleInComingCall_Proxy", "windows.h"},
+	{"IMessageFilter_HandleInComingCall_Stub", "windows.h"},
+	{"IMessageFilter_MessagePending_Proxy", "windows.h"},
+	{"IMessageFilter_MessagePending_Stub", "windows.h"},
+	{"IMessageFilter_RetryRejectedCall_Proxy", "windows.h"},
+	{"IMessageFilter_RetryRejectedCall_Stub", "windows.h"},
+	{"IMoniker_BindToObject_Proxy", "windows.h"},
+	{"IMoniker_BindToObject_Stub", "windows.h"},
+	{"IMoniker_BindToStorage_Proxy", "windows.h"},
+	{"IMoniker_BindToStorage_Stub", "windows.h"},
+	{"IMoniker_CommonPrefixWith_Proxy", "windows.h"},
+	{"IMoniker_CommonPrefixWith_Stub", "windows.h"},
+	{"IMoniker_ComposeWith_Proxy", "windows.h"},
+	{"IMoniker_ComposeWith_Stub", "windows.h"},
+	{"IMoniker_Enum_Proxy", "windows.h"},
+	{"IMoniker_Enum_Stub", "windows.h"},
+	{"IMoniker_GetDisplayName_Proxy", "windows.h"},
+	{"IMoniker_GetDisplayName_Stub", "windows.h"},
+	{"IMoniker_GetTimeOfLastChange_Proxy", "windows.h"},
+	{"IMoniker_GetTimeOfLastChange_Stub", "windows.h"},
+	{"IMoniker_Hash_Proxy", "windows.h"},
+	{"IMoniker_Hash_Stub", "windows.h"},
+	{"IMoniker_Inverse_Proxy", "windows.h"},
+	{"IMoniker_Inverse_Stub", "windows.h"},
+	{"IMoniker_IsEqual_Proxy", "windows.h"},
+	{"IMoniker_IsEqual_Stub", "windows.h"},
+	{"IMoniker_IsRunning_Proxy", "windows.h"},
+	{"IMoniker_IsRunning_Stub", "windows.h"},
+	{"IMoniker_IsSystemMoniker_Proxy", "windows.h"},
+	{"IMoniker_IsSystemMoniker_Stub", "windows.h"},
+	{"IMoniker_ParseDisplayName_Proxy", "windows.h"},
+	{"IMoniker_ParseDisplayName_Stub", "windows.h"},
+	{"IMoniker_Reduce_Proxy", "windows.h"},
+	{"IMoniker_Reduce_Stub", "windows.h"},
+	{"IMoniker_RelativePathTo_Proxy", "windows.h"},
+	{"IMoniker_RelativePathTo_Stub", "windows.h"},
+	{"IMoniker_RemoteBindToObject_Proxy", "windows.h"},
+	{"IMoniker_RemoteBindToObject_Stub", "windows.h"},
+	{"IMoniker_RemoteBindToStorage_Proxy", "windows.h"},
+	{"IMoniker_RemoteBindToStorage_Stub", "windows.h"},
+	{"IPSFactoryBuffer_CreateProxy_Proxy", "windows.h"},
+	{"IPSFactoryBuffer_CreateProxy_Stub", "windows.h"},
+	{"IPSFactoryBuffer_CreateStub_Proxy", "windows.h"},
+	{"IPSFactoryBuffer_CreateStub_Stub", "windows.h"},
+	{"IPersistFile_GetCurFile_Proxy", "windows.h"},
+	{"IPersistFile_GetCurFile_Stub", "windows.h"},
+	{"IPersistFile_IsDirty_Proxy", "windows.h"},
+	{"IPersistFile_IsDirty_Stub", "windows.h"},
+	{"IPersistFile_Load_Proxy", "windows.h"},
+	{"IPersistFile_Load_Stub", "windows.h"},
+	{"IPersistFile_SaveCompleted_Proxy", "windows.h"},
+	{"IPersistFile_SaveCompleted_Stub", "windows.h"},
+	{"IPersistFile_Save_Proxy", "windows.h"},
+	{"IPersistFile_Save_Stub", "windows.h"},
+	{"IPersistStorage_HandsOffStorage_Proxy", "windows.h"},
+	{"IPersistStorage_HandsOffStorage_Stub", "windows.h"},
+	{"IPersistStorage_InitNew_Proxy", "windows.h"},
+	{"IPersistStorage_InitNew_Stub", "windows.h"},
+	{"IPersistStorage_IsDirty_Proxy", "windows.h"},
+	{"IPersistStorage_IsDirty_Stub", "windows.h"},
+	{"IPersistStorage_Load_Proxy", "windows.h"},
+	{"IPersistStorage_Load_Stub", "windows.h"},
+	{"IPersistStorage_SaveCompleted_Proxy", "windows.h"},
+	{"IPersistStorage_SaveCompleted_Stub", "windows.h"},
+	{"IPersistStorage_Save_Proxy", "windows.h"},
+	{"IPersistStorage_Save_Stub", "windows.h"},
+	{"IPersistStream_GetSizeMax_Proxy", "windows.h"},
+	{"IPersistStream_GetSizeMax_Stub", "windows.h"},
+	{"IPersistStream_IsDirty_Proxy", "windows.h"},
+	{"IPersistStream_IsDirty_Stub", "windows.h"},
+	{"IPersistStream_Load_Proxy", "windows.h"},
+	{"IPersistStream_Load_Stub", "windows.h"},
+	{"IPersistStream_Save_Proxy", "windows.h"},
+	{"IPersistStream_Save_Stub", "windows.h"},
+	{"IPersist_GetClassID_Proxy", "windows.h"},
+	{"IPersist_GetClassID_Stub", "windows.h"},
+	{"IROTData_GetComparisonData_Proxy", "windows.h"},
+	{"IROTData_GetComparisonData_Stub", "windows.h"},
+	{"IRootStorage_SwitchToFile_Proxy", "windows.h"},
+	{"IRootStorage_SwitchToFile_Stub", "windows.h"},
+	{"IRpcChannelBuffer_FreeBuffer_Proxy", "windows.h"},
+	{"IRpcChannelBuffer_FreeBuffer_Stub", "windows.h"},
+	{"IRpcChannelBuffer_GetBuffer_Proxy", "windows.h"},
+	{"IRpcChannelBuffer_GetBuffer_Stub", "windows.h"},
+	{"IRpcChannelBuffer_GetDestCtx_Proxy", "windows.h"},
+	{"IRpcChannelBuffer_GetDestCtx_Stub", "windows.h"},
+	{"IRpcChannelBuffer_IsConnected_Proxy", "windows.h"},
+	{"IRpcChannelBuffer_IsConnected_Stub", "windows.h"},
+	{"IRpcChannelBuffer_SendReceive_Proxy", "windows.h"},
+	{"IRpcChannelBuffer_SendReceive_Stub", "windows.h"},
+	{"IRpcProxyBuffer_Connect_Proxy", "windows.h"},
+	{"IRpcProxyBuffer_Connect_Stub", "windows.h"},
+	{"IRpcProxyBuffer_Disconnect_Proxy", "windows.h"},
+	{"IRpcProxyBuffer_Disconnect_Stub", "windows.h"},
+	{"IRpcStubBuffer_Connect_Proxy", "windows.h"},
+	{"IRpcStubBuffer_Connect_Stub", "windows.h"},
+	{"IRpcStubBuffer_CountRefs_Proxy", "windows.h"},
+	{"IRpcStubBuffer_CountRefs_Stub", "windows.h"},
+	{"IRpcStubBuffer_DebugServerQueryInterface_Proxy", "windows.h"},
+	{"IRpcStubBuffer_DebugServerQueryInterface_Stub", "windows.h"},
+	{"IRpcStubBuffer_DebugServerRelease_Proxy", "windows.h"},
+	{"IRpcStubBuffer_DebugServerRelease_Stub", "windows.h"},
+	{"IRpcStubBuffer_Disconnect_Proxy", "windows.h"},
+	{"IRpcStubBuffer_Disconnect_Stub", "windows.h"},
+	{"IRpcStubBuffer_Invoke_Proxy", "windows.h"},
+	{"IRpcStubBuffer_Invoke_Stub", "windows.h"},
+	{"IRpcStubBuffer_IsIIDSupported_Proxy", "windows.h"},
+	{"IRpcStubBuffer_IsIIDSupported_Stub", "windows.h"},
+	{"IRunnableObject_GetRunningClass_Proxy", "windows.h"},
+	{"IRunnableObject_GetRunningClass_Stub", "windows.h"},
+	{"IRunnableObject_IsRunning_Proxy", "windows.h"},
+	{"IRunnableObject_IsRunning_Stub", "windows.h"},
+	{"IRunnableObject_LockRunning_Proxy", "windows.h"},
+	{"IRunnableObject_LockRunning_Stub", "windows.h"},
+	{"IRunnableObject_Run_Proxy", "windows.h"},
+	{"IRunnableObject_Run_Stub", "windows.h"},
+	{"IRunnableObject_SetContainedObject_Proxy", "windows.h"},
+	{"IRunnableObject_SetContainedObject_Stub", "windows.h"},
+	{"IRunningObjectTable_EnumRunning_Proxy", "windows.h"},
+	{"IRunningObjectTable_EnumRunning_Stub", "windows.h"},
+	{"IRunningObjectTable_GetObject_Proxy", "windows.h"},
+	{"IRunningObjectTable_GetObject_Stub", "windows.h"},
+	{"IRunningObjectTable_GetTimeOfLastChange_Proxy", "windows.h"},
+	{"IRunningObjectTable_GetTimeOfLastChange_Stub", "windows.h"},
+	{"IRunningObjectTable_IsRunning_Proxy", "windows.h"},
+	{"IRunningObjectTable_IsRunning_Stub", "windows.h"},
+	{"IRunningObjectTable_NoteChangeTime_Proxy", "windows.h"},
+	{"IRunningObjectTable_NoteChangeTime_Stub", "windows.h"},
+	{"IRunningObjectTable_Register_Proxy", "windows.h"},
+	{"IRunningObjectTable_Register_Stub", "windows.h"},
+	{"IRunningObjectTable_Revoke_Proxy", "windows.h"},
+	{"IRunningObjectTable_Revoke_Stub", "windows.h"},
+	{"IStdMarshalInfo_GetClassForHandler_Proxy", "windows.h"},
+	{"IStdMarshalInfo_GetClassForHandler_Stub", "windows.h"},
+	{"IStorage_Commit_Proxy", "windows.h"},
+	{"IStorage_Commit_Stub", "windows.h"},
+	{"IStorage_CopyTo_Proxy", "windows.h"},
+	{"IStorage_CopyTo_Stub", "windows.h"},
+	{"IStorage_CreateStorage_Proxy", "windows.h"},
+	{"IStorage_CreateStorage_Stub", "windows.h"},
+	{"IStorage_CreateStream_Proxy", "windows.h"},
+	{"IStorage_CreateStream_Stub", "windows.h"},
+	{"IStorage_DestroyElement_Proxy", "windows.h"},
+	{"IStorage_DestroyElement_Stub", "windows.h"},
+	{"IStorage_EnumElements_Proxy", "windows.h"},
+	{"IStorage_EnumElements_Stub", "windows.h"},
+	{"IStorage_MoveElementTo_Proxy", "windows.h"},
+	{"IStorage_MoveElementTo_Stub", "windows.h"},
+	{"IStorage_OpenStorage_Proxy", "windows.h"},
+	{"IStorage_OpenStorage_Stub", "windows.h"},
+	{"IStorage_OpenStream_Proxy", "windows.h"},
+	{"IStorage_OpenStream_Stub", "windows.h"},
+	{"IStorage_RemoteEnumElements_Proxy", "windows.h"},
+	{"IStorage_RemoteEnumElements_Stub", "windows.h"},
+	{"IStorage_RemoteOpenStream_Proxy", "windows.h"},
+	{"IStorage_RemoteOpenStream_Stub", "windows.h"},
+	{"IStorage_RenameElement_Proxy", "windows.h"},
+	{"IStorage_RenameElement_Stub", "windows.h"},
+	{"IStorage_Revert_Proxy", "windows.h"},
+	{"IStorage_Revert_Stub", "windows.h"},
+	{"IStorage_SetClass_Proxy", "windows.h"},
+	{"IStorage_SetClass_Stub", "windows.h"},
+	{"IStorage_SetElementTimes_Proxy", "windows.h"},
+	{"IStorage_SetElementTimes_Stub", "windows.h"},
+	{"IStorage_SetStateBits_Proxy", "windows.h"},
+	{"IStorage_SetStateBits_Stub", "windows.h"},
+	{"IStorage_Stat_Proxy", "windows.h"},
+	{"IStorage_Stat_Stub", "windows.h"},
+	{"IStream_Clone_Proxy", "windows.h"},
+	{"IStream_Clone_Stub", "windows.h"},
+	{"IStream_Commit_Proxy", "windows.h"},
+	{"IStream_Commit_Stub", "windows.h"},
+	{"IStream_CopyTo_Proxy", "windows.h"},
+	{"IStream_CopyTo_Stub", "windows.h"},
+	{"IStream_LockRegion_Proxy", "windows.h"},
+	{"IStream_LockRegion_Stub", "windows.h"},
+	{"IStream_Read_Proxy", "windows.h"},
+	{"IStream_Read_Stub", "windows.h"},
+	{"IStream_RemoteCopyTo_Proxy", "windows.h"},
+	{"IStream_RemoteCopyTo_Stub", "windows.h"},
+	{"IStream_RemoteRead_Proxy", "windows.h"},
+	{"IStream_RemoteRead_Stub", "windows.h"},
+	{"IStream_RemoteSeek_Proxy", "windows.h"},
+	{"IStream_RemoteSeek_Stub", "windows.h"},
+	{"IStream_RemoteWrite_Proxy", "windows.h"},
+	{"IStream_RemoteWrite_Stub", "windows.h"},
+	{"IStream_Revert_Proxy", "windows.h"},
+	{"IStream_Revert_Stub", "windows.h"},
+	{"IStream_Seek_Proxy", "windows.h"},
+	{"IStream_Seek_Stub", "windows.h"},
+	{"IStream_SetSize_Proxy", "windows.h"},
+	{"IStream_SetSize_Stub", "windows.h"},
+	{"IStream_Stat_Proxy", "windows.h"},
+	{"IStream_Stat_Stub", "windows.h"},
+	{"IStream_UnlockRegion_Proxy", "windows.h"},
+	{"IStream_UnlockRegion_Stub", "windows.h"},
+	{"IStream_Write_Proxy", "windows.h"},
+	{"IStream_Write_Stub", "windows.h"},
+	{"IUnknown_AddRef_Proxy", "windows.h"},
+	{"IUnknown_AddRef_Stub", "windows.h"},
+	{"IUnknown_QueryInterface_Proxy", "windows.h"},
+	{"IUnknown_QueryInterface_Stub", "windows.h"},
+	{"IUnknown_Release_Proxy", "windows.h"},
+	{"IUnknown_Release_Stub", "windows.h"},
+	{"I_NsClientBindDone", "windows.h"},
+	{"I_NsClientBindSearch", "windows.h"},
+	{"I_NsServerBindSearch", "windows.h"},
+	{"I_RpcAllocate", "windows.h"},
+	{"I_RpcAsyncSendReceive", "windows.h"},
+	{"I_RpcBindingCopy", "windows.h"},
+	{"I_RpcBindingInqDynamicEndpoint", "windows.h"},
+	{"I_RpcBindingInqTransportType", "windows.h"},
+	{"I_RpcBindingIsClientLocal", "windows.h"},
+	{"I_RpcBindingSetAsync", "windows.h"},
+	{"I_RpcClearMutex", "windows.h"},
+	{"I_RpcConnectionInqSockBuffSize", "windows.h"},
+	{"I_RpcConnectionSetSockBuffSize", "windows.h"},
+	{"I_RpcDeleteMutex", "windows.h"},
+	{"I_RpcFree", "windows.h"},
+	{"I_RpcFreeBuffer", "windows.h"},
+	{"I_RpcGetAssociationContext", "windows.h"},
+	{"I_RpcGetBuffer", "windows.h"},
+	{"I_RpcGetCurrentCallHandle", "windows.h"},
+	{"I_RpcGetThreadWindowHandle", "windows.h"},
+	{"I_RpcIfInqTransferSyntaxes", "windows.h"},
+	{"I_RpcMapWin32Status", "windows.h"},
+	{"I_RpcMonitorAssociation", "windows.h"},
+	{"I_RpcNsBindingSetEntryName", "windows.h"},
+	{"I_RpcNsGetBuffer", "windows.h"},
+	{"I_RpcNsRaiseException", "windows.h"},
+	{"I_RpcNsSendReceive", "windows.h"},
+	{"I_RpcPauseExecution", "windows.h"},
+	{"I_RpcReBindBuffer", "windows.h"},
+	{"I_RpcRequestMutex", "windows.h"},
+	{"I_RpcSend", "windows.h"},
+	{"I_RpcSendReceive", "windows.h"},
+	{"I_RpcServerThreadContinueListening", "windows.h"},
+	{"I_RpcServerThreadPauseListening", "windows.h"},
+	{"I_RpcServerUnregisterEndpointA", "windows.h"},
+	{"I_RpcServerUnregisterEndpointW", "windows.h"},
+	{"I_RpcSetAssociationContext", "windows.h"},
+	{"I_RpcSsDontSerializeContext", "windows.h"},
+	{"I_RpcStopMonitorAssociation", "windows.h"},
+	{"I_UuidCreate", "windows.h"},
+	{"ImmAssociateContext", "windows.h"},
+	{"ImmConfigureIMEA", "windows.h"},
+	{"ImmConfigureIMEW", "windows.h"},
+	{"ImmCreateContext", "windows.h"},
+	{"ImmDestroyContext", "windows.h"},
+	{"ImmDisableIME", "windows.h"},
+	{"ImmEnumRegisterWordA", "windows.h"},
+	{"ImmEnumRegisterWordW", "windows.h"},
+	{"ImmEscapeA", "windows.h"},
+	{"ImmEscapeW", "windows.h"},
+	{"ImmGetCandidateListA", "windows.h"},
+	{"ImmGetCandidateListCountA", "windows.h"},
+	{"ImmGetCandidateListCountW", "windows.h"},
+	{"ImmGetCandidateListW", "windows.h"},
+	{"ImmGetCandidateWindow", "windows.h"},
+	{"ImmGetCompositionFontA", "windows.h"},
+	{"ImmGetCompositionFontW", "windows.h"},
+	{"ImmGetCompositionStringA", "windows.h"},
+	{"ImmGetCompositionStringW", "windows.h"},
+	{"ImmGetCompositionWindow", "windows.h"},
+	{"ImmGetContext", "windows.h"},
+	{"ImmGetConversionListA", "windows.h"},
+	{"ImmGetConversionListW", "windows.h"},
+	{"ImmGetConversionStatus", "windows.h"},
+	{"ImmGetDefaultIMEWnd", "windows.h"},
+	{"ImmGetDescriptionA", "windows.h"},
+	{"ImmGetDescriptionW", "windows.h"},
+	{"ImmGetGuideLineA", "windows.h"},
+	{"ImmGetGuideLineW", "windows.h"},
+	{"ImmGetIMEFileNameA", "windows.h"},
+	{"ImmGetIMEFileNameW", "windows.h"},
+	{"ImmGetImeMenuItemsA", "windows.h"},
+	{"ImmGetImeMenuItemsW", "windows.h"},
+	{"ImmGetOpenStatus", "windows.h"},
+	{"ImmGetProperty", "windows.h"},
+	{"ImmGetRegisterWordStyleA", "windows.h"},
+	{"ImmGetRegisterWordStyleW", "windows.h"},
+	{"ImmGetStatusWindowPos", "windows.h"},
+	{"ImmGetVirtualKey", "windows.h"},
+	{"ImmInstallIMEA", "windows.h"},
+	{"ImmInstallIMEW", "windows.h"},
+	{"ImmIsIME", "windows.h"},
+	{"ImmIsUIMessageA", "windows.h"},
+	{"ImmIsUIMessageW", "windows.h"},
+	{"ImmNotifyIME", "windows.h"},
+	{"ImmRegisterWordA", "windows.h"},
+	{"ImmRegisterWordW", "windows.h"},
+	{"ImmReleaseContext", "windows.h"},
+	{"ImmSetCandidateWindow", "windows.h"},
+	{"ImmSetCompositionFontA", "windows.h"},
+	{"ImmSetCompositionFontW", "windows.h"},
+	{"ImmSetCompositionStringA", "windows.h"},
+	{"ImmSetCompositionStringW", "windows.h"},
+	{"ImmSetCompositionWindow", "windows.h"},
+	{"ImmSetConversionStatus", "windows.h"},
+	{"ImmSetOpenStatus", "windows.h"},
+	{"ImmSetStatusWindowPos", "windows.h"},
+	{"ImmSimulateHotKey", "windows.h"},
+	{"ImmUnregisterWordA", "windows.h"},
+	{"ImmUnregisterWordW", "windows.h"},
+	{"ImpersonateDdeClientWindow", "windows.h"},
+	{"ImpersonateLoggedOnUser", "windows.h"},
+	{"ImpersonateNamedPipeClient", "windows.h"},
+	{"ImpersonateSelf", "windows.h"},
+	{"InSendMessage", "windows.h"},
+	{"InflateRect", "windows.h"},
+	{"InitAtomTable", "windows.h"},
+	{"InitializeAcl", "windows.h"},
+	{"InitializeCriticalSection", "windows.h"},
+	{"InitializeCriticalSectionAndSpinCount", "windows.h"},
+	{"InitializeSecurityDescriptor", "windows.h"},
+	{"InitializeSid", "windows.h"},
+	{"InitiateSystemShutdownA", "windows.h"},
+	{"InitiateSystemShutdownW", "windows.h"},
+	{"InsertMenuA", "windows.h"},
+	{"InsertMenuItemA", "windows.h"},
+	{"InsertMenuItemW", "windows.h"},
+	{"InsertMenuW", "windows.h"},
+	{"InterlockedCompareExchange", "windows.h"},
+	{"InterlockedDecrement", "windows.h"},
+	{"InterlockedExchange", "windows.h"},
+	{"InterlockedExchangeAdd", "windows.h"},
+	{"InterlockedIncrement", "windows.h"},
+	{"InternalGetWindowText", "windows.h"},
+	{"IntersectClipRect", "windows.h"},
+	{"IntersectRect", "windows.h"},
+	{"InvalidateRect", "windows.h"},
+	{"InvalidateRgn", "windows.h"},
+	{"InvertRect", "windows.h"},
+	{"InvertRgn", "windows.h"},
+	{"IsAccelerator", "windows.h"},
+	{"IsBadCodePtr", "windows.h"},
+	{"IsBadHugeReadPtr", "windows.h"},
+	{"IsBadHugeWritePtr", "windows.h"},
+	{"IsBadReadPtr", "windows.h"},
+	{"IsBadStringPtrA", "windows.h"},
+	{"IsBadStringPtrW", "windows.h"},
+	{"IsBadWritePtr", "windows.h"},
+	{"IsCharAlphaA", "windows.h"},
+	{"IsCharAlphaNumericA", "windows.h"},
+	{"IsCharAlphaNumericW", "windows.h"},
+	{"IsCharAlphaW", "windows.h"},
+	{"IsCharLowerA", "windows.h"},
+	{"IsCharLowerW", "windows.h"},
+	{"IsCharUpperA", "windows.h"},
+	{"IsCharUpperW", "windows.h"},
+	{"IsChild", "windows.h"},
+	{"IsClipboardFormatAvailable", "windows.h"},
+	{"IsDBCSLeadByte", "windows.h"},
+	{"IsDBCSLeadByteEx", "windows.h"},
+	{"IsDebuggerPresent", "windows.h"},
+	{"IsDialogMessageA", "windows.h"},
+	{"IsDialogMessageW", "windows.h"},
+	{"IsDlgButtonChecked", "windows.h"},
+	{"IsIconic", "windows.h"},
+	{"IsMenu", "windows.h"},
+	{"IsNLSDefinedString", "windows.h"},
+	{"IsProcessorFeaturePresent", "windows.h"},
+	{"IsRectEmpty", "windows.h"},
+	{"IsSystemResumeAutomatic", "windows.h"},
+	{"IsTextUnicode", "windows.h"},
+	{"IsValidAcl", "windows.h"},
+	{"IsValidCodePage", "windows.h"},
+	{"IsValidLocale", "windows.h"},
+	{"IsValidSecurityDescriptor", "windows.h"},
+	{"IsValidSid", "windows.h"},
+	{"IsWindow", "windows.h"},
+	{"IsWindowEnabled", "windows.h"},
+	{"IsWindowUnicode", "windows.h"},
+	{"IsWindowVisible", "windows.h"},
+	{"IsZoomed", "windows.h"},
+	{"KillTimer", "windows.h"},
+	{"LCMapStringA", "windows.h"},
+	{"LCMapStringW", "windows.h"},
+	{"LHashValOfNameSys", "windows.h"},
+	{"LHashValOfNameSysA", "windows.h"},
+	{"LPtoDP", "windows.h"},
+	{"LZClose", "windows.h"},
+	{"LZCopy", "windows.h"},
+	{"LZDone", "windows.h"},
+	{"LZInit", "windows.h"},
+	{"LZOpenFileA", "windows.h"},
+	{"LZOpenFileW", "windows.h"},
+	{"LZRead", "windows.h"},
+	{"LZSeek", "windows.h"},
+	{"LZStart", "windows.h"},
+	{"LeaveCriticalSection", "windows.h"},
+	{"LineDDA", "windows.h"},
+	{"LineTo", "windows.h"},
+	{"LoadAcceleratorsA", "windows.h"},
+	{"LoadAcceleratorsW", "windows.h"},
+	{"LoadBitmapA", "windows.h"},
+	{"LoadBitmapW", "windows.h"},
+	{"LoadCursorA", "windows.h"},
+	{"LoadCursorFromFileA", "windows.h"},
+	{"LoadCursorFromFileW", "windows.h"},
+	{"LoadCursorW", "windows.h"},
+	{"LoadIconA", "windows.h"},
+	{"LoadIconW", "windows.h"},
+	{"LoadImageA", "windows.h"},
+	{"LoadImageW", "windows.h"},
+	{"LoadKeyboardLayoutA", "windows.h"},
+	{"LoadKeyboardLayoutW", "windows.h"},
+	{"LoadLibraryA", "windows.h"},
+	{"LoadLibraryExA", "windows.h"},
+	{"LoadLibraryExW", "windows.h"},
+	{"LoadLibraryW", "windows.h"},
+	{"LoadMenuA", "windows.h"},
+	{"LoadMenuIndirectA", "windows.h"},
+	{"LoadMenuIndirectW", "windows.h"},
+	{"LoadMenuW", "windows.h"},
+	{"LoadModule", "windows.h"},
+	{"LoadRegTypeLib", "windows.h"},
+	{"LoadResource", "windows.h"},
+	{"LoadStringA", "windows.h"},
+	{"LoadStringW", "windows.h"},
+	{"LoadTypeLib", "windows.h"},
+	{"LoadTypeLibEx", "windows.h"},
+	{"LocalAlloc", "windows.h"},
+	{"LocalCompact", "windows.h"},
+	{"LocalDiscard", "windows.h"},
+	{"LocalFileTimeToFileTime", "windows.h"},
+	{"LocalFlags", "windows.h"},
+	{"LocalFree", "windows.h"},
+	{"LocalHandle", "windows.h"},
+	{"LocalLock", "windows.h"},
+	{"LocalReAlloc", "windows.h"},
+	{"LocalShrink", "windows.h"},
+	{"LocalSize", "windows.h"},
+	{"LocalUnlock", "windows.h"},
+	{"LockFile", "windows.h"},
+	{"LockFileEx", "windows.h"},
+	{"LockResource", "windows.h"},
+	{"LockServiceDatabase", "windows.h"},
+	{"LockWindowUpdate", "windows.h"},
+	{"LogonUserA", "windows.h"},
+	{"LogonUserW", "windows.h"},
+	{"LookupAccountNameA", "windows.h"},
+	{"LookupAccountNameW", "windows.h"},
+	{"LookupAccountSidA", "windows.h"},
+	{"LookupAccountSidW", "windows.h"},
+	{"LookupIconIdFromDirectory", "windows.h"},
+	{"LookupIconIdFromDirectoryEx", "windows.h"},
+	{"LookupPrivilegeDisplayNameA", "windows.h"},
+	{"LookupPrivilegeDisplayNameW", "windows.h"},
+	{"LookupPrivilegeNameA", "windows.h"},
+	{"LookupPrivilegeNameW", "windows.h"},
+	{"LookupPrivilegeValueA", "windows.h"},
+	{"LookupPrivilegeValueW", "windows.h"},
+	{"MIDL_user_allocate", "windows.h"},
+	{"MIDL_user_free", "windows.h"},
+	{"MIDL_wchar_strcpy", "windows.h"},
+	{"MIDL_wchar_strlen", "windows.h"},
+	{"MakeAbsoluteSD", "windows.h"},
+	{"MakeSelfRelativeSD", "windows.h"},
+	{"MapDialogRect", "windows.h"},
+	{"MapGenericMask", "windows.h"},
+	{"MapViewOfFile", "windows.h"},
+	{"MapViewOfFileEx", "windows.h"},
+	{"MapVirtualKeyA", "windows.h"},
+	{"MapVirtualKeyExA", "windows.h"},
+	{"MapVirtualKeyExW", "windows.h"},
+	{"MapVirtualKeyW", "windows.h"},
+	{"MapWindowPoints", "windows.h"},
+	{"MaskBlt", "windows.h"},
+	{"MenuItemFromPoint", "windows.h"},
+	{"MessageBeep", "windows.h"},
+	{"MessageBoxA", "windows.h"},
+	{"MessageBoxExA", "windows.h"},
+	{"MessageBoxExW", "windows.h"},
+	{"MessageBoxIndirectA", "windows.h"},
+	{"MessageBoxIndirectW", "windows.h"},
+	{"MessageBoxW", "windows.h"},
+	{"MkParseDisplayName", "windows.h"},
+	{"ModifyMenuA", "windows.h"},
+	{"ModifyMenuW", "windows.h"},
+	{"ModifyWorldTransform", "windows.h"},
+	{"MonikerCommonPrefixWith", "windows.h"},
+	{"MonikerRelativePathTo", "windows.h"},
+	{"MoveFileA", "windows.h"},
+	{"MoveFileExA", "windows.h"},
+	{"MoveFileExW", "windows.h"},
+	{"MoveFileW", "windows.h"},
+	{"MoveToEx", "windows.h"},
+	{"MoveWindow", "windows.h"},
+	{"MsgWaitForMultipleObjects", "windows.h"},
+	{"MsgWaitForMultipleObjectsEx", "windows.h"},
+	{"MulDiv", "windows.h"},
+	{"MultiByteToWideChar", "windows.h"},
+	{"MultinetGetConnectionPerformanceA", "windows.h"},
+	{"MultinetGetConnectionPerformanceW", "windows.h"},
+	{"NDRCContextBinding", "windows.h"},
+	{"NDRCContextMarshall", "windows.h"},
+	{"NDRCContextUnmarshall", "windows.h"},
+	{"NDRSContextMarshall", "windows.h"},
+	{"NDRSContextUnmarshall", "windows.h"},
+	{"NDRcopy", "windows.h"},
+	{"NdrAllocate", "windows.h"},
+	{"NdrByteCountPointerBufferSize", "windows.h"},
+	{"NdrByteCountPointerFree", "windows.h"},
+	{"NdrByteCountPointerMarshall", "windows.h"},
+	{"NdrByteCountPointerUnmarshall", "windows.h"},
+	{"NdrClearOutParameters", "windows.h"},
+	{"NdrClientCall", "windows.h"},
+	{"NdrClientCall2", "windows.h"},
+	{"NdrClientContextMarshall", "windows.h"},
+	{"NdrClientContextUnmarshall", "windows.h"},
+	{"NdrClientInitialize", "windows.h"},
+	{"NdrClientInitializeNew", "windows.h"},
+	{"NdrComplexArrayBufferSize", "windows.h"},
+	{"NdrComplexArrayFree", "windows.h"},
+	{"NdrComplexArrayMarshall", "windows.h"},
+	{"NdrComplexArrayMemorySize", "windows.h"},
+	{"NdrComplexArrayUnmarshall", "windows.h"},
+	{"NdrComplexStructBufferSize", "windows.h"},
+	{"NdrComplexStructFree", "windows.h"},
+	{"NdrComplexStructMarshall", "windows.h"},
+	{"NdrComplexStructMemorySize", "windows.h"},
+	{"NdrComplexStructUnmarshall", "windows.h"},
+	{"NdrConformantArrayBufferSize", "windows.h"},
+	{"NdrConformantArrayFree", "windows.h"},
+	{"NdrConformantArrayMarshall", "windows.h"},
+	{"NdrConformantArrayMemorySize", "windows.h"},
+	{"NdrConformantArrayUnmarshall", "windows.h"},
+	{"NdrConformantStringBufferSize", "windows.h"},
+	{"NdrConformantStringMarshall", "windows.h"},
+	{"NdrConformantStringMemorySize", "windows.h"},
+	{"NdrConformantStringUnmarshall", "windows.h"},
+	{"NdrConformantStructBufferSize", "windows.h"},
+	{"NdrConformantStructFree", "windows.h"},
+	{"NdrConformantStructMarshall", "windows.h"},
+	{"NdrConformantStructMemorySize", "windows.h"},
+	{"NdrConformantStructUnmarshall", "windows.h"},
+	{"NdrConformantVaryingArrayBufferSize", "windows.h"},
+	{"NdrConformantVaryingArrayFree", "windows.h"},
+	{"NdrConformantVaryingArrayMarshall", "windows.h"},
+	{"NdrConformantVaryingArrayMemorySize", "windows.h"},
+	{"NdrConformantVaryingArrayUnmarshall", "windows.h"},
+	{"NdrConformantVaryingStructBufferSize", "windows.h"},
+	{"NdrConformantVaryingStructFree", "windows.h"},
+	{"NdrConformantVaryingStructMarshall", "windows.h"},
+	{"NdrConformantVaryingStructMemorySize", "windows.h"},
+	{"NdrConformantVaryingStructUnmarshall", "windows.h"},
+	{"NdrContextHandleSize", "windows.h"},
+	{"NdrConvert", "windows.h"},
+	{"NdrEncapsulatedUnionBufferSize", "windows.h"},
+	{"NdrEncapsulatedUnionFree", "windows.h"},
+	{"NdrEncapsulatedUnionMarshall", "windows.h"},
+	{"NdrEncapsulatedUnionMemorySize", "windows.h"},
+	{"NdrEncapsulatedUnionUnmarshall", "windows.h"},
+	{"NdrFixedArrayBufferSize", "windows.h"},
+	{"NdrFixedArrayFree", "windows.h"},
+	{"NdrFixedArrayMarshall", "windows.h"},
+	{"NdrFixedArrayMemorySize", "windows.h"},
+	{"NdrFixedArrayUnmarshall", "windows.h"},
+	{"NdrFreeBuffer", "windows.h"},
+	{"NdrFullPointerFree", "windows.h"},
+	{"NdrFullPointerInsertRefId", "windows.h"},
+	{"NdrFullPointerQueryPointer", "windows.h"},
+	{"NdrFullPointerQueryRefId", "windows.h"},
+	{"NdrFullPointerXlatFree", "windows.h"},
+	{"NdrFullPointerXlatInit", "windows.h"},
+	{"NdrGetBuffer", "windows.h"},
+	{"NdrHardStructBufferSize", "windows.h"},
+	{"NdrHardStructFree", "windows.h"},
+	{"NdrHardStructMarshall", "windows.h"},
+	{"NdrHardStructMemorySize", "windows.h"},
+	{"NdrHardStructUnmarshall", "windows.h"},
+	{"NdrInterfacePointerBufferSize", "windows.h"},
+	{"NdrInterfacePointerFree", "windows.h"},
+	{"NdrInterfacePointerMarshall", "windows.h"},
+	{"NdrInterfacePointerMemorySize", "windows.h"},
+	{"NdrInterfacePointerUnmarshall", "windows.h"},
+	{"NdrMapCommAndFaultStatus", "windows.h"},
+	{"NdrNonConformantStringBufferSize", "windows.h"},
+	{"NdrNonConformantStringMarshall", "windows.h"},
+	{"NdrNonConformantStringMemorySize", "windows.h"},
+	{"NdrNonConformantStringUnmarshall", "windows.h"},
+	{"NdrNonEncapsulatedUnionBufferSize", "windows.h"},
+	{"NdrNonEncapsulatedUnionFree", "windows.h"},
+	{"NdrNonEncapsulatedUnionMarshall", "windows.h"},
+	{"NdrNonEncapsulatedUnionMemorySize", "windows.h"},
+	{"NdrNonEncapsulatedUnionUnmarshall", "windows.h"},
+	{"NdrNsGetBuffer", "windows.h"},
+	{"NdrNsSendReceive", "windows.h"},
+	{"NdrOleAllocate", "windows.h"},
+	{"NdrOleFree", "windows.h"},
+	{"NdrPointerBufferSize", "windows.h"},
+	{"NdrPointerFree", "windows.h"},
+	{"NdrPointerMarshall", "windows.h"},
+	{"NdrPointerMemorySize", "windows.h"},
+	{"NdrPointerUnmarshall", "windows.h"},
+	{"NdrRpcSmClientAllocate", "windows.h"},
+	{"NdrRpcSmClientFree", "windows.h"},
+	{"NdrRpcSmSetClientToOsf", "windows.h"},
+	{"NdrRpcSsDefaultAllocate", "windows.h"},
+	{"NdrRpcSsDefaultFree", "windows.h"},
+	{"NdrRpcSsDisableAllocate", "windows.h"},
+	{"NdrRpcSsEnableAllocate", "windows.h"},
+	{"NdrSH_Copy", "windows.h"},
+	{"NdrSH_IfAlloc", "windows.h"},
+	{"NdrSH_IfAllocCopy", "windows.h"},
+	{"NdrSH_IfAllocRef", "windows.h"},
+	{"NdrSH_IfAllocSet", "windows.h"},
+	{"NdrSH_IfCopy", "windows.h"},
+	{"NdrSH_IfFree", "windows.h"},
+	{"NdrSH_StringMarshall", "windows.h"},
+	{"NdrSH_StringUnMarshall", "windows.h"},
+	{"NdrSH_TLUPDecision", "windows.h"},
+	{"NdrSH_TLUPDecisionBuffer", "windows.h"},
+	{"NdrSH_UPDecision", "windows.h"},
+	{"NdrSendReceive", "windows.h"},
+	{"NdrServerCall", "windows.h"},
+	{"NdrServerContextMarshall", "windows.h"},
+	{"NdrServerContextUnmarshall", "windows.h"},
+	{"NdrServerInitialize", "windows.h"},
+	{"NdrServerInitializeMarshall", "windows.h"},
+	{"NdrServerInitializeNew", "windows.h"},
+	{"NdrServerInitializeUnmarshall", "windows.h"},
+	{"NdrServerMarshall", "windows.h"},
+	{"NdrServerUnmarshall", "windows.h"},
+	{"NdrSimpleStructBufferSize", "windows.h"},
+	{"NdrSimpleStructFree", "windows.h"},
+	{"NdrSimpleStructMarshall", "windows.h"},
+	{"NdrSimpleStructMemorySize", "windows.h"},
+	{"NdrSimpleStructUnmarshall", "windows.h"},
+	{"NdrSimpleTypeMarshall", "windows.h"},
+	{"NdrSimpleTypeUnmarshall", "windows.h"},
+	{"NdrStubCall", "windows.h"},
+	{"NdrUserMarshalBufferSize", "windows.h"},
+	{"NdrUserMarshalFree", "windows.h"},
+	{"NdrUserMarshalMarshall", "windows.h"},
+	{"NdrUserMarshalMemorySize", "windows.h"},
+	{"NdrUserMarshalUnmarshall", "windows.h"},
+	{"NdrVaryingArrayBufferSize", "windows.h"},
+	{"NdrVaryingArrayFree", "windows.h"},
+	{"NdrVaryingArrayMarshall", "windows.h"},
+	{"NdrVaryingArrayMemorySize", "windows.h"},
+	{"NdrVaryingArrayUnmarshall", "windows.h"},
+	{"NdrXmitOrRepAsBufferSize", "windows.h"},
+	{"NdrXmitOrRepAsFree", "windows.h"},
+	{"NdrXmitOrRepAsMarshall", "windows.h"},
+	{"NdrXmitOrRepAsMemorySize", "windows.h"},
+	{"NdrXmitOrRepAsUnmarshall", "windows.h"},
+	{"Netbios", "windows.h"},
+	{"NotifyBootConfigStatus", "windows.h"},
+	{"NotifyChangeEventLog", "windows.h"},
+	{"OaBuildVersion", "windows.h"},
+	{"ObjectCloseAuditAlarmA", "windows.h"},
+	{"ObjectCloseAuditAlarmW", "windows.h"},
+	{"ObjectDeleteAuditAlarmA", "windows.h"},
+	{"ObjectDeleteAuditAlarmW", "windows.h"},
+	{"ObjectOpenAuditAlarmA", "windows.h"},
+	{"ObjectOpenAuditAlarmW", "windows.h"},
+	{"ObjectPrivilegeAuditAlarmA", "windows.h"},
+	{"ObjectPrivilegeAuditAlarmW", "windows.h"},
+	{"OemKeyScan", "windows.h"},
+	{"OemToCharA", "windows.h"},
+	{"OemToCharBuffA", "windows.h"},
+	{"OemToCharBuffW", "windows.h"},
+	{"OemToCharW", "windows.h"},
+	{"OffsetClipRgn", "windows.h"},
+	{"OffsetRect", "windows.h"},
+	{"OffsetRgn", "windows.h"},
+	{"OffsetViewportOrgEx", "windows.h"},
+	{"OffsetWindowOrgEx", "windows.h"},
+	{"OleBuildVersion", "windows.h"},
+	{"OleConvertIStorageToOLESTREAM", "windows.h"},
+	{"OleConvertIStorageToOLESTREAMEx", "windows.h"},
+	{"OleConvertOLESTREAMToIStorage", "windows.h"},
+	{"OleConvertOLESTREAMToIStorageEx", "windows.h"},
+	{"OleCreate", "windows.h"},
+	{"OleCreateDefaultHandler", "windows.h"},
+	{"OleCreateEmbeddingHelper", "windows.h"},
+	{"OleCreateFromData", "windows.h"},
+	{"OleCreateFromFile", "windows.h"},
+	{"OleCreateLink", "windows.h"},
+	{"OleCreateLinkFromData", "windows.h"},
+	{"OleCreateLinkToFile", "windows.h"},
+	{"OleCreateMenuDescriptor", "windows.h"},
+	{"OleCreateStaticFromData", "windows.h"},
+	{"OleDestroyMenuDescriptor", "windows.h"},
+	{"OleDoAutoConvert", "windows.h"},
+	{"OleDraw", "windows.h"},
+	{"OleDuplicateData", "windows.h"},
+	{"OleFlushClipboard", "windows.h"},
+	{"OleGetAutoConvert", "windows.h"},
+	{"OleGetClipboard", "windows.h"},
+	{"OleGetIconOfClass", "windows.h"},
+	{"OleGetIconOfFile", "windows.h"},
+	{"OleInitialize", "windows.h"},
+	{"OleIsCurrentClipboard", "windows.h"},
+	{"OleIsRunning", "windows.h"},
+	{"OleLoad", "windows.h"},
+	{"OleLoadFromStream", "windows.h"},
+	{"OleLockRunning", "windows.h"},
+	{"OleMetafilePictFromIconAndLabel", "windows.h"},
+	{"OleNoteObjectVisible", "windows.h"},
+	{"OleQueryCreateFromData", "windows.h"},
+	{"OleQueryLinkFromData", "windows.h"},
+	{"OleRegEnumFormatEtc", "windows.h"},
+	{"OleRegEnumVerbs", "windows.h"},
+	{"OleRegGetMiscStatus", "windows.h"},
+	{"OleRegGetUserType", "windows.h"},
+	{"OleRun", "windows.h"},
+	{"OleSave", "windows.h"},
+	{"OleSaveToStream", "windows.h"},
+	{"OleSetAutoConvert", "windows.h"},
+	{"OleSetClipboard", "windows.h"},
+	{"OleSetContainedObject", "windows.h"},
+	{"OleSetMenuDescriptor", "windows.h"},
+	{"OleTranslateAccelerator", "windows.h"},
+	{"OleUninitialize", "windows.h"},
+	{"OpenBackupEventLogA", "windows.h"},
+	{"OpenBackupEventLogW", "windows.h"},
+	{"OpenClipboard", "windows.h"},
+	{"OpenDesktopA", "windows.h"},
+	{"OpenDesktopW", "windows.h"},
+	{"OpenDriver", "windows.h"},
+	{"OpenEventA", "windows.h"},
+	{"OpenEventLogA", "windows.h"},
+	{"OpenEventLogW", "windows.h"},
+	{"OpenEventW", "windows.h"},
+	{"OpenFile", "windows.h"},
+	{"OpenFileMappingA", "windows.h"},
+	{"OpenFileMappingW", "windows.h"},
+	{"OpenIcon", "windows.h"},
+	{"OpenInputDesktop", "windows.h"},
+	{"OpenMutexA", "windows.h"},
+	{"OpenMutexW", "windows.h"},
+	{"OpenPrinterA", "windows.h"},
+	{"OpenPrinterW", "windows.h"},
+	{"OpenProcess", "windows.h"},
+	{"OpenProcessToken", "windows.h"},
+	{"OpenSCManagerA", "windows.h"},
+	{"OpenSCManagerW", "windows.h"},
+	{"OpenSemaphoreA", "windows.h"},
+	{"OpenSemaphoreW", "windows.h"},
+	{"OpenServiceA", "windows.h"},
+	{"OpenServiceW", "windows.h"},
+	{"OpenThreadToken", "windows.h"},
+	{"OpenWaitableTimerA", "windows.h"},
+	{"OpenWaitableTimerW", "windows.h"},
+	{"OpenWindowStationA", "windows.h"},
+	{"OpenWindowStationW", "windows.h"},
+	{"OutputDebugStringA", "windows.h"},
+	{"OutputDebugStringW", "windows.h"},
+	{"PackDDElParam", "windows.h"},
+	{"PageSetupDlgA", "windows.h"},
+	{"PageSetupDlgW", "windows.h"},
+	{"PaintDesktop", "windows.h"},
+	{"PaintRgn", "windows.h"},
+	{"PatBlt", "windows.h"},
+	{"PathToRegion", "windows.h"},
+	{"PeekConsoleInputA", "windows.h"},
+	{"PeekConsoleInputW", "windows.h"},
+	{"PeekMessageA", "windows.h"},
+	{"PeekMessageW", "windows.h"},
+	{"PeekNamedPipe", "windows.h"},
+	{"Pie", "windows.h"},
+	{"PlayEnhMetaFile", "windows.h"},
+	{"PlayEnhMetaFileRecord", "windows.h"},
+	{"PlayMetaFile", "windows.h"},
+	{"PlayMetaFileRecord", "windows.h"},
+	{"PlaySoundA", "windows.h"},
+	{"PlaySoundW", "windows.h"},
+	{"PlgBlt", "windows.h"},
+	{"PolyBezier", "windows.h"},
+	{"PolyBezierTo", "windows.h"},
+	{"PolyDraw", "windows.h"},
+	{"PolyPolygon", "windows.h"},
+	{"PolyPolyline", "windows.h"},
+	{"PolyTextOutA", "windows.h"},
+	{"PolyTextOutW", "windows.h"},
+	{"Polygon", "windows.h"},
+	{"Polyline", "windows.h"},
+	{"PolylineTo", "windows.h"},
+	{"PostMessageA", "windows.h"},
+	{"PostMessageW", "windows.h"},
+	{"PostQueuedCompletionStatus", "windows.h"},
+	{"PostQuitMessage", "windows.h"},
+	{"PostThreadMessageA", "windows.h"},
+	{"PostThreadMessageW", "windows.h"},
+	{"PrepareTape", "windows.h"},
+	{"PrintDlgA", "windows.h"},
+	{"PrintDlgW", "windows.h"},
+	{"PrinterMessageBoxA", "windows.h"},
+	{"PrinterMessageBoxW", "windows.h"},
+	{"PrinterProperties", "windows.h"},
+	{"PrivilegeCheck", "windows.h"},
+	{"PrivilegedServiceAuditAlarmA", "windows.h"},
+	{"PrivilegedServiceAuditAlarmW", "windows.h"},
+	{"ProgIDFromCLSID", "windows.h"},
+	{"PtInRect", "windows.h"},
+	{"PtInRegion", "windows.h"},
+	{"PtVisible", "windows.h"},
+	{"PulseEvent", "windows.h"},
+	{"PurgeComm", "windows.h"},
+	{"QueryDosDeviceA", "windows.h"},
+	{"QueryDosDeviceW", "windows.h"},
+	{"QueryPathOfRegTypeLib", "windows.h"},
+	{"QueryPerformanceCounter", "windows.h"},
+	{"QueryPerformanceFrequency", "windows.h"},
+	{"QueryServiceConfig2A", "windows.h"},
+	{"QueryServiceConfig2W", "windows.h"},
+	{"QueryServiceConfigA", "windows.h"},
+	{"QueryServiceConfigW", "windows.h"},
+	{"QueryServiceLockStatusA", "windows.h"},
+	{"QueryServiceLockStatusW", "windows.h"},
+	{"QueryServiceObjectSecurity", "windows.h"},
+	{"QueryServiceStatus", "windows.h"},
+	{"QueryServiceStatusEx", "windows.h"},
+	{"QueueUserAPC", "windows.h"},
+	{"RPC_CLIENT_FREE", "windows.h"},
+	{"RPC_FORWARD_FUNCTION", "windows.h"},
+	{"RPC_IF_CALLBACK_FN", "windows.h"},
+	{"RPC_OBJECT_INQ_FN", "windows.h"},
+	{"RaiseException", "windows.h"},
+	{"ReadClassStg", "windows.h"},
+	{"ReadClassStm", "windows.h"},
+	{"ReadConsoleA", "windows.h"},
+	{"ReadConsoleInputA", "windows.h"},
+	{"ReadConsoleInputW", "windows.h"},
+	{"ReadConsoleOutputA", "windows.h"},
+	{"ReadConsoleOutputAttribute", "windows.h"},
+	{"ReadConsoleOutputCharacterA", "windows.h"},
+	{"ReadConsoleOutputCharacterW", "windows.h"},
+	{"ReadConsoleOutputW", "windows.h"},
+	{"ReadConsoleW", "windows.h"},
+	{"ReadDirectoryChangesW", "windows.h"},
+	{"ReadEventLogA", "windows.h"},
+	{"ReadEventLogW", "windows.h"},
+	{"ReadFile", "windows.h"},
+	{"ReadFileEx", "windows.h"},
+	{"ReadFileScatter", "windows.h"},
+	{"ReadFmtUserTypeStg", "windows.h"},
+	{"ReadPrinter", "windows.h"},
+	{"ReadProcessMemory", "windows.h"},
+	{"RealChildWindowFromPoint", "windows.h"},
+	{"RealGetWindowClassA", "windows.h"},
+	{"RealGetWindowClassW", "windows.h"},
+	{"RealizePalette", "windows.h"},
+	{"RectInRegion", "windows.h"},
+	{"RectVisible", "windows.h"},
+	{"Rectangle", "windows.h"},
+	{"RedrawWindow", "windows.h"},
+	{"RegCloseKey", "windows.h"},
+	{"RegConnectRegistryA", "windows.h"},
+	{"RegConnectRegistryW", "windows.h"},
+	{"RegCreateKeyA", "windows.h"},
+	{"RegCreateKeyExA", "windows.h"},
+	{"RegCreateKeyExW", "windows.h"},
+	{"RegCreateKeyW", "windows.h"},
+	{"RegDeleteKeyA", "windows.h"},
+	{"RegDeleteKeyW", "windows.h"},
+	{"RegDeleteValueA", "windows.h"},
+	{"RegDeleteValueW", "windows.h"},
+	{"RegEnumKeyA", "windows.h"},
+	{"RegEnumKeyExA", "windows.h"},
+	{"RegEnumKeyExW", "windows.h"},
+	{"RegEnumKeyW", "windows.h"},
+	{"RegEnumValueA", "windows.h"},
+	{"RegEnumValueW", "windows.h"},
+	{"RegFlushKey", "windows.h"},
+	{"RegGetKeySecurity", "windows.h"},
+	{"RegLoadKeyA", "windows.h"},
+	{"RegLoadKeyW", "windows.h"},
+	{"RegNotifyChangeKeyValue", "windows.h"},
+	{"RegOpenKeyA", "windows.h"},
+	{"RegOpenKeyExA", "windows.h"},
+	{"RegOpenKeyExW", "windows.h"},
+	{"RegOpenKeyW", "windows.h"},
+	{"RegQueryInfoKeyA", "windows.h"},
+	{"RegQueryInfoKeyW", "windows.h"},
+	{"RegQueryMultipleValuesA", "windows.h"},
+	{"RegQueryMultipleValuesW", "windows.h"},
+	{"RegQueryValueA", "windows.h"},
+	{"RegQueryValueExA", "windows.h"},
+	{"RegQueryValueExW", "windows.h"},
+	{"RegQueryValueW", "windows.h"},
+	{"RegReplaceKeyA", "windows.h"},
+	{"RegReplaceKeyW", "windows.h"},
+	{"RegRestoreKeyA", "windows.h"},
+	{"RegRestoreKeyW", "windows.h"},
+	{"RegSaveKeyA", "windows.h"},
+	{"RegSaveKeyW", "windows.h"},
+	{"RegSetKeySecurity", "windows.h"},
+	{"RegSetValueA", "windows.h"},
+	{"RegSetValueExA", "windows.h"},
+	{"RegSetValueExW", "windows.h"},
+	{"RegSetValueW", "windows.h"},
+	{"RegUnLoadKeyA", "windows.h"},
+	{"RegUnLoadKeyW", "windows.h"},
+	{"RegisterActiveObject", "windows.h"},
+	{"RegisterClassA", "windows.h"},
+	{"RegisterClassExA", "windows.h"},
+	{"RegisterClassExW", "windows.h"},
+	{"RegisterClassW", "windows.h"},
+	{"RegisterClipboardFormatA", "windows.h"},
+	{"RegisterClipboardFormatW", "windows.h"},
+	{"RegisterDragDrop", "windows.h"},
+	{"RegisterEventSourceA", "windows.h"},
+	{"RegisterEventSourceW", "windows.h"},
+	{"RegisterHotKey", "windows.h"},
+	{"RegisterServiceCtrlHandlerA", "windows.h"},
+	{"RegisterServiceCtrlHandlerExA", "windows.h"},
+	{"RegisterServiceCtrlHandlerExW", "windows.h"},
+	{"RegisterServiceCtrlHandlerW", "windows.h"},
+	{"RegisterTypeLib", "windows.h"},
+	{"RegisterWindowMessageA", "windows.h"},
+	{"RegisterWindowMessageW", "windows.h"},
+	{"ReleaseCapture", "windows.h"},
+	{"ReleaseDC", "windows.h"},
+	{"ReleaseMutex", "windows.h"},
+	{"ReleaseSemaphore", "windows.h"},
+	{"ReleaseStgMedium", "windows.h"},
+	{"RemoveDirectoryA", "windows.h"},
+	{"RemoveDirectoryW", "windows.h"},
+	{"RemoveFontResourceA", "windows.h"},
+	{"RemoveFontResourceW", "windows.h"},
+	{"RemoveMenu", "windows.h"},
+	{"RemovePropA", "windows.h"},
+	{"RemovePropW", "windows.h"},
+	{"ReplaceTextA", "windows.h"},
+	{"ReplaceTextW", "windows.h"},
+	{"ReplyMessage", "windows.h"},
+	{"ReportEventA", "windows.h"},
+	{"ReportEventW", "windows.h"},
+	{"ResetDCA", "windows.h"},
+	{"ResetDCW", "windows.h"},
+	{"ResetEvent", "windows.h"},
+	{"ResetPrinterA", "windows.h"},
+	{"ResetPrinterW", "windows.h"},
+	{"ResetWriteWatch", "windows.h"},
+	{"ResizePalette", "windows.h"},
+	{"RestoreDC", "windows.h"},
+	{"ResumeThread", "windows.h"},
+	{"ReuseDDElParam", "windows.h"},
+	{"RevertToSelf", "windows.h"},
+	{"RevokeActiveObject", "windows.h"},
+	{"RevokeDragDrop", "windows.h"},
+	{"RoundRect", "windows.h"},
+	{"RpcBindingCopy", "windows.h"},
+	{"RpcBindingFree", "windows.h"},
+	{"RpcBindingFromStringBindingA", "windows.h"},
+	{"RpcBindingFromStringBindingW", "windows.h"},
+	{"RpcBindingInqAuthClientA", "windows.h"},
+	{"RpcBindingInqAuthClientW", "windows.h"},
+	{"RpcBindingInqAuthInfoA", "windows.h"},
+	{"RpcBindingInqAuthInfoExA", "windows.h"},
+	{"RpcBindingInqAuthInfoExW", "windows.h"},
+	{"RpcBindingInqAuthInfoW", "windows.h"},
+	{"RpcBindingInqObject", "windows.h"},
+	{"RpcBindingReset", "windows.h"},
+	{"RpcBindingServerFromClient", "windows.h"},
+	{"RpcBindingSetAuthInfoA", "windows.h"},
+	{"RpcBindingSetAuthInfoExA", "windows.h"},
+	{"RpcBindingSetAuthInfoExW", "windows.h"},
+	{"RpcBindingSetAuthInfoW", "windows.h"},
+	{"RpcBindingSetObject", "windows.h"},
+	{"RpcBindingToStringBindingA", "windows.h"},
+	{"RpcBindingToStringBindingW", "windows.h"},
+	{"RpcBindingVectorFree", "windows.h"},
+	{"RpcCancelThread", "windows.h"},
+	{"RpcEpRegisterA", "windows.h"},
+	{"RpcEpRegisterNoReplaceA", "windows.h"},
+	{"RpcEpRegisterNoReplaceW", "windows.h"},
+	{"RpcEpRegisterW", "windows.h"},
+	{"RpcEpResolveBinding", "windows.h"},
+	{"RpcEpUnregister", "windows.h"},
+	{"RpcIfIdVectorFree", "windows.h"},
+	{"RpcIfInqId", "windows.h"},
+	{"RpcImpersonateClient", "windows.h"},
+	{"RpcMgmtBindingInqParameter", "windows.h"},
+	{"RpcMgmtBindingSetParameter", "windows.h"},
+	{"RpcMgmtEnableIdleCleanup", "windows.h"},
+	{"RpcMgmtEpEltInqBegin", "windows.h"},
+	{"RpcMgmtEpEltInqDone", "windows.h"},
+	{"RpcMgmtEpEltInqNextA", "windows.h"},
+	{"RpcMgmtEpEltInqNextW", "windows.h"},
+	{"RpcMgmtEpUnregister", "windows.h"},
+	{"RpcMgmtInqComTimeout", "windows.h"},
+	{"RpcMgmtInqDefaultProtectLevel", "windows.h"},
+	{"RpcMgmtInqIfIds", "windows.h"},
+	{"RpcMgmtInqParameter", "windows.h"},
+	{"RpcMgmtInqServerPrincNameA", "windows.h"},
+	{"RpcMgmtInqServerPrincNameW", "windows.h"},
+	{"RpcMgmtInqStats", "windows.h"},
+	{"RpcMgmtIsServerListening", "windows.h"},
+	{"RpcMgmtSetAuthorizationFn", "windows.h"},
+	{"RpcMgmtSetCancelTimeout", "windows.h"},
+	{"RpcMgmtSetComTimeout", "windows.h"},
+	{"RpcMgmtSetParameter", "windows.h"},
+	{"RpcMgmtSetServerStackSize", "windows.h"},
+	{"RpcMgmtStatsVectorFree", "windows.h"},
+	{"RpcMgmtStopServerListening", "windows.h"},
+	{"RpcMgmtWaitServerListen", "windows.h"},
+	{"RpcNetworkInqProtseqsA", "windows.h"},
+	{"RpcNetworkInqProtseqsW", "windows.h"},
+	{"RpcNetworkIsProtseqValidA", "windows.h"},
+	{"RpcNetworkIsProtseqValidW", "windows.h"},
+	{"RpcNsBindingExportA", "windows.h"},
+	{"RpcNsBindingExportW", "windows.h"},
+	{"RpcNsBindingImportBeginA", "windows.h"},
+	{"RpcNsBindingImportBeginW", "windows.h"},
+	{"RpcNsBindingImportDone", "windows.h"},
+	{"RpcNsBindingImportNext", "windows.h"},
+	{"RpcNsBindingInqEntryNameA", "windows.h"},
+	{"RpcNsBindingInqEntryNameW", "windows.h"},
+	{"RpcNsBindingLookupBeginA", "windows.h"},
+	{"RpcNsBindingLookupBeginW", "windows.h"},
+	{"RpcNsBindingLookupDone", "windows.h"},
+	{"RpcNsBindingLookupNext", "windows.h"},
+	{"RpcNsBindingSelect", "windows.h"},
+	{"RpcNsBindingUnexportA", "windows.h"},
+	{"RpcNsBindingUnexportW", "windows.h"},
+	{"RpcNsEntryExpandNameA", "windows.h"},
+	{"RpcNsEntryExpandNameW", "windows.h"},
+	{"RpcNsEntryObjectInqBeginA", "windows.h"},
+	{"RpcNsEntryObjectInqBeginW", "windows.h"},
+	{"RpcNsEntryObjectInqDone", "windows.h"},
+	{"RpcNsEntryObjectInqNext", "windows.h"},
+	{"RpcNsGroupDeleteA", "windows.h"},
+	{"RpcNsGroupDeleteW", "windows.h"},
+	{"RpcNsGroupMbrAddA", "windows.h"},
+	{"RpcNsGroupMbrAddW", "windows.h"},
+	{"RpcNsGroupMbrInqBeginA", "windows.h"},
+	{"RpcNsGroupMbrInqBeginW", "windows.h"},
+	{"RpcNsGroupMbrInqDone", "windows.h"},
+	{"RpcNsGroupMbrInqNextA", "windows.h"},
+	{"RpcNsGroupMbrInqNextW", "windows.h"},
+	{"RpcNsGroupMbrRemoveA", "windows.h"},
+	{"RpcNsGroupMbrRemoveW", "windows.h"},
+	{"RpcNsMgmtBindingUnexportA", "windows.h"},
+	{"RpcNsMgmtBindingUnexportW", "windows.h"},
+	{"RpcNsMgmtEntryCreateA", "windows.h"},
+	{"RpcNsMgmtEntryCreateW", "windows.h"},
+	{"RpcNsMgmtEntryDeleteA", "windows.h"},
+	{"RpcNsMgmtEntryDeleteW", "windows.h"},
+	{"RpcNsMgmtEntryInqIfIdsA", "windows.h"},
+	{"RpcNsMgmtEntryInqIfIdsW", "windows.h"},
+	{"RpcNsMgmtHandleSetExpAge", "windows.h"},
+	{"RpcNsMgmtInqExpAge", "windows.h"},
+	{"RpcNsMgmtSetExpAge", "windows.h"},
+	{"RpcNsProfileDeleteA", "windows.h"},
+	{"RpcNsProfileDeleteW", "windows.h"},
+	{"RpcNsProfileEltAddA", "windows.h"},
+	{"RpcNsProfileEltAddW", "windows.h"},
+	{"RpcNsProfileEltInqBeginA", "windows.h"},
+	{"RpcNsProfileEltInqBeginW", "windows.h"},
+	{"RpcNsProfileEltInqDone", "windows.h"},
+	{"RpcNsProfileEltInqNextA", "windows.h"},
+	{"RpcNsProfileEltInqNextW", "windows.h"},
+	{"RpcNsProfileEltRemoveA", "windows.h"},
+	{"RpcNsProfileEltRemoveW", "windows.h"},
+	{"RpcObjectInqType", "windows.h"},
+	{"RpcObjectSetType", "windows.h"},
+	{"RpcProtseqVectorFreeA", "windows.h"},
+	{"RpcProtseqVectorFreeW", "windows.h"},
+	{"RpcRaiseException", "windows.h"},
+	{"RpcRevertToSelf", "windows.h"},
+	{"RpcServerInqDefaultPrincNameA", "windows.h"},
+	{"RpcServerInqDefaultPrincNameW", "windows.h"},
+	{"RpcServerInqIf", "windows.h"},
+	{"RpcServerListen", "windows.h"},
+	{"RpcServerRegisterAuthInfoA", "windows.h"},
+	{"RpcServerRegisterAuthInfoW", "windows.h"},
+	{"RpcServerRegisterIf", "windows.h"},
+	{"RpcServerUnregisterIf", "windows.h"},
+	{"RpcServerUseAllProtseqs", "windows.h"},
+	{"RpcServerUseAllProtseqsEx", "windows.h"},
+	{"RpcServerUseAllProtseqsIf", "windows.h"},
+	{"RpcServerUseAllProtseqsIfEx", "windows.h"},
+	{"RpcServerUseProtseqA", "windows.h"},
+	{"RpcServerUseProtseqEpA", "windows.h"},
+	{"RpcServerUseProtseqEpExA", "windows.h"},
+	{"RpcServerUseProtseqEpExW", "windows.h"},
+	{"RpcServerUseProtseqEpW", "windows.h"},
+	{"RpcServerUseProtseqExA", "windows.h"},
+	{"RpcServerUseProtseqExW", "windows.h"},
+	{"RpcServerUseProtseqIfA", "windows.h"},
+	{"RpcServerUseProtseqIfExA", "windows.h"},
+	{"RpcServerUseProtseqIfExW", "windows.h"},
+	{"RpcServerUseProtseqIfW", "windows.h"},
+	{"RpcServerUseProtseqW", "windows.h"},
+	{"RpcSmAllocate", "windows.h"},
+	{"RpcSmClientFree", "windows.h"},
+	{"RpcSmDestroyClientContext", "windows.h"},
+	{"RpcSmDisableAllocate", "windows.h"},
+	{"RpcSmEnableAllocate", "windows.h"},
+	{"RpcSmFree", "windows.h"},
+	{"RpcSmGetThreadHandle", "windows.h"},
+	{"RpcSmSetThreadHandle", "windows.h"},
+	{"RpcSsAllocate", "windows.h"},
+	{"RpcSsDestroyClientContext", "windows.h"},
+	{"RpcSsDisableAllocate", "windows.h"},
+	{"RpcSsDontSerializeContext", "windows.h"},
+	{"RpcSsEnableAllocate", "windows.h"},
+	{"RpcSsFree", "windows.h"},
+	{"RpcSsGetThreadHandle", "windows.h"},
+	{"RpcSsSetThreadHandle", "windows.h"},
+	{"RpcStringBindingComposeA", "windows.h"},
+	{"RpcStringBindingComposeW", "windows.h"},
+	{"RpcStringBindingParseA", "windows.h"},
+	{"RpcStringBindingParseW", "windows.h"},
+	{"RpcStringFreeA", "windows.h"},
+	{"RpcStringFreeW", "windows.h"},
+	{"RpcTestCancel", "windows.h"},
+	{"SHAppBarMessage", "windows.h"},
+	{"SHEmptyRecycleBinA", "windows.h"},
+	{"SHEmptyRecycleBinW", "windows.h"},
+	{"SHFileOperationA", "windows.h"},
+	{"SHFileOperationW", "windows.h"},
+	{"SHFreeNameMappings", "windows.h"},
+	{"SHGetFileInfoA", "windows.h"},
+	{"SHGetFileInfoW", "windows.h"},
+	{"SHQueryRecycleBinA", "windows.h"},
+	{"SHQueryRecycleBinW", "windows.h"},
+	{"SNB_free_inst", "windows.h"},
+	{"SNB_free_xmit", "windows.h"},
+	{"SNB_from_xmit", "windows.h"},
+	{"SNB_to_xmit", "windows.h"},
+	{"SafeArrayAccessData", "windows.h"},
+	{"SafeArrayAllocData", "windows.h"},
+	{"SafeArrayAllocDescriptor", "windows.h"},
+	{"SafeArrayAllocDescriptorEx", "windows.h"},
+	{"SafeArrayCopy", "windows.h"},
+	{"SafeArrayCreate", "windows.h"},
+	{"SafeArrayCreateVector", "windows.h"},
+	{"SafeArrayCreateVectorEx", "windows.h"},
+	{"SafeArrayDestroy", "windows.h"},
+	{"SafeArrayDestroyData", "windows.h"},
+	{"SafeArrayDestroyDescriptor", "windows.h"},
+	{"SafeArrayGetDim", "windows.h"},
+	{"SafeArrayGetElement", "windows.h"},
+	{"SafeArrayGetElemsize", "windows.h"},
+	{"SafeArrayGetIID", "windows.h"},
+	{"SafeArrayGetLBound", "windows.h"},
+	{"SafeArrayGetRecordInfo", "windows.h"},
+	{"SafeArrayGetUBound", "windows.h"},
+	{"SafeArrayGetVartype", "windows.h"},
+	{"SafeArrayLock", "windows.h"},
+	{"SafeArrayPtrOfIndex", "windows.h"},
+	{"SafeArrayPutElement", "windows.h"},
+	{"SafeArrayRedim", "windows.h"},
+	{"SafeArraySetIID", "windows.h"},
+	{"SafeArraySetRecordInfo", "windows.h"},
+	{"SafeArrayUnaccessData", "windows.h"},
+	{"SafeArrayUnlock", "windows.h"},
+	{"SaveDC", "windows.h"},
+	{"ScaleViewportExtEx", "windows.h"},
+	{"ScaleWindowExtEx", "windows.h"},
+	{"ScheduleJob", "windows.h"},
+	{"ScreenToClient", "windows.h"},
+	{"ScrollConsoleScreenBufferA", "windows.h"},
+	{"ScrollConsoleScreenBufferW", "windows.h"},
+	{"ScrollDC", "windows.h"},
+	{"ScrollWindow", "windows.h"},
+	{"ScrollWindowEx", "windows.h"},
+	{"SearchPathA", "windows.h"},
+	{"SearchPathW", "windows.h"},
+	{"SelectClipPath", "windows.h"},
+	{"SelectClipRgn", "windows.h"},
+	{"SelectObject", "windows.h"},
+	{"SelectPalette", "windows.h"},
+	{"SendDlgItemMessageA", "windows.h"},
+	{"SendDlgItemMessageW", "windows.h"},
+	{"SendDriverMessage", "windows.h"},
+	{"SendMessageA", "windows.h"},
+	{"SendMessageCallbackA", "windows.h"},
+	{"SendMessageCallbackW", "windows.h"},
+	{"SendMessageTimeoutA", "windows.h"},
+	{"SendMessageTimeoutW", "windows.h"},
+	{"SendMessageW", "windows.h"},
+	{"SendNotifyMessageA", "windows.h"},
+	{"SendNotifyMessageW", "windows.h"},
+	{"SetAbortProc", "windows.h"},
+	{"SetAclInformation", "windows.h"},
+	{"SetActiveWindow", "windows.h"},
+	{"SetArcDirection", "windows.h"},
+	{"SetBitmapBits", "windows.h"},
+	{"SetBitmapDimensionEx", "windows.h"},
+	{"SetBkColor", "windows.h"},
+	{"SetBkMode", "windows.h"},
+	{"SetBoundsRect", "windows.h"},
+	{"SetBrushOrgEx", "windows.h"},
+	{"SetCalendarInfoA", "windows.h"},
+	{"SetCalendarInfoW", "windows.h"},
+	{"SetCapture", "windows.h"},
+	{"SetCaretBlinkTime", "windows.h"},
+	{"SetCaretPos", "windows.h"},
+	{"SetClassLongA", "windows.h"},
+	{"SetClassLongW", "windows.h"},
+	{"SetClassWord", "windows.h"},
+	{"SetClipboardData", "windows.h"},
+	{"SetClipboardViewer", "windows.h"},
+	{"SetColorAdjustment", "windows.h"},
+	{"SetColorSpace", "windows.h"},
+	{"SetCommBreak", "windows.h"},
+	{"SetCommConfig", "windows.h"},
+	{"SetCommMask", "windows.h"},
+	{"SetCommState", "windows.h"},
+	{"SetCommTimeouts", "windows.h"},
+	{"SetComputerNameA", "windows.h"},
+	{"SetComputerNameW", "windows.h"},
+	{"SetConsoleActiveScreenBuffer", "windows.h"},
+	{"SetConsoleCP", "windows.h"},
+	{"SetConsoleCtrlHandler", "windows.h"},
+	{"SetConsoleCursorInfo", "windows.h"},
+	{"SetConsoleCursorPosition", "windows.h"},
+	{"SetConsoleMode", "windows.h"},
+	{"SetConsoleOutputCP", "windows.h"},
+	{"SetConsoleScreenBufferSize", "windows.h"},
+	{"SetConsoleTextAttribute", "windows.h"},
+	{"SetConsoleTitleA", "windows.h"},
+	{"SetConsoleTitleW", "windows.h"},
+	{"SetConsoleWindowInfo", "windows.h"},
+	{"SetConvertStg", "windows.h"},
+	{"SetCriticalSectionSpinCount", "windows.h"},
+	{"SetCurrentDirectoryA", "windows.h"},
+	{"SetCurrentDirectoryW", "windows.h"},
+	{"SetCursor", "windows.h"},
+	{"SetCursorPos", "windows.h"},
+	{"SetDIBColorTable", "windows.h"},
+	{"SetDIBits", "windows.h"},
+	{"SetDIBitsToDevice", "windows.h"},
+	{"SetDebugErrorLevel", "windows.h"},
+	{"SetDefaultCommConfigA", "windows.h"},
+	{"SetDefaultCommConfigW", "windows.h"},
+	{"SetDeviceGammaRamp", "windows.h"},
+	{"SetDlgItemInt", "windows.h"},
+	{"SetDlgItemTextA", "windows.h"},
+	{"SetDlgItemTextW", "windows.h"},
+	{"SetDoubleClickTime", "windows.h"},
+	{"SetEndOfFile", "windows.h"},
+	{"SetEnhMetaFileBits", "windows.h"},
+	{"SetEnvironmentVariableA", "windows.h"},
+	{"SetEnvironmentVariableW", "windows.h"},
+	{"SetErrorInfo", "windows.h"},
+	{"SetErrorMode", "windows.h"},
+	{"SetEvent", "windows.h"},
+	{"SetFileApisToANSI", "windows.h"},
+	{"SetFileApisToOEM", "windows.h"},
+	{"SetFileAttributesA", "windows.h"},
+	{"SetFileAttributesW", "windows.h"},
+	{"SetFilePointer", "windows.h"},
+	{"SetFilePointerEx", "windows.h"},
+	{"SetFileSecurityA", "windows.h"},
+	{"SetFileSecurityW", "windows.h"},
+	{"SetFileTime", "windows.h"},
+	{"SetFocus", "windows.h"},
+	{"SetForegroundWindow", "windows.h"},
+	{"SetFormA", "windows.h"},
+	{"SetFormW", "windows.h"},
+	{"SetGraphicsMode", "windows.h"},
+	{"SetHandleCount", "windows.h"},
+	{"SetHandleInformation", "windows.h"},
+	{"SetICMMode", "windows.h"},
+	{"SetICMProfileA", "windows.h"},
+	{"SetICMProfileW", "windows.h"},
+	{"SetJobA", "windows.h"},
+	{"SetJobW", "windows.h"},
+	{"SetKernelObjectSecurity", "windows.h"},
+	{"SetKeyboardState", "windows.h"},
+	{"SetLastError", "windows.h"},
+	{"SetLastErrorEx", "windows.h"},
+	{"SetLocalTime", "windows.h"},
+	{"SetLocaleInfoA", "windows.h"},
+	{"SetLocaleInfoW", "windows.h"},
+	{"SetMailslotInfo", "windows.h"},
+	{"SetMapMode", "windows.h"},
+	{"SetMapperFlags", "windows.h"},
+	{"SetMenu", "windows.h"},
+	{"SetMenuContextHelpId", "windows.h"},
+	{"SetMenuDefaultItem", "windows.h"},
+	{"SetMenuInfo", "windows.h"},
+	{"SetMenuItemBitmaps", "windows.h"},
+	{"SetMenuItemInfoA", "windows.h"},
+	{"SetMenuItemInfoW", "windows.h"},
+	{"SetMessageExtraInfo", "windows.h"},
+	{"SetMessageQueue", "windows.h"},
+	{"SetMetaFileBitsEx", "windows.h"},
+	{"SetMetaRgn", "windows.h"},
+	{"SetMiterLimit", "windows.h"},
+	{"SetNamedPipeHandleState", "windows.h"},
+	{"SetPaletteEntries", "windows.h"},
+	{"SetParent", "windows.h"},
+	{"SetPixel", "windows.h"},
+	{"SetPixelFormat", "windows.h"},
+	{"SetPixelV", "windows.h"},
+	{"SetPolyFillMode", "windows.h"},
+	{"SetPrinterA", "windows.h"},
+	{"SetPrinterDataA", "windows.h"},
+	{"SetPrinterDataW", "windows.h"},
+	{"SetPrinterW", "windows.h"},
+	{"SetPriorityClass", "windows.h"},
+	{"SetPrivateObjectSecurity", "windows.h"},
+	{"SetProcessAffinityMask", "windows.h"},
+	{"SetProcessPriorityBoost", "windows.h"},
+	{"SetProcessShutdownParameters", "windows.h"},
+	{"SetProcessWindowStation", "windows.h"},
+	{"SetProcessWorkingSetSize", "windows.h"},
+	{"SetPropA", "windows.h"},
+	{"SetPropW", "windows.h"},
+	{"SetROP2", "windows.h"},
+	{"SetRect", "windows.h"},
+	{"SetRectEmpty", "windows.h"},
+	{"SetRectRgn", "windows.h"},
+	{"SetScrollInfo", "windows.h"},
+	{"SetScrollPos", "windows.h"},
+	{"SetScrollRange", "windows.h"},
+	{"SetSecurityDescriptorControl", "windows.h"},
+	{"SetSecurityDescriptorDacl", "windows.h"},
+	{"SetSecurityDescriptorGroup", "windows.h"},
+	{"SetSecurityDescriptorOwner", "windows.h"},
+	{"SetSecurityDescriptorSacl", "windows.h"},
+	{"SetServiceObjectSecurity", "windows.h"},
+	{"SetServiceStatus", "windows.h"},
+	{"SetStdHandle", "windows.h"},
+	{"SetStretchBltMode", "windows.h"},
+	{"SetSysColors", "windows.h"},
+	{"SetSystemCursor", "windows.h"},
+	{"SetSystemPaletteUse", "windows.h"},
+	{"SetSystemPowerState", "windows.h"},
+	{"SetSystemTime", "windows.h"},
+	{"SetSystemTimeAdjustment", "windows.h"},
+	{"SetTapeParameters", "windows.h"},
+	{"SetTapePosition", "windows.h"},
+	{"SetTextAlign", "windows.h"},
+	{"SetTextCharacterExtra", "windows.h"},
+	{"SetTextColor", "windows.h"},
+	{"SetTextJustification", "windows.h"},
+	{"SetThreadAffinityMask", "windows.h"},
+	{"SetThreadContext", "windows.h"},
+	{"SetThreadDesktop", "windows.h"},
+	{"SetThreadIdealProcessor", "windows.h"},
+	{"SetThreadLocale", "windows.h"},
+	{"SetThreadPriority", "windows.h"},
+	{"SetThreadPriorityBoost", "windows.h"},
+	{"SetThreadToken", "windows.h"},
+	{"SetTimeZoneInformation", "windows.h"},
+	{"SetTimer", "windows.h"},
+	{"SetTokenInformation", "windows.h"},
+	{"SetUnhandledExceptionFilter", "windows.h"},
+	{"SetUserGeoID", "windows.h"},
+	{"SetUserObjectInformationA", "windows.h"},
+	{"SetUserObjectInformationW", "windows.h"},
+	{"SetUserObjectSecurity", "windows.h"},
+	{"SetViewportExtEx", "windows.h"},
+	{"SetViewportOrgEx", "windows.h"},
+	{"SetVolumeLabelA", "windows.h"},
+	{"SetVolumeLabelW", "windows.h"},
+	{"SetWaitableTimer", "windows.h"},
+	{"SetWinMetaFileBits", "windows.h"},
+	{"SetWindowContextHelpId", "windows.h"},
+	{"SetWindowExtEx", "windows.h"},
+	{"SetWindowLongA", "windows.h"},
+	{"SetWindowLongW", "windows.h"},
+	{"SetWindowOrgEx", "windows.h"},
+	{"SetWindowPlacement", "windows.h"},
+	{"SetWindowPos", "windows.h"},
+	{"SetWindowRgn", "windows.h"},
+	{"SetWindowTextA", "windows.h"},
+	{"SetWindowTextW", "windows.h"},
+	{"SetWindowWord", "windows.h"},
+	{"SetWindowsHookA", "windows.h"},
+	{"SetWindowsHookExA", "windows.h"},
+	{"SetWindowsHookExW", "windows.h"},
+	{"SetWindowsHookW", "windows.h"},
+	{"SetWorldTransform", "windows.h"},
+	{"SetupComm", "windows.h"},
+	{"ShellAboutA", "windows.h"},
+	{"ShellAboutW", "windows.h"},
+	{"ShellExecuteA", "windows.h"},
+	{"ShellExecuteExA", "windows.h"},
+	{"ShellExecuteExW", "windows.h"},
+	{"ShellExecuteW", "windows.h"},
+	{"Shell_NotifyIconA", "windows.h"},
+	{"Shell_NotifyIconW", "windows.h"},
+	{"ShowCaret", "windows.h"},
+	{"ShowCursor", "windows.h"},
+	{"ShowOwnedPopups", "windows.h"},
+	{"ShowScrollBar", "windows.h"},
+	{"ShowWindow", "windows.h"},
+	{"ShowWindowAsync", "windows.h"},
+	{"SignalObjectAndWait", "windows.h"},
+	{"SizeofResource", "windows.h"},
+	{"Sleep", "windows.h"},
+	{"SleepEx", "windows.h"},
+	{"StartDocA", "windows.h"},
+	{"StartDocPrinterA", "windows.h"},
+	{"StartDocPrinterW", "windows.h"},
+	{"StartDocW", "windows.h"},
+	{"StartPage", "windows.h"},
+	{"StartPagePrinter", "windows.h"},
+	{"StartServiceA", "windows.h"},
+	{"StartServiceCtrlDispatcherA", "windows.h"},
+	{"StartServiceCtrlDispatcherW", "windows.h"},
+	{"StartServiceW", "windows.h"},
+	{"StgCreateDocfile", "windows.h"},
+	{"StgCreateDocfileOnILockBytes", "windows.h"},
+	{"StgCreateStorageEx", "windows.h"},
+	{"StgIsStorageFile", "windows.h"},
+	{"StgIsStorageILockBytes", "windows.h"},
+	{"StgOpenStorage", "windows.h"},
+	{"StgOpenStorageEx", "windows.h"},
+	{"StgOpenStorageOnILockBytes", "windows.h"},
+	{"StgSetTimes", "windows.h"},
+	{"StretchBlt", "windows.h"},
+	{"StretchDIBits", "windows.h"},
+	{"StringFromCLSID", "windows.h"},
+	{"StringFromGUID2", "windows.h"},
+	{"StringFromIID", "windows.h"},
+	{"StrokeAndFillPath", "windows.h"},
+	{"StrokePath", "windows.h"},
+	{"SubtractRect", "windows.h"},
+	{"SuspendThread", "windows.h"},
+	{"SwapBuffers", "windows.h"},
+	{"SwapMouseButton", "windows.h"},
+	{"SwitchDesktop", "windows.h"},
+	{"SwitchToFiber", "windows.h"},
+	{"SwitchToThread", "windows.h"},
+	{"SysAllocString", "windows.h"},
+	{"SysAllocStringByteLen", "windows.h"},
+	{"SysAllocStringLen", "windows.h"},
+	{"SysFreeString", "windows.h"},
+	{"SysReAllocString", "windows.h"},
+	{"SysReAllocStringLen", "windows.h"},
+	{"SysStringByteLen", "windows.h"},
+	{"SysStringLen", "windows.h"},
+	{"SystemParametersInfoA", "windows.h"},
+	{"SystemParametersInfoW", "windows.h"},
+	{"SystemTimeToFileTime", "windows.h"},
+	{"SystemTimeToTzSpecificLocalTime", "windows.h"},
+	{"SystemTimeToVariantTime", "windows.h"},
+	{"TabbedTextOutA", "windows.h"},
+	{"TabbedTextOutW", "windows.h"},
+	{"TerminateProcess", "windows.h"},
+	{"TerminateThread", "windows.h"},
+	{"TextOutA", "windows.h"},
+	{"TextOutW", "windows.h"},
+	{"TileWindows", "windows.h"},
+	{"TlsAlloc", "windows.h"},
+	{"TlsFree", "windows.h"},
+	{"TlsGetValue", "windows.h"},
+	{"TlsSetValue", "windows.h"},
+	{"ToAscii", "windows.h"},
+	{"ToAsciiEx", "windows.h"},
+	{"ToUnicode", "windows.h"},
+	{"ToUnicodeEx", "windows.h"},
+	{"TrackMouseEvent", "windows.h"},
+	{"TrackPopupMenu", "windows.h"},
+	{"TrackPopupMenuEx", "windows.h"},
+	{"TransactNamedPipe", "windows.h"},
+	{"TranslateAcceleratorA", "windows.h"},
+	{"TranslateAcceleratorW", "windows.h"},
+	{"TranslateCharsetInfo", "windows.h"},
+	{"TranslateMDISysAccel", "windows.h"},
+	{"TranslateMessage", "windows.h"},
+	{"TransmitCommChar", "windows.h"},
+	{"TryEnterCriticalSection", "windows.h"},
+	{"UnRegisterTypeLib", "windows.h"},
+	{"UnhandledExceptionFilter", "windows.h"},
+	{"UnhookWindowsHook", "windows.h"},
+	{"UnhookWindowsHookEx", "windows.h"},
+	{"UnionRect", "windows.h"},
+	{"UnloadKeyboardLayout", "windows.h"},
+	{"UnlockFile", "windows.h"},
+	{"UnlockFileEx", "windows.h"},
+	{"UnlockServiceDatabase", "windows.h"},
+	{"UnmapViewOfFile", "windows.h"},
+	{"UnpackDDElParam", "windows.h"},
+	{"UnrealizeObject", "windows.h"},
+	{"UnregisterClassA", "windows.h"},
+	{"UnregisterClassW", "windows.h"},
+	{"UnregisterHotKey", "windows.h"},
+	{"UpdateColors", "windows.h"},
+	{"UpdateICMRegKeyA", "windows.h"},
+	{"UpdateICMRegKeyW", "windows.h"},
+	{"UpdateResourceA", "windows.h"},
+	{"UpdateResourceW", "windows.h"},
+	{"UpdateWindow", "windows.h"},
+	{"UuidCompare", "windows.h"},
+	{"UuidCreate", "windows.h"},
+	{"UuidCreateNil", "windows.h"},
+	{"UuidEqual", "windows.h"},
+	{"UuidFromStringA", "windows.h"},
+	{"UuidFromStringW", "windows.h"},
+	{"UuidHash", "windows.h"},
+	{"UuidIsNil", "windows.h"},
+	{"UuidToStringA", "windows.h"},
+	{"UuidToStringW", "windows.h"},
+	{"ValidateRect", "windows.h"},
+	{"ValidateRgn", "windows.h"},
+	{"VarAbs", "windows.h"},
+	{"VarAdd", "windows.h"},
+	{"VarAnd", "windows.h"},
+	{"VarBoolFromCy", "windows.h"},
+	{"VarBoolFromDate", "windows.h"},
+	{"VarBoolFromDec", "windows.h"},
+	{"VarBoolFromDisp", "windows.h"},
+	{"VarBoolFromI1", "windows.h"},
+	{"VarBoolFromI2", "windows.h"},
+	{"VarBoolFromI4", "windows.h"},
+	{"VarBoolFromI8", "windows.h"},
+	{"VarBoolFromR4", "windows.h"},
+	{"VarBoolFromR8", "windows.h"},
+	{"VarBoolFromStr", "windows.h"},
+	{"VarBoolFromUI1", "windows.h"},
+	{"VarBoolFromUI2", "windows.h"},
+	{"VarBoolFromUI4", "windows.h"},
+	{"VarBoolFromUI8", "windows.h"},
+	{"VarBstrCat", "windows.h"},
+	{"VarBstrCmp", "windows.h"},
+	{"VarBstrFromBool", "windows.h"},
+	{"VarBstrFromCy", "windows.h"},
+	{"VarBstrFromDate", "windows.h"},
+	{"VarBstrFromDec", "windows.h"},
+	{"VarBstrFromDisp", "windows.h"},
+	{"VarBstrFromI1", "windows.h"},
+	{"VarBstrFromI2", "windows.h"},
+	{"VarBstrFromI4", "windows.h"},
+	{"VarBstrFromI8", "windows.h"},
+	{"VarBstrFromR4", "windows.h"},
+	{"VarBstrFromR8", "windows.h"},
+	{"VarBstrFromUI1", "windows.h"},
+	{"VarBstrFromUI2", "windows.h"},
+	{"VarBstrFromUI4", "windows.h"},
+	{"VarBstrFromUI8", "windows.h"},
+	{"VarCat", "windows.h"},
+	{"VarCmp", "windows.h"},
+	{"VarCyAbs", "windows.h"},
+	{"VarCyAdd", "windows.h"},
+	{"VarCyCmp", "windows.h"},
+	{"VarCyCmpR8", "windows.h"},
+	{"VarCyFix", "windows.h"},
+	{"VarCyFromBool", "windows.h"},
+	{"VarCyFromDate", "windows.h"},
+	{"VarCyFromDec", "windows.h"},
+	{"VarCyFromDisp", "windows.h"},
+	{"VarCyFromI1", "windows.h"},
+	{"VarCyFromI2", "windows.h"},
+	{"VarCyFromI4", "windows.h"},
+	{"VarCyFromI8", "windows.h"},
+	{"VarCyFromR4", "windows.h"},
+	{"VarCyFromR8", "windows.h"},
+	{"VarCyFromStr", "windows.h"},
+	{"VarCyFromUI1", "windows.h"},
+	{"VarCyFromUI2", "windows.h"},
+	{"VarCyFromUI4", "windows.h"},
+	{"VarCyFromUI8", "windows.h"},
+	{"VarCyInt", "windows.h"},
+	{"VarCyMul", "windows.h"},
+	{"VarCyMulI4", "windows.h"},
+	{"VarCyMulI8", "windows.h"},
+	{"VarCyNeg", "windows.h"},
+	{"VarCyRound", "windows.h"},
+	{"VarCySub", "windows.h"},
+	{"VarDateFromBool", "windows.h"},
+	{"VarDateFromCy", "windows.h"},
+	{"VarDateFromDec", "windows.h"},
+	{"VarDateFromDisp", "windows.h"},
+	{"VarDateFromI1", "windows.h"},
+	{"VarDateFromI2", "windows.h"},
+	{"VarDateFromI4", "windows.h"},
+	{"VarDateFromI8", "windows.h"},
+	{"VarDateFromR4", "windows.h"},
+	{"VarDateFromR8", "windows.h"},
+	{"VarDateFromStr", "windows.h"},
+	{"VarDateFromUI1", "windows.h"},
+	{"VarDateFromUI2", "windows.h"},
+	{"VarDateFromUI4", "windows.h"},
+	{"VarDateFromUI8", "windows.h"},
+	{"VarDateFromUdate", "windows.h"},
+	{"VarDateFromUdateEx", "windows.h"},
+	{"VarDecAbs", "windows.h"},
+	{"VarDecAdd", "windows.h"},
+	{"VarDecCmp", "windows.h"},
+	{"VarDecCmpR8", "windows.h"},
+	{"VarDecDiv", "windows.h"},
+	{"VarDecFix", "windows.h"},
+	{"VarDecFromBool", "windows.h"},
+	{"VarDecFromCy", "windows.h"},
+	{"VarDecFromDate", "windows.h"},
+	{"VarDecFromDisp", "windows.h"},
+	{"VarDecFromI1", "windows.h"},
+	{"VarDecFromI2", "windows.h"},
+	{"VarDecFromI4", "windows.h"},
+	{"VarDecFromI8", "windows.h"},
+	{"VarDecFromR4", "windows.h"},
+	{"VarDecFromR8", "windows.h"},
+	{"VarDecFromStr", "windows.h"},
+	{"VarDecFromUI1", "windows.h"},
+	{"VarDecFromUI2", "windows.h"},
+	{"VarDecFromUI4", "windows.h"},
+	{"VarDecFromUI8", "windows.h"},
+	{"VarDecInt", "windows.h"},
+	{"VarDecMul", "windows.h"},
+	{"VarDecNeg", "windows.h"},
+	{"VarDecRound", "windows.h"},
+	{"VarDecSub", "windows.h"},
+	{"VarDiv", "windows.h"},
+	{"VarEqv", "windows.h"},
+	{"VarFix", "windows.h"},
+	{"VarI1FromBool", "windows.h"},
+	{"VarI1FromCy", "windows.h"},
+	{"VarI1FromDate", "windows.h"},
+	{"VarI1FromDec", "windows.h"},
+	{"VarI1FromDisp", "windows.h"},
+	{"VarI1FromI2", "windows.h"},
+	{"VarI1FromI4", "windows.h"},
+	{"VarI1FromI8", "windows.h"},
+	{"VarI1FromR4", "windows.h"},
+	{"VarI1FromR8", "windows.h"},
+	{"VarI1FromStr", "windows.h"},
+	{"VarI1FromUI1", "windows.h"},
+	{"VarI1FromUI2", "windows.h"},
+	{"VarI1FromUI4", "windows.h"},
+	{"VarI1FromUI8", "windows.h"},
+	{"VarI2FromBool", "windows.h"},
+	{"VarI2FromCy", "windows.h"},
+	{"VarI2FromDate", "windows.h"},
+	{"VarI2FromDec", "windows.h"},
+	{"VarI2FromDisp", "windows.h"},
+	{"VarI2FromI1", "windows.h"},
+	{"VarI2FromI4", "windows.h"},
+	{"VarI2FromI8", "windows.h"},
+	{"VarI2FromR4", "windows.h"},
+	{"VarI2FromR8", "windows.h"},
+	{"VarI2FromStr", "windows.h"},
+	{"VarI2FromUI1", "windows.h"},
+	{"VarI2FromUI2", "windows.h"},
+	{"VarI2FromUI4", "windows.h"},
+	{"VarI2FromUI8", "windows.h"},
+	{"VarI4FromBool", "windows.h"},
+	{"VarI4FromCy", "windows.h"},
+	{"VarI4FromDate", "windows.h"},
+	{"VarI4FromDec", "windows.h"},
+	{"VarI4FromDisp", "windows.h"},
+	{"VarI4FromI1", "windows.h"},
+	{"VarI4FromI2", "windows.h"},
+	{"VarI4FromI8", "windows.h"},
+	{"VarI4FromR4", "windows.h"},
+	{"VarI4FromR8", "windows.h"},
+	{"VarI4FromStr", "windows.h"},
+	{"VarI4FromUI1", "windows.h"},
+	{"VarI4FromUI2", "windows.h"},
+	{"VarI4FromUI4", "windows.h"},
+	{"VarI4FromUI8", "windows.h"},
+	{"VarI8FromBool", "windows.h"},
+	{"VarI8FromCy", "windows.h"},
+	{"VarI8FromDate", "windows.h"},
+	{"VarI8FromDec", "windows.h"},
+	{"VarI8FromDisp", "windows.h"},
+	{"VarI8FromI1", "windows.h"},
+	{"VarI8FromI2", "windows.h"},
+	{"VarI8FromI4", "windows.h"},
+	{"VarI8FromInt", "windows.h"},
+	{"VarI8FromR4", "windows.h"},
+	{"VarI8FromR8", "windows.h"},
+	{"VarI8FromStr", "windows.h"},
+	{"VarI8FromUI1", "windows.h"},
+	{"VarI8FromUI2", "windows.h"},
+	{"VarI8FromUI4", "windows.h"},
+	{"VarI8FromUI8", "windows.h"},
+	{"VarIdiv", "windows.h"},
+	{"VarImp", "windows.h"},
+	{"VarInt", "windows.h"},
+	{"VarMod", "windows.h"},
+	{"VarMul", "windows.h"},
+	{"VarNeg", "windows.h"},
+	{"VarNot", "windows.h"},
+	{"VarNumFromParseNum", "windows.h"},
+	{"VarOr", "windows.h"},
+	{"VarParseNumFromStr", "windows.h"},
+	{"VarPow", "windows.h"},
+	{"VarR4CmpR8", "windows.h"},
+	{"VarR4FromBool", "windows.h"},
+	{"VarR4FromCy", "windows.h"},
+	{"VarR4FromDate", "windows.h"},
+	{"VarR4FromDec", "windows.h"},
+	{"VarR4FromDisp", "windows.h"},
+	{"VarR4FromI1", "windows.h"},
+	{"VarR4FromI2", "windows.h"},
+	{"VarR4FromI4", "windows.h"},
+	{"VarR4FromI8", "windows.h"},
+	{"VarR4FromR8", "windows.h"},
+	{"VarR4FromStr", "windows.h"},
+	{"VarR4FromUI1", "windows.h"},
+	{"VarR4FromUI2", "windows.h"},
+	{"VarR4FromUI4", "windows.h"},
+	{"VarR4FromUI8", "windows.h"},
+	{"VarR8FromBool", "windows.h"},
+	{"VarR8FromCy", "windows.h"},
+	{"VarR8FromDate", "windows.h"},
+	{"VarR8FromDec", "windows.h"},
+	{"VarR8FromDisp", "windows.h"},
+	{"VarR8FromI1", "windows.h"},
+	{"VarR8FromI2", "windows.h"},
+	{"VarR8FromI4", "windows.h"},
+	{"VarR8FromI8", "windows.h"},
+	{"VarR8FromR4", "windows.h"},
+	{"VarR8FromStr", "windows.h"},
+	{"VarR8FromUI1", "windows.h"},
+	{"VarR8FromUI2", "windows.h"},
+	{"VarR8FromUI4", "windows.h"},
+	{"VarR8FromUI8", "windows.h"},
+	{"VarR8Pow", "windows.h"},
+	{"VarR8Round", "windows.h"},
+	{"VarRound", "windows.h"},
+	{"VarSub", "windows.h"},
+	{"VarUI1FromBool", "windows.h"},
+	{"VarUI1FromCy", "windows.h"},
+	{"VarUI1FromDate", "windows.h"},
+	{"VarUI1FromDec", "windows.h"},
+	{"VarUI1FromDisp", "windows.h"},
+	{"VarUI1FromI1", "windows.h"},
+	{"VarUI1FromI2", "windows.h"},
+	{"VarUI1FromI4", "windows.h"},
+	{"VarUI1FromI8", "windows.h"},
+	{"VarUI1FromR4", "windows.h"},
+	{"VarUI1FromR8", "windows.h"},
+	{"VarUI1FromStr", "windows.h"},
+	{"VarUI1FromUI2", "windows.h"},
+	{"VarUI1FromUI4", "windows.h"},
+	{"VarUI1FromUI8", "windows.h"},
+	{"VarUI2FromBool", "windows.h"},
+	{"VarUI2FromCy", "windows.h"},
+	{"VarUI2FromDate", "windows.h"},
+	{"VarUI2FromDec", "windows.h"},
+	{"VarUI2FromDisp", "windows.h"},
+	{"VarUI2FromI1", "windows.h"},
+	{"VarUI2FromI2", "windows.h"},
+	{"VarUI2FromI4", "windows.h"},
+	{"VarUI2FromI8", "windows.h"},
+	{"VarUI2FromR4", "windows.h"},
+	{"VarUI2FromR8", "windows.h"},
+	{"VarUI2FromStr", "windows.h"},
+	{"VarUI2FromUI1", "windows.h"},
+	{"VarUI2FromUI4", "windows.h"},
+	{"VarUI2FromUI8", "windows.h"},
+	{"VarUI4FromBool", "windows.h"},
+	{"VarUI4FromCy", "windows.h"},
+	{"VarUI4FromDate", "windows.h"},
+	{"VarUI4FromDec", "windows.h"},
+	{"VarUI4FromDisp", "windows.h"},
+	{"VarUI4FromI1", "windows.h"},
+	{"VarUI4FromI2", "windows.h"},
+	{"VarUI4FromI4", "windows.h"},
+	{"VarUI4FromI8", "windows.h"},
+	{"VarUI4FromR4", "windows.h"},
+	{"VarUI4FromR8", "windows.h"},
+	{"VarUI4FromStr", "windows.h"},
+	{"VarUI4FromUI1", "windows.h"},
+	{"VarUI4FromUI2", "windows.h"},
+	{"VarUI4FromUI8", "windows.h"},
+	{"VarUI8FromBool", "windows.h"},
+	{"VarUI8FromCy", "windows.h"},
+	{"VarUI8FromDate", "windows.h"},
+	{"VarUI8FromDec", "windows.h"},
+	{"VarUI8FromDisp", "windows.h"},
+	{"VarUI8FromI1", "windows.h"},
+	{"VarUI8FromI2", "windows.h"},
+	{"VarUI8FromI4", "windows.h"},
+	{"VarUI8FromI8", "windows.h"},
+	{"VarUI8FromInt", "windows.h"},
+	{"VarUI8FromR4", "windows.h"},
+	{"VarUI8FromR8", "windows.h"},
+	{"VarUI8FromStr", "windows.h"},
+	{"VarUI8FromUI1", "windows.h"},
+	{"VarUI8FromUI2", "windows.h"},
+	{"VarUI8FromUI4", "windows.h"},
+	{"VarUdateFromDate", "windows.h"},
+	{"VarXor", "windows.h"},
+	{"VariantChangeType", "windows.h"},
+	{"VariantChangeTypeEx", "windows.h"},
+	{"VariantClear", "windows.h"},
+	{"VariantCopy", "windows.h"},
+	{"VariantCopyInd", "windows.h"},
+	{"VariantInit", "windows.h"},
+	{"VariantTimeToDosDateTime", "windows.h"},
+	{"VariantTimeToSystemTime", "windows.h"},
+	{"VectorFromBstr", "windows.h"},
+	{"VerFindFileA", "windows.h"},
+	{"VerFindFileW", "windows.h"},
+	{"VerInstallFileA", "windows.h"},
+	{"VerInstallFileW", "windows.h"},
+	{"VerLanguageNameA", "windows.h"},
+	{"VerLanguageNameW", "windows.h"},
+	{"VerQueryValueA", "windows.h"},
+	{"VerQueryValueW", "windows.h"},
+	{"VerifyVersionInfoA", "windows.h"},
+	{"VerifyVersionInfoW", "windows.h"},
+	{"VirtualAlloc", "windows.h"},
+	{"VirtualAllocEx", "windows.h"},
+	{"VirtualFree", "windows.h"},
+	{"VirtualFreeEx", "windows.h"},
+	{"VirtualLock", "windows.h"},
+	{"VirtualProtect", "windows.h"},
+	{"VirtualProtectEx", "windows.h"},
+	{"VirtualQuery", "windows.h"},
+	{"VirtualQueryEx", "windows.h"},
+	{"VirtualUnlock", "windows.h"},
+	{"VkKeyScanA", "windows.h"},
+	{"VkKeyScanExA", "windows.h"},
+	{"VkKeyScanExW", "windows.h"},
+	{"VkKeyScanW", "windows.h"},
+	{"WNetAddConnection2A", "windows.h"},
+	{"WNetAddConnection2W", "windows.h"},
+	{"WNetAddConnection3A", "windows.h"},
+	{"WNetAddConnection3W", "windows.h"},
+	{"WNetAddConnectionA", "windows.h"},
+	{"WNetAddConnectionW", "windows.h"},
+	{"WNetCancelConnection2A", "windows.h"},
+	{"WNetCancelConnection2W", "windows.h"},
+	{"WNetCancelConnectionA", "windows.h"},
+	{"WNetCancelConnectionW", "windows.h"},
+	{"WNetCloseEnum", "windows.h"},
+	{"WNetConnectionDialog", "windows.h"},
+	{"WNetConnectionDialog1A", "windows.h"},
+	{"WNetConnectionDialog1W", "windows.h"},
+	{"WNetDisconnectDialog", "windows.h"},
+	{"WNetDisconnectDialog1A", "windows.h"},
+	{"WNetDisconnectDialog1W", "windows.h"},
+	{"WNetEnumResourceA", "windows.h"},
+	{"WNetEnumResourceW", "windows.h"},
+	{"WNetGetConnectionA", "windows.h"},
+	{"WNetGetConnectionW", "windows.h"},
+	{"WNetGetLastErrorA", "windows.h"},
+	{"WNetGetLastErrorW", "windows.h"},
+	{"WNetGetNetworkInformationA", "windows.h"},
+	{"WNetGetNetworkInformationW", "windows.h"},
+	{"WNetGetProviderNameA", "windows.h"},
+	{"WNetGetProviderNameW", "windows.h"},
+	{"WNetGetResourceInformationA", "windows.h"},
+	{"WNetGetResourceInformationW", "windows.h"},
+	{"WNetGetResourceParentA", "windows.h"},
+	{"WNetGetResourceParentW", "windows.h"},
+	{"WNetGetUniversalNameA", "windows.h"},
+	{"WNetGetUniversalNameW", "windows.h"},
+	{"WNetGetUserA", "windows.h"},
+	{"WNetGetUserW", "windows.h"},
+	{"WNetOpenEnumA", "windows.h"},
+	{"WNetOpenEnumW", "windows.h"},
+	{"WNetSetConnectionA", "windows.h"},
+	{"WNetSetConnectionW", "windows.h"},
+	{"WNetUseConnectionA", "windows.h"},
+	{"WNetUseConnectionW", "windows.h"},
+	{"WSAAccept", "windows.h"},
+	{"WSAAddressToStringA", "windows.h"},
+	{"WSAAddressToStringW", "windows.h"},
+	{"WSAAsyncGetHostByAddr", "windows.h"},
+	{"WSAAsyncGetHostByName", "windows.h"},
+	{"WSAAsyncGetProtoByName", "windows.h"},
+	{"WSAAsyncGetProtoByNumber", "windows.h"},
+	{"WSAAsyncGetServByName", "windows.h"},
+	{"WSAAsyncGetServByPort", "windows.h"},
+	{"WSAAsyncSelect", "windows.h"},
+	{"WSACancelAsyncRequest", "windows.h"},
+	{"WSACancelBlockingCall", "windows.h"},
+	{"WSACleanup", "windows.h"},
+	{"WSACloseEvent", "windows.h"},
+	{"WSAConnect", "windows.h"},
+	{"WSACreateEvent", "windows.h"},
+	{"WSADuplicateSocketA", "windows.h"},
+	{"WSADuplicateSocketW", "windows.h"},
+	{"WSAEnumNameSpaceProvidersA", "windows.h"},
+	{"WSAEnumNameSpaceProvidersW", "windows.h"},
+	{"WSAEnumNetworkEvents", "windows.h"},
+	{"WSAEnumProtocolsA", "windows.h"},
+	{"WSAEnumProtocolsW", "windows.h"},
+	{"WSAEventSelect", "windows.h"},
+	{"WSAGetLastError", "windows.h"},
+	{"WSAGetOverlappedResult", "windows.h"},
+	{"WSAGetQOSByName", "windows.h"},
+	{"WSAGetServiceClassInfoA", "windows.h"},
+	{"WSAGetServiceClassInfoW", "windows.h"},
+	{"WSAGetServiceClassNameByClassIdA", "windows.h"},
+	{"WSAGetServiceClassNameByClassIdW", "windows.h"},
+	{"WSAHtonl", "windows.h"},
+	{"WSAHtons", "windows.h"},
+	{"WSAInstallServiceClassA", "windows.h"},
+	{"WSAInstallServiceClassW", "windows.h"},
+	{"WSAIoctl", "windows.h"},
+	{"WSAIsBlocking", "windows.h"},
+	{"WSAJoinLeaf", "windows.h"},
+	{"WSALookupServiceBeginA", "windows.h"},
+	{"WSALookupServiceBeginW", "windows.h"},
+	{"WSALookupServiceEnd", "windows.h"},
+	{"WSALookupServiceNextA", "windows.h"},
+	{"WSALookupServiceNextW", "windows.h"},
+	{"WSANSPIoctl", "windows.h"},
+	{"WSANtohl", "windows.h"},
+	{"WSANtohs", "windows.h"},
+	{"WSARecv", "windows.h"},
+	{"WSARecvDisconnect", "windows.h"},
+	{"WSARecvFrom", "windows.h"},
+	{"WSARemoveServiceClass", "windows.h"},
+	{"WSAResetEvent", "windows.h"},
+	{"WSASend", "windows.h"},
+	{"WSASendDisconnect", "windows.h"},
+	{"WSASendTo", "windows.h"},
+	{"WSASetBlockingHook", "windows.h"},
+	{"WSASetEvent", "windows.h"},
+	{"WSASetLastError", "windows.h"},
+	{"WSASetServiceA", "windows.h"},
+	{"WSASetServiceW", "windows.h"},
+	{"WSASocketA", "windows.h"},
+	{"WSASocketW", "windows.h"},
+	{"WSAStartup", "windows.h"},
+	{"WSAStringToAddressA", "windows.h"},
+	{"WSAStringToAddressW", "windows.h"},
+	{"WSAUnhookBlockingHook", "windows.h"},
+	{"WSAWaitForMultipleEvents", "windows.h"},
+	{"WaitCommEvent", "windows.h"},
+	{"WaitForDebugEvent", "windows.h"},
+	{"WaitForInputIdle", "windows.h"},
+	{"WaitForMultipleObjects", "windows.h"},
+	{"WaitForMultipleObjectsEx", "windows.h"},
+	{"WaitForPrinterChange", "windows.h"},
+	{"WaitForSingleObject", "windows.h"},
+	{"WaitForSingleObjectEx", "windows.h"},
+	{"WaitMessage", "windows.h"},
+	{"WaitNamedPipeA", "windows.h"},
+	{"WaitNamedPipeW", "windows.h"},
+	{"WideCharToMultiByte", "windows.h"},
+	{"WidenPath", "windows.h"},
+	{"WinExec", "windows.h"},
+	{"WinHelpA", "windows.h"},
+	{"WinHelpW", "windows.h"},
+	{"WinLoadTrustProvider", "windows.h"},
+	{"WinMain", "windows.h"},
+	{"WindowFromDC", "windows.h"},
+	{"WindowFromPoint", "windows.h"},
+	{"WriteClassStg", "windows.h"},
+	{"WriteClassStm", "windows.h"},
+	{"WriteConsoleA", "windows.h"},
+	{"WriteConsoleInputA", "windows.h"},
+	{"WriteConsoleInputW", "windows.h"},
+	{"WriteConsoleOutputA", "windows.h"},
+	{"WriteConsoleOutputAttribute", "windows.h"},
+	{"WriteConsoleOutputCharacterA", "windows.h"},
+	{"WriteConsoleOutputCharacterW", "windows.h"},
+	{"WriteConsoleOutputW", "windows.h"},
+	{"WriteConsoleW", "windows.h"},
+	{"WriteFile", "windows.h"},
+	{"WriteFileEx", "windows.h"},
+	{"WriteFileGather", "windows.h"},
+	{"WriteFmtUserTypeStg", "windows.h"},
+	{"WritePrinter", "windows.h"},
+	{"WritePrivateProfileSectionA", "windows.h"},
+	{"WritePrivateProfileSectionW", "windows.h"},
+	{"WritePrivateProfileStringA", "windows.h"},
+	{"WritePrivateProfileStringW", "windows.h"},
+	{"WritePrivateProfileStructA", "windows.h"},
+	{"WritePrivateProfileStructW", "windows.h"},
+	{"WriteProcessMemory", "windows.h"},
+	{"WriteProfileSectionA", "windows.h"},
+	{"WriteProfileSectionW", "windows.h"},
+	{"WriteProfileStringA", "windows.h"},
+	{"WriteProfileStringW", "windows.h"},
+	{"WriteTapemark", "windows.h"},
+	{"_Exit", "stdlib.h"},
+	{"__WSAFDIsSet", "windows.h"},
+	{"__doserrno", "stdlib.h"},
+	{"__p___argc", "stdlib.h"},
+	{"__p___argv", "stdlib.h"},
+	{"__p___wargv", "stdlib.h"},
+	{"__p__environ", "stdlib.h"},
+	{"__p__osver", "stdlib.h"},
+	{"__p__pgmptr", "stdlib.h"},
+	{"__p__wenviron", "stdlib.h"},
+	{"__p__winmajor", "stdlib.h"},
+	{"__p__winminor", "stdlib.h"},
+	{"__p__winver", "stdlib.h"},
+	{"__p__wpgmptr", "stdlib.h"},
+	{"__strtod", "stdlib.h"},
+	{"_atoi64", "stdlib.h"},
+	{"_beep", "stdlib.h"},
+	{"_ecvt", "stdlib.h"},
+	{"_errno", "stdlib.h"},
+	{"_exit", "stdlib.h"},
+	{"_fcvt", "stdlib.h"},
+	{"_fullpath", "stdlib.h"},
+	{"_gcvt", "stdlib.h"},
+	{"_getstdfilex", "stdio.h"},
+	{"_hread", "windows.h"},
+	{"_hwrite", "windows.h"},
+	{"_i64toa", "stdlib.h"},
+	{"_i64tow", "stdlib.h"},
+	{"_isctype", "ctype.h"},
+	{"_itoa", "stdlib.h"},
+	{"_itow", "stdlib.h"},
+	{"_lclose", "windows.h"},
+	{"_lcreat", "windows.h"},
+	{"_llseek", "windows.h"},
+	{"_lopen", "windows.h"},
+	{"_lread", "windows.h"},
+	{"_lrotl", "stdlib.h"},
+	{"_lrotr", "stdlib.h"},
+	{"_ltoa", "stdlib.h"},
+	{"_ltow", "stdlib.h"},
+	{"_lwrite", "windows.h"},
+	{"_makepath", "stdlib.h"},
+	{"_memccpy", "string.h"},
+	{"_memicmp", "string.h"},
+	{"_onexit", "stdlib.h"},
+	{"_open", "windows.h"},
+	{"_putenv", "stdlib.h"},
+	{"_read", "windows.h"},
+	{"_rotl", "stdlib.h"},
+	{"_rotr", "stdlib.h"},
+	{"_searchenv", "stdlib.h"},
+	{"_set_error_mode", "stdlib.h"},
+	{"_seterrormode", "stdlib.h"},
+	{"_sleep", "stdlib.h"},
+	{"_splitpath", "stdlib.h"},
+	{"_strcmpi", "string.h"},
+	{"_strdup", "string.h"},
+	{"_strerror", "string.h"},
+	{"_stricmp", "string.h"},
+	{"_stricoll", "string.h"},
+	{"_strlwr", "string.h"},
+	{"_strncoll", "string.h"},
+	{"_strnicmp", "string.h"},
+	{"_strnicoll", "string.h"},
+	{"_strnset", "string.h"},
+	{"_strrev", "string.h"},
+	{"_strset", "string.h"},
+	{"_strupr", "string.h"},
+	{"_swab", "string.h"},
+	{"_ui64toa", "stdlib.h"},
+	{"_ui64tow", "stdlib.h"},
+	{"_ultoa", "stdlib.h"},
+	{"_ultow", "stdlib.h"},
+	{"_wcsdup", "string.h"},
+	{"_wcsicmp", "string.h"},
+	{"_wcsicoll", "string.h"},
+	{"_wcslwr", "string.h"},
+	{"_wcsncoll", "string.h"},
+	{"_wcsnicmp", "string.h"},
+	{"_wcsnicoll", "string.h"},
+	{"_wcsnset", "string.h"},
+	{"_wcsrev", "string.h"},
+	{"_wcsset", "string.h"},
+	{"_wcsupr", "string.h"},
+	{"_wfullpath", "stdlib.h"},
+	{"_wgetenv", "stdlib.h"},
+	{"_wmakepath", "stdlib.h"},
+	{"_wputenv", "stdlib.h"},
+	{"_write", "windows.h"},
+	{"_wsearchenv", "stdlib.h"},
+	{"_wsplitpath", "stdlib.h"},
+	{"_wsystem", "stdlib.h"},
+	{"_wtof", "stdlib.h"},
+	{"_wtoi", "stdlib.h"},
+	{"_wtoi64", "stdlib.h"},
+	{"_wtol", "stdlib.h"},
+	{"abort", "stdlib.h"},
+	{"abs", "stdlib.h"},
+	{"accept", "windows.h"},
+	{"atof", "stdlib.h"},
+	{"atoi", "stdlib.h"},
+	{"atol", "stdlib.h"},
+	{"atoll", "stdlib.h"},
+	{"auxGetDevCapsA", "windows.h"},
+	{"auxGetDevCapsW", "windows.h"},
+	{"auxGetNumDevs", "windows.h"},
+	{"auxGetVolume", "windows.h"},
+	{"auxOutMessage", "windows.h"},
+	{"auxSetVolume", "windows.h"},
+	{"bind", "windows.h"},
+	{"calloc", "stdlib.h"},
+	{"char_array_from_ndr", "windows.h"},
+	{"char_from_ndr", "windows.h"},
+	{"closesocket", "windows.h"},
+	{"connect", "windows.h"},
+	{"data_from_ndr", "windows.h"},
+	{"data_into_ndr", "windows.h"},
+	{"data_size_ndr", "windows.h"},
+	{"div", "stdlib.h"},
+	{"double_array_from_ndr", "windows.h"},
+	{"double_from_ndr", "windows.h"},
+	{"ecvt", "stdlib.h"},
+	{"enum_from_ndr", "windows.h"},
+	{"exit", "stdlib.h"},
+	{"fcvt", "stdlib.h"},
+	{"float_array_from_ndr", "windows.h"},
+	{"float_from_ndr", "windows.h"},
+	{"free", "stdlib.h"},
+	{"gcvt", "stdlib.h"},
+	{"getenv", "stdlib.h"},
+	{"gethostbyaddr", "windows.h"},
+	{"gethostbyname", "windows.h"},
+	{"gethostname", "windows.h"},
+	{"getpeername", "windows.h"},
+	{"getprotobyname", "windows.h"},
+	{"getprotobynumber", "windows.h"},
+	{"getservbyname", "windows.h"},
+	{"getservbyport", "windows.h"},
+	{"getsockname", "windows.h"},
+	{"getsockopt", "windows.h"},
+	{"htonl", "windows.h"},
+	{"htons", "windows.h"},
+	{"hyper_array_from_ndr", "windows.h"},
+	{"hyper_from_ndr", "windows.h"},
+	{"hyper_from_ndr_temp", "windows.h"},
+	{"inet_addr", "windows.h"},
+	{"inet_ntoa", "windows.h"},
+	{"int", "stdlib.h"},
+	{"ioctlsocket", "windows.h"},
+	{"itoa", "stdlib.h"},
+	{"joyGetDevCapsA", "windows.h"},
+	{"joyGetDevCapsW", "windows.h"},
+	{"joyGetNumDevs", "windows.h"},
+	{"joyGetPos", "windows.h"},
+	{"joyGetPosEx", "windows.h"},
+	{"joyGetThreshold", "windows.h"},
+	{"joyReleaseCapture", "windows.h"},
+	{"joySetCapture", "windows.h"},
+	{"joySetThreshold", "windows.h"},
+	{"keybd_event", "windows.h"},
+	{"labs", "stdlib.h"},
+	{"ldiv", "stdlib.h"},
+	{"listen", "windows.h"},
+	{"llabs", "stdlib.h"},
+	{"lldiv", "stdlib.h"},
+	{"lltoa", "stdlib.h"},
+	{"lltow", "stdlib.h"},
+	{"long_array_from_ndr", "windows.h"},
+	{"long_from_ndr", "windows.h"},
+	{"long_from_ndr_temp", "windows.h"},
+	{"lstrcatA", "windows.h"},
+	{"lstrcatW", "windows.h"},
+	{"lstrcmpA", "windows.h"},
+	{"lstrcmpW", "windows.h"},
+	{"lstrcmpiA", "windows.h"},
+	{"lstrcmpiW", "windows.h"},
+	{"lstrcpyA", "windows.h"},
+	{"lstrcpyW", "windows.h"},
+	{"lstrcpynA", "windows.h"},
+	{"lstrcpynW", "windows.h"},
+	{"lstrlenA", "windows.h"},
+	{"lstrlenW", "windows.h"},
+	{"ltoa", "stdlib.h"},
+	{"malloc", "stdlib.h"},
+	{"mblen", "stdlib.h"},
+	{"mbstowcs", "stdlib.h"},
+	{"mbtowc", "stdlib.h"},
+	{"mciGetCreatorTask", "windows.h"},
+	{"mciGetDeviceIDA", "windows.h"},
+	{"mciGetDeviceIDFromElementIDA", "windows.h"},
+	{"mciGetDeviceIDFromElementIDW", "windows.h"},
+	{"mciGetDeviceIDW", "windows.h"},
+	{"mciGetErrorStringA", "windows.h"},
+	{"mciGetErrorStringW", "windows.h"},
+	{"mciGetYieldProc", "windows.h"},
+	{"mciSendCommandA", "windows.h"},
+	{"mciSendCommandW", "windows.h"},
+	{"mciSendStringA", "windows.h"},
+	{"mciSendStringW", "windows.h"},
+	{"mciSetYieldProc", "windows.h"},
+	{"memccpy", "string.h"},
+	{"memchr", "string.h"},
+	{"memcmp", "string.h"},
+	{"memcpy", "string.h"},
+	{"memicmp", "string.h"},
+	{"memmove", "string.h"},
+	{"memset", "string.h"},
+	{"midiConnect", "windows.h"},
+	{"midiDisconnect", "windows.h"},
+	{"midiInAddBuffer", "windows.h"},
+	{"midiInClose", "windows.h"},
+	{"midiInGetDevCapsA", "windows.h"},
+	{"midiInGetDevCapsW", "windows.h"},
+	{"midiInGetErrorTextA", "windows.h"},
+	{"midiInGetErrorTextW", "windows.h"},
+	{"midiInGetID", "windows.h"},
+	{"midiInGetNumDevs", "windows.h"},
+	{"midiInMessage", "windows.h"},
+	{"midiInOpen", "windows.h"},
+	{"midiInPrepareHeader", "windows.h"},
+	{"midiInReset", "windows.h"},
+	{"midiInStart", "windows.h"},
+	{"midiInStop", "windows.h"},
+	{"midiInUnprepareHeader", "windows.h"},
+	{"midiOutCacheDrumPatches", "windows.h"},
+	{"midiOutCachePatches", "windows.h"},
+	{"midiOutClose", "windows.h"},
+	{"midiOutGetDevCapsA", "windows.h"},
+	{"midiOutGetDevCapsW", "windows.h"},
+	{"midiOutGetErrorTextA", "windows.h"},
+	{"midiOutGetErrorTextW", "windows.h"},
+	{"midiOutGetID", "windows.h"},
+	{"midiOutGetNumDevs", "windows.h"},
+	{"midiOutGetVolume", "windows.h"},
+	{"midiOutLongMsg", "windows.h"},
+	{"midiOutMessage", "windows.h"},
+	{"midiOutOpen", "windows.h"},
+	{"midiOutPrepareHeader", "windows.h"},
+	{"midiOutReset", "windows.h"},
+	{"midiOutSetVolume", "windows.h"},
+	{"midiOutShortMsg", "windows.h"},
+	{"midiOutUnprepareHeader", "windows.h"},
+	{"midiStreamClose", "windows.h"},
+	{"midiStreamOpen", "windows.h"},
+	{"midiStreamOut", "windows.h"},
+	{"midiStreamPause", "windows.h"},
+	{"midiStreamPosition", "windows.h"},
+	{"midiStreamProperty", "windows.h"},
+	{"midiStreamRestart", "windows.h"},
+	{"midiStreamStop", "windows.h"},
+	{"midl_allocate", "windows.h"},
+	{"mixerClose", "windows.h"},
+	{"mixerGetControlDetailsA", "windows.h"},
+	{"mixerGetControlDetailsW", "windows.h"},
+	{"mixerGetDevCapsA", "windows.h"},
+	{"mixerGetDevCapsW", "windows.h"},
+	{"mixerGetID", "windows.h"},
+	{"mixerGetLineControlsA", "windows.h"},
+	{"mixerGetLineControlsW", "windows.h"},
+	{"mixerGetLineInfoA", "windows.h"},
+	{"mixerGetLineInfoW", "windows.h"},
+	{"mixerGetNumDevs", "windows.h"},
+	{"mixerMessage", "windows.h"},
+	{"mixerOpen", "windows.h"},
+	{"mixerSetControlDetails", "windows.h"},
+	{"mmioAdvance", "windows.h"},
+	{"mmioAscend", "windows.h"},
+	{"mmioClose", "windows.h"},
+	{"mmioCreateChunk", "windows.h"},
+	{"mmioDescend", "windows.h"},
+	{"mmioFlush", "windows.h"},
+	{"mmioGetInfo", "windows.h"},
+	{"mmioInstallIOProcA", "windows.h"},
+	{"mmioInstallIOProcW", "windows.h"},
+	{"mmioOpenA", "windows.h"},
+	{"mmioOpenW", "windows.h"},
+	{"mmioRead", "windows.h"},
+	{"mmioRenameA", "windows.h"},
+	{"mmioRenameW", "windows.h"},
+	{"mmioSeek", "windows.h"},
+	{"mmioSendMessage", "windows.h"},
+	{"mmioSetBuffer", "windows.h"},
+	{"mmioSetInfo", "windows.h"},
+	{"mmioStringToFOURCCA", "windows.h"},
+	{"mmioStringToFOURCCW", "windows.h"},
+	{"mmioWrite", "windows.h"},
+	{"mmsystemGetVersion", "windows.h"},
+	{"mouse_event", "windows.h"},
+	{"ntohl", "windows.h"},
+	{"ntohs", "windows.h"},
+	{"putenv", "stdlib.h"},
+	{"rand", "stdlib.h"},
+	{"realloc", "stdlib.h"},
+	{"recv", "windows.h"},
+	{"recvfrom", "windows.h"},
+	{"searchenv", "stdlib.h"},
+	{"select", "windows.h"},
+	{"send", "windows.h"},
+	{"sendto", "windows.h"},
+	{"setsockopt", "windows.h"},
+	{"short_array_from_ndr", "windows.h"},
+	{"short_from_ndr", "windows.h"},
+	{"short_from_ndr_temp", "windows.h"},
+	{"shutdown", "windows.h"},
+	{"sndPlaySoundA", "windows.h"},
+	{"sndPlaySoundW", "windows.h"},
+	{"socket", "windows.h"},
+	{"srand", "stdlib.h"},
+	{"strcasecmp", "string.h"},
+	{"strcat", "string.h"},
+	{"strchr", "string.h"},
+	{"strcmp", "string.h"},
+	{"strcmpi", "string.h"},
+	{"strcoll", "string.h"},
+	{"strcpy", "string.h"},
+	{"strcspn", "string.h"},
+	{"strdup", "string.h"},
+	{"strerror", "string.h"},
+	{"stricmp", "string.h"},
+	{"stricoll", "string.h"},
+	{"strlen", "string.h"},
+	{"strlwr", "string.h"},
+	{"strncasecmp", "string.h"},
+	{"strncat", "string.h"},
+	{"strncmp", "string.h"},
+	{"strncpy", "string.h"},
+	{"strnicmp", "string.h"},
+	{"strnset", "string.h"},
+	{"strpbrk", "string.h"},
+	{"strrchr", "string.h"},
+	{"strrev", "string.h"},
+	{"strset", "string.h"},
+	{"strspn", "string.h"},
+	{"strstr", "string.h"},
+	{"strtod", "stdlib.h"},
+	{"strtof", "stdlib.h"},
+	{"strtok", "string.h"},
+	{"strtol", "stdlib.h"},
+	{"strtold", "stdlib.h"},
+	{"strtoll", "stdlib.h"},
+	{"strtoul", "stdlib.h"},
+	{"strtoull", "stdlib.h"},
+	{"strupr", "string.h"},
+	{"strxfrm", "string.h"},
+	{"swab", "string.h"},
+	{"system", "stdlib.h"},
+	{"timeBeginPeriod", "windows.h"},
+	{"timeEndPeriod", "windows.h"},
+	{"timeGetDevCaps", "windows.h"},
+	{"timeGetSystemTime", "windows.h"},
+	{"timeGetTime", "windows.h"},
+	{"timeKillEvent", "windows.h"},
+	{"timeSetEvent", "windows.h"},
+	{"tree_into_ndr", "windows.h"},
+	{"tree_peek_ndr", "windows.h"},
+	{"tree_size_ndr", "windows.h"},
+	{"ulltoa", "stdlib.h"},
+	{"ulltow", "stdlib.h"},
+	{"void", "stdlib.h"},
+	{"wWinMain", "windows.h"},
+	{"waveInAddBuffer", "windows.h"},
+	{"waveInClose", "windows.h"},
+	{"waveInGetDevCapsA", "windows.h"},
+	{"waveInGetDevCapsW", "windows.h"},
+	{"waveInGetErrorTextA", "windows.h"},
+	{"waveInGetErrorTextW", "windows.h"},
+	{"waveInGetID", "windows.h"},
+	{"waveInGetNumDevs", "windows.h"},
+	{"waveInGetPosition", "windows.h"},
+	{"waveInMessage", "windows.h"},
+	{"waveInOpen", "windows.h"},
+	{"waveInPrepareHeader", "windows.h"},
+	{"waveInReset", "windows.h"},
+	{"waveInStart", "windows.h"},
+	{"waveInStop", "windows.h"},
+	{"waveInUnprepareHeader", "windows.h"},
+	{"waveOutBreakLoop", "windows.h"},
+	{"waveOutClose", "windows.h"},
+	{"waveOutGetDevCapsA", "windows.h"},
+	{"waveOutGetDevCapsW", "windows.h"},
+	{"waveOutGetErrorTextA", "windows.h"},
+	{"waveOutGetErrorTextW", "windows.h"},
+	{"waveOutGetID", "windows.h"},
+	{"waveOutGetNumDevs", "windows.h"},
+	{"waveOutGetPitch", "windows.h"},
+	{"waveOutGetPlaybackRate", "windows.h"},
+	{"waveOutGetPosition", "windows.h"},
+	{"waveOutGetVolume", "windows.h"},
+	{"waveOutMessage", "windows.h"},
+	{"waveOutOpen", "windows.h"},
+	{"waveOutPause", "windows.h"},
+	{"waveOutPrepareHeader", "windows.h"},
+	{"waveOutReset", "windows.h"},
+	{"waveOutRestart", "windows.h"},
+	{"waveOutSetPitch", "windows.h"},
+	{"waveOutSetPlaybackRate", "windows.h"},
+	{"waveOutSetVolume", "windows.h"},
+	{"waveOutUnprepareHeader", "windows.h"},
+	{"waveOutWrite", "windows.h"},
+	{"wcscat", "string.h"},
+	{"wcschr", "string.h"},
+	{"wcscmp", "string.h"},
+	{"wcscmpi", "string.h"},
+	{"wcscoll", "string.h"},
+	{"wcscpy", "string.h"},
+	{"wcscspn", "string.h"},
+	{"wcsdup", "string.h"},
+	{"wcsicmp", "string.h"},
+	{"wcsicoll", "string.h"},
+	{"wcslen", "string.h"},
+	{"wcslwr", "string.h"},
+	{"wcsncat", "string.h"},
+	{"wcsncmp", "string.h"},
+	{"wcsncpy", "string.h"},
+	{"wcsnicmp", "string.h"},
+	{"wcsnset", "string.h"},
+	{"wcspbrk", "string.h"},
+	{"wcsrchr", "string.h"},
+	{"wcsrev", "string.h"},
+	{"wcsset", "string.h"},
+	{"wcsspn", "string.h"},
+	{"wcsstr", "string.h"},
+	{"wcstod", "stdlib.h"},
+	{"wcstof", "stdlib.h"},
+	{"wcstok", "string.h"},
+	{"wcstol", "stdlib.h"},
+	{"wcstold", "stdlib.h"},
+	{"wcstombs", "stdlib.h"},
+	{"wcstoul", "stdlib.h"},
+	{"wcsupr", "string.h"},
+	{"wcsxfrm", "string.h"},
+	{"wctomb", "stdlib.h"},
+	{"wglCopyContext", "windows.h"},
+	{"wglCreateContext", "windows.h"},
+	{"wglCreateLayerContext", "windows.h"},
+	{"wglDeleteContext", "windows.h"},
+	{"wglDescribeLayerPlane", "windows.h"},
+	{"wglGetCurrentContext", "windows.h"},
+	{"wglGetCurrentDC", "windows.h"},
+	{"wglGetLayerPaletteEntries", "windows.h"},
+	{"wglGetProcAddress", "windows.h"},
+	{"wglMakeCurrent", "windows.h"},
+	{"wglRealizeLayerPalette", "windows.h"},
+	{"wglSetLayerPaletteEntries", "windows.h"},
+	{"wglShareLists", "windows.h"},
+	{"wglSwapLayerBuffers", "windows.h"},
+	{"wglUseFontBitmapsA", "windows.h"},
+	{"wglUseFontBitmapsW", "windows.h"},
+	{"wglUseFontOutlinesA", "windows.h"},
+	{"wglUseFontOutlinesW", "windows.h"},
+	{"wsprintfA", "windows.h"},
+	{"wsprintfW", "windows.h"},
+	{"wtoll", "stdlib.h"},
+	{"wvsprintfA", "windows.h"},
+	{"wvsprintfW", "windows.h"},
+};
 
-/// Mapping of function names to their corresponding header files.
-const StringStringUMap &FUNC_C_HEADER_MAP(initFuncCHeaderMap());
+static_assert(isSortedFuncCHeaderTable(FUNC_C_HEADERS),
+	"FUNC_C_HEADERS has to be sorted by function names");
 
 } // anonymous namespace
 
@@ -3873,7 +3842,7 @@ const StringStringUMap &FUNC_C_HEADER_MAP(initFuncCHeaderMap());
 * See its description for more details.
 */
 std::optional<std::string> getCHeaderFileForFunc(const std::string &funcName) {
-	return getCHeaderFileForFuncFromMap(funcName, FUNC_C_HEADER_MAP);
+	return getCHeaderFileForFuncFromTable(funcName, FUNC_C_HEADERS);
 }
 
 } // namespace win_api
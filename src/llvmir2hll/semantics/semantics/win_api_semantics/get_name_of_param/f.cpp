@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/f.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Table of parameter names of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -11,292 +11,305 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with F.
-*/
-void initFuncParamNamesMap_F(FuncParamNamesMap &funcParamNamesMap) {
+namespace {
+
+/// Names of parameters of the functions, sorted by function names and
+/// parameter positions.
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("FatalAppExitA", 1, "uAction"); // UINT
-	ADD_PARAM_NAME("FatalAppExitA", 2, "lpMessageText"); // LPCSTR
-	ADD_PARAM_NAME("FatalAppExitW", 1, "uAction"); // UINT
-	ADD_PARAM_NAME("FatalAppExitW", 2, "lpMessageText"); // LPCWSTR
-	ADD_PARAM_NAME("FatalExit", 1, "ExitCode"); // int
-	ADD_PARAM_NAME("FileEncryptionStatusA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("FileEncryptionStatusA", 2, "lpStatus"); // LPDWORD
-	ADD_PARAM_NAME("FileEncryptionStatusW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("FileEncryptionStatusW", 2, "lpStatus"); // LPDWORD
-	ADD_PARAM_NAME("FileTimeToDosDateTime", 1, "lpFileTime"); // CONST FILETIME *
-	ADD_PARAM_NAME("FileTimeToDosDateTime", 2, "lpFatDate"); // LPWORD
-	ADD_PARAM_NAME("FileTimeToDosDateTime", 3, "lpFatTime"); // LPWORD
-	ADD_PARAM_NAME("FileTimeToLocalFileTime", 1, "lpFileTime"); // CONST FILETIME *
-	ADD_PARAM_NAME("FileTimeToLocalFileTime", 2, "lpLocalFileTime"); // LPFILETIME
-	ADD_PARAM_NAME("FileTimeToSystemTime", 1, "lpFileTime"); // CONST FILETIME *
-	ADD_PARAM_NAME("FileTimeToSystemTime", 2, "lpSystemTime"); // LPSYSTEMTIME
-	ADD_PARAM_NAME("FillConsoleOutputAttribute", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("FillConsoleOutputAttribute", 2, "wAttribute"); // WORD
-	ADD_PARAM_NAME("FillConsoleOutputAttribute", 3, "nLength"); // DWORD
-	ADD_PARAM_NAME("FillConsoleOutputAttribute", 4, "dwWriteCoord"); // COORD
-	ADD_PARAM_NAME("FillConsoleOutputAttribute", 5, "lpNumberOfAttrsWritten"); // LPDWORD
-	ADD_PARAM_NAME("FillConsoleOutputCharacterA", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("FillConsoleOutputCharacterA", 2, "cCharacter"); // CHAR
-	ADD_PARAM_NAME("FillConsoleOutputCharacterA", 3, "nLength"); // DWORD
-	ADD_PARAM_NAME("FillConsoleOutputCharacterA", 4, "dwWriteCoord"); // COORD
-	ADD_PARAM_NAME("FillConsoleOutputCharacterA", 5, "lpNumberOfCharsWritten"); // LPDWORD
-	ADD_PARAM_NAME("FillConsoleOutputCharacterW", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("FillConsoleOutputCharacterW", 2, "cCharacter"); // WCHAR
-	ADD_PARAM_NAME("FillConsoleOutputCharacterW", 3, "nLength"); // DWORD
-	ADD_PARAM_NAME("FillConsoleOutputCharacterW", 4, "dwWriteCoord"); // COORD
-	ADD_PARAM_NAME("FillConsoleOutputCharacterW", 5, "lpNumberOfCharsWritten"); // LPDWORD
-	ADD_PARAM_NAME("FillPath", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("FillRect", 1, "hDC"); // HDC
-	ADD_PARAM_NAME("FillRect", 2, "lprc"); // CONST RECT *
-	ADD_PARAM_NAME("FillRect", 3, "hbr"); // HBRUSH
-	ADD_PARAM_NAME("FillRgn", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("FillRgn", 2, "hrgn"); // HRGN
-	ADD_PARAM_NAME("FillRgn", 3, "hbr"); // HBRUSH
-	ADD_PARAM_NAME("FindActCtxSectionGuid", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("FindActCtxSectionGuid", 2, "lpExtensionGuid"); // const GUID *
-	ADD_PARAM_NAME("FindActCtxSectionGuid", 3, "ulSectionId"); // ULONG
-	ADD_PARAM_NAME("FindActCtxSectionGuid", 4, "lpGuidToFind"); // const GUID *
-	ADD_PARAM_NAME("FindActCtxSectionGuid", 5, "ReturnedData"); // PACTCTX_SECTION_KEYED_DATA
-	ADD_PARAM_NAME("FindActCtxSectionStringA", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("FindActCtxSectionStringA", 2, "lpExtensionGuid"); // const GUID *
-	ADD_PARAM_NAME("FindActCtxSectionStringA", 3, "ulSectionId"); // ULONG
-	ADD_PARAM_NAME("FindActCtxSectionStringA", 4, "lpStringToFind"); // LPCSTR
-	ADD_PARAM_NAME("FindActCtxSectionStringA", 5, "ReturnedData"); // PACTCTX_SECTION_KEYED_DATA
-	ADD_PARAM_NAME("FindActCtxSectionStringW", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("FindActCtxSectionStringW", 2, "lpExtensionGuid"); // const GUID *
-	ADD_PARAM_NAME("FindActCtxSectionStringW", 3, "ulSectionId"); // ULONG
-	ADD_PARAM_NAME("FindActCtxSectionStringW", 4, "lpStringToFind"); // LPCWSTR
-	ADD_PARAM_NAME("FindActCtxSectionStringW", 5, "ReturnedData"); // PACTCTX_SECTION_KEYED_DATA
-	ADD_PARAM_NAME("FindAtomA", 1, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("FindAtomW", 1, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("FindCertsByIssuer", 1, "pCertChains"); // PCERT_CHAIN
-	ADD_PARAM_NAME("FindCertsByIssuer", 2, "pcbCertChains"); // DWORD *
-	ADD_PARAM_NAME("FindCertsByIssuer", 3, "pcCertChains"); // DWORD *
-	ADD_PARAM_NAME("FindCertsByIssuer", 4, "pbEncodedIssuerName"); // BYTE *
-	ADD_PARAM_NAME("FindCertsByIssuer", 5, "cbEncodedIssuerName"); // DWORD
-	ADD_PARAM_NAME("FindCertsByIssuer", 6, "pwszPurpose"); // LPCWSTR
-	ADD_PARAM_NAME("FindCertsByIssuer", 7, "dwKeySpec"); // DWORD
-	ADD_PARAM_NAME("FindClose", 1, "hFindFile"); // HANDLE
-	ADD_PARAM_NAME("FindCloseChangeNotification", 1, "hChangeHandle"); // HANDLE
-	ADD_PARAM_NAME("FindClosePrinterChangeNotification", 1, "hChange"); // HANDLE
-	ADD_PARAM_NAME("FindFirstChangeNotificationA", 1, "lpPathName"); // LPCSTR
-	ADD_PARAM_NAME("FindFirstChangeNotificationA", 2, "bWatchSubtree"); // WINBOOL
-	ADD_PARAM_NAME("FindFirstChangeNotificationA", 3, "dwNotifyFilter"); // DWORD
-	ADD_PARAM_NAME("FindFirstChangeNotificationW", 1, "lpPathName"); // LPCWSTR
-	ADD_PARAM_NAME("FindFirstChangeNotificationW", 2, "bWatchSubtree"); // WINBOOL
-	ADD_PARAM_NAME("FindFirstChangeNotificationW", 3, "dwNotifyFilter"); // DWORD
-	ADD_PARAM_NAME("FindFirstFileA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("FindFirstFileA", 2, "lpFindFileData"); // LPWIN32_FIND_DATAA
-	ADD_PARAM_NAME("FindFirstFileExA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("FindFirstFileExA", 2, "fInfoLevelId"); // FINDEX_INFO_LEVELS
-	ADD_PARAM_NAME("FindFirstFileExA", 3, "lpFindFileData"); // LPVOID
-	ADD_PARAM_NAME("FindFirstFileExA", 4, "fSearchOp"); // FINDEX_SEARCH_OPS
-	ADD_PARAM_NAME("FindFirstFileExA", 5, "lpSearchFilter"); // LPVOID
-	ADD_PARAM_NAME("FindFirstFileExA", 6, "dwAdditionalFlags"); // DWORD
-	ADD_PARAM_NAME("FindFirstFileExW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("FindFirstFileExW", 2, "fInfoLevelId"); // FINDEX_INFO_LEVELS
-	ADD_PARAM_NAME("FindFirstFileExW", 3, "lpFindFileData"); // LPVOID
-	ADD_PARAM_NAME("FindFirstFileExW", 4, "fSearchOp"); // FINDEX_SEARCH_OPS
-	ADD_PARAM_NAME("FindFirstFileExW", 5, "lpSearchFilter"); // LPVOID
-	ADD_PARAM_NAME("FindFirstFileExW", 6, "dwAdditionalFlags"); // DWORD
-	ADD_PARAM_NAME("FindFirstFileNameTransactedW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("FindFirstFileNameTransactedW", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("FindFirstFileNameTransactedW", 3, "StringLength"); // LPDWORD
-	ADD_PARAM_NAME("FindFirstFileNameTransactedW", 4, "LinkName"); // PWCHAR
-	ADD_PARAM_NAME("FindFirstFileNameTransactedW", 5, "hTransaction"); // HANDLE
-	ADD_PARAM_NAME("FindFirstFileNameW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("FindFirstFileNameW", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("FindFirstFileNameW", 3, "StringLength"); // LPDWORD
-	ADD_PARAM_NAME("FindFirstFileNameW", 4, "LinkName"); // PWCHAR
-	ADD_PARAM_NAME("FindFirstFileTransactedA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("FindFirstFileTransactedA", 2, "fInfoLevelId"); // FINDEX_INFO_LEVELS
-	ADD_PARAM_NAME("FindFirstFileTransactedA", 3, "lpFindFileData"); // LPVOID
-	ADD_PARAM_NAME("FindFirstFileTransactedA", 4, "fSearchOp"); // FINDEX_SEARCH_OPS
-	ADD_PARAM_NAME("FindFirstFileTransactedA", 5, "lpSearchFilter"); // LPVOID
-	ADD_PARAM_NAME("FindFirstFileTransactedA", 6, "dwAdditionalFlags"); // DWORD
-	ADD_PARAM_NAME("FindFirstFileTransactedA", 7, "hTransaction"); // HANDLE
-	ADD_PARAM_NAME("FindFirstFileTransactedW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("FindFirstFileTransactedW", 2, "fInfoLevelId"); // FINDEX_INFO_LEVELS
-	ADD_PARAM_NAME("FindFirstFileTransactedW", 3, "lpFindFileData"); // LPVOID
-	ADD_PARAM_NAME("FindFirstFileTransactedW", 4, "fSearchOp"); // FINDEX_SEARCH_OPS
-	ADD_PARAM_NAME("FindFirstFileTransactedW", 5, "lpSearchFilter"); // LPVOID
-	ADD_PARAM_NAME("FindFirstFileTransactedW", 6, "dwAdditionalFlags"); // DWORD
-	ADD_PARAM_NAME("FindFirstFileTransactedW", 7, "hTransaction"); // HANDLE
-	ADD_PARAM_NAME("FindFirstFileW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("FindFirstFileW", 2, "lpFindFileData"); // LPWIN32_FIND_DATAW
-	ADD_PARAM_NAME("FindFirstFreeAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("FindFirstFreeAce", 2, "pAce"); // LPVOID *
-	ADD_PARAM_NAME("FindFirstPrinterChangeNotification", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("FindFirstPrinterChangeNotification", 2, "fdwFlags"); // DWORD
-	ADD_PARAM_NAME("FindFirstPrinterChangeNotification", 3, "fdwOptions"); // DWORD
-	ADD_PARAM_NAME("FindFirstPrinterChangeNotification", 4, "pPrinterNotifyOptions"); // LPVOID
-	ADD_PARAM_NAME("FindFirstStreamTransactedW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("FindFirstStreamTransactedW", 2, "InfoLevel"); // STREAM_INFO_LEVELS
-	ADD_PARAM_NAME("FindFirstStreamTransactedW", 3, "lpFindStreamData"); // LPVOID
-	ADD_PARAM_NAME("FindFirstStreamTransactedW", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("FindFirstStreamTransactedW", 5, "hTransaction"); // HANDLE
-	ADD_PARAM_NAME("FindFirstStreamW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("FindFirstStreamW", 2, "InfoLevel"); // STREAM_INFO_LEVELS
-	ADD_PARAM_NAME("FindFirstStreamW", 3, "lpFindStreamData"); // LPVOID
-	ADD_PARAM_NAME("FindFirstStreamW", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("FindFirstVolumeA", 1, "lpszVolumeName"); // LPSTR
-	ADD_PARAM_NAME("FindFirstVolumeA", 2, "cchBufferLength"); // DWORD
-	ADD_PARAM_NAME("FindFirstVolumeMountPointA", 1, "lpszRootPathName"); // LPCSTR
-	ADD_PARAM_NAME("FindFirstVolumeMountPointA", 2, "lpszVolumeMountPoint"); // LPSTR
-	ADD_PARAM_NAME("FindFirstVolumeMountPointA", 3, "cchBufferLength"); // DWORD
-	ADD_PARAM_NAME("FindFirstVolumeMountPointW", 1, "lpszRootPathName"); // LPCWSTR
-	ADD_PARAM_NAME("FindFirstVolumeMountPointW", 2, "lpszVolumeMountPoint"); // LPWSTR
-	ADD_PARAM_NAME("FindFirstVolumeMountPointW", 3, "cchBufferLength"); // DWORD
-	ADD_PARAM_NAME("FindFirstVolumeW", 1, "lpszVolumeName"); // LPWSTR
-	ADD_PARAM_NAME("FindFirstVolumeW", 2, "cchBufferLength"); // DWORD
-	ADD_PARAM_NAME("FindNLSString", 1, "Locale"); // LCID
-	ADD_PARAM_NAME("FindNLSString", 2, "dwFindNLSStringFlags"); // DWORD
-	ADD_PARAM_NAME("FindNLSString", 3, "lpStringSource"); // LPCWSTR
-	ADD_PARAM_NAME("FindNLSString", 4, "cchSource"); // int
-	ADD_PARAM_NAME("FindNLSString", 5, "lpStringValue"); // LPCWSTR
-	ADD_PARAM_NAME("FindNLSString", 6, "cchValue"); // int
-	ADD_PARAM_NAME("FindNLSString", 7, "pcchFound"); // LPINT
-	ADD_PARAM_NAME("FindNLSStringEx", 1, "lpLocaleName"); // LPCWSTR
-	ADD_PARAM_NAME("FindNLSStringEx", 2, "dwFindNLSStringFlags"); // DWORD
-	ADD_PARAM_NAME("FindNLSStringEx", 3, "lpStringSource"); // LPCWSTR
-	ADD_PARAM_NAME("FindNLSStringEx", 4, "cchSource"); // int
-	ADD_PARAM_NAME("FindNLSStringEx", 5, "lpStringValue"); // LPCWSTR
-	ADD_PARAM_NAME("FindNLSStringEx", 6, "cchValue"); // int
-	ADD_PARAM_NAME("FindNLSStringEx", 7, "pcchFound"); // LPINT
-	ADD_PARAM_NAME("FindNLSStringEx", 8, "lpVersionInformation"); // LPNLSVERSIONINFO
-	ADD_PARAM_NAME("FindNLSStringEx", 9, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("FindNLSStringEx", 10, "lParam"); // LPARAM
-	ADD_PARAM_NAME("FindNextChangeNotification", 1, "hChangeHandle"); // HANDLE
-	ADD_PARAM_NAME("FindNextFileA", 1, "hFindFile"); // HANDLE
-	ADD_PARAM_NAME("FindNextFileA", 2, "lpFindFileData"); // LPWIN32_FIND_DATAA
-	ADD_PARAM_NAME("FindNextFileNameW", 1, "hFindStream"); // HANDLE
-	ADD_PARAM_NAME("FindNextFileNameW", 2, "StringLength"); // LPDWORD
-	ADD_PARAM_NAME("FindNextFileNameW", 3, "LinkName"); // PWCHAR
-	ADD_PARAM_NAME("FindNextFileW", 1, "hFindFile"); // HANDLE
-	ADD_PARAM_NAME("FindNextFileW", 2, "lpFindFileData"); // LPWIN32_FIND_DATAW
-	ADD_PARAM_NAME("FindNextPrinterChangeNotification", 1, "hChange"); // HANDLE
-	ADD_PARAM_NAME("FindNextPrinterChangeNotification", 2, "pdwChange"); // PDWORD
-	ADD_PARAM_NAME("FindNextPrinterChangeNotification", 3, "pPrinterNotifyOptions"); // LPVOID
-	ADD_PARAM_NAME("FindNextPrinterChangeNotification", 4, "ppPrinterNotifyInfo"); // LPVOID *
-	ADD_PARAM_NAME("FindNextStreamW", 1, "hFindStream"); // HANDLE
-	ADD_PARAM_NAME("FindNextStreamW", 2, "lpFindStreamData"); // LPVOID
-	ADD_PARAM_NAME("FindNextVolumeA", 1, "hFindVolume"); // HANDLE
-	ADD_PARAM_NAME("FindNextVolumeA", 2, "lpszVolumeName"); // LPSTR
-	ADD_PARAM_NAME("FindNextVolumeA", 3, "cchBufferLength"); // DWORD
-	ADD_PARAM_NAME("FindNextVolumeMountPointA", 1, "hFindVolumeMountPoint"); // HANDLE
-	ADD_PARAM_NAME("FindNextVolumeMountPointA", 2, "lpszVolumeMountPoint"); // LPSTR
-	ADD_PARAM_NAME("FindNextVolumeMountPointA", 3, "cchBufferLength"); // DWORD
-	ADD_PARAM_NAME("FindNextVolumeMountPointW", 1, "hFindVolumeMountPoint"); // HANDLE
-	ADD_PARAM_NAME("FindNextVolumeMountPointW", 2, "lpszVolumeMountPoint"); // LPWSTR
-	ADD_PARAM_NAME("FindNextVolumeMountPointW", 3, "cchBufferLength"); // DWORD
-	ADD_PARAM_NAME("FindNextVolumeW", 1, "hFindVolume"); // HANDLE
-	ADD_PARAM_NAME("FindNextVolumeW", 2, "lpszVolumeName"); // LPWSTR
-	ADD_PARAM_NAME("FindNextVolumeW", 3, "cchBufferLength"); // DWORD
-	ADD_PARAM_NAME("FindResourceA", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("FindResourceA", 2, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("FindResourceA", 3, "lpType"); // LPCSTR
-	ADD_PARAM_NAME("FindResourceExA", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("FindResourceExA", 2, "lpType"); // LPCSTR
-	ADD_PARAM_NAME("FindResourceExA", 3, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("FindResourceExA", 4, "wLanguage"); // WORD
-	ADD_PARAM_NAME("FindResourceExW", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("FindResourceExW", 2, "lpType"); // LPCWSTR
-	ADD_PARAM_NAME("FindResourceExW", 3, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("FindResourceExW", 4, "wLanguage"); // WORD
-	ADD_PARAM_NAME("FindResourceW", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("FindResourceW", 2, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("FindResourceW", 3, "lpType"); // LPCWSTR
-	ADD_PARAM_NAME("FindVolumeClose", 1, "hFindVolume"); // HANDLE
-	ADD_PARAM_NAME("FindVolumeMountPointClose", 1, "hFindVolumeMountPoint"); // HANDLE
-	ADD_PARAM_NAME("FindWindowA", 1, "lpClassName"); // LPCSTR
-	ADD_PARAM_NAME("FindWindowA", 2, "lpWindowName"); // LPCSTR
-	ADD_PARAM_NAME("FindWindowExA", 1, "hWndParent"); // HWND
-	ADD_PARAM_NAME("FindWindowExA", 2, "hWndChildAfter"); // HWND
-	ADD_PARAM_NAME("FindWindowExA", 3, "lpszClass"); // LPCSTR
-	ADD_PARAM_NAME("FindWindowExA", 4, "lpszWindow"); // LPCSTR
-	ADD_PARAM_NAME("FindWindowExW", 1, "hWndParent"); // HWND
-	ADD_PARAM_NAME("FindWindowExW", 2, "hWndChildAfter"); // HWND
-	ADD_PARAM_NAME("FindWindowExW", 3, "lpszClass"); // LPCWSTR
-	ADD_PARAM_NAME("FindWindowExW", 4, "lpszWindow"); // LPCWSTR
-	ADD_PARAM_NAME("FindWindowW", 1, "lpClassName"); // LPCWSTR
-	ADD_PARAM_NAME("FindWindowW", 2, "lpWindowName"); // LPCWSTR
-	ADD_PARAM_NAME("FixBrushOrgEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("FixBrushOrgEx", 2, "x"); // int
-	ADD_PARAM_NAME("FixBrushOrgEx", 3, "y"); // int
-	ADD_PARAM_NAME("FixBrushOrgEx", 4, "ptl"); // LPPOINT
-	ADD_PARAM_NAME("FlashWindow", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("FlashWindow", 2, "bInvert"); // WINBOOL
-	ADD_PARAM_NAME("FlashWindowEx", 1, "pfwi"); // PFLASHWINFO
-	ADD_PARAM_NAME("FlattenPath", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("FloodFill", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("FloodFill", 2, "x"); // int
-	ADD_PARAM_NAME("FloodFill", 3, "y"); // int
-	ADD_PARAM_NAME("FloodFill", 4, "color"); // COLORREF
-	ADD_PARAM_NAME("FlsAlloc", 1, "lpCallback"); // PFLS_CALLBACK_FUNCTION
-	ADD_PARAM_NAME("FlsFree", 1, "dwFlsIndex"); // DWORD
-	ADD_PARAM_NAME("FlsGetValue", 1, "dwFlsIndex"); // DWORD
-	ADD_PARAM_NAME("FlsSetValue", 1, "dwFlsIndex"); // DWORD
-	ADD_PARAM_NAME("FlsSetValue", 2, "lpFlsData"); // PVOID
-	ADD_PARAM_NAME("FlushConsoleInputBuffer", 1, "hConsoleInput"); // HANDLE
-	ADD_PARAM_NAME("FlushFileBuffers", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("FlushInstructionCache", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("FlushInstructionCache", 2, "lpBaseAddress"); // LPCVOID
-	ADD_PARAM_NAME("FlushInstructionCache", 3, "dwSize"); // SIZE_T
-	ADD_PARAM_NAME("FlushPrinter", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("FlushPrinter", 2, "pBuf"); // LPVOID
-	ADD_PARAM_NAME("FlushPrinter", 3, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("FlushPrinter", 4, "pcWritten"); // LPDWORD
-	ADD_PARAM_NAME("FlushPrinter", 5, "cSleep"); // DWORD
-	ADD_PARAM_NAME("FlushViewOfFile", 1, "lpBaseAddress"); // LPCVOID
-	ADD_PARAM_NAME("FlushViewOfFile", 2, "dwNumberOfBytesToFlush"); // SIZE_T
-	ADD_PARAM_NAME("FoldStringA", 1, "dwMapFlags"); // DWORD
-	ADD_PARAM_NAME("FoldStringA", 2, "lpSrcStr"); // LPCSTR
-	ADD_PARAM_NAME("FoldStringA", 3, "cchSrc"); // int
-	ADD_PARAM_NAME("FoldStringA", 4, "lpDestStr"); // LPSTR
-	ADD_PARAM_NAME("FoldStringA", 5, "cchDest"); // int
-	ADD_PARAM_NAME("FoldStringW", 1, "dwMapFlags"); // DWORD
-	ADD_PARAM_NAME("FoldStringW", 2, "lpSrcStr"); // LPCWSTR
-	ADD_PARAM_NAME("FoldStringW", 3, "cchSrc"); // int
-	ADD_PARAM_NAME("FoldStringW", 4, "lpDestStr"); // LPWSTR
-	ADD_PARAM_NAME("FoldStringW", 5, "cchDest"); // int
-	ADD_PARAM_NAME("FormatMessageA", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("FormatMessageA", 2, "lpSource"); // LPCVOID
-	ADD_PARAM_NAME("FormatMessageA", 3, "dwMessageId"); // DWORD
-	ADD_PARAM_NAME("FormatMessageA", 4, "dwLanguageId"); // DWORD
-	ADD_PARAM_NAME("FormatMessageA", 5, "lpBuffer"); // LPSTR
-	ADD_PARAM_NAME("FormatMessageA", 6, "nSize"); // DWORD
-	ADD_PARAM_NAME("FormatMessageW", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("FormatMessageW", 2, "lpSource"); // LPCVOID
-	ADD_PARAM_NAME("FormatMessageW", 3, "dwMessageId"); // DWORD
-	ADD_PARAM_NAME("FormatMessageW", 4, "dwLanguageId"); // DWORD
-	ADD_PARAM_NAME("FormatMessageW", 5, "lpBuffer"); // LPWSTR
-	ADD_PARAM_NAME("FormatMessageW", 6, "nSize"); // DWORD
-	ADD_PARAM_NAME("FrameRect", 1, "hDC"); // HDC
-	ADD_PARAM_NAME("FrameRect", 2, "lprc"); // CONST RECT *
-	ADD_PARAM_NAME("FrameRect", 3, "hbr"); // HBRUSH
-	ADD_PARAM_NAME("FrameRgn", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("FrameRgn", 2, "hrgn"); // HRGN
-	ADD_PARAM_NAME("FrameRgn", 3, "hbr"); // HBRUSH
-	ADD_PARAM_NAME("FrameRgn", 4, "w"); // int
-	ADD_PARAM_NAME("FrameRgn", 5, "h"); // int
-	ADD_PARAM_NAME("FreeEncryptionCertificateHashList", 1, "pHashes"); // PENCRYPTION_CERTIFICATE_HASH_LIST
-	ADD_PARAM_NAME("FreeEnvironmentStringsA", 1, "lpszEnvironmentBlock"); // LPCH
-	ADD_PARAM_NAME("FreeEnvironmentStringsW", 1, "lpszEnvironmentBlock"); // LPWCH
-	ADD_PARAM_NAME("FreeLibrary", 1, "hLibModule"); // HMODULE
-	ADD_PARAM_NAME("FreeLibraryAndExitThread", 1, "hLibModule"); // HMODULE
-	ADD_PARAM_NAME("FreeLibraryAndExitThread", 2, "dwExitCode"); // DWORD
-	ADD_PARAM_NAME("FreeLibraryWhenCallbackReturns", 1, "pci"); // PTP_CALLBACK_INSTANCE
-	ADD_PARAM_NAME("FreeLibraryWhenCallbackReturns", 2, "mod"); // HMODULE
-	ADD_PARAM_NAME("FreePrinterNotifyInfo", 1, "pPrinterNotifyInfo"); // PPRINTER_NOTIFY_INFO
-	ADD_PARAM_NAME("FreeResource", 1, "hResData"); // HGLOBAL
-	ADD_PARAM_NAME("FreeSid", 1, "pSid"); // PSID
-	ADD_PARAM_NAME("FreeUserPhysicalPages", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("FreeUserPhysicalPages", 2, "NumberOfPages"); // PULONG_PTR
-	ADD_PARAM_NAME("FreeUserPhysicalPages", 3, "PageArray"); // PULONG_PTR
+	{"FatalAppExitA", 1, "uAction"}, // UINT
+	{"FatalAppExitA", 2, "lpMessageText"}, // LPCSTR
+	{"FatalAppExitW", 1, "uAction"}, // UINT
+	{"FatalAppExitW", 2, "lpMessageText"}, // LPCWSTR
+	{"FatalExit", 1, "ExitCode"}, // int
+	{"FileEncryptionStatusA", 1, "lpFileName"}, // LPCSTR
+	{"FileEncryptionStatusA", 2, "lpStatus"}, // LPDWORD
+	{"FileEncryptionStatusW", 1, "lpFileName"}, // LPCWSTR
+	{"FileEncryptionStatusW", 2, "lpStatus"}, // LPDWORD
+	{"FileTimeToDosDateTime", 1, "lpFileTime"}, // CONST FILETIME *
+	{"FileTimeToDosDateTime", 2, "lpFatDate"}, // LPWORD
+	{"FileTimeToDosDateTime", 3, "lpFatTime"}, // LPWORD
+	{"FileTimeToLocalFileTime", 1, "lpFileTime"}, // CONST FILETIME *
+	{"FileTimeToLocalFileTime", 2, "lpLocalFileTime"}, // LPFILETIME
+	{"FileTimeToSystemTime", 1, "lpFileTime"}, // CONST FILETIME *
+	{"FileTimeToSystemTime", 2, "lpSystemTime"}, // LPSYSTEMTIME
+	{"FillConsoleOutputAttribute", 1, "hConsoleOutput"}, // HANDLE
+	{"FillConsoleOutputAttribute", 2, "wAttribute"}, // WORD
+	{"FillConsoleOutputAttribute", 3, "nLength"}, // DWORD
+	{"FillConsoleOutputAttribute", 4, "dwWriteCoord"}, // COORD
+	{"FillConsoleOutputAttribute", 5, "lpNumberOfAttrsWritten"}, // LPDWORD
+	{"FillConsoleOutputCharacterA", 1, "hConsoleOutput"}, // HANDLE
+	{"FillConsoleOutputCharacterA", 2, "cCharacter"}, // CHAR
+	{"FillConsoleOutputCharacterA", 3, "nLength"}, // DWORD
+	{"FillConsoleOutputCharacterA", 4, "dwWriteCoord"}, // COORD
+	{"FillConsoleOutputCharacterA", 5, "lpNumberOfCharsWritten"}, // LPDWORD
+	{"FillConsoleOutputCharacterW", 1, "hConsoleOutput"}, // HANDLE
+	{"FillConsoleOutputCharacterW", 2, "cCharacter"}, // WCHAR
+	{"FillConsoleOutputCharacterW", 3, "nLength"}, // DWORD
+	{"FillConsoleOutputCharacterW", 4, "dwWriteCoord"}, // COORD
+	{"FillConsoleOutputCharacterW", 5, "lpNumberOfCharsWritten"}, // LPDWORD
+	{"FillPath", 1, "hdc"}, // HDC
+	{"FillRect", 1, "hDC"}, // HDC
+	{"FillRect", 2, "lprc"}, // CONST RECT *
+	{"FillRect", 3, "hbr"}, // HBRUSH
+	{"FillRgn", 1, "hdc"}, // HDC
+	{"FillRgn", 2, "hrgn"}, // HRGN
+	{"FillRgn", 3, "hbr"}, // HBRUSH
+	{"FindActCtxSectionGuid", 1, "dwFlags"}, // DWORD
+	{"FindActCtxSectionGuid", 2, "lpExtensionGuid"}, // const GUID *
+	{"FindActCtxSectionGuid", 3, "ulSectionId"}, // ULONG
+	{"FindActCtxSectionGuid", 4, "lpGuidToFind"}, // const GUID *
+	{"FindActCtxSectionGuid", 5, "ReturnedData"}, // PACTCTX_SECTION_KEYED_DATA
+	{"FindActCtxSectionStringA", 1, "dwFlags"}, // DWORD
+	{"FindActCtxSectionStringA", 2, "lpExtensionGuid"}, // const GUID *
+	{"FindActCtxSectionStringA", 3, "ulSectionId"}, // ULONG
+	{"FindActCtxSectionStringA", 4, "lpStringToFind"}, // LPCSTR
+	{"FindActCtxSectionStringA", 5, "ReturnedData"}, // PACTCTX_SECTION_KEYED_DATA
+	{"FindActCtxSectionStringW", 1, "dwFlags"}, // DWORD
+	{"FindActCtxSectionStringW", 2, "lpExtensionGuid"}, // const GUID *
+	{"FindActCtxSectionStringW", 3, "ulSectionId"}, // ULONG
+	{"FindActCtxSectionStringW", 4, "lpStringToFind"}, // LPCWSTR
+	{"FindActCtxSectionStringW", 5, "ReturnedData"}, // PACTCTX_SECTION_KEYED_DATA
+	{"FindAtomA", 1, "lpString"}, // LPCSTR
+	{"FindAtomW", 1, "lpString"}, // LPCWSTR
+	{"FindCertsByIssuer", 1, "pCertChains"}, // PCERT_CHAIN
+	{"FindCertsByIssuer", 2, "pcbCertChains"}, // DWORD *
+	{"FindCertsByIssuer", 3, "pcCertChains"}, // DWORD *
+	{"FindCertsByIssuer", 4, "pbEncodedIssuerName"}, // BYTE *
+	{"FindCertsByIssuer", 5, "cbEncodedIssuerName"}, // DWORD
+	{"FindCertsByIssuer", 6, "pwszPurpose"}, // LPCWSTR
+	{"FindCertsByIssuer", 7, "dwKeySpec"}, // DWORD
+	{"FindClose", 1, "hFindFile"}, // HANDLE
+	{"FindCloseChangeNotification", 1, "hChangeHandle"}, // HANDLE
+	{"FindClosePrinterChangeNotification", 1, "hChange"}, // HANDLE
+	{"FindFirstChangeNotificationA", 1, "lpPathName"}, // LPCSTR
+	{"FindFirstChangeNotificationA", 2, "bWatchSubtree"}, // WINBOOL
+	{"FindFirstChangeNotificationA", 3, "dwNotifyFilter"}, // DWORD
+	{"FindFirstChangeNotificationW", 1, "lpPathName"}, // LPCWSTR
+	{"FindFirstChangeNotificationW", 2, "bWatchSubtree"}, // WINBOOL
+	{"FindFirstChangeNotificationW", 3, "dwNotifyFilter"}, // DWORD
+	{"FindFirstFileA", 1, "lpFileName"}, // LPCSTR
+	{"FindFirstFileA", 2, "lpFindFileData"}, // LPWIN32_FIND_DATAA
+	{"FindFirstFileExA", 1, "lpFileName"}, // LPCSTR
+	{"FindFirstFileExA", 2, "fInfoLevelId"}, // FINDEX_INFO_LEVELS
+	{"FindFirstFileExA", 3, "lpFindFileData"}, // LPVOID
+	{"FindFirstFileExA", 4, "fSearchOp"}, // FINDEX_SEARCH_OPS
+	{"FindFirstFileExA", 5, "lpSearchFilter"}, // LPVOID
+	{"FindFirstFileExA", 6, "dwAdditionalFlags"}, // DWORD
+	{"FindFirstFileExW", 1, "lpFileName"}, // LPCWSTR
+	{"FindFirstFileExW", 2, "fInfoLevelId"}, // FINDEX_INFO_LEVELS
+	{"FindFirstFileExW", 3, "lpFindFileData"}, // LPVOID
+	{"FindFirstFileExW", 4, "fSearchOp"}, // FINDEX_SEARCH_OPS
+	{"FindFirstFileExW", 5, "lpSearchFilter"}, // LPVOID
+	{"FindFirstFileExW", 6, "dwAdditionalFlags"}, // DWORD
+	{"FindFirstFileNameTransactedW", 1, "lpFileName"}, // LPCWSTR
+	{"FindFirstFileNameTransactedW", 2, "dwFlags"}, // DWORD
+	{"FindFirstFileNameTransactedW", 3, "StringLength"}, // LPDWORD
+	{"FindFirstFileNameTransactedW", 4, "LinkName"}, // PWCHAR
+	{"FindFirstFileNameTransactedW", 5, "hTransaction"}, // HANDLE
+	{"FindFirstFileNameW", 1, "lpFileName"}, // LPCWSTR
+	{"FindFirstFileNameW", 2, "dwFlags"}, // DWORD
+	{"FindFirstFileNameW", 3, "StringLength"}, // LPDWORD
+	{"FindFirstFileNameW", 4, "LinkName"}, // PWCHAR
+	{"FindFirstFileTransactedA", 1, "lpFileName"}, // LPCSTR
+	{"FindFirstFileTransactedA", 2, "fInfoLevelId"}, // FINDEX_INFO_LEVELS
+	{"FindFirstFileTransactedA", 3, "lpFindFileData"}, // LPVOID
+	{"FindFirstFileTransactedA", 4, "fSearchOp"}, // FINDEX_SEARCH_OPS
+	{"FindFirstFileTransactedA", 5, "lpSearchFilter"}, // LPVOID
+	{"FindFirstFileTransactedA", 6, "dwAdditionalFlags"}, // DWORD
+	{"FindFirstFileTransactedA", 7, "hTransaction"}, // HANDLE
+	{"FindFirstFileTransactedW", 1, "lpFileName"}, // LPCWSTR
+	{"FindFirstFileTransactedW", 2, "fInfoLevelId"}, // FINDEX_INFO_LEVELS
+	{"FindFirstFileTransactedW", 3, "lpFindFileData"}, // LPVOID
+	{"FindFirstFileTransactedW", 4, "fSearchOp"}, // FINDEX_SEARCH_OPS
+	{"FindFirstFileTransactedW", 5, "lpSearchFilter"}, // LPVOID
+	{"FindFirstFileTransactedW", 6, "dwAdditionalFlags"}, // DWORD
+	{"FindFirstFileTransactedW", 7, "hTransaction"}, // HANDLE
+	{"FindFirstFileW", 1, "lpFileName"}, // LPCWSTR
+	{"FindFirstFileW", 2, "lpFindFileData"}, // LPWIN32_FIND_DATAW
+	{"FindFirstFreeAce", 1, "pAcl"}, // PACL
+	{"FindFirstFreeAce", 2, "pAce"}, // LPVOID *
+	{"FindFirstPrinterChangeNotification", 1, "hPrinter"}, // HANDLE
+	{"FindFirstPrinterChangeNotification", 2, "fdwFlags"}, // DWORD
+	{"FindFirstPrinterChangeNotification", 3, "fdwOptions"}, // DWORD
+	{"FindFirstPrinterChangeNotification", 4, "pPrinterNotifyOptions"}, // LPVOID
+	{"FindFirstStreamTransactedW", 1, "lpFileName"}, // LPCWSTR
+	{"FindFirstStreamTransactedW", 2, "InfoLevel"}, // STREAM_INFO_LEVELS
+	{"FindFirstStreamTransactedW", 3, "lpFindStreamData"}, // LPVOID
+	{"FindFirstStreamTransactedW", 4, "dwFlags"}, // DWORD
+	{"FindFirstStreamTransactedW", 5, "hTransaction"}, // HANDLE
+	{"FindFirstStreamW", 1, "lpFileName"}, // LPCWSTR
+	{"FindFirstStreamW", 2, "InfoLevel"}, // STREAM_INFO_LEVELS
+	{"FindFirstStreamW", 3, "lpFindStreamData"}, // LPVOID
+	{"FindFirstStreamW", 4, "dwFlags"}, // DWORD
+	{"FindFirstVolumeA", 1, "lpszVolumeName"}, // LPSTR
+	{"FindFirstVolumeA", 2, "cchBufferLength"}, // DWORD
+	{"FindFirstVolumeMountPointA", 1, "lpszRootPathName"}, // LPCSTR
+	{"FindFirstVolumeMountPointA", 2, "lpszVolumeMountPoint"}, // LPSTR
+	{"FindFirstVolumeMountPointA", 3, "cchBufferLength"}, // DWORD
+	{"FindFirstVolumeMountPointW", 1, "lpszRootPathName"}, // LPCWSTR
+	{"FindFirstVolumeMountPointW", 2, "lpszVolumeMountPoint"}, // LPWSTR
+	{"FindFirstVolumeMountPointW", 3, "cchBufferLength"}, // DWORD
+	{"FindFirstVolumeW", 1, "lpszVolumeName"}, // LPWSTR
+	{"FindFirstVolumeW", 2, "cchBufferLength"}, // DWORD
+	{"FindNLSString", 1, "Locale"}, // LCID
+	{"FindNLSString", 2, "dwFindNLSStringFlags"}, // DWORD
+	{"FindNLSString", 3, "lpStringSource"}, // LPCWSTR
+	{"FindNLSString", 4, "cchSource"}, // int
+	{"FindNLSString", 5, "lpStringValue"}, // LPCWSTR
+	{"FindNLSString", 6, "cchValue"}, // int
+	{"FindNLSString", 7, "pcchFound"}, // LPINT
+	{"FindNLSStringEx", 1, "lpLocaleName"}, // LPCWSTR
+	{"FindNLSStringEx", 2, "dwFindNLSStringFlags"}, // DWORD
+	{"FindNLSStringEx", 3, "lpStringSource"}, // LPCWSTR
+	{"FindNLSStringEx", 4, "cchSource"}, // int
+	{"FindNLSStringEx", 5, "lpStringValue"}, // LPCWSTR
+	{"FindNLSStringEx", 6, "cchValue"}, // int
+	{"FindNLSStringEx", 7, "pcchFound"}, // LPINT
+	{"FindNLSStringEx", 8, "lpVersionInformation"}, // LPNLSVERSIONINFO
+	{"FindNLSStringEx", 9, "lpReserved"}, // LPVOID
+	{"FindNLSStringEx", 10, "lParam"}, // LPARAM
+	{"FindNextChangeNotification", 1, "hChangeHandle"}, // HANDLE
+	{"FindNextFileA", 1, "hFindFile"}, // HANDLE
+	{"FindNextFileA", 2, "lpFindFileData"}, // LPWIN32_FIND_DATAA
+	{"FindNextFileNameW", 1, "hFindStream"}, // HANDLE
+	{"FindNextFileNameW", 2, "StringLength"}, // LPDWORD
+	{"FindNextFileNameW", 3, "LinkName"}, // PWCHAR
+	{"FindNextFileW", 1, "hFindFile"}, // HANDLE
+	{"FindNextFileW", 2, "lpFindFileData"}, // LPWIN32_FIND_DATAW
+	{"FindNextPrinterChangeNotification", 1, "hChange"}, // HANDLE
+	{"FindNextPrinterChangeNotification", 2, "pdwChange"}, // PDWORD
+	{"FindNextPrinterChangeNotification", 3, "pPrinterNotifyOptions"}, // LPVOID
+	{"FindNextPrinterChangeNotification", 4, "ppPrinterNotifyInfo"}, // LPVOID *
+	{"FindNextStreamW", 1, "hFindStream"}, // HANDLE
+	{"FindNextStreamW", 2, "lpFindStreamData"}, // LPVOID
+	{"FindNextVolumeA", 1, "hFindVolume"}, // HANDLE
+	{"FindNextVolumeA", 2, "lpszVolumeName"}, // LPSTR
+	{"FindNextVolumeA", 3, "cchBufferLength"}, // DWORD
+	{"FindNextVolumeMountPointA", 1, "hFindVolumeMountPoint"}, // HANDLE
+	{"FindNextVolumeMountPointA", 2, "lpszVolumeMountPoint"}, // LPSTR
+	{"FindNextVolumeMountPointA", 3, "cchBufferLength"}, // DWORD
+	{"FindNextVolumeMountPointW", 1, "hFindVolumeMountPoint"}, // HANDLE
+	{"FindNextVolumeMountPointW", 2, "lpszVolumeMountPoint"}, // LPWSTR
+	{"FindNextVolumeMountPointW", 3, "cchBufferLength"}, // DWORD
+	{"FindNextVolumeW", 1, "hFindVolume"}, // HANDLE
+	{"FindNextVolumeW", 2, "lpszVolumeName"}, // LPWSTR
+	{"FindNextVolumeW", 3, "cchBufferLength"}, // DWORD
+	{"FindResourceA", 1, "hModule"}, // HMODULE
+	{"FindResourceA", 2, "lpName"}, // LPCSTR
+	{"FindResourceA", 3, "lpType"}, // LPCSTR
+	{"FindResourceExA", 1, "hModule"}, // HMODULE
+	{"FindResourceExA", 2, "lpType"}, // LPCSTR
+	{"FindResourceExA", 3, "lpName"}, // LPCSTR
+	{"FindResourceExA", 4, "wLanguage"}, // WORD
+	{"FindResourceExW", 1, "hModule"}, // HMODULE
+	{"FindResourceExW", 2, "lpType"}, // LPCWSTR
+	{"FindResourceExW", 3, "lpName"}, // LPCWSTR
+	{"FindResourceExW", 4, "wLanguage"}, // WORD
+	{"FindResourceW", 1, "hModule"}, // HMODULE
+	{"FindResourceW", 2, "lpName"}, // LPCWSTR
+	{"FindResourceW", 3, "lpType"}, // LPCWSTR
+	{"FindVolumeClose", 1, "hFindVolume"}, // HANDLE
+	{"FindVolumeMountPointClose", 1, "hFindVolumeMountPoint"}, // HANDLE
+	{"FindWindowA", 1, "lpClassName"}, // LPCSTR
+	{"FindWindowA", 2, "lpWindowName"}, // LPCSTR
+	{"FindWindowExA", 1, "hWndParent"}, // HWND
+	{"FindWindowExA", 2, "hWndChildAfter"}, // HWND
+	{"FindWindowExA", 3, "lpszClass"}, // LPCSTR
+	{"FindWindowExA", 4, "lpszWindow"}, // LPCSTR
+	{"FindWindowExW", 1, "hWndParent"}, // HWND
+	{"FindWindowExW", 2, "hWndChildAfter"}, // HWND
+	{"FindWindowExW", 3, "lpszClass"}, // LPCWSTR
+	{"FindWindowExW", 4, "lpszWindow"}, // LPCWSTR
+	{"FindWindowW", 1, "lpClassName"}, // LPCWSTR
+	{"FindWindowW", 2, "lpWindowName"}, // LPCWSTR
+	{"FixBrushOrgEx", 1, "hdc"}, // HDC
+	{"FixBrushOrgEx", 2, "x"}, // int
+	{"FixBrushOrgEx", 3, "y"}, // int
+	{"FixBrushOrgEx", 4, "ptl"}, // LPPOINT
+	{"FlashWindow", 1, "hWnd"}, // HWND
+	{"FlashWindow", 2, "bInvert"}, // WINBOOL
+	{"FlashWindowEx", 1, "pfwi"}, // PFLASHWINFO
+	{"FlattenPath", 1, "hdc"}, // HDC
+	{"FloodFill", 1, "hdc"}, // HDC
+	{"FloodFill", 2, "x"}, // int
+	{"FloodFill", 3, "y"}, // int
+	{"FloodFill", 4, "color"}, // COLORREF
+	{"FlsAlloc", 1, "lpCallback"}, // PFLS_CALLBACK_FUNCTION
+	{"FlsFree", 1, "dwFlsIndex"}, // DWORD
+	{"FlsGetValue", 1, "dwFlsIndex"}, // DWORD
+	{"FlsSetValue", 1, "dwFlsIndex"}, // DWORD
+	{"FlsSetValue", 2, "lpFlsData"}, // PVOID
+	{"FlushConsoleInputBuffer", 1, "hConsoleInput"}, // HANDLE
+	{"FlushFileBuffers", 1, "hFile"}, // HANDLE
+	{"FlushInstructionCache", 1, "hProcess"}, // HANDLE
+	{"FlushInstructionCache", 2, "lpBaseAddress"}, // LPCVOID
+	{"FlushInstructionCache", 3, "dwSize"}, // SIZE_T
+	{"FlushPrinter", 1, "hPrinter"}, // HANDLE
+	{"FlushPrinter", 2, "pBuf"}, // LPVOID
+	{"FlushPrinter", 3, "cbBuf"}, // DWORD
+	{"FlushPrinter", 4, "pcWritten"}, // LPDWORD
+	{"FlushPrinter", 5, "cSleep"}, // DWORD
+	{"FlushViewOfFile", 1, "lpBaseAddress"}, // LPCVOID
+	{"FlushViewOfFile", 2, "dwNumberOfBytesToFlush"}, // SIZE_T
+	{"FoldStringA", 1, "dwMapFlags"}, // DWORD
+	{"FoldStringA", 2, "lpSrcStr"}, // LPCSTR
+	{"FoldStringA", 3, "cchSrc"}, // int
+	{"FoldStringA", 4, "lpDestStr"}, // LPSTR
+	{"FoldStringA", 5, "cchDest"}, // int
+	{"FoldStringW", 1, "dwMapFlags"}, // DWORD
+	{"FoldStringW", 2, "lpSrcStr"}, // LPCWSTR
+	{"FoldStringW", 3, "cchSrc"}, // int
+	{"FoldStringW", 4, "lpDestStr"}, // LPWSTR
+	{"FoldStringW", 5, "cchDest"}, // int
+	{"FormatMessageA", 1, "dwFlags"}, // DWORD
+	{"FormatMessageA", 2, "lpSource"}, // LPCVOID
+	{"FormatMessageA", 3, "dwMessageId"}, // DWORD
+	{"FormatMessageA", 4, "dwLanguageId"}, // DWORD
+	{"FormatMessageA", 5, "lpBuffer"}, // LPSTR
+	{"FormatMessageA", 6, "nSize"}, // DWORD
+	{"FormatMessageW", 1, "dwFlags"}, // DWORD
+	{"FormatMessageW", 2, "lpSource"}, // LPCVOID
+	{"FormatMessageW", 3, "dwMessageId"}, // DWORD
+	{"FormatMessageW", 4, "dwLanguageId"}, // DWORD
+	{"FormatMessageW", 5, "lpBuffer"}, // LPWSTR
+	{"FormatMessageW", 6, "nSize"}, // DWORD
+	{"FrameRect", 1, "hDC"}, // HDC
+	{"FrameRect", 2, "lprc"}, // CONST RECT *
+	{"FrameRect", 3, "hbr"}, // HBRUSH
+	{"FrameRgn", 1, "hdc"}, // HDC
+	{"FrameRgn", 2, "hrgn"}, // HRGN
+	{"FrameRgn", 3, "hbr"}, // HBRUSH
+	{"FrameRgn", 4, "w"}, // int
+	{"FrameRgn", 5, "h"}, // int
+	{"FreeEncryptionCertificateHashList", 1, "pHashes"}, // PENCRYPTION_CERTIFICATE_HASH_LIST
+	{"FreeEnvironmentStringsA", 1, "lpszEnvironmentBlock"}, // LPCH
+	{"FreeEnvironmentStringsW", 1, "lpszEnvironmentBlock"}, // LPWCH
+	{"FreeLibrary", 1, "hLibModule"}, // HMODULE
+	{"FreeLibraryAndExitThread", 1, "hLibModule"}, // HMODULE
+	{"FreeLibraryAndExitThread", 2, "dwExitCode"}, // DWORD
+	{"FreeLibraryWhenCallbackReturns", 1, "pci"}, // PTP_CALLBACK_INSTANCE
+	{"FreeLibraryWhenCallbackReturns", 2, "mod"}, // HMODULE
+	{"FreePrinterNotifyInfo", 1, "pPrinterNotifyInfo"}, // PPRINTER_NOTIFY_INFO
+	{"FreeResource", 1, "hResData"}, // HGLOBAL
+	{"FreeSid", 1, "pSid"}, // PSID
+	{"FreeUserPhysicalPages", 1, "hProcess"}, // HANDLE
+	{"FreeUserPhysicalPages", 2, "NumberOfPages"}, // PULONG_PTR
+	{"FreeUserPhysicalPages", 3, "PageArray"}, // PULONG_PTR
+};
+
+static_assert(isSortedFuncParamNamesTable(FUNC_PARAM_NAMES),
+	"FUNC_PARAM_NAMES has to be sorted by function names and positions");
+
+} // anonymous namespace
+
+/**
+* @brief Returns the table with info about functions starting with F.
+*/
+FuncParamNamesTable getFuncParamNamesTable_F() {
+	return FUNC_PARAM_NAMES;
 }
 
 } // namespace win_api
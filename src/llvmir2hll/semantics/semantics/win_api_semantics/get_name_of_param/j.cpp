@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/j.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Table of parameter names of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -12,12 +12,13 @@ namespace semantics {
 namespace win_api {
 
 /**
-* @brief Initializes the given map with info about functions starting with J.
+* @brief Returns the table with info about functions starting with J.
 */
-void initFuncParamNamesMap_J(FuncParamNamesMap &funcParamNamesMap) {
+FuncParamNamesTable getFuncParamNamesTable_J() {
 	//
 	// windows.h
 	//
+	return FuncParamNamesTable();
 }
 
 } // namespace win_api
@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/k.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Table of parameter names of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -11,20 +11,32 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with K.
-*/
-void initFuncParamNamesMap_K(FuncParamNamesMap &funcParamNamesMap) {
+namespace {
+
+/// Names of parameters of the functions, sorted by function names and
+/// parameter positions.
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("KillTimer", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("KillTimer", 2, "uIDEvent"); // UINT_PTR
+	{"KillTimer", 1, "hWnd"}, // HWND
+	{"KillTimer", 2, "uIDEvent"}, // UINT_PTR
+	{"keybd_event", 1, "bVk"}, // BYTE
+	{"keybd_event", 2, "bScan"}, // BYTE
+	{"keybd_event", 3, "dwFlags"}, // DWORD
+	{"keybd_event", 4, "dwExtraInfo"}, // ULONG_PTR
+};
+
+static_assert(isSortedFuncParamNamesTable(FUNC_PARAM_NAMES),
+	"FUNC_PARAM_NAMES has to be sorted by function names and positions");
 
-	ADD_PARAM_NAME("keybd_event", 1, "bVk"); // BYTE
-	ADD_PARAM_NAME("keybd_event", 2, "bScan"); // BYTE
-	ADD_PARAM_NAME("keybd_event", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("keybd_event", 4, "dwExtraInfo"); // ULONG_PTR
+} // anonymous namespace
+
+/**
+* @brief Returns the table with info about functions starting with K.
+*/
+FuncParamNamesTable getFuncParamNamesTable_K() {
+	return FUNC_PARAM_NAMES;
 }
 
 } // namespace win_api
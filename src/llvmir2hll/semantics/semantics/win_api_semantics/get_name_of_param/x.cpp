@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/x.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Table of parameter names of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -11,21 +11,34 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with X.
-*/
-void initFuncParamNamesMap_X(FuncParamNamesMap &funcParamNamesMap) {
+namespace {
+
+/// Names of parameters of the functions, sorted by function names and
+/// parameter positions.
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("XcvDataW", 1, "hXcv"); // HANDLE
-	ADD_PARAM_NAME("XcvDataW", 2, "pszDataName"); // PCWSTR
-	ADD_PARAM_NAME("XcvDataW", 3, "pInputData"); // PBYTE
-	ADD_PARAM_NAME("XcvDataW", 4, "cbInputData"); // DWORD
-	ADD_PARAM_NAME("XcvDataW", 5, "pOutputData"); // PBYTE
-	ADD_PARAM_NAME("XcvDataW", 6, "cbOutputData"); // DWORD
-	ADD_PARAM_NAME("XcvDataW", 7, "pcbOutputNeeded"); // PDWORD
-	ADD_PARAM_NAME("XcvDataW", 8, "pdwStatus"); // PDWORD
+	{"XcvDataW", 1, "hXcv"}, // HANDLE
+	{"XcvDataW", 2, "pszDataName"}, // PCWSTR
+	{"XcvDataW", 3, "pInputData"}, // PBYTE
+	{"XcvDataW", 4, "cbInputData"}, // DWORD
+	{"XcvDataW", 5, "pOutputData"}, // PBYTE
+	{"XcvDataW", 6, "cbOutputData"}, // DWORD
+	{"XcvDataW", 7, "pcbOutputNeeded"}, // PDWORD
+	{"XcvDataW", 8, "pdwStatus"}, // PDWORD
+};
+
+static_assert(isSortedFuncParamNamesTable(FUNC_PARAM_NAMES),
+	"FUNC_PARAM_NAMES has to be sorted by function names and positions");
+
+} // anonymous namespace
+
+/**
+* @brief Returns the table with info about functions starting with X.
+*/
+FuncParamNamesTable getFuncParamNamesTable_X() {
+	return FUNC_PARAM_NAMES;
 }
 
 } // namespace win_api
@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/y.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Table of parameter names of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -12,12 +12,13 @@ namespace semantics {
 namespace win_api {
 
 /**
-* @brief Initializes the given map with info about functions starting with Y.
+* @brief Returns the table with info about functions starting with Y.
 */
-void initFuncParamNamesMap_Y(FuncParamNamesMap &funcParamNamesMap) {
+FuncParamNamesTable getFuncParamNamesTable_Y() {
 	//
 	// windows.h
 	//
+	return FuncParamNamesTable();
 }
 
 } // namespace win_api
@@ -64,14 +64,19 @@ std::unique_ptr<Image> createImageImpl(const std::shared_ptr<retdec::fileformat:
  *
  * @param filePath Path to input file.
  * @param isRaw Is the input a raw binary file format?
+ * @param loadFlags Load flags of the file format.
  *
  * @return Pointer to instance of Image class or @c nullptr if any error
  */
-std::unique_ptr<Image> createImage(const std::string& filePath, bool isRaw)
+std::unique_ptr<Image> createImage(
+		const std::string& filePath,
+		bool isRaw,
+		retdec::fileformat::LoadFlags loadFlags)
 {
 	std::unique_ptr<retdec::fileformat::FileFormat> fileFormat = retdec::fileformat::createFileFormat(
 			filePath,
-			isRaw);
+			isRaw,
+			loadFlags);
 	std::shared_ptr<retdec::fileformat::FileFormat> fileFormatShared(std::move(fileFormat)); // Obtain ownership.
 	return createImageImpl(fileFormatShared);
 }
@@ -176,6 +176,95 @@ bool BreakMachOUniversal::getByArchFamily(
 	return false;
 }
 
+/**
+ * Get Mach-O Universal object iterator by architecture family name
+ * @param familyName family name (valid --arch option value)
+ * @param res reference for storing result
+ * @return @c true if object of @p familyName was found, @c false otherwise
+ */
+bool BreakMachOUniversal::getByArchFamilyName(
+		const std::string &familyName,
+		llvm::object::MachOUniversalBinary::object_iterator &res)
+{
+	if(familyName == "x86")
+	{
+		return getByArchFamily(CPU_TYPE_X86, res);
+	}
+	else if(familyName == "arm" || familyName == "thumb")
+	{
+		// Same family
+		return getByArchFamily(CPU_TYPE_ARM, res);
+	}
+	else if(familyName == "powerpc")
+	{
+		return getByArchFamily(CPU_TYPE_POWERPC, res);
+	}
+	else if(familyName == "x86-64")
+	{
+		return getByArchFamily(CPU_TYPE_X86_64, res);
+	}
+	else if(familyName == "arm64")
+	{
+		return getByArchFamily(CPU_TYPE_ARM64, res);
+	}
+	else if(familyName == "powerpc64")
+	{
+		return getByArchFamily(CPU_TYPE_POWERPC64, res);
+	}
+	else if(familyName == "sparc")
+	{
+		return getByArchFamily(CPU_TYPE_SPARC, res);
+	}
+	else if(familyName == "mc98000")
+	{
+		return getByArchFamily(CPU_TYPE_MC98000, res);
+	}
+
+	return false;
+}
+
+/**
+ * Get Mach-O Universal object iterator of the best architecture for
+ * decompilation
+ * @param res reference for storing result
+ * @return @c true if there is some object, @c false otherwise
+ */
+bool BreakMachOUniversal::getBest(
+		llvm::object::MachOUniversalBinary::object_iterator &res)
+{
+	if(!file || !file->getNumberOfObjects())
+	{
+		return false;
+	}
+
+	res = file->begin_objects();
+	if(getByArchFamily(CPU_TYPE_X86, res)
+			|| getByArchFamily(CPU_TYPE_ARM, res)
+			|| getByArchFamily(CPU_TYPE_POWERPC, res))
+	{
+		return true;
+	}
+
+	// If none of above, just pick first.
+	res = file->begin_objects();
+	return true;
+}
+
+/**
+ * Get slice view of object by iterator
+ * @param it object iterator
+ * @return slice pointing into the file buffer
+ */
+MachOSlice BreakMachOUniversal::getSlice(
+		llvm::object::MachOUniversalBinary::object_iterator &it)
+{
+	MachOSlice slice;
+	slice.archName = getArchName(it);
+	slice.offset = it->getOffset();
+	slice.data = llvm::StringRef(getFileBufferStart() + it->getOffset(), it->getSize());
+	return slice;
+}
+
 /**
  * Extract object by iterator
  * @param it object iterator
@@ -189,7 +278,8 @@ bool BreakMachOUniversal::extract(
 	std::ofstream output(outPath, std::ios::binary);
 	if(output)
 	{
-		output.write(getFileBufferStart() + it->getOffset(), it->getSize());
+		auto slice = getSlice(it);
+		output.write(slice.data.data(), slice.data.size());
 		return output.good();
 	}
 
@@ -468,15 +558,7 @@ bool BreakMachOUniversal::extractBestArchive(
 	}
 
 	auto obj = file->begin_objects();
-	if(getByArchFamily(CPU_TYPE_X86, obj)
-			|| getByArchFamily(CPU_TYPE_ARM, obj)
-			|| getByArchFamily(CPU_TYPE_POWERPC, obj))
-	{
-		return extract(obj, outPath);
-	}
-
-	// If none of above, just pick first.
-	return extract(obj, outPath);
+	return getBest(obj) && extract(obj, outPath);
 }
 
 /**
@@ -522,91 +604,102 @@ bool BreakMachOUniversal::extractArchiveForFamily(
 	}
 
 	auto obj = file->begin_objects();
-	if(familyName == "x86")
-	{
-		if(getByArchFamily(CPU_TYPE_X86, obj))
-		{
-			return extract(obj, outPath);
-		}
-	}
-	else if(familyName == "arm" || familyName == "thumb")
-	{
-		// Same family
-		if(getByArchFamily(CPU_TYPE_ARM, obj))
-		{
-			return extract(obj, outPath);
-		}
-	}
-	else if(familyName == "powerpc")
+	return getByArchFamilyName(familyName, obj) && extract(obj, outPath);
+}
+
+/**
+ * Extract archive by architecture
+ * @param machoArchName Mach-O specific architecture string
+ * @param outPath path to output file
+ * @return @c true if extraction was successful, @c false otherwise
+ */
+bool BreakMachOUniversal::extractArchiveForArchitecture(
+		const std::string &machoArchName,
+		const std::string &outPath)
+{
+	if(!file)
 	{
-		if(getByArchFamily(CPU_TYPE_POWERPC, obj))
-		{
-			return extract(obj, outPath);
-		}
+		return false;
 	}
-	else if(familyName == "x86-64")
+
+	for(auto i = file->begin_objects(), e = file->end_objects(); i != e; ++i)
 	{
-		if(getByArchFamily(CPU_TYPE_X86_64, obj))
+		if(machoArchName == getArchName(i))
 		{
-			return extract(obj, outPath);
+			return extract(i, outPath);
 		}
 	}
-	else if(familyName == "arm64")
+
+	return false;
+}
+
+/**
+ * Get slice with best architecture for decompilation
+ * @param res reference for storing result
+ * @return @c true if slice was found, @c false otherwise
+ */
+bool BreakMachOUniversal::getBestArchive(
+		MachOSlice &res)
+{
+	if(!file)
 	{
-		if(getByArchFamily(CPU_TYPE_ARM64, obj))
-		{
-			return extract(obj, outPath);
-		}
+		return false;
 	}
-	else if(familyName == "powerpc64")
+
+	auto obj = file->begin_objects();
+	if(!getBest(obj))
 	{
-		if(getByArchFamily(CPU_TYPE_POWERPC64, obj))
-		{
-			return extract(obj, outPath);
-		}
+		return false;
 	}
-	else if(familyName == "sparc")
+
+	res = getSlice(obj);
+	return true;
+}
+
+/**
+ * Get slice by architecture family
+ * @param familyName family name
+ * @param res reference for storing result
+ * @return @c true if slice was found, @c false otherwise
+ */
+bool BreakMachOUniversal::getArchiveForFamily(
+		const std::string &familyName,
+		MachOSlice &res)
+{
+	if(!file)
 	{
-		if(getByArchFamily(CPU_TYPE_SPARC, obj))
-		{
-			return extract(obj, outPath);
-		}
+		return false;
 	}
-	else if(familyName == "mc98000")
+
+	auto obj = file->begin_objects();
+	if(!getByArchFamilyName(familyName, obj))
 	{
-		if(getByArchFamily(CPU_TYPE_MC98000, obj))
-		{
-			return extract(obj, outPath);
-		}
+		return false;
 	}
 
-	return false;
+	res = getSlice(obj);
+	return true;
 }
 
 /**
- * Extract archive by architecture
- * @param machoArchName Mach-O specific architecture string
- * @param outPath path to output file
- * @return @c true if extraction was successful, @c false otherwise
+ * Get all slices
+ * @return slices in the order of the universal binary
+ *
+ * Slices are views into the file buffer, nothing is copied.
  */
-bool BreakMachOUniversal::extractArchiveForArchitecture(
-		const std::string &machoArchName,
-		const std::string &outPath)
+std::vector<MachOSlice> BreakMachOUniversal::getAllArchives()
 {
+	std::vector<MachOSlice> result;
 	if(!file)
 	{
-		return false;
+		return result;
 	}
 
 	for(auto i = file->begin_objects(), e = file->end_objects(); i != e; ++i)
 	{
-		if(machoArchName == getArchName(i))
-		{
-			return extract(i, outPath);
-		}
+		result.push_back(getSlice(i));
 	}
-
-	return false;
+	return result;
 }
 
 } // namespace macho_extractor
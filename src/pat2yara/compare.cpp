@@ -4,6 +4,9 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <cstdint>
+#include <unordered_map>
+
 #include "pat2yara/compare.h"
 #include "pat2yara/utils.h"
 #include "yaramod/types/hex_string.h"
@@ -191,6 +194,71 @@ bool sortNamesPredicate(
 	return first < other;
 }
 
+/**
+ * Number of leading nibbles used to bucket patterns.
+ */
+const std::size_t PREFIX_NIBBLES = 16;
+
+/**
+ * Leading nibbles of rule pattern packed into integers.
+ *
+ * Two patterns can be equal in the sense of comparePatterns() only if their
+ * keys agree on all nibbles that are concrete in both masks. Patterns whose
+ * leading nibbles are all concrete are regular, such patterns can be related
+ * to a regular pattern only if their keys are the same.
+ */
+struct PatternPrefix
+{
+	bool hasPattern = false; ///< Rule has hexadecimal pattern.
+	bool regular = false;    ///< All leading nibbles are concrete.
+	std::uint64_t key = 0;   ///< Values of leading nibbles.
+	std::uint64_t mask = 0;  ///< Concrete leading nibbles.
+
+	bool mayMatch(const PatternPrefix &other) const
+	{
+		if (hasPattern != other.hasPattern) {
+			return false;
+		}
+		return ((key ^ other.key) & mask & other.mask) == 0;
+	}
+};
+
+/**
+ * Get leading nibbles of rule pattern.
+ *
+ * @param rule input rule
+ *
+ * @return prefix of rule pattern
+ */
+PatternPrefix getPatternPrefix(
+	const Rule* rule)
+{
+	PatternPrefix result;
+
+	const auto pattern = getHexPattern(rule, "$1");
+	if (!pattern) {
+		return result;
+	}
+	result.hasPattern = true;
+
+	const auto &units = pattern->getUnits();
+	result.regular = units.size() >= PREFIX_NIBBLES;
+	for (std::size_t i = 0; i < PREFIX_NIBBLES && i < units.size(); ++i) {
+		const auto &unit = units[i];
+		if (unit->isWildcard() || unit->isJump() || unit->isOr()) {
+			result.regular = false;
+			continue;
+		}
+
+		const auto value = std::static_pointer_cast<HexStringNibble>(
+			unit)->getValue();
+		result.key |= std::uint64_t(value & 0xf) << (4 * i);
+		result.mask |= std::uint64_t(0xf) << (4 * i);
+	}
+
+	return result;
+}
+
 } // anonymous namespace
 
 /**
@@ -350,20 +418,66 @@ std::vector<RuleRelations> getRuleRelationsFromRules(
 {
 	std::vector<RuleRelations> results;
 
+	// Prefixes of base rules of results.
+	std::vector<PatternPrefix> prefixes;
+	// Indexes of results with regular prefix by prefix key.
+	std::unordered_map<std::uint64_t, std::vector<std::size_t>> buckets;
+	// Indexes of results without regular prefix.
+	std::vector<std::size_t> irregular;
+
+	// Rule is added to the first related result. Only results that can be
+	// related are compared, in the same order as they were created.
+	auto tryAdd = [&](std::size_t index, Rule* rule,
+			const PatternPrefix &prefix) {
+		return prefixes[index].mayMatch(prefix)
+			&& results[index].add(rule);
+	};
+
 	for (const auto &rule : rules) {
 		// Look for related rules.
 		bool foundRelation = false;
-		for (auto &relation : results) {
-			if (relation.add(rule.get())) {
-				// Related rule was found.
-				foundRelation = true;
-				break;
+		const auto prefix = getPatternPrefix(rule.get());
+
+		if (prefix.regular) {
+			// Regular rule can be related only to results from its bucket
+			// or to results with irregular prefix.
+			static const std::vector<std::size_t> noBucket;
+			auto bIt = buckets.find(prefix.key);
+			const auto &bucket = bIt != buckets.end() ? bIt->second : noBucket;
+
+			auto bI = bucket.begin();
+			auto iI = irregular.begin();
+			while (!foundRelation
+					&& (bI != bucket.end() || iI != irregular.end())) {
+				if (iI == irregular.end()
+						|| (bI != bucket.end() && *bI < *iI)) {
+					foundRelation = tryAdd(*bI++, rule.get(), prefix);
+				}
+				else {
+					foundRelation = tryAdd(*iI++, rule.get(), prefix);
+				}
+			}
+		}
+		else {
+			for (std::size_t i = 0; i < results.size(); ++i) {
+				if (tryAdd(i, rule.get(), prefix)) {
+					// Related rule was found.
+					foundRelation = true;
+					break;
+				}
 			}
 		}
 
 		// Create new entry if no related rule was found.
 		if (!foundRelation) {
+			if (prefix.regular) {
+				buckets[prefix.key].push_back(results.size());
+			}
+			else {
+				irregular.push_back(results.size());
+			}
 			results.emplace_back(RuleRelations(rule.get()));
+			prefixes.push_back(prefix);
 		}
 	}
 
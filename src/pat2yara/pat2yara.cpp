@@ -47,7 +47,10 @@ void printUsage(Logger& log)
 	"--ignore-nops OPCODE\n"
 	"    Ignore NOPs with OPCODE when computing (pure) size.\n\n"
 	"--delphi\n"
-	"    Set special Delphi processing on.\n\n";
+	"    Set special Delphi processing on.\n\n"
+	"-j --jobs VALUE\n"
+	"    Parse input files with VALUE threads.\n"
+	"    If not given, number of processors is used.\n\n";
 }
 
 /**
@@ -140,6 +143,11 @@ int processArguments(std::vector<std::string> &args)
 				return dieWithError("invalid --ignore-nops argument value");
 			}
 		}
+		else if (args[i] == "--jobs" || args[i] == "-j") {
+			if (!argumentToSize(args, options.jobs, ++i)) {
+				return dieWithError("invalid --jobs argument value");
+			}
+		}
 		else if (args[i] == "--output" || args[i] == "-o") {
 			if (args.size() > i + 1) {
 				outputPath = args[++i];
@@ -4,6 +4,10 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <exception>
+#include <thread>
+
 #include "pat2yara/compare.h"
 #include "pat2yara/logic.h"
 #include "pat2yara/modifications.h"
@@ -111,6 +115,102 @@ void filterRulesFromFile(
 	}
 }
 
+/**
+ * Parse input files in parallel.
+ *
+ * Files are parsed in windows so that only a limited number of parsed files
+ * is kept in memory at once. Each thread has its own parser.
+ */
+class ParallelParser
+{
+	public:
+		ParallelParser(
+			const std::vector<std::string> &input,
+			std::size_t jobs)
+			: input(input)
+		{
+			if (jobs == 0) {
+				jobs = std::max(1u, std::thread::hardware_concurrency());
+			}
+			jobs = std::min(jobs, std::max<std::size_t>(1, input.size()));
+			for (std::size_t i = 0; i < jobs; ++i) {
+				parsers.push_back(std::make_unique<Yaramod>());
+			}
+			window.resize(jobs * 4);
+		}
+
+		/**
+		 * Get parsed file with given index.
+		 *
+		 * Files have to be requested in input order. If parsing of file
+		 * failed, exception thrown by the parser is rethrown.
+		 *
+		 * @param index index of input file
+		 *
+		 * @return parsed file
+		 */
+		std::unique_ptr<YaraFile> get(
+			std::size_t index)
+		{
+			if (index < windowStart || index >= windowEnd) {
+				parseWindow(index);
+			}
+
+			auto &parsed = window[index - windowStart];
+			if (parsed.error) {
+				std::rethrow_exception(parsed.error);
+			}
+			return std::move(parsed.file);
+		}
+
+	private:
+		struct ParsedFile
+		{
+			std::unique_ptr<YaraFile> file;
+			std::exception_ptr error;
+		};
+
+		void parseWindow(
+			std::size_t start)
+		{
+			windowStart = start;
+			windowEnd = std::min(start + window.size(), input.size());
+			for (auto &parsed : window) {
+				parsed = ParsedFile();
+			}
+
+			// Thread t parses files t, t + jobs, t + 2 * jobs, ...
+			auto parseFiles = [&](std::size_t t) {
+				for (auto i = start + t; i < windowEnd; i += parsers.size()) {
+					auto &parsed = window[i - start];
+					try {
+						parsed.file = parsers[t]->parseFile(input[i]);
+					}
+					catch (...) {
+						parsed.error = std::current_exception();
+					}
+				}
+			};
+
+			std::vector<std::thread> threads;
+			for (std::size_t t = 1; t < parsers.size(); ++t) {
+				threads.emplace_back(parseFiles, t);
+			}
+			parseFiles(0);
+
+			for (auto &thread : threads) {
+				thread.join();
+			}
+		}
+
+	private:
+		const std::vector<std::string> &input; ///< Input files.
+		std::vector<std::unique_ptr<Yaramod>> parsers; ///< Parser per thread.
+		std::vector<ParsedFile> window; ///< Currently parsed files.
+		std::size_t windowStart = 0;    ///< Index of first parsed file.
+		std::size_t windowEnd = 0;      ///< Index after last parsed file.
+};
+
 } // anonymous namespace
 
 /**
@@ -159,12 +259,13 @@ void processFiles(
 	bool firstFile = true;
 	std::vector<std::unique_ptr<Rule>> rules;
 
-	Yaramod ym;
+	// Files are parsed in parallel, but processed in input order.
+	ParallelParser parser(options.input, options.jobs);
 
 	std::size_t counter = 0;
-	for (const auto &file : options.input) {
+	for (std::size_t i = 0; i < options.input.size(); ++i) {
 		// Parse file.
-		auto yaraFile = ym.parseFile(file);
+		auto yaraFile = parser.get(i);
 
 		// Add architecture info rule.
 		if (firstFile) {
@@ -39,6 +39,8 @@ struct ProcessingOptions
 		bool logOn = false;             ///< Log-file on/off.
 		std::vector<std::string> input; ///< Input files.
 
+		std::size_t jobs = 0; ///< Parser threads (0 for all processors).
+
 		bool validate(std::string &error);
 };
 
@@ -9,6 +9,7 @@
 #include <cstring>
 
 #include "retdec/pdbparser/pdb_file.h"
+#include "retdec/utils/mapped_file.h"
 
 using namespace std;
 
@@ -20,7 +21,20 @@ namespace pdbparser {
 // =================================================================
 
 /**
- * Loads PDB file into memory and separates all streams.
+ * Constructor
+ */
+PDBFile::PDBFile(void) :
+		pdb_loaded(false), pdb_initialized(false), pdb_filename(nullptr), pdb_version(0), page_size(0), pdb_file_size(
+		        0), pdb_file_data(
+		nullptr), num_streams(0), pdb_fpo_num(0), pdb_newfpo_num(0), pdb_sec_num(0), pdb_header(nullptr), pdb_root_dir(
+		nullptr), pdb_info_v700(nullptr), dbi_header_v700(nullptr), pdb_types(nullptr), pdb_symbols(nullptr)
+{
+}
+
+/**
+ * Maps PDB file into memory and separates all streams.
+ * Streams are only indexed here, non-linear streams are copied into linear
+ * memory when they are used for the first time.
  * Must be called before using of any method.
  * Can be called only once.
  * @param filename Name of PDB file to load.
@@ -31,22 +45,18 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 	if (pdb_loaded)
 		return PDB_STATE_ALREADY_LOADED;
 
-	// Load PDB file into memory
+	// Map PDB file into memory (read-only, streams are never modified)
 	pdb_filename = filename;
-	FILE *fp = fopen(filename,"rb");
-	if (fp == nullptr)
+	pdb_file_map = std::make_unique<retdec::utils::MappedFile>(filename);
+	if (!pdb_file_map->isOpen())
 	{
 		return PDB_STATE_ERR_FILE_OPEN;
 	}
-	fseek(fp, 0, SEEK_END);  // Determine file size
-	pdb_file_size = ftell(fp);
-	fseek(fp, 0, SEEK_SET);
-	pdb_file_data = new char[pdb_file_size]; // Allocate memory
-	size_t result = fread(pdb_file_data,1,pdb_file_size,fp); // Read the file
-	fclose(fp);
-	if (result != pdb_file_size)
+	pdb_file_size = pdb_file_map->getSize();
+	pdb_file_data = const_cast<char *>(reinterpret_cast<const char *>(pdb_file_map->getData()));
+	if (pdb_file_size < sizeof(PDB_HEADER))
 	{
-		return PDB_STATE_ERR_FILE_OPEN;
+		return PDB_STATE_INVALID_FILE;
 	}
 
 	// Get the version of PDB file and parse it
@@ -66,7 +76,7 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 		// Get pointer to PDB info header
 		if (streams.size() > PDB_STREAM_PDB)
 		{
-			pdb_info_v700 = reinterpret_cast<PDBInfo70 *>(streams[PDB_STREAM_PDB].data);
+			pdb_info_v700 = reinterpret_cast<PDBInfo70 *>(get_stream(PDB_STREAM_PDB)->data);
 		}
 		else
 		{
@@ -96,8 +106,8 @@ void PDBFile::initialize(int image_base)
 	}
 
 	// Initialize types
-	pdb_types = new PDBTypes(&streams[PDB_STREAM_TPI]);
-	pdb_types->parse_types();
+	pdb_types = new PDBTypes(get_stream(PDB_STREAM_TPI));
+	pdb_types->index_types();
 
 	// Check if DBI stream is present
 	bool dbi_present = (num_streams > PDB_STREAM_DBI && streams[PDB_STREAM_DBI].unused == false);
@@ -105,8 +115,8 @@ void PDBFile::initialize(int image_base)
 	if (dbi_present)
 	{
 		// Get DBI stream
-		unsigned int pdb_dbi_size = streams[PDB_STREAM_DBI].size;
-		char * pdb_dbi_data = streams[PDB_STREAM_DBI].data;
+		unsigned int pdb_dbi_size = get_stream(PDB_STREAM_DBI)->size;
+		char * pdb_dbi_data = get_stream(PDB_STREAM_DBI)->data;
 
 		// Get pointer to DBI header
 		dbi_header_v700 = reinterpret_cast<NewDBIHdr *>(pdb_dbi_data);
@@ -129,7 +139,7 @@ void PDBFile::initialize(int image_base)
 		int pdb_gsi_num = dbi_header_v700->snGSSyms;
 		int pdb_psi_num = dbi_header_v700->snPSSyms;
 		int pdb_sym_num = dbi_header_v700->snSymRecs;
-		pdb_symbols = new PDBSymbols(&streams[pdb_gsi_num],&streams[pdb_psi_num],&streams[pdb_sym_num],modules,sections,pdb_types);
+		pdb_symbols = new PDBSymbols(get_stream(pdb_gsi_num),get_stream(pdb_psi_num),get_stream(pdb_sym_num),modules,sections,pdb_types);
 		pdb_symbols->parse_symbols();
 	}
 	pdb_initialized = true;
@@ -154,12 +164,27 @@ bool PDBFile::save_streams_to_files(void)
 		if (fs == nullptr)
 			return false;
 		if (!streams[i].unused)
-			fwrite(streams[i].data,1,streams[i].size,fs);
+			fwrite(get_stream(i)->data,1,streams[i].size,fs);
 		fclose(fs);
 	}
 	return true;
 }
 
+/**
+ * Returns stream with given number, non-linear stream is copied into linear
+ * memory if it was not used yet.
+ * Can be called after load_pdb_file() was executed
+ * @param num Stream number
+ * @return Stream or nullptr if there is no such stream
+ */
+PDBStream * PDBFile::get_stream(unsigned int num)
+{
+	if (num >= num_streams)
+		return nullptr;
+	load_stream(num);
+	return &streams[num];
+}
+
 /**
  * Prints basic PDB file information and list of streams
  * Can be called after load_pdb_file() was executed
@@ -240,7 +265,7 @@ void PDBFile::dump_FPO(void)
 		return;
 	}
 
-	PDBStream *pdb_fpo_stream = &streams[pdb_fpo_num];
+	PDBStream *pdb_fpo_stream = get_stream(pdb_fpo_num);
 	int fpoSize = pdb_fpo_stream->size;
 	PDB_FPO_DATA *fpo = reinterpret_cast<PDB_FPO_DATA *>(pdb_fpo_stream->data);
 
@@ -282,7 +307,7 @@ void PDBFile::dump_PE_sections(void)
 		return;
 	}
 
-	PDBStream *pdb_sect_stream = &streams[pdb_sec_num];
+	PDBStream *pdb_sect_stream = get_stream(pdb_sec_num);
 	PDB_PVOID pSect = pdb_sect_stream->data;
 	unsigned long sectSize = pdb_sect_stream->size;
 
@@ -305,9 +330,7 @@ void PDBFile::dump_PE_sections(void)
  */
 PDBFile::~PDBFile()
 {
-	if (pdb_file_data)
-		delete [] pdb_file_data;
-	// Delete all non-linear (copied) streams
+	// Delete all non-linear (copied) streams, the file itself is unmapped by pdb_file_map
 	for (unsigned int i = 0; i < num_streams;i++)
 		if (!streams[i].unused && !streams[i].linear)
 			delete [] streams[i].data;
@@ -353,6 +376,19 @@ char *PDBFile::extract_stream(PDB_DWORD *pages, int num_pages)
 	return stream_data;
 }
 
+/**
+ * Copies non-linear stream into linear memory if it was not copied yet.
+ * @param num Stream number
+ */
+void PDBFile::load_stream(unsigned int num)
+{
+	PDBStream &stream = streams[num];
+	if (stream.unused || stream.linear || stream.data != nullptr)
+		return;
+	int pages_per_stream = (stream.size + page_size - 1) / page_size;
+	stream.data = extract_stream(stream.pages, pages_per_stream);
+}
+
 /**
  * Separates all streams from PDB file version 2.00.
  * Vector "streams" is filled here.
@@ -396,7 +432,7 @@ PDBFileState PDBFile::load_pdb_v700(void)
 	streams.resize(num_streams);
 	int cur_pagedir_index = num_streams + 0;  // Skip dwords with stream sizes
 
-	// Extract each stream
+	// Index each stream
 	for (unsigned int i = 0; i < num_streams;i++)
 	{
 		streams[i].size = pdb_root_dir->V700.adStreamSizes[i];
@@ -406,22 +442,24 @@ PDBFileState PDBFile::load_pdb_v700(void)
 			streams[i].unused = true;
 			streams[i].linear = false;
 			streams[i].data = nullptr;
+			streams[i].pages = nullptr;
 		}
 		// Stream is not empty
 		else
 		{
 			streams[i].unused = false;
 			int pages_per_stream = (streams[i].size + page_size - 1) / page_size;
+			streams[i].pages = &pdb_root_dir->V700.adStreamSizes[cur_pagedir_index];
 			// Stream is linear in pdb file, we just get a pointer to it
-			if (stream_is_linear(&pdb_root_dir->V700.adStreamSizes[cur_pagedir_index], pages_per_stream))
+			if (stream_is_linear(streams[i].pages, pages_per_stream))
 			{
-				streams[i].data = pdb_file_data + pdb_root_dir->V700.adStreamSizes[cur_pagedir_index] * page_size;
+				streams[i].data = pdb_file_data + streams[i].pages[0] * page_size;
 				streams[i].linear = true;
 			}
-			// Stream is not linear in pdb file, we must copy it to linear memory
+			// Stream is not linear in pdb file, it is copied to linear memory when it is used (see load_stream())
 			else
 			{
-				streams[i].data = extract_stream(&pdb_root_dir->V700.adStreamSizes[cur_pagedir_index], pages_per_stream);
+				streams[i].data = nullptr;
 				streams[i].linear = false;
 			}
 			cur_pagedir_index += pages_per_stream;  // Increase index to next stream
@@ -437,7 +475,7 @@ PDBFileState PDBFile::load_pdb_v700(void)
 void PDBFile::parse_modules(void)
 {
 	// Get DBI stream size and data
-	PDBStream * pdb_dbi_stream = &streams[PDB_STREAM_DBI];
+	PDBStream * pdb_dbi_stream = get_stream(PDB_STREAM_DBI);
 	unsigned int pdb_dbi_size = pdb_dbi_stream->size;
 	char * pdb_dbi_data = pdb_dbi_stream->data;
 
@@ -473,7 +511,7 @@ void PDBFile::parse_modules(void)
 		}
 
 		// Add module into vector
-		PDBStream *s = (entry->sn == 0xffff)?nullptr:&streams[entry->sn]; // Get module stream
+		PDBStream *s = (entry->sn == 0xffff)?nullptr:get_stream(entry->sn); // Get module stream
 		PDBModule new_module =
 		{
 			reinterpret_cast<char *>(entry->rgch),  // name
@@ -497,7 +535,7 @@ void PDBFile::parse_sections(int image_base)
 		return;
 
 	// Get stream with section info
-	PDBStream * pdb_sect_stream = &streams[pdb_sec_num];
+	PDBStream * pdb_sect_stream = get_stream(pdb_sec_num);
 	unsigned int pdb_sect_size = pdb_sect_stream->size;
 	char * pdb_sect_data = pdb_sect_stream->data;
 
@@ -76,7 +76,7 @@ std::string PDBTypeBase::to_llvm(void)
 //
 // =================================================================
 
-void PDBTypeFieldList::parse(lfFieldList *record, int size, PDBTypeDefIndexMap &types)
+void PDBTypeFieldList::parse(lfFieldList *record, int size, PDBTypes &types)
 {
 	int position = 0;
 	while (position < size - 2)
@@ -113,7 +113,7 @@ void PDBTypeFieldList::parse(lfFieldList *record, int size, PDBTypeDefIndexMap &
 				new_field.field_type = PDBFIELD_MEMBER;
 				// Get type of struct member
 				new_field.Member.type_index = subrecord->Member.index;
-				new_field.Member.type_def = types[subrecord->Member.index];
+				new_field.Member.type_def = types.get_type_by_index(subrecord->Member.index);
 				// Get offset and name of struct member
 				int value;
 				char * name;
@@ -168,19 +168,19 @@ void PDBTypeFieldList::dump(bool nested)
 //
 // =================================================================
 
-void PDBTypeEnum::parse(lfEnum *record, int, PDBTypeDefIndexMap &types)
+void PDBTypeEnum::parse(lfEnum *record, int, PDBTypes &types)
 {
 	// Copy member count and name
 	enum_count = record->count;
 	enum_name = reinterpret_cast<char *>(record->Name);
 	// Get enum size in bytes by underlying type
-	if (record->utype > 0 && types[record->utype] != nullptr)
-		size_bytes = types[record->utype]->size_bytes;
+	if (record->utype > 0 && types.get_type_by_index(record->utype) != nullptr)
+		size_bytes = types.get_type_by_index(record->utype)->size_bytes;
 	// Fill the array of pointers to enum members
-	if (record->field > 0 && types[record->field] != nullptr)
+	if (record->field > 0 && types.get_type_by_index(record->field) != nullptr)
 	{
 		// Get the type definition with field list
-		PDBTypeFieldList * fieldlist = reinterpret_cast<PDBTypeFieldList *>(types[record->field]);
+		PDBTypeFieldList * fieldlist = reinterpret_cast<PDBTypeFieldList *>(types.get_type_by_index(record->field));
 		if (fieldlist->fields.size() != enum_count)
 		{
 			return;
@@ -226,14 +226,14 @@ std::string PDBTypeEnum::to_llvm(void)
 //
 // =================================================================
 
-void PDBTypeArray::parse(lfArray *record, int, PDBTypeDefIndexMap &types)
+void PDBTypeArray::parse(lfArray *record, int, PDBTypes &types)
 {
 	// Get element type
 	array_elemtype_index = record->elemtype;
-	array_elemtype_def = types[array_elemtype_index];
+	array_elemtype_def = types.get_type_by_index(array_elemtype_index);
 	// Get indexing type
 	array_idxtype_index = record->idxtype;
-	array_idxtype_def = types[array_idxtype_index];
+	array_idxtype_def = types.get_type_by_index(array_idxtype_index);
 	// Get size of the array
 	int value;
 	RecordValue(record->data, reinterpret_cast<PDB_DWORD *>(&value));
@@ -273,11 +273,11 @@ std::string PDBTypeArray::to_llvm(void)
 //
 // =================================================================
 
-void PDBTypePointer::parse(lfPointer *record, int, PDBTypeDefIndexMap &types)
+void PDBTypePointer::parse(lfPointer *record, int, PDBTypes &types)
 {
 	// Get underlying type
 	ptr_utype_index = record->body.utype;
-	ptr_utype_def = types[ptr_utype_index];
+	ptr_utype_def = types.get_type_by_index(ptr_utype_index);
 	// TODO pointer type and const pointer
 	size_bytes = 4;
 }
@@ -312,10 +312,10 @@ std::string PDBTypePointer::to_llvm(void)
 //
 // =================================================================
 
-void PDBTypeConst::parse(lfModifier *record, int, PDBTypeDefIndexMap &types)
+void PDBTypeConst::parse(lfModifier *record, int, PDBTypes &types)
 {
 	const_utype_index = record->utype;
-	const_utype_def = types[record->utype];
+	const_utype_def = types.get_type_by_index(record->utype);
 	if (const_utype_def != nullptr)
 		size_bytes = const_utype_def->size_bytes;
 }
@@ -343,16 +343,16 @@ std::string PDBTypeConst::to_llvm(void)
 //
 // =================================================================
 
-void PDBTypeFunction::parse(lfProc *record, int, PDBTypeDefIndexMap &types)
+void PDBTypeFunction::parse(lfProc *record, int, PDBTypes &types)
 {
 	// Get function return value type
 	func_rettype_index = record->rvtype;
-	func_rettype_def = types[record->rvtype];
+	func_rettype_def = types.get_type_by_index(record->rvtype);
 	// Get calling convention
 	func_calltype = record->calltype;
 	// Get list of arguments
 	func_args_count = record->parmcount;
-	PDBTypeArglist * arglisttypedef = reinterpret_cast<PDBTypeArglist *>(types[record->arglist]);  // Get auxiliary type definition containing arglist
+	PDBTypeArglist * arglisttypedef = reinterpret_cast<PDBTypeArglist *>(types.get_type_by_index(record->arglist));  // Get auxiliary type definition containing arglist
 	if (arglisttypedef != nullptr)
 	{
 		assert(arglisttypedef->type_class == PDBTYPE_ARGLIST);
@@ -365,7 +365,7 @@ void PDBTypeFunction::parse(lfProc *record, int, PDBTypeDefIndexMap &types)
 		for (int i = 0; i < func_args_count; i++)
 		{  // Process all arguments
 			func_args[i].type_index = arglist->arg[i];
-			func_args[i].type_def = types[arglist->arg[i]];
+			func_args[i].type_def = types.get_type_by_index(arglist->arg[i]);
 		}
 		// Check if function is variadic
 		if (func_args_count > 0 && func_args[func_args_count - 1].type_index == T_NOTYPE)
@@ -376,16 +376,16 @@ void PDBTypeFunction::parse(lfProc *record, int, PDBTypeDefIndexMap &types)
 	func_thistype_index = 0;
 }
 
-void PDBTypeFunction::parse_mfunc(lfMFunc *record, int, PDBTypeDefIndexMap &types)
+void PDBTypeFunction::parse_mfunc(lfMFunc *record, int, PDBTypes &types)
 {
 	// Get function return value type
 	func_rettype_index = record->rvtype;
-	func_rettype_def = types[record->rvtype];
+	func_rettype_def = types.get_type_by_index(record->rvtype);
 	// Get calling convention
 	func_calltype = record->calltype;
 	// Get list of arguments
 	func_args_count = record->parmcount;
-	PDBTypeArglist * arglisttypedef = reinterpret_cast<PDBTypeArglist *>(types[record->arglist]);  // Get auxiliary type definition containing arglist
+	PDBTypeArglist * arglisttypedef = reinterpret_cast<PDBTypeArglist *>(types.get_type_by_index(record->arglist));  // Get auxiliary type definition containing arglist
 	if (arglisttypedef != nullptr)
 	{
 		assert(arglisttypedef->type_class == PDBTYPE_ARGLIST);
@@ -398,15 +398,15 @@ void PDBTypeFunction::parse_mfunc(lfMFunc *record, int, PDBTypeDefIndexMap &type
 		for (int i = 0; i < func_args_count; i++)
 		{  // Process all arguments
 			func_args[i].type_index = arglist->arg[i];
-			func_args[i].type_def = types[arglist->arg[i]];
+			func_args[i].type_def = types.get_type_by_index(arglist->arg[i]);
 		}
 	}
 	// Get function parent class and this-parameter type
 	func_is_clsmember = true;
 	func_clstype_index = record->classtype;
-	func_clstype_def = types[record->classtype];
+	func_clstype_def = types.get_type_by_index(record->classtype);
 	func_thistype_index = record->thistype;
-	func_thistype_def = (func_thistype_index) ? types[record->thistype] : nullptr;
+	func_thistype_def = (func_thistype_index) ? types.get_type_by_index(record->thistype) : nullptr;
 }
 
 void PDBTypeFunction::dump(bool nested)
@@ -469,7 +469,7 @@ std::string PDBTypeFunction::to_llvm(void)
 //
 // =================================================================
 
-void PDBTypeStruct::parse(lfStructure *record, int, PDBTypeDefIndexMap &types)
+void PDBTypeStruct::parse(lfStructure *record, int, PDBTypes &types)
 {
 	// Get member count
 	struct_count = record->count;
@@ -481,10 +481,10 @@ void PDBTypeStruct::parse(lfStructure *record, int, PDBTypeDefIndexMap &types)
 	if (name)
 		struct_name = name;
 	// Copy struct members
-	if (record->field > 0 && types[record->field] != nullptr)
+	if (record->field > 0 && types.get_type_by_index(record->field) != nullptr)
 	{
 		// Get field list with struct members
-		PDBTypeFieldList * fieldlist = reinterpret_cast<PDBTypeFieldList *>(types[record->field]);
+		PDBTypeFieldList * fieldlist = reinterpret_cast<PDBTypeFieldList *>(types.get_type_by_index(record->field));
 		// Copy all members from field list
 		for (unsigned int i = 0; i < fieldlist->fields.size(); i++)
 		{  // Copy pointers to struct members from field list
@@ -562,7 +562,7 @@ std::string PDBTypeStruct::to_llvm_identified(void)
 //
 // =================================================================
 
-void PDBTypeUnion::parse(lfUnion *record, int, PDBTypeDefIndexMap &types)
+void PDBTypeUnion::parse(lfUnion *record, int, PDBTypes &types)
 {
 	// Copy member count
 	union_count = record->count;
@@ -573,10 +573,10 @@ void PDBTypeUnion::parse(lfUnion *record, int, PDBTypeDefIndexMap &types)
 	size_bytes = value;
 	union_name = name;
 	// Copy union members
-	if (record->field > 0 && types[record->field] != nullptr)
+	if (record->field > 0 && types.get_type_by_index(record->field) != nullptr)
 	{
 		// Get field list with union members
-		PDBTypeFieldList * fieldlist = reinterpret_cast<PDBTypeFieldList *>(types[record->field]);
+		PDBTypeFieldList * fieldlist = reinterpret_cast<PDBTypeFieldList *>(types.get_type_by_index(record->field));
 		// Copy all members from field list
 		for (unsigned int i = 0; i < fieldlist->fields.size(); i++)
 		{  // Copy pointers to struct members from field list
@@ -622,7 +622,7 @@ std::string PDBTypeUnion::to_llvm(void)
 //
 // =================================================================
 
-void PDBTypeClass::parse(lfClass *record, int, PDBTypeDefIndexMap &)
+void PDBTypeClass::parse(lfClass *record, int, PDBTypes &)
 {
 	// Copy member count
 	class_count = record->count;
@@ -1067,9 +1067,13 @@ bool DisplayTypes(char * ptSource, int ptSize)
 // PUBLIC METHODS
 // =================================================================
 
-void PDBTypes::parse_types(void)
+/**
+ * Registers base types and finds offsets of all type records in TPI stream.
+ * User-defined types are parsed later, when they are asked for.
+ */
+void PDBTypes::index_types(void)
 {
-	if (parsed)
+	if (indexed)
 		return;
 	// Base types
 	types[T_NOTYPE] = new PDBTypeBase(0x00000000, PDBBASETYPE_VARIADIC, false, 0, "...");
@@ -1137,119 +1141,185 @@ void PDBTypes::parse_types(void)
 
 	// User-defined types
 	unsigned int position = sizeof(HDR);
-	int index = tpi_header->tiMin;
-	while (position < pdb_tpi_size)
-	{  // Process all data-type records in TPI stream
+	while (position + sizeof(PDBGeneralSymbol) <= pdb_tpi_size)
+	{  // Find all data-type records in TPI stream
 		PDBGeneralSymbol * symbol = reinterpret_cast<PDBGeneralSymbol *>(pdb_tpi_data + position);
-		lfRecord * record = reinterpret_cast<lfRecord *>(pdb_tpi_data + position + 2);
+		type_offsets.push_back(position);
+		position += symbol->size + 2;  // Go to next record
+	}
+	type_parsed.assign(type_offsets.size(), false);
+	indexed = true;
+}
+
+/**
+ * Parses all user-defined types in TPI stream.
+ */
+void PDBTypes::parse_types(void)
+{
+	if (parsed)
+		return;
+	index_types();
+	for (unsigned int i = 0; i < type_offsets.size(); i++)
+		parse_type(tpi_header->tiMin + i);
+	parsed = true;
+}
 
-		switch (record->leaf)
+/**
+ * Returns type definition with given index, user-defined types are parsed
+ * on the first use.
+ */
+PDBTypeDef * PDBTypes::get_type_by_index(int index)
+{
+	if (!indexed)
+		return nullptr;
+	unsigned int i = index - tpi_header->tiMin;
+	if (index < static_cast<int>(tpi_header->tiMin) || i >= type_offsets.size())
+	{  // Base type
+		PDBTypeDefIndexMap::iterator it = types.find(index);
+		return (it != types.end()) ? it->second : nullptr;
+	}
+	if (index >= parsing_index)
+		return nullptr;  // Types can refer only to preceding types
+	return parse_type(index);
+}
+
+/**
+ * Parses user-defined type with given index (if not parsed yet).
+ */
+PDBTypeDef * PDBTypes::parse_type(int index)
+{
+	unsigned int i = index - tpi_header->tiMin;
+	if (type_parsed[i])
+	{
+		PDBTypeDefIndexMap::iterator it = types.find(index);
+		return (it != types.end()) ? it->second : nullptr;
+	}
+	type_parsed[i] = true;
+
+	int parent_index = parsing_index;
+	parsing_index = index;
+
+	unsigned int position = type_offsets[i];
+	PDBGeneralSymbol * symbol = reinterpret_cast<PDBGeneralSymbol *>(pdb_tpi_data + position);
+	lfRecord * record = reinterpret_cast<lfRecord *>(pdb_tpi_data + position + 2);
+	PDBTypeDef * result = nullptr;
+
+	switch (record->leaf)
+	{
+		case LF_FIELDLIST:
 		{
-			case LF_FIELDLIST:
-			{
-				PDBTypeFieldList *new_type = new PDBTypeFieldList(index);
-				new_type->parse(&record->FieldList, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_ENUM:
-			{
-				PDBTypeEnum *new_type = new PDBTypeEnum(index);
-				new_type->parse(&record->Enum, symbol->size, types);
-				types[index] = new_type;
-				if (new_type->is_fully_defined())
-				{
-					types_fully_defined[index] = new_type;
-					types_byname[new_type->enum_name] = new_type;
-				}
-				break;
-			}
-			case LF_ARRAY:
-			{
-				PDBTypeArray *new_type = new PDBTypeArray(index);
-				new_type->parse(&record->Array, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_POINTER:
-			{
-				PDBTypePointer *new_type = new PDBTypePointer(index);
-				new_type->parse(&record->Pointer, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_MODIFIER:
-			{
-				PDBTypeConst *new_type = new PDBTypeConst(index);
-				new_type->parse(&record->Modifier, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_ARGLIST:
-			{
-				PDBTypeArglist *new_type = new PDBTypeArglist(index);
-				new_type->parse(&record->ArgList, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_PROCEDURE:
-			{
-				PDBTypeFunction *new_type = new PDBTypeFunction(index);
-				new_type->parse(&record->Proc, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_MFUNCTION:
+			PDBTypeFieldList *new_type = new PDBTypeFieldList(index);
+			new_type->parse(&record->FieldList, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			break;
+		}
+		case LF_ENUM:
+		{
+			PDBTypeEnum *new_type = new PDBTypeEnum(index);
+			new_type->parse(&record->Enum, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			if (new_type->is_fully_defined())
 			{
-				PDBTypeFunction *new_type = new PDBTypeFunction(index);
-				new_type->parse_mfunc(&record->MFunc, symbol->size, types);
-				types[index] = new_type;
-				break;
+				types_fully_defined[index] = new_type;
+				types_byname[new_type->enum_name] = new_type;
 			}
-			case LF_STRUCTURE:
+			break;
+		}
+		case LF_ARRAY:
+		{
+			PDBTypeArray *new_type = new PDBTypeArray(index);
+			new_type->parse(&record->Array, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			break;
+		}
+		case LF_POINTER:
+		{
+			PDBTypePointer *new_type = new PDBTypePointer(index);
+			new_type->parse(&record->Pointer, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			break;
+		}
+		case LF_MODIFIER:
+		{
+			PDBTypeConst *new_type = new PDBTypeConst(index);
+			new_type->parse(&record->Modifier, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			break;
+		}
+		case LF_ARGLIST:
+		{
+			PDBTypeArglist *new_type = new PDBTypeArglist(index);
+			new_type->parse(&record->ArgList, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			break;
+		}
+		case LF_PROCEDURE:
+		{
+			PDBTypeFunction *new_type = new PDBTypeFunction(index);
+			new_type->parse(&record->Proc, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			break;
+		}
+		case LF_MFUNCTION:
+		{
+			PDBTypeFunction *new_type = new PDBTypeFunction(index);
+			new_type->parse_mfunc(&record->MFunc, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			break;
+		}
+		case LF_STRUCTURE:
+		{
+			PDBTypeStruct *new_type = new PDBTypeStruct(index);
+			new_type->parse(&record->Structure, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			if (new_type->is_fully_defined())
 			{
-				PDBTypeStruct *new_type = new PDBTypeStruct(index);
-				new_type->parse(&record->Structure, symbol->size, types);
-				types[index] = new_type;
-				if (new_type->is_fully_defined())
-				{
-					types_fully_defined[index] = new_type;
-					types_byname[new_type->struct_name] = new_type;
-				}
-				break;
+				types_fully_defined[index] = new_type;
+				types_byname[new_type->struct_name] = new_type;
 			}
-			case LF_UNION:
+			break;
+		}
+		case LF_UNION:
+		{
+			PDBTypeUnion *new_type = new PDBTypeUnion(index);
+			new_type->parse(&record->Union, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			if (new_type->is_fully_defined())
 			{
-				PDBTypeUnion *new_type = new PDBTypeUnion(index);
-				new_type->parse(&record->Union, symbol->size, types);
-				types[index] = new_type;
-				if (new_type->is_fully_defined())
-				{
-					types_fully_defined[index] = new_type;
-					types_byname[new_type->union_name] = new_type;
-				}
-				break;
+				types_fully_defined[index] = new_type;
+				types_byname[new_type->union_name] = new_type;
 			}
-			case LF_CLASS:
+			break;
+		}
+		case LF_CLASS:
+		{
+			PDBTypeClass *new_type = new PDBTypeClass(index);
+			new_type->parse(&record->Class, symbol->size, *this);
+			types[index] = new_type;
+			result = new_type;
+			if (new_type->is_fully_defined())
 			{
-				PDBTypeClass *new_type = new PDBTypeClass(index);
-				new_type->parse(&record->Class, symbol->size, types);
-				types[index] = new_type;
-				if (new_type->is_fully_defined())
-				{
-					types_fully_defined[index] = new_type;
-					types_byname[new_type->class_name] = new_type;
-				}
-				break;
+				types_fully_defined[index] = new_type;
+				types_byname[new_type->class_name] = new_type;
 			}
-			default:
-				break;
+			break;
 		}
-
-		position += symbol->size + 2;  // Go to next record
-		index++;
+		default:
+			break;
 	}
-	parsed = true;
+
+	parsing_index = parent_index;
+	return result;
 }
 
 void PDBTypes::dump_types(void)
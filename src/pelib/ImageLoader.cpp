@@ -8,6 +8,7 @@
 #include <fstream>
 
 #include "retdec/pelib/ImageLoader.h"
+#include "retdec/utils/mapped_file.h"
 
 //-----------------------------------------------------------------------------
 // Anti-headache
@@ -44,6 +45,8 @@ uint8_t PeLib::ImageLoader::ImageProtectionArray[16] =
 	PELIB_PAGE_EXECUTE_READWRITE
 };
 
+const uint8_t PeLib::PELIB_FILE_PAGE::zeroPage[PELIB_PAGE_SIZE] = {0};
+
 //-----------------------------------------------------------------------------
 // Constructor and destructor
 
@@ -210,10 +213,10 @@ uint32_t PeLib::ImageLoader::stringLength(
 					const uint8_t * dataPtr;
 					uint32_t rvaEndPage = (pageIndex + 1) * PELIB_PAGE_SIZE;
 
-					// If zero page, means this is a zeroed page. This is the end of the string.
-					if(page.buffer.empty())
+					// If invalid page, this is the end of the string. Zero pages end it by their content
+					if(page.getData() == nullptr)
 						break;
-					dataBegin = dataPtr = page.buffer.data() + (rva & (PELIB_PAGE_SIZE - 1));
+					dataBegin = dataPtr = page.getData() + (rva & (PELIB_PAGE_SIZE - 1));
 
 					// Perhaps the last page loaded?
 					if(rvaEndPage > rvaEnd)
@@ -334,7 +337,7 @@ uint32_t PeLib::ImageLoader::readStringRc(
 }
 
 uint32_t PeLib::ImageLoader::readStringRaw(
-	ByteBuffer & fileData,
+	const PELIB_FILE_DATA & fileData,
 	std::string & str,
 	size_t offset,
 	size_t maxLength,
@@ -345,8 +348,8 @@ uint32_t PeLib::ImageLoader::readStringRaw(
 
 	if(offset < fileData.size())
 	{
-		uint8_t * stringBegin = fileData.data() + offset;
-		uint8_t * stringEnd;
+		const uint8_t * stringBegin = fileData.data() + offset;
+		const uint8_t * stringEnd;
 
 		// Make sure we won't read past the end of the buffer
 		if((offset + maxLength) > fileData.size())
@@ -355,7 +358,7 @@ uint32_t PeLib::ImageLoader::readStringRaw(
 		// Get the length of the string. Do not go beyond the maximum length
 		// Note that there is no guaratee that the string is zero terminated, so can't use strlen
 		// retdec-regression-tests\tools\fileinfo\bugs\issue-451-strange-section-names\4383fe67fec6ea6e44d2c7d075b9693610817edc68e8b2a76b2246b53b9186a1-unpacked
-		stringEnd = (uint8_t *)memchr(stringBegin, 0, maxLength);
+		stringEnd = (const uint8_t *)memchr(stringBegin, 0, maxLength);
 		if(stringEnd == nullptr)
 		{
 			// No zero terminator means that the string is limited by max length
@@ -394,14 +397,12 @@ uint32_t PeLib::ImageLoader::dumpImage(const char * fileName)
 
 	if(fs.is_open())
 	{
-		// Allocate one page filled with zeros
-		uint8_t zeroPage[PELIB_PAGE_SIZE] = {0};
-		char * dataToWrite;
+		const char * dataToWrite;
 
 		// Write each page to the file
 		for(auto & page : pages)
 		{
-			dataToWrite = (char *)(page.buffer.size() ? page.buffer.data() : zeroPage);
+			dataToWrite = (const char *)(page.getData() ? page.getData() : PELIB_FILE_PAGE::zeroPage);
 			fs.write(dataToWrite, PELIB_PAGE_SIZE);
 			bytesWritten += PELIB_PAGE_SIZE;
 		}
@@ -847,53 +848,15 @@ PeLib::LoaderError PeLib::ImageLoader::loaderError() const
 // Interface for loading files
 
 int PeLib::ImageLoader::Load(
-	ByteBuffer & fileData,
-	bool loadHeadersOnly)
+	const ByteBuffer & fileData,
+	bool loadHeadersOnly,
+	bool shareFileData)
 {
-	int fileError;
-
-	// Check and capture DOS header
-	fileError = captureDosHeader(fileData);
-	if(fileError != ERROR_NONE)
-		return fileError;
+	// If the data are shared, the caller must keep them unchanged for the lifetime of the loader.
+	// Otherwise, the mapped pages get their own copy of the data
+	PELIB_FILE_DATA fileView{nullptr, fileData.data(), fileData.size(), shareFileData};
 
-	// Check and capture NT headers
-	fileError = captureNtHeaders(fileData);
-	if(fileError != ERROR_NONE)
-		return fileError;
-
-	// Check and capture section headers
-	fileError = captureSectionHeaders(fileData);
-	if(fileError != ERROR_NONE)
-		return fileError;
-
-	// Shall we map the image content?
-	if(loadHeadersOnly == false)
-	{
-		// Large amount of memory may be allocated during loading the image to memory.
-		// We need to handle low memory condition carefully here
-		try
-		{
-			// If there was no detected image error, map the image as if Windows loader would do
-			if(isImageLoadable())
-			{
-				fileError = captureImageSections(fileData);
-			}
-
-			// If there was any kind of error that prevents the image from being mapped,
-			// we load the content as-is and translate virtual addresses using getFileOffsetFromRva
-			if(pages.size() == 0)
-			{
-				fileError = loadImageAsIs(fileData);
-			}
-		}
-		catch(const std::bad_alloc&)
-		{
-			fileError = ERROR_NOT_ENOUGH_SPACE;
-		}
-	}
-
-	return fileError;
+	return loadFileData(fileView, loadHeadersOnly);
 }
 
 int PeLib::ImageLoader::Load(
@@ -901,7 +864,7 @@ int PeLib::ImageLoader::Load(
 	std::streamoff fileOffset,
 	bool loadHeadersOnly)
 {
-	ByteBuffer fileData;
+	std::shared_ptr<ByteBuffer> fileData;
 	std::streampos fileSize;
 	size_t fileSize2;
 	int fileError;
@@ -932,7 +895,7 @@ int PeLib::ImageLoader::Load(
 	// potentially allocate a very large memory block, so we need to handle that carefully
 	try
 	{
-		fileData.resize(fileSize2);
+		fileData = std::make_shared<ByteBuffer>(fileSize2);
 	}
 	catch(const std::bad_alloc&)
 	{
@@ -944,25 +907,42 @@ int PeLib::ImageLoader::Load(
 	// can fail on low memory. When that happens, fs.read will read less than
 	// required. We need to verify the number of bytes read and return the apropriate error code.
 	fs.seekg(fileOffset);
-	fs.read(reinterpret_cast<char*>(fileData.data()), fileSize2);
+	fs.read(reinterpret_cast<char*>(fileData->data()), fileSize2);
 	if(fs.gcount() < (fileSize - fileOffset))
 	{
 		return ERROR_NOT_ENOUGH_SPACE;
 	}
 
-	// Call the Load interface on char buffer
-	return Load(fileData, loadHeadersOnly);
+	// Load the image from the buffer. The mapped pages keep the buffer alive
+	PELIB_FILE_DATA fileView{fileData, fileData->data(), fileData->size(), true};
+	return loadFileData(fileView, loadHeadersOnly);
 }
 
 int PeLib::ImageLoader::Load(
 	const char * fileName,
 	bool loadHeadersOnly)
 {
-	std::ifstream fs(fileName, std::ifstream::in | std::ifstream::binary);
-	if(!fs.is_open())
+	std::shared_ptr<retdec::utils::MappedFile> mappedFile;
+
+	try
+	{
+		mappedFile = std::make_shared<retdec::utils::MappedFile>(fileName);
+	}
+	catch(const std::bad_alloc&)
+	{
+		return ERROR_NOT_ENOUGH_SPACE;
+	}
+
+	if(!mappedFile->isOpen())
 		return ERROR_OPENING_FILE;
 
-	return Load(fs, loadHeadersOnly);
+	// Windows loader refuses to load any file which is larger than 0xFFFFFFFF
+	if((static_cast<std::uint64_t>(mappedFile->getSize()) >> 32) != 0)
+		return setLoaderError(LDR_ERROR_FILE_TOO_BIG);
+
+	// Load the image from the mapped file. The mapped pages keep the file mapped
+	PELIB_FILE_DATA fileView{mappedFile, mappedFile->getData(), mappedFile->getSize(), true};
+	return loadFileData(fileView, loadHeadersOnly);
 }
 
 //-----------------------------------------------------------------------------
@@ -1036,16 +1016,66 @@ int PeLib::ImageLoader::Save(
 //-----------------------------------------------------------------------------
 // Protected functions
 
+int PeLib::ImageLoader::loadFileData(
+	const PELIB_FILE_DATA & fileData,
+	bool loadHeadersOnly)
+{
+	int fileError;
+
+	// Check and capture DOS header
+	fileError = captureDosHeader(fileData);
+	if(fileError != ERROR_NONE)
+		return fileError;
+
+	// Check and capture NT headers
+	fileError = captureNtHeaders(fileData);
+	if(fileError != ERROR_NONE)
+		return fileError;
+
+	// Check and capture section headers
+	fileError = captureSectionHeaders(fileData);
+	if(fileError != ERROR_NONE)
+		return fileError;
+
+	// Shall we map the image content?
+	if(loadHeadersOnly == false)
+	{
+		// Large amount of memory may be allocated during loading the image to memory.
+		// We need to handle low memory condition carefully here
+		try
+		{
+			// If there was no detected image error, map the image as if Windows loader would do
+			if(isImageLoadable())
+			{
+				fileError = captureImageSections(fileData);
+			}
+
+			// If there was any kind of error that prevents the image from being mapped,
+			// we load the content as-is and translate virtual addresses using getFileOffsetFromRva
+			if(pages.size() == 0)
+			{
+				fileError = loadImageAsIs(fileData);
+			}
+		}
+		catch(const std::bad_alloc&)
+		{
+			fileError = ERROR_NOT_ENOUGH_SPACE;
+		}
+	}
+
+	return fileError;
+}
+
 void PeLib::ImageLoader::readFromPage(
 	PELIB_FILE_PAGE & page,
 	void * buffer,
 	size_t offsetInPage,
 	size_t bytesInPage)
 {
-	// Is it a page with actual data?
-	if(page.buffer.size())
+	// Is it a page with actual data? Invalid pages read as zeros
+	if(page.getData() != nullptr)
 	{
-		memcpy(buffer, page.buffer.data() + offsetInPage, bytesInPage);
+		memcpy(buffer, page.getData() + offsetInPage, bytesInPage);
 	}
 	else
 	{
@@ -1515,10 +1545,10 @@ void PeLib::ImageLoader::writeNewImageBase(uint64_t newImageBase)
 	}
 }
 
-int PeLib::ImageLoader::captureDosHeader(ByteBuffer & fileData)
+int PeLib::ImageLoader::captureDosHeader(const PELIB_FILE_DATA & fileData)
 {
-	uint8_t * fileBegin = fileData.data();
-	uint8_t * fileEnd = fileBegin + fileData.size();
+	const uint8_t * fileBegin = fileData.data();
+	const uint8_t * fileEnd = fileBegin + fileData.size();
 
 	// Capture the DOS header
 	if((fileBegin + sizeof(PELIB_IMAGE_DOS_HEADER)) >= fileEnd)
@@ -1541,11 +1571,11 @@ int PeLib::ImageLoader::saveDosHeader(
 	return ERROR_NONE;
 }
 
-int PeLib::ImageLoader::captureNtHeaders(ByteBuffer & fileData)
+int PeLib::ImageLoader::captureNtHeaders(const PELIB_FILE_DATA & fileData)
 {
-	uint8_t * fileBegin = fileData.data();
-	uint8_t * filePtr = fileBegin + dosHeader.e_lfanew;
-	uint8_t * fileEnd = fileBegin + fileData.size();
+	const uint8_t * fileBegin = fileData.data();
+	const uint8_t * filePtr = fileBegin + dosHeader.e_lfanew;
+	const uint8_t * fileEnd = fileBegin + fileData.size();
 	size_t ntHeaderSize;
 	uint16_t optionalHeaderMagic = PELIB_IMAGE_NT_OPTIONAL_HDR32_MAGIC;
 
@@ -1783,7 +1813,7 @@ int PeLib::ImageLoader::saveNtHeaders(
 }
 
 int PeLib::ImageLoader::captureSectionName(
-	ByteBuffer & fileData,
+	const PELIB_FILE_DATA & fileData,
 	std::string & sectionName,
 	const uint8_t * Name)
 {
@@ -1819,11 +1849,11 @@ int PeLib::ImageLoader::captureSectionName(
 	return ERROR_NONE;
 }
 
-int PeLib::ImageLoader::captureSectionHeaders(ByteBuffer & fileData)
+int PeLib::ImageLoader::captureSectionHeaders(const PELIB_FILE_DATA & fileData)
 {
-	uint8_t * fileBegin = fileData.data();
-	uint8_t * filePtr;
-	uint8_t * fileEnd = fileBegin + fileData.size();
+	const uint8_t * fileBegin = fileData.data();
+	const uint8_t * filePtr;
+	const uint8_t * fileEnd = fileBegin + fileData.size();
 	bool bRawDataBeyondEOF = false;
 
 	// If there are no sections, then we're done
@@ -2019,7 +2049,7 @@ int PeLib::ImageLoader::saveSectionHeaders(
 	return ERROR_NONE;
 }
 
-int PeLib::ImageLoader::captureImageSections(ByteBuffer & fileData)
+int PeLib::ImageLoader::captureImageSections(const PELIB_FILE_DATA & fileData)
 {
 	uint32_t virtualAddress = 0;
 	uint32_t sizeOfHeaders = optionalHeader.SizeOfHeaders;
@@ -2136,19 +2166,19 @@ int PeLib::ImageLoader::verifyDosHeader(
 	return (ldrError == LDR_ERROR_E_LFANEW_OUT_OF_FILE) ? ERROR_INVALID_FILE : ERROR_NONE;
 }
 
-int PeLib::ImageLoader::loadImageAsIs(ByteBuffer & fileData)
+int PeLib::ImageLoader::loadImageAsIs(const PELIB_FILE_DATA & fileData)
 {
-	rawFileData = fileData;
+	rawFileData.assign(fileData.data(), fileData.data() + fileData.size());
 	return ERROR_NONE;
 }
 
 int PeLib::ImageLoader::captureOptionalHeader64(
-	uint8_t * fileBegin,
-	uint8_t * filePtr,
-	uint8_t * fileEnd)
+	const uint8_t * fileBegin,
+	const uint8_t * filePtr,
+	const uint8_t * fileEnd)
 {
 	PELIB_IMAGE_OPTIONAL_HEADER64 optionalHeader64{};
-	uint8_t * dataDirectoryPtr;
+	const uint8_t * dataDirectoryPtr;
 	uint32_t sizeOfOptionalHeader = sizeof(PELIB_IMAGE_OPTIONAL_HEADER64);
 	uint32_t numberOfRvaAndSizes;
 
@@ -2214,12 +2244,12 @@ int PeLib::ImageLoader::captureOptionalHeader64(
 }
 
 int PeLib::ImageLoader::captureOptionalHeader32(
-	uint8_t * fileBegin,
-	uint8_t * filePtr,
-	uint8_t * fileEnd)
+	const uint8_t * fileBegin,
+	const uint8_t * filePtr,
+	const uint8_t * fileEnd)
 {
 	PELIB_IMAGE_OPTIONAL_HEADER32 optionalHeader32{};
-	uint8_t * dataDirectoryPtr;
+	const uint8_t * dataDirectoryPtr;
 	uint32_t sizeOfOptionalHeader = sizeof(PELIB_IMAGE_OPTIONAL_HEADER32);
 	uint32_t numberOfRvaAndSizes;
 
@@ -2286,7 +2316,7 @@ int PeLib::ImageLoader::captureOptionalHeader32(
 }
 
 uint32_t PeLib::ImageLoader::captureImageSection(
-	ByteBuffer & fileData,
+	const PELIB_FILE_DATA & fileData,
 	uint32_t virtualAddress,
 	uint32_t virtualSize,
 	uint32_t pointerToRawData,
@@ -2294,10 +2324,10 @@ uint32_t PeLib::ImageLoader::captureImageSection(
 	uint32_t characteristics,
 	bool isImageHeader)
 {
-	uint8_t * fileBegin = fileData.data();
-	uint8_t * rawDataPtr;
-	uint8_t * rawDataEnd;
-	uint8_t * fileEnd = fileBegin + fileData.size();
+	const uint8_t * fileBegin = fileData.data();
+	const uint8_t * rawDataPtr;
+	const uint8_t * rawDataEnd;
+	const uint8_t * fileEnd = fileBegin + fileData.size();
 	uint32_t sizeOfInitializedPages;            // The part of section with initialized pages
 	uint32_t sizeOfValidPages;                  // The part of section with valid pages
 	uint32_t sizeOfSection;                     // Total virtual size of the section
@@ -2366,7 +2396,7 @@ uint32_t PeLib::ImageLoader::captureImageSection(
 						bytesToCopy = (rawDataEnd - rawDataPtr);
 
 					// Initialize the page with valid data
-					filePage.setValidPage(rawDataPtr, bytesToCopy);
+					filePage.setValidPage(fileData, rawDataPtr, bytesToCopy);
 				}
 				else
 				{
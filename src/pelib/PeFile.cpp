@@ -10,6 +10,8 @@
 * of PeLib.
 */
 
+#include <future>
+
 #include "retdec/pelib/PeFile.h"
 
 namespace PeLib
@@ -33,9 +35,9 @@ namespace PeLib
 		return m_imageLoader.Load(m_iStream, loadHeadersOnly);
 	}
 
-	int PeFileT::loadPeHeaders(ByteBuffer & fileData, bool loadHeadersOnly)
+	int PeFileT::loadPeHeaders(const ByteBuffer & fileData, bool loadHeadersOnly, bool shareFileData)
 	{
-		return m_imageLoader.Load(fileData, loadHeadersOnly);
+		return m_imageLoader.Load(fileData, loadHeadersOnly, shareFileData);
 	}
 
 	/// returns PEFILE64 or PEFILE32
@@ -332,6 +334,45 @@ namespace PeLib
 		return ERROR_DIRECTORY_DOES_NOT_EXIST;
 	}
 
+	/**
+	* Reads the data directories of the current file.
+	* Directories read from the mapped image are independent of each other and the
+	* image is not modified while they are read, so each of them can be read by its own
+	* task. Each directory limits the amount of work spent on it and reports the
+	* truncation as a loader error. Directories read from the input stream (debug,
+	* security) are always read serially, because the stream is shared.
+	* @param concurrently If false, all the directories are read on the calling thread.
+	**/
+	void PeFileT::readDirectories(bool concurrently)
+	{
+		std::vector<std::future<int>> tasks;
+
+		for(auto readDirectory : {
+				&PeFileT::readImportDirectory,
+				&PeFileT::readIatDirectory,
+				&PeFileT::readBoundImportDirectory,
+				&PeFileT::readDelayImportDirectory,
+				&PeFileT::readExportDirectory,
+				&PeFileT::readTlsDirectory,
+				&PeFileT::readResourceDirectory,
+				&PeFileT::readComHeaderDirectory,
+				&PeFileT::readRelocationsDirectory})
+		{
+			if(concurrently)
+				tasks.push_back(std::async(std::launch::async, readDirectory, this));
+			else
+				(this->*readDirectory)();
+		}
+
+		readDebugDirectory();
+		readSecurityDirectory();
+
+		for(auto & task : tasks)
+		{
+			task.get();
+		}
+	}
+
 	int PeFileT::readDebugDirectory()
 	{
 		if(m_imageLoader.getDataDirRva(PELIB_IMAGE_DIRECTORY_ENTRY_DEBUG))
@@ -92,6 +92,10 @@ namespace PeLib
 		// Other errors
 		{"LDR_ERROR_INMEMORY_IMAGE",               "The file is an in-memory image", false },
 
+		// Directory limit errors
+		{"LDR_ERROR_RSRC_ENTRY_COUNT_EXCEEDED",    "Number of resource directory entries exceeds maximum; resources are truncated", true },
+		{"LDR_ERROR_RELOC_ENTRY_COUNT_EXCEEDED",   "Number of relocation entries exceeds maximum; relocations are truncated", true },
+
 	};
 
 	PELIB_IMAGE_FILE_MACHINE_ITERATOR::PELIB_IMAGE_FILE_MACHINE_ITERATOR()
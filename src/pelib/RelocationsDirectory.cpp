@@ -68,6 +68,7 @@ namespace PeLib
 	void RelocationsDirectory::read(const std::uint8_t * data, std::uint32_t uiSize, std::uint32_t sizeOfImage)
 	{
 		const std::uint8_t * dataEnd = data + uiSize;
+		std::uint32_t totalEntries = 0;
 
 		// Clear the current relocations
 		m_vRelocations.clear();
@@ -112,6 +113,14 @@ namespace PeLib
 				const std::uint16_t * typeAndOffsets = (const std::uint16_t *)(pRelocBlock + 1);
 				std::uint32_t numberOfEntries = (ibrCurr.ibrRelocation.SizeOfBlock - PELIB_IMAGE_SIZEOF_BASE_RELOCATION) / sizeof(uint16_t);
 
+				// Don't let a hostile relocation table stall the parsing
+				if(numberOfEntries > PELIB_MAX_RELOCATION_ENTRIES - totalEntries)
+				{
+					setLoaderError(LDR_ERROR_RELOC_ENTRY_COUNT_EXCEEDED);
+					break;
+				}
+				totalEntries += numberOfEntries;
+
 				for (std::uint32_t i = 0; i < numberOfEntries; i++)
 				{
 					// Read the type and offset
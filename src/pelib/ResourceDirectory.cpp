@@ -660,6 +660,13 @@ namespace PeLib
 			return ERROR_NONE;
 		}
 
+		// Deeply nested or very large resource trees are truncated
+		if (!resDir->addNumberOfEntries(uiNumberOfEntries))
+		{
+			resDir->setLoaderError(LDR_ERROR_RSRC_ENTRY_COUNT_EXCEEDED);
+			return ERROR_NONE;
+		}
+
 		// Load all entries to the vector
 		std::vector<PELIB_IMAGE_RESOURCE_DIRECTORY_ENTRY> vResourceChildren(uiNumberOfEntries);
 		resDir->insertNodeOffset(uiOffset);
@@ -999,7 +1006,7 @@ namespace PeLib
 	/**
 	* Constructor
 	*/
-	ResourceDirectory::ResourceDirectory() : m_readOffset(0), m_ldrError(LDR_ERROR_NONE)
+	ResourceDirectory::ResourceDirectory() : m_readOffset(0), m_numberOfEntries(0), m_ldrError(LDR_ERROR_NONE)
 	{
 
 	}
@@ -1816,6 +1823,17 @@ namespace PeLib
 		return m_resourceNodeOffsets.find(nodeOffset) != m_resourceNodeOffsets.end();
 	}
 
+	/**
+	* Count entries of a loaded node.
+	* @param numberOfEntries Number of entries of the node.
+	* @return @c false if the total number of entries exceeds PELIB_MAX_RESOURCE_ENTRIES.
+	*/
+	bool ResourceDirectory::addNumberOfEntries(std::size_t numberOfEntries)
+	{
+		m_numberOfEntries += numberOfEntries;
+		return m_numberOfEntries <= PELIB_MAX_RESOURCE_ENTRIES;
+	}
+
 	void ResourceDirectory::addOccupiedAddressRange(unsigned int start, unsigned int end)
 	{
 		m_occupiedAddresses.emplace_back(start, end);
@@ -1,4 +1,11 @@
 
 if(NOT TARGET retdec::pelib)
+    find_package(Threads REQUIRED)
+
+    find_package(retdec @PROJECT_VERSION@ REQUIRED
+        COMPONENTS
+            utils
+    )
+
     include(${CMAKE_CURRENT_LIST_DIR}/retdec-pelib-targets.cmake)
 endif()
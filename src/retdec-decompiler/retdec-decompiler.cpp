@@ -4,9 +4,13 @@
  * @copyright (c) 2020 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <fstream>
 #include <future>
 #include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
 #include <thread>
 
 #include <llvm/ADT/Triple.h>
@@ -39,6 +43,7 @@
 #include "retdec/ar-extractor/archive_wrapper.h"
 #include "retdec/ar-extractor/detection.h"
 #include "retdec/config/config.h"
+#include "retdec/fileformat/format_factory.h"
 #include "retdec/retdec/retdec.h"
 #include "retdec/macho-extractor/break_fat.h"
 #include "retdec/unpackertool/unpackertool.h"
@@ -46,9 +51,17 @@
 #include "retdec/utils/filesystem.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/memory.h"
+#include "retdec/utils/os.h"
 
 #include "retdec/utils/io/log.h"
 
+#ifdef OS_POSIX
+	#include <signal.h>
+	#include <sys/types.h>
+	#include <sys/wait.h>
+	#include <unistd.h>
+#endif
+
 using namespace retdec::utils::io;
 
 const int EXIT_TIMEOUT = 137;
@@ -73,6 +86,12 @@ class ProgramOptions
 		std::string arExtractPath;
 		std::string arName;
 		std::optional<uint64_t> arIdx;
+		bool arAll = false;
+		bool machoAll = false;
+		unsigned arJobs = 0;
+		/// Output paths without extensions, outputs of archive objects and
+		/// Mach-O slices are named by it.
+		std::string outputBase;
 
 		bool cleanup = false;
 		std::set<std::string> toClean;
@@ -260,7 +279,8 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	else if (isParam(i, "-f", "--output-format"))
 	{
 		auto of = getParamOrDie(i);
-		if (!(of == "plain" || of == "json" || of == "json-human"))
+		if (!(of == "plain" || of == "json" || of == "json-human"
+				|| of == "binary"))
 		{
 			throw std::runtime_error(
 				"[-f|--output-format] unknown output format: " + of
@@ -304,6 +324,7 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 		params.setOutputConfigFile(out + ".config.json");
 		params.setOutputUnpackedFile(out + "-unpacked");
 		arExtractPath = out + "-extracted";
+		outputBase = out;
 	}
 	else if (isParam(i, "-k", "--keep-unreachable-funcs"))
 	{
@@ -387,6 +408,18 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	{
 		params.setIsDetectStaticCode(false);
 	}
+	else if (isParam(i, "", "--lazy-flags"))
+	{
+		params.setIsLazyFlags(true);
+	}
+	else if (isParam(i, "", "--pipeline"))
+	{
+		params.setLlvmPipeline(getParamOrDie(i));
+	}
+	else if (isParam(i, "", "--pipeline-stats"))
+	{
+		params.setLlvmPassStatsFile(getParamOrDie(i));
+	}
 	else if (isParam(i, "", "--backend-disabled-opts"))
 	{
 		params.setBackendDisabledOpts(getParamOrDie(i));
@@ -463,11 +496,11 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	}
 	else if (isParam(i, "", "--ar-index"))
 	{
-		if (!arName.empty())
+		if (!arName.empty() || arAll)
 		{
 			throw std::runtime_error(
-				"[--ar-index] and [--ar-name] are mutually exclusive, "
-				"use only one"
+				"[--ar-index], [--ar-name] and [--ar-all] are mutually "
+				"exclusive, use only one"
 			);
 		}
 
@@ -485,16 +518,46 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	}
 	else if (isParam(i, "", "--ar-name"))
 	{
-		if (arIdx.has_value())
+		if (arIdx.has_value() || arAll)
 		{
 			throw std::runtime_error(
-				"[--ar-name] and [--ar-index] are mutually exclusive, "
-				"use only one"
+				"[--ar-index], [--ar-name] and [--ar-all] are mutually "
+				"exclusive, use only one"
 			);
 		}
 
 		arName = getParamOrDie(i);
 	}
+	else if (isParam(i, "", "--ar-all"))
+	{
+		if (arIdx.has_value() || !arName.empty())
+		{
+			throw std::runtime_error(
+				"[--ar-index], [--ar-name] and [--ar-all] are mutually "
+				"exclusive, use only one"
+			);
+		}
+
+		arAll = true;
+	}
+	else if (isParam(i, "", "--macho-all"))
+	{
+		machoAll = true;
+	}
+	else if (isParam(i, "", "--ar-jobs"))
+	{
+		auto val = getParamOrDie(i);
+		try
+		{
+			arJobs = std::stoul(val);
+		}
+		catch (...)
+		{
+			throw std::runtime_error(
+				"[--ar-jobs] invalid number of jobs: " + val
+			);
+		}
+	}
 	else if (isParam(i, "", "--static-code-sigfile"))
 	{
 		auto file = checkFile(getParamOrDie(i), "[--static-code-sigfile]");
@@ -548,6 +611,8 @@ void ProgramOptions::afterLoad()
 	{
 		if (params.getOutputFormat() == "plain")
 			params.setOutputFile(in + ".c");
+		else if (params.getOutputFormat() == "binary")
+			params.setOutputFile(in + ".c.tokens");
 		else
 			params.setOutputFile(in + ".c.json");
 	}
@@ -555,6 +620,8 @@ void ProgramOptions::afterLoad()
 		params.setOutputUnpackedFile(in + "-unpacked");
 	if (arExtractPath.empty())
 		arExtractPath = in + "-extracted";
+	if (outputBase.empty())
+		outputBase = in;
 
 	if (mode == "raw")
 	{
@@ -615,15 +682,19 @@ void ProgramOptions::printHelpAndDie()
 Mandatory arguments:
 	INPUT_FILE File to decompile.
 General arguments:
-	[-o|--output FILE] Output file (default: INPUT_FILE.c if OUTPUT_FORMAT is plain, INPUT_FILE.c.json if OUTPUT_FORMAT is json|json-human).
+	[-o|--output FILE] Output file (default: INPUT_FILE.c if OUTPUT_FORMAT is plain, INPUT_FILE.c.json if OUTPUT_FORMAT is json|json-human, INPUT_FILE.c.tokens if OUTPUT_FORMAT is binary).
 	[-s|--silent] Turns off informative output of the decompilation.
-	[-f|--output-format OUTPUT_FORMAT] Output format [plain|json|json-human] (default: plain).
+	[-f|--output-format OUTPUT_FORMAT] Output format [plain|json|json-human|binary] (default: plain).
+	                                   The binary format can be converted into JSON by retdec-tokens2json.
 	[-m|--mode MODE] Force the type of decompilation mode [bin|raw] (default: bin).
 	[-p|--pdb FILE] File with PDB debug information.
 	[-k|--keep-unreachable-funcs] Keep functions that are unreachable from the main function.
 	[--cleanup] Removes temporary files created during the decompilation.
 	[--config] Specify JSON decompilation configuration file.
 	[--disable-static-code-detection] Prevents detection of statically linked code.
+	[--lazy-flags] Do not generate x86 flags that are overwritten before they are read. Faster decoding, smaller LLVM IR.
+	[--pipeline NAME] Run the named LLVM pipeline from the config's llvmPipelines instead of llvmPasses (e.g. fast).
+	[--pipeline-stats FILE] Write run time, LLVM IR size and hash changes and demangler cache hits of each pass in the pipeline into FILE (CSV).
 Selective decompilation arguments:
 	[--select-ranges RANGES] Specify a comma separated list of ranges to decompile (example: 0x100-0x200,0x300-0x400,0x500-0x600).
 	[--select-functions FUNCS] Specify a comma separated list of functions to decompile (example: fnc1,fnc2,fnc3).
@@ -640,7 +711,13 @@ Raw or Intel HEX decompilation arguments:
 Archive decompilation arguments:
 	[--ar-index INDEX] Pick file from archive for decompilation by its zero-based index.
 	[--ar-name NAME] Pick file from archive for decompilation by its name.
+	[--ar-all] Decompile all files from archive without extracting them.
+	           Outputs of each file are named by the output and the file name (e.g. INPUT_FILE-NAME.c).
 	[--static-code-sigfile FILE] Adds additional signature file for static code detection.
+Mach-O Universal Binary decompilation arguments:
+	[--macho-all] Decompile all architectures from Mach-O Universal Binary.
+	              Outputs of each architecture are named by the output and the architecture name (e.g. INPUT_FILE-x86_64.c).
+	[--ar-jobs N] Number of files from archive or architectures decompiled in parallel with --ar-all or --macho-all (default: number of processors).
 Backend arguments:
 	[--backend-disabled-opts LIST] Prevents the optimizations from the given comma-separated list of optimizations to be run.
 	[--backend-enabled-opts LIST] Runs only the optimizations from the given comma-separated list of optimizations.
@@ -660,6 +737,7 @@ Decompilation process arguments:
 	[--timeout SECONDS]
 	[--max-memory MAX_MEMORY] Limits the maximal memory used by the given number of bytes.
 	[--no-memory-limit] Disables the default memory limit (half of system RAM).
+	                    With --ar-all or --macho-all, the memory limit applies to each process decompiling one file.
 LLVM IR debug arguments:
 	[--print-after-all] Dump LLVM IR to stderr after every LLVM pass.
 	[--print-before-all] Dump LLVM IR to stderr before every LLVM pass.
@@ -789,6 +867,395 @@ void setLogsFrom(const retdec::config::Parameters& params)
 	}
 }
 
+/**
+ * Unpacks and decompiles the input file.
+ *
+ * @param config Decompilation config.
+ * @param po Program options.
+ * @param inputFile Parsed input file. If not given, it is parsed from
+ *                  the input file path (except in the raw mode).
+ */
+int unpackAndDecompile(
+		retdec::config::Config& config,
+		ProgramOptions& po,
+		std::shared_ptr<retdec::fileformat::FileFormat> inputFile = nullptr)
+{
+	// Unpacking
+	//
+
+	// The input file is parsed only once, the unpacker checks it for known
+	// packers and, if it was not unpacked, it is handed over to the
+	// decompilation.
+	//
+	Log::phase("Unpacking");
+	if (!inputFile && !config.fileFormat.isRaw())
+	{
+		inputFile = retdec::fileformat::createFileFormat(
+				config.parameters.getInputFile(),
+				false,
+				retdec::fileformat::LoadFlags::PROFILE_DECOMPILER);
+	}
+
+	int unpackCode = 1;
+	if (inputFile)
+	{
+		unpackCode = retdec::unpackertool::unpack(
+				inputFile,
+				config.parameters.getOutputUnpackedFile());
+	}
+	if (unpackCode == 0) // EXIT_CODE_OK
+	{
+		config.parameters.setInputFile(
+				config.parameters.getOutputUnpackedFile()
+		);
+		po.toClean.insert(config.parameters.getOutputUnpackedFile());
+		inputFile.reset();
+	}
+
+	// Decompilation.
+	//
+	return inputFile
+			? retdec::decompile(config, inputFile)
+			: retdec::decompile(config);
+}
+
+/**
+ * Part of the input file decompiled on its own, i.e. object from archive or
+ * architecture from Mach-O Universal Binary. Its data are owned by the input.
+ */
+struct InputPart
+{
+	std::string name;
+	llvm::StringRef data;
+};
+
+/**
+ * Returns output path @a path for the input part @a name, i.e.
+ * OUTPUT-NAME.c for OUTPUT.c.
+ */
+std::string getInputPartPath(
+		const ProgramOptions& po,
+		const std::string& path,
+		const std::string& name)
+{
+	return retdec::utils::startsWith(path, po.outputBase)
+			? po.outputBase + "-" + name + path.substr(po.outputBase.size())
+			: path + "-" + name;
+}
+
+/**
+ * Returns file format parsed from @a data. Data are not copied into a file.
+ */
+std::shared_ptr<retdec::fileformat::FileFormat> createFileFormat(
+		llvm::StringRef data)
+{
+	return retdec::fileformat::createFileFormat(
+			reinterpret_cast<const std::uint8_t*>(data.data()),
+			data.size(),
+			false,
+			retdec::fileformat::LoadFlags::PROFILE_DECOMPILER);
+}
+
+/**
+ * Decompiles input part @a part. The part is parsed directly from the input
+ * buffer, it is not extracted into a file.
+ */
+int decompileInputPart(
+		const retdec::config::Config& config,
+		ProgramOptions& po,
+		const InputPart& part,
+		bool verbose)
+{
+	auto partConfig = config;
+	auto& params = partConfig.parameters;
+	auto partPath = [&po, &part](const std::string& path)
+	{
+		return getInputPartPath(po, path, part.name);
+	};
+
+	// There is no such file, it only describes the input in outputs.
+	params.setInputFile(
+			config.parameters.getInputFile() + "(" + part.name + ")");
+	params.setOutputFile(partPath(params.getOutputFile()));
+	params.setOutputAsmFile(partPath(params.getOutputAsmFile()));
+	params.setOutputBitcodeFile(partPath(params.getOutputBitcodeFile()));
+	params.setOutputLlvmirFile(partPath(params.getOutputLlvmirFile()));
+	params.setOutputConfigFile(partPath(params.getOutputConfigFile()));
+	params.setOutputUnpackedFile(partPath(params.getOutputUnpackedFile()));
+	if (!params.getLlvmPassStatsFile().empty())
+	{
+		params.setLlvmPassStatsFile(partPath(params.getLlvmPassStatsFile()));
+	}
+	if (!verbose)
+	{
+		params.setIsVerboseOutput(false);
+	}
+
+	auto inputFile = createFileFormat(part.data);
+	if (!inputFile)
+	{
+		throw std::runtime_error("failed to parse " + part.name);
+	}
+
+	return unpackAndDecompile(partConfig, po, inputFile);
+}
+
+/**
+ * Decompiles input part @a part, reports errors instead of throwing them.
+ */
+int tryDecompileInputPart(
+		const retdec::config::Config& config,
+		ProgramOptions& po,
+		const InputPart& part,
+		bool verbose)
+{
+	try
+	{
+		return decompileInputPart(config, po, part, verbose);
+	}
+	catch (const std::runtime_error& e)
+	{
+		Log::error() << Log::Error << part.name << ": " << e.what()
+				<< std::endl;
+		return EXIT_FAILURE;
+	}
+	catch (const std::bad_alloc& e)
+	{
+		Log::error() << part.name << ": catched std::bad_alloc"
+				<< std::endl;
+		return EXIT_BAD_ALLOC;
+	}
+}
+
+#ifdef OS_POSIX
+/// Guards @c inputPartProcesses and @c inputPartProcessesKilled.
+std::mutex inputPartProcessesMutex;
+/// Running children decompiling input parts.
+std::set<pid_t> inputPartProcesses;
+/// No more children are started once they were killed.
+bool inputPartProcessesKilled = false;
+#endif
+
+/**
+ * Kills and reaps all running children decompiling input parts, and prevents
+ * starting new ones. It is used when the decompilation times out.
+ */
+void killInputPartProcesses()
+{
+#ifdef OS_POSIX
+	std::lock_guard<std::mutex> lock(inputPartProcessesMutex);
+	inputPartProcessesKilled = true;
+	for (auto pid : inputPartProcesses)
+	{
+		kill(pid, SIGKILL);
+		waitpid(pid, nullptr, 0);
+	}
+	inputPartProcesses.clear();
+#endif
+}
+
+/**
+ * Decompiles all input parts @a parts.
+ *
+ * On POSIX systems, parts are decompiled in parallel in child processes,
+ * because the decompilation keeps its state in global variables. The children
+ * get the input buffer from the parent, nothing is written to disk. Limits of
+ * the memory used apply to each child. Elsewhere, parts are decompiled one
+ * by one in this process.
+ */
+int decompileInputParts(
+		const retdec::config::Config& config,
+		ProgramOptions& po,
+		const std::vector<InputPart>& parts)
+{
+	for (auto& part : parts)
+	{
+		po.toClean.insert(getInputPartPath(
+				po,
+				config.parameters.getOutputUnpackedFile(),
+				part.name));
+	}
+
+	std::size_t jobs = po.arJobs
+			? po.arJobs
+			: std::max(1u, std::thread::hardware_concurrency());
+	jobs = std::min(jobs, parts.size());
+
+	Log::phase(
+			"Decompilation of " + std::to_string(parts.size())
+			+ " parts (" + std::to_string(jobs) + " jobs)");
+
+	std::vector<int> codes(parts.size(), EXIT_FAILURE);
+	auto report = [&parts, &codes](std::size_t i)
+	{
+		Log::phase(
+				parts[i].name + (codes[i] == EXIT_SUCCESS ? "" : " FAILED"),
+				Log::SubPhase);
+	};
+
+#ifdef OS_POSIX
+	// Outputs of children would be interleaved, only results are printed.
+	bool verbose = jobs == 1;
+	std::map<pid_t, std::size_t> running;
+	std::size_t next = 0;
+	while (next < parts.size() || !running.empty())
+	{
+		if (next < parts.size() && running.size() < jobs)
+		{
+			// Buffered output would be written by the child as well.
+			std::cout.flush();
+			std::cerr.flush();
+
+			// The child never releases its copy of the lock, it exits.
+			std::unique_lock<std::mutex> lock(inputPartProcessesMutex);
+			if (inputPartProcessesKilled)
+			{
+				break;
+			}
+			pid_t pid = fork();
+			if (pid == 0)
+			{
+				int code = tryDecompileInputPart(
+						config,
+						po,
+						parts[next],
+						verbose);
+				std::cout.flush();
+				std::cerr.flush();
+				_exit(code);
+			}
+			else if (pid < 0)
+			{
+				Log::error() << Log::Error << parts[next].name
+						<< ": failed to start decompilation" << std::endl;
+				report(next++);
+			}
+			else
+			{
+				inputPartProcesses.insert(pid);
+				running[pid] = next++;
+			}
+			continue;
+		}
+
+		int status = 0;
+		pid_t pid = waitpid(-1, &status, 0);
+		if (pid < 0)
+		{
+			break;
+		}
+		{
+			std::lock_guard<std::mutex> lock(inputPartProcessesMutex);
+			inputPartProcesses.erase(pid);
+		}
+		auto it = running.find(pid);
+		if (it == running.end())
+		{
+			continue;
+		}
+		codes[it->second] = WIFEXITED(status)
+				? WEXITSTATUS(status)
+				: EXIT_FAILURE;
+		report(it->second);
+		running.erase(it);
+	}
+#else
+	for (std::size_t i = 0; i < parts.size(); ++i)
+	{
+		codes[i] = tryDecompileInputPart(config, po, parts[i], true);
+		report(i);
+	}
+#endif
+
+	auto failed = std::count_if(codes.begin(), codes.end(), [](int c) {
+		return c != EXIT_SUCCESS;
+	});
+	if (failed)
+	{
+		Log::error() << Log::Error << failed << " of " << parts.size()
+				<< " parts failed to decompile" << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+/**
+ * Decompiles all objects from the input archive @a arw. The archive is read
+ * only once and objects are parsed from its buffer.
+ */
+int decompileArchive(
+		retdec::config::Config& config,
+		ProgramOptions& po,
+		const retdec::ar_extractor::ArchiveWrapper& arw)
+{
+	Log::phase("Archive loading");
+
+	if (arw.isThinArchive())
+	{
+		throw std::runtime_error(
+				"File is a thin archive and cannot be decompiled."
+		);
+	}
+
+	std::string errMsg;
+	std::vector<retdec::ar_extractor::ArchiveObject> objects;
+	if (!arw.getObjects(objects, errMsg))
+	{
+		throw std::runtime_error("failed to read archive: " + errMsg);
+	}
+	if (objects.empty())
+	{
+		throw std::runtime_error("The input archive is empty.");
+	}
+
+	std::vector<InputPart> parts;
+	for (auto& object : objects)
+	{
+		parts.push_back({object.name, object.data});
+	}
+	return decompileInputParts(config, po, parts);
+}
+
+/**
+ * Decompiles all architectures from Mach-O Universal Binary @a fat.
+ * Architectures are parsed from the file buffer.
+ */
+int decompileMachOSlices(
+		retdec::config::Config& config,
+		ProgramOptions& po,
+		retdec::macho_extractor::BreakMachOUniversal& fat)
+{
+	if (fat.isStaticLibrary())
+	{
+		throw std::runtime_error(
+				"[--macho-all] static libraries are not supported, "
+				"use retdec-macho-extractor to extract them"
+		);
+	}
+
+	// Names of architectures are made unique in the same way as names of
+	// archive objects.
+	std::map<std::string, std::size_t> nameMap;
+	std::vector<InputPart> parts;
+	for (auto& slice : fat.getAllArchives())
+	{
+		auto name = slice.archName;
+		if (++nameMap[name] != 1)
+		{
+			name += "." + std::to_string(nameMap[name]);
+		}
+		parts.push_back({name, slice.data});
+	}
+	if (parts.empty())
+	{
+		throw std::runtime_error(
+				"Mach-O extraction: input file has no architectures."
+		);
+	}
+
+	return decompileInputParts(config, po, parts);
+}
+
 int decompile(retdec::config::Config& config, ProgramOptions& po)
 {
 	setLogsFrom(config.parameters);
@@ -798,17 +1265,32 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 	retdec::macho_extractor::BreakMachOUniversal fat(
 			config.parameters.getInputFile()
 	);
+	if (po.machoAll && !fat.isValid())
+	{
+		throw std::runtime_error(
+				"[--macho-all] input file is not a Mach-O Universal Binary"
+		);
+	}
+
+	// The selected architecture is parsed directly from the file buffer,
+	// it is not extracted into a file.
+	//
+	std::optional<retdec::macho_extractor::MachOSlice> slice;
 	if (fat.isValid())
 	{
 		Log::phase("Mach-O extraction");
 
-		auto extractedFile = po.arExtractPath + "_m";
+		if (po.machoAll)
+		{
+			return decompileMachOSlices(config, po, fat);
+		}
 
+		slice.emplace();
 		if (config.architecture.isKnown())
 		{
-			if (!fat.extractArchiveForFamily(
+			if (!fat.getArchiveForFamily(
 					config.architecture.getName(),
-					extractedFile))
+					*slice))
 			{
 				std::stringstream ss;
 				ss << "Invalid --arch option '"
@@ -821,43 +1303,55 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 		}
 		else
 		{
-			if (!fat.extractBestArchive(extractedFile))
+			if (!fat.getBestArchive(*slice))
 			{
 				throw std::runtime_error(
-						"Mach-O extraction: extractBestArchive() failed."
+						"Mach-O extraction: failed to select architecture."
 				);
-				return EXIT_FAILURE;
 			}
 		}
-
-		config.parameters.setInputFile(extractedFile);
-		po.toClean.insert(extractedFile);
 	}
 
 	// Archive extraction.
 	//
-	if (po.arIdx || !po.arName.empty())
+	bool ok = true;
+	std::string errMsg;
+	auto arw = slice
+			? std::make_unique<retdec::ar_extractor::ArchiveWrapper>(
+					llvm::MemoryBufferRef(slice->data, slice->archName),
+					ok,
+					errMsg)
+			: std::make_unique<retdec::ar_extractor::ArchiveWrapper>(
+					config.parameters.getInputFile(),
+					ok,
+					errMsg);
+
+	if ((po.arAll || po.arIdx || !po.arName.empty()) && !ok)
 	{
-		Log::phase("Archive extraction");
-
-		bool ok = true;
-		std::string errMsg;
-		retdec::ar_extractor::ArchiveWrapper arw(
-				config.parameters.getInputFile(),
-				ok,
-				errMsg
+		throw std::runtime_error(
+				"failed to create archive wrapper: " + errMsg
 		);
+	}
 
-		if (!ok)
-		{
-			throw std::runtime_error(
-					"failed to create archive wrapper: " + errMsg
-			);
-		}
+	if (slice)
+	{
+		// There is no such file, it only describes the input in outputs.
+		config.parameters.setInputFile(
+				config.parameters.getInputFile()
+				+ "(" + slice->archName + ")");
+	}
+
+	if (po.arAll)
+	{
+		return decompileArchive(config, po, *arw);
+	}
+	else if (po.arIdx || !po.arName.empty())
+	{
+		Log::phase("Archive extraction");
 
 		if (po.arIdx)
 		{
-			if (!arw.extractByIndex(po.arIdx.value(), errMsg, po.arExtractPath))
+			if (!arw->extractByIndex(po.arIdx.value(), errMsg, po.arExtractPath))
 			{
 				throw std::runtime_error(
 						"failed to extract archive: " + errMsg + "\n"
@@ -865,14 +1359,14 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 						+ std::to_string(po.arIdx.value())
 						+ "' was not found in the input archive."
 						  " Valid indexes are 0-"
-						+ std::to_string(arw.getNumberOfObjects()-1)
+						+ std::to_string(arw->getNumberOfObjects()-1)
 						+ ".\n"
 				);
 			}
 		}
 		else if (!po.arName.empty())
 		{
-			if (!arw.extractByName(po.arName, errMsg, po.arExtractPath))
+			if (!arw->extractByName(po.arName, errMsg, po.arExtractPath))
 			{
 				throw std::runtime_error(
 						"failed to extract archive: " + errMsg + "\n"
@@ -884,23 +1378,17 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 
 		config.parameters.setInputFile(po.arExtractPath);
 		po.toClean.insert(po.arExtractPath);
+		return unpackAndDecompile(config, po);
 	}
 	else
 	{
-		bool ok = true;
-		std::string errMsg;
-		retdec::ar_extractor::ArchiveWrapper arw(
-				config.parameters.getInputFile(),
-				ok,
-				errMsg
-		);
-		if (ok && arw.isThinArchive())
+		if (ok && arw->isThinArchive())
 		{
 			Log::error() << "This file is an archive!" << std::endl;
 			Log::error() << "Error: File is a thin archive and cannot be decompiled." << std::endl;
 			return EXIT_FAILURE;
 		}
-		else if (ok && arw.isEmptyArchive())
+		else if (ok && arw->isEmptyArchive())
 		{
 			Log::error() << "This file is an archive!" << std::endl;
 			Log::error() << "Error: The input archive is empty." << std::endl;
@@ -911,14 +1399,17 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 			Log::error() << "This file is an archive!" << std::endl;
 
 			std::string result;
-			if (arw.getPlainTextList(result, errMsg, false, true))
+			if (arw->getPlainTextList(result, errMsg, false, true))
 			{
 				Log::error() << result << std::endl;
 			}
 			return EXIT_FAILURE;
 		}
 
-		if (!ok && retdec::ar_extractor::isArchive(config.parameters.getInputFile()))
+		bool isArchive = slice
+				? fat.isStaticLibrary()
+				: retdec::ar_extractor::isArchive(config.parameters.getInputFile());
+		if (!ok && isArchive)
 		{
 			Log::error() << "This file is an archive!" << std::endl;
 			Log::error() << "Error: The input archive has invalid format." << std::endl;
@@ -926,33 +1417,19 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 		}
 	}
 
-	// Unpacking
-	//
-
-	Log::phase("Unpacking");
-	std::vector<std::string> unpackArgs;
-	unpackArgs.push_back("whatever_program_name");
-	unpackArgs.push_back(config.parameters.getInputFile());
-	unpackArgs.push_back("--output");
-	unpackArgs.push_back(config.parameters.getOutputUnpackedFile());
-	char* uargv[4] = {
-			unpackArgs[0].data(),
-			unpackArgs[1].data(),
-			unpackArgs[2].data(),
-			unpackArgs[3].data()
-	};
-	auto unpackCode = retdec::unpackertool::_main(4, uargv);
-	if (unpackCode == 0) // EXIT_CODE_OK
+	if (slice)
 	{
-		config.parameters.setInputFile(
-				config.parameters.getOutputUnpackedFile()
-		);
-		po.toClean.insert(config.parameters.getOutputUnpackedFile());
+		auto inputFile = createFileFormat(slice->data);
+		if (!inputFile)
+		{
+			throw std::runtime_error(
+					"Mach-O extraction: failed to parse " + slice->archName
+			);
+		}
+		return unpackAndDecompile(config, po, inputFile);
 	}
 
-	// Decompilation.
-	//
-	return retdec::decompile(config);
+	return unpackAndDecompile(config, po);
 }
 
 //
@@ -1043,6 +1520,7 @@ int main(int argc, char **argv)
 			else
 			{
 				thr.detach(); // we leave the thread still running
+				killInputPartProcesses(); // but not processes it started
 				Log::error() << "timeout after: " << config.parameters.getTimeout()
 						<< " seconds" << std::endl;
 				ret = EXIT_TIMEOUT;
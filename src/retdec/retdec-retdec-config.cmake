@@ -7,6 +7,7 @@ if(NOT TARGET retdec::retdec)
             llvmir2hll
             config
             common
+            fileformat
             capstone
             llvm
     )
@@ -4,6 +4,10 @@
  * @copyright (c) 2019 Avast Software, licensed under the MIT license
  */
 
+#include <chrono>
+#include <fstream>
+#include <functional>
+
 #include <llvm/ADT/Triple.h>
 #include <llvm/Analysis/CallGraph.h>
 #include <llvm/Analysis/CallGraphSCCPass.h>
@@ -44,6 +48,7 @@
 #include "retdec/bin2llvmir/optimizations/provider_init/provider_init.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/demangler.h"
 
 #include "retdec/llvmir2hll/llvmir2hll.h"
 
@@ -408,19 +413,193 @@ class ModulePassPrinter : public ModulePass
 char ModulePassPrinter::ID = 0;
 std::string ModulePassPrinter::LastPhase;
 
+/**
+ * Statistics of one pass in the pipeline.
+ */
+struct PassStatistics
+{
+	std::string passArg;
+	std::chrono::steady_clock::time_point start;
+	double seconds = 0.0;
+	std::size_t instructionsBefore = 0;
+	std::size_t instructionsAfter = 0;
+	std::size_t blocksBefore = 0;
+	std::size_t blocksAfter = 0;
+	std::size_t irHashBefore = 0;
+	std::size_t irHashAfter = 0;
+	demangler::CachingDemangler::Statistics demanglerBefore;
+	std::size_t demanglerHits = 0;
+	std::size_t demanglerMisses = 0;
+};
+
+/**
+ * @return Statistics of the demangling cache used by the module @a M, or
+ *         zeroes if there is no demangler for it yet.
+ */
+static demangler::CachingDemangler::Statistics getDemanglerStatistics(
+		Module& M)
+{
+	auto* d = bin2llvmir::DemanglerProvider::getDemangler(&M);
+	return d
+			? d->getCacheStatistics()
+			: demangler::CachingDemangler::Statistics();
+}
+
+/**
+ * @return Hash of the textual LLVM IR of the module @a M.
+ */
+static std::size_t getIrHash(Module& M)
+{
+	std::string str;
+	raw_string_ostream os(str);
+	M.print(os, nullptr);
+	return std::hash<std::string>()(os.str());
+}
+
+/**
+ * This pass records the IR size, the IR hash and the run time of another pass.
+ * In pass manager, one instance (@c start set) should be placed right before
+ * the measured pass, and another one right after it.
+ */
+class PassStatisticsRecorder : public ModulePass
+{
+	public:
+		static char ID;
+		std::vector<PassStatistics>& Stats;
+		std::string PhaseArg;
+		bool Start;
+
+	public:
+		PassStatisticsRecorder(
+				std::vector<PassStatistics>& stats,
+				const std::string& phaseArg,
+				bool start)
+				: ModulePass(ID)
+				, Stats(stats)
+				, PhaseArg(phaseArg)
+				, Start(start)
+		{
+
+		}
+
+		bool runOnModule(Module &M) override
+		{
+			std::size_t instructions = 0;
+			std::size_t blocks = 0;
+			for (auto& F : M)
+			{
+				instructions += F.getInstructionCount();
+				blocks += F.size();
+			}
+
+			if (Start)
+			{
+				Stats.emplace_back();
+				Stats.back().passArg = PhaseArg;
+				Stats.back().instructionsBefore = instructions;
+				Stats.back().blocksBefore = blocks;
+				Stats.back().irHashBefore = getIrHash(M);
+				Stats.back().demanglerBefore = getDemanglerStatistics(M);
+				Stats.back().start = std::chrono::steady_clock::now();
+			}
+			else
+			{
+				auto& s = Stats.back();
+				s.seconds = std::chrono::duration<double>(
+						std::chrono::steady_clock::now() - s.start).count();
+				s.instructionsAfter = instructions;
+				s.blocksAfter = blocks;
+				s.irHashAfter = getIrHash(M);
+
+				// The demangler may be (re)created by the measured pass.
+				auto d = getDemanglerStatistics(M);
+				s.demanglerHits = d.hits >= s.demanglerBefore.hits
+						? d.hits - s.demanglerBefore.hits
+						: d.hits;
+				s.demanglerMisses = d.misses >= s.demanglerBefore.misses
+						? d.misses - s.demanglerBefore.misses
+						: d.misses;
+			}
+			return false;
+		}
+
+		llvm::StringRef getPassName() const override
+		{
+			return "ModulePass Statistics Recorder";
+		}
+
+		void getAnalysisUsage(AnalysisUsage &AU) const override
+		{
+			AU.setPreservesAll();
+		}
+};
+char PassStatisticsRecorder::ID = 0;
+
+/**
+ * Write the collected pass statistics as CSV into @a path.
+ */
+static void writePassStatistics(
+		const std::string& path,
+		const std::vector<PassStatistics>& stats)
+{
+	std::ofstream out(path);
+	if (!out)
+	{
+		throw std::runtime_error("cannot write pass statistics: " + path);
+	}
+
+	out << "index,pass,seconds,instructions_before,instructions_after,"
+			"blocks_before,blocks_after,ir_hash_before,ir_hash_after,"
+			"demangler_hits,demangler_misses\n";
+	for (std::size_t i = 0; i < stats.size(); ++i)
+	{
+		auto& s = stats[i];
+		out << i << ","
+				<< s.passArg << ","
+				<< s.seconds << ","
+				<< s.instructionsBefore << ","
+				<< s.instructionsAfter << ","
+				<< s.blocksBefore << ","
+				<< s.blocksAfter << ","
+				<< s.irHashBefore << ","
+				<< s.irHashAfter << ","
+				<< s.demanglerHits << ","
+				<< s.demanglerMisses << "\n";
+	}
+}
+
 /**
  * Add the pass to the pass manager - no verification.
+ * If @a stats is set, the pass's statistics are recorded into it.
  */
 static inline void addPass(
 		legacy::PassManagerBase& PM,
 		Pass* P,
-		const PassInfo* PI)
+		const PassInfo* PI,
+		std::vector<PassStatistics>* stats = nullptr)
 {
 	PM.add(new ModulePassPrinter(
 			PI->getPassName().str(),
 			PI->getPassArgument().str()
 	));
-	PM.add(P);
+	// The printer is a module pass placed before every pass, so the
+	// recorders do not split any runs of function passes it did not split.
+	if (stats)
+	{
+		PM.add(new PassStatisticsRecorder(
+				*stats,
+				PI->getPassArgument().str(),
+				true));
+		PM.add(P);
+		PM.add(new PassStatisticsRecorder(
+				*stats,
+				PI->getPassArgument().str(),
+				false));
+	}
+	else
+	{
+		PM.add(P);
+	}
 
 // if (!PI->isAnalysis())
 // PM.add(P->createPrinterPass(
@@ -430,7 +609,6 @@ static inline void addPass(
 
 }
 
-
 /**
  * TODO: this function has exact copy located in retdec-decompiler.cpp.
  * The reason for this is that right now creation of correct interface that
@@ -460,7 +638,13 @@ void setLogsFrom(const retdec::config::Parameters& params)
 	}
 }
 
-bool decompile(retdec::config::Config& config, std::string* outString)
+namespace {
+
+bool decompile(
+		retdec::config::Config& config,
+		const std::shared_ptr<retdec::fileformat::FileFormat>& inputFile,
+		std::string* outString,
+		const retdec::llvmir2hll::OutputSink* outSink)
 {
 	setLogsFrom(config.parameters);
 
@@ -487,23 +671,30 @@ bool decompile(retdec::config::Config& config, std::string* outString)
 	TLII.disableAllFunctions();
 	pm.add(new TargetLibraryInfoWrapperPass(TLII));
 
-	for (auto& p : config.parameters.llvmPasses)
+	// Per-pass statistics are collected only if requested.
+	//
+	std::vector<PassStatistics> stats;
+	auto& statsFile = config.parameters.getLlvmPassStatsFile();
+
+	for (auto& p : config.parameters.getLlvmPasses())
 	{
 		if (auto* info = passRegistry.getPassInfo(p))
 		{
 			auto* pass = info->createPass();
-			addPass(pm, pass, info);
+			addPass(pm, pass, info, statsFile.empty() ? nullptr : &stats);
 
 			if (info->getTypeInfo() == &bin2llvmir::ProviderInitialization::ID)
 			{
 				auto* p = static_cast<bin2llvmir::ProviderInitialization*>(pass);
 				p->setConfig(&config);
+				p->setInputFile(inputFile);
 			}
 			if (info->getTypeInfo() == &llvmir2hll::LlvmIr2Hll::ID)
 			{
 				auto* p = static_cast<llvmir2hll::LlvmIr2Hll*>(pass);
 				p->setConfig(&config);
 				p->setOutputString(outString);
+				p->setOutputSink(outSink);
 			}
 		}
 		else
@@ -515,7 +706,34 @@ bool decompile(retdec::config::Config& config, std::string* outString)
 	// Now that we have all of the passes ready, run them.
 	pm.run(*module);
 
+	if (!statsFile.empty())
+	{
+		writePassStatistics(statsFile, stats);
+	}
+
 	return EXIT_SUCCESS;
 }
 
+} // anonymous namespace
+
+bool decompile(retdec::config::Config& config, std::string* outString)
+{
+	return decompile(config, nullptr, outString, nullptr);
+}
+
+bool decompile(
+		retdec::config::Config& config,
+		const std::shared_ptr<retdec::fileformat::FileFormat>& inputFile,
+		std::string* outString)
+{
+	return decompile(config, inputFile, outString, nullptr);
+}
+
+bool decompile(
+		retdec::config::Config& config,
+		const retdec::llvmir2hll::OutputSink& outSink)
+{
+	return decompile(config, nullptr, nullptr, &outSink);
+}
+
 } // namespace retdec
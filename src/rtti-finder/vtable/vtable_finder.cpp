@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <iostream>
 
 #include "retdec/loader/loader/image.h"
@@ -20,49 +21,307 @@ using namespace retdec::common;
 using namespace retdec::utils;
 using namespace retdec::rtti_finder;
 
-void findPossibleVtables(
+namespace {
+
+/**
+ * Sorted table of disjoint address ranges which pointers can point to, i.e.
+ * addresses for which @c Image::hasDataOnAddress() is @c true.
+ */
+class PointerTargets
+{
+	public:
+		PointerTargets(const retdec::loader::Image* img);
+
+		bool contains(std::uint64_t address) const;
+		void markPointers(
+				const std::vector<std::uint64_t>& words,
+				std::vector<std::uint8_t>& isPointer) const;
+		bool overlapsOtherSegment(const retdec::loader::Segment* seg) const;
+
+	private:
+		std::vector<std::uint64_t> _starts;
+		std::vector<std::uint64_t> _ends;
+		/// Lowest and highest (exclusive) address of all the ranges.
+		std::uint64_t _low = 0;
+		std::uint64_t _high = 0;
+		/// Segments which share some addresses with other segments.
+		std::set<const retdec::loader::Segment*> _overlapping;
+};
+
+PointerTargets::PointerTargets(const retdec::loader::Image* img)
+{
+	auto& segs = img->getSegments();
+
+	std::vector<std::uint64_t> bounds;
+	for (auto& seg : segs)
+	{
+		bounds.push_back(seg->getAddress());
+		bounds.push_back(seg->getEndAddress());
+	}
+	std::sort(bounds.begin(), bounds.end());
+	bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+	// Segment bounds split addresses into ranges covered by the same set of
+	// segments. Image uses the first segment containing an address.
+	for (std::size_t i = 0; i + 1 < bounds.size(); ++i)
+	{
+		const retdec::loader::Segment* first = nullptr;
+		for (auto& seg : segs)
+		{
+			if (!seg->containsAddress(bounds[i]))
+			{
+				continue;
+			}
+			if (first == nullptr)
+			{
+				first = seg.get();
+			}
+			else
+			{
+				_overlapping.insert(first);
+				_overlapping.insert(seg.get());
+			}
+		}
+
+		if (first == nullptr
+				|| first->getSecSeg() == nullptr
+				|| first->getSecSeg()->isDebug())
+		{
+			continue;
+		}
+		if (!_ends.empty() && _ends.back() == bounds[i])
+		{
+			_ends.back() = bounds[i + 1];
+		}
+		else
+		{
+			_starts.push_back(bounds[i]);
+			_ends.push_back(bounds[i + 1]);
+		}
+	}
+
+	if (!_starts.empty())
+	{
+		_low = _starts.front();
+		_high = _ends.back();
+	}
+}
+
+bool PointerTargets::contains(std::uint64_t address) const
+{
+	auto it = std::upper_bound(_starts.begin(), _starts.end(), address);
+	if (it == _starts.begin())
+	{
+		return false;
+	}
+	return address < _ends[it - _starts.begin() - 1];
+}
+
+/**
+ * Sets @c isPointer[i] to @c 1 if @c words[i] points to some range.
+ * Most of the words in data segments are not addresses, they are rejected
+ * by a branch-free comparison with the bounds of all ranges first.
+ */
+void PointerTargets::markPointers(
+		const std::vector<std::uint64_t>& words,
+		std::vector<std::uint8_t>& isPointer) const
+{
+	isPointer.resize(words.size());
+	auto low = _low;
+	auto high = _high;
+	for (std::size_t i = 0; i < words.size(); ++i)
+	{
+		isPointer[i] = (words[i] >= low) & (words[i] < high);
+	}
+	for (std::size_t i = 0; i < words.size(); ++i)
+	{
+		if (isPointer[i])
+		{
+			isPointer[i] = contains(words[i]);
+		}
+	}
+}
+
+bool PointerTargets::overlapsOtherSegment(
+		const retdec::loader::Segment* seg) const
+{
+	return _overlapping.count(seg);
+}
+
+/**
+ * Reads all the words which are completely inside segment @a seg.
+ * Bytes which are not physically present in the file are zeros, as in
+ * @c Segment::getBytes().
+ */
+std::vector<std::uint64_t> readSegmentWords(
 		const retdec::loader::Image* img,
+		const retdec::loader::Segment* seg)
+{
+	auto wordSz = img->getBytesPerWord();
+	bool little = img->isLittleEndian();
+	auto raw = seg->getRawData();
+	std::uint64_t physSize = raw.first ? raw.second : 0;
+
+	std::vector<std::uint64_t> words(seg->getSize() / wordSz);
+	for (std::size_t i = 0; i < words.size(); ++i)
+	{
+		std::uint64_t offset = i * wordSz;
+		std::uint64_t val = 0;
+		for (std::size_t b = 0; b < wordSz && offset + b < physSize; ++b)
+		{
+			std::uint64_t byte = raw.first[offset + b];
+			val |= byte << (8 * (little ? b : wordSz - b - 1));
+		}
+		words[i] = val;
+	}
+	return words;
+}
+
+/**
+ * Finds possible vtables in segment @a seg by the same rules as
+ * @c findPossibleVtablesSlow(), but reads and tests all its words at once.
+ * Only words near the segment end, which may be read from other segments,
+ * are read through @c Image.
+ */
+void findPossibleVtablesInSegment(
+		const retdec::loader::Image* img,
+		const PointerTargets& targets,
+		const retdec::loader::Segment* seg,
 		std::set<retdec::common::Address>& possibleVtables,
 		bool gcc)
 {
 	auto wordSz = img->getBytesPerWord();
+	auto words = readSegmentWords(img, seg);
+	std::vector<std::uint8_t> isPtr;
+	targets.markPointers(words, isPtr);
 
-	for (auto& seg : img->getSegments())
+	auto start = seg->getAddress();
+	auto isPointer = [&](std::size_t i)
 	{
-		if (seg->getSecSeg() && !seg->getSecSeg()->isSomeData())
+		return i < words.size()
+				? isPtr[i] != 0
+				: img->isPointer(start + i * wordSz);
+	};
+
+	auto end = seg->getEndAddress();
+	for (std::size_t i = 0; start + i * wordSz + wordSz < end; ++i)
+	{
+		std::uint64_t val = 0;
+		if (i < words.size())
+		{
+			val = words[i];
+		}
+		else if (!img->getWord(start + i * wordSz, val))
 		{
 			continue;
 		}
 
-		auto addr = seg->getAddress();
-		auto end = seg->getEndAddress();
-		while (addr + wordSz < end)
+		if (gcc && val != 0)
 		{
-			std::uint64_t val = 0;
-			if (!img->getWord(addr, val))
-			{
-				addr += wordSz;
-				continue;
-			}
+			continue;
+		}
 
-			if (gcc && val != 0)
-			{
-				addr += wordSz;
-				continue;
-			}
+		if (!isPointer(i + 1) || !isPointer(i + 2))
+		{
+			continue;
+		}
 
-			Address item1 = addr + wordSz;
-			Address item2 = item1 + wordSz;
+		possibleVtables.insert(start + (i + 2) * wordSz);
+		// Continue with the second item.
+		i += 1;
+	}
+}
 
-			if (!img->isPointer(item1)
-					|| !img->isPointer(item2))
-			{
-				addr += wordSz;
-				continue;
-			}
+/**
+ * Finds possible vtables in segment @a seg word by word through @c Image.
+ */
+void findPossibleVtablesSlow(
+		const retdec::loader::Image* img,
+		const retdec::loader::Segment* seg,
+		std::set<retdec::common::Address>& possibleVtables,
+		bool gcc)
+{
+	auto wordSz = img->getBytesPerWord();
+
+	auto addr = seg->getAddress();
+	auto end = seg->getEndAddress();
+	while (addr + wordSz < end)
+	{
+		std::uint64_t val = 0;
+		if (!img->getWord(addr, val))
+		{
+			addr += wordSz;
+			continue;
+		}
 
-			possibleVtables.insert(item2);
-			addr = item2;
+		if (gcc && val != 0)
+		{
+			addr += wordSz;
+			continue;
+		}
+
+		Address item1 = addr + wordSz;
+		Address item2 = item1 + wordSz;
+
+		if (!img->isPointer(item1)
+				|| !img->isPointer(item2))
+		{
+			addr += wordSz;
+			continue;
+		}
+
+		possibleVtables.insert(item2);
+		addr = item2;
+	}
+}
+
+} // anonymous namespace
+
+/**
+ * Finds addresses of possible vtables in data segments of @a img, i.e. the
+ * second of two consecutive pointers. With @a gcc, the word before them must
+ * be zero.
+ *
+ * If @a bulk is set, segments are scanned in bulk where possible, otherwise
+ * word by word through @c Image. Both give the same results.
+ *
+ * @note This method is defined outside the namespace retdec::rtti_finder with
+ *       explicit namespace declarations to help Doxygen and prevent it from
+ *       generating "no matching file member found for" warnings.
+ */
+void retdec::rtti_finder::findPossibleVtables(
+		const retdec::loader::Image* img,
+		std::set<retdec::common::Address>& possibleVtables,
+		bool gcc,
+		bool bulk)
+{
+	auto wordSz = img->getBytesPerWord();
+	bulk = bulk
+			&& img->getByteLength() == 8
+			&& wordSz > 0 && wordSz <= sizeof(std::uint64_t)
+			&& (img->isLittleEndian() || img->isBigEndian());
+	PointerTargets targets(img);
+
+	for (auto& seg : img->getSegments())
+	{
+		if (seg->getSecSeg() && !seg->getSecSeg()->isSomeData())
+		{
+			continue;
+		}
+
+		// Words of overlapping segments may be read from other segments.
+		if (bulk && !targets.overlapsOtherSegment(seg.get()))
+		{
+			findPossibleVtablesInSegment(
+					img,
+					targets,
+					seg.get(),
+					possibleVtables,
+					gcc);
+		}
+		else
+		{
+			findPossibleVtablesSlow(img, seg.get(), possibleVtables, gcc);
 		}
 	}
 }
@@ -0,0 +1,79 @@
+/**
+ * @file src/tokens2jsontool/tokens2json.cpp
+ * @brief Converter of the binary token output of the decompiler into JSON.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "retdec/hlltokens/binary_token_reader.h"
+#include "retdec/hlltokens/json_converter.h"
+#include "retdec/utils/io/log.h"
+
+using namespace retdec::hlltokens;
+using namespace retdec::utils::io;
+
+/**
+ * @brief String constant containing help.
+ */
+const std::string helpmsg =
+	"Usage:\n"
+	"\tretdec-tokens2json [-h, --help]                       | Show this help.\n"
+	"\tretdec-tokens2json [--pretty] <input> [output.json]   | Convert binary tokens (output format 'binary') into JSON.\n"
+	"\t                                                      | Output defaults to the standard output.\n";
+
+/**
+ * @brief Main function of the binary tokens converter.
+ */
+int main(int argc, char *argv[])
+{
+	if (argc <= 1 || strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)
+	{
+		Log::info() << helpmsg;
+		return 0;
+	}
+
+	int argi = 1;
+	bool pretty = false;
+	if (strcmp(argv[argi], "--pretty") == 0)
+	{
+		pretty = true;
+		++argi;
+	}
+	if (argc - argi != 1 && argc - argi != 2)
+	{
+		Log::error() << helpmsg;
+		return 1;
+	}
+	std::string inPath = argv[argi];
+
+	try
+	{
+		BinaryTokenReader reader;
+		reader.openFile(inPath);
+
+		if (argc - argi == 2)
+		{
+			std::ofstream out(argv[argi + 1], std::ios::binary);
+			if (!out)
+			{
+				Log::error() << "Error: failed to open " << argv[argi + 1] << std::endl;
+				return 1;
+			}
+			convertToJson(reader, out, pretty);
+		}
+		else
+		{
+			convertToJson(reader, std::cout, pretty);
+		}
+	}
+	catch (const BinaryTokenReaderError& e)
+	{
+		Log::error() << "Error: " << inPath << ": " << e.what() << std::endl;
+		return 1;
+	}
+	return 0;
+}
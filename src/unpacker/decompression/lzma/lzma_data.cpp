@@ -20,7 +20,7 @@ namespace unpacker {
  * @param lc Property of LZMA.
  */
 LzmaData::LzmaData(const DynamicBuffer& buffer, uint8_t pb, uint8_t lp, uint8_t lc) : CompressedData(buffer),
-		_readPos(0), _pb(pb), _lp(lp), _lc(lc), _rangeDecoder()
+		_input(), _readPos(0), _pb(pb), _lp(lp), _lc(lc), _rangeDecoder()
 {
 }
 
@@ -39,6 +39,8 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 	// Reset just in case decompress() is called more times in row
 	_readPos = 0;
 	_rangeDecoder.reset();
+	_input = InputView(_buffer);
+	OutputWindow output(outputBuffer);
 
 	// 42D175
 	uint8_t previousByte = 0;
@@ -51,9 +53,9 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 	_rangeDecoder.decoder.resize((0x300 << (_lc + _lp)) + 0x736, 0x400);
 	_rangeDecoder.range = std::numeric_limits<uint32_t>::max();
 	for (uint8_t i = 0; i < 5; ++i)
-		_rangeDecoder.code = (_rangeDecoder.code << 8) | _buffer.read<uint8_t>(_readPos++);
+		_rangeDecoder.code = (_rangeDecoder.code << 8) | _input.read(_readPos++);
 
-	while (pos < outputBuffer.getCapacity() && _readPos < _buffer.getRealDataSize())
+	while (pos < output.capacity() && _readPos < _input.size())
 	{
 		uint32_t bit;
 		uint32_t posState = pos & posStateMask;
@@ -74,12 +76,12 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 			else
 			{
 				// 42d322
-				if (!decodeLiteral(literalPos, previousByte, true, outputBuffer.read<uint8_t>(pos - rep[0])))
+				if (!decodeLiteral(literalPos, previousByte, true, output.read(pos - rep[0])))
 					return false;
 			}
 
 			// 42d45d
-			outputBuffer.write<uint8_t>(previousByte, pos++);
+			output.write(pos++, previousByte);
 			state = (state <= 3) ? 0 : ((state <= 9) ? (state - 3) : (state - 6));
 		}
 		else
@@ -126,11 +128,8 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 						return false;
 
 					len += 2;
-					do
-					{
-						previousByte = outputBuffer.read<uint8_t>(pos - rep[0]);
-						outputBuffer.write<uint8_t>(previousByte, pos++);
-					} while (--len && pos < outputBuffer.getCapacity());
+					output.copy(pos, rep[0], len);
+					previousByte = output.read(pos - 1);
 				}
 				// 42d5aa
 				else
@@ -153,11 +152,8 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 							return false;
 
 						len += 2;
-						do
-						{
-							previousByte = outputBuffer.read<uint8_t>(pos - rep[0]);
-							outputBuffer.write<uint8_t>(previousByte, pos++);
-						} while (--len && pos < outputBuffer.getCapacity());
+						output.copy(pos, rep[0], len);
+						previousByte = output.read(pos - 1);
 					}
 					// 42d614
 					else
@@ -166,8 +162,8 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 							return false;
 
 						state = (state <= 6) ? 9 : 11;
-						previousByte = outputBuffer.read<uint8_t>(pos - rep[0]);
-						outputBuffer.write<uint8_t>(previousByte, pos++);
+						previousByte = output.read(pos - rep[0]);
+						output.write(pos++, previousByte);
 					}
 				}
 			}
@@ -219,11 +215,8 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 					return false;
 
 				len += 2;
-				do
-				{
-					previousByte = outputBuffer.read<uint8_t>(pos - rep[0]);
-					outputBuffer.write<uint8_t>(previousByte, pos++);
-				} while (--len && pos < outputBuffer.getCapacity());
+				output.copy(pos, rep[0], len);
+				previousByte = output.read(pos - 1);
 			}
 		}
 	}
@@ -237,7 +230,7 @@ bool LzmaData::decodeBit(uint32_t pos, uint32_t& bit)
 	if (_rangeDecoder.range <= 0xFFFFFF)
 	{
 		_rangeDecoder.range <<= 8;
-		_rangeDecoder.code = (_rangeDecoder.code << 8) | _buffer.read<uint8_t>(_readPos++);
+		_rangeDecoder.code = (_rangeDecoder.code << 8) | _input.read(_readPos++);
 	}
 
 	if (pos >= _rangeDecoder.decoder.size())
@@ -395,7 +388,7 @@ bool LzmaData::decodeDirectBits(uint32_t count, uint32_t initValue, uint32_t& re
 		if (_rangeDecoder.range <= 0xFFFFFF)
 		{
 			_rangeDecoder.range <<= 8;
-			_rangeDecoder.code = (_rangeDecoder.code << 8) | _buffer.read<uint8_t>(_readPos++);
+			_rangeDecoder.code = (_rangeDecoder.code << 8) | _input.read(_readPos++);
 		}
 
 		_rangeDecoder.range >>= 1;
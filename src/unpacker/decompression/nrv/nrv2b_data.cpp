@@ -19,34 +19,44 @@ bool Nrv2bData::decompress(DynamicBuffer& outputBuffer)
 	// Reset just in case decompress() is called more times in row
 	reset();
 
+	return withBitGetter([&](auto& bitGetter) {
+		return decompress(bitGetter, outputBuffer);
+	});
+}
+
+template <typename BitGetter> bool Nrv2bData::decompress(BitGetter& bitGetter, DynamicBuffer& outputBuffer)
+{
+	InputView input(_buffer);
+	OutputWindow output(outputBuffer);
+
 	int32_t lastDist = 1;
 	uint8_t bit;
 
 	while (true)
 	{
-		if (!_bitParser->getBit(bit, _buffer, _readPos))
+		if (!bitGetter.getBit(bit, input, _readPos))
 			return false;
 
 		while (bit == 1)
 		{
-			if (_writePos >= outputBuffer.getCapacity() || _readPos >= _buffer.getRealDataSize())
+			if (_writePos >= output.capacity() || _readPos >= input.size())
 				return false;
 
-			outputBuffer.write<uint8_t>(_buffer.read<uint8_t>(_readPos++), _writePos++);
+			output.write(_writePos++, input.read(_readPos++));
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitGetter.getBit(bit, input, _readPos))
 				return false;
 		}
 
 		int32_t dist = 1;
 		do
 		{
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitGetter.getBit(bit, input, _readPos))
 				return false;
 
 			dist += dist + bit;
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitGetter.getBit(bit, input, _readPos))
 				return false;
 		} while (bit == 0);
 
@@ -56,22 +66,22 @@ bool Nrv2bData::decompress(DynamicBuffer& outputBuffer)
 		}
 		else
 		{
-			if (_readPos >= _buffer.getRealDataSize())
+			if (_readPos >= input.size())
 				return false;
 
-			dist = ((dist - 3) << 8) | _buffer.read<uint8_t>(_readPos++);
+			dist = ((dist - 3) << 8) | input.read(_readPos++);
 			if (dist == -1)
 				return true;
 
 			lastDist = ++dist;
 		}
 
-		if (!_bitParser->getBit(bit, _buffer, _readPos))
+		if (!bitGetter.getBit(bit, input, _readPos))
 			return false;
 
 		int32_t count = bit << 1;
 
-		if (!_bitParser->getBit(bit, _buffer, _readPos))
+		if (!bitGetter.getBit(bit, input, _readPos))
 			return false;
 
 		count += bit;
@@ -82,12 +92,12 @@ bool Nrv2bData::decompress(DynamicBuffer& outputBuffer)
 
 			do
 			{
-				if (!_bitParser->getBit(bit, _buffer, _readPos))
+				if (!bitGetter.getBit(bit, input, _readPos))
 					return false;
 
 				count += count + bit;
 
-				if (!_bitParser->getBit(bit, _buffer, _readPos))
+				if (!bitGetter.getBit(bit, input, _readPos))
 					return false;
 			} while (bit == 0);
 
@@ -96,15 +106,9 @@ bool Nrv2bData::decompress(DynamicBuffer& outputBuffer)
 
 		count += (dist > 0xD00) + 1;
 
-		uint32_t srcPos = static_cast<int32_t>(_writePos) - dist;
-		do
-		{
-			if (_writePos >= outputBuffer.getCapacity())
-				return false;
-
-			outputBuffer.write<uint8_t>(outputBuffer.read<uint8_t>(srcPos++), _writePos++);
-		}
-		while (--count);
+		// Zero count wraps around, the copy then runs out of the capacity
+		if (!output.copy(_writePos, dist, count == 0 ? UINT32_MAX : count))
+			return false;
 	}
 }
 
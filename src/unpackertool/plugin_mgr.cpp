@@ -60,5 +60,25 @@ PluginList PluginMgr::matchingPlugins(const std::string& packerName, const std::
 	return result;
 }
 
+/**
+ * Find the registered plugins which detect their packer in the already parsed file.
+ * Unlike the detection by @c cpdetect, only the checks of the plugins are performed.
+ *
+ * @param file The parsed input file.
+ *
+ * @return The list of detecting plugins.
+ */
+PluginList PluginMgr::detectingPlugins(const retdec::fileformat::FileFormat& file)
+{
+	PluginList result;
+	for (const auto& plugin : plugins)
+	{
+		if (plugin->detect(file))
+			result.push_back(plugin);
+	}
+
+	return result;
+}
+
 } // namepsace unpackertool
 } // namepsace retdec
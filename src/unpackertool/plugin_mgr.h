@@ -14,6 +14,10 @@
 #include <vector>
 
 namespace retdec {
+namespace fileformat {
+class FileFormat;
+} // namespace fileformat
+
 namespace unpackertool {
 
 #define WILDCARD_ALL_VERSIONS   ""
@@ -41,6 +45,7 @@ public:
 	static const PluginList plugins;
 
 	static PluginList matchingPlugins(const std::string& packerName, const std::string& packerVersion);
+	static PluginList detectingPlugins(const retdec::fileformat::FileFormat& file);
 
 private:
 	PluginMgr() = default;
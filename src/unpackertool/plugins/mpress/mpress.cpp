@@ -70,17 +70,32 @@ MpressPlugin::~MpressPlugin()
 	cleanup();
 }
 
+/**
+ * Checks whether the file is packed by MPRESS according to the names of the sections MPRESS creates.
+ *
+ * @param file The parsed input file.
+ *
+ * @return @c true if the file is packed by MPRESS, otherwise @c false.
+ */
+bool MpressPlugin::detect(const retdec::fileformat::FileFormat& file) const
+{
+	return file.getFileFormat() == retdec::fileformat::Format::PE
+			&& file.getSection(".MPRESS1") != nullptr
+			&& file.getSection(".MPRESS2") != nullptr;
+}
+
 /**
  * Performs preparation of unpacking.
  */
 void MpressPlugin::prepare()
 {
-	_file = retdec::loader::createImage(getStartupArguments()->inputFile);
+	_file = createInputImage();
 	if (!_file)
 		throw UnsupportedFileException();
 
-	_peFile = new PeLib::PeFileT(getStartupArguments()->inputFile);
-	if(_peFile->loadPeHeaders() != PeLib::ERROR_NONE)
+	// The headers are loaded from the content of the input file which was already read
+	_peFile = new PeLib::PeFileT();
+	if(_peFile->loadPeHeaders(_file->getFileFormat()->getBytes()) != PeLib::ERROR_NONE)
 		throw UnsupportedFileException();
 
 	// We currently don't support PE32+ as the decompiler doesn't support them anyways
@@ -68,6 +68,7 @@ public:
 	MpressPlugin();
 	virtual ~MpressPlugin() override;
 
+	virtual bool detect(const retdec::fileformat::FileFormat& file) const override;
 	virtual void prepare() override;
 	virtual void unpack() override;
 	virtual void cleanup() override;
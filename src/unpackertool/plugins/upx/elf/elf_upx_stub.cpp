@@ -11,6 +11,7 @@
 
 #include "retdec/utils/alignment.h"
 #include "retdec/utils/file_io.h"
+#include "retdec/fileformat/utils/byte_array_buffer.h"
 #include "retdec/loader/loader.h"
 #include "unpackertool/plugins/upx/decompressors/decompressors.h"
 #include "unpackertool/plugins/upx/elf/elf_upx_stub.h"
@@ -110,8 +111,8 @@ template <int bits> void ElfUpxStub<bits>::unpack(const std::string& outputFile)
 	// We need to do this hack, because UPX doesn't map its whole content to the segments
 	// Especially content that is not needed during the runtime, but is important for original file reconstruction
 	//  such as section headers, string tables, etc.
-	// Thus there is no way we can get this data through fileformat nor elfio
-	std::string inputFilePath = _file->getFileFormat()->getPathToFile();
+	// Thus there is no way we can get this data through fileformat nor elfio, they are read from the bytes of the input file
+	const auto& inputBytes = _file->getFileFormat()->getBytes();
 
 	unsigned long long ep;
 	_file->getFileFormat()->getEpAddress(ep);
@@ -122,7 +123,8 @@ template <int bits> void ElfUpxStub<bits>::unpack(const std::string& outputFile)
 	// UPX recognizes this by using UPX metadata which we don't want to rely on, so we do these heuristic analyses
 	// If there is enough data between the last packed block and EP to store packed block header, we check whether it is a valid block
 	// If it isn't, we assume that these additional data are located at the end
-	std::ifstream additionalDataFile(inputFilePath, std::ios::in | std::ios::binary);
+	retdec::fileformat::byte_array_buffer additionalDataBuffer(inputBytes.data(), inputBytes.size());
+	std::istream additionalDataFile(&additionalDataBuffer);
 	AddressType additionalDataPos = 0, additionalDataSize = 0;
 	bool additionalDataBehindStub = false;
 
@@ -193,7 +195,6 @@ template <int bits> void ElfUpxStub<bits>::unpack(const std::string& outputFile)
 
 	std::vector<std::uint8_t> additionalDataBytes;
 	retdec::utils::readFile(additionalDataFile, additionalDataBytes, additionalDataPos, additionalDataSize);
-	additionalDataFile.close();
 
 	DynamicBuffer additionalData(additionalDataBytes, _file->getFileFormat()->getEndianness());
 
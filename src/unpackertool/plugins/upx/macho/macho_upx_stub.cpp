@@ -9,6 +9,7 @@
 #include "retdec/utils/alignment.h"
 #include "retdec/utils/file_io.h"
 #include "retdec/fileformat/fileformat.h"
+#include "retdec/fileformat/utils/byte_array_buffer.h"
 #include "unpackertool/plugins/upx/decompressors/decompressors.h"
 #include "unpackertool/plugins/upx/macho/macho_upx_stub.h"
 #include "unpackertool/plugins/upx/unfilter.h"
@@ -81,7 +82,10 @@ template <int bits> MachOUpxStub<bits>::MachOUpxStub(retdec::loader::Image* inpu
 template <int bits> void MachOUpxStub<bits>::unpack(const std::string& outputFile)
 {
 	std::ofstream output(outputFile, std::ios::out | std::ios::trunc | std::ios::binary);
-	std::ifstream input(_file->getFileFormat()->getPathToFile(), std::ios::in | std::ios::binary);
+	// The input file is read from its bytes, it may exist only in memory.
+	const auto& inputBytes = _file->getFileFormat()->getBytes();
+	retdec::fileformat::byte_array_buffer inputBuffer(inputBytes.data(), inputBytes.size());
+	std::istream input(&inputBuffer);
 
 	auto fileFormat = _file->getFileFormatWptr().lock();
 	auto machoFormat = static_cast<retdec::fileformat::MachOFormat*>(fileFormat.get());
@@ -142,7 +146,6 @@ template <int bits> void MachOUpxStub<bits>::unpack(const std::string& outputFil
 		retdec::utils::writeFile(output, fatHeader.getBuffer());
 	}
 
-	input.close();
 	output.close();
 }
 
@@ -167,7 +170,7 @@ template <int bits> void MachOUpxStub<bits>::decompress(DynamicBuffer& packedDat
 	_decompressor->decompress(this, packedData, unpackedData);
 }
 
-template <int bits> void MachOUpxStub<bits>::unpack(std::ifstream& inputFile, std::ofstream& outputFile, std::uint64_t baseInputOffset, std::uint64_t baseOutputOffset)
+template <int bits> void MachOUpxStub<bits>::unpack(std::istream& inputFile, std::ofstream& outputFile, std::uint64_t baseInputOffset, std::uint64_t baseOutputOffset)
 {
 	// Move to the specific offset of the first packed block.
 	inputFile.seekg(baseInputOffset + getFirstBlockOffset(inputFile), std::ios::beg);
@@ -229,7 +232,7 @@ template <int bits> void MachOUpxStub<bits>::unpack(std::ifstream& inputFile, st
 	}
 }
 
-template <int bits> std::uint32_t MachOUpxStub<bits>::getFirstBlockOffset(std::ifstream& inputFile) const
+template <int bits> std::uint32_t MachOUpxStub<bits>::getFirstBlockOffset(std::istream& inputFile) const
 {
 	auto machoFormat = static_cast<retdec::fileformat::MachOFormat*>(_file->getFileFormat());
 
@@ -248,7 +251,7 @@ template <int bits> std::uint32_t MachOUpxStub<bits>::getFirstBlockOffset(std::i
 	return firstBlockOffset + (itr - firstBlockBytes.begin()) + FirstBlockOffset;
 }
 
-template <int bits> DynamicBuffer MachOUpxStub<bits>::readNextBlock(std::ifstream& inputFile)
+template <int bits> DynamicBuffer MachOUpxStub<bits>::readNextBlock(std::istream& inputFile)
 {
 	const std::size_t blockFilePos = inputFile.tellg();
 
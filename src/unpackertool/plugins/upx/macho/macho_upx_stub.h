@@ -78,11 +78,11 @@ public:
 	void setupPackingMethod(std::uint8_t packingMethod);
 	void decompress(DynamicBuffer& packedData, DynamicBuffer& unpackedData);
 
-	void unpack(std::ifstream& inputFile, std::ofstream& outputFile, std::uint64_t baseInputOffset, std::uint64_t baseOutputOffset);
+	void unpack(std::istream& inputFile, std::ofstream& outputFile, std::uint64_t baseInputOffset, std::uint64_t baseOutputOffset);
 
 protected:
-	std::uint32_t getFirstBlockOffset(std::ifstream& inputFile) const;
-	DynamicBuffer readNextBlock(std::ifstream& inputFile);
+	std::uint32_t getFirstBlockOffset(std::istream& inputFile) const;
+	DynamicBuffer readNextBlock(std::istream& inputFile);
 	DynamicBuffer unpackBlock(DynamicBuffer& packedBlock);
 	void unfilterBlock(const DynamicBuffer& packedBlock, DynamicBuffer& unpackedData);
 
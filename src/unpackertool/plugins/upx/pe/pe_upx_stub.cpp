@@ -183,12 +183,11 @@ template <int bits> void PeUpxStub<bits>::unpack(const std::string& outputFile)
 	// Detect auxiliary stubs
 	detectUnfilter(unpackingStub);
 
-	// Create new instance of a PeFileT class
-	std::string inputFilePath = _file->getFileFormat()->getPathToFile();
-	_newPeFile = new PeLib::PeFileT(inputFilePath);
+	// Create new instance of a PeFileT class, the input file may exist only in memory
+	_newPeFile = new PeLib::PeFileT();
 
-	// Read MZ & PE headers
-	_newPeFile->loadPeHeaders();
+	// Read MZ & PE headers from the content of the input file which was already read
+	_newPeFile->loadPeHeaders(_file->getFileFormat()->getBytes());
 
 	// We won't copy the DOS program so let's just set the pointer to PE header right after MZ header
 	_newPeFile->imageLoader().setPeHeaderOffset(sizeof(PeLib::PELIB_IMAGE_DOS_HEADER));
@@ -1117,9 +1116,7 @@ template <int bits> void PeUpxStub<bits>::fixCoffSymbolTable()
 		if (_file->getFileFormat()->getLoadedFileLength() > totalSectionSize)
 		{
 			// Read whole COFF symbol table
-			std::ifstream inputFileHandle(_file->getFileFormat()->getPathToFile(), std::ios::binary | std::ios::in);
-			retdec::utils::readFile(inputFileHandle, _coffSymbolTable, totalSectionSize, _file->getFileFormat()->getLoadedFileLength() - totalSectionSize);
-			inputFileHandle.close();
+			_file->getFileFormat()->getBytes(_coffSymbolTable, totalSectionSize, _file->getFileFormat()->getLoadedFileLength() - totalSectionSize);
 
 			// Calculate the offset where to write COFF symbols in unpacked file by calculating raw sizes of all sections in unpacked file
 			std::uint32_t newSymbolTablePointer = imageLoader.getSectionHeader(0)->PointerToRawData;
@@ -1252,12 +1249,11 @@ template <int bits> void PeUpxStub<bits>::saveFile(const std::string& outputFile
 	if (_file->getFileFormat()->getDeclaredFileLength() < _file->getFileFormat()->getLoadedFileLength())
 	{
 		std::uint32_t overlaySize = static_cast<std::uint32_t>(_file->getFileFormat()->getLoadedFileLength() - _file->getFileFormat()->getDeclaredFileLength());
-		std::vector<std::uint8_t> overlay(overlaySize);
+		std::vector<std::uint8_t> overlay;
 
 		upx_plugin->log("Packed file has overlay with size of 0x", std::hex, overlaySize, std::dec, " bytes. Copying into unpacked file.");
 
-		std::fstream inputFileHandle(_file->getFileFormat()->getPathToFile(), std::ios::binary | std::ios::in);
-		retdec::utils::readFile(inputFileHandle, overlay, _file->getFileFormat()->getDeclaredFileLength(), overlaySize);
+		_file->getFileFormat()->getBytes(overlay, _file->getFileFormat()->getDeclaredFileLength(), overlaySize);
 
 		std::fstream outputFileHandle(outputFile, std::ios::binary | std::ios::out | std::ios::in);
 		outputFileHandle.seekp(0, std::ios::end);
@@ -40,12 +40,40 @@ UpxPlugin::~UpxPlugin()
 	cleanup();
 }
 
+/**
+ * Checks whether the file is packed by UPX. The known unpacking stubs are
+ * matched at the entry point, PE files are also recognized by the names of
+ * the sections UPX creates. Files with unknown stubs are recognized by valid
+ * UPX metadata, they are unpacked according to the metadata.
+ *
+ * @param file The parsed input file.
+ *
+ * @return @c true if the file is packed by UPX, otherwise @c false.
+ */
+bool UpxPlugin::detect(const retdec::fileformat::FileFormat& file) const
+{
+	if (file.getFileFormat() == retdec::fileformat::Format::PE && file.getNumberOfSections() > 2
+			&& file.getSection(0)->getName() == "UPX0" && file.getSection(1)->getName() == "UPX1")
+		return true;
+
+	std::vector<std::uint8_t> epBytes;
+	if (file.getEpBytes(epBytes, UpxStubSignatures::getMaxMatchLength()))
+	{
+		DynamicBuffer epData(epBytes, file.getEndianness());
+		DynamicBuffer capturedData(file.getEndianness());
+		if (UpxStubSignatures::matchSignatures(epData, capturedData, file.getTargetArchitecture(), file.getFileFormat()) != nullptr)
+			return true;
+	}
+
+	return UpxMetadata::read(file).isDefined();
+}
+
 /**
  * Performs preparation of unpacking.
  */
 void UpxPlugin::prepare()
 {
-	_file = retdec::loader::createImage(getStartupArguments()->inputFile);
+	_file = createInputImage();
 	if (!_file)
 		throw UnsupportedFileException();
 
@@ -35,6 +35,7 @@ public:
 	UpxPlugin();
 	virtual ~UpxPlugin();
 
+	virtual bool detect(const retdec::fileformat::FileFormat& file) const override;
 	virtual void prepare() override;
 	virtual void unpack() override;
 	virtual void cleanup() override;
@@ -33,28 +33,31 @@ UpxMetadata::UpxMetadata(const UpxMetadata& metadata) : _defined(metadata._defin
 
 UpxMetadata UpxMetadata::read(retdec::loader::Image* file)
 {
-	UpxMetadata metadata;
+	return read(*file->getFileFormat());
+}
 
-	std::vector<std::uint8_t> dataBuffer(1024);
-	std::ifstream inputFile(file->getFileFormat()->getPathToFile(), std::ios::binary | std::ios::in);
+UpxMetadata UpxMetadata::read(const retdec::fileformat::FileFormat& file)
+{
+	UpxMetadata metadata;
 
+	std::uint64_t offset = 0;
 	bool useChecksum = true;
 	bool usePackingMethod = true;
-	switch (file->getFileFormat()->getFileFormat())
+	switch (file.getFileFormat())
 	{
 		// UPX metadata should be in the first 1024 bytes in PE
 		case retdec::fileformat::Format::PE:
-		{
-			inputFile.seekg(0, std::ios::beg);
 			break;
-		}
 		// UPX metadata should be in the last 1024 bytes in ELF
 		case retdec::fileformat::Format::ELF:
 		{
 			// ELF does not use packing method.
 			usePackingMethod = false;
 
-			inputFile.seekg(-1024, std::ios::end);
+			if (file.getFileLength() < 1024)
+				return metadata;
+
+			offset = file.getFileLength() - 1024;
 			break;
 		}
 		// UPX metadata should be in the first 1024 bytes from the chosen architecture offset in Mach-O
@@ -64,16 +67,20 @@ UpxMetadata UpxMetadata::read(retdec::loader::Image* file)
 			useChecksum = false;
 			usePackingMethod = false;
 
-			auto machoFormat = static_cast<retdec::fileformat::MachOFormat*>(file->getFileFormat());
-			inputFile.seekg(machoFormat->getChosenArchitectureOffset(), std::ios::beg);
+			const auto& machoFormat = static_cast<const retdec::fileformat::MachOFormat&>(file);
+			offset = machoFormat.getChosenArchitectureOffset();
 			break;
 		}
 		default:
 			return metadata;
 	}
 
-	inputFile.read(reinterpret_cast<char*>(&dataBuffer[0]), 1024);
-	DynamicBuffer data(dataBuffer, file->getFileFormat()->getEndianness());
+	// The metadata are read from the bytes of the parsed file, the file
+	// may have no path (e.g. a slice or an archive member in memory).
+	std::vector<std::uint8_t> dataBuffer;
+	file.getBytes(dataBuffer, offset, 1024);
+	dataBuffer.resize(1024);
+	DynamicBuffer data(dataBuffer, file.getEndianness());
 
 	std::string pattern = "UPX!";
 	for (size_t i = 0; i < 1024 - pattern.length(); ++i)
@@ -66,6 +66,7 @@ public:
 	UpxMetadata(const UpxMetadata& metadata);
 
 	static UpxMetadata read(retdec::loader::Image* file);
+	static UpxMetadata read(const retdec::fileformat::FileFormat& file);
 	static std::uint8_t calcChecksum(const DynamicBuffer& data);
 	static std::uint32_t getSizeOfVersion(std::uint8_t version);
 
@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "unpackertool/plugins/upx/upx_stub_signatures.h"
 
 using namespace retdec::fileformat;
@@ -1801,6 +1803,20 @@ const UpxStubData* UpxStubSignatures::matchSignatures(const DynamicBuffer& data,
 	return nullptr;
 }
 
+/**
+ * Returns the number of bytes from the entry point which are enough to match any of the supported signatures.
+ *
+ * @return Maximum length of the signature including its search distance.
+ */
+std::uint64_t UpxStubSignatures::getMaxMatchLength()
+{
+	std::uint64_t maxLength = 0;
+	for (const UpxStubData& stubData : allStubs)
+		maxLength = std::max(maxLength, stubData.signature->getSize() + stubData.searchDistance);
+
+	return maxLength;
+}
+
 } // namespace upx
 } // namespace unpackertool
 } // namespace retdec
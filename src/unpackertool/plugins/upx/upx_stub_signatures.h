@@ -58,6 +58,7 @@ public:
 	static const UpxStubData* matchSignatures(retdec::loader::Image* file, DynamicBuffer& captureData);
 	static const UpxStubData* matchSignatures(const DynamicBuffer& data, DynamicBuffer& captureData,
 			retdec::fileformat::Architecture architecture = retdec::fileformat::Architecture::UNKNOWN, retdec::fileformat::Format format = retdec::fileformat::Format::UNKNOWN);
+	static std::uint64_t getMaxMatchLength();
 
 private:
 	UpxStubSignatures& operator =(const UpxStubSignatures&);
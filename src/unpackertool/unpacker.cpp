@@ -56,7 +56,7 @@ bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::D
 			return false;
 		default:
 		{
-			auto fileParser = createFileFormat(inputFile);
+			auto fileParser = createFileFormat(inputFile, false, LoadFlags::PROFILE_UNPACKER);
 			if (!fileParser)
 			{
 				Log::error() << "Error while detecting format of file '" << inputFile << "'! Please, report this." << std::endl;
@@ -83,6 +83,28 @@ bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::D
 	return true;
 }
 
+/**
+ * Runs the @a plugins until one of them unpacks the file.
+ *
+ * @return @c true if the file was unpacked. Failure of any plugin is recorded into @a ret.
+ */
+bool runPlugins(const PluginList& plugins, const Plugin::Arguments& pluginArgs, ExitCode& ret)
+{
+	for (const auto& plugin : plugins)
+	{
+		PluginExitCode pluginExitCode = plugin->run(pluginArgs);
+		if (pluginExitCode == PLUGIN_EXIT_UNPACKED)
+		{
+			plugin->log("Successfully unpacked '", pluginArgs.inputFile, "'!");
+			return true;
+		}
+		else if (pluginExitCode == PLUGIN_EXIT_FAILED)
+			ret = EXIT_CODE_UNPACKING_FAILED;
+	}
+
+	return false;
+}
+
 ExitCode unpackFile(const std::string& inputFile, const std::string& outputFile, bool brute, const std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
 {
 	Plugin::Arguments pluginArgs = { inputFile, outputFile, brute };
@@ -101,17 +123,8 @@ ExitCode unpackFile(const std::string& inputFile, const std::string& outputFile,
 			continue;
 		}
 
-		for (const auto& plugin : plugins)
-		{
-			PluginExitCode pluginExitCode = plugin->run(pluginArgs);
-			if (pluginExitCode == PLUGIN_EXIT_UNPACKED)
-			{
-				plugin->log("Successfully unpacked '", inputFile, "'!");
-				return EXIT_CODE_OK;
-			}
-			else if (pluginExitCode == PLUGIN_EXIT_FAILED)
-				ret = EXIT_CODE_UNPACKING_FAILED;
-		}
+		if (runPlugins(plugins, pluginArgs, ret))
+			return EXIT_CODE_OK;
 	}
 
 	return ret;
@@ -198,6 +211,21 @@ ExitCode processArgs(ArgHandler& handler, char argc, char** argv)
 	return EXIT_CODE_OK;
 }
 
+int unpack(const std::shared_ptr<retdec::fileformat::FileFormat>& inputFile, const std::string& outputFile)
+{
+	// Plugins are shared by all the unpacked files, exit codes cached for the previous ones do not apply
+	for (const auto& plugin : PluginMgr::plugins)
+		plugin->resetCachedExitCode();
+
+	Plugin::Arguments pluginArgs = { inputFile->getPathToFile(), outputFile, false, inputFile };
+
+	ExitCode ret = EXIT_CODE_NOTHING_TO_DO;
+	if (runPlugins(PluginMgr::detectingPlugins(*inputFile), pluginArgs, ret))
+		return EXIT_CODE_OK;
+
+	return ret;
+}
+
 int _main(int argc, char** argv)
 {
 	ArgHandler handler("unpacker options [PACKED_FILE] [optional]");
@@ -183,6 +183,17 @@ std::vector<uint8_t> DynamicBuffer::getBuffer() const
 	return _data;
 }
 
+/**
+ * Exchanges the bytes in the buffer with the bytes in @a data. The capacity
+ * of the buffer is not changed, the caller must not exceed it.
+ *
+ * @param data The vector of bytes to exchange with.
+ */
+void DynamicBuffer::swapBuffer(std::vector<uint8_t>& data)
+{
+	_data.swap(data);
+}
+
 /**
  * Gets the raw pointer to the bytes in the buffer.
  *
@@ -0,0 +1,144 @@
+/**
+* @file src/utils/mapped_file.cpp
+* @brief Read-only memory-mapped files.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/utils/file_io.h"
+#include "retdec/utils/mapped_file.h"
+#include "retdec/utils/os.h"
+
+#ifdef OS_POSIX
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Opens the given file.
+*
+* Use isOpen() to check whether the file was successfully opened.
+*/
+MappedFile::MappedFile(const std::string& filePath)
+{
+	open(filePath);
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+/**
+* @brief Opens the given file, closing the previously opened one.
+*
+* @return @c true if the file was opened, @c false otherwise.
+*/
+bool MappedFile::open(const std::string& filePath)
+{
+	close();
+
+#ifdef OS_POSIX
+	int fd = ::open(filePath.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+	{
+		::close(fd);
+		return false;
+	}
+
+	// Empty files cannot be mapped, but they are valid files.
+	if (st.st_size == 0)
+	{
+		::close(fd);
+		_opened = true;
+		return true;
+	}
+
+	void* addr = mmap(
+			nullptr,
+			static_cast<std::size_t>(st.st_size),
+			PROT_READ,
+			MAP_PRIVATE,
+			fd,
+			0
+	);
+	// The mapping stays valid after the descriptor is closed.
+	::close(fd);
+	if (addr != MAP_FAILED)
+	{
+		_data = static_cast<const std::uint8_t*>(addr);
+		_size = static_cast<std::size_t>(st.st_size);
+		_mapped = true;
+		_opened = true;
+		return true;
+	}
+#endif
+
+	// Fallback for systems without mmap() and for files that cannot be
+	// mapped.
+	if (!readFile(filePath, _buffer))
+	{
+		return false;
+	}
+	_data = _buffer.data();
+	_size = _buffer.size();
+	_opened = true;
+	return true;
+}
+
+/**
+* @brief Closes the file and releases its mapping.
+*/
+void MappedFile::close()
+{
+#ifdef OS_POSIX
+	if (_mapped)
+	{
+		munmap(const_cast<std::uint8_t*>(_data), _size);
+	}
+#endif
+
+	_buffer.clear();
+	_buffer.shrink_to_fit();
+	_data = nullptr;
+	_size = 0;
+	_mapped = false;
+	_opened = false;
+}
+
+bool MappedFile::isOpen() const
+{
+	return _opened;
+}
+
+/**
+* @brief Returns @c true if the file is mapped into memory, @c false if its
+*        content was read into a buffer.
+*/
+bool MappedFile::isMapped() const
+{
+	return _mapped;
+}
+
+const std::uint8_t* MappedFile::getData() const
+{
+	return _data;
+}
+
+std::size_t MappedFile::getSize() const
+{
+	return _size;
+}
+
+} // namespace utils
+} // namespace retdec
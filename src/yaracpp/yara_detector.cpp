@@ -358,7 +358,7 @@ bool YaraDetector::analyze(
  *                      store all rules (not only detected)
  * @return @c true if analysis completed without any error, otherwise @c false.
  */
-bool YaraDetector::analyze(std::vector<std::uint8_t> &bytes, bool storeAllRules)
+bool YaraDetector::analyze(const std::vector<std::uint8_t> &bytes, bool storeAllRules)
 {
 	return analyzeWithScan(bytes, storeAllRules);
 }
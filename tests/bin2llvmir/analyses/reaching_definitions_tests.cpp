@@ -44,6 +44,255 @@ DummyTest)
 	EXPECT_EQ( nullptr, module->getGlobalVariable("glob1") );
 }
 
+TEST_F(ReachingDefinitionsTests,
+updateComputesAllFunctionsForTheFirstTime)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @f1() {
+			store i32 1, i32* @r
+			%x = load i32, i32* @r
+			ret void
+		}
+		define void @f2() {
+			%y = load i32, i32* @r
+			ret void
+		}
+	)");
+	auto* s = getNthInstruction<StoreInst>();
+	auto* x = getInstructionByName("x");
+
+	auto stats = RDA.update(*module);
+
+	EXPECT_TRUE(RDA.wasRun());
+	EXPECT_EQ(2, stats.recomputed);
+	EXPECT_EQ(0, stats.reused);
+	ASSERT_EQ(1, RDA.defsFromUse(x).size());
+	EXPECT_EQ(s, (*RDA.defsFromUse(x).begin())->def);
+}
+
+TEST_F(ReachingDefinitionsTests,
+updateRecomputesOnlyChangedFunctions)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @f1() {
+			store i32 1, i32* @r
+			%x = load i32, i32* @r
+			ret void
+		}
+		define void @f2() {
+			store i32 2, i32* @r
+			%y = load i32, i32* @r
+			ret void
+		}
+	)");
+	auto* x = getInstructionByName("x");
+	auto* y = getInstructionByName("y");
+	auto* s2 = getNthInstruction<StoreInst>(1);
+	RDA.update(*module);
+
+	auto stats = RDA.update(*module);
+	EXPECT_EQ(0, stats.recomputed);
+	EXPECT_EQ(2, stats.reused);
+
+	auto* s3 = new StoreInst(
+			ConstantInt::get(Type::getInt32Ty(context), 3),
+			module->getGlobalVariable("r"),
+			x);
+	stats = RDA.update(*module);
+
+	EXPECT_EQ(1, stats.recomputed);
+	EXPECT_EQ(1, stats.reused);
+	ASSERT_EQ(1, RDA.defsFromUse(x).size());
+	EXPECT_EQ(s3, (*RDA.defsFromUse(x).begin())->def);
+	ASSERT_EQ(1, RDA.defsFromUse(y).size());
+	EXPECT_EQ(s2, (*RDA.defsFromUse(y).begin())->def);
+}
+
+TEST_F(ReachingDefinitionsTests,
+updateRecomputesInvalidatedFunctionsAndDropsRemovedOnes)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @f1() {
+			ret void
+		}
+		define void @f2() {
+			ret void
+		}
+	)");
+	RDA.update(*module);
+
+	RDA.invalidate(getFunctionByName("f2"));
+	auto stats = RDA.update(*module);
+	EXPECT_EQ(1, stats.recomputed);
+	EXPECT_EQ(1, stats.reused);
+
+	getFunctionByName("f1")->eraseFromParent();
+	stats = RDA.update(*module);
+	EXPECT_EQ(0, stats.recomputed);
+	EXPECT_EQ(1, stats.reused);
+}
+
+TEST_F(ReachingDefinitionsTests,
+updateRecomputesEverythingWhenSettingsChange)
+{
+	parseInput(R"(
+		define void @f1() {
+			ret void
+		}
+	)");
+	RDA.update(*module);
+
+	auto stats = RDA.update(*module, nullptr, true);
+
+	EXPECT_EQ(1, stats.recomputed);
+	EXPECT_EQ(0, stats.reused);
+}
+
+//
+// OnDemandRdaCache
+//
+
+class OnDemandRdaCacheTests: public LlvmIrTests
+{
+	protected:
+		using InstSet = std::set<llvm::Instruction*>;
+
+		OnDemandRdaCache cache;
+};
+
+TEST_F(OnDemandRdaCacheTests,
+defsFromUseFindsDefinitionsInSameAndPreviousBlocks)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @f(i1 %c) {
+		bb0:
+			%a = alloca i32
+			store i32 1, i32* @r
+			br i1 %c, label %bb1, label %bb2
+		bb1:
+			store i32 2, i32* @r
+			%x1 = load i32, i32* @r
+			br label %bb3
+		bb2:
+			store i32 3, i32* %a
+			br label %bb3
+		bb3:
+			%x2 = load i32, i32* @r
+			%x3 = load i32, i32* %a
+			ret void
+		}
+	)");
+	auto* s1 = getNthInstruction<StoreInst>(0);
+	auto* s2 = getNthInstruction<StoreInst>(1);
+	auto* s3 = getNthInstruction<StoreInst>(2);
+	auto* a = getInstructionByName("a");
+	auto* x1 = getInstructionByName("x1");
+	auto* x2 = getInstructionByName("x2");
+	auto* x3 = getInstructionByName("x3");
+
+	EXPECT_EQ(InstSet({s2}), cache.defsFromUse(x1));
+	EXPECT_EQ(InstSet({s1, s2}), cache.defsFromUse(x2));
+	EXPECT_EQ(InstSet({a, s3}), cache.defsFromUse(x3));
+	EXPECT_TRUE(cache.defsFromUse(s1).empty());
+}
+
+TEST_F(OnDemandRdaCacheTests,
+usesFromDefFindsUsesUntilValueIsKilled)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @f(i1 %c) {
+		bb0:
+			store i32 1, i32* @r
+			%x1 = load i32, i32* @r
+			br i1 %c, label %bb1, label %bb2
+		bb1:
+			%x2 = load i32, i32* @r
+			store i32 2, i32* @r
+			%x3 = load i32, i32* @r
+			br label %bb2
+		bb2:
+			%x4 = load i32, i32* @r
+			ret void
+		}
+	)");
+	auto* s1 = getNthInstruction<StoreInst>(0);
+	auto* s2 = getNthInstruction<StoreInst>(1);
+	auto* x1 = getInstructionByName("x1");
+	auto* x2 = getInstructionByName("x2");
+	auto* x3 = getInstructionByName("x3");
+	auto* x4 = getInstructionByName("x4");
+
+	EXPECT_EQ(InstSet({x1, x2, x4}), cache.usesFromDef(s1));
+	EXPECT_EQ(InstSet({x3, x4}), cache.usesFromDef(s2));
+}
+
+TEST_F(OnDemandRdaCacheTests,
+resultsAreSameAsFromStaticOnDemandInterfaceInLoops)
+{
+	parseInput(R"(
+		@r = global i32 0
+		@s = global i32 0
+		define void @f(i1 %c) {
+		bb0:
+			store i32 1, i32* @r
+			br label %bb1
+		bb1:
+			%x1 = load i32, i32* @r
+			%x2 = load i32, i32* @s
+			br i1 %c, label %bb2, label %bb3
+		bb2:
+			%x3 = load i32, i32* @r
+			store i32 %x3, i32* @s
+			store i32 %x2, i32* @r
+			br label %bb1
+		bb3:
+			%x4 = load i32, i32* @s
+			ret void
+		}
+	)");
+
+	for (int i = 0; i < 2; ++i) // Second time from the cache.
+	for (auto& bb : *getFunctionByName("f"))
+	for (auto& insn : bb)
+	{
+		EXPECT_EQ(
+			ReachingDefinitionsAnalysis::defsFromUse_onDemand(&insn),
+			cache.defsFromUse(&insn));
+		EXPECT_EQ(
+			ReachingDefinitionsAnalysis::usesFromDef_onDemand(&insn),
+			cache.usesFromDef(&insn));
+	}
+}
+
+TEST_F(OnDemandRdaCacheTests,
+invalidateForgetsResults)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @f() {
+			store i32 1, i32* @r
+			%x1 = load i32, i32* @r
+			ret void
+		}
+	)");
+	auto* s1 = getNthInstruction<StoreInst>(0);
+	auto* x1 = getInstructionByName("x1");
+	ASSERT_EQ(InstSet({s1}), cache.defsFromUse(x1));
+
+	auto* s2 = new StoreInst(
+			ConstantInt::get(Type::getInt32Ty(context), 2),
+			s1->getPointerOperand(),
+			x1);
+	cache.invalidate();
+
+	EXPECT_EQ(InstSet({s2}), cache.defsFromUse(x1));
+}
+
 } // namespace tests
 } // namespace bin2llvmir
 } // namespace retdec
@@ -0,0 +1,228 @@
+/**
+* @file tests/bin2llvmir/optimizations/idioms/idioms_analysis_tests.cpp
+* @brief Tests for the @c IdiomsAnalysis class.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+#include <llvm/IR/InstIterator.h>
+
+#include "retdec/bin2llvmir/optimizations/idioms/idioms_analysis.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c IdiomsAnalysis class.
+ */
+class IdiomsAnalysisTests: public LlvmIrTests
+{
+	protected:
+		void runAnalysis(CC_compiler cc = CC_ANY, CC_arch arch = ARCH_ANY)
+		{
+			IdiomsAnalysis analysis(module.get(), cc, arch);
+			for (Function& f : *module)
+			{
+				if (!f.isDeclaration())
+				{
+					analysis.doAnalysis(f, nullptr);
+				}
+			}
+		}
+};
+
+TEST_F(IdiomsAnalysisTests, instructionsWithoutIdiomsAreKept)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %x, i32 %y) {
+			%a = add i32 %x, %y
+			%b = mul i32 %a, %y
+			ret i32 %b
+		}
+	)");
+
+	runAnalysis();
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %x, i32 %y) {
+			%a = add i32 %x, %y
+			%b = mul i32 %a, %y
+			ret i32 %b
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+}
+
+TEST_F(IdiomsAnalysisTests, idiomsWithDifferentRootsAreExchangedInOneBasicBlock)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %x) {
+			%a = shl i32 %x, 3
+			%b = lshr i32 %a, 31
+			%c = add i32 %a, %b
+			ret i32 %c
+		}
+	)");
+
+	runAnalysis();
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %x) {
+			%a = mul i32 %x, 8
+			%1 = icmp slt i32 %a, 0
+			%b = zext i1 %1 to i32
+			%c = add i32 %a, %b
+			ret i32 %c
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+}
+
+TEST_F(IdiomsAnalysisTests, magicUnsignedDivisionIsExchanged)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %x) {
+			%z = zext i32 %x to i64
+			%m = mul i64 %z, 2863311531
+			%s = lshr i64 %m, 33
+			%v = trunc i64 %s to i32
+			ret i32 %v
+		}
+	)");
+
+	runAnalysis();
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %x) {
+			%v = udiv i32 %x, 3
+			ret i32 %v
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+}
+
+TEST_F(IdiomsAnalysisTests, complexIdiomIsExchangedBeforeIdiomItConsistsOf)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %x) {
+			%a = lshr i32 %x, 31
+			%b = xor i32 %a, 1
+			ret i32 %b
+		}
+	)");
+
+	runAnalysis();
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %x) {
+			%1 = icmp sge i32 %x, 0
+			%b = zext i1 %1 to i32
+			ret i32 %b
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+}
+
+TEST_F(IdiomsAnalysisTests, idiomsOfOtherCompilersAreNotExchanged)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %x) {
+			%a = and i32 %x, 7
+			ret i32 %a
+		}
+	)");
+
+	runAnalysis(CC_VStudio, ARCH_x86);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %x) {
+			%a = and i32 %x, 7
+			ret i32 %a
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+}
+
+TEST_F(IdiomsAnalysisTests, idiomsOfSelectedCompilerAreExchanged)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %x) {
+			%a = and i32 %x, 7
+			ret i32 %a
+		}
+	)");
+
+	runAnalysis(CC_GCC, ARCH_ANY);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %x) {
+			%a = urem i32 %x, 8
+			ret i32 %a
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+}
+
+/**
+ * Benchmark of the analysis on a scaled-up version of the magic division and
+ * modulo idioms (idioms_magicdivmod): 400 functions with 250 unsigned magic
+ * divisions each, interleaved with instructions which are not idioms.
+ * Run it by:
+ * @code
+ * retdec-tests-bin2llvmir --gtest_also_run_disabled_tests \
+ *     --gtest_filter='*Benchmark*'
+ * @endcode
+ */
+TEST_F(IdiomsAnalysisTests, DISABLED_BenchmarkMagicDivMod)
+{
+	const unsigned fncCount = 400;
+	const unsigned divCount = 250;
+
+	std::stringstream ss;
+	for (unsigned f = 0; f < fncCount; ++f)
+	{
+		ss << "define i32 @fnc" << f << "(i32 %x) {\n";
+		ss << "  %v0 = add i32 %x, 0\n";
+		for (unsigned i = 0; i < divCount; ++i)
+		{
+			ss << "  %z" << i << " = zext i32 %v" << i << " to i64\n"
+				<< "  %m" << i << " = mul i64 %z" << i << ", 2863311531\n"
+				<< "  %s" << i << " = lshr i64 %m" << i << ", 33\n"
+				<< "  %t" << i << " = trunc i64 %s" << i << " to i32\n"
+				<< "  %a" << i << " = add i32 %t" << i << ", %x\n"
+				<< "  %b" << i << " = xor i32 %a" << i << ", " << i << "\n"
+				<< "  %c" << i << " = sub i32 %b" << i << ", %x\n"
+				<< "  %v" << i + 1 << " = or i32 %c" << i << ", %a" << i << "\n";
+		}
+		ss << "  ret i32 %v" << divCount << "\n";
+		ss << "}\n";
+	}
+	parseInput(ss.str());
+
+	auto start = std::chrono::steady_clock::now();
+	runAnalysis();
+	std::chrono::duration<double> elapsed =
+			std::chrono::steady_clock::now() - start;
+
+	unsigned udivs = 0;
+	for (Function& f : *module)
+	for (auto& i : instructions(f))
+	{
+		udivs += i.getOpcode() == Instruction::UDiv;
+	}
+	EXPECT_EQ(fncCount * divCount, udivs);
+
+	std::cout << "idioms analysis: " << elapsed.count() << " s" << std::endl;
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
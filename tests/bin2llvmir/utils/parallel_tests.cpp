@@ -0,0 +1,202 @@
+/**
+ * @file tests/bin2llvmir/utils/parallel_tests.cpp
+ * @brief Tests for the @c parallel utils module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <atomic>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/bin2llvmir/analyses/symbolic_tree.h"
+#include "retdec/bin2llvmir/optimizations/constants/constants.h"
+#include "retdec/bin2llvmir/optimizations/stack/stack.h"
+#include "retdec/bin2llvmir/providers/abi/x86.h"
+#include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/rda.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+class ParallelTests : public LlvmIrTests
+{
+	protected:
+		virtual void TearDown() override
+		{
+			LlvmIrTests::TearDown();
+			RdaProvider::clear();
+			setParallelExecution(true);
+		}
+
+		/**
+		 * Generate module with @a n functions, each accessing the stack
+		 * through @c esp and the data through constant addresses from
+		 * @a addrs.
+		 */
+		std::string generateInput(
+				unsigned n,
+				const std::vector<retdec::common::Address>& addrs)
+		{
+			std::stringstream ss;
+			ss << "@esp = global i32 0\n";
+			ss << "@eax = global i32 0\n";
+			for (unsigned i = 0; i < n; ++i)
+			{
+				auto addr = addrs[i % addrs.size()];
+				ss << "define i32 @f" << i << "() {\n"
+					<< "  %a = load i32, i32* @esp\n"
+					<< "  %b = add i32 %a, -" << 4 * (i % 8 + 1) << "\n"
+					<< "  %c = inttoptr i32 %b to i32*\n"
+					<< "  store i32 " << i << ", i32* %c\n"
+					<< "  store i32 " << addr.getValue() << ", i32* @eax\n"
+					<< "  %d = load i32, i32* @eax\n"
+					<< "  %e = inttoptr i32 %d to i32*\n"
+					<< "  %f = load i32, i32* %e\n"
+					<< "  %g = load i32, i32* %c\n"
+					<< "  %h = add i32 %f, %g\n"
+					<< "  ret i32 %h\n"
+					<< "}\n";
+			}
+			return ss.str();
+		}
+
+		/**
+		 * Parse @a code, run the stack and constants analyses on it and
+		 * return the resulting module.
+		 */
+		std::string runAnalyses(const std::string& code, bool parallel)
+		{
+			clearAllStaticData();
+			RdaProvider::clear();
+			setParallelExecution(parallel);
+
+			parseInput(code);
+			auto format = createFormat();
+			for (int32_t i = 0; i < 16; ++i)
+			{
+				format->appendData(i);
+			}
+			auto c = Config::empty(module.get());
+			auto image = FileImage(module.get(), format, &c);
+			AbiX86 abi(module.get(), &c);
+			abi.addRegister(X86_REG_ESP, getGlobalByName("esp"));
+			abi.addRegister(X86_REG_EAX, getGlobalByName("eax"));
+			SymbolicTree::setAbi(&abi);
+			SymbolicTree::setConfig(&c);
+
+			StackAnalysis stack;
+			stack.runOnModuleCustom(*module, &c, &abi);
+			RdaProvider::clear();
+			ConstantsAnalysis constants;
+			constants.runOnModuleCustom(*module, &c, &abi, &image, nullptr);
+
+			auto ret = llvmObjToString(module.get());
+			SymbolicTree::setAbi(nullptr);
+			SymbolicTree::setConfig(nullptr);
+			RdaProvider::clear();
+			return ret;
+		}
+};
+
+TEST_F(ParallelTests,
+parallelForEachDoesNothingForNoItems)
+{
+	std::vector<int> items;
+	std::atomic<unsigned> calls(0);
+
+	parallelForEach(items, [&calls](int&)
+	{
+		++calls;
+	});
+
+	EXPECT_EQ(0, calls);
+}
+
+TEST_F(ParallelTests,
+parallelForEachCallsFunctionOnceForEachItem)
+{
+	std::vector<int> items(1000);
+	for (std::size_t i = 0; i < items.size(); ++i)
+	{
+		items[i] = i;
+	}
+
+	parallelForEach(items, [](int& item)
+	{
+		item *= 2;
+	});
+
+	for (std::size_t i = 0; i < items.size(); ++i)
+	{
+		EXPECT_EQ(2 * i, items[i]);
+	}
+}
+
+TEST_F(ParallelTests,
+parallelForEachRethrowsExceptionThrownByFunction)
+{
+	std::vector<int> items(100);
+	std::atomic<unsigned> calls(0);
+
+	EXPECT_THROW(
+		parallelForEach(items, [&calls](int&)
+		{
+			if (++calls == 50)
+			{
+				throw std::runtime_error("error");
+			}
+		}),
+		std::runtime_error
+	);
+	EXPECT_EQ(100, calls);
+}
+
+TEST_F(ParallelTests,
+parallelForEachProcessesItemsInOrderOnCallingThreadIfParallelExecutionIsDisabled)
+{
+	setParallelExecution(false);
+	std::vector<int> items(100);
+	std::vector<int> order;
+	auto thread = std::this_thread::get_id();
+
+	parallelForEach(items, [&order, &thread](int& item)
+	{
+		EXPECT_EQ(thread, std::this_thread::get_id());
+		item = order.size();
+		order.push_back(item);
+	});
+
+	for (std::size_t i = 0; i < items.size(); ++i)
+	{
+		EXPECT_EQ(i, items[i]);
+	}
+}
+
+TEST_F(ParallelTests,
+stackAndConstantsAnalysesProduceSameModuleInSerialAndParallel)
+{
+	std::vector<retdec::common::Address> addrs;
+	for (unsigned i = 0; i < 16; ++i)
+	{
+		addrs.push_back(4 * i);
+	}
+	auto code = generateInput(256, addrs);
+
+	auto serial = runAnalyses(code, false);
+	auto parallel = runAnalyses(code, true);
+
+	EXPECT_EQ(serial, parallel);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
@@ -5,6 +5,7 @@
  */
 
 #include <cmath>
+#include <map>
 
 #include <llvm/IR/InstIterator.h>
 
@@ -177,6 +178,96 @@ class Capstone2LlvmIrTranslatorX86Tests :
 			return dynamic_cast<Capstone2LlvmIrTranslatorX86*>(_translator.get());
 		}
 
+		/**
+		 * Emulate @p textAsm translated with all the flags, and translated
+		 * without the flags @c getDeadFlags() found dead, both from the
+		 * initial registers @p regs. Both translations must store the same
+		 * registers with the same values, and call the same values with the
+		 * same arguments.
+		 */
+		void EXPECT_LAZY_FLAGS_SAME_AS_EAGER(
+				const std::string& textAsm,
+				const std::vector<std::pair<uint32_t, StoredValue>>& regs)
+		{
+			uint64_t addr = 0x1000;
+			auto bytes = assemble(textAsm, addr);
+
+			setRegisters(regs);
+			_emulate(bytes, addr);
+			auto eagerStored = _emulator->getStoredGlobalVariablesSet();
+			std::map<llvm::GlobalVariable*, uint64_t> eagerRegs;
+			for (auto* gv : eagerStored)
+			{
+				eagerRegs[gv] = _emulator->getGlobalVariableValue(gv)
+						.IntVal.getZExtValue();
+			}
+			auto eagerCalls = _emulator->getCallEntries();
+
+			cs_insn* insns = nullptr;
+			auto count = cs_disasm(
+					_translator->getCapstoneEngine(),
+					bytes.data(),
+					bytes.size(),
+					addr,
+					0,
+					&insns);
+			auto dead = getX86Translator()->getDeadFlags(insns, count);
+			cs_free(insns, count);
+
+			auto* f = llvm::Function::Create(
+					llvm::FunctionType::get(
+							llvm::Type::getVoidTy(_context),
+							false),
+					llvm::GlobalValue::ExternalLinkage,
+					"",
+					&_module);
+			auto* bb = llvm::BasicBlock::Create(_context, "", f);
+			llvm::IRBuilder<> irb(bb);
+			irb.SetInsertPoint(irb.CreateRetVoid());
+
+			const uint8_t* b = bytes.data();
+			std::size_t s = bytes.size();
+			common::Address a = addr;
+			for (auto d : dead)
+			{
+				getX86Translator()->setDeadFlags(d);
+				auto res = _translator->translateOne(b, s, a, irb);
+				ASSERT_FALSE(res.failed());
+				cs_free(res.capstoneInsn, 1);
+			}
+
+			initLlvmEmulator();
+			setRegisters(regs);
+			f = modifyTranslationForEmulation(f);
+			_emulator->runFunction(f, {});
+			_function = f;
+
+			EXPECT_EQ(eagerStored, _emulator->getStoredGlobalVariablesSet())
+					<< dumpFunction(f);
+			for (auto& p : eagerRegs)
+			{
+				EXPECT_EQ(p.second, _emulator->getGlobalVariableValue(p.first)
+						.IntVal.getZExtValue())
+						<< p.first->getName().str() << "\n" << dumpFunction(f);
+			}
+			auto& lazyCalls = _emulator->getCallEntries();
+			ASSERT_EQ(eagerCalls.size(), lazyCalls.size());
+			auto eIt = eagerCalls.begin();
+			auto lIt = lazyCalls.begin();
+			for (; eIt != eagerCalls.end(); ++eIt, ++lIt)
+			{
+				EXPECT_EQ(eIt->calledValue, lIt->calledValue);
+				ASSERT_EQ(eIt->calledArguments.size(), lIt->calledArguments.size());
+				for (std::size_t j = 0; j < eIt->calledArguments.size(); ++j)
+				{
+					EXPECT_EQ(
+						eIt->calledArguments[j].IntVal.getZExtValue(),
+						lIt->calledArguments[j].IntVal.getZExtValue())
+						<< dumpFunction(f);
+				}
+			}
+		}
+
 	// Some of these (or their parts) might be moved to abstract parent class.
 	//
 	protected:
@@ -13660,6 +13751,179 @@ TEST_P(Capstone2LlvmIrTranslatorX86Tests, X86_INS_FXTRACT)
 // + REP prefix variants
 //
 
+//
+// Dead flags
+//
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, getDeadFlags_flagsOverwrittenBeforeRead)
+{
+	ONLY_MODE_32;
+
+	auto bytes = assemble("add dl, 0x12; adc dl, 1; add dl, 2; ret");
+	cs_insn* insns = nullptr;
+	auto count = cs_disasm(
+			_translator->getCapstoneEngine(),
+			bytes.data(),
+			bytes.size(),
+			0,
+			0,
+			&insns);
+	ASSERT_EQ(4, count);
+
+	auto dead = getX86Translator()->getDeadFlags(insns, count);
+	cs_free(insns, count);
+
+	uint32_t all = getX86Translator()->getFlagMask(X86_REG_CF)
+			| getX86Translator()->getFlagMask(X86_REG_PF)
+			| getX86Translator()->getFlagMask(X86_REG_AF)
+			| getX86Translator()->getFlagMask(X86_REG_ZF)
+			| getX86Translator()->getFlagMask(X86_REG_SF)
+			| getX86Translator()->getFlagMask(X86_REG_OF);
+	uint32_t cf = getX86Translator()->getFlagMask(X86_REG_CF);
+	ASSERT_EQ(4, dead.size());
+	EXPECT_EQ(all & ~cf, dead[0]);
+	EXPECT_EQ(all & ~cf, dead[1]);
+	EXPECT_EQ(0, dead[2]);
+	EXPECT_EQ(0, dead[3]);
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, getDeadFlags_undefinedFlagsDoNotEndLiveRange)
+{
+	ONLY_MODE_32;
+
+	// mul leaves ZF undefined, but its translation does not store it.
+	auto bytes = assemble("cmp eax, ebx; mul ecx; sete dl");
+	cs_insn* insns = nullptr;
+	auto count = cs_disasm(
+			_translator->getCapstoneEngine(),
+			bytes.data(),
+			bytes.size(),
+			0,
+			0,
+			&insns);
+	ASSERT_EQ(3, count);
+
+	auto dead = getX86Translator()->getDeadFlags(insns, count);
+	cs_free(insns, count);
+
+	ASSERT_EQ(3, dead.size());
+	EXPECT_EQ(0, dead[0] & getX86Translator()->getFlagMask(X86_REG_ZF));
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, lazyFlags_adcAfterAdd)
+{
+	ALL_MODES;
+
+	EXPECT_LAZY_FLAGS_SAME_AS_EAGER("add al, bl; adc cl, dl; adc cl, 1", {
+		{X86_REG_AL, 0xf0},
+		{X86_REG_BL, 0x20},
+		{X86_REG_CL, 0x7f},
+		{X86_REG_DL, 0x00},
+	});
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, lazyFlags_sbbAfterCmpAndInc)
+{
+	ALL_MODES;
+
+	// inc does not write CF, sbb reads the one written by cmp.
+	EXPECT_LAZY_FLAGS_SAME_AS_EAGER("cmp al, bl; inc dl; sbb cl, 0", {
+		{X86_REG_AL, 0x10},
+		{X86_REG_BL, 0x20},
+		{X86_REG_CL, 0x05},
+		{X86_REG_DL, 0xff},
+	});
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, lazyFlags_jccAfterMul)
+{
+	ALL_MODES;
+
+	// mul leaves ZF undefined, je reads the one written by cmp.
+	EXPECT_LAZY_FLAGS_SAME_AS_EAGER("cmp al, bl; mul cl; je 0x1234", {
+		{X86_REG_AL, 0x20},
+		{X86_REG_BL, 0x20},
+		{X86_REG_CL, 0x03},
+	});
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, lazyFlags_setccAfterShift)
+{
+	ALL_MODES;
+
+	// shl by a zero count leaves all flags unchanged.
+	EXPECT_LAZY_FLAGS_SAME_AS_EAGER("sub al, bl; shl dl, cl; setb ah; sets bh", {
+		{X86_REG_AL, 0x10},
+		{X86_REG_BL, 0x20},
+		{X86_REG_CL, 0x00},
+		{X86_REG_DL, 0x81},
+	});
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, lazyFlags_setccAfterPartialFlagWriters)
+{
+	ALL_MODES;
+
+	EXPECT_LAZY_FLAGS_SAME_AS_EAGER(
+			"add al, bl; bt dx, 3; dec cl; seto ah; setc bh; setp ch", {
+		{X86_REG_AL, 0x7f},
+		{X86_REG_BL, 0x01},
+		{X86_REG_CL, 0x80},
+		{X86_REG_DX, 0x0008},
+	});
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, setDeadFlags_deadFlagsAreNotStored)
+{
+	ALL_MODES;
+
+	setRegisters({
+		{X86_REG_DL, 0xf0},
+	});
+
+	getX86Translator()->setDeadFlags(
+			getX86Translator()->getFlagMask(X86_REG_PF)
+			| getX86Translator()->getFlagMask(X86_REG_SF)
+			| getX86Translator()->getFlagMask(X86_REG_ZF)
+			| getX86Translator()->getFlagMask(X86_REG_OF)
+			| getX86Translator()->getFlagMask(X86_REG_AF));
+	emulate("add dl, 0x12");
+
+	EXPECT_JUST_REGISTERS_LOADED({X86_REG_DL});
+	EXPECT_JUST_REGISTERS_STORED({
+		{X86_REG_DL, 0x2ULL},
+		{X86_REG_CF, true},
+	});
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, setDeadFlags_appliesOnlyToNextInstruction)
+{
+	ALL_MODES;
+
+	setRegisters({
+		{X86_REG_DL, 0xf0},
+	});
+
+	getX86Translator()->setDeadFlags(
+			getX86Translator()->getFlagMask(X86_REG_CF));
+	emulate("add dl, 0x12; add dl, 0");
+
+	EXPECT_JUST_REGISTERS_LOADED({X86_REG_DL});
+	EXPECT_JUST_REGISTERS_STORED({
+		{X86_REG_DL, 0x2ULL},
+		{X86_REG_PF, false},
+		{X86_REG_SF, false},
+		{X86_REG_ZF, false},
+		{X86_REG_OF, false},
+		{X86_REG_AF, false},
+		{X86_REG_CF, false},
+	});
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+}
+
 } // namespace tests
 } // namespace capstone2llvmir
 } // namespace retdec
@@ -4,6 +4,9 @@
  * @copyright (c) 2019 Avast Software, licensed under the MIT license
  */
 
+#include <chrono>
+#include <iostream>
+
 #include <gtest/gtest.h>
 
 #include "retdec/common/function.h"
@@ -74,6 +77,108 @@ TEST_F(FunctionContainerTests, TestGetFunctionByStartAddress)
 	ASSERT_TRUE(n == nullptr);
 }
 
+TEST_F(FunctionContainerTests, TestGetFunctionByStartAddressReturnsLowestNameOnTheSameAddress)
+{
+	Function f("a_fnc");
+	f.setStart(0x3000);
+	funcs.insert(f);
+
+	EXPECT_EQ("a_fnc", funcs.getFunctionByStartAddress(0x3000)->getName());
+
+	funcs.erase(f);
+
+	EXPECT_EQ("fnc3", funcs.getFunctionByStartAddress(0x3000)->getName());
+}
+
+TEST_F(FunctionContainerTests, TestGetFunctionByRealName)
+{
+	auto* f = funcs.getFunctionByName("fnc2");
+	funcs.setRealName(f, "real2");
+
+	EXPECT_EQ(f, funcs.getFunctionByRealName("real2"));
+	EXPECT_EQ("real2", f->getRealName());
+
+	funcs.setRealName(f, "other2");
+
+	EXPECT_EQ(nullptr, funcs.getFunctionByRealName("real2"));
+	EXPECT_EQ(f, funcs.getFunctionByRealName("other2"));
+}
+
+TEST_F(FunctionContainerTests, TestInsertingExistingNameDoesNotChangeIndexes)
+{
+	Function f("fnc1");
+	f.setStart(0x5000);
+	auto p = funcs.insert(f);
+
+	EXPECT_FALSE(p.second);
+	EXPECT_EQ("fnc1", funcs.getFunctionByStartAddress(0x1000)->getName());
+	EXPECT_EQ(nullptr, funcs.getFunctionByStartAddress(0x5000));
+}
+
+TEST_F(FunctionContainerTests, TestOperationsOnContainerAreReflectedInIndexes)
+{
+	Function f("fnc5");
+	f.setStart(0x5000);
+	f.setRealName("real5");
+	funcs.insert(funcs.end(), f);
+
+	EXPECT_EQ("fnc5", funcs.getFunctionByStartAddress(0x5000)->getName());
+	EXPECT_EQ("fnc5", funcs.getFunctionByRealName("real5")->getName());
+
+	funcs.erase(funcs.find("fnc5"));
+
+	EXPECT_EQ(nullptr, funcs.getFunctionByStartAddress(0x5000));
+	EXPECT_EQ(nullptr, funcs.getFunctionByRealName("real5"));
+	EXPECT_EQ(0, funcs.erase(f));
+
+	funcs.clear();
+
+	EXPECT_EQ(nullptr, funcs.getFunctionByStartAddress(0x1000));
+}
+
+TEST_F(FunctionContainerTests, TestWhenContainerIsCopiedPointersInIndexesAreUpdated)
+{
+	auto copy = funcs;
+	FunctionContainer assigned;
+	assigned = funcs;
+
+	EXPECT_EQ(copy.getFunctionByName("fnc1"), copy.getFunctionByStartAddress(0x1000));
+	EXPECT_EQ(assigned.getFunctionByName("fnc1"), assigned.getFunctionByStartAddress(0x1000));
+
+	funcs.clear();
+
+	EXPECT_EQ("fnc2", copy.getFunctionByStartAddress(0x2000)->getName());
+	EXPECT_EQ("fnc2", assigned.getFunctionByStartAddress(0x2000)->getName());
+}
+
+TEST_F(FunctionContainerTests, DISABLED_TestLookupScaling)
+{
+	for (std::size_t n : {1000, 10000, 100000})
+	{
+		FunctionContainer c;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			Function f("function_" + std::to_string(i));
+			f.setStart(0x1000 + 0x10 * i);
+			f.setRealName("real_" + std::to_string(i));
+			c.insert(f);
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		std::size_t found = 0;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			found += c.getFunctionByStartAddress(0x1000 + 0x10 * i) != nullptr;
+			found += c.getFunctionByRealName("real_" + std::to_string(i)) != nullptr;
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		EXPECT_EQ(2 * n, found);
+		std::cout << n << " functions: "
+				<< elapsed.count() * 1e9 / (2 * n) << " ns per lookup" << std::endl;
+	}
+}
+
 } // namespace tests
 } // namespace common
 } // namespace retdec
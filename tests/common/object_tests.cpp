@@ -37,6 +37,8 @@ TEST_F(GlobalVarContainerTests, ElementWithTheSameNameGetsReplaced)
 	globals.insert( Object("g2", common::Storage::inMemory(0x4000)) );
 
 	EXPECT_EQ(0x4000, globals.getObjectByName("g2")->getStorage().getAddress());
+	EXPECT_EQ(nullptr, globals.getObjectByAddress(0x2000));
+	EXPECT_EQ(3, globals._addr2global.size());
 }
 
 TEST_F(GlobalVarContainerTests, ElementWithTheSameAddressGetsReplaced)
@@ -72,6 +74,8 @@ TEST_F(GlobalVarContainerTests, OperationsOnUnderlyingContainerAreReflectedInadd
 	EXPECT_EQ(2, globals.size());
 	EXPECT_EQ(2, globals._addr2global.size());
 
+	EXPECT_EQ(0, globals.erase(g2));
+
 	globals.clear();
 
 	EXPECT_TRUE(globals.empty());
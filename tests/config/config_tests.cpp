@@ -59,6 +59,62 @@ TEST_F(ConfigTests, ClassesGetElementByIdReturnsNullPointerWhenThereIsNoSuchClas
 	ASSERT_EQ(config.classes.end(), config.classes.find("ClassName"));
 }
 
+TEST_F(ConfigTests, LlvmPassesExpandReferencesToNamedPipelines)
+{
+	config.readJsonString(R"({
+		"decompParams": {
+			"llvmPasses": ["a", "@p1", "d"],
+			"llvmPipelines": {
+				"p1": ["b", "@p2"],
+				"p2": ["c"]
+			}
+		}
+	})");
+
+	std::vector<std::string> expected{"a", "b", "c", "d"};
+	EXPECT_EQ(expected, config.parameters.getLlvmPasses());
+}
+
+TEST_F(ConfigTests, SelectedLlvmPipelineIsUsedInsteadOfLlvmPasses)
+{
+	config.readJsonString(R"({
+		"decompParams": {
+			"llvmPasses": ["a"],
+			"llvmPipelines": {
+				"fast": ["b"]
+			},
+			"llvmPipeline": "fast"
+		}
+	})");
+
+	std::vector<std::string> expected{"b"};
+	EXPECT_EQ(expected, config.parameters.getLlvmPasses());
+}
+
+TEST_F(ConfigTests, LlvmPassesThrowOnUnknownOrRecursivePipeline)
+{
+	config.parameters.llvmPipelines["p"] = {"@p"};
+
+	config.parameters.llvmPasses = {"@unknown"};
+	EXPECT_THROW(config.parameters.getLlvmPasses(), std::runtime_error);
+	config.parameters.llvmPasses = {"@p"};
+	EXPECT_THROW(config.parameters.getLlvmPasses(), std::runtime_error);
+}
+
+TEST_F(ConfigTests, LlvmPipelinesSurviveSerialization)
+{
+	config.parameters.llvmPasses = {"@p"};
+	config.parameters.llvmPipelines["p"] = {"a", "b"};
+	config.parameters.setLlvmPipeline("p");
+
+	Config other;
+	other.readJsonString(config.generateJsonString());
+
+	EXPECT_EQ(config.parameters.llvmPasses, other.parameters.llvmPasses);
+	EXPECT_EQ(config.parameters.llvmPipelines, other.parameters.llvmPipelines);
+	EXPECT_EQ("p", other.parameters.getLlvmPipeline());
+}
+
 } // namespace tests
 } // namespace config
 } // namespace retdec
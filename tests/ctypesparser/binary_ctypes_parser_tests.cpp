@@ -0,0 +1,331 @@
+/**
+* @file tests/ctypesparser/binary_ctypes_parser_tests.cpp
+* @brief Tests for the @c binary_ctypes_parser module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/ctypes/context.h"
+#include "retdec/ctypes/function.h"
+#include "retdec/ctypes/integral_type.h"
+#include "retdec/ctypes/module.h"
+#include "retdec/ctypes/parameter.h"
+#include "retdec/ctypes/pointer_type.h"
+#include "retdec/ctypes/struct_type.h"
+#include "retdec/ctypesparser/binary_ctypes_parser.h"
+#include "retdec/ctypesparser/binary_ctypes_writer.h"
+#include "retdec/ctypesparser/json_ctypes_parser.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace ctypesparser {
+namespace tests {
+
+namespace {
+
+const std::string TEST_JSON = R"(
+	{
+		"functions": {
+			"f2": {
+				"decl": "node_t *f2(node_t *n, int x);",
+				"header": "header2.h",
+				"name": "f2",
+				"params": [
+					{
+						"annotations": "_Inout_",
+						"name": "n",
+						"type": "p_node_t"
+					},
+					{
+						"name": "x",
+						"type": "int"
+					}
+				],
+				"ret_type": "p_node_t"
+			},
+			"f1": {
+				"call_conv": "stdcall",
+				"decl": "unsigned f1(int a, ...);",
+				"header": "header1.h",
+				"name": "f1",
+				"params": [
+					{
+						"name": "a",
+						"type": "int"
+					}
+				],
+				"ret_type": "unsigned",
+				"vararg": true
+			}
+		},
+		"types": {
+			"int": {
+				"name": "int",
+				"type": "integral_type"
+			},
+			"unsigned": {
+				"bit_width": 16,
+				"name": "unsigned int",
+				"type": "integral_type"
+			},
+			"node_t": {
+				"name": "node_t",
+				"type": "typedef",
+				"typedefed_type": "s_node"
+			},
+			"p_node_t": {
+				"pointed_type": "node_t",
+				"type": "pointer"
+			},
+			"s_node": {
+				"members": [
+					{
+						"name": "next",
+						"type": "p_node_t"
+					},
+					{
+						"name": "value",
+						"type": "int"
+					}
+				],
+				"name": "node",
+				"type": "structure"
+			},
+			"not_used": {
+				"name": "not_used",
+				"type": "integral_type"
+			}
+		}
+	}
+)";
+
+} // anonymous namespace
+
+class BinaryCTypesParserTests : public Test
+{
+	public:
+		BinaryCTypesParserTests():
+			module(std::make_unique<retdec::ctypes::Module>(
+				std::make_shared<retdec::ctypes::Context>())) {}
+
+	protected:
+		void compileAndOpen(const std::string &json)
+		{
+			std::stringstream jsonStream(json);
+			data = BinaryCTypesWriter().write(jsonStream);
+			parser.openBuffer(data.data(), data.size());
+		}
+
+	protected:
+		std::vector<std::uint8_t> data;
+		BinaryCTypesParser parser;
+		std::unique_ptr<retdec::ctypes::Module> module;
+};
+
+TEST_F(BinaryCTypesParserTests,
+WritingBadJsonThrowsException)
+{
+	std::stringstream json(R"({ "missing bracket": 1 )");
+
+	ASSERT_THROW(BinaryCTypesWriter().write(json), CTypesParseError);
+}
+
+TEST_F(BinaryCTypesParserTests,
+WritingReferenceToNonExistingTypeThrowsException)
+{
+	std::stringstream json(R"(
+		{
+			"functions": {
+				"f": {
+					"decl": "t f();",
+					"header": "h.h",
+					"params": [],
+					"ret_type": "missing"
+				}
+			},
+			"types": {}
+		}
+	)");
+
+	ASSERT_THROW(BinaryCTypesWriter().write(json), CTypesParseError);
+}
+
+TEST_F(BinaryCTypesParserTests,
+OpeningDataWithBadMagicThrowsException)
+{
+	compileAndOpen(TEST_JSON);
+	data[0] = 'X';
+
+	ASSERT_THROW(parser.openBuffer(data.data(), data.size()), CTypesParseError);
+	EXPECT_FALSE(parser.isOpen());
+}
+
+TEST_F(BinaryCTypesParserTests,
+OpeningTruncatedDataThrowsException)
+{
+	compileAndOpen(TEST_JSON);
+
+	ASSERT_THROW(parser.openBuffer(data.data(), 10), CTypesParseError);
+}
+
+TEST_F(BinaryCTypesParserTests,
+FunctionIndexContainsSortedFunctionNames)
+{
+	compileAndOpen(TEST_JSON);
+
+	EXPECT_EQ(2, parser.getFunctionCount());
+	EXPECT_EQ(std::vector<std::string>({"f1", "f2"}), parser.getFunctionNames());
+	EXPECT_TRUE(parser.hasFunction("f1"));
+	EXPECT_TRUE(parser.hasFunction("f2"));
+	EXPECT_FALSE(parser.hasFunction("f3"));
+	EXPECT_FALSE(parser.hasFunction(""));
+}
+
+TEST_F(BinaryCTypesParserTests,
+ParseFunctionReturnsNullptrForUnknownFunction)
+{
+	compileAndOpen(TEST_JSON);
+
+	EXPECT_EQ(nullptr, parser.parseFunction("unknown", module));
+	EXPECT_FALSE(module->hasFunctionWithName("unknown"));
+}
+
+TEST_F(BinaryCTypesParserTests,
+ParseFunctionParsesOnlyRequestedFunction)
+{
+	compileAndOpen(TEST_JSON);
+
+	auto f1 = parser.parseFunction("f1", module, {}, std::string("cdecl"));
+
+	ASSERT_NE(nullptr, f1);
+	EXPECT_TRUE(module->hasFunctionWithName("f1"));
+	EXPECT_FALSE(module->hasFunctionWithName("f2"));
+	EXPECT_EQ("unsigned f1(int a, ...);", std::string(f1->getDeclaration()));
+	EXPECT_EQ("header1.h", f1->getHeaderFile().getPath());
+	EXPECT_EQ(retdec::ctypes::CallConvention("stdcall"), f1->getCallConvention());
+	EXPECT_TRUE(f1->isVarArg());
+	EXPECT_EQ(16, f1->getReturnType()->getBitWidth());
+	ASSERT_EQ(1, f1->getParameterCount());
+	EXPECT_EQ("a", f1->getParameterName(1));
+}
+
+TEST_F(BinaryCTypesParserTests,
+ParseFunctionUsesDefaultsWhenFunctionDoesNotSpecifyThem)
+{
+	compileAndOpen(TEST_JSON);
+
+	auto f2 = parser.parseFunction("f2", module, {{"int", 32}, {"*", 64}},
+		std::string("cdecl"));
+
+	ASSERT_NE(nullptr, f2);
+	EXPECT_EQ(retdec::ctypes::CallConvention("cdecl"), f2->getCallConvention());
+	EXPECT_FALSE(f2->isVarArg());
+	EXPECT_EQ(64, f2->getReturnType()->getBitWidth());
+	ASSERT_EQ(2, f2->getParameterCount());
+	EXPECT_EQ(32, f2->getParameterType(2)->getBitWidth());
+	EXPECT_TRUE(f2->getParameter(1).isInOut());
+}
+
+TEST_F(BinaryCTypesParserTests,
+ParseFunctionHandlesRecursiveTypes)
+{
+	compileAndOpen(R"(
+		{
+			"functions": {
+				"f": {
+					"decl": "struct node *f();",
+					"header": "header.h",
+					"params": [],
+					"ret_type": "p_s_node"
+				}
+			},
+			"types": {
+				"p_s_node": {
+					"pointed_type": "s_node",
+					"type": "pointer"
+				},
+				"s_node": {
+					"members": [
+						{
+							"name": "next",
+							"type": "p_s_node"
+						}
+					],
+					"name": "node",
+					"type": "structure"
+				}
+			}
+		}
+	)");
+
+	auto f = parser.parseFunction("f", module);
+
+	ASSERT_NE(nullptr, f);
+	auto nodePtr = std::dynamic_pointer_cast<retdec::ctypes::PointerType>(
+		f->getReturnType());
+	ASSERT_NE(nullptr, nodePtr);
+	auto node = std::dynamic_pointer_cast<retdec::ctypes::StructType>(
+		nodePtr->getPointedType());
+	ASSERT_NE(nullptr, node);
+	ASSERT_EQ(1, node->getMemberCount());
+	EXPECT_EQ(nodePtr, node->getMemberType(1));
+}
+
+TEST_F(BinaryCTypesParserTests,
+ParseFunctionReusesTypesFromPreviouslyParsedFunctions)
+{
+	compileAndOpen(TEST_JSON);
+
+	auto f1 = parser.parseFunction("f1", module);
+	auto f2 = parser.parseFunction("f2", module);
+
+	ASSERT_NE(nullptr, f1);
+	ASSERT_NE(nullptr, f2);
+	EXPECT_EQ(f1->getParameterType(1), f2->getParameterType(2));
+	EXPECT_EQ(f1, parser.parseFunction("f1", module));
+}
+
+TEST_F(BinaryCTypesParserTests,
+ParseIntoProducesSameFunctionsAsJsonParser)
+{
+	compileAndOpen(TEST_JSON);
+	std::stringstream json(TEST_JSON);
+	CTypesParser::TypeWidths typeWidths{{"int", 32}, {"*", 32}};
+	auto jsonModule = JSONCTypesParser().parse(
+		json, typeWidths, std::string("cdecl"));
+
+	parser.parseInto(module, typeWidths, std::string("cdecl"));
+
+	for (const auto &name : {"f1", "f2"})
+	{
+		auto jsonFunc = jsonModule->getFunctionWithName(name);
+		auto binFunc = module->getFunctionWithName(name);
+		ASSERT_NE(nullptr, jsonFunc);
+		ASSERT_NE(nullptr, binFunc);
+		EXPECT_EQ(std::string(jsonFunc->getDeclaration()),
+			std::string(binFunc->getDeclaration()));
+		EXPECT_EQ(jsonFunc->getCallConvention(), binFunc->getCallConvention());
+		EXPECT_EQ(jsonFunc->isVarArg(), binFunc->isVarArg());
+		EXPECT_EQ(jsonFunc->getReturnType()->getName(),
+			binFunc->getReturnType()->getName());
+		EXPECT_EQ(jsonFunc->getReturnType()->getBitWidth(),
+			binFunc->getReturnType()->getBitWidth());
+		ASSERT_EQ(jsonFunc->getParameterCount(), binFunc->getParameterCount());
+		for (std::size_t i = 1; i <= jsonFunc->getParameterCount(); ++i)
+		{
+			EXPECT_EQ(jsonFunc->getParameterName(i), binFunc->getParameterName(i));
+			EXPECT_EQ(jsonFunc->getParameterType(i)->getName(),
+				binFunc->getParameterType(i)->getName());
+			EXPECT_EQ(jsonFunc->getParameterType(i)->getBitWidth(),
+				binFunc->getParameterType(i)->getBitWidth());
+		}
+	}
+}
+
+} // namespace tests
+} // namespace ctypesparser
+} // namespace retdec
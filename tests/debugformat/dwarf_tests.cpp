@@ -0,0 +1,386 @@
+/**
+ * @file tests/debugformat/dwarf_tests.cpp
+ * @brief Tests for loading of DWARF debug information.
+ * @copyright (c) 2020 Avast Software, licensed under the MIT license
+ */
+
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/debugformat/debugformat.h"
+#include "retdec/demangler/demangler.h"
+#include "retdec/fileformat/format_factory.h"
+#include "retdec/loader/image_factory.h"
+#include "retdec/utils/filesystem.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace debugformat {
+namespace tests {
+
+namespace {
+
+/**
+ * x86-64 ELF executable built with 'gcc -g -gdwarf-4 -O0 -nostdlib -static'
+ * from /src/t.c:
+ *
+ *  1 struct point { int x; int y; };
+ *  2 struct point origin;
+ *  3 int counter;
+ *  4
+ *  5 int add(int a, int b)
+ *  6 {
+ *  7     int sum = a + b;
+ *  8     return sum;
+ *  9 }
+ * 10
+ * 11 void move(struct point* p, int dx)
+ * 12 {
+ * 13     p->x = add(p->x, dx);
+ * 14     counter++;
+ * 15 }
+ * 16
+ * 17 void _start(void)
+ * 18 {
+ * 19     move(&origin, 2);
+ * 20     for (;;);
+ * 21 }
+ */
+const std::vector<uint8_t> elfBytes = {
+	0x7f, 0x45, 0x4c, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x03, 0x00, 0x40, 0x00, 0x0a, 0x00, 0x09, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x58, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x51, 0xe5, 0x74, 0x64, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48, 0x89, 0xe5, 0x89, 0x7d, 0xec, 0x89,
+	0x75, 0xe8, 0x8b, 0x55, 0xec, 0x8b, 0x45, 0xe8, 0x01, 0xd0, 0x89, 0x45, 0xfc, 0x8b, 0x45, 0xfc,
+	0x5d, 0xc3, 0x55, 0x48, 0x89, 0xe5, 0x48, 0x83, 0xec, 0x10, 0x48, 0x89, 0x7d, 0xf8, 0x89, 0x75,
+	0xf4, 0x48, 0x8b, 0x45, 0xf8, 0x8b, 0x00, 0x8b, 0x55, 0xf4, 0x89, 0xd6, 0x89, 0xc7, 0xe8, 0xc5,
+	0xff, 0xff, 0xff, 0x48, 0x8b, 0x55, 0xf8, 0x89, 0x02, 0x8b, 0x05, 0x31, 0x10, 0x00, 0x00, 0x83,
+	0xc0, 0x01, 0x89, 0x05, 0x28, 0x10, 0x00, 0x00, 0x90, 0xc9, 0xc3, 0x55, 0x48, 0x89, 0xe5, 0xbe,
+	0x02, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x05, 0x0d, 0x10, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0xaf,
+	0xff, 0xff, 0xff, 0xeb, 0xfe, 0x23, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x01, 0x1a, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x2e, 0x63, 0x00, 0x15, 0x00, 0x00, 0x00, 0xe8, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x08, 0x01, 0x01, 0x08, 0x51, 0x00, 0x00, 0x00, 0x03,
+	0x78, 0x00, 0x01, 0x01, 0x14, 0x51, 0x00, 0x00, 0x00, 0x00, 0x03, 0x79, 0x00, 0x01, 0x01, 0x1b,
+	0x51, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x05, 0x69, 0x6e, 0x74, 0x00, 0x05, 0x7c, 0x00,
+	0x00, 0x00, 0x01, 0x02, 0x0e, 0x2d, 0x00, 0x00, 0x00, 0x09, 0x03, 0x58, 0x11, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x51, 0x00, 0x00, 0x00, 0x09,
+	0x03, 0x60, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11,
+	0x06, 0x3b, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x9c, 0x07, 0x77, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x06, 0x02, 0x01, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9c, 0xd8, 0x00, 0x00,
+	0x00, 0x08, 0x70, 0x00, 0x01, 0x0b, 0x19, 0xd8, 0x00, 0x00, 0x00, 0x02, 0x91, 0x68, 0x08, 0x64,
+	0x78, 0x00, 0x01, 0x0b, 0x20, 0x51, 0x00, 0x00, 0x00, 0x02, 0x91, 0x64, 0x00, 0x09, 0x08, 0x2d,
+	0x00, 0x00, 0x00, 0x0a, 0x61, 0x64, 0x64, 0x00, 0x01, 0x05, 0x05, 0x51, 0x00, 0x00, 0x00, 0xe8,
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x9c, 0x08, 0x61, 0x00, 0x01, 0x05, 0x0d, 0x51, 0x00, 0x00, 0x00, 0x02, 0x91, 0x5c, 0x08, 0x62,
+	0x00, 0x01, 0x05, 0x14, 0x51, 0x00, 0x00, 0x00, 0x02, 0x91, 0x58, 0x0b, 0x73, 0x75, 0x6d, 0x00,
+	0x01, 0x07, 0x06, 0x51, 0x00, 0x00, 0x00, 0x02, 0x91, 0x6c, 0x00, 0x00, 0x01, 0x11, 0x01, 0x25,
+	0x0e, 0x13, 0x0b, 0x03, 0x08, 0x1b, 0x0e, 0x11, 0x01, 0x12, 0x07, 0x10, 0x17, 0x00, 0x00, 0x02,
+	0x13, 0x01, 0x03, 0x0e, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x01, 0x13, 0x00, 0x00,
+	0x03, 0x0d, 0x00, 0x03, 0x08, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13, 0x38, 0x0b, 0x00,
+	0x00, 0x04, 0x24, 0x00, 0x0b, 0x0b, 0x3e, 0x0b, 0x03, 0x08, 0x00, 0x00, 0x05, 0x34, 0x00, 0x03,
+	0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13, 0x3f, 0x19, 0x02, 0x18, 0x00, 0x00, 0x06,
+	0x2e, 0x00, 0x3f, 0x19, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x27, 0x19, 0x11, 0x01,
+	0x12, 0x07, 0x40, 0x18, 0x96, 0x42, 0x19, 0x00, 0x00, 0x07, 0x2e, 0x01, 0x3f, 0x19, 0x03, 0x0e,
+	0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x27, 0x19, 0x11, 0x01, 0x12, 0x07, 0x40, 0x18, 0x96, 0x42,
+	0x19, 0x01, 0x13, 0x00, 0x00, 0x08, 0x05, 0x00, 0x03, 0x08, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b,
+	0x49, 0x13, 0x02, 0x18, 0x00, 0x00, 0x09, 0x0f, 0x00, 0x0b, 0x0b, 0x49, 0x13, 0x00, 0x00, 0x0a,
+	0x2e, 0x01, 0x3f, 0x19, 0x03, 0x08, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x27, 0x19, 0x49, 0x13,
+	0x11, 0x01, 0x12, 0x07, 0x40, 0x18, 0x97, 0x42, 0x19, 0x00, 0x00, 0x0b, 0x34, 0x00, 0x03, 0x08,
+	0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13, 0x02, 0x18, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xfb, 0x0e, 0x0d, 0x00, 0x01, 0x01,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x74, 0x2e, 0x63, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x00, 0x09, 0x02, 0xe8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+	0x05, 0x06, 0x9f, 0x05, 0x09, 0xad, 0x05, 0x01, 0x3d, 0x31, 0x05, 0x09, 0xe5, 0x05, 0x07, 0x08,
+	0x20, 0x05, 0x09, 0x67, 0x05, 0x01, 0xe5, 0x3f, 0x05, 0x02, 0x4b, 0x00, 0x02, 0x04, 0x01, 0x08,
+	0x3d, 0x02, 0x02, 0x00, 0x01, 0x01, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x70, 0x6f, 0x69,
+	0x6e, 0x74, 0x00, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x00, 0x2f, 0x73, 0x72, 0x63, 0x00,
+	0x47, 0x4e, 0x55, 0x20, 0x43, 0x31, 0x37, 0x20, 0x31, 0x32, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x2d,
+	0x6d, 0x74, 0x75, 0x6e, 0x65, 0x3d, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x20, 0x2d, 0x6d,
+	0x61, 0x72, 0x63, 0x68, 0x3d, 0x78, 0x38, 0x36, 0x2d, 0x36, 0x34, 0x20, 0x2d, 0x67, 0x20, 0x2d,
+	0x67, 0x64, 0x77, 0x61, 0x72, 0x66, 0x2d, 0x34, 0x20, 0x2d, 0x4f, 0x30, 0x20, 0x2d, 0x66, 0x6e,
+	0x6f, 0x2d, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x68, 0x72, 0x6f, 0x6e, 0x6f, 0x75, 0x73, 0x2d, 0x75,
+	0x6e, 0x77, 0x69, 0x6e, 0x64, 0x2d, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x00, 0x6d, 0x6f, 0x76,
+	0x65, 0x00, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x58, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+	0xe8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x02, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+	0x3b, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x60, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00,
+	0x55, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x29, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x55, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00,
+	0x68, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x74, 0x2e, 0x63, 0x00, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x00, 0x61, 0x64, 0x64, 0x00,
+	0x6d, 0x6f, 0x76, 0x65, 0x00, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x00, 0x5f, 0x5f, 0x62,
+	0x73, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x5f, 0x65, 0x64, 0x61, 0x74, 0x61, 0x00,
+	0x5f, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x2e, 0x73, 0x79, 0x6d, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x73,
+	0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00,
+	0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x62, 0x73, 0x73, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75,
+	0x67, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x61, 0x62,
+	0x62, 0x72, 0x65, 0x76, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x6c, 0x69, 0x6e, 0x65,
+	0x00, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x58, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x27, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const retdec::common::Address ADD_ADDRESS = 0x4000e8;
+const retdec::common::Address MOVE_ADDRESS = 0x400102;
+const retdec::common::Address START_ADDRESS = 0x40013b;
+const retdec::common::Address ORIGIN_ADDRESS = 0x401158;
+const retdec::common::Address COUNTER_ADDRESS = 0x401160;
+
+std::string describe(const retdec::common::LineNumber& l)
+{
+	return l.isDefined() ? std::to_string(l.getValue()) : "?";
+}
+
+std::string describe(const retdec::common::Object& o)
+{
+	return o.getName() + ":" + o.type.getLlvmIr();
+}
+
+/**
+ * Describe all the debug information of function @a f.
+ */
+std::string describe(const retdec::common::Function& f)
+{
+	std::ostringstream out;
+	out << f.getName() << " " << f.getStart() << "-" << f.getEnd()
+		<< " " << f.getSourceFileName()
+		<< " " << describe(f.getStartLine()) << "-" << describe(f.getEndLine())
+		<< " " << f.returnType.getLlvmIr()
+		<< (f.isVariadic() ? " variadic" : "") << " (";
+	for (const auto& p : f.parameters)
+	{
+		out << describe(p) << " ";
+	}
+	out << ") {";
+	for (const auto& l : f.locals)
+	{
+		out << describe(l) << " ";
+	}
+	out << "}";
+	return out.str();
+}
+
+} // anonymous namespace
+
+/**
+ * @brief Tests for loading of DWARF debug information.
+ */
+class DwarfTests: public Test
+{
+	protected:
+		virtual void SetUp() override
+		{
+			filePath = fs::temp_directory_path() / "retdec-dwarf-tests.elf";
+			std::ofstream file(filePath.string(), std::ios::binary);
+			file.write(reinterpret_cast<const char*>(elfBytes.data()), elfBytes.size());
+			file.close();
+
+			image = retdec::loader::createImage(filePath.string());
+			ASSERT_NE(nullptr, image);
+		}
+
+		virtual void TearDown() override
+		{
+			fs::remove(filePath);
+		}
+
+		std::unique_ptr<DebugFormat> load(bool lazyDwarf)
+		{
+			return std::make_unique<DebugFormat>(
+					image.get(),
+					"",
+					nullptr,
+					&demangler,
+					lazyDwarf);
+		}
+
+	protected:
+		fs::path filePath;
+		std::unique_ptr<retdec::loader::Image> image;
+		retdec::demangler::ItaniumDemangler demangler;
+};
+
+TEST_F(DwarfTests, LazyLoadingIndexesOnlyNamesAndRanges)
+{
+	auto debug = load(true);
+
+	ASSERT_EQ(3, debug->functions.size());
+	const auto& add = debug->functions.at(ADD_ADDRESS);
+	EXPECT_EQ("add", add.getName());
+	EXPECT_EQ(MOVE_ADDRESS, add.getEnd());
+	EXPECT_TRUE(add.isFromDebug());
+	EXPECT_EQ("", add.getSourceFileName());
+	EXPECT_TRUE(add.getStartLine().isUndefined());
+	EXPECT_TRUE(add.parameters.empty());
+	EXPECT_TRUE(add.locals.empty());
+
+	ASSERT_EQ(2, debug->globals.size());
+	EXPECT_EQ("origin", debug->globals.getObjectByAddress(ORIGIN_ADDRESS)->getName());
+	EXPECT_EQ("counter", debug->globals.getObjectByAddress(COUNTER_ADDRESS)->getName());
+	EXPECT_TRUE(debug->types.empty());
+}
+
+TEST_F(DwarfTests, GetFunctionLinesLoadsOnlySourceFileAndLines)
+{
+	auto debug = load(true);
+
+	auto* add = debug->getFunctionLines(ADD_ADDRESS);
+
+	ASSERT_NE(nullptr, add);
+	EXPECT_EQ("/src/t.c", add->getSourceFileName());
+	EXPECT_EQ(5, add->getStartLine());
+	EXPECT_EQ(9, add->getEndLine());
+	EXPECT_TRUE(add->parameters.empty());
+	EXPECT_TRUE(add->locals.empty());
+	EXPECT_TRUE(debug->types.empty());
+}
+
+TEST_F(DwarfTests, GetFunctionLoadsWholeFunction)
+{
+	auto debug = load(true);
+
+	auto* move = debug->getFunction(MOVE_ADDRESS);
+
+	ASSERT_NE(nullptr, move);
+	EXPECT_EQ(
+		"move 0x400102-0x40013b /src/t.c 11-15 void (p:%point* dx:i32 ) {}",
+		describe(*move));
+	EXPECT_EQ(1, debug->types.count(retdec::common::Type("%point = type {i32, i32}")));
+	EXPECT_EQ(nullptr, debug->getFunction(MOVE_ADDRESS + 1));
+	EXPECT_EQ(nullptr, debug->getFunctionLines(MOVE_ADDRESS + 1));
+}
+
+TEST_F(DwarfTests, GetGlobalVarLoadsItsType)
+{
+	auto debug = load(true);
+
+	auto* origin = debug->getGlobalVar(ORIGIN_ADDRESS);
+
+	ASSERT_NE(nullptr, origin);
+	EXPECT_EQ("origin:%point", describe(*origin));
+	EXPECT_EQ(1, debug->types.count(retdec::common::Type("%point = type {i32, i32}")));
+}
+
+TEST_F(DwarfTests, LazyLoadingGivesSameResultsAsLoadingAll)
+{
+	auto eager = load(false);
+	auto lazy = load(true);
+
+	// Ask for the functions in different order than they are loaded in.
+	for (auto a : {START_ADDRESS, ADD_ADDRESS})
+	{
+		lazy->getFunctionLines(a);
+	}
+	for (auto a : {COUNTER_ADDRESS, ORIGIN_ADDRESS})
+	{
+		lazy->getGlobalVar(a);
+	}
+	for (auto a : {MOVE_ADDRESS, ADD_ADDRESS})
+	{
+		lazy->getFunction(a);
+	}
+	lazy->loadAll();
+
+	ASSERT_EQ(eager->functions.size(), lazy->functions.size());
+	for (const auto& p : eager->functions)
+	{
+		ASSERT_EQ(1, lazy->functions.count(p.first));
+		EXPECT_EQ(describe(p.second), describe(lazy->functions.at(p.first)));
+	}
+	EXPECT_EQ(
+		"add 0x4000e8-0x400102 /src/t.c 5-9 i32 (a:i32 b:i32 ) {sum:i32 }",
+		describe(lazy->functions.at(ADD_ADDRESS)));
+
+	ASSERT_EQ(eager->globals.size(), lazy->globals.size());
+	for (const auto& gv : eager->globals)
+	{
+		ASSERT_EQ(1, lazy->globals.count(gv));
+		EXPECT_EQ(describe(gv), describe(*lazy->globals.find(gv)));
+	}
+
+	EXPECT_EQ(eager->types, lazy->types);
+}
+
+TEST_F(DwarfTests, DwarfIsLoadedFromFileParsedInMemory)
+{
+	std::shared_ptr<retdec::fileformat::FileFormat> file =
+			retdec::fileformat::createFileFormat(elfBytes.data(), elfBytes.size());
+	auto memoryImage = retdec::loader::createImage(file);
+	ASSERT_NE(nullptr, memoryImage);
+
+	DebugFormat debug(memoryImage.get(), "", nullptr, &demangler, false);
+
+	auto* add = debug.getFunction(ADD_ADDRESS);
+	ASSERT_NE(nullptr, add);
+	EXPECT_EQ(
+		"add 0x4000e8-0x400102 /src/t.c 5-9 i32 (a:i32 b:i32 ) {sum:i32 }",
+		describe(*add));
+	EXPECT_EQ(load(false)->functions.size(), debug.functions.size());
+}
+
+} // namespace tests
+} // namespace debugformat
+} // namespace retdec
@@ -0,0 +1,91 @@
+/**
+ * @file tests/demangler/batch_demangler_tests.cpp
+ * @brief Tests for the batch demangler.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <gtest/gtest.h>
+
+#include "retdec/demangler/demangler.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace demangler {
+namespace tests {
+
+class BatchDemanglerTests : public Test
+{
+};
+
+TEST_F(BatchDemanglerTests, SchemeIsDetectedByPrefix)
+{
+	EXPECT_EQ(ManglingScheme::itanium, detectManglingScheme("_ZN3fooILi1EEC5Ev"));
+	EXPECT_EQ(ManglingScheme::itanium, detectManglingScheme("__ZN1A1B6myFuncEii"));
+	EXPECT_EQ(ManglingScheme::microsoft, detectManglingScheme("??_7type_info@@6B@"));
+	EXPECT_EQ(ManglingScheme::borland, detectManglingScheme("@myFunc_int_$qi"));
+	EXPECT_EQ(ManglingScheme::unknown, detectManglingScheme("main"));
+	EXPECT_EQ(ManglingScheme::unknown, detectManglingScheme(""));
+}
+
+TEST_F(BatchDemanglerTests, DemanglerIsCreatedForKnownSchemes)
+{
+	EXPECT_EQ("itanium", createDemangler(ManglingScheme::itanium)->getCompiler());
+	EXPECT_EQ("microsoft", createDemangler(ManglingScheme::microsoft)->getCompiler());
+	EXPECT_EQ("borland", createDemangler(ManglingScheme::borland)->getCompiler());
+	EXPECT_EQ(nullptr, createDemangler(ManglingScheme::unknown));
+}
+
+TEST_F(BatchDemanglerTests, NamesOfAllSchemesAreDemangledInOrder)
+{
+	BatchDemangler demangler(1);
+
+	auto results = demangler.demangle({
+		"_ZN3fooILi1EEC5Ev",
+		"main",
+		"??_7type_info@@6B@",
+		"@myFunc_int_$qi",
+		"_Zinvalid",
+	});
+
+	ASSERT_EQ(5, results.size());
+	EXPECT_EQ("foo<1>::foo()", results[0].demangled);
+	EXPECT_EQ(ManglingScheme::itanium, results[0].scheme);
+	EXPECT_EQ("", results[1].demangled);
+	EXPECT_EQ(ManglingScheme::unknown, results[1].scheme);
+	EXPECT_EQ("const type_info::`vftable'", results[2].demangled);
+	EXPECT_EQ(ManglingScheme::microsoft, results[2].scheme);
+	EXPECT_EQ("myFunc_int_(int)", results[3].demangled);
+	EXPECT_EQ(ManglingScheme::borland, results[3].scheme);
+	EXPECT_EQ("", results[4].demangled);
+	EXPECT_EQ(ManglingScheme::itanium, results[4].scheme);
+}
+
+TEST_F(BatchDemanglerTests, ResultsOfMoreThreadsAreInOrder)
+{
+	BatchDemangler demangler(4);
+	EXPECT_EQ(4, demangler.getThreadCount());
+
+	std::vector<std::string> names;
+	for (int i = 0; i < 10000; ++i) {
+		auto name = "f" + std::to_string(i);
+		names.push_back("_Z" + std::to_string(name.size()) + name + "v");
+	}
+
+	auto results = demangler.demangle(names);
+
+	ASSERT_EQ(names.size(), results.size());
+	for (int i = 0; i < 10000; ++i) {
+		EXPECT_EQ("f" + std::to_string(i) + "()", results[i].demangled);
+	}
+}
+
+TEST_F(BatchDemanglerTests, EmptyBatchIsDemangled)
+{
+	BatchDemangler demangler(4);
+	EXPECT_TRUE(demangler.demangle({}).empty());
+}
+
+} // namespace tests
+} // namespace demangler
+} // namespace retdec
@@ -0,0 +1,132 @@
+/**
+ * @file tests/demangler/caching_demangler_tests.cpp
+ * @brief Tests for the caching demangler.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/ctypes/context.h"
+#include "retdec/ctypes/function.h"
+#include "retdec/ctypes/module.h"
+#include "retdec/demangler/demangler.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace demangler {
+namespace tests {
+
+class CachingDemanglerTests : public Test
+{
+public:
+	using status = retdec::demangler::Demangler::Status;
+
+	CachingDemanglerTests() :
+		demangler(std::make_unique<BorlandDemangler>()),
+		module(std::make_unique<ctypes::Module>(std::make_shared<retdec::ctypes::Context>())) {}
+
+protected:
+	std::shared_ptr<ctypes::Function> mangledToCtypes(const std::string &mangled)
+	{
+		return demangler.demangleFunctionToCtypes(
+				mangled,
+				module,
+				{{"int", 32}},
+				{},
+				32);
+	}
+
+	CachingDemangler demangler;
+	std::unique_ptr<retdec::ctypes::Module> module;
+};
+
+TEST_F(CachingDemanglerTests, CompilerIsTakenFromWrappedDemangler)
+{
+	EXPECT_EQ("borland", demangler.getCompiler());
+}
+
+TEST_F(CachingDemanglerTests, RepeatedDemanglingIsCached)
+{
+	EXPECT_EQ("foo(int)", demangler.demangleToString("@foo$qi"));
+	EXPECT_EQ(status::success, demangler.status());
+	EXPECT_EQ("foo(int)", demangler.demangleToString("@foo$qi"));
+	EXPECT_EQ(status::success, demangler.status());
+
+	EXPECT_EQ(1, demangler.statistics().hits);
+	EXPECT_EQ(1, demangler.statistics().misses);
+}
+
+TEST_F(CachingDemanglerTests, StatusOfFailedDemanglingIsCached)
+{
+	EXPECT_EQ("", demangler.demangleToString("@foo$q010ns@Bar@Baz"));
+	EXPECT_EQ(status::invalid_mangled_name, demangler.status());
+
+	demangler.demangleToString("@foo$qi");
+	EXPECT_EQ(status::success, demangler.status());
+
+	EXPECT_EQ("", demangler.demangleToString("@foo$q010ns@Bar@Baz"));
+	EXPECT_EQ(status::invalid_mangled_name, demangler.status());
+	EXPECT_EQ(1, demangler.statistics().hits);
+}
+
+TEST_F(CachingDemanglerTests, FunctionIsTakenFromModule)
+{
+	auto f1 = mangledToCtypes("@foo$qi");
+	ASSERT_NE(nullptr, f1);
+	EXPECT_TRUE(module->hasFunctionWithName("@foo$qi"));
+
+	auto f2 = mangledToCtypes("@foo$qi");
+	EXPECT_EQ(f1, f2);
+	EXPECT_EQ(status::success, demangler.status());
+
+	EXPECT_EQ(1, demangler.statistics().hits);
+	EXPECT_EQ(1, demangler.statistics().misses);
+}
+
+TEST_F(CachingDemanglerTests, FunctionIsDemangledAgainForOtherModule)
+{
+	mangledToCtypes("@foo$qi");
+	module = std::make_unique<ctypes::Module>(std::make_shared<retdec::ctypes::Context>());
+
+	EXPECT_NE(nullptr, mangledToCtypes("@foo$qi"));
+	EXPECT_EQ(2, demangler.statistics().misses);
+}
+
+TEST_F(CachingDemanglerTests, NamesWhichAreNotFunctionsAreCached)
+{
+	EXPECT_EQ(nullptr, mangledToCtypes("@foo$q010ns@Bar@Baz"));
+	EXPECT_EQ(status::invalid_mangled_name, demangler.status());
+	EXPECT_EQ(nullptr, mangledToCtypes("@foo$q010ns@Bar@Baz"));
+	EXPECT_EQ(status::invalid_mangled_name, demangler.status());
+
+	EXPECT_EQ(1, demangler.statistics().hits);
+	EXPECT_EQ(1, demangler.statistics().misses);
+}
+
+TEST_F(CachingDemanglerTests, DemanglingFromMoreThreadsIsSafe)
+{
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([this]() {
+			for (int i = 0; i < 1000; ++i) {
+				auto name = "@foo" + std::to_string(i % 100) + "$qi";
+				EXPECT_EQ("foo" + std::to_string(i % 100) + "(int)",
+						demangler.demangleToString(name));
+			}
+		});
+	}
+	for (auto &t : threads) {
+		t.join();
+	}
+
+	EXPECT_EQ(100, demangler.statistics().misses);
+	EXPECT_EQ(3900, demangler.statistics().hits);
+}
+
+} // namespace tests
+} // namespace demangler
+} // namespace retdec
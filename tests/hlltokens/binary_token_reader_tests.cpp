@@ -0,0 +1,161 @@
+/**
+* @file tests/hlltokens/binary_token_reader_tests.cpp
+* @brief Tests for the @c binary_token_reader module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/hlltokens/binary_format.h"
+#include "retdec/hlltokens/binary_token_reader.h"
+
+using namespace ::testing;
+using namespace retdec::hlltokens::binary_format;
+
+namespace retdec {
+namespace hlltokens {
+namespace tests {
+
+class BinaryTokenReaderTests : public Test
+{
+	protected:
+		void open(const std::vector<std::uint8_t>& records)
+		{
+			data.assign(MAGIC, MAGIC + sizeof(MAGIC));
+			data.push_back(VERSION);
+			data.insert(data.end(), records.begin(), records.end());
+			reader.openBuffer(data.data(), data.size());
+		}
+
+		static std::uint8_t op(std::uint8_t type, TokenKind kind)
+		{
+			return type | static_cast<std::uint8_t>(kind);
+		}
+
+	protected:
+		std::vector<std::uint8_t> data;
+		BinaryTokenReader reader;
+		TokenEntry entry;
+};
+
+TEST_F(BinaryTokenReaderTests,
+OpeningDataWithBadMagicThrowsException)
+{
+	std::vector<std::uint8_t> bad = {'R', 'D', 'X', 'O', 'K', 'E', 'N', 'S', VERSION};
+
+	ASSERT_THROW(reader.openBuffer(bad.data(), bad.size()), BinaryTokenReaderError);
+	EXPECT_FALSE(reader.isOpen());
+}
+
+TEST_F(BinaryTokenReaderTests,
+OpeningDataWithUnsupportedVersionThrowsException)
+{
+	std::vector<std::uint8_t> bad(MAGIC, MAGIC + sizeof(MAGIC));
+	bad.push_back(VERSION + 1);
+
+	ASSERT_THROW(reader.openBuffer(bad.data(), bad.size()), BinaryTokenReaderError);
+}
+
+TEST_F(BinaryTokenReaderTests,
+NewTokenValuesCanBeReferencedLater)
+{
+	open({
+		op(TOKEN_NEW, TokenKind::FunctionId), 4, 'm', 'a', 'i', 'n',
+		op(TOKEN_NEW, TokenKind::Punctuation), 1, '(',
+		op(TOKEN_REF, TokenKind::FunctionId), 0,
+		op(TOKEN_REF, TokenKind::Punctuation), 1,
+	});
+
+	ASSERT_TRUE(reader.next(entry));
+	EXPECT_EQ(TokenEntry::Type::Token, entry.type);
+	EXPECT_EQ(TokenKind::FunctionId, entry.kind);
+	EXPECT_EQ("main", entry.value);
+	ASSERT_TRUE(reader.next(entry));
+	EXPECT_EQ(TokenKind::Punctuation, entry.kind);
+	EXPECT_EQ("(", entry.value);
+	ASSERT_TRUE(reader.next(entry));
+	EXPECT_EQ(TokenKind::FunctionId, entry.kind);
+	EXPECT_EQ("main", entry.value);
+	ASSERT_TRUE(reader.next(entry));
+	EXPECT_EQ(TokenKind::Punctuation, entry.kind);
+	EXPECT_EQ("(", entry.value);
+}
+
+TEST_F(BinaryTokenReaderTests,
+InlineTokenValuesAreNotAddedToStringTable)
+{
+	open({
+		op(TOKEN_INLINE, TokenKind::Comment), 2, '/', '/',
+		op(TOKEN_REF, TokenKind::Comment), 0,
+	});
+
+	ASSERT_TRUE(reader.next(entry));
+	EXPECT_EQ(TokenKind::Comment, entry.kind);
+	EXPECT_EQ("//", entry.value);
+	ASSERT_THROW(reader.next(entry), BinaryTokenReaderError);
+}
+
+TEST_F(BinaryTokenReaderTests,
+AddressesAreDeltaEncoded)
+{
+	open({
+		ADDRESS, 0x80, 0x40,       // +0x1000
+		ADDRESS, 0x20,             // +0x10
+		ADDRESS_UNDEFINED,
+		ADDRESS, 0x1f,             // -0x10
+	});
+
+	ASSERT_TRUE(reader.next(entry));
+	EXPECT_EQ(TokenEntry::Type::Address, entry.type);
+	EXPECT_TRUE(entry.addressDefined);
+	EXPECT_EQ(0x1000, entry.address);
+	ASSERT_TRUE(reader.next(entry));
+	EXPECT_EQ(0x1010, entry.address);
+	ASSERT_TRUE(reader.next(entry));
+	EXPECT_EQ(TokenEntry::Type::Address, entry.type);
+	EXPECT_FALSE(entry.addressDefined);
+	ASSERT_TRUE(reader.next(entry));
+	EXPECT_TRUE(entry.addressDefined);
+	EXPECT_EQ(0x1000, entry.address);
+}
+
+TEST_F(BinaryTokenReaderTests,
+NothingIsReadAfterEnd)
+{
+	open({
+		END, 1, 'C',
+		op(TOKEN_NEW, TokenKind::Keyword), 2, 'i', 'f',
+	});
+
+	ASSERT_TRUE(reader.next(entry));
+	EXPECT_EQ(TokenEntry::Type::End, entry.type);
+	EXPECT_EQ("C", entry.value);
+	EXPECT_FALSE(reader.next(entry));
+}
+
+TEST_F(BinaryTokenReaderTests,
+TruncatedDataThrowsException)
+{
+	open({
+		op(TOKEN_NEW, TokenKind::Keyword), 5, 'i', 'f',
+	});
+
+	ASSERT_THROW(reader.next(entry), BinaryTokenReaderError);
+}
+
+TEST_F(BinaryTokenReaderTests,
+InvalidTokenKindThrowsException)
+{
+	open({
+		TOKEN_NEW | TOKEN_KIND_MASK, 0,
+	});
+
+	ASSERT_THROW(reader.next(entry), BinaryTokenReaderError);
+}
+
+} // namespace tests
+} // namespace hlltokens
+} // namespace retdec
@@ -0,0 +1,100 @@
+/**
+* @file tests/hlltokens/json_converter_tests.cpp
+* @brief Tests for the @c json_converter module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/hlltokens/binary_format.h"
+#include "retdec/hlltokens/binary_token_reader.h"
+#include "retdec/hlltokens/json_converter.h"
+
+using namespace ::testing;
+using namespace retdec::hlltokens::binary_format;
+
+namespace retdec {
+namespace hlltokens {
+namespace tests {
+
+class JsonConverterTests : public Test
+{
+	protected:
+		std::string convert(
+				const std::vector<std::uint8_t>& records,
+				bool pretty = false)
+		{
+			data.assign(MAGIC, MAGIC + sizeof(MAGIC));
+			data.push_back(VERSION);
+			data.insert(data.end(), records.begin(), records.end());
+			reader.openBuffer(data.data(), data.size());
+
+			std::ostringstream out;
+			convertToJson(reader, out, pretty);
+			return out.str();
+		}
+
+		static std::uint8_t op(std::uint8_t type, TokenKind kind)
+		{
+			return type | static_cast<std::uint8_t>(kind);
+		}
+
+	protected:
+		std::vector<std::uint8_t> data;
+		BinaryTokenReader reader;
+};
+
+TEST_F(JsonConverterTests,
+EmptySequenceIsConverted)
+{
+	EXPECT_EQ(
+		R"({"tokens":[],"language":"C"})",
+		convert({END, 1, 'C'})
+	);
+}
+
+TEST_F(JsonConverterTests,
+TokensAndAddressesAreConverted)
+{
+	EXPECT_EQ(
+		R"({"tokens":[{"addr":""},{"kind":"i_fnc","val":"f"},)"
+		R"({"addr":"0x1000"},{"kind":"cmnt","val":"// \"x\""},)"
+		R"({"kind":"i_fnc","val":"f"}],"language":"C"})",
+		convert({
+			ADDRESS_UNDEFINED,
+			op(TOKEN_NEW, TokenKind::FunctionId), 1, 'f',
+			ADDRESS, 0x80, 0x40,
+			op(TOKEN_INLINE, TokenKind::Comment), 6, '/', '/', ' ', '"', 'x', '"',
+			op(TOKEN_REF, TokenKind::FunctionId), 0,
+			END, 1, 'C',
+		})
+	);
+}
+
+TEST_F(JsonConverterTests,
+PrettyJsonIsGeneratedWhenRequested)
+{
+	EXPECT_EQ(
+		"{\n"
+		"    \"tokens\": [\n"
+		"        {\n"
+		"            \"kind\": \"nl\",\n"
+		"            \"val\": \"\\n\"\n"
+		"        }\n"
+		"    ],\n"
+		"    \"language\": \"C\"\n"
+		"}",
+		convert({
+			op(TOKEN_NEW, TokenKind::NewLine), 1, '\n',
+			END, 1, 'C',
+		}, true)
+	);
+}
+
+} // namespace tests
+} // namespace hlltokens
+} // namespace retdec
@@ -0,0 +1,156 @@
+/**
+* @file tests/llvmir2hll/hll/output_managers/binary_manager_tests.cpp
+* @brief Implementation of class for tests of binary output manager.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <functional>
+#include <sstream>
+
+#include "llvmir2hll/hll/output_managers/output_manager_tests.h"
+#include "retdec/hlltokens/binary_token_reader.h"
+#include "retdec/hlltokens/json_converter.h"
+#include "retdec/llvmir2hll/hll/output_managers/binary_manager.h"
+#include "retdec/llvmir2hll/hll/output_managers/json_manager.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+class BinaryOutputManagerTests: public OutputManagerTests
+{
+	protected:
+		virtual void SetUp() override;
+
+		void expectSameAsJson(std::function<void(OutputManager&)> emit);
+		std::string emitJson(std::function<void(OutputManager&)> emit);
+		std::string convertToJson();
+};
+
+void BinaryOutputManagerTests::SetUp()
+{
+	OutputManagerTests::SetUp();
+	manager = UPtr<OutputManager>(new BinaryOutputManager(codeStream));
+	manager->setCommentPrefix("//");
+	manager->setOutputLanguage("C");
+}
+
+/**
+* @brief Emits tokens by @a emit and checks that the binary output converted
+*        into JSON is the same as the output of the JSON output manager.
+*/
+void BinaryOutputManagerTests::expectSameAsJson(
+		std::function<void(OutputManager&)> emit)
+{
+	emit(*manager);
+	EXPECT_EQ(emitJson(emit), convertToJson());
+}
+
+std::string BinaryOutputManagerTests::emitJson(
+		std::function<void(OutputManager&)> emit)
+{
+	std::string json;
+	llvm::raw_string_ostream jsonStream(json);
+	JsonOutputManagerPlain jsonManager(jsonStream);
+	jsonManager.setCommentPrefix("//");
+	jsonManager.setOutputLanguage("C");
+	emit(jsonManager);
+	jsonManager.finalize();
+	return jsonStream.str();
+}
+
+std::string BinaryOutputManagerTests::convertToJson()
+{
+	auto code = emitCode();
+	hlltokens::BinaryTokenReader reader;
+	reader.openBuffer(
+		reinterpret_cast<const std::uint8_t*>(code.data()),
+		code.size());
+	std::ostringstream out;
+	hlltokens::convertToJson(reader, out);
+	return out.str();
+}
+
+TEST_F(BinaryOutputManagerTests, output_starts_with_magic)
+{
+	EXPECT_EQ(0, emitCode().find("RDTOKENS"));
+}
+
+TEST_F(BinaryOutputManagerTests, empty_output_is_same_as_json)
+{
+	expectSameAsJson([](OutputManager&) {});
+}
+
+TEST_F(BinaryOutputManagerTests, tokens_are_same_as_json)
+{
+	expectSameAsJson([](OutputManager& m) {
+		m.includeLine("stdio.h");
+		m.keyword("int");
+		m.space();
+		m.functionId("main");
+		m.punctuation('(');
+		m.dataType("int");
+		m.space();
+		m.parameterId("argc");
+		m.punctuation(')');
+		m.newLine();
+		m.constantString("\"hello\\n\"");
+		m.operatorX("=", true, true);
+		m.constantInt("-1");
+		m.functionId("main");
+		m.commentLine("comment", "    ");
+	});
+}
+
+TEST_F(BinaryOutputManagerTests, comment_modifier_is_same_as_json)
+{
+	expectSameAsJson([](OutputManager& m) {
+		m.commentModifier();
+		m.localVariableId("hello");
+		m.space();
+		m.operatorX("=");
+		m.space();
+		m.constantInt("1234");
+		m.punctuation(';');
+		m.newLine();
+		m.functionId("f");
+	});
+}
+
+TEST_F(BinaryOutputManagerTests, addresses_are_same_as_json)
+{
+	expectSameAsJson([](OutputManager& m) {
+		m.addressPush(0x1000);
+		m.localVariableId("v1");
+		m.addressPush(0x800);
+		m.localVariableId("v2");
+		m.addressPush(Address::Undefined);
+		m.functionId("f");
+		m.addressPop();
+		m.addressPop();
+		m.localVariableId("v1");
+		m.addressPush(0xffffffffffffffff);
+		m.localVariableId("v3");
+		m.addressPop();
+		m.addressPop();
+	});
+}
+
+TEST_F(BinaryOutputManagerTests, repeated_values_are_stored_once)
+{
+	for (int i = 0; i < 100; ++i)
+	{
+		manager->localVariableId("a_long_variable_name");
+	}
+
+	auto code = emitCode();
+	auto first = code.find("a_long_variable_name");
+	EXPECT_NE(std::string::npos, first);
+	EXPECT_EQ(std::string::npos, code.find("a_long_variable_name", first + 1));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -0,0 +1,121 @@
+/**
+* @file tests/llvmir2hll/hll/output_sink_tests.cpp
+* @brief Tests for the @c output_sink module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/hll/output_managers/json_manager.h"
+#include "retdec/llvmir2hll/hll/output_sink.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+class OutputSinkStreamTests: public Test
+{
+	protected:
+		OutputSink sink()
+		{
+			return [this](std::string_view chunk) {
+				chunks.emplace_back(chunk);
+			};
+		}
+
+		std::string joinedChunks() const
+		{
+			std::string result;
+			for (const auto& chunk : chunks)
+			{
+				result += chunk;
+			}
+			return result;
+		}
+
+	protected:
+		std::vector<std::string> chunks;
+};
+
+TEST_F(OutputSinkStreamTests,
+NothingIsPassedToSinkWhenNothingIsWritten)
+{
+	{
+		OutputSinkStream stream(sink());
+	}
+
+	EXPECT_TRUE(chunks.empty());
+}
+
+TEST_F(OutputSinkStreamTests,
+WrittenDataArePassedToSinkOnFlush)
+{
+	OutputSinkStream stream(sink());
+	stream << "hello " << 42;
+
+	EXPECT_TRUE(chunks.empty());
+	stream.flush();
+	EXPECT_EQ("hello 42", joinedChunks());
+	EXPECT_EQ(8, stream.tell());
+}
+
+TEST_F(OutputSinkStreamTests,
+WrittenDataArePassedToSinkOnDestruction)
+{
+	{
+		OutputSinkStream stream(sink());
+		stream << "hello";
+	}
+
+	EXPECT_EQ("hello", joinedChunks());
+}
+
+TEST_F(OutputSinkStreamTests,
+DataArePassedToSinkInChunksBeforeFlush)
+{
+	OutputSinkStream stream(sink(), 4);
+	stream << "abcdefghij";
+
+	EXPECT_FALSE(chunks.empty());
+	stream.flush();
+	EXPECT_EQ("abcdefghij", joinedChunks());
+}
+
+TEST_F(OutputSinkStreamTests,
+JsonOutputManagerStreamsSameOutputAsIntoString)
+{
+	auto emit = [](llvm::raw_ostream& out) {
+		JsonOutputManagerPlain manager(out);
+		manager.setCommentPrefix("//");
+		for (int i = 0; i < 100; ++i)
+		{
+			manager.keyword("int");
+			manager.space();
+			manager.localVariableId("v" + std::to_string(i));
+			manager.punctuation(';');
+			manager.newLine();
+		}
+		manager.finalize();
+	};
+	std::string expected;
+	llvm::raw_string_ostream expectedStream(expected);
+	emit(expectedStream);
+	expectedStream.flush();
+
+	OutputSinkStream stream(sink(), 256);
+	emit(stream);
+	std::size_t chunksBeforeFlush = chunks.size();
+	stream.flush();
+
+	EXPECT_LT(1, chunksBeforeFlush);
+	EXPECT_EQ(expected, joinedChunks());
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -127,6 +127,19 @@ GetNameOfParamForKnownFunctionsReturnsCorrectAnswer) {
 	EXPECT_EQ("uStyle", openFileParam3Name.value());
 }
 
+TEST_F(WinAPISemanticsTests,
+GetNameOfParamForFunctionsFromDifferentTablesReturnsCorrectAnswer) {
+	// _lwrite (the end of the table for A and underscore)
+	std::optional<std::string> lwriteParam3Name(semantics->getNameOfParam("_lwrite", 3));
+	ASSERT_TRUE(lwriteParam3Name) << "no name of the third parameter of `_lwrite`";
+	EXPECT_EQ("uBytes", lwriteParam3Name.value());
+
+	// ZombifyActCtx (the only function in the table for Z)
+	std::optional<std::string> zombifyActCtxParam1Name(semantics->getNameOfParam("ZombifyActCtx", 1));
+	ASSERT_TRUE(zombifyActCtxParam1Name) << "no name of the first parameter of `ZombifyActCtx`";
+	EXPECT_EQ("hActCtx", zombifyActCtxParam1Name.value());
+}
+
 TEST_F(WinAPISemanticsTests,
 GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	// foo
@@ -134,6 +147,13 @@ GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	EXPECT_FALSE(fooParam1Name) << "there should be no information for `foo`";
 }
 
+TEST_F(WinAPISemanticsTests,
+GetNameOfParamForUnknownParamPositionReturnsNoAnswer) {
+	// OpenFile has only three parameters.
+	std::optional<std::string> openFileParam4Name(semantics->getNameOfParam("OpenFile", 4));
+	EXPECT_FALSE(openFileParam4Name) << "there should be no information for the fourth parameter of `OpenFile`";
+}
+
 //
 // getSymbolicNamesForParam()
 //
@@ -0,0 +1,299 @@
+/**
+* @file tests/pdbparser/pdb_file_tests.cpp
+* @brief Tests for the @c pdb_file module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include "retdec/pdbparser/pdb_file.h"
+#include "retdec/utils/filesystem.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace pdbparser {
+namespace tests {
+
+namespace {
+
+const unsigned PAGE_SIZE = 0x400;
+const unsigned TI_MIN = 0x1000;
+
+/// Number of modifier records which make the TPI stream longer than a page.
+const unsigned PADDING_RECORDS = 150;
+
+void putWord(std::vector<char> &data, unsigned value)
+{
+	data.push_back(value & 0xff);
+	data.push_back((value >> 8) & 0xff);
+}
+
+void putDword(std::vector<char> &data, unsigned value)
+{
+	putWord(data, value & 0xffff);
+	putWord(data, value >> 16);
+}
+
+void putDword(std::vector<char> &data, std::size_t offset, unsigned value)
+{
+	for (int i = 0; i < 4; ++i)
+		data[offset + i] = (value >> (8 * i)) & 0xff;
+}
+
+/**
+* @brief Creates TPI stream with these types:
+*
+* 0x1000: arglist (int)
+* 0x1001: int (*)(int)
+* 0x1002: pointer to 0x1001
+* 0x1003: const char
+* 0x1004: pointer to 0x1005 (forward reference)
+* 0x1005: pointer to 0x1003
+*
+* They are followed by @c PADDING_RECORDS modifiers of int.
+*/
+std::vector<char> createTpiStream()
+{
+	std::vector<char> tpi(sizeof(HDR), 0);
+
+	putWord(tpi, 10); putWord(tpi, LF_ARGLIST);
+	putDword(tpi, 1); putDword(tpi, T_INT4);
+
+	putWord(tpi, 14); putWord(tpi, LF_PROCEDURE);
+	putDword(tpi, T_INT4); tpi.push_back(0); tpi.push_back(0);
+	putWord(tpi, 1); putDword(tpi, TI_MIN);
+
+	putWord(tpi, 10); putWord(tpi, LF_POINTER);
+	putDword(tpi, TI_MIN + 1); putDword(tpi, 0);
+
+	putWord(tpi, 8); putWord(tpi, LF_MODIFIER);
+	putDword(tpi, T_CHAR); putWord(tpi, 1);
+
+	putWord(tpi, 10); putWord(tpi, LF_POINTER);
+	putDword(tpi, TI_MIN + 5); putDword(tpi, 0);
+
+	putWord(tpi, 10); putWord(tpi, LF_POINTER);
+	putDword(tpi, TI_MIN + 3); putDword(tpi, 0);
+
+	for (unsigned i = 0; i < PADDING_RECORDS; ++i)
+	{
+		putWord(tpi, 8); putWord(tpi, LF_MODIFIER);
+		putDword(tpi, T_INT4); putWord(tpi, 1);
+	}
+
+	putDword(tpi, 8, TI_MIN);
+	putDword(tpi, 12, TI_MIN + 6 + PADDING_RECORDS);
+	putDword(tpi, 16, tpi.size() - sizeof(HDR));
+	return tpi;
+}
+
+/**
+* @brief Creates PDB 7.00 file with PDB info and TPI streams. Pages of the TPI
+*        stream are stored in reverse order, so the stream is not linear.
+*/
+std::vector<char> createPdbFile()
+{
+	auto tpi = createTpiStream();
+	unsigned tpiPages = (tpi.size() + PAGE_SIZE - 1) / PAGE_SIZE;
+
+	// Pages: header, root indexes, root, PDB info, TPI.
+	unsigned numPages = 4 + tpiPages;
+	std::vector<char> pdb(numPages * PAGE_SIZE, 0);
+
+	std::memcpy(pdb.data(), PDB_SIGNATURE_700, PDB_SIGNATURE_700_SIZE);
+	std::vector<char> header;
+	putDword(header, PAGE_SIZE);
+	putDword(header, 2);
+	putDword(header, numPages);
+	putDword(header, 0);  // root size, set below
+	putDword(header, 0);
+	putDword(header, 1);
+	std::memcpy(pdb.data() + PDB_SIGNATURE_700_SIZE, header.data(), header.size());
+
+	// Root indexes page.
+	putDword(pdb, PAGE_SIZE, 2);
+
+	// Root: root, PDB info, TPI and DBI streams.
+	std::vector<char> root;
+	putDword(root, 4);
+	putDword(root, 0);
+	putDword(root, sizeof(PDBInfo70));
+	putDword(root, tpi.size());
+	putDword(root, 0);
+	putDword(root, 3);
+	for (unsigned i = 0; i < tpiPages; ++i)
+		putDword(root, 4 + tpiPages - 1 - i);
+	std::memcpy(pdb.data() + 2 * PAGE_SIZE, root.data(), root.size());
+	putDword(pdb, PDB_SIGNATURE_700_SIZE + 12, root.size());
+
+	for (unsigned i = 0; i < tpiPages; ++i)
+	{
+		auto size = std::min<std::size_t>(PAGE_SIZE, tpi.size() - i * PAGE_SIZE);
+		std::memcpy(
+			pdb.data() + (4 + tpiPages - 1 - i) * PAGE_SIZE,
+			tpi.data() + i * PAGE_SIZE,
+			size);
+	}
+	return pdb;
+}
+
+} // anonymous namespace
+
+/**
+* @brief Tests for the @c pdb_file module.
+*/
+class PDBFileTests: public Test {
+protected:
+	virtual void SetUp() override {
+		filePath = fs::temp_directory_path() / "retdec-pdb-file-tests.pdb";
+	}
+
+	virtual void TearDown() override {
+		fs::remove(filePath);
+	}
+
+	void writeTestFile(const std::vector<char> &content) {
+		std::ofstream file(filePath.string(), std::ios::binary);
+		file.write(content.data(), content.size());
+	}
+
+	PDBFileState loadTestFile() {
+		return pdb.load_pdb_file(filePath.string().c_str());
+	}
+
+protected:
+	fs::path filePath;
+	PDBFile pdb;
+};
+
+TEST_F(PDBFileTests,
+LoadingNonExistingFileFails) {
+	EXPECT_EQ(PDB_STATE_ERR_FILE_OPEN, loadTestFile());
+}
+
+TEST_F(PDBFileTests,
+LoadingTooShortFileFails) {
+	writeTestFile({'M', 'i', 'c', 'r', 'o', 's', 'o', 'f', 't'});
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, loadTestFile());
+}
+
+TEST_F(PDBFileTests,
+NonLinearStreamIsProvidedInOrder) {
+	writeTestFile(createPdbFile());
+
+	ASSERT_EQ(PDB_STATE_OK, loadTestFile());
+
+	auto tpi = createTpiStream();
+	auto *stream = pdb.get_stream(PDB_STREAM_TPI);
+	ASSERT_NE(nullptr, stream);
+	ASSERT_EQ(tpi.size(), stream->size);
+	EXPECT_FALSE(stream->linear);
+	EXPECT_EQ(0, std::memcmp(tpi.data(), stream->data, tpi.size()));
+	EXPECT_EQ(nullptr, pdb.get_stream(4));
+}
+
+TEST_F(PDBFileTests,
+TypesAreParsedWhenTheyAreUsed) {
+	writeTestFile(createPdbFile());
+	ASSERT_EQ(PDB_STATE_OK, loadTestFile());
+	pdb.initialize();
+	auto *types = pdb.get_types_container();
+	ASSERT_NE(nullptr, types);
+	auto baseTypes = types->types.size();
+
+	auto *ptr = types->get_type_by_index(TI_MIN + 2);
+
+	ASSERT_NE(nullptr, ptr);
+	ASSERT_EQ(PDBTYPE_POINTER, ptr->type_class);
+	auto *func = static_cast<PDBTypePointer *>(ptr)->ptr_utype_def;
+	ASSERT_NE(nullptr, func);
+	ASSERT_EQ(PDBTYPE_FUNCTION, func->type_class);
+	auto *f = static_cast<PDBTypeFunction *>(func);
+	EXPECT_EQ(types->get_type_by_index(T_INT4), f->func_rettype_def);
+	ASSERT_EQ(1, f->func_args_count);
+	EXPECT_EQ(types->get_type_by_index(T_INT4), f->func_args[0].type_def);
+	EXPECT_EQ(baseTypes + 3, types->types.size());
+	EXPECT_EQ(ptr, types->get_type_by_index(TI_MIN + 2));
+}
+
+TEST_F(PDBFileTests,
+TypesReferToPrecedingTypesOnly) {
+	writeTestFile(createPdbFile());
+	ASSERT_EQ(PDB_STATE_OK, loadTestFile());
+	pdb.initialize();
+	auto *types = pdb.get_types_container();
+
+	auto *forward = types->get_type_by_index(TI_MIN + 4);
+	auto *backward = types->get_type_by_index(TI_MIN + 5);
+
+	ASSERT_NE(nullptr, forward);
+	ASSERT_NE(nullptr, backward);
+	EXPECT_EQ(nullptr, static_cast<PDBTypePointer *>(forward)->ptr_utype_def);
+	EXPECT_EQ(
+		types->get_type_by_index(TI_MIN + 3),
+		static_cast<PDBTypePointer *>(backward)->ptr_utype_def);
+}
+
+TEST_F(PDBFileTests,
+AllTypesAreParsedOnRequest) {
+	writeTestFile(createPdbFile());
+	ASSERT_EQ(PDB_STATE_OK, loadTestFile());
+	pdb.initialize();
+	auto *types = pdb.get_types_container();
+	auto baseTypes = types->types.size();
+
+	types->parse_types();
+
+	EXPECT_TRUE(types->parsed);
+	EXPECT_EQ(baseTypes + 6 + PADDING_RECORDS, types->types.size());
+	EXPECT_EQ(nullptr, types->get_type_by_index(TI_MIN + 6 + PADDING_RECORDS));
+}
+
+/**
+* @brief Measures time and memory needed to load and initialize a real PDB
+*        file given by the @c RETDEC_PDB_BENCHMARK_FILE environment variable.
+*
+* Run it by
+* @code
+* RETDEC_PDB_BENCHMARK_FILE=file.pdb retdec-tests-pdbparser \
+*     --gtest_also_run_disabled_tests --gtest_filter='*Benchmark*'
+* @endcode
+*/
+TEST_F(PDBFileTests,
+DISABLED_BenchmarkLoadingOfPdbFile) {
+	auto *path = std::getenv("RETDEC_PDB_BENCHMARK_FILE");
+	if (path == nullptr)
+	{
+		std::cout << "RETDEC_PDB_BENCHMARK_FILE is not set" << std::endl;
+		return;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	ASSERT_EQ(PDB_STATE_OK, pdb.load_pdb_file(path));
+	pdb.initialize();
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	std::cout << "load + initialize: " << elapsed.count() << " s" << std::endl;
+#ifdef __linux__
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	std::cout << "max RSS: " << usage.ru_maxrss << " kB" << std::endl;
+#endif
+}
+
+} // namespace tests
+} // namespace pdbparser
+} // namespace retdec
@@ -0,0 +1,113 @@
+/**
+* @file tests/pelib/directory_tests.cpp
+* @brief Tests for reading data directories of PE files.
+* @copyright (c) 2020 Avast Software, licensed under the MIT license
+*/
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/pelib/PeFile.h"
+#include "pelib/pelib_tests.h"
+
+using namespace ::testing;
+
+namespace PeLib {
+namespace tests {
+
+/**
+* @brief Tests for reading data directories of PE files.
+*/
+class DirectoryTests: public PeImageTests
+{
+	protected:
+		/**
+		* Add a resource tree with three subdirectories. Each of them claims
+		* the maximum number of entries, so the total exceeds the limit.
+		*/
+		void addHugeResourceTree()
+		{
+			// The entries of the subdirectories must fit into the image
+			put32(0x90, 0x110000);
+			putSection(2, ".bss", 0x10d000, 0x3000, 0, 0, 0xc0000080);
+			putDataDirectory(PELIB_IMAGE_DIRECTORY_ENTRY_RESOURCE, 0x2100, 0x100);
+
+			// The root node, placed behind the relocations
+			std::size_t root = 0x1500;
+			put16(root + 14, 3);
+			for (std::uint32_t i = 0; i < 3; i++)
+			{
+				std::uint32_t subdir = 0x40 + i * 0x20;
+
+				put32(root + 16 + i * 8, i + 1);
+				put32(root + 20 + i * 8, PELIB_IMAGE_RESOURCE_DATA_IS_DIRECTORY | subdir);
+				put16(root + subdir + 12, 0xffff);
+				put16(root + subdir + 14, 0xffff);
+			}
+		}
+
+		std::unique_ptr<PeFileT> readDirectories(bool concurrently)
+		{
+			auto file = std::make_unique<PeFileT>(stream);
+			EXPECT_EQ(ERROR_NONE, file->loadPeHeaders(fileData));
+			file->readDirectories(concurrently);
+			return file;
+		}
+
+	protected:
+		std::istringstream stream;
+};
+
+TEST_F(DirectoryTests, RelocationEntriesAboveLimitAreTruncated)
+{
+	std::uint32_t smallBlockSize = PELIB_IMAGE_SIZEOF_BASE_RELOCATION + 0x10 * sizeof(std::uint16_t);
+	std::uint32_t hugeBlockSize = PELIB_IMAGE_SIZEOF_BASE_RELOCATION + PELIB_MAX_RELOCATION_ENTRIES * sizeof(std::uint16_t);
+	ByteBuffer data(smallBlockSize + hugeBlockSize);
+	*reinterpret_cast<std::uint32_t *>(data.data() + 0) = 0x1000;
+	*reinterpret_cast<std::uint32_t *>(data.data() + 4) = smallBlockSize;
+	*reinterpret_cast<std::uint32_t *>(data.data() + smallBlockSize + 0) = 0x2000;
+	*reinterpret_cast<std::uint32_t *>(data.data() + smallBlockSize + 4) = hugeBlockSize;
+
+	RelocationsDirectory relocations;
+	relocations.read(data.data(), data.size(), 0x5000);
+
+	EXPECT_EQ(LDR_ERROR_RELOC_ENTRY_COUNT_EXCEEDED, relocations.loaderError());
+	ASSERT_EQ(1, relocations.calcNumberOfRelocations());
+	EXPECT_EQ(0x1000, relocations.getVirtualAddress(0));
+	EXPECT_EQ(0x10, relocations.calcNumberOfRelocationData(0));
+}
+
+TEST_F(DirectoryTests, ResourceEntriesAboveLimitAreTruncated)
+{
+	addHugeResourceTree();
+
+	auto file = readDirectories(false);
+
+	EXPECT_EQ(LDR_ERROR_RSRC_ENTRY_COUNT_EXCEEDED, file->resDir().loaderError());
+}
+
+TEST_F(DirectoryTests, ConcurrentReadingGivesSameDirectoriesAsSerialReading)
+{
+	addHugeResourceTree();
+
+	auto serial = readDirectories(false);
+	auto concurrent = readDirectories(true);
+
+	EXPECT_EQ(serial->resDir().loaderError(), concurrent->resDir().loaderError());
+	EXPECT_EQ(serial->resDir().getRoot()->getNumberOfChildren(), concurrent->resDir().getRoot()->getNumberOfChildren());
+	EXPECT_EQ(serial->relocDir().loaderError(), concurrent->relocDir().loaderError());
+	ASSERT_EQ(1, serial->relocDir().calcNumberOfRelocations());
+	ASSERT_EQ(1, concurrent->relocDir().calcNumberOfRelocations());
+	EXPECT_EQ(serial->relocDir().getVirtualAddress(0), concurrent->relocDir().getVirtualAddress(0));
+	ASSERT_EQ(serial->relocDir().calcNumberOfRelocationData(0), concurrent->relocDir().calcNumberOfRelocationData(0));
+	for (unsigned int i = 0; i < serial->relocDir().calcNumberOfRelocationData(0); i++)
+	{
+		EXPECT_EQ(serial->relocDir().getRelocationData(0, i), concurrent->relocDir().getRelocationData(0, i));
+	}
+	EXPECT_EQ(serial->impDir().getNumberOfFiles(OLDDIR), concurrent->impDir().getNumberOfFiles(OLDDIR));
+	EXPECT_EQ(serial->loaderError(), concurrent->loaderError());
+}
+
+} // namespace tests
+} // namespace PeLib
@@ -0,0 +1,93 @@
+/**
+* @file tests/pelib/image_loader_tests.cpp
+* @brief Tests for the @c ImageLoader module.
+* @copyright (c) 2020 Avast Software, licensed under the MIT license
+*/
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/pelib/ImageLoader.h"
+#include "retdec/utils/filesystem.h"
+#include "pelib/pelib_tests.h"
+
+using namespace ::testing;
+
+namespace PeLib {
+namespace tests {
+
+/**
+* @brief Tests for the @c ImageLoader module.
+*/
+class ImageLoaderTests: public PeImageTests
+{
+	protected:
+		std::uint32_t readImage32(ImageLoader& loader, std::uint32_t rva)
+		{
+			std::uint32_t value = 0;
+			EXPECT_EQ(sizeof(value), loader.readImage(&value, rva, sizeof(value)));
+			return value;
+		}
+};
+
+TEST_F(ImageLoaderTests, RelocationsCopySharedPageOnWrite)
+{
+	ImageLoader loader;
+	ASSERT_EQ(ERROR_NONE, loader.Load(fileData, false, true));
+	ImageLoader copy = loader;
+
+	ASSERT_TRUE(loader.relocateImage(0x10000000));
+
+	EXPECT_EQ(0x10001020, readImage32(loader, 0x1010));
+	EXPECT_EQ(0x401020, readImage32(copy, 0x1010));
+	EXPECT_EQ(0x401020, *reinterpret_cast<std::uint32_t*>(fileData.data() + 0x410));
+}
+
+TEST_F(ImageLoaderTests, RelocationsDoNotChangeCopiedData)
+{
+	ImageLoader loader;
+	ASSERT_EQ(ERROR_NONE, loader.Load(fileData));
+	ImageLoader copy = loader;
+
+	ASSERT_TRUE(copy.relocateImage(0x10000000));
+
+	EXPECT_EQ(0x401020, readImage32(loader, 0x1010));
+	EXPECT_EQ(0x10001020, readImage32(copy, 0x1010));
+}
+
+TEST_F(ImageLoaderTests, VirtualOnlySectionIsReadAsZeros)
+{
+	ImageLoader loader;
+	ASSERT_EQ(ERROR_NONE, loader.Load(fileData, false, true));
+
+	ByteBuffer data(0x2000, 0xcc);
+	EXPECT_EQ(0x2000, loader.readImage(data.data(), 0x3000, 0x2000));
+	EXPECT_EQ(ByteBuffer(0x2000, 0), data);
+	EXPECT_EQ(0, loader.stringLength(0x3000));
+}
+
+TEST_F(ImageLoaderTests, LoadingMappedFileGivesSameImage)
+{
+	auto filePath = fs::temp_directory_path() / "retdec-image-loader-tests.bin";
+	{
+		std::ofstream file(filePath.string(), std::ios::binary);
+		file.write(reinterpret_cast<const char*>(fileData.data()), fileData.size());
+	}
+
+	ImageLoader fromFile;
+	ImageLoader fromData;
+	ASSERT_EQ(ERROR_NONE, fromFile.Load(filePath.string().c_str()));
+	ASSERT_EQ(ERROR_NONE, fromData.Load(fileData));
+	fs::remove(filePath);
+
+	ByteBuffer imageFromFile(0x5000);
+	ByteBuffer imageFromData(0x5000);
+	EXPECT_EQ(0x5000, fromFile.readImage(imageFromFile.data(), 0, 0x5000));
+	EXPECT_EQ(0x5000, fromData.readImage(imageFromData.data(), 0, 0x5000));
+	EXPECT_EQ(imageFromData, imageFromFile);
+	EXPECT_EQ(0x401020, readImage32(fromFile, 0x1010));
+}
+
+} // namespace tests
+} // namespace PeLib
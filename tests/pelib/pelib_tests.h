@@ -0,0 +1,118 @@
+/**
+* @file tests/pelib/pelib_tests.h
+* @brief Tests for the @c pelib module.
+* @copyright (c) 2020 Avast Software, licensed under the MIT license
+*/
+
+#ifndef TESTS_PELIB_PELIB_TESTS_H
+#define TESTS_PELIB_PELIB_TESTS_H
+
+#include <algorithm>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/pelib/PeLibAux.h"
+
+namespace PeLib {
+namespace tests {
+
+/**
+* @brief Base of tests that need a PE image.
+*
+* The image has a full page of code with one relocated address,
+* a relocation section and an uninitialized section without file data.
+*/
+class PeImageTests: public ::testing::Test
+{
+	protected:
+		virtual void SetUp() override
+		{
+			fileData.assign(0x1600, 0);
+
+			// DOS header and NT signature
+			put16(0x00, 0x5a4d);
+			put32(0x3c, 0x40);
+			put32(0x40, PELIB_IMAGE_NT_SIGNATURE);
+
+			// File header
+			put16(0x44, PELIB_IMAGE_FILE_MACHINE_I386);
+			put16(0x46, 3);
+			put16(0x54, sizeof(PELIB_IMAGE_OPTIONAL_HEADER32));
+			put16(0x56, PELIB_IMAGE_FILE_EXECUTABLE_IMAGE | PELIB_IMAGE_FILE_32BIT_MACHINE);
+
+			// Optional header
+			put16(0x58, PELIB_IMAGE_NT_OPTIONAL_HDR32_MAGIC);
+			put32(0x68, 0x1000);
+			put32(0x74, 0x400000);
+			put32(0x78, 0x1000);
+			put32(0x7c, 0x200);
+			put16(0x80, 4);
+			put16(0x88, 4);
+			put32(0x90, 0x5000);
+			put32(0x94, 0x400);
+			put16(0x9c, 2);
+			put32(0xa0, 0x100000);
+			put32(0xa4, 0x1000);
+			put32(0xa8, 0x100000);
+			put32(0xac, 0x1000);
+			put32(0xb4, 16);
+			putDataDirectory(PELIB_IMAGE_DIRECTORY_ENTRY_BASERELOC, 0x2000, 0x0c);
+
+			// Section headers
+			putSection(0, ".text", 0x1000, 0x1000, 0x1000, 0x400, 0x60000020);
+			putSection(1, ".reloc", 0x0c, 0x2000, 0x200, 0x1400, 0x42000040);
+			putSection(2, ".bss", 0x2000, 0x3000, 0, 0, 0xc0000080);
+
+			// Code with an absolute address and the relocation of it
+			put32(0x410, 0x401020);
+			put32(0x1400, 0x1000);
+			put32(0x1404, 0x0c);
+			put16(0x1408, (PELIB_IMAGE_REL_BASED_HIGHLOW << 12) | 0x10);
+		}
+
+		void put16(std::size_t offset, std::uint16_t value)
+		{
+			fileData[offset] = value & 0xff;
+			fileData[offset + 1] = value >> 8;
+		}
+
+		void put32(std::size_t offset, std::uint32_t value)
+		{
+			put16(offset, value & 0xffff);
+			put16(offset + 2, value >> 16);
+		}
+
+		void putDataDirectory(std::size_t index, std::uint32_t rva, std::uint32_t size)
+		{
+			put32(0xb8 + index * 8, rva);
+			put32(0xbc + index * 8, size);
+		}
+
+		void putSection(
+				std::size_t index,
+				const std::string& name,
+				std::uint32_t virtualSize,
+				std::uint32_t virtualAddress,
+				std::uint32_t sizeOfRawData,
+				std::uint32_t pointerToRawData,
+				std::uint32_t characteristics)
+		{
+			std::size_t offset = 0x138 + index * 0x28;
+
+			std::copy(name.begin(), name.end(), fileData.begin() + offset);
+			put32(offset + 8, virtualSize);
+			put32(offset + 12, virtualAddress);
+			put32(offset + 16, sizeOfRawData);
+			put32(offset + 20, pointerToRawData);
+			put32(offset + 36, characteristics);
+		}
+
+	protected:
+		ByteBuffer fileData;
+};
+
+} // namespace tests
+} // namespace PeLib
+
+#endif
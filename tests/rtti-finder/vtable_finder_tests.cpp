@@ -0,0 +1,203 @@
+/**
+ * @file tests/rtti-finder/vtable_finder_tests.cpp
+ * @brief Tests for the @c vtable_finder module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+#include "retdec/fileformat/types/sec_seg/section.h"
+#include "retdec/loader/loader/image.h"
+#include "retdec/rtti-finder/vtable/vtable_finder.h"
+
+using namespace ::testing;
+using namespace retdec::common;
+using namespace retdec::fileformat;
+using namespace retdec::loader;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace rtti_finder {
+namespace tests {
+
+/**
+ * Image with segments added by hand, in the given order.
+ */
+class TestImage : public Image
+{
+	public:
+		TestImage(const std::shared_ptr<FileFormat>& fileFormat) : Image(fileFormat) {}
+
+		virtual bool load() override
+		{
+			return true;
+		}
+
+		void addSegment(
+				const SecSeg* secSeg,
+				std::uint64_t address,
+				std::uint64_t size,
+				const std::vector<std::uint8_t>& data)
+		{
+			std::unique_ptr<SegmentDataSource> dataSource;
+			if (!data.empty())
+			{
+				llvm::StringRef dataRef(reinterpret_cast<const char*>(data.data()), data.size());
+				dataSource = std::make_unique<SegmentDataSource>(dataRef);
+			}
+			insertSegment(std::make_unique<retdec::loader::Segment>(secSeg, address, size, std::move(dataSource)));
+		}
+};
+
+class VtableFinderTests : public Test
+{
+	public:
+		struct SegmentInfo
+		{
+			std::string name;
+			SecSeg::Type type;
+			std::uint64_t address;
+			std::uint64_t size;
+			/// Number of bytes physically present in the file.
+			std::uint64_t physSize;
+		};
+
+		/**
+		 * Creates an image with data, overlapping, BSS, debug, code and
+		 * partially physical segments. Data of the segments are mixes of
+		 * zeros, pointers to all the segments and gaps between them, and
+		 * random words.
+		 */
+		std::unique_ptr<TestImage> createImage(std::size_t wordSize, Endianness endianness)
+		{
+			auto format = std::make_shared<RawDataFormat>(fileBytes.data(), fileBytes.size());
+			format->setBytesPerWord(wordSize);
+			format->setBytesLength(8);
+			format->setEndianness(endianness);
+			auto image = std::make_unique<TestImage>(format);
+
+			std::vector<SegmentInfo> infos = {
+				// Only a part of the segment is in the file, the rest is zeros.
+				{".data", SecSeg::Type::DATA, 0x1000, 0x400, 0x300},
+				// Size is not a multiple of the word size.
+				{".rdata", SecSeg::Type::CONST_DATA, 0x2000, 0x202, 0x202},
+				// Directly follows .rdata, its words are read across the bound.
+				{".data2", SecSeg::Type::DATA, 0x2202, 0x100, 0x100},
+				{".bss", SecSeg::Type::BSS, 0x3000, 0x200, 0},
+				{".debug", SecSeg::Type::DEBUG, 0x4000, 0x100, 0x100},
+				// Overlaps .data, which is used for the common addresses.
+				{".ovl", SecSeg::Type::DATA, 0x1200, 0x400, 0x400},
+				// Overlaps .bss, which has no data.
+				{".ovl2", SecSeg::Type::DATA, 0x3100, 0x200, 0x180},
+				{".text", SecSeg::Type::CODE, 0x5000, 0x100, 0x100},
+				// Only a part of the segment is in the file, no overlaps.
+				{".data3", SecSeg::Type::DATA, 0x7000, 0x300, 0x101},
+				// Segment without section is scanned, but it is not a target.
+				{"", SecSeg::Type::UNDEFINED_SEC_SEG, 0x6000, 0x81, 0x81},
+			};
+
+			std::vector<std::uint64_t> pointers = {0x1000, 0x1004, 0x12fc, 0x13fc,
+				0x1400, 0x15ff, 0x1600, 0x2000, 0x2201, 0x2202, 0x2301, 0x3000,
+				0x31ff, 0x3300, 0x4000, 0x40ff, 0x5000, 0x50ff, 0x5100, 0x6000,
+				0x7000, 0x72ff, 0x0, 0xfff};
+
+			std::mt19937 gen(wordSize);
+			for (const auto& info : infos)
+			{
+				const SecSeg* secSeg = nullptr;
+				if (!info.name.empty())
+				{
+					auto section = std::make_unique<Section>();
+					section->setName(info.name);
+					section->setType(info.type);
+					secSeg = section.get();
+					sections.push_back(std::move(section));
+				}
+
+				std::vector<std::uint8_t> bytes;
+				while (bytes.size() < info.physSize)
+				{
+					std::uint64_t word = 0;
+					switch (gen() % 4)
+					{
+						case 0: word = 0; break;
+						case 1:
+						case 2: word = pointers[gen() % pointers.size()]; break;
+						default: word = gen(); break;
+					}
+					for (std::size_t b = 0; b < wordSize; ++b)
+					{
+						auto shift = endianness == Endianness::LITTLE ? b : wordSize - b - 1;
+						bytes.push_back(word >> (8 * shift));
+					}
+				}
+				bytes.resize(info.physSize);
+				data.push_back(std::move(bytes));
+
+				image->addSegment(secSeg, info.address, info.size, data.back());
+			}
+
+			return image;
+		}
+
+		void expectSameCandidates(const Image* image, bool gcc)
+		{
+			std::set<Address> bulk;
+			std::set<Address> slow;
+			findPossibleVtables(image, bulk, gcc, true);
+			findPossibleVtables(image, slow, gcc, false);
+
+			EXPECT_FALSE(slow.empty());
+			EXPECT_EQ(slow, bulk);
+		}
+
+	private:
+		std::vector<std::uint8_t> fileBytes = std::vector<std::uint8_t>(16);
+		std::vector<std::unique_ptr<Section>> sections;
+		std::vector<std::vector<std::uint8_t>> data;
+};
+
+TEST_F(VtableFinderTests,
+BulkAndSlowScansFindSameGccCandidatesIn32BitLittleEndianImage) {
+	auto image = createImage(4, Endianness::LITTLE);
+
+	expectSameCandidates(image.get(), true);
+}
+
+TEST_F(VtableFinderTests,
+BulkAndSlowScansFindSameMsvcCandidatesIn32BitLittleEndianImage) {
+	auto image = createImage(4, Endianness::LITTLE);
+
+	expectSameCandidates(image.get(), false);
+}
+
+TEST_F(VtableFinderTests,
+BulkAndSlowScansFindSameCandidatesIn32BitBigEndianImage) {
+	auto image = createImage(4, Endianness::BIG);
+
+	expectSameCandidates(image.get(), true);
+	expectSameCandidates(image.get(), false);
+}
+
+TEST_F(VtableFinderTests,
+BulkAndSlowScansFindSameCandidatesIn64BitImage) {
+	auto image = createImage(8, Endianness::LITTLE);
+
+	expectSameCandidates(image.get(), true);
+	expectSameCandidates(image.get(), false);
+}
+
+TEST_F(VtableFinderTests,
+BulkAndSlowScansFindSameCandidatesIn16BitImage) {
+	auto image = createImage(2, Endianness::LITTLE);
+
+	expectSameCandidates(image.get(), true);
+	expectSameCandidates(image.get(), false);
+}
+
+} // namespace tests
+} // namespace rtti_finder
+} // namespace retdec
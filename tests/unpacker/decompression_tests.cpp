@@ -0,0 +1,515 @@
+/**
+* @file tests/unpacker/decompression_tests.cpp
+* @brief Tests for the NRV and LZMA decompression.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/unpacker/decompression/lzma/lzma_data.h"
+#include "retdec/unpacker/decompression/nrv/nrv2b_data.h"
+#include "retdec/unpacker/decompression/nrv/nrv2d_data.h"
+#include "retdec/unpacker/decompression/nrv/nrv2e_data.h"
+#include "retdec/utils/dynamic_buffer.h"
+
+using namespace ::testing;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace unpacker {
+namespace tests {
+
+namespace {
+
+enum class NrvVersion
+{
+	NRV2B,
+	NRV2D,
+	NRV2E
+};
+
+/**
+ * Writer of NRV bitstreams. Bit words are reserved in the output at the
+ * moment their first bit is written, the same way the decompressor reads
+ * them interleaved with the literal bytes.
+ */
+class NrvBitWriter
+{
+public:
+	NrvBitWriter(std::vector<uint8_t>& output, bool le32) : _output(output), _wordSize(le32 ? 4 : 1) {}
+
+	void putBit(uint32_t bit)
+	{
+		if (_bitsLeft == 0)
+		{
+			_wordPos = _output.size();
+			_output.resize(_output.size() + _wordSize);
+			_bitsLeft = _wordSize * 8;
+		}
+
+		--_bitsLeft;
+		if (bit)
+		{
+			// Bit words are little endian, bits are taken from the highest
+			uint32_t byteIndex = _wordSize == 1 ? 0 : _bitsLeft / 8;
+			_output[_wordPos + byteIndex] |= 1 << (_bitsLeft % 8);
+		}
+	}
+
+	void putByte(uint8_t byte)
+	{
+		_output.push_back(byte);
+	}
+
+private:
+	std::vector<uint8_t>& _output;
+	std::size_t _wordPos = 0;
+	uint32_t _wordSize;
+	uint32_t _bitsLeft = 0;
+};
+
+/**
+ * Simple greedy NRV compressor which produces streams the decompressors
+ * must decode back to @a data.
+ */
+class NrvCompressor
+{
+public:
+	NrvCompressor(NrvVersion version, bool le32) : _version(version), _le32(le32) {}
+
+	std::vector<uint8_t> compress(const std::vector<uint8_t>& data)
+	{
+		std::vector<uint8_t> output;
+		NrvBitWriter writer(output, _le32);
+		std::vector<int64_t> lastPos(1 << 16, -1);
+		uint32_t lastDist = 1;
+
+		std::size_t pos = 0;
+		while (pos < data.size())
+		{
+			uint32_t bestLen = 0, bestDist = 0;
+			if (pos + 3 <= data.size())
+			{
+				uint32_t h = hash(data, pos);
+				for (int64_t candidate : { static_cast<int64_t>(pos) - lastDist, lastPos[h] })
+				{
+					if (candidate < 0 || static_cast<std::size_t>(candidate) >= pos)
+						continue;
+
+					uint32_t len = 0;
+					while (pos + len < data.size() && len < 0x1000 && data[candidate + len] == data[pos + len])
+						++len;
+
+					uint32_t dist = static_cast<uint32_t>(pos - candidate);
+					if (len > bestLen && len >= 2 + (dist > farThreshold()))
+					{
+						bestLen = len;
+						bestDist = dist;
+					}
+				}
+				lastPos[h] = pos;
+			}
+
+			if (bestLen == 0)
+			{
+				writer.putBit(1);
+				writer.putByte(data[pos++]);
+				continue;
+			}
+
+			writer.putBit(0);
+			putMatch(writer, bestDist, bestLen, bestDist == lastDist);
+			lastDist = bestDist;
+			pos += bestLen;
+		}
+
+		// End marker
+		writer.putBit(0);
+		putOffsetGamma(writer, 0x1000002);
+		writer.putByte(0xFF);
+		return output;
+	}
+
+private:
+	static uint32_t hash(const std::vector<uint8_t>& data, std::size_t pos)
+	{
+		return ((data[pos] << 8) ^ (data[pos + 1] << 4) ^ data[pos + 2]) & 0xFFFF;
+	}
+
+	uint32_t farThreshold() const
+	{
+		return _version == NrvVersion::NRV2B ? 0xD00 : 0x500;
+	}
+
+	static void putGamma(NrvBitWriter& writer, uint32_t value)
+	{
+		uint32_t bits = 0;
+		while ((value >> bits) > 1)
+			++bits;
+
+		while (bits--)
+		{
+			writer.putBit((value >> bits) & 1);
+			writer.putBit(bits == 0);
+		}
+	}
+
+	void putOffsetGamma(NrvBitWriter& writer, uint32_t value)
+	{
+		if (_version == NrvVersion::NRV2B)
+			return putGamma(writer, value);
+
+		// Unwind (dist - 1) * 2 + bit continuation steps from the end
+		std::vector<uint32_t> bits = { value & 1, 1 };
+		uint32_t state = value >> 1;
+		while (state != 1)
+		{
+			uint32_t extraBit = state & 1;
+			uint32_t prev = (state >> 1) + 1;
+			bits.insert(bits.begin(), { prev & 1, 0, extraBit });
+			state = prev >> 1;
+		}
+
+		for (auto bit : bits)
+			writer.putBit(bit);
+	}
+
+	void putMatch(NrvBitWriter& writer, uint32_t dist, uint32_t len, bool useLastDist)
+	{
+		uint32_t count = len - 1 - (dist > farThreshold());
+
+		if (_version == NrvVersion::NRV2B)
+		{
+			if (useLastDist)
+				putOffsetGamma(writer, 2);
+			else
+			{
+				putOffsetGamma(writer, ((dist - 1) >> 8) + 3);
+				writer.putByte((dist - 1) & 0xFF);
+			}
+
+			if (count < 4)
+			{
+				writer.putBit(count >> 1);
+				writer.putBit(count & 1);
+			}
+			else
+			{
+				writer.putBit(0);
+				writer.putBit(0);
+				putGamma(writer, count - 2);
+			}
+			return;
+		}
+
+		// NRV2D and NRV2E carry the first bit of the count with the offset
+		uint32_t countBit;
+		if (_version == NrvVersion::NRV2D)
+			countBit = count < 4 ? count >> 1 : 0;
+		else
+			countBit = count < 3 ? 1 : 0;
+
+		if (useLastDist)
+		{
+			putOffsetGamma(writer, 2);
+			writer.putBit(countBit);
+		}
+		else
+		{
+			uint32_t value = ((dist - 1) << 1) | (countBit ^ 1);
+			putOffsetGamma(writer, (value >> 8) + 3);
+			writer.putByte(value & 0xFF);
+		}
+
+		if (_version == NrvVersion::NRV2D)
+		{
+			if (count < 4)
+				writer.putBit(count & 1);
+			else
+			{
+				writer.putBit(0);
+				putGamma(writer, count - 2);
+			}
+		}
+		else
+		{
+			if (count < 3)
+				writer.putBit(count - 1);
+			else if (count < 5)
+			{
+				writer.putBit(1);
+				writer.putBit(count - 3);
+			}
+			else
+			{
+				writer.putBit(0);
+				putGamma(writer, count - 3);
+			}
+		}
+	}
+
+	NrvVersion _version;
+	bool _le32;
+};
+
+std::vector<uint8_t> createSampleData(std::size_t size)
+{
+	static const char* words[] = { "mov", "eax", "push", "ebp", "call", "ret", "0x401000", "\n", " ", "," };
+
+	// Deterministic mix of repeating words, far repeats and noise
+	std::vector<uint8_t> data;
+	uint32_t seed = 0x12345678;
+	while (data.size() < size)
+	{
+		seed = seed * 1103515245 + 12345;
+		uint32_t r = seed >> 16;
+		if (r % 16 == 0)
+			data.push_back(r >> 8);
+		else if (r % 16 == 1 && data.size() > 0x2000)
+		{
+			std::size_t from = data.size() - 0x1000 - (r % 0x1000);
+			for (std::size_t i = 0; i < 32; ++i)
+				data.push_back(data[from + i]);
+		}
+		else
+		{
+			for (const char* c = words[r % 10]; *c; ++c)
+				data.push_back(*c);
+		}
+	}
+	data.resize(size);
+	return data;
+}
+
+std::unique_ptr<NrvData> createNrvData(NrvVersion version, const DynamicBuffer& buffer, BitParser* bitParser)
+{
+	switch (version)
+	{
+		case NrvVersion::NRV2B:
+			return std::make_unique<Nrv2bData>(buffer, bitParser);
+		case NrvVersion::NRV2D:
+			return std::make_unique<Nrv2dData>(buffer, bitParser);
+		default:
+			return std::make_unique<Nrv2eData>(buffer, bitParser);
+	}
+}
+
+std::unique_ptr<BitParser> createBitParser(bool le32)
+{
+	if (le32)
+		return std::make_unique<BitParserLe32>();
+	return std::make_unique<BitParser8>();
+}
+
+/**
+ * Bit parser which is none of the known ones, so it is called through
+ * the virtual interface.
+ */
+class CustomBitParser : public BitParser
+{
+public:
+	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
+	{
+		return _bitParser.getBit(bit, data, pos);
+	}
+
+private:
+	BitParser8 _bitParser;
+};
+
+/**
+ * LZMA stream (lc=3, lp=0, pb=2) of the data created by @c createLzmaData().
+ */
+const std::vector<uint8_t> lzmaStream = {
+	0x00, 0x29, 0x19, 0x4a, 0x86, 0x56, 0x09, 0x7c, 0xea, 0xa2, 0x49, 0x45, 0x0c, 0xf6, 0x8c, 0xbb,
+	0x22, 0xbb, 0xc2, 0x0c, 0x8d, 0xdb, 0xbb, 0x7a, 0xf4, 0x1b, 0x83, 0xaa, 0x28, 0x04, 0x9e, 0x4f,
+	0x1c, 0xf0, 0x8b, 0xab, 0x8b, 0x81, 0x2a, 0xe7, 0x2b, 0x19, 0xd3, 0xa6, 0xe7, 0x24, 0x73, 0x96,
+	0x6a, 0x04, 0xde, 0xe0, 0x4c, 0x61, 0x82, 0x33, 0xec, 0x11, 0xab, 0xe0, 0x75, 0x6c, 0x53, 0x86,
+	0x96, 0x0e, 0x47, 0xd0, 0x49, 0xcb, 0x71, 0x42, 0x26, 0xa1, 0xaa, 0xf6, 0x67, 0xce, 0x27, 0xb7,
+	0x31, 0x46, 0xc7, 0xae, 0xcb, 0xb2, 0x5e, 0x21, 0xc5, 0xcf, 0xc8, 0x3e, 0x35, 0x6c, 0x2f, 0xa2,
+	0xa4, 0xc3, 0x99, 0x38, 0x87, 0x05, 0x07, 0x75, 0x73, 0x72, 0xe2, 0x0e, 0x3f, 0x21, 0x13, 0xda,
+	0x41, 0xd9, 0x15, 0x3c, 0x21, 0x2c, 0x5d, 0xfd, 0x51, 0x0b, 0x82, 0x4d, 0xc2, 0xe1, 0xf0, 0x3b,
+	0xdc, 0x32, 0x25, 0x8b, 0xb4, 0xbc, 0x45, 0x4f, 0xff, 0xfc, 0xc7, 0x10, 0x00
+};
+
+std::vector<uint8_t> createLzmaData()
+{
+	std::string text;
+	for (int i = 0; i < 8; ++i)
+		text += "Retdec is a retargetable machine-code decompiler based on LLVM. ";
+
+	std::vector<uint8_t> data(text.begin(), text.end());
+	for (int i = 0; i < 64; ++i)
+		data.push_back(i);
+
+	std::string end = "The end.";
+	data.insert(data.end(), end.begin(), end.end());
+	return data;
+}
+
+} // anonymous namespace
+
+class DecompressionTests : public Test
+{
+protected:
+	void checkNrvRoundTrip(NrvVersion version, bool le32, const std::vector<uint8_t>& data)
+	{
+		DynamicBuffer packed(NrvCompressor(version, le32).compress(data));
+		auto bitParser = createBitParser(le32);
+		auto nrvData = createNrvData(version, packed, bitParser.get());
+
+		DynamicBuffer unpacked(static_cast<uint32_t>(data.size()));
+		EXPECT_TRUE(nrvData->decompress(unpacked));
+		EXPECT_EQ(data, unpacked.getBuffer());
+	}
+
+	double benchmarkNrv(NrvVersion version, bool le32, const std::vector<uint8_t>& data)
+	{
+		DynamicBuffer packed(NrvCompressor(version, le32).compress(data));
+		const int rounds = 10;
+
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < rounds; ++i)
+		{
+			auto bitParser = createBitParser(le32);
+			auto nrvData = createNrvData(version, packed, bitParser.get());
+			DynamicBuffer unpacked(static_cast<uint32_t>(data.size()));
+			EXPECT_TRUE(nrvData->decompress(unpacked));
+			EXPECT_EQ(data.size(), unpacked.getRealDataSize());
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		return rounds * data.size() / elapsed.count() / (1024 * 1024);
+	}
+};
+
+TEST_F(DecompressionTests,
+Nrv2bRoundTripWorks) {
+	auto data = createSampleData(0x10000);
+
+	checkNrvRoundTrip(NrvVersion::NRV2B, false, data);
+	checkNrvRoundTrip(NrvVersion::NRV2B, true, data);
+}
+
+TEST_F(DecompressionTests,
+Nrv2dRoundTripWorks) {
+	auto data = createSampleData(0x10000);
+
+	checkNrvRoundTrip(NrvVersion::NRV2D, false, data);
+	checkNrvRoundTrip(NrvVersion::NRV2D, true, data);
+}
+
+TEST_F(DecompressionTests,
+Nrv2eRoundTripWorks) {
+	auto data = createSampleData(0x10000);
+
+	checkNrvRoundTrip(NrvVersion::NRV2E, false, data);
+	checkNrvRoundTrip(NrvVersion::NRV2E, true, data);
+}
+
+TEST_F(DecompressionTests,
+NrvWithCustomBitParserWorks) {
+	auto data = createSampleData(0x1000);
+	DynamicBuffer packed(NrvCompressor(NrvVersion::NRV2E, false).compress(data));
+	CustomBitParser bitParser;
+	Nrv2eData nrvData(packed, &bitParser);
+
+	DynamicBuffer unpacked(static_cast<uint32_t>(data.size()));
+	EXPECT_TRUE(nrvData.decompress(unpacked));
+	EXPECT_EQ(data, unpacked.getBuffer());
+}
+
+TEST_F(DecompressionTests,
+NrvOutputIsLimitedByCapacity) {
+	auto data = createSampleData(0x1000);
+	DynamicBuffer packed(NrvCompressor(NrvVersion::NRV2B, false).compress(data));
+	BitParser8 bitParser;
+	Nrv2bData nrvData(packed, &bitParser);
+
+	DynamicBuffer unpacked(0x800);
+	EXPECT_FALSE(nrvData.decompress(unpacked));
+	EXPECT_EQ(0x800, unpacked.getRealDataSize());
+	EXPECT_EQ(std::vector<uint8_t>(data.begin(), data.begin() + 0x800), unpacked.getBuffer());
+}
+
+TEST_F(DecompressionTests,
+NrvTruncatedInputFails) {
+	auto data = createSampleData(0x1000);
+	auto packed = NrvCompressor(NrvVersion::NRV2D, true).compress(data);
+	packed.resize(packed.size() / 2);
+	DynamicBuffer packedBuffer(packed);
+	BitParserLe32 bitParser;
+	Nrv2dData nrvData(packedBuffer, &bitParser);
+
+	DynamicBuffer unpacked(static_cast<uint32_t>(data.size()));
+	EXPECT_FALSE(nrvData.decompress(unpacked));
+}
+
+TEST_F(DecompressionTests,
+LzmaDecompressionWorks) {
+	auto data = createLzmaData();
+	LzmaData lzmaData(DynamicBuffer(lzmaStream), 2, 0, 3);
+
+	DynamicBuffer unpacked(static_cast<uint32_t>(data.size()));
+	EXPECT_TRUE(lzmaData.decompress(unpacked));
+	EXPECT_EQ(data, unpacked.getBuffer());
+}
+
+TEST_F(DecompressionTests,
+LzmaOutputIsLimitedByCapacity) {
+	auto data = createLzmaData();
+	LzmaData lzmaData(DynamicBuffer(lzmaStream), 2, 0, 3);
+
+	DynamicBuffer unpacked(100);
+	EXPECT_TRUE(lzmaData.decompress(unpacked));
+	EXPECT_EQ(std::vector<uint8_t>(data.begin(), data.begin() + 100), unpacked.getBuffer());
+}
+
+TEST_F(DecompressionTests,
+LzmaInvalidPropertiesFail) {
+	LzmaData lzmaData(DynamicBuffer(lzmaStream), 5, 0, 3);
+
+	DynamicBuffer unpacked(0x100);
+	EXPECT_FALSE(lzmaData.decompress(unpacked));
+}
+
+/**
+ * Throughput of the decompressors. Run explicitly with
+ * --gtest_also_run_disabled_tests --gtest_filter=*Throughput*.
+ */
+TEST_F(DecompressionTests,
+DISABLED_NrvThroughput) {
+	auto data = createSampleData(0x1000000);
+
+	std::cout << "NRV2B/8:    " << benchmarkNrv(NrvVersion::NRV2B, false, data) << " MB/s" << std::endl;
+	std::cout << "NRV2B/LE32: " << benchmarkNrv(NrvVersion::NRV2B, true, data) << " MB/s" << std::endl;
+	std::cout << "NRV2D/8:    " << benchmarkNrv(NrvVersion::NRV2D, false, data) << " MB/s" << std::endl;
+	std::cout << "NRV2D/LE32: " << benchmarkNrv(NrvVersion::NRV2D, true, data) << " MB/s" << std::endl;
+	std::cout << "NRV2E/8:    " << benchmarkNrv(NrvVersion::NRV2E, false, data) << " MB/s" << std::endl;
+	std::cout << "NRV2E/LE32: " << benchmarkNrv(NrvVersion::NRV2E, true, data) << " MB/s" << std::endl;
+}
+
+TEST_F(DecompressionTests,
+DISABLED_LzmaThroughput) {
+	auto data = createLzmaData();
+	DynamicBuffer packed(lzmaStream);
+	const int rounds = 20000;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < rounds; ++i)
+	{
+		LzmaData lzmaData(packed, 2, 0, 3);
+		DynamicBuffer unpacked(static_cast<uint32_t>(data.size()));
+		EXPECT_TRUE(lzmaData.decompress(unpacked));
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	std::cout << "LZMA:       " << rounds * data.size() / elapsed.count() / (1024 * 1024) << " MB/s" << std::endl;
+}
+
+} // namespace tests
+} // namespace unpacker
+} // namespace retdec
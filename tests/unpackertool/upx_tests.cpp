@@ -0,0 +1,115 @@
+/**
+* @file tests/unpackertool/upx_tests.cpp
+* @brief Tests for the @c upx unpacking plugin.
+* @copyright (c) 2020 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/format_factory.h"
+#include "pelib/pelib_tests.h"
+#include "unpackertool/plugins/upx/upx.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+
+namespace retdec {
+namespace unpackertool {
+namespace upx {
+namespace tests {
+
+/**
+* @brief Tests for the @c UpxPlugin class.
+*
+* The PE image has neither the UPX section names nor a known unpacking stub
+* at its entry point.
+*/
+class UpxPluginTests: public PeLib::tests::PeImageTests
+{
+	protected:
+		static constexpr std::size_t MetadataOffset = 0x200;
+		static constexpr std::size_t MetadataSize = 32;
+
+		/**
+		* Puts UPX metadata of version 13 into the file.
+		*/
+		void putMetadata(bool validChecksum = true)
+		{
+			std::string magic = "UPX!";
+			std::copy(magic.begin(), magic.end(), fileData.begin() + MetadataOffset);
+			fileData[MetadataOffset + 4] = 13;
+			fileData[MetadataOffset + 5] = 9;
+			fileData[MetadataOffset + 6] = UPX_PACKING_METHOD_NRV2B_LE32;
+			fileData[MetadataOffset + 7] = 8;
+			put32(MetadataOffset + 16, 0x3000);
+			put32(MetadataOffset + 20, 0x1000);
+			fileData[MetadataOffset + 28] = 0x26;
+			fileData[MetadataOffset + 29] = 0x1;
+
+			std::uint32_t sum = 0;
+			for (std::size_t i = 4; i < MetadataSize - 1; ++i)
+			{
+				sum += fileData[MetadataOffset + i];
+			}
+			fileData[MetadataOffset + MetadataSize - 1] = sum % 251 + (validChecksum ? 0 : 1);
+		}
+
+		std::unique_ptr<FileFormat> createFile()
+		{
+			return createFileFormat(
+					fileData.data(),
+					fileData.size(),
+					false,
+					LoadFlags::PROFILE_UNPACKER);
+		}
+};
+
+TEST_F(UpxPluginTests, FileWithoutMetadataIsNotDetected)
+{
+	auto file = createFile();
+	ASSERT_NE(nullptr, file);
+
+	EXPECT_FALSE(UpxPlugin().detect(*file));
+}
+
+TEST_F(UpxPluginTests, FileWithUnknownStubAndMetadataIsDetected)
+{
+	putMetadata();
+	auto file = createFile();
+	ASSERT_NE(nullptr, file);
+
+	EXPECT_TRUE(UpxPlugin().detect(*file));
+}
+
+TEST_F(UpxPluginTests, FileWithUnknownStubAndInvalidMetadataIsNotDetected)
+{
+	putMetadata(false);
+	auto file = createFile();
+	ASSERT_NE(nullptr, file);
+
+	EXPECT_FALSE(UpxPlugin().detect(*file));
+}
+
+TEST_F(UpxPluginTests, MetadataAreReadFromFileBytes)
+{
+	putMetadata();
+	auto file = createFile();
+	ASSERT_NE(nullptr, file);
+
+	auto metadata = UpxMetadata::read(*file);
+	ASSERT_TRUE(metadata.isDefined());
+	EXPECT_EQ(MetadataOffset, metadata.getFileOffset());
+	EXPECT_EQ(MetadataSize, metadata.getFileSize());
+	EXPECT_EQ(UPX_PACKING_METHOD_NRV2B_LE32, metadata.getPackingMethod());
+	EXPECT_EQ(0x3000, metadata.getUnpackedDataSize());
+	EXPECT_EQ(0x1000, metadata.getPackedDataSize());
+	EXPECT_EQ(0x26, metadata.getFilterId());
+	EXPECT_EQ(0x1, metadata.getFilterParameter());
+}
+
+} // namespace tests
+} // namespace upx
+} // namespace unpackertool
+} // namespace retdec
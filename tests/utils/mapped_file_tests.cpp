@@ -0,0 +1,88 @@
+/**
+* @file tests/utils/mapped_file_tests.cpp
+* @brief Tests for the @c mapped_file module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/filesystem.h"
+#include "retdec/utils/mapped_file.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c mapped_file module.
+*/
+class MappedFileTests: public Test {
+protected:
+	virtual void SetUp() override {
+		filePath = fs::temp_directory_path() / "retdec-mapped-file-tests.bin";
+	}
+
+	virtual void TearDown() override {
+		fs::remove(filePath);
+	}
+
+	void writeTestFile(const std::string &content) {
+		std::ofstream file(filePath.string(), std::ios::binary);
+		file << content;
+	}
+
+protected:
+	fs::path filePath;
+};
+
+TEST_F(MappedFileTests,
+OpeningNonExistingFileFails) {
+	MappedFile file(filePath.string());
+
+	EXPECT_FALSE(file.isOpen());
+	EXPECT_EQ(nullptr, file.getData());
+	EXPECT_EQ(0, file.getSize());
+}
+
+TEST_F(MappedFileTests,
+OpenedFileProvidesItsContent) {
+	writeTestFile("retdec");
+
+	MappedFile file(filePath.string());
+
+	ASSERT_TRUE(file.isOpen());
+	ASSERT_EQ(6, file.getSize());
+	EXPECT_EQ("retdec", std::string(
+		reinterpret_cast<const char*>(file.getData()), file.getSize()));
+}
+
+TEST_F(MappedFileTests,
+EmptyFileCanBeOpened) {
+	writeTestFile("");
+
+	MappedFile file(filePath.string());
+
+	EXPECT_TRUE(file.isOpen());
+	EXPECT_EQ(0, file.getSize());
+}
+
+TEST_F(MappedFileTests,
+CloseReleasesTheFile) {
+	writeTestFile("retdec");
+	MappedFile file(filePath.string());
+
+	file.close();
+
+	EXPECT_FALSE(file.isOpen());
+	EXPECT_FALSE(file.isMapped());
+	EXPECT_EQ(nullptr, file.getData());
+	EXPECT_EQ(0, file.getSize());
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec